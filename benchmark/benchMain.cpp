@@ -0,0 +1,27 @@
+// 各组件的微基准测试，用法和google benchmark一样，比如
+//   microbench --benchmark_filter=SkipList --benchmark_out=result.json --benchmark_out_format=json
+// Persister、lsm引擎和rpc的provider都往当前目录写文件，运行期间切换到一个临时目录，结束后删掉
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+int main(int argc, char **argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  std::string dir = (std::filesystem::temp_directory_path() / "kvraft-bench-XXXXXX").string();
+  if (mkdtemp(dir.data()) == nullptr || chdir(dir.c_str()) != 0) {
+    std::cerr << "can not create work directory " << dir << std::endl;
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  std::error_code ec;
+  std::filesystem::remove_all(dir, ec);
+  // rpc的provider线程不会退出，直接结束进程
+  std::_Exit(0);
+}
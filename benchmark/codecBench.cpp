@@ -0,0 +1,111 @@
+// 日志里的Op编解码，和状态机快照的导出导入
+// KvServer::getSnapshotData/parseFromString在session表和范围之后直接调用存储引擎的DumpTo/Load，
+// 数据量大时时间基本都花在引擎上，这里对两种引擎分别测
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "kvEngine.h"
+#include "snapshotCodec.h"
+#include "util.h"
+
+namespace {
+
+Op makeOp(size_t valueSize) {
+  Op op;
+  op.Operation = "Put";
+  op.Key = "user:1234567890";
+  op.Value = std::string(valueSize, 'v');
+  op.ClientId = 1234567;
+  op.RequestId = 42;
+  op.Timestamp = 1700000000000;
+  return op;
+}
+
+void BM_OpAsString(benchmark::State &state) {
+  Op op = makeOp(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(op.asString());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_OpParseFromString(benchmark::State &state) {
+  std::string encoded = makeOp(state.range(0)).asString();
+  Op op;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(op.parseFromString(encoded));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// Batch日志：range(0)个100字节的子操作
+void BM_OpBatchRoundTrip(benchmark::State &state) {
+  std::vector<Op> ops(state.range(0), makeOp(100));
+  std::vector<Op> decoded;
+  for (auto _ : state) {
+    std::string data = Op::encodeBatch(ops);
+    decoded.clear();
+    benchmark::DoNotOptimize(Op::decodeBatch(data, &decoded));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// n个100字节value的有序快照，和跳表导出的格式一样
+std::string sortedSnapshot(long long n) {
+  std::string snapshot(SKIPLIST_SNAPSHOT_MAGIC, sizeof(SKIPLIST_SNAPSHOT_MAGIC));
+  SnapshotBlockWriter writer(&snapshot);
+  std::string value(100, 'v');
+  for (long long i = 0; i < n; ++i) {
+    writer.add(format("user:%012lld", i), value);
+  }
+  writer.finish();
+  return snapshot;
+}
+
+// Args: keys, engine（0是跳表，1是lsm）
+std::unique_ptr<KvEngine> filledEngine(long long n, bool lsm) {
+  std::unique_ptr<KvEngine> engine = NewKvEngine(lsm ? "lsm" : "", "lsmBench");
+  std::string snapshot = sortedSnapshot(n);
+  engine->Load(snapshot.data(), snapshot.size());
+  return engine;
+}
+
+void BM_EngineDumpTo(benchmark::State &state) {
+  auto engine = filledEngine(state.range(0), state.range(1) != 0);
+  size_t bytes = 0;
+  for (auto _ : state) {
+    std::string out;
+    engine->DumpTo(&out);
+    bytes = out.size();
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * bytes);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_EngineLoad(benchmark::State &state) {
+  std::string snapshot = sortedSnapshot(state.range(0));
+  std::unique_ptr<KvEngine> engine = NewKvEngine(state.range(1) != 0 ? "lsm" : "", "lsmBench");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(engine->Load(snapshot.data(), snapshot.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * snapshot.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void EngineArgs(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"keys", "lsm"});
+  for (long long n : {10000, 100000, 1000000}) {
+    b->Args({n, 0});
+    b->Args({n, 1});
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_OpAsString)->Arg(16)->Arg(1024)->Arg(64 << 10);
+BENCHMARK(BM_OpParseFromString)->Arg(16)->Arg(1024)->Arg(64 << 10);
+BENCHMARK(BM_OpBatchRoundTrip)->Arg(16)->Arg(256);
+BENCHMARK(BM_EngineDumpTo)->Apply(EngineArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_EngineLoad)->Apply(EngineArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
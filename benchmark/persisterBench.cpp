@@ -0,0 +1,139 @@
+// 持久化层写日志和hard state的吞吐，以及线程间传递消息的队列
+// 文件写在当前目录下（benchMain切换到的临时目录），PERSIST_FSYNC为true时每次Sync都有一次fdatasync
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Persister.h"
+#include "mpscQueue.h"
+#include "util.h"
+
+namespace {
+
+// 每个benchmark用自己的节点号，不会回放别的benchmark留下的日志
+int nextNode() {
+  static std::atomic<int> node{0};
+  return node.fetch_add(1);
+}
+
+// 一条日志一次Sync，follower收到单条AE时就是这样
+void BM_PersisterAppendSync(benchmark::State &state) {
+  Persister persister(nextNode());
+  std::string entry(state.range(0), 'e');
+  int index = 1;
+  for (auto _ : state) {
+    persister.AppendLog(index++, entry);
+    persister.Sync();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  state.SetItemsProcessed(state.iterations());
+}
+
+// range(1)条日志一起追加再Sync，leader攒批之后的写法
+void BM_PersisterAppendBatchSync(benchmark::State &state) {
+  Persister persister(nextNode());
+  std::vector<std::string> entries(state.range(1), std::string(state.range(0), 'e'));
+  int index = 1;
+  for (auto _ : state) {
+    persister.AppendLogs(index, entries);
+    persister.Sync();
+    index += static_cast<int>(entries.size());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(1));
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+// 多个线程同时追加各自的组，靠group commit合并成一次fdatasync
+std::shared_ptr<WalLog> g_sharedWal;
+std::vector<std::unique_ptr<Persister>> g_groups;
+
+void SetupGroups(const benchmark::State &state) {
+  int me = nextNode();
+  g_sharedWal = std::make_shared<WalLog>(me);
+  for (int g = 0; g < state.threads(); ++g) {
+    g_groups.emplace_back(new Persister(me, g, g_sharedWal));
+  }
+}
+
+void TeardownGroups(const benchmark::State &) {
+  g_groups.clear();
+  g_sharedWal.reset();
+}
+
+void BM_PersisterGroupCommit(benchmark::State &state) {
+  Persister &persister = *g_groups[state.thread_index()];
+  std::string entry(state.range(0), 'e');
+  int index = 1;
+  for (auto _ : state) {
+    persister.AppendLog(index++, entry);
+    persister.Sync();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_PersisterSaveHardState(benchmark::State &state) {
+  Persister persister(nextNode());
+  int term = 0;
+  for (auto _ : state) {
+    persister.SaveHardState(++term, 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LockQueuePushPop(benchmark::State &state) {
+  LockQueue<int> queue;
+  for (auto _ : state) {
+    queue.Push(1);
+    benchmark::DoNotOptimize(queue.Pop());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// 另一个线程把收到的消息原样送回来，一次迭代是一个来回，测的是跨线程唤醒的延迟
+void BM_LockQueuePingPong(benchmark::State &state) {
+  LockQueue<int> ping, pong;
+  std::thread echo([&]() {
+    for (int v; (v = ping.Pop()) >= 0;) {
+      pong.Push(v);
+    }
+  });
+  for (auto _ : state) {
+    ping.Push(1);
+    benchmark::DoNotOptimize(pong.Pop());
+  }
+  ping.Push(-1);
+  echo.join();
+  state.SetItemsProcessed(state.iterations());
+}
+
+// raft交给apply线程的队列，作为对照
+void BM_MpscQueuePingPong(benchmark::State &state) {
+  MpscQueue<int> ping(1024), pong(1024);
+  std::thread echo([&]() {
+    for (int v = 0; v >= 0;) {
+      if (ping.popFor(&v, 1000) && v >= 0) {
+        pong.push(std::move(v));
+      }
+    }
+  });
+  int v = 0;
+  for (auto _ : state) {
+    ping.push(1);
+    pong.popFor(&v, 1000);
+  }
+  ping.push(-1);
+  echo.join();
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_PersisterAppendSync)->Arg(128)->Arg(4096)->UseRealTime();
+BENCHMARK(BM_PersisterAppendBatchSync)->Args({128, 64})->Args({4096, 64})->UseRealTime();
+BENCHMARK(BM_PersisterGroupCommit)->Arg(128)->ThreadRange(1, 8)->Setup(SetupGroups)->Teardown(TeardownGroups)->UseRealTime();
+BENCHMARK(BM_PersisterSaveHardState)->UseRealTime();
+BENCHMARK(BM_LockQueuePushPop);
+BENCHMARK(BM_LockQueuePingPong)->UseRealTime();
+BENCHMARK(BM_MpscQueuePingPong)->UseRealTime();
@@ -0,0 +1,148 @@
+// 本机回环上的rpc往返：RpcProvider发布一个直接回复的raftRpc服务，MprpcChannel调用它的AppendEntries
+// 测的是请求帧的序列化、压缩、收发和分发到worker协程的开销，不含raft本身
+#include <benchmark/benchmark.h>
+#include <google/protobuf/stubs/callback.h>
+#include <unistd.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "mprpcchannel.h"
+#include "mprpcconfig.h"
+#include "mprpccontroller.h"
+#include "raftRPC.pb.h"
+#include "rpcprovider.h"
+
+namespace {
+
+class EchoRaftService : public raftRpcProctoc::raftRpc {
+ public:
+  void AppendEntries(google::protobuf::RpcController *controller, const raftRpcProctoc::AppendEntriesArgs *request,
+                     raftRpcProctoc::AppendEntriesReply *response, google::protobuf::Closure *done) override {
+    response->set_term(request->term());
+    response->set_success(true);
+    response->set_updatenextindex(request->prevlogindex() + request->entries_size() + 1);
+    done->Run();
+  }
+};
+
+// 整个进程只起一个provider，Run不会返回，放在单独的线程里；地址从它写出的test.conf里读
+struct LoopbackServer {
+  LoopbackServer() {
+    port = static_cast<short>(30000 + getpid() % 20000);
+    std::thread([this]() {
+      RpcProvider provider;
+      provider.NotifyService(&service, true);
+      provider.Run(0, port);
+    }).detach();
+    for (int i = 0; i < 100 && ip.empty(); ++i) {
+      usleep(50 * 1000);
+      MprpcConfig config;
+      config.LoadConfigFile("test.conf");
+      ip = config.Load("node0ip");
+    }
+    // test.conf写出时监听还没开始，再等一下
+    usleep(200 * 1000);
+  }
+
+  EchoRaftService service;
+  short port;
+  std::string ip;
+};
+
+LoopbackServer &server() {
+  static LoopbackServer s;
+  return s;
+}
+
+raftRpcProctoc::AppendEntriesArgs makeArgs(int entries, int entrySize) {
+  raftRpcProctoc::AppendEntriesArgs args;
+  args.set_term(1);
+  args.set_leaderid(0);
+  args.set_prevlogindex(100);
+  args.set_prevlogterm(1);
+  args.set_leadercommit(100);
+  for (int i = 0; i < entries; ++i) {
+    auto *entry = args.add_entries();
+    entry->set_command(std::string(entrySize, 'c'));
+    entry->set_logterm(1);
+    entry->set_logindex(101 + i);
+  }
+  return args;
+}
+
+// Args: 条目数, 每条的大小；同步channel，一次迭代一个来回
+void BM_RpcRoundTrip(benchmark::State &state) {
+  LoopbackServer &s = server();
+  raftRpcProctoc::raftRpc_Stub stub(new MprpcChannel(s.ip, s.port, true),
+                                    google::protobuf::Service::STUB_OWNS_CHANNEL);
+  auto args = makeArgs(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+  size_t bytes = args.ByteSizeLong();
+  for (auto _ : state) {
+    MprpcController controller;
+    raftRpcProctoc::AppendEntriesReply reply;
+    stub.AppendEntries(&controller, &args, &reply, nullptr);
+    if (controller.Failed()) {
+      state.SkipWithError(controller.ErrorText().c_str());
+      break;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * bytes);
+  state.SetItemsProcessed(state.iterations());
+}
+
+// 异步channel上保持range(0)个请求在途，raft的流水线复制就是这样用的
+void BM_RpcPipelined(benchmark::State &state) {
+  LoopbackServer &s = server();
+  raftRpcProctoc::raftRpc_Stub stub(new MprpcChannel(s.ip, s.port, false, true, 1),
+                                    google::protobuf::Service::STUB_OWNS_CHANNEL);
+  auto args = makeArgs(1, 128);
+  const int depth = static_cast<int>(state.range(0));
+  std::mutex mtx;
+  std::condition_variable cv;
+  int inflight = 0;
+  std::atomic<bool> failed{false};
+
+  struct Call {
+    MprpcController controller;
+    raftRpcProctoc::AppendEntriesReply reply;
+  };
+  auto onDone = [&](Call *call) {
+    if (call->controller.Failed()) {
+      failed = true;
+    }
+    delete call;
+    std::lock_guard<std::mutex> lock(mtx);
+    --inflight;
+    cv.notify_one();
+  };
+  for (auto _ : state) {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      cv.wait(lock, [&] { return inflight < depth; });
+      ++inflight;
+    }
+    auto *call = new Call;
+    stub.AppendEntries(&call->controller, &args, &call->reply,
+                       google::protobuf::NewCallback(+[](decltype(onDone) *fn, Call *c) { (*fn)(c); }, &onDone, call));
+  }
+  std::unique_lock<std::mutex> lock(mtx);
+  cv.wait(lock, [&] { return inflight == 0; });
+  if (failed) {
+    state.SkipWithError("rpc failed");
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_RpcRoundTrip)
+    ->ArgNames({"entries", "entry_size"})
+    ->Args({0, 0})
+    ->Args({1, 128})
+    ->Args({64, 128})
+    ->Args({16, 64 << 10})
+    ->UseRealTime();
+BENCHMARK(BM_RpcPipelined)->ArgName("depth")->Arg(1)->Arg(16)->Arg(128)->UseRealTime();
@@ -0,0 +1,137 @@
+// 跳表的点查、插入删除、覆盖写，按数据量、max_level、hash索引和线程数组合
+// 预先装入的key是0, 2, 4, ... 2(n-1)，插入用奇数key，表的大小在测量过程中保持不变
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include "skipList.h"
+#include "snapshotCodec.h"
+
+namespace {
+
+template <typename K>
+K makeKey(long long i);
+
+template <>
+int makeKey<int>(long long i) {
+  return static_cast<int>(i);
+}
+
+// 补0保证字符串的顺序和数字一样，load_from要求输入有序
+template <>
+std::string makeKey<std::string>(long long i) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), "key%012lld", i);
+  return buf;
+}
+
+template <typename V>
+V makeValue();
+
+template <>
+int makeValue<int>() {
+  return 1;
+}
+
+template <>
+std::string makeValue<std::string>() {
+  return std::string(100, 'v');
+}
+
+// 同一组参数的benchmark（包括多线程时的各个线程）共用一张装好的表，参数变了才重建
+// 只留一张，1e7个key的表不会同时存在好几张
+template <typename K, typename V>
+std::shared_ptr<SkipList<K, V>> filledList(long long n, int maxLevel, bool hashIndex) {
+  static std::mutex mtx;
+  static std::shared_ptr<SkipList<K, V>> cached;
+  static long long cachedN = -1;
+  static int cachedLevel = -1;
+  static bool cachedIndex = false;
+  std::lock_guard<std::mutex> lock(mtx);
+  if (cached && cachedN == n && cachedLevel == maxLevel && cachedIndex == hashIndex) {
+    return cached;
+  }
+  cached.reset();
+  // 直接拼一份有序的快照交给load_from线性建表，比逐个插入快得多
+  std::string snapshot(SKIPLIST_SNAPSHOT_MAGIC, sizeof(SKIPLIST_SNAPSHOT_MAGIC));
+  SnapshotBlockWriter writer(&snapshot);
+  V value = makeValue<V>();
+  for (long long i = 0; i < n; ++i) {
+    writer.add(makeKey<K>(2 * i), value);
+  }
+  writer.finish();
+  cached = std::make_shared<SkipList<K, V>>(maxLevel, hashIndex);
+  cached->load_from(snapshot.data(), snapshot.size());
+  cachedN = n;
+  cachedLevel = maxLevel;
+  cachedIndex = hashIndex;
+  return cached;
+}
+
+// Args: n, max_level, hash_index
+template <typename K, typename V>
+void BM_SkipListSearch(benchmark::State &state) {
+  long long n = state.range(0);
+  auto list = filledList<K, V>(n, static_cast<int>(state.range(1)), state.range(2) != 0);
+  std::mt19937_64 rng(state.thread_index() + 1);
+  std::uniform_int_distribution<long long> dist(0, n - 1);
+  V value;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(list->search_element(makeKey<K>(2 * dist(rng)), value));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// 插入一个不存在的key再删掉它，各线程用不同的奇数key
+template <typename K, typename V>
+void BM_SkipListInsertDelete(benchmark::State &state) {
+  long long n = state.range(0);
+  auto list = filledList<K, V>(n, static_cast<int>(state.range(1)), state.range(2) != 0);
+  std::mt19937_64 rng(state.thread_index() + 1);
+  std::uniform_int_distribution<long long> dist(0, n / state.threads());
+  V value = makeValue<V>();
+  for (auto _ : state) {
+    K key = makeKey<K>(2 * (dist(rng) * state.threads() + state.thread_index()) + 1);
+    list->insert_element(key, value);
+    list->delete_element(key);
+  }
+  state.SetItemsProcessed(2 * state.iterations());
+}
+
+// 覆盖已有的key，KvServer里每个Put走的都是这条路径
+template <typename K, typename V>
+void BM_SkipListUpdate(benchmark::State &state) {
+  long long n = state.range(0);
+  auto list = filledList<K, V>(n, static_cast<int>(state.range(1)), state.range(2) != 0);
+  std::mt19937_64 rng(state.thread_index() + 1);
+  std::uniform_int_distribution<long long> dist(0, n / state.threads() - 1);
+  V value = makeValue<V>();
+  for (auto _ : state) {
+    K key = makeKey<K>(2 * (dist(rng) * state.threads() + state.thread_index()));
+    list->insert_set_element(key, value);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void ListArgs(benchmark::internal::Benchmark *b, long long maxKeys) {
+  b->ArgNames({"keys", "max_level", "hash_index"});
+  for (long long n = 1000; n <= maxKeys; n *= 10) {
+    for (int level : {4, 16, SKIPLIST_MAX_LEVEL}) {
+      b->Args({n, level, 0});
+    }
+    b->Args({n, SKIPLIST_MAX_LEVEL, 1});
+  }
+}
+
+void IntListArgs(benchmark::internal::Benchmark *b) { ListArgs(b, 10000000); }
+// 100字节的value，1e7个key要好几GB内存，字符串只测到1e6
+void StringListArgs(benchmark::internal::Benchmark *b) { ListArgs(b, 1000000); }
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_SkipListSearch, int, int)->Apply(IntListArgs)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SkipListSearch, std::string, std::string)->Apply(StringListArgs)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SkipListInsertDelete, int, int)->Apply(IntListArgs)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SkipListInsertDelete, std::string, std::string)->Apply(StringListArgs)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SkipListUpdate, std::string, std::string)->Apply(StringListArgs)->Threads(1)->UseRealTime();
@@ -0,0 +1,676 @@
+// YCSB风格的压测工具：先装载recordcount条记录，再按A~F中的一种负载跑，输出每种操作的吞吐和延迟分布
+// 闭环（默认）：每个线程发完一个请求等它回来再发下一个，测的是系统能跑多快
+// 开环（--target）：按固定速率发请求，不等前一个回来，延迟从“本来该发出的时间”算起，
+//   系统跟不上时排队的时间也算进延迟里（避免coordinated omission），测的是给定压力下的延迟
+// 结果是一行JSON（--output写到文件），--hgrm给出前缀时每种操作另外写一个HdrHistogram的百分位分布文件
+// 用raftCoreRun -f test.conf起好集群之后：kvbench -f test.conf -w a -t 16
+#include <getopt.h>
+#include <unistd.h>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "clerk.h"
+#include "latencyHistogram.h"
+#include "util.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum OpKind { OP_READ, OP_UPDATE, OP_INSERT, OP_SCAN, OP_RMW, OP_KINDS };
+const char *const kOpNames[OP_KINDS] = {"READ", "UPDATE", "INSERT", "SCAN", "READ-MODIFY-WRITE"};
+
+enum Distribution { DIST_UNIFORM, DIST_ZIPFIAN, DIST_LATEST, DIST_CONSTANT };
+
+struct Options {
+  std::string configFile = "test.conf";
+  char workload = 'a';
+  long long recordCount = 100000;
+  long long operationCount = 100000;
+  int durationSec = 0;            // 大于0时按时间跑，operationCount不再限制
+  int warmupSec = 0;              // 开始这么多秒内完成的请求不计入统计
+  int threads = 8;
+  double targetOps = 0;           // 所有线程合计的目标速率，0表示闭环
+  int maxInflight = 128;          // 开环时每个线程最多在途的请求数
+  Distribution keyDist = DIST_ZIPFIAN;
+  bool keyDistSet = false;        // 没有指定时用负载自己的分布（D是latest，其他是zipfian）
+  double zipfianTheta = 0.99;
+  int keyLength = 0;              // key在"user"后面补0补到这么长，0表示不补
+  int valueSize = 100;
+  int valueMinSize = 1;
+  Distribution valueDist = DIST_CONSTANT;
+  int maxScanLength = 100;
+  int loadBatch = 100;            // 装载时一次BatchPut的条数
+  bool doLoad = true;
+  bool doRun = true;
+  int statusIntervalSec = 10;
+  bool followerRead = false;
+  std::string output;
+  std::string hgrmPrefix;
+};
+
+// YCSB core workload的操作比例
+struct Mix {
+  double read, update, insert, scan, rmw;
+};
+
+Mix workloadMix(char w) {
+  switch (w) {
+    case 'a':
+      return {0.5, 0.5, 0, 0, 0};
+    case 'b':
+      return {0.95, 0.05, 0, 0, 0};
+    case 'c':
+      return {1, 0, 0, 0, 0};
+    case 'd':
+      return {0.95, 0, 0.05, 0, 0};
+    case 'e':
+      return {0, 0, 0.05, 0.95, 0};
+    case 'f':
+      return {0.5, 0, 0, 0, 0.5};
+    default:
+      return {0, 0, 0, 0, 0};
+  }
+}
+
+uint64_t fnvHash64(uint64_t v) {
+  uint64_t hash = 0xCBF29CE484222325ULL;
+  for (int i = 0; i < 8; ++i) {
+    hash ^= v & 0xff;
+    hash *= 1099511628211ULL;
+    v >>= 8;
+  }
+  return hash;
+}
+
+// YCSB的ZipfianGenerator（Gray等人的快速算法），0最热；项数变多时增量更新zeta，不用重新算整个和
+class ZipfianGenerator {
+ public:
+  ZipfianGenerator(long long items, double theta) : m_theta(theta), m_items(0), m_zetan(0) {
+    m_alpha = 1.0 / (1.0 - theta);
+    m_zeta2 = 1.0 + std::pow(0.5, theta);
+    grow(items);
+  }
+
+  long long next(std::mt19937_64 &rng, long long items) {
+    if (items > m_items) {
+      grow(items);
+    }
+    double u = std::uniform_real_distribution<double>(0, 1)(rng);
+    double uz = u * m_zetan;
+    if (uz < 1.0) {
+      return 0;
+    }
+    if (uz < m_zeta2) {
+      return 1;
+    }
+    long long v = static_cast<long long>(m_items * std::pow(m_eta * u - m_eta + 1, m_alpha));
+    return v < m_items ? v : m_items - 1;
+  }
+
+ private:
+  void grow(long long items) {
+    for (long long i = m_items + 1; i <= items; ++i) {
+      m_zetan += 1.0 / std::pow(static_cast<double>(i), m_theta);
+    }
+    m_items = items;
+    m_eta = (1 - std::pow(2.0 / m_items, 1 - m_theta)) / (1 - m_zeta2 / m_zetan);
+  }
+
+  double m_theta;
+  long long m_items;
+  double m_zetan;
+  double m_zeta2;
+  double m_alpha;
+  double m_eta;
+};
+
+std::string buildKey(long long keyNum, int keyLength) {
+  std::string digits = std::to_string(fnvHash64(static_cast<uint64_t>(keyNum)));
+  std::string key = "user";
+  if (keyLength > static_cast<int>(key.size() + digits.size())) {
+    key.append(keyLength - key.size() - digits.size(), '0');
+  }
+  return key + digits;
+}
+
+// 所有线程共享的运行状态
+struct Shared {
+  explicit Shared(const Options &o) : opts(o), mix(workloadMix(o.workload)) {}
+
+  const Options &opts;
+  Mix mix;
+  std::atomic<long long> insertNext{0};     // 下一条要插入的记录号
+  std::atomic<long long> issued{0};         // 已经发出的操作数，用来按operationCount停止
+  std::atomic<long long> completed{0};
+  std::atomic<bool> stop{false};
+  Clock::time_point measureFrom;            // 这之后完成的请求才记录
+  LatencyHistogram hist[OP_KINDS];
+  std::atomic<long long> notFound[OP_KINDS] = {};
+};
+
+// 一个客户端线程，自己的Clerk、随机数和分布
+class Client {
+ public:
+  Client(Shared *shared, int id, const ZipfianGenerator &zipf)
+      : m_shared(shared), m_opts(shared->opts), m_rng(0x9E3779B97F4A7C15ULL * (id + 1)), m_zipf(zipf) {
+    m_clerk.Init(m_opts.configFile);
+    m_clerk.SetFollowerRead(m_opts.followerRead);
+    // 值从一段随机字符里按随机偏移截取，不用每次都生成
+    m_valuePool.resize(std::max(m_opts.valueSize, 1) * 2 + 4096);
+    std::uniform_int_distribution<int> ch('a', 'z');
+    for (auto &c : m_valuePool) {
+      c = static_cast<char>(ch(m_rng));
+    }
+  }
+
+  void load(long long begin, long long end) {
+    std::vector<std::pair<std::string, std::string>> batch;
+    for (long long k = begin; k < end; ++k) {
+      batch.emplace_back(buildKey(k, m_opts.keyLength), nextValue());
+      if (static_cast<int>(batch.size()) >= m_opts.loadBatch || k + 1 == end) {
+        m_clerk.BatchPut(batch);
+        batch.clear();
+      }
+    }
+  }
+
+  void runClosedLoop() {
+    while (claimOp()) {
+      Clock::time_point start = Clock::now();
+      OpKind kind = nextKind();
+      bool found = execute(kind);
+      finish(kind, start, found);
+    }
+  }
+
+  // 每个线程负担目标速率的1/threads，第i个请求本来该在 start + i*interval 发出
+  void runOpenLoop(Clock::time_point start) {
+    double perThread = m_opts.targetOps / m_opts.threads;
+    auto interval = std::chrono::duration<double>(1.0 / perThread);
+    for (long long i = 0; claimOp(); ++i) {
+      auto intended = start + std::chrono::duration_cast<Clock::duration>(interval * i);
+      std::this_thread::sleep_until(intended);
+      {
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_cv.wait(lock, [this] { return m_inflight < m_opts.maxInflight; });
+        ++m_inflight;
+      }
+      issueAsync(nextKind(), intended);
+    }
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_cv.wait(lock, [this] { return m_inflight == 0; });
+  }
+
+ private:
+  bool claimOp() {
+    if (m_shared->stop.load(std::memory_order_relaxed)) {
+      return false;
+    }
+    if (m_opts.durationSec > 0) {
+      return true;
+    }
+    return m_shared->issued.fetch_add(1, std::memory_order_relaxed) < m_opts.operationCount;
+  }
+
+  OpKind nextKind() {
+    const Mix &m = m_shared->mix;
+    double r = std::uniform_real_distribution<double>(0, 1)(m_rng);
+    if ((r -= m.read) < 0) {
+      return OP_READ;
+    }
+    if ((r -= m.update) < 0) {
+      return OP_UPDATE;
+    }
+    if ((r -= m.insert) < 0) {
+      return OP_INSERT;
+    }
+    if ((r -= m.scan) < 0) {
+      return OP_SCAN;
+    }
+    return m.rmw > 0 ? OP_RMW : OP_READ;
+  }
+
+  // 已有记录里按分布挑一条；插入中的记录可能还没有写完，读到空时算作not found
+  std::string nextKey() {
+    long long items = std::max(m_shared->insertNext.load(std::memory_order_relaxed), 1LL);
+    long long k;
+    switch (m_opts.keyDist) {
+      case DIST_UNIFORM:
+        k = std::uniform_int_distribution<long long>(0, items - 1)(m_rng);
+        break;
+      case DIST_LATEST:
+        k = items - 1 - m_zipf.next(m_rng, items);
+        break;
+      default:
+        // 打散之后热点不集中在相邻的记录号上
+        k = static_cast<long long>(fnvHash64(m_zipf.next(m_rng, items)) % static_cast<uint64_t>(items));
+        break;
+    }
+    return buildKey(k, m_opts.keyLength);
+  }
+
+  std::string insertKey() { return buildKey(m_shared->insertNext.fetch_add(1), m_opts.keyLength); }
+
+  std::string nextValue() {
+    int size = m_opts.valueSize;
+    if (m_opts.valueDist == DIST_UNIFORM) {
+      size = std::uniform_int_distribution<int>(m_opts.valueMinSize, m_opts.valueSize)(m_rng);
+    } else if (m_opts.valueDist == DIST_ZIPFIAN) {
+      // 小的值多，大的值少
+      static thread_local ZipfianGenerator sizes(m_opts.valueSize - m_opts.valueMinSize + 1, m_opts.zipfianTheta);
+      size = m_opts.valueMinSize + static_cast<int>(sizes.next(m_rng, m_opts.valueSize - m_opts.valueMinSize + 1));
+    }
+    size_t offset = std::uniform_int_distribution<size_t>(0, m_valuePool.size() - size)(m_rng);
+    return m_valuePool.substr(offset, size);
+  }
+
+  // 同步执行一个操作，返回读到的key是否存在（写操作总是true）
+  bool execute(OpKind kind) {
+    switch (kind) {
+      case OP_READ:
+        return !m_clerk.Get(nextKey()).empty();
+      case OP_UPDATE:
+        m_clerk.Put(nextKey(), nextValue());
+        return true;
+      case OP_INSERT:
+        m_clerk.Put(insertKey(), nextValue());
+        return true;
+      case OP_SCAN: {
+        int len = std::uniform_int_distribution<int>(1, m_opts.maxScanLength)(m_rng);
+        return !m_clerk.Scan(nextKey(), "", len).empty();
+      }
+      case OP_RMW: {
+        std::string key = nextKey();
+        bool found = !m_clerk.Get(key).empty();
+        m_clerk.Put(key, nextValue());
+        return found;
+      }
+      default:
+        return true;
+    }
+  }
+
+  // Scan没有异步接口，在本线程里同步做，做的时候后面的请求会晚发，晚的时间算进它们的延迟
+  void issueAsync(OpKind kind, Clock::time_point intended) {
+    auto done = [this, kind, intended](bool found) {
+      finish(kind, intended, found);
+      std::lock_guard<std::mutex> lock(m_mtx);
+      --m_inflight;
+      m_cv.notify_all();
+    };
+    switch (kind) {
+      case OP_READ:
+        m_clerk.GetAsync(nextKey(), [done](std::string value) { done(!value.empty()); });
+        break;
+      case OP_UPDATE:
+        m_clerk.PutAsync(nextKey(), nextValue(), [done]() { done(true); });
+        break;
+      case OP_INSERT:
+        m_clerk.PutAsync(insertKey(), nextValue(), [done]() { done(true); });
+        break;
+      case OP_RMW: {
+        std::string key = nextKey();
+        std::string value = nextValue();
+        m_clerk.GetAsync(key, [this, key, value, done](std::string old) {
+          bool found = !old.empty();
+          m_clerk.PutAsync(key, value, [done, found]() { done(found); });
+        });
+        break;
+      }
+      default:
+        done(execute(kind));
+        break;
+    }
+  }
+
+  void finish(OpKind kind, Clock::time_point start, bool found) {
+    Clock::time_point end = Clock::now();
+    m_shared->completed.fetch_add(1, std::memory_order_relaxed);
+    if (end < m_shared->measureFrom) {
+      return;
+    }
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    m_shared->hist[kind].record(static_cast<uint64_t>(us));
+    if (!found) {
+      m_shared->notFound[kind].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  Shared *m_shared;
+  const Options &m_opts;
+  Clerk m_clerk;
+  std::mt19937_64 m_rng;
+  ZipfianGenerator m_zipf;
+  std::string m_valuePool;
+  std::mutex m_mtx;  // 开环时保护m_inflight，回调在rpc客户端的IO线程里
+  std::condition_variable m_cv;
+  int m_inflight = 0;
+};
+
+bool parseDistribution(const std::string &name, Distribution *dist) {
+  if (name == "uniform") {
+    *dist = DIST_UNIFORM;
+  } else if (name == "zipfian") {
+    *dist = DIST_ZIPFIAN;
+  } else if (name == "latest") {
+    *dist = DIST_LATEST;
+  } else if (name == "constant") {
+    *dist = DIST_CONSTANT;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+std::string opJson(const char *name, const LatencyHistogram &h, long long notFound) {
+  return format(
+      "\"%s\":{\"count\":%llu,\"not_found\":%lld,\"mean_us\":%.1f,\"min_us\":%llu,\"p50_us\":%llu,"
+      "\"p90_us\":%llu,\"p99_us\":%llu,\"p999_us\":%llu,\"p9999_us\":%llu,\"max_us\":%llu}",
+      name, static_cast<unsigned long long>(h.count()), notFound, h.mean(),
+      static_cast<unsigned long long>(h.min()), static_cast<unsigned long long>(h.percentile(50)),
+      static_cast<unsigned long long>(h.percentile(90)), static_cast<unsigned long long>(h.percentile(99)),
+      static_cast<unsigned long long>(h.percentile(99.9)), static_cast<unsigned long long>(h.percentile(99.99)),
+      static_cast<unsigned long long>(h.max()));
+}
+
+void ShowArgsHelp() {
+  std::cout
+      << "format: kvbench [options]\n"
+         "  -f, --config <file>         raftCoreRun写出的配置文件，默认test.conf\n"
+         "  -w, --workload <a-f>        YCSB负载，默认a\n"
+         "  -r, --records <n>           装载的记录数，默认100000\n"
+         "  -o, --operations <n>        运行阶段的操作数，默认100000\n"
+         "  -d, --duration <sec>        按时间运行，给出时不看--operations\n"
+         "      --warmup <sec>          开始这么多秒不计入统计\n"
+         "  -t, --threads <n>           客户端线程数，每个线程一个Clerk，默认8\n"
+         "  -T, --target <ops/s>        开环的目标速率，不给时闭环\n"
+         "      --max-inflight <n>      开环时每个线程最多在途的请求数，默认128\n"
+         "      --key-dist <d>          uniform|zipfian|latest，默认跟随负载\n"
+         "      --zipfian-theta <x>     默认0.99\n"
+         "      --key-length <n>        key补0到这么长\n"
+         "      --value-size <n>        value的最大长度，默认100\n"
+         "      --value-min-size <n>    value长度分布的下界，默认1\n"
+         "      --value-dist <d>        constant|uniform|zipfian，默认constant\n"
+         "      --max-scan <n>          E负载一次扫描的最大条数，默认100\n"
+         "      --load-only / --run-only\n"
+         "      --follower-read         读请求分摊到所有节点\n"
+         "      --status <sec>          运行中打印进度的间隔，0不打印，默认10\n"
+         "      --output <file>         JSON结果写到文件，默认标准输出\n"
+         "      --hgrm <prefix>         每种操作写一个<prefix>-<op>.hgrm\n"
+      << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options opts;
+  enum {
+    OPT_WARMUP = 256,
+    OPT_MAX_INFLIGHT,
+    OPT_KEY_DIST,
+    OPT_THETA,
+    OPT_KEY_LENGTH,
+    OPT_VALUE_SIZE,
+    OPT_VALUE_MIN_SIZE,
+    OPT_VALUE_DIST,
+    OPT_MAX_SCAN,
+    OPT_LOAD_ONLY,
+    OPT_RUN_ONLY,
+    OPT_FOLLOWER_READ,
+    OPT_STATUS,
+    OPT_OUTPUT,
+    OPT_HGRM,
+  };
+  static const struct option longOptions[] = {
+      {"config", required_argument, nullptr, 'f'},
+      {"workload", required_argument, nullptr, 'w'},
+      {"records", required_argument, nullptr, 'r'},
+      {"operations", required_argument, nullptr, 'o'},
+      {"duration", required_argument, nullptr, 'd'},
+      {"threads", required_argument, nullptr, 't'},
+      {"target", required_argument, nullptr, 'T'},
+      {"warmup", required_argument, nullptr, OPT_WARMUP},
+      {"max-inflight", required_argument, nullptr, OPT_MAX_INFLIGHT},
+      {"key-dist", required_argument, nullptr, OPT_KEY_DIST},
+      {"zipfian-theta", required_argument, nullptr, OPT_THETA},
+      {"key-length", required_argument, nullptr, OPT_KEY_LENGTH},
+      {"value-size", required_argument, nullptr, OPT_VALUE_SIZE},
+      {"value-min-size", required_argument, nullptr, OPT_VALUE_MIN_SIZE},
+      {"value-dist", required_argument, nullptr, OPT_VALUE_DIST},
+      {"max-scan", required_argument, nullptr, OPT_MAX_SCAN},
+      {"load-only", no_argument, nullptr, OPT_LOAD_ONLY},
+      {"run-only", no_argument, nullptr, OPT_RUN_ONLY},
+      {"follower-read", no_argument, nullptr, OPT_FOLLOWER_READ},
+      {"status", required_argument, nullptr, OPT_STATUS},
+      {"output", required_argument, nullptr, OPT_OUTPUT},
+      {"hgrm", required_argument, nullptr, OPT_HGRM},
+      {"help", no_argument, nullptr, 'h'},
+      {nullptr, 0, nullptr, 0},
+  };
+  int c;
+  while ((c = getopt_long(argc, argv, "f:w:r:o:d:t:T:h", longOptions, nullptr)) != -1) {
+    switch (c) {
+      case 'f':
+        opts.configFile = optarg;
+        break;
+      case 'w':
+        opts.workload = static_cast<char>(tolower(optarg[0]));
+        break;
+      case 'r':
+        opts.recordCount = atoll(optarg);
+        break;
+      case 'o':
+        opts.operationCount = atoll(optarg);
+        break;
+      case 'd':
+        opts.durationSec = atoi(optarg);
+        break;
+      case 't':
+        opts.threads = atoi(optarg);
+        break;
+      case 'T':
+        opts.targetOps = atof(optarg);
+        break;
+      case OPT_WARMUP:
+        opts.warmupSec = atoi(optarg);
+        break;
+      case OPT_MAX_INFLIGHT:
+        opts.maxInflight = atoi(optarg);
+        break;
+      case OPT_KEY_DIST:
+        if (!parseDistribution(optarg, &opts.keyDist) || opts.keyDist == DIST_CONSTANT) {
+          ShowArgsHelp();
+          exit(EXIT_FAILURE);
+        }
+        opts.keyDistSet = true;
+        break;
+      case OPT_THETA:
+        opts.zipfianTheta = atof(optarg);
+        break;
+      case OPT_KEY_LENGTH:
+        opts.keyLength = atoi(optarg);
+        break;
+      case OPT_VALUE_SIZE:
+        opts.valueSize = atoi(optarg);
+        break;
+      case OPT_VALUE_MIN_SIZE:
+        opts.valueMinSize = atoi(optarg);
+        break;
+      case OPT_VALUE_DIST:
+        if (!parseDistribution(optarg, &opts.valueDist) || opts.valueDist == DIST_LATEST) {
+          ShowArgsHelp();
+          exit(EXIT_FAILURE);
+        }
+        break;
+      case OPT_MAX_SCAN:
+        opts.maxScanLength = atoi(optarg);
+        break;
+      case OPT_LOAD_ONLY:
+        opts.doRun = false;
+        break;
+      case OPT_RUN_ONLY:
+        opts.doLoad = false;
+        break;
+      case OPT_FOLLOWER_READ:
+        opts.followerRead = true;
+        break;
+      case OPT_STATUS:
+        opts.statusIntervalSec = atoi(optarg);
+        break;
+      case OPT_OUTPUT:
+        opts.output = optarg;
+        break;
+      case OPT_HGRM:
+        opts.hgrmPrefix = optarg;
+        break;
+      default:
+        ShowArgsHelp();
+        exit(EXIT_FAILURE);
+    }
+  }
+  Mix mix = workloadMix(opts.workload);
+  if (mix.read + mix.update + mix.insert + mix.scan + mix.rmw == 0 || opts.threads <= 0 || opts.recordCount <= 0 ||
+      opts.valueSize <= 0 || opts.valueMinSize <= 0 || opts.valueMinSize > opts.valueSize ||
+      opts.maxScanLength <= 0 || opts.loadBatch <= 0) {
+    ShowArgsHelp();
+    exit(EXIT_FAILURE);
+  }
+  if (!opts.keyDistSet) {
+    opts.keyDist = opts.workload == 'd' ? DIST_LATEST : DIST_ZIPFIAN;
+  }
+  // 在途的requestId跨度到了去重窗口clerk会阻塞，在回调里阻塞会卡住rpc的IO线程
+  opts.maxInflight = std::max(1, std::min(opts.maxInflight, KV_DEDUP_WINDOW / 2));
+
+  Shared shared(opts);
+  shared.insertNext = opts.recordCount;
+  ZipfianGenerator zipf(opts.recordCount, opts.zipfianTheta);
+  std::vector<std::unique_ptr<Client>> clients;
+  for (int i = 0; i < opts.threads; ++i) {
+    clients.emplace_back(new Client(&shared, i, zipf));
+  }
+
+  std::string json = format("{\"workload\":\"%c\",\"records\":%lld,\"threads\":%d,\"target_ops\":%.1f", opts.workload,
+                            opts.recordCount, opts.threads, opts.targetOps);
+  std::vector<std::thread> threads;
+
+  if (opts.doLoad) {
+    Clock::time_point start = Clock::now();
+    long long per = (opts.recordCount + opts.threads - 1) / opts.threads;
+    for (int i = 0; i < opts.threads; ++i) {
+      long long begin = std::min(opts.recordCount, per * i);
+      long long end = std::min(opts.recordCount, begin + per);
+      threads.emplace_back([&clients, i, begin, end]() { clients[i]->load(begin, end); });
+    }
+    for (auto &t : threads) {
+      t.join();
+    }
+    threads.clear();
+    double sec = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cerr << "load: " << opts.recordCount << " records in " << sec << "s (" << opts.recordCount / sec
+              << " records/s)" << std::endl;
+    json += format(",\"load_seconds\":%.3f,\"load_throughput\":%.1f", sec, opts.recordCount / sec);
+  }
+
+  if (opts.doRun) {
+    Clock::time_point start = Clock::now();
+    shared.measureFrom = start + std::chrono::seconds(opts.warmupSec);
+    for (int i = 0; i < opts.threads; ++i) {
+      threads.emplace_back([&clients, &opts, i, start]() {
+        if (opts.targetOps > 0) {
+          clients[i]->runOpenLoop(start);
+        } else {
+          clients[i]->runClosedLoop();
+        }
+      });
+    }
+    // 到时间或者所有线程都做完就停，期间按间隔打印进度
+    std::mutex waitMtx;
+    std::condition_variable waitCv;
+    bool finished = false;
+    std::thread watcher([&]() {
+      long long last = 0;
+      Clock::time_point lastAt = start;
+      std::unique_lock<std::mutex> lock(waitMtx);
+      Clock::time_point deadline =
+          opts.durationSec > 0 ? start + std::chrono::seconds(opts.warmupSec + opts.durationSec) : Clock::time_point::max();
+      while (!finished) {
+        Clock::time_point wakeAt = opts.statusIntervalSec > 0 ? Clock::now() + std::chrono::seconds(opts.statusIntervalSec)
+                                                              : Clock::time_point::max();
+        if (std::min(wakeAt, deadline) == Clock::time_point::max()) {
+          waitCv.wait(lock, [&] { return finished; });
+        } else {
+          waitCv.wait_until(lock, std::min(wakeAt, deadline), [&] { return finished; });
+        }
+        Clock::time_point at = Clock::now();
+        if (at >= deadline) {
+          shared.stop = true;
+          deadline = Clock::time_point::max();
+        }
+        if (!finished && opts.statusIntervalSec > 0 && at >= wakeAt) {
+          long long done = shared.completed.load();
+          std::cerr << std::chrono::duration_cast<std::chrono::seconds>(at - start).count() << "s: " << done
+                    << " operations, " << (done - last) / std::chrono::duration<double>(at - lastAt).count()
+                    << " ops/s" << std::endl;
+          last = done;
+          lastAt = at;
+        }
+      }
+    });
+    for (auto &t : threads) {
+      t.join();
+    }
+    {
+      std::lock_guard<std::mutex> lock(waitMtx);
+      finished = true;
+    }
+    waitCv.notify_all();
+    watcher.join();
+
+    double sec = std::chrono::duration<double>(Clock::now() - std::max(start, shared.measureFrom)).count();
+    LatencyHistogram overall;
+    for (auto &h : shared.hist) {
+      overall.add(h);
+    }
+    json += format(",\"run_seconds\":%.3f,\"operations\":%llu,\"throughput_ops\":%.1f,\"ops\":{", sec,
+                   static_cast<unsigned long long>(overall.count()), overall.count() / sec);
+    json += opJson("OVERALL", overall, 0);
+    for (int k = 0; k < OP_KINDS; ++k) {
+      if (shared.hist[k].count() == 0) {
+        continue;
+      }
+      json += "," + opJson(kOpNames[k], shared.hist[k], shared.notFound[k].load());
+      std::cerr << kOpNames[k] << ": count=" << shared.hist[k].count() << " p50=" << shared.hist[k].percentile(50)
+                << "us p99=" << shared.hist[k].percentile(99) << "us p999=" << shared.hist[k].percentile(99.9)
+                << "us max=" << shared.hist[k].max() << "us" << std::endl;
+      if (!opts.hgrmPrefix.empty()) {
+        std::ofstream hgrm(opts.hgrmPrefix + "-" + kOpNames[k] + ".hgrm");
+        hgrm << shared.hist[k].percentileDistribution(1000.0);
+      }
+    }
+    json += "}";
+    std::cerr << "run: " << overall.count() << " operations in " << sec << "s (" << overall.count() / sec << " ops/s)"
+              << std::endl;
+  }
+  json += "}";
+
+  if (opts.output.empty()) {
+    std::cout << json << std::endl;
+  } else {
+    std::ofstream out(opts.output, std::ios::out | std::ios::trunc);
+    out << json << std::endl;
+  }
+  // Clerk的连接和rpc客户端的线程不做清理，直接退出
+  std::_Exit(EXIT_SUCCESS);
+}
@@ -2,10 +2,11 @@
 #include <iostream>
 #include "raft.h"
 // #include "kvServer.h"
-#include <kvServer.h>
+#include <kvNode.h>
 #include <unistd.h>
 #include <iostream>
 #include <random>
+#include <sstream>
 #include "rpcprovider.h"
 #include <mprpcchannel.h>
 
@@ -20,11 +21,15 @@ int main(int argc, char **argv) {
   int c = 0;
   int nodeNum = 0;
   std::string configFileName;
+  std::string splitKeys;  // 逗号分隔的各个raft组的起始key，不给时只有一个组
+  int spareGroups = 0;    // 没有范围的备用组，热点范围分裂时交给它们
+  int learnerNum = 0;     // 最后几个节点作为learner启动，只分担读请求，不参与投票
+  std::string engine;     // 存储引擎，lsm或者不给（内存里的跳表）
   std::random_device rd;
   std::mt19937 gen(rd());
   std::uniform_int_distribution<> dis(10000, 29999);
   unsigned short startPort = dis(gen);
-  while ((c = getopt(argc, argv, "n:f:")) != -1) {
+  while ((c = getopt(argc, argv, "n:f:s:r:l:e:")) != -1) {
     switch (c) {
       case 'n':
         nodeNum = atoi(optarg);
@@ -32,6 +37,18 @@ int main(int argc, char **argv) {
       case 'f':
         configFileName = optarg;
         break;
+      case 's':
+        splitKeys = optarg;
+        break;
+      case 'r':
+        spareGroups = atoi(optarg);
+        break;
+      case 'l':
+        learnerNum = atoi(optarg);
+        break;
+      case 'e':
+        engine = optarg;
+        break;
       default:
         ShowArgsHelp();
         exit(EXIT_FAILURE);
@@ -41,6 +58,25 @@ int main(int argc, char **argv) {
   file.close();
   file = std::ofstream(configFileName, std::ios::out | std::ios::trunc);
   if (file.is_open()) {
+    // 范围表写在最前面，节点启动时读它建组，节点的地址由各个节点自己追加
+    std::stringstream ss(splitKeys);
+    std::string key;
+    for (int group = 1; std::getline(ss, key, ',');) {
+      if (!key.empty()) {
+        file << "group" << group++ << "start=" << key << std::endl;
+      }
+    }
+    // 节点启动时等这么多个节点都写好地址、端口都能连上再建raft连接
+    file << "nodeNum=" << nodeNum << std::endl;
+    if (spareGroups > 0) {
+      file << "spareGroups=" << spareGroups << std::endl;
+    }
+    if (!engine.empty()) {
+      file << "storageEngine=" << engine << std::endl;
+    }
+    for (int i = std::max(nodeNum - learnerNum, 1); i < nodeNum; i++) {
+      file << "node" << i << "role=learner" << std::endl;
+    }
     file.close();
     std::cout << configFileName << " 已清空" << std::endl;
   } else {
@@ -55,14 +91,12 @@ int main(int argc, char **argv) {
       // 如果是子进程
       // 子进程的代码
 
-      auto kvServer = new KvServer(i, 500, configFileName, port);
-      RpcProvider provider;
-      provider.NotifyService(kvServer);
-      pause();  // 子进程进入等待状态，不会执行 return 语句
+      // 不会返回，子进程一直在这里提供服务
+      auto kvNode = new KvNode(i, 500, configFileName, port);
+      pause();
     } else if (pid > 0) {
       // 如果是父进程
-      // 父进程的代码
-      sleep(1);
+      // 父进程的代码：节点自己会等其他节点起来，这里不用一个个错开
     } else {
       // 如果创建进程失败
       std::cerr << "Failed to create child process." << std::endl;
@@ -73,4 +107,7 @@ int main(int argc, char **argv) {
   return 0;
 }
 
-void ShowArgsHelp() { std::cout << "format: command -n <nodeNum> -f <configFileName>" << std::endl; }
+void ShowArgsHelp() {
+  std::cout << "format: command -n <nodeNum> -f <configFileName> [-s <splitKey1,splitKey2,...>] [-r <spareGroups>] [-l <learnerNum>] [-e lsm]"
+            << std::endl;
+}
@@ -5,16 +5,124 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
-const bool Debug = true;
+// 日志，见logger.h；默认级别INFO，DEBUG（原来的DPrintf）要用KV_LOG_LEVEL=debug打开
+const int LOG_DEFAULT_LEVEL = 1;
+const int LOG_LINE_MAX = 512;            // 一行日志最长这么多字节，超过的截断
+const int LOG_QUEUE_CAPACITY = 8192;     // 还没写出的日志最多这么多行，满了丢掉新的
+const unsigned int LOG_FLUSH_BYTES = 64 * 1024;  // 后台线程攒到这么多字节就写一次，不等队列空
 
 const int debugMul = 1;  // 时间单位：time.Millisecond，不同网络环境rpc速度不同，因此需要乘以一个系数
 const int HeartBeatTimeout = 25 * debugMul;  // 心跳时间一般要比选举超时小一个数量级
-const int ApplyInterval = 10 * debugMul;     //
 
 const int minRandomizedElectionTime = 300 * debugMul;  // ms
 const int maxRandomizedElectionTime = 500 * debugMul;  // ms
 
 const int CONSENSUS_TIMEOUT = 500 * debugMul;  // ms
+// 读请求走ReadIndex，不写日志；打开租约后leader在租约内不用等一轮心跳，follower相应地在租约内拒绝投票
+const bool RAFT_READ_LEASE = false;
+// 从多数派确认的AE发出时算起，比follower承诺不投票的minRandomizedElectionTime短，留出时钟误差
+const int RAFT_READ_LEASE_MS = minRandomizedElectionTime * 9 / 10;
+// 超时之后先预投票：不增加term也不持久化，拿到多数派的认可才真正发起选举，重新连上的节点不会打断正常的leader
+const bool RAFT_PRE_VOTE = true;
+// leader一个选举超时内没有收到多数派的回复就主动下台；follower收到leader的消息之后最短选举超时内不认可预投票
+const bool RAFT_CHECK_QUORUM = true;
+// 交出领导权时等目标追上日志的最长时间，发出TimeoutNow之后目标在这段时间内没有当选，就恢复接受提议
+const int RAFT_LEAD_TRANSFER_TIMEOUT_MS = minRandomizedElectionTime;
+// 一个组最多有多少个成员，节点号必须小于它；删掉的节点号不要再给别的机器用
+const int RAFT_MAX_NODES = 16;
+// learner落后leader的日志不超过这么多条时才能提升为投票成员，否则它一加入多数派就拖慢提交
+const int RAFT_PROMOTE_MAX_LAG = 1000;
+
+const int RAFT_MAX_INFLIGHT_APPENDS = 4;  // leader对每个follower最多同时在途的AppendEntries，流水线窗口
+const int RAFT_MAX_APPEND_ENTRIES = 512;  // 一个AppendEntries最多携带的日志条数
+const long long RAFT_MAX_APPEND_BYTES = 1024 * 1024;  // 一个AppendEntries携带的日志最多约这么多字节
+// leader合并并发的Start：第一个到达的等这么久，让同时到达的提议一起写日志、一起persist，us；0表示不等，只合并自然排队的
+const int RAFT_PROPOSE_BATCH_WINDOW_US = 100;
+const int RAFT_PROPOSE_BATCH_MAX = 256;  // 排队的提议攒够这么多就不再等窗口结束
+const int RAFT_PROPOSE_BATCH_SLICE_US = 20;  // 窗口分成这么长的小段等，每段之后检查是否已经攒够
+// raft推给kvserver的applyChan最多积压这么多批，满了raft先不往外推，已提交的日志留在log里
+const int RAFT_APPLY_QUEUE_CAPACITY = 1024;
+// leader记录最近这么多条日志的写入、提交时间，用于/metrics里的提交延迟和上层的提交到apply延迟
+const int RAFT_TRACE_RING = 4096;
+
+const long long WAL_SEGMENT_SIZE = 64 * 1024 * 1024;  // raft日志段写满后换新文件，byte
+
+// group commit：并发写入的日志先进入共享缓冲区，由一个线程统一write+fdatasync
+const bool PERSIST_FSYNC = true;                         // false时不调用fdatasync，快但掉电可能丢数据
+const int GROUP_COMMIT_WINDOW_US = 500;                  // 第一条记录到达后最多再等多久凑批，us
+const int GROUP_COMMIT_MAX_BATCH_BYTES = 1024 * 1024;  // 缓冲区攒够这么多立即落盘，byte
+
+const int SCAN_MAX_LIMIT = 1000;  // 一次Scan RPC最多返回的kv条数
+// kvserver对每个client记住最近这么多个requestId是否执行过，clerk在途请求的id跨度不能超过它，64的倍数
+const int KV_DEDUP_WINDOW = 1024;
+// client的session按日志里记录的时间过期，超过这么久没有写操作就删掉；session太多时也从最久没有写的开始删
+const int KV_SESSION_TIMEOUT_MS = 60 * 60 * 1000;
+const int KV_MAX_SESSIONS = 100000;
+// leader上热点key的读缓存（见hotKeyCache.h），每个组最多缓存这么多个key，分到这么多个分片各自LRU淘汰
+// 一个key没命中这么多次之后才放进缓存；value超过这么长的不缓存
+const int KV_READ_CACHE_CAPACITY = 1024;
+const int KV_READ_CACHE_SHARDS = 16;
+const int KV_READ_CACHE_ADMIT = 3;
+const unsigned int KV_READ_CACHE_MAX_VALUE_BYTES = 16 * 1024;
+// BatchGet不加锁读的次数，每次都碰上正在apply的batch时改为拿m_sessionMtx的读锁读，不在worker线程上空转
+const int KV_BATCH_GET_OPTIMISTIC_TRIES = 4;
+
+// LSM存储引擎（见lsmEngine.h），节点配置里storageEngine=lsm时使用
+const long long LSM_MEMTABLE_BYTES = 4 * 1024 * 1024;  // memtable写到这么大就冻结，交给后台线程写成L0的文件
+const int LSM_MAX_IMMUTABLE_MEMTABLES = 4;           // 冻结的memtable来不及落盘时写入等待
+const int LSM_MAX_LEVELS = 4;
+const int LSM_L0_COMPACTION_TRIGGER = 4;             // L0的文件互相重叠，个数到这么多就整体合并进L1
+const long long LSM_LEVEL1_BYTES = 16 * 1024 * 1024;  // L1的大小上限，往下每层乘LSM_LEVEL_MULTIPLIER
+const int LSM_LEVEL_MULTIPLIER = 10;
+const long long LSM_TABLE_BYTES = 4 * 1024 * 1024;    // 合并输出的单个文件大小
+const int SSTABLE_BLOCK_BYTES = 4 * 1024;             // SSTable数据块大小，点查每次读一块
+const int SSTABLE_BLOOM_BITS_PER_KEY = 10;           // 布隆过滤器误判率约1%
+
+// 范围的自动分裂、合并和leader的均衡，每个节点每隔这么久检查一次自己领导的组，ms
+const int KV_BALANCE_INTERVAL_MS = 1000;
+// key数或者每秒请求数超过这个就把范围的后一半分给一个备用组；迁移的数据作为一条日志提交，不宜太大
+const int KV_SPLIT_MAX_KEYS = 100000;
+const int KV_SPLIT_QPS = 20000;
+// 相邻的两个组都低于这两个值时合并，合并后的key数也要低于KV_SPLIT_MAX_KEYS的一半，免得马上又分裂
+const int KV_MERGE_MAX_KEYS = 1000;
+const int KV_MERGE_QPS = 10;
+// 连续这么多轮都是冷的才合并，配置里预先切好的范围在刚启动、还没有数据的时候不会被马上合并
+const int KV_MERGE_COLD_ROUNDS = 60;
+// 一个节点上的leader比最少的节点多到这么多时，交一个给最少的节点
+const int KV_LEADER_IMBALANCE = 2;
+
+// rpc帧：4字节长度（网络字节序） + 内容
+const unsigned int RPC_FRAME_HEADER_SIZE = 4;
+const unsigned int RPC_MAX_FRAME_SIZE = 512 * 1024 * 1024;  // 超过这个长度认为流已经错位
+// rpc端口上也回答 HTTP GET /metrics，请求头超过这么长还没结束就断开
+const unsigned int RPC_HTTP_MAX_HEADER_SIZE = 8 * 1024;
+const int RPC_CLIENT_IO_THREADS = 1;  // 异步rpc客户端读响应的线程数
+const int RPC_CONNECTIONS_PER_PEER = 2;  // 异步rpc客户端到每个对端的连接数，多条连接可以分散到服务端不同的IO线程
+const int RPC_SERVER_IO_THREADS = 4;      // rpc服务端muduo的IO线程数
+const int RPC_SERVER_WORKER_THREADS = 8;  // rpc服务端执行业务方法的线程数，kv的请求会阻塞直到raft提交，不宜太少
+const int RPC_CONNECT_TIMEOUT_MS = 1000;
+// 连接失败后的重连退避，从MIN开始每次失败翻倍，最多MAX
+const int RPC_RECONNECT_BACKOFF_MIN_MS = 50;
+const int RPC_RECONNECT_BACKOFF_MAX_MS = 3000;
+// 节点启动时等其他节点：每隔POLL重读一次节点信息文件；配置没写nodeNum时节点数SETTLE内不再变化就认为写全了；
+// 最多等WAIT，之后直接启动，没起来的节点由raft的连接按退避重连
+const int KV_STARTUP_POLL_MS = 20;
+const int KV_STARTUP_SETTLE_MS = 1000;
+const int KV_STARTUP_WAIT_MS = 30000;
+// rpc超时，ms：AE和投票要比选举超时短，kvserver的处理最多等CONSENSUS_TIMEOUT
+const int RAFT_RPC_TIMEOUT_MS = 200 * debugMul;
+const int RAFT_INSTALL_SNAPSHOT_TIMEOUT_MS = 3000 * debugMul;  // 每一块快照的超时
+const int RAFT_SNAPSHOT_CHUNK_SIZE = 1024 * 1024;  // 分块发送快照时每块的大小
+const int CLERK_RPC_TIMEOUT_MS = 2 * CONSENSUS_TIMEOUT;
+// clerk把所有节点都试过一轮还没找到leader时退避，一般是在选举，从MIN开始每轮翻倍，最多MAX，带随机抖动
+const int CLERK_RETRY_BACKOFF_MIN_MS = 10 * debugMul;
+const int CLERK_RETRY_BACKOFF_MAX_MS = maxRandomizedElectionTime;
+// 运维接口（成员变更）每个组最多试这么多轮节点，还不成功就返回失败
+const int CLERK_ADMIN_RETRY_ROUNDS = 10;
+const int RPC_ARENA_BLOCK_SIZE = 8 * 1024;  // 每次rpc的请求和响应分配在同一个arena上，这是它的第一块内存的大小
+// 序列化后不小于这个长度的请求参数和响应才压缩，主要是InstallSnapshot和大批的AE；小消息压缩得不偿失
+const unsigned int RPC_COMPRESS_MIN_SIZE = 4 * 1024;
+const int RPC_COMPRESS_ZSTD_LEVEL = 1;
 
 // 协程相关设置
 
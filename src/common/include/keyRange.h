@@ -0,0 +1,94 @@
+#ifndef KEY_RANGE_H
+#define KEY_RANGE_H
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "mprpcconfig.h"
+#include "util.h"
+
+// 一个raft组负责的key范围[start, end)，end为空表示到末尾
+struct KeyRange {
+  std::string start;
+  std::string end;
+
+  bool contains(const std::string &key) const { return key >= start && (end.empty() || key < end); }
+  // other紧接在这个范围后面
+  bool followedBy(const KeyRange &other) const { return !end.empty() && end == other.start; }
+};
+
+/**
+ * 按key范围把整个key空间分给多个raft组，kvserver和clerk从同一个配置文件里读初始的范围
+ * 配置文件里 group<i>start=<key> 是组i的起始key（i从1开始，必须递增），组0从空串开始，最后一个组到末尾
+ * 一个都没有配置时只有组0，负责全部的key
+ * spareGroups=<n> 另外再建n个没有范围的备用组，分裂时把范围的一部分交给它们，见KvNode
+ * 范围在运行中会分裂、合并，clerk遇到ErrWrongGroup时从kvserver拉取当前的范围表，见Assign
+ */
+class KeyRangeTable {
+ public:
+  struct Entry {
+    int group;
+    KeyRange range;
+  };
+
+  KeyRangeTable() : m_groups(1), m_entries{{0, KeyRange()}} {}
+
+  void Load(MprpcConfig &config) {
+    m_entries.assign(1, {0, KeyRange()});
+    for (int i = 1;; ++i) {
+      std::string start = config.Load("group" + std::to_string(i) + "start");
+      if (start.empty()) {
+        break;
+      }
+      myAssert(start > m_entries.back().range.start, format("[KeyRangeTable::Load] group%dstart is not increasing", i));
+      m_entries.back().range.end = start;
+      m_entries.push_back({i, {start, ""}});
+    }
+    m_groups = static_cast<int>(m_entries.size()) + std::max(0, atoi(config.Load("spareGroups").c_str()));
+  }
+
+  // 换成kvserver上的范围表，entries是所有有范围的组，顺序任意
+  void Assign(int groups, std::vector<Entry> entries) {
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry &a, const Entry &b) { return a.range.start < b.range.start; });
+    m_groups = groups;
+    m_entries = std::move(entries);
+  }
+
+  // 组的总数，包括备用组，组号从0开始
+  int groups() const { return m_groups; }
+  // 有范围的组，按start升序；范围迁移的途中相邻的两项之间可能有空隙
+  const std::vector<Entry> &entries() const { return m_entries; }
+
+  // 组在配置文件里的初始范围，只在Load之后、Assign之前可以用，备用组返回false
+  bool initialRange(int group, KeyRange *range) const {
+    if (group >= static_cast<int>(m_entries.size())) {
+      return false;
+    }
+    *range = m_entries[group].range;
+    return true;
+  }
+
+  // key所在的组在entries里的下标，落在空隙里时返回-1
+  int indexOf(const std::string &key) const {
+    auto it = std::upper_bound(m_entries.begin(), m_entries.end(), key,
+                               [](const std::string &k, const Entry &e) { return k < e.range.start; });
+    if (it == m_entries.begin() || !std::prev(it)->range.contains(key)) {
+      return -1;
+    }
+    return static_cast<int>(it - m_entries.begin()) - 1;
+  }
+
+  // key所在的组，二分查找最后一个start <= key的组，落在空隙里时返回-1
+  int groupOf(const std::string &key) const {
+    int i = indexOf(key);
+    return i < 0 ? -1 : m_entries[i].group;
+  }
+
+ private:
+  int m_groups;
+  std::vector<Entry> m_entries;
+};
+
+#endif  // KEY_RANGE_H
@@ -0,0 +1,172 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+// HdrHistogram那样的对数-线性分桶：值小于2048时每个值一个桶，之后每翻一倍桶宽也翻一倍，每段1024个桶
+// 任何值的相对误差不超过1/1024（三位有效数字），能记录到2^kBuckets * 1024，单位由调用方定（一般是微秒）
+// record只是一次relaxed的原子加，多个线程可以同时记录同一个直方图，读统计值时和记录并发得到的是近似值
+class LatencyHistogram {
+ public:
+  static constexpr int kSubBucketBits = 11;
+  static constexpr int kSubBucketHalf = 1 << (kSubBucketBits - 1);
+  static constexpr int kBuckets = 26;
+  static constexpr int kCounts = (kBuckets + 1) * kSubBucketHalf;
+
+  LatencyHistogram() : m_counts(new std::atomic<uint64_t>[kCounts]) { reset(); }
+  LatencyHistogram(const LatencyHistogram &) = delete;
+  LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+  void record(uint64_t value) {
+    const uint64_t maxValue = lowestEquivalent(kCounts - 1);
+    if (value > maxValue) {
+      value = maxValue;
+    }
+    m_counts[indexOf(value)].fetch_add(1, std::memory_order_relaxed);
+    m_total.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+    uint64_t cur = m_max.load(std::memory_order_relaxed);
+    while (value > cur && !m_max.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+    }
+    cur = m_min.load(std::memory_order_relaxed);
+    while (value < cur && !m_min.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  // 把other的计数加进来，用来合并各个线程的直方图
+  void add(const LatencyHistogram &other) {
+    for (int i = 0; i < kCounts; ++i) {
+      uint64_t n = other.m_counts[i].load(std::memory_order_relaxed);
+      if (n != 0) {
+        m_counts[i].fetch_add(n, std::memory_order_relaxed);
+      }
+    }
+    m_total.fetch_add(other.count(), std::memory_order_relaxed);
+    m_sum.fetch_add(other.m_sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    if (other.count() > 0) {
+      if (other.min() < m_min.load(std::memory_order_relaxed)) {
+        m_min.store(other.min(), std::memory_order_relaxed);
+      }
+      if (other.max() > m_max.load(std::memory_order_relaxed)) {
+        m_max.store(other.max(), std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void reset() {
+    for (int i = 0; i < kCounts; ++i) {
+      m_counts[i].store(0, std::memory_order_relaxed);
+    }
+    m_total.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(UINT64_MAX, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+  }
+
+  uint64_t count() const { return m_total.load(std::memory_order_relaxed); }
+  uint64_t min() const { return count() == 0 ? 0 : m_min.load(std::memory_order_relaxed); }
+  uint64_t max() const { return m_max.load(std::memory_order_relaxed); }
+  double mean() const {
+    uint64_t n = count();
+    return n == 0 ? 0 : static_cast<double>(m_sum.load(std::memory_order_relaxed)) / n;
+  }
+
+  // percentile取0到100，返回至少有percentile%的记录不大于它的值（所在桶的上界，不超过max）
+  uint64_t percentile(double percentile) const {
+    uint64_t n = count();
+    if (n == 0) {
+      return 0;
+    }
+    uint64_t target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * n));
+    if (target < 1) {
+      target = 1;
+    }
+    uint64_t seen = 0;
+    for (int i = 0; i < kCounts; ++i) {
+      seen += m_counts[i].load(std::memory_order_relaxed);
+      if (seen >= target) {
+        uint64_t v = highestEquivalent(i);
+        return v < max() ? v : max();
+      }
+    }
+    return max();
+  }
+
+  // HdrHistogram的百分位分布文本格式（.hgrm），可以直接交给HdrHistogram的绘图工具
+  // 每一行是 值 百分位 累计个数 1/(1-百分位)，值除以scale输出（比如微秒转成毫秒传1000）
+  std::string percentileDistribution(double scale = 1.0, int ticksPerHalf = 5) const {
+    std::string out = "       Value     Percentile TotalCount 1/(1-Percentile)\n\n";
+    uint64_t n = count();
+    if (n == 0) {
+      return out;
+    }
+    char line[128];
+    double next = 0;
+    double half = 50;
+    double step = half / ticksPerHalf;
+    uint64_t seen = 0;
+    for (int i = 0; i < kCounts && seen < n; ++i) {
+      uint64_t c = m_counts[i].load(std::memory_order_relaxed);
+      if (c == 0) {
+        continue;
+      }
+      seen += c;
+      double p = 100.0 * seen / n;
+      if (p < next && seen < n) {
+        continue;
+      }
+      uint64_t v = highestEquivalent(i) < max() ? highestEquivalent(i) : max();
+      if (seen < n) {
+        std::snprintf(line, sizeof(line), "%12.3f %14.12f %10llu %14.2f\n", v / scale, p / 100.0,
+                      static_cast<unsigned long long>(seen), 1.0 / (1.0 - p / 100.0));
+      } else {
+        std::snprintf(line, sizeof(line), "%12.3f %14.12f %10llu\n", v / scale, 1.0,
+                      static_cast<unsigned long long>(seen));
+      }
+      out += line;
+      if (seen == n) {
+        break;
+      }
+      // 每过一半剩下的部分刻度加密一倍，和HdrHistogram一样尾部越来越细
+      while (next <= p) {
+        next += step;
+        if (next >= half) {
+          half += (100 - half) / 2;
+          step /= 2;
+        }
+      }
+    }
+    std::snprintf(line, sizeof(line), "#[Mean    = %12.3f, Max     = %12.3f]\n#[Total count    = %12llu]\n",
+                  mean() / scale, max() / scale, static_cast<unsigned long long>(n));
+    out += line;
+    return out;
+  }
+
+ private:
+  static int indexOf(uint64_t value) {
+    int bucket = 63 - __builtin_clzll(value | ((1ULL << kSubBucketBits) - 1)) - (kSubBucketBits - 1);
+    return bucket * kSubBucketHalf + static_cast<int>(value >> bucket);
+  }
+  static int bucketOf(int index) { return index < 2 * kSubBucketHalf ? 0 : index / kSubBucketHalf - 1; }
+  static uint64_t lowestEquivalent(int index) {
+    int bucket = bucketOf(index);
+    return static_cast<uint64_t>(index - bucket * kSubBucketHalf) << bucket;
+  }
+  static uint64_t highestEquivalent(int index) {
+    int bucket = bucketOf(index);
+    return lowestEquivalent(index) + (1ULL << bucket) - 1;
+  }
+
+  std::unique_ptr<std::atomic<uint64_t>[]> m_counts;
+  std::atomic<uint64_t> m_total;
+  std::atomic<uint64_t> m_sum;
+  std::atomic<uint64_t> m_min;
+  std::atomic<uint64_t> m_max;
+};
+
+#endif  // LATENCY_HISTOGRAM_H
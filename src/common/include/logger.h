@@ -0,0 +1,108 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <sys/types.h>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "config.h"
+#include "mpscQueue.h"
+
+// 异步日志：调用方只在自己的栈外（队列的槽里）格式化一行，放进无锁的MpscQueue就返回，后台线程负责写出
+// 队列满时丢掉这一行并计数，不会阻塞调用方；写出的线程在队列空的时候才fflush
+//
+// 级别分两层过滤：
+// 编译期：低于LOG_MIN_LEVEL的宏展开为空，参数也不会求值（cmake -DLOG_MIN_LEVEL=1 去掉全部DEBUG）
+// 运行期：低于Logger::SetLevel设置的级别时只有一次原子读；启动时的级别取环境变量KV_LOG_LEVEL（debug/info/warn/error/off），
+//        没有设置时为LOG_DEFAULT_LEVEL
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_OFF 4
+
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+class Logger {
+ public:
+  static Logger &Instance();
+
+  static bool Enabled(int level) { return level >= s_level.load(std::memory_order_relaxed); }
+  static void SetLevel(int level) { s_level.store(level, std::memory_order_relaxed); }
+  static int Level() { return s_level.load(std::memory_order_relaxed); }
+  // "debug"/"info"/"warn"/"error"/"off"，不认识返回-1
+  static int ParseLevel(const std::string &name);
+
+  // 之后的日志写到path（追加），空串表示标准输出；打不开时返回false，仍写原来的地方
+  bool SetOutput(const std::string &path);
+
+  void Log(int level, const char *file, int line, const char *fmt, ...) __attribute__((format(printf, 5, 6)));
+  // 等后台线程把调用之前放进队列的日志都写出去，最多等timeoutMs；进程退出和myAssert失败前调用
+  void Flush(int timeoutMs = 1000);
+
+  uint64_t Dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+ private:
+  struct Record {
+    int level = 0;
+    int line = 0;
+    pid_t tid = 0;
+    int64_t timeUs = 0;  // 墙上时钟
+    const char *file = nullptr;
+    uint32_t len = 0;
+    char text[LOG_LINE_MAX];
+  };
+
+  Logger();
+  void flushLoop();
+  void writeRecord(const Record &record, std::string *out);
+
+  static std::atomic<int> s_level;
+
+  MpscQueue<Record> m_queue;
+  std::atomic<uint64_t> m_pushed{0};   // 放进队列的行数
+  std::atomic<uint64_t> m_written{0};  // 后台线程已经写出并fflush的行数
+  std::atomic<uint64_t> m_dropped{0};
+  std::mutex m_outMtx;  // 保护m_out，只在换输出和后台线程写出时拿
+  FILE *m_out;
+  std::thread m_flusher;
+};
+
+#define LOG_AT(level, fmt, ...)                                                 \
+  do {                                                                          \
+    if (Logger::Enabled(level)) {                                               \
+      Logger::Instance().Log(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__);    \
+    }                                                                           \
+  } while (0)
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(fmt, ...) LOG_AT(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(fmt, ...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(fmt, ...) LOG_AT(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define LOG_INFO(fmt, ...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WARN(fmt, ...) LOG_AT(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#else
+#define LOG_WARN(fmt, ...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(fmt, ...) LOG_AT(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(fmt, ...) ((void)0)
+#endif
+
+#endif  // LOGGER_H
@@ -0,0 +1,99 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "latencyHistogram.h"
+
+// 进程内的运行指标，RpcProvider在rpc端口上回答 HTTP GET /metrics，输出Prometheus的文本格式
+// 指标按名字注册一次（一般在构造函数里，或者用函数内的static指针），之后热路径上只有原子加，不拿锁
+// 名字里可以带标签，比如 raft_term{group="1"}，同一个名字（不含标签）的指标输出在同一组HELP/TYPE下面
+
+// 分散到多个cache line上的计数器，每个线程固定加到其中一格，读的时候求和
+class MetricCounter {
+ public:
+  static constexpr int kShards = 16;
+
+  void add(uint64_t n = 1) { m_shards[shardOfThisThread()].value.fetch_add(n, std::memory_order_relaxed); }
+  uint64_t value() const {
+    uint64_t sum = 0;
+    for (const auto &s : m_shards) {
+      sum += s.value.load(std::memory_order_relaxed);
+    }
+    return sum;
+  }
+
+ private:
+  static int shardOfThisThread() {
+    static std::atomic<int> next{0};
+    thread_local int shard = next.fetch_add(1, std::memory_order_relaxed) % kShards;
+    return shard;
+  }
+
+  struct alignas(64) Shard {
+    std::atomic<uint64_t> value{0};
+  };
+  Shard m_shards[kShards];
+};
+
+class Metrics {
+ public:
+  static Metrics &Instance();
+
+  // 同名的指标只注册一次，再次注册返回同一个对象；返回的指针在进程退出之前一直有效
+  MetricCounter *Counter(const std::string &name, const std::string &help);
+  // 单位是微秒，以summary（分位数+sum+count）输出
+  LatencyHistogram *Histogram(const std::string &name, const std::string &help);
+  // 输出时才调用fn取值，用于队列长度、跳表大小这类现成的状态；fn引用的对象要活到进程退出
+  // 同名的gauge再次注册时替换掉原来的fn
+  void Gauge(const std::string &name, const std::string &help, std::function<double()> fn);
+
+  // Prometheus text exposition format 0.0.4
+  std::string RenderPrometheus();
+
+ private:
+  struct Entry {
+    std::string help;
+    std::unique_ptr<MetricCounter> counter;
+    std::unique_ptr<LatencyHistogram> histogram;
+    std::function<double()> gauge;
+  };
+
+  std::mutex m_mtx;
+  std::map<std::string, Entry> m_entries;  // 带标签的全名 -> 指标，有序输出时同名的指标挨在一起
+};
+
+// 单调时钟的微秒数，只用来算时间差
+inline int64_t MetricsNowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// 作用域结束时把经过的时间记进直方图
+class ScopedLatency {
+ public:
+  explicit ScopedLatency(LatencyHistogram *histogram) : m_histogram(histogram), m_startUs(MetricsNowUs()) {}
+  ~ScopedLatency() { m_histogram->record(static_cast<uint64_t>(MetricsNowUs() - m_startUs)); }
+  ScopedLatency(const ScopedLatency &) = delete;
+  ScopedLatency &operator=(const ScopedLatency &) = delete;
+
+ private:
+  LatencyHistogram *m_histogram;
+  int64_t m_startUs;
+};
+
+// 记录 MetricsNowUs() - startUs，startUs为0（不知道开始时间）时不记
+inline void RecordSince(LatencyHistogram *histogram, int64_t startUs) {
+  if (startUs > 0) {
+    int64_t d = MetricsNowUs() - startUs;
+    histogram->record(static_cast<uint64_t>(d > 0 ? d : 0));
+  }
+}
+
+#endif  // METRICS_H
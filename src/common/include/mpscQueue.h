@@ -0,0 +1,172 @@
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// 有界的多生产者单消费者无锁队列，环形数组，每个槽带一个序号（Vyukov的有界队列去掉多消费者的部分）
+// 生产者用CAS抢写入位置，写完把槽的序号改成位置+1发布；消费者只有一个，按顺序读，读完把序号加上容量还给生产者
+// push/pop只移动元素，不拷贝；队列空或满时用futex阻塞，不在阻塞状态的一方不需要系统调用
+// T需要可以默认构造和移动赋值
+template <typename T>
+class MpscQueue {
+ public:
+  // 容量向上取整到2的幂
+  explicit MpscQueue(size_t capacity) {
+    size_t cap = 2;
+    while (cap < capacity) {
+      cap <<= 1;
+    }
+    m_mask = cap - 1;
+    m_cells.reset(new Cell[cap]);
+    for (size_t i = 0; i < cap; ++i) {
+      m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  size_t capacity() const { return m_mask + 1; }
+
+  // 只用于监控的近似长度：已经抢到位置但还没发布的元素也算在内
+  size_t size() const {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+  }
+
+  // 满了返回false，value不变
+  bool tryPush(T&& value) {
+    size_t pos = m_tail.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+      cell = &m_cells[pos & m_mask];
+      size_t seq = cell->seq.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;  // 一圈之前的元素还没被取走
+      } else {
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = std::move(value);
+    cell->seq.store(pos + 1, std::memory_order_release);
+    signal(m_pushEpoch, m_consumerWaiting);
+    return true;
+  }
+
+  // 满了等到有空位
+  void push(T&& value) {
+    while (!tryPush(std::move(value))) {
+      waitFor(m_popEpoch, m_producersWaiting, [this]() { return !full(); }, -1);
+    }
+  }
+
+  // 只能由消费者调用，空了返回false
+  bool tryPop(T* value) {
+    size_t pos = m_head.load(std::memory_order_relaxed);
+    Cell* cell = &m_cells[pos & m_mask];
+    if (cell->seq.load(std::memory_order_acquire) != pos + 1) {
+      return false;
+    }
+    *value = std::move(cell->value);
+    cell->value = T();
+    cell->seq.store(pos + m_mask + 1, std::memory_order_release);
+    m_head.store(pos + 1, std::memory_order_release);
+    signal(m_popEpoch, m_producersWaiting);
+    return true;
+  }
+
+  // 只能由消费者调用，空了一直等
+  T pop() {
+    T value;
+    popFor(&value, -1);
+    return value;
+  }
+
+  // 只能由消费者调用，timeoutMs < 0时不超时，超时返回false
+  bool popFor(T* value, int timeoutMs) {
+    while (!tryPop(value)) {
+      if (!waitFor(m_pushEpoch, m_consumerWaiting, [this]() { return readable(); }, timeoutMs)) {
+        return tryPop(value);
+      }
+    }
+    return true;
+  }
+
+  // 只能由消费者调用，等到至少有一个元素，再把已经发布的最多max个一起取走，返回取到的个数
+  size_t drain(std::vector<T>* out, size_t max) {
+    out->push_back(pop());
+    size_t n = 1;
+    T value;
+    while (n < max && tryPop(&value)) {
+      out->push_back(std::move(value));
+      ++n;
+    }
+    return n;
+  }
+
+  // 生产者之间互斥时（比如都在同一把锁里push）结果是准确的；否则只是一个估计
+  bool full() const {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire) > m_mask;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> seq;
+    T value;
+  };
+
+  bool readable() const {
+    size_t pos = m_head.load(std::memory_order_relaxed);
+    return m_cells[pos & m_mask].seq.load(std::memory_order_acquire) == pos + 1;
+  }
+
+  // 发布之后递增epoch，有人在等才futex唤醒
+  static void signal(std::atomic<uint32_t>& epoch, std::atomic<int>& waiting) {
+    epoch.fetch_add(1, std::memory_order_seq_cst);
+    if (waiting.load(std::memory_order_seq_cst) > 0) {
+      syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+    }
+  }
+
+  // 先记下epoch并登记为等待者，再检查条件：条件成立之后的signal一定会改变epoch，futex不会睡过去
+  template <typename Ready>
+  static bool waitFor(std::atomic<uint32_t>& epoch, std::atomic<int>& waiting, Ready ready, int timeoutMs) {
+    uint32_t seen = epoch.load(std::memory_order_seq_cst);
+    waiting.fetch_add(1, std::memory_order_seq_cst);
+    bool ok = true;
+    if (!ready()) {
+      timespec ts{timeoutMs / 1000, (timeoutMs % 1000) * 1000000L};
+      long ret = syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAIT_PRIVATE, seen,
+                         timeoutMs < 0 ? nullptr : &ts, nullptr, 0);
+      ok = !(ret < 0 && errno == ETIMEDOUT);
+    }
+    waiting.fetch_sub(1, std::memory_order_relaxed);
+    return ok;
+  }
+
+  std::unique_ptr<Cell[]> m_cells;
+  size_t m_mask;
+  // 生产者和消费者各写各的位置，分开放在不同的缓存行
+  alignas(64) std::atomic<size_t> m_tail{0};
+  alignas(64) std::atomic<size_t> m_head{0};
+  alignas(64) std::atomic<uint32_t> m_pushEpoch{0};
+  std::atomic<int> m_consumerWaiting{0};
+  alignas(64) std::atomic<uint32_t> m_popEpoch{0};
+  std::atomic<int> m_producersWaiting{0};
+};
+
+#endif  // MPSC_QUEUE_H
@@ -16,7 +16,11 @@
 #include <random>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 #include "config.h"
+#include "fiber_sync.hpp"
+#include "logger.h"
 
 template <class F>
 class DeferClass {
@@ -38,7 +42,8 @@ class DeferClass {
 #undef DEFER
 #define DEFER _MAKE_DEFER_(__LINE__)
 
-void DPrintf(const char* format, ...);
+// 调试日志，DEBUG级别，见logger.h
+#define DPrintf(fmt, ...) LOG_DEBUG(fmt, ##__VA_ARGS__)
 
 void myAssert(bool condition, std::string message = "Assertion failed!");
 
@@ -59,56 +64,115 @@ void sleepNMilliseconds(int N);
 
 // ////////////////////////异步写日志的日志队列
 // read is blocking!!! LIKE  go chan
+// 基于协程通道：在协程里读时只挂起协程，普通线程读时阻塞线程
 template <typename T>
 class LockQueue {
  public:
-  // 多个worker线程都会写日志queue
-  void Push(const T& data) {
-    std::lock_guard<std::mutex> lock(m_mutex);  //使用lock_gurad，即RAII的思想保证锁正确释放
-    m_queue.push(data);
-    m_condvariable.notify_one();
-  }
+  // 多个worker线程都会写日志queue，不限长度，不会阻塞
+  void Push(const T& data) { m_channel.push(data); }
+
+  void Push(T&& data) { m_channel.push(std::move(data)); }
 
   // 一个线程读日志queue，写日志文件
   T Pop() {
-    std::unique_lock<std::mutex> lock(m_mutex);
-    while (m_queue.empty()) {
-      // 日志队列为空，线程进入wait状态
-      m_condvariable.wait(lock);  //这里用unique_lock是因为lock_guard不支持解锁，而unique_lock支持
-    }
-    T data = m_queue.front();
-    m_queue.pop();
+    T data;
+    m_channel.pop(&data);
     return data;
   }
 
   bool timeOutPop(int timeout, T* ResData)  // 添加一个超时时间参数，默认为 50 毫秒
   {
-    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_channel.popFor(ResData, timeout);
+  }
 
-    // 获取当前时间点，并计算出超时时刻
-    auto now = std::chrono::system_clock::now();
-    auto timeout_time = now + std::chrono::milliseconds(timeout);
+ private:
+  monsoon::Channel<T> m_channel;
+};
 
-    // 在超时之前，不断检查队列是否为空
-    while (m_queue.empty()) {
-      // 如果已经超时了，就返回一个空对象
-      if (m_condvariable.wait_until(lock, timeout_time) == std::cv_status::timeout) {
-        return false;
-      } else {
-        continue;
+// 按raft index等待apply结果的登记表，代替每个请求new一个LockQueue再放进全局锁保护的map
+// 按index分片，每片一把锁；等待者在自己的栈上登记，apply线程可以一次完成一批
+// 等待用协程条件变量，在协程里等待时不占用线程
+// 同一个index上可能有多个等待者（leader换届后index被复用），完成时全部唤醒，由调用方核对结果是不是自己的
+template <typename T>
+class CompletionTable {
+ public:
+  // 在index上等待，超时返回false
+  bool Wait(int index, int timeoutMs, T* result) {
+    Shard& shard = m_shards[shardOf(index)];
+    Waiter waiter;
+    std::unique_lock<std::mutex> lk(shard.mtx);
+    auto& head = shard.waiters[index];
+    waiter.next = head;
+    head = &waiter;
+    if (waiter.cv.waitFor(lk, timeoutMs, [&]() { return waiter.done; })) {
+      *result = std::move(waiter.result);
+      return true;
+    }
+    // 超时，把自己从链表里摘掉
+    auto it = shard.waiters.find(index);
+    for (Waiter** p = &it->second; *p != nullptr; p = &(*p)->next) {
+      if (*p == &waiter) {
+        *p = waiter.next;
+        break;
       }
     }
+    if (it->second == nullptr) {
+      shard.waiters.erase(it);
+    }
+    return false;
+  }
 
-    T data = m_queue.front();
-    m_queue.pop();
-    *ResData = data;
-    return true;
+  void Complete(int index, const T& result) {
+    Shard& shard = m_shards[shardOf(index)];
+    std::lock_guard<std::mutex> lg(shard.mtx);
+    completeLocked(shard, index, result);
+  }
+
+  // 每个分片只加一次锁
+  void CompleteBatch(const std::vector<std::pair<int, T>>& items) {
+    for (int i = 0; i < kShards; ++i) {
+      std::unique_lock<std::mutex> lk(m_shards[i].mtx, std::defer_lock);
+      for (const auto& item : items) {
+        if (shardOf(item.first) != i) {
+          continue;
+        }
+        if (!lk.owns_lock()) {
+          lk.lock();
+        }
+        completeLocked(m_shards[i], item.first, item.second);
+      }
+    }
   }
 
  private:
-  std::queue<T> m_queue;
-  std::mutex m_mutex;
-  std::condition_variable m_condvariable;
+  static constexpr int kShards = 16;
+  struct Waiter {
+    monsoon::FiberCondVar cv;
+    bool done = false;
+    T result;
+    Waiter* next = nullptr;
+  };
+  struct Shard {
+    std::mutex mtx;
+    std::unordered_map<int, Waiter*> waiters;
+  };
+
+  static int shardOf(int index) { return static_cast<unsigned int>(index) % kShards; }
+
+  void completeLocked(Shard& shard, int index, const T& result) {
+    auto it = shard.waiters.find(index);
+    if (it == shard.waiters.end()) {
+      return;
+    }
+    for (Waiter* w = it->second; w != nullptr; w = w->next) {
+      w->result = result;
+      w->done = true;
+      w->cv.notifyOne();
+    }
+    shard.waiters.erase(it);
+  }
+
+  Shard m_shards[kShards];
 };
 // 两个对锁的管理用到了RAII的思想，防止中途出现问题而导致资源无法释放的问题！！！
 // std::lock_guard 和 std::unique_lock 都是 C++11 中用来管理互斥锁的工具类，它们都封装了 RAII（Resource Acquisition Is
@@ -126,52 +190,234 @@ class Op {
   // Your definitions here.
   // Field names must start with capital letters,
   // otherwise RPC will break.
-  std::string Operation;  // "Get" "Put" "Append"
+  std::string Operation;  // "Get" "Put" "Append" "Batch" "Register" "Range" "CompareAndSwap" "Increment" "AppendV2"
   std::string Key;
   std::string Value;
-  std::string ClientId;  //客户端号码
-  int RequestId;         //客户端号码请求的Request的序列号，为了保证线性一致性
-                         // IfDuplicate bool // Duplicate command can't be applied twice , but only for PUT and APPEND
+  uint64_t ClientId = 0;  //客户端的session id
+  int RequestId = 0;      //客户端号码请求的Request的序列号，为了保证线性一致性
+                          // IfDuplicate bool // Duplicate command can't be applied twice , but only for PUT and APPEND
+  // leader提交时的时间，ms，session按它过期；旧格式的日志里没有，解析出来是kNoTimestamp
+  int64_t Timestamp = 0;
+
+  static constexpr int64_t kNoTimestamp = -1;
 
  public:
-  // todo
-  //为了协调raftRPC中的command只设置成了string,这个的限制就是正常字符中不能包含|
-  //当然后期可以换成更高级的序列化方法，比如protobuf
+  // 写进LogEntry.Command的二进制编码，不再经过stringstream和boost文本归档：
+  // 0x01 | opcode | varint RequestId | varint ClientId | varint Timestamp | varint长度+Key | varint长度+Value
+  // 不在opcode表里的操作opcode写0，后面再跟varint长度+Operation
+  // boost文本归档总是以数字开头，第一个字节是0或1就是二进制格式，WAL里旧格式的日志仍然可以读：
+  // 0x00开头的ClientId是varint长度+字符串，没有Timestamp
   std::string asString() const {
-    std::stringstream ss;
-    boost::archive::text_oarchive oa(ss);
+    std::string out;
+    out.reserve(2 + 5 + 10 + 10 + 10 + Key.size() + Value.size());
+    out.push_back('\1');
+    uint8_t code = opcodeOf(Operation);
+    out.push_back(static_cast<char>(code));
+    if (code == 0) {
+      putBytes(&out, Operation);
+    }
+    putVarint32(&out, static_cast<uint32_t>(RequestId));
+    putVarint64(&out, ClientId);
+    putVarint64(&out, static_cast<uint64_t>(Timestamp));
+    putBytes(&out, Key);
+    putBytes(&out, Value);
+    return out;
+  }
+
+  // 没有session之前client id是随机的字符串，映射成最高位为1的id，不会和日志index分配的id冲突
+  static uint64_t legacyClientId(const std::string& clientId) {
+    uint64_t h = 14695981039346656037ull;  // FNV-1a
+    for (unsigned char c : clientId) {
+      h = (h ^ c) * 1099511628211ull;
+    }
+    return h | 1ull << 63;
+  }
+
+  // 直接从日志内容里把各字段拷到成员上，格式不对时返回false
+  bool parseFromString(const std::string& str) {
+    if (str.empty() || (str[0] != '\0' && str[0] != '\1')) {
+      std::stringstream iss(str);
+      boost::archive::text_iarchive ia(iss);
+      // read class state from archive
+      ia >> *this;
+      return true;  // todo : 解析失敗如何處理，要看一下boost庫了
+    }
+    bool legacy = str[0] == '\0';
+    const char* p = str.data() + 1;
+    const char* end = str.data() + str.size();
+    if (p == end) {
+      return false;
+    }
+    uint8_t code = static_cast<uint8_t>(*p++);
+    if (code == 0) {
+      if (!getBytes(&p, end, &Operation)) {
+        return false;
+      }
+    } else if (code < sizeof(kOpNames) / sizeof(kOpNames[0])) {
+      Operation = kOpNames[code];
+    } else {
+      return false;
+    }
+    uint32_t requestId = 0;
+    if (!getVarint32(&p, end, &requestId)) {
+      return false;
+    }
+    RequestId = static_cast<int>(requestId);
+    if (legacy) {
+      std::string clientId;
+      if (!getBytes(&p, end, &clientId)) {
+        return false;
+      }
+      ClientId = legacyClientId(clientId);
+      Timestamp = kNoTimestamp;
+    } else {
+      uint64_t timestamp = 0;
+      if (!getVarint64(&p, end, &ClientId) || !getVarint64(&p, end, &timestamp)) {
+        return false;
+      }
+      Timestamp = static_cast<int64_t>(timestamp);
+    }
+    return getBytes(&p, end, &Key) && getBytes(&p, end, &Value) && p == end;
+  }
 
-    // write class instance to archive
-    oa << *this;
-    // close archive
+  // "Batch"操作的Value：依次是每个子操作的varint长度+asString()，子操作的ClientId/RequestId不用，以外层为准
+  static std::string encodeBatch(const std::vector<Op>& ops) {
+    std::string out;
+    for (const auto& op : ops) {
+      putBytes(&out, op.asString());
+    }
+    return out;
+  }
 
-    return ss.str();
+  // "CompareAndSwap"操作的Value：1字节（1表示要求key不存在） | varint长度+期望值 | 新值
+  // "Increment"操作的Value是十进制的delta
+  static std::string encodeCompareAndSwap(const std::string& expected, bool expectAbsent, const std::string& value) {
+    std::string out;
+    out.reserve(1 + 5 + expected.size() + value.size());
+    out.push_back(expectAbsent ? '\1' : '\0');
+    putBytes(&out, expected);
+    out += value;
+    return out;
   }
 
-  bool parseFromString(std::string str) {
-    std::stringstream iss(str);
-    boost::archive::text_iarchive ia(iss);
-    // read class state from archive
-    ia >> *this;
-    return true;  // todo : 解析失敗如何處理，要看一下boost庫了
+  static bool decodeCompareAndSwap(const std::string& data, std::string* expected, bool* expectAbsent,
+                                   std::string* value) {
+    const char* p = data.data();
+    const char* end = data.data() + data.size();
+    if (p == end) {
+      return false;
+    }
+    *expectAbsent = *p++ == '\1';
+    if (!getBytes(&p, end, expected)) {
+      return false;
+    }
+    value->assign(p, end);
+    return true;
+  }
+
+  static bool decodeBatch(const std::string& data, std::vector<Op>* ops) {
+    const char* p = data.data();
+    const char* end = data.data() + data.size();
+    std::string item;
+    while (p < end) {
+      ops->emplace_back();
+      if (!getBytes(&p, end, &item) || !ops->back().parseFromString(item)) {
+        return false;
+      }
+    }
+    return true;
   }
 
  public:
   friend std::ostream& operator<<(std::ostream& os, const Op& obj) {
     os << "[MyClass:Operation{" + obj.Operation + "},Key{" + obj.Key + "},Value{" + obj.Value + "},ClientId{" +
-              obj.ClientId + "},RequestId{" + std::to_string(obj.RequestId) + "}";  // 在这里实现自定义的输出格式
+              std::to_string(obj.ClientId) + "},RequestId{" + std::to_string(obj.RequestId) +
+              "}";  // 在这里实现自定义的输出格式
     return os;
   }
 
  private:
   friend class boost::serialization::access;
   template <class Archive>
+  // 只用来读旧的日志
   void serialize(Archive& ar, const unsigned int version) {
+    std::string clientId;
     ar& Operation;
     ar& Key;
     ar& Value;
-    ar& ClientId;
+    ar& clientId;
     ar& RequestId;
+    ClientId = legacyClientId(clientId);
+    Timestamp = kNoTimestamp;
+  }
+
+  // 下标即opcode，0留给表里没有的操作；只能往后加，已经写进日志的opcode不能改
+  // "Append"是旧版本写下的日志，apply时和Put一样覆盖；真正接在原值后面的是"AppendV2"
+  static constexpr const char* kOpNames[] = {"",      "Get",      "Put",   "Append",         "Scan",     "Batch",
+                                             "Register", "Range", "CompareAndSwap", "Increment", "AppendV2"};
+
+  static uint8_t opcodeOf(const std::string& operation) {
+    for (uint8_t i = 1; i < sizeof(kOpNames) / sizeof(kOpNames[0]); ++i) {
+      if (operation == kOpNames[i]) {
+        return i;
+      }
+    }
+    return 0;
+  }
+
+  static void putVarint32(std::string* out, uint32_t v) {
+    while (v >= 0x80) {
+      out->push_back(static_cast<char>(v | 0x80));
+      v >>= 7;
+    }
+    out->push_back(static_cast<char>(v));
+  }
+
+  static void putVarint64(std::string* out, uint64_t v) {
+    while (v >= 0x80) {
+      out->push_back(static_cast<char>(v | 0x80));
+      v >>= 7;
+    }
+    out->push_back(static_cast<char>(v));
+  }
+
+  static void putBytes(std::string* out, const std::string& v) {
+    putVarint32(out, static_cast<uint32_t>(v.size()));
+    out->append(v);
+  }
+
+  static bool getVarint32(const char** p, const char* end, uint32_t* v) {
+    *v = 0;
+    for (int shift = 0; shift <= 28 && *p < end; shift += 7) {
+      uint32_t byte = static_cast<unsigned char>(*(*p)++);
+      *v |= (byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static bool getVarint64(const char** p, const char* end, uint64_t* v) {
+    *v = 0;
+    for (int shift = 0; shift <= 63 && *p < end; shift += 7) {
+      uint64_t byte = static_cast<unsigned char>(*(*p)++);
+      *v |= (byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static bool getBytes(const char** p, const char* end, std::string* v) {
+    uint32_t len = 0;
+    if (!getVarint32(p, end, &len) || static_cast<size_t>(end - *p) < len) {
+      return false;
+    }
+    v->assign(*p, len);
+    *p += len;
+    return true;
   }
 };
 
@@ -180,6 +426,27 @@ class Op {
 const std::string OK = "OK";
 const std::string ErrNoKey = "ErrNoKey";
 const std::string ErrWrongLeader = "ErrWrongLeader";
+const std::string ErrBadRequest = "ErrBadRequest";  // 请求本身不合法，重试也没用
+// client的session已经过期或者不存在，重新RegisterClient之后再发
+const std::string ErrSessionExpired = "ErrSessionExpired";
+// key不归请求里的GroupId负责，clerk的范围表和服务端不一致
+const std::string ErrWrongGroup = "ErrWrongGroup";
+// 领导权没有交出去：目标没有及时追上日志，或者TimeoutNow没有送到，稍后再试
+const std::string ErrTransferFailed = "ErrTransferFailed";
+// 上一次成员变更还没有提交，或者要提升的learner还没追上日志，稍后再试
+const std::string ErrMembershipBusy = "ErrMembershipBusy";
+// CompareAndSwap时key的值不是期望的值（或者要求不存在而key存在），回复的Value是当前值
+const std::string ErrCompareFailed = "ErrCompareFailed";
+// Increment时key的值不是十进制的int64，或者加上之后溢出
+const std::string ErrNotInteger = "ErrNotInteger";
+// 重试的CompareAndSwap/Increment之前已经执行过了，但是结果已经被同一个client后来的原子操作替换，不知道当时的结果
+const std::string ErrAlreadyApplied = "ErrAlreadyApplied";
+
+///////////////////////////////////////////////成员变更的种类，即ChangeMembershipArgs.Kind
+
+constexpr int AddLearner = 0;      // 加入一个learner，只接收日志
+constexpr int PromoteLearner = 1;  // 把追上日志的learner提升为投票成员
+constexpr int RemoveMember = 2;    // 移除一个投票成员或者learner
 
 ////////////////////////////////////获取可用端口
 
@@ -0,0 +1,153 @@
+#include "logger.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include "metrics.h"
+
+std::atomic<int> Logger::s_level{LOG_DEFAULT_LEVEL};
+
+namespace {
+pid_t currentTid() {
+  thread_local pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+  return tid;
+}
+
+const char *levelName(int level) {
+  static const char *names[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+  return level >= 0 && level < 4 ? names[level] : "?";
+}
+
+// 只保留文件名，不要编译时的完整路径
+const char *baseName(const char *file) {
+  const char *slash = strrchr(file, '/');
+  return slash ? slash + 1 : file;
+}
+}  // namespace
+
+Logger &Logger::Instance() {
+  // 不析构：退出时别的线程可能还在写日志；atexit里把还在队列里的写出去
+  static Logger *logger = []() {
+    Logger *l = new Logger();
+    std::atexit([]() { Logger::Instance().Flush(); });
+    return l;
+  }();
+  return *logger;
+}
+
+int Logger::ParseLevel(const std::string &name) {
+  static const char *names[] = {"debug", "info", "warn", "error", "off"};
+  for (int i = 0; i < 5; ++i) {
+    if (strcasecmp(name.c_str(), names[i]) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+Logger::Logger() : m_queue(LOG_QUEUE_CAPACITY), m_out(stdout) {
+  const char *env = getenv("KV_LOG_LEVEL");
+  if (env != nullptr) {
+    int level = ParseLevel(env);
+    if (level >= 0) {
+      SetLevel(level);
+    }
+  }
+  m_flusher = std::thread(&Logger::flushLoop, this);
+  m_flusher.detach();
+}
+
+bool Logger::SetOutput(const std::string &path) {
+  FILE *out = path.empty() ? stdout : fopen(path.c_str(), "a");
+  if (out == nullptr) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lk(m_outMtx);
+  fflush(m_out);
+  if (m_out != stdout) {
+    fclose(m_out);
+  }
+  m_out = out;
+  return true;
+}
+
+void Logger::Log(int level, const char *file, int line, const char *fmt, ...) {
+  static MetricCounter *dropped = Metrics::Instance().Counter("log_dropped_total", "日志队列满时丢掉的行数");
+  Record record;
+  record.level = level;
+  record.line = line;
+  record.file = file;
+  record.tid = currentTid();
+  record.timeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::system_clock::now().time_since_epoch())
+                      .count();
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(record.text, sizeof(record.text), fmt, args);
+  va_end(args);
+  // 太长的截断；原来DPrintf的调用里有的自己带了换行，写出时统一去掉再加一个
+  record.len = n < 0 ? 0 : std::min<uint32_t>(n, sizeof(record.text) - 1);
+  while (record.len > 0 && record.text[record.len - 1] == '\n') {
+    --record.len;
+  }
+  if (m_queue.tryPush(std::move(record))) {
+    m_pushed.fetch_add(1, std::memory_order_release);
+  } else {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    dropped->add();
+  }
+}
+
+void Logger::Flush(int timeoutMs) {
+  uint64_t target = m_pushed.load(std::memory_order_acquire);
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  while (m_written.load(std::memory_order_acquire) < target && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+void Logger::writeRecord(const Record &record, std::string *out) {
+  // 只有后台线程调用，同一秒内的日志不用重复转换时间
+  static time_t lastSec = -1;
+  static tm t;
+  time_t sec = static_cast<time_t>(record.timeUs / 1000000);
+  if (sec != lastSec) {
+    localtime_r(&sec, &t);
+    lastSec = sec;
+  }
+  char prefix[128];
+  int n = snprintf(prefix, sizeof(prefix), "[%04d-%02d-%02d %02d:%02d:%02d.%06d] %-5s %d %s:%d ", t.tm_year + 1900,
+                   t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec, static_cast<int>(record.timeUs % 1000000),
+                   levelName(record.level), record.tid, baseName(record.file), record.line);
+  out->append(prefix, n > 0 ? std::min<size_t>(n, sizeof(prefix) - 1) : 0);
+  out->append(record.text, record.len);
+  out->push_back('\n');
+}
+
+void Logger::flushLoop() {
+  std::string batch;
+  Record record;
+  while (true) {
+    // 一直取到队列空（或者攒够一块）再一起写出去，一批只有一次fwrite和fflush
+    uint64_t n = 0;
+    if (!m_queue.popFor(&record, 100)) {
+      continue;
+    }
+    do {
+      writeRecord(record, &batch);
+      ++n;
+    } while (batch.size() < LOG_FLUSH_BYTES && m_queue.tryPop(&record));
+    {
+      std::lock_guard<std::mutex> lk(m_outMtx);
+      fwrite(batch.data(), 1, batch.size(), m_out);
+      fflush(m_out);
+    }
+    batch.clear();
+    m_written.fetch_add(n, std::memory_order_release);
+  }
+}
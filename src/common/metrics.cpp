@@ -0,0 +1,118 @@
+#include "metrics.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+Metrics &Metrics::Instance() {
+  // 不析构：退出时别的线程可能还在记录
+  static Metrics *metrics = new Metrics();
+  return *metrics;
+}
+
+MetricCounter *Metrics::Counter(const std::string &name, const std::string &help) {
+  std::lock_guard<std::mutex> lk(m_mtx);
+  Entry &entry = m_entries[name];
+  if (!entry.counter) {
+    entry.help = help;
+    entry.counter = std::make_unique<MetricCounter>();
+  }
+  return entry.counter.get();
+}
+
+LatencyHistogram *Metrics::Histogram(const std::string &name, const std::string &help) {
+  std::lock_guard<std::mutex> lk(m_mtx);
+  Entry &entry = m_entries[name];
+  if (!entry.histogram) {
+    entry.help = help;
+    entry.histogram = std::make_unique<LatencyHistogram>();
+  }
+  return entry.histogram.get();
+}
+
+void Metrics::Gauge(const std::string &name, const std::string &help, std::function<double()> fn) {
+  std::lock_guard<std::mutex> lk(m_mtx);
+  Entry &entry = m_entries[name];
+  entry.help = help;
+  entry.gauge = std::move(fn);
+}
+
+namespace {
+
+// "a{x=\"1\"}" -> base "a"，labels "x=\"1\""
+void splitName(const std::string &name, std::string *base, std::string *labels) {
+  size_t brace = name.find('{');
+  if (brace == std::string::npos) {
+    *base = name;
+    labels->clear();
+    return;
+  }
+  *base = name.substr(0, brace);
+  *labels = name.substr(brace + 1, name.size() - brace - 2);
+}
+
+std::string withLabels(const std::string &base, const std::string &labels, const std::string &extra = "") {
+  if (labels.empty() && extra.empty()) {
+    return base;
+  }
+  std::string out = base + "{" + labels;
+  if (!labels.empty() && !extra.empty()) {
+    out += ",";
+  }
+  return out + extra + "}";
+}
+
+void appendSample(std::string *out, const std::string &name, double value) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), " %.15g\n", value);
+  *out += name;
+  *out += buf;
+}
+
+}  // namespace
+
+std::string Metrics::RenderPrometheus() {
+  struct Snapshot {
+    std::string name;
+    std::string help;
+    MetricCounter *counter;
+    LatencyHistogram *histogram;
+    std::function<double()> gauge;
+  };
+  // gauge的fn可能要拿别的锁，不在m_mtx里调用
+  std::vector<Snapshot> entries;
+  {
+    std::lock_guard<std::mutex> lk(m_mtx);
+    entries.reserve(m_entries.size());
+    for (auto &item : m_entries) {
+      entries.push_back({item.first, item.second.help, item.second.counter.get(), item.second.histogram.get(),
+                         item.second.gauge});
+    }
+  }
+
+  std::string out;
+  std::string lastBase;
+  std::string base;
+  std::string labels;
+  for (const auto &e : entries) {
+    splitName(e.name, &base, &labels);
+    if (base != lastBase) {
+      const char *type = e.counter ? "counter" : e.histogram ? "summary" : "gauge";
+      out += "# HELP " + base + " " + e.help + "\n# TYPE " + base + " " + type + "\n";
+      lastBase = base;
+    }
+    if (e.counter) {
+      appendSample(&out, e.name, static_cast<double>(e.counter->value()));
+    } else if (e.histogram) {
+      for (const char *q : {"0.5", "0.9", "0.99", "0.999"}) {
+        appendSample(&out, withLabels(base, labels, std::string("quantile=\"") + q + "\""),
+                     static_cast<double>(e.histogram->percentile(atof(q) * 100)));
+      }
+      appendSample(&out, withLabels(base + "_sum", labels), e.histogram->mean() * e.histogram->count());
+      appendSample(&out, withLabels(base + "_count", labels), static_cast<double>(e.histogram->count()));
+    } else if (e.gauge) {
+      appendSample(&out, e.name, e.gauge());
+    }
+  }
+  return out;
+}
@@ -7,6 +7,7 @@
 
 void myAssert(bool condition, std::string message) {
   if (!condition) {
+    Logger::Instance().Flush();
     std::cerr << "Error: " << message << std::endl;
     std::exit(EXIT_FAILURE);
   }
@@ -15,8 +16,8 @@ void myAssert(bool condition, std::string message) {
 std::chrono::_V2::system_clock::time_point now() { return std::chrono::high_resolution_clock::now(); }
 
 std::chrono::milliseconds getRandomizedElectionTimeout() {
-  std::random_device rd;
-  std::mt19937 rng(rd());
+  // random_device每次都要读系统熵源，每个线程只取一次种子
+  static thread_local std::mt19937 rng(std::random_device{}());
   std::uniform_int_distribution<int> dist(minRandomizedElectionTime, maxRandomizedElectionTime);
 
   return std::chrono::milliseconds(dist(rng));
@@ -51,18 +52,3 @@ bool isReleasePort(unsigned short usPort) {
   close(s);
   return true;
 }
-
-void DPrintf(const char *format, ...) {
-  if (Debug) {
-    // 获取当前的日期，然后取日志信息，写入相应的日志文件当中 a+
-    time_t now = time(nullptr);
-    tm *nowtm = localtime(&now);
-    va_list args;
-    va_start(args, format);
-    std::printf("[%d-%d-%d-%d-%d-%d] ", nowtm->tm_year + 1900, nowtm->tm_mon + 1, nowtm->tm_mday, nowtm->tm_hour,
-                nowtm->tm_min, nowtm->tm_sec);
-    std::vprintf(format, args);
-    std::printf("\n");
-    va_end(args);
-  }
-}
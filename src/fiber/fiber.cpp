@@ -2,6 +2,7 @@
 #include <assert.h>
 #include <atomic>
 #include "scheduler.hpp"
+#include "stack_allocator.hpp"
 #include "utils.hpp"
 
 namespace monsoon {
@@ -15,18 +16,13 @@ static std::atomic<uint64_t> cur_fiber_id{0};
 // 统计当前协程数
 static std::atomic<uint64_t> fiber_count{0};
 // 协议栈默认大小 128k
-static int g_fiber_stack_size = 128 * 1024;
+static size_t g_fiber_stack_size = StackAllocator::kDefaultStackSize;
 
-class StackAllocator {
- public:
-  static void *Alloc(size_t size) { return malloc(size); }
-  static void Delete(void *vp, size_t size) { return free(vp); }
-};
 // only for GetThis
 Fiber::Fiber() {
   SetThis(this);
   state_ = RUNNING;
-  CondPanic(getcontext(&ctx_) == 0, "getcontext error");
+  InitMainContext(&ctx_);
   ++fiber_count;
   id_ = cur_fiber_id++;
   std::cout << "[fiber] create fiber , id = " << id_ << std::endl;
@@ -51,14 +47,11 @@ Fiber::ptr Fiber::GetThis() {
 Fiber::Fiber(std::function<void()> cb, size_t stacksize, bool run_inscheduler)
     : id_(cur_fiber_id++), cb_(cb), isRunInScheduler_(run_inscheduler) {
   ++fiber_count;
-  stackSize_ = stacksize > 0 ? stacksize : g_fiber_stack_size;
+  // 按档位取整，同档位的栈可以互相复用
+  stackSize_ = StackAllocator::RoundUp(stacksize > 0 ? stacksize : g_fiber_stack_size);
   stack_ptr = StackAllocator::Alloc(stackSize_);
-  CondPanic(getcontext(&ctx_) == 0, "getcontext error");
   // 初始化协程上下文
-  ctx_.uc_link = nullptr;
-  ctx_.uc_stack.ss_sp = stack_ptr;
-  ctx_.uc_stack.ss_size = stackSize_;
-  makecontext(&ctx_, &Fiber::MainFunc, 0);
+  MakeContext(&ctx_, stack_ptr, stackSize_, &Fiber::MainFunc);
 
   // std::cout << "create son fiber , id = " << id_ << ",backtrace:\n"
   //           << BacktraceToString(6, 3, "") << std::endl;
@@ -73,11 +66,10 @@ void Fiber::resume() {
 
   if (isRunInScheduler_) {
     // 当前协程参与调度器调度，则与调度器主协程进行swap
-    CondPanic(0 == swapcontext(&(Scheduler::GetMainFiber()->ctx_), &ctx_),
-              "isRunInScheduler_ = true,swapcontext error");
+    SwapContext(&(Scheduler::GetMainFiber()->ctx_), &ctx_);
   } else {
     // 切换主协程到当前协程，并保存主协程上下文到子协程ctx_
-    CondPanic(0 == swapcontext(&(cur_thread_fiber->ctx_), &ctx_), "isRunInScheduler_ = false,swapcontext error");
+    SwapContext(&(cur_thread_fiber->ctx_), &ctx_);
   }
 }
 
@@ -90,14 +82,18 @@ void Fiber::yield() {
     state_ = READY;
   }
   if (isRunInScheduler_) {
-    CondPanic(0 == swapcontext(&ctx_, &(Scheduler::GetMainFiber()->ctx_)),
-              "isRunInScheduler_ = true,swapcontext error");
+    SwapContext(&ctx_, &(Scheduler::GetMainFiber()->ctx_));
   } else {
     // 切换当前协程到主协程，并保存子协程的上下文到主协程ctx_
-    CondPanic(0 == swapcontext(&ctx_, &(cur_thread_fiber->ctx_)), "swapcontext failed");
+    SwapContext(&ctx_, &(cur_thread_fiber->ctx_));
   }
 }
 
+bool Fiber::InScheduler() {
+  return cur_fiber != nullptr && cur_fiber->isRunInScheduler_ && Scheduler::GetThis() != nullptr &&
+         cur_fiber != Scheduler::GetMainFiber();
+}
+
 // 协程入口函数
 void Fiber::MainFunc() {
   Fiber::ptr cur = GetThis();
@@ -120,12 +116,7 @@ void Fiber::reset(std::function<void()> cb) {
   CondPanic(stack_ptr, "stack is nullptr");
   CondPanic(state_ == TERM, "state isn't TERM");
   cb_ = cb;
-  CondPanic(0 == getcontext(&ctx_), "getcontext failed");
-  ctx_.uc_link = nullptr;
-  ctx_.uc_stack.ss_sp = stack_ptr;
-  ctx_.uc_stack.ss_size = stackSize_;
-
-  makecontext(&ctx_, &Fiber::MainFunc, 0);
+  MakeContext(&ctx_, stack_ptr, stackSize_, &Fiber::MainFunc);
   state_ = READY;
 }
 
@@ -0,0 +1,126 @@
+#include "fiber_context.hpp"
+#include <stdint.h>
+
+#ifndef MONSOON_USE_UCONTEXT
+
+#if defined(__x86_64__)
+// 栈上从低到高：mxcsr|x87控制字、对齐填充、r15、r14、r13、r12、rbx、rbp、返回地址
+asm(R"(
+  .pushsection .text
+  .globl monsoon_swap_context
+  .type monsoon_swap_context, @function
+  .align 16
+monsoon_swap_context:
+  pushq %rbp
+  pushq %rbx
+  pushq %r12
+  pushq %r13
+  pushq %r14
+  pushq %r15
+  subq $16, %rsp
+  stmxcsr (%rsp)
+  fnstcw 4(%rsp)
+  movq %rsp, (%rdi)
+  movq %rsi, %rsp
+  ldmxcsr (%rsp)
+  fldcw 4(%rsp)
+  addq $16, %rsp
+  popq %r15
+  popq %r14
+  popq %r13
+  popq %r12
+  popq %rbx
+  popq %rbp
+  ret
+  .size monsoon_swap_context, .-monsoon_swap_context
+
+  .globl monsoon_fiber_entry
+  .type monsoon_fiber_entry, @function
+  .align 16
+monsoon_fiber_entry:
+  call *%r12
+  ud2
+  .size monsoon_fiber_entry, .-monsoon_fiber_entry
+  .popsection
+)");
+
+namespace monsoon {
+void MakeContext(FiberContext *ctx, void *stack, size_t size, void (*fn)()) {
+  uintptr_t top = (reinterpret_cast<uintptr_t>(stack) + size) & ~static_cast<uintptr_t>(15);
+  // ret之后rsp正好16字节对齐，入口里的call再压入返回地址，fn看到的就是正常的调用栈
+  uint64_t *frame = reinterpret_cast<uint64_t *>(top - 8) - 8;
+  frame[0] = 0x1F80 | (static_cast<uint64_t>(0x037F) << 32);  // mxcsr和x87控制字的默认值
+  frame[1] = 0;
+  frame[2] = 0;                                    // r15
+  frame[3] = 0;                                    // r14
+  frame[4] = 0;                                    // r13
+  frame[5] = reinterpret_cast<uint64_t>(fn);       // r12
+  frame[6] = 0;                                    // rbx
+  frame[7] = 0;                                    // rbp
+  frame[8] = reinterpret_cast<uint64_t>(&monsoon_fiber_entry);
+  ctx->sp = frame;
+}
+}  // namespace monsoon
+
+#elif defined(__aarch64__)
+// 栈上从低到高：d8-d15、x19-x28、x29、x30
+asm(R"(
+  .pushsection .text
+  .globl monsoon_swap_context
+  .type monsoon_swap_context, %function
+  .align 4
+monsoon_swap_context:
+  sub sp, sp, #0xa0
+  stp d8, d9, [sp, #0x00]
+  stp d10, d11, [sp, #0x10]
+  stp d12, d13, [sp, #0x20]
+  stp d14, d15, [sp, #0x30]
+  stp x19, x20, [sp, #0x40]
+  stp x21, x22, [sp, #0x50]
+  stp x23, x24, [sp, #0x60]
+  stp x25, x26, [sp, #0x70]
+  stp x27, x28, [sp, #0x80]
+  stp x29, x30, [sp, #0x90]
+  mov x9, sp
+  str x9, [x0]
+  mov sp, x1
+  ldp d8, d9, [sp, #0x00]
+  ldp d10, d11, [sp, #0x10]
+  ldp d12, d13, [sp, #0x20]
+  ldp d14, d15, [sp, #0x30]
+  ldp x19, x20, [sp, #0x40]
+  ldp x21, x22, [sp, #0x50]
+  ldp x23, x24, [sp, #0x60]
+  ldp x25, x26, [sp, #0x70]
+  ldp x27, x28, [sp, #0x80]
+  ldp x29, x30, [sp, #0x90]
+  add sp, sp, #0xa0
+  ret
+  .size monsoon_swap_context, .-monsoon_swap_context
+
+  .globl monsoon_fiber_entry
+  .type monsoon_fiber_entry, %function
+  .align 4
+monsoon_fiber_entry:
+  blr x19
+  brk #0
+  .size monsoon_fiber_entry, .-monsoon_fiber_entry
+  .popsection
+)");
+
+namespace monsoon {
+void MakeContext(FiberContext *ctx, void *stack, size_t size, void (*fn)()) {
+  uintptr_t top = (reinterpret_cast<uintptr_t>(stack) + size) & ~static_cast<uintptr_t>(15);
+  uint64_t *frame = reinterpret_cast<uint64_t *>(top - 0xa0);
+  for (int i = 0; i < 20; ++i) {
+    frame[i] = 0;
+  }
+  frame[8] = reinterpret_cast<uint64_t>(fn);                    // x19
+  frame[19] = reinterpret_cast<uint64_t>(&monsoon_fiber_entry);  // x30
+  ctx->sp = frame;
+}
+}  // namespace monsoon
+
+#endif
+
+#endif
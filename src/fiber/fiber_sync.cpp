@@ -0,0 +1,158 @@
+#include "fiber_sync.hpp"
+#include <chrono>
+#include "scheduler.hpp"
+#include "timer.hpp"
+
+namespace monsoon {
+bool WaitQueue::wait(Mutex &mutex, uint64_t timeoutMs) {
+  FiberWaiter local;
+  if (!Fiber::InScheduler()) {
+    return waitThread(mutex, &local, timeoutMs);
+  }
+  TimerManager *timers = nullptr;
+  if (timeoutMs != ~0ull) {
+    timers = dynamic_cast<TimerManager *>(Scheduler::GetThis());
+    if (timers == nullptr) {
+      // 调度器没有定时器，只能阻塞线程等待
+      return waitThread(mutex, &local, timeoutMs);
+    }
+  }
+  // 带超时的等待者定时器回调里也要访问，放在堆上
+  std::shared_ptr<FiberWaiter> holder;
+  FiberWaiter *waiter = &local;
+  if (timers != nullptr) {
+    holder = std::make_shared<FiberWaiter>();
+    waiter = holder.get();
+  }
+  waiter->scheduler = Scheduler::GetThis();
+  waiter->fiber = Fiber::GetThis();
+  waiter->thread = GetThreadId();
+  push(waiter);
+  Timer::ptr timer;
+  if (timers != nullptr) {
+    timer = timers->addTimer(timeoutMs, [this, &mutex, holder]() {
+      Mutex::Lock lock(mutex);
+      if (holder->queued) {
+        remove(holder.get());
+        wake(holder.get());
+      }
+    });
+  }
+  mutex.unlock();
+  Fiber::GetThis()->yield();
+  mutex.lock();
+  if (timer) {
+    timer->cancel();
+  }
+  // 定时器回调可能还持有holder，不能让它再持有协程
+  waiter->fiber.reset();
+  return waiter->notified;
+}
+
+bool WaitQueue::waitThread(Mutex &mutex, FiberWaiter *waiter, uint64_t timeoutMs) {
+  push(waiter);
+  mutex.unlock();
+  {
+    std::unique_lock<std::mutex> lk(waiter->mtx);
+    if (timeoutMs == ~0ull) {
+      waiter->cv.wait(lk, [waiter]() { return waiter->signalled; });
+    } else {
+      waiter->cv.wait_for(lk, std::chrono::milliseconds(timeoutMs), [waiter]() { return waiter->signalled; });
+    }
+  }
+  mutex.lock();
+  if (waiter->queued) {
+    // 超时了还没被唤醒
+    remove(waiter);
+  }
+  return waiter->notified;
+}
+
+bool WaitQueue::notifyOne() {
+  FiberWaiter *waiter = head_;
+  if (waiter == nullptr) {
+    return false;
+  }
+  remove(waiter);
+  waiter->notified = true;
+  wake(waiter);
+  return true;
+}
+
+void WaitQueue::notifyAll() {
+  while (notifyOne()) {
+  }
+}
+
+void WaitQueue::push(FiberWaiter *waiter) {
+  waiter->prev = tail_;
+  waiter->next = nullptr;
+  if (tail_ != nullptr) {
+    tail_->next = waiter;
+  } else {
+    head_ = waiter;
+  }
+  tail_ = waiter;
+  waiter->queued = true;
+}
+
+void WaitQueue::remove(FiberWaiter *waiter) {
+  if (waiter->prev != nullptr) {
+    waiter->prev->next = waiter->next;
+  } else {
+    head_ = waiter->next;
+  }
+  if (waiter->next != nullptr) {
+    waiter->next->prev = waiter->prev;
+  } else {
+    tail_ = waiter->prev;
+  }
+  waiter->prev = waiter->next = nullptr;
+  waiter->queued = false;
+}
+
+void WaitQueue::wake(FiberWaiter *waiter) {
+  if (waiter->fiber) {
+    waiter->scheduler->scheduler(waiter->fiber, waiter->thread);
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lg(waiter->mtx);
+    waiter->signalled = true;
+  }
+  waiter->cv.notify_one();
+}
+
+void FiberMutex::lock() {
+  Mutex::Lock lock(mutex_);
+  while (locked_) {
+    waiters_.wait(mutex_);
+  }
+  locked_ = true;
+}
+
+bool FiberMutex::try_lock() {
+  Mutex::Lock lock(mutex_);
+  if (locked_) {
+    return false;
+  }
+  locked_ = true;
+  return true;
+}
+
+void FiberMutex::unlock() {
+  Mutex::Lock lock(mutex_);
+  locked_ = false;
+  waiters_.notifyOne();
+}
+
+void FiberCondVar::notifyOne() {
+  Mutex::Lock lock(mutex_);
+  waiters_.notifyOne();
+}
+
+void FiberCondVar::notifyAll() {
+  Mutex::Lock lock(mutex_);
+  waiters_.notifyAll();
+}
+}  // namespace monsoon
@@ -64,8 +64,18 @@ struct timer_info {
   int cnacelled = 0;
 };
 
+// 可以整个交给io_uring执行的读写，数据未就绪时do_io用它代替epoll等待再重试
+struct uring_io {
+  enum Op { READ, RECV, WRITE, SEND };
+  Op op;
+  void *buf;
+  size_t len;
+  int flags;
+};
+
 template <typename OriginFun, typename... Args>
-static ssize_t do_io(int fd, OriginFun fun, const char *hook_fun_name, uint32_t event, int timeout_so, Args &&...args) {
+static ssize_t do_io(int fd, const uring_io *uio, OriginFun fun, const char *hook_fun_name, uint32_t event,
+                     int timeout_so, Args &&...args) {
   if (!t_hook_enable) {
     return fun(fd, std::forward<Args>(args)...);
   }
@@ -96,6 +106,12 @@ retry:
   if (n == -1 && errno == EAGAIN) {
     // 数据未就绪
     IOManager *iom = IOManager::GetThis();
+#ifdef MONSOON_WITH_IO_URING
+    if (uio != nullptr && iom->uringEnabled()) {
+      static const uint8_t ops[] = {IORING_OP_READ, IORING_OP_RECV, IORING_OP_WRITE, IORING_OP_SEND};
+      return iom->uringSocketIo(fd, (Event)event, ops[uio->op], uio->buf, uio->len, uio->flags, to);
+    }
+#endif
     Timer::ptr timer;
     std::weak_ptr<timer_info> winfo(tinfo);
 
@@ -153,10 +169,12 @@ unsigned int sleep(unsigned int seconds) {
     return sleep_f(seconds);
   }
   // 允许hook,则直接让当前协程退出，seconds秒后再重启（by定时器）
+  // 定时器可能在yield之前就在别的线程到期，只能调度回本线程
   Fiber::ptr fiber = Fiber::GetThis();
   IOManager *iom = IOManager::GetThis();
   iom->addTimer(seconds * 1000,
-                std::bind((void(Scheduler::*)(Fiber::ptr, int thread)) & IOManager::scheduler, iom, fiber, -1));
+                std::bind((void(Scheduler::*)(Fiber::ptr, int thread)) & IOManager::scheduler, iom, fiber,
+                          GetThreadId()));
   Fiber::GetThis()->yield();
   return 0;
 }
@@ -175,7 +193,8 @@ int usleep(useconds_t usec) {
   Fiber::ptr fiber = Fiber::GetThis();
   IOManager *iom = IOManager::GetThis();
   iom->addTimer(usec / 1000,
-                std::bind((void(Scheduler::*)(Fiber::ptr, int thread)) & IOManager::scheduler, iom, fiber, -1));
+                std::bind((void(Scheduler::*)(Fiber::ptr, int thread)) & IOManager::scheduler, iom, fiber,
+                          GetThreadId()));
   Fiber::GetThis()->yield();
   return 0;
 }
@@ -190,7 +209,8 @@ int nanosleep(const struct timespec *req, struct timespec *rem) {
   IOManager *iom = IOManager::GetThis();
   int timeout_s = req->tv_sec * 1000 + req->tv_nsec / 1000 / 1000;
   iom->addTimer(timeout_s,
-                std::bind((void(Scheduler::*)(Fiber::ptr, int thread)) & IOManager::scheduler, iom, fiber, -1));
+                std::bind((void(Scheduler::*)(Fiber::ptr, int thread)) & IOManager::scheduler, iom, fiber,
+                          GetThreadId()));
   Fiber::GetThis()->yield();
   return 0;
 }
@@ -259,6 +279,24 @@ int connect_with_timeout(int fd, const struct sockaddr *addr, socklen_t addrlen,
         winfo);
   }
 
+#ifdef MONSOON_WITH_IO_URING
+  if (iom->uringEnabled()) {
+    // 只等可写，connect的结果在SO_ERROR里
+    if (iom->uringSocketIo(fd, WRITE, IORING_OP_POLL_ADD, nullptr, 0, 0, timeout_ms) < 0) {
+      return -1;
+    }
+    int error = 0;
+    socklen_t len = sizeof(int);
+    if (-1 == getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &len)) {
+      return -1;
+    }
+    if (error) {
+      errno = error;
+      return -1;
+    }
+    return 0;
+  }
+#endif
   // 添加WRITE事件，并yield,等待WRITE事件触发再往下执行
   int rt = iom->addEvent(fd, WRITE);
   if (rt == 0) {
@@ -299,49 +337,55 @@ int connect(int sockfd, const struct sockaddr *addr, socklen_t addrlen) {
 }
 
 int accept(int s, struct sockaddr *addr, socklen_t *addrlen) {
-  int fd = do_io(s, accept_f, "accept", READ, SO_RCVTIMEO, addr, addrlen);
+  int fd = do_io(s, nullptr, accept_f, "accept", READ, SO_RCVTIMEO, addr, addrlen);
   if (fd >= 0) {
     FdMgr::GetInstance()->get(fd, true);
   }
   return fd;
 }
 
-ssize_t read(int fd, void *buf, size_t count) { return do_io(fd, read_f, "read", READ, SO_RCVTIMEO, buf, count); }
+ssize_t read(int fd, void *buf, size_t count) {
+  uring_io uio{uring_io::READ, buf, count, 0};
+  return do_io(fd, &uio, read_f, "read", READ, SO_RCVTIMEO, buf, count);
+}
 
 ssize_t readv(int fd, const struct iovec *iov, int iovcnt) {
-  return do_io(fd, readv_f, "readv", READ, SO_RCVTIMEO, iov, iovcnt);
+  return do_io(fd, nullptr, readv_f, "readv", READ, SO_RCVTIMEO, iov, iovcnt);
 }
 
 ssize_t recv(int sockfd, void *buf, size_t len, int flags) {
-  return do_io(sockfd, recv_f, "recv", READ, SO_RCVTIMEO, buf, len, flags);
+  uring_io uio{uring_io::RECV, buf, len, flags};
+  return do_io(sockfd, &uio, recv_f, "recv", READ, SO_RCVTIMEO, buf, len, flags);
 }
 
 ssize_t recvfrom(int sockfd, void *buf, size_t len, int flags, struct sockaddr *src_addr, socklen_t *addrlen) {
-  return do_io(sockfd, recvfrom_f, "recvfrom", READ, SO_RCVTIMEO, buf, len, flags, src_addr, addrlen);
+  return do_io(sockfd, nullptr, recvfrom_f, "recvfrom", READ, SO_RCVTIMEO, buf, len, flags, src_addr, addrlen);
 }
 
 ssize_t recvmsg(int sockfd, struct msghdr *msg, int flags) {
-  return do_io(sockfd, recvmsg_f, "recvmsg", READ, SO_RCVTIMEO, msg, flags);
+  return do_io(sockfd, nullptr, recvmsg_f, "recvmsg", READ, SO_RCVTIMEO, msg, flags);
 }
 
 ssize_t write(int fd, const void *buf, size_t count) {
-  return do_io(fd, write_f, "write", WRITE, SO_SNDTIMEO, buf, count);
+  uring_io uio{uring_io::WRITE, const_cast<void *>(buf), count, 0};
+  return do_io(fd, &uio, write_f, "write", WRITE, SO_SNDTIMEO, buf, count);
 }
 
 ssize_t writev(int fd, const struct iovec *iov, int iovcnt) {
-  return do_io(fd, writev_f, "writev", WRITE, SO_SNDTIMEO, iov, iovcnt);
+  return do_io(fd, nullptr, writev_f, "writev", WRITE, SO_SNDTIMEO, iov, iovcnt);
 }
 
 ssize_t send(int s, const void *msg, size_t len, int flags) {
-  return do_io(s, send_f, "send", WRITE, SO_SNDTIMEO, msg, len, flags);
+  uring_io uio{uring_io::SEND, const_cast<void *>(msg), len, flags};
+  return do_io(s, &uio, send_f, "send", WRITE, SO_SNDTIMEO, msg, len, flags);
 }
 
 ssize_t sendto(int s, const void *msg, size_t len, int flags, const struct sockaddr *to, socklen_t tolen) {
-  return do_io(s, sendto_f, "sendto", WRITE, SO_SNDTIMEO, msg, len, flags, to, tolen);
+  return do_io(s, nullptr, sendto_f, "sendto", WRITE, SO_SNDTIMEO, msg, len, flags, to, tolen);
 }
 
 ssize_t sendmsg(int s, const struct msghdr *msg, int flags) {
-  return do_io(s, sendmsg_f, "sendmsg", WRITE, SO_SNDTIMEO, msg, flags);
+  return do_io(s, nullptr, sendmsg_f, "sendmsg", WRITE, SO_SNDTIMEO, msg, flags);
 }
 
 int close(int fd) {
@@ -354,6 +398,9 @@ int close(int fd) {
     auto iom = IOManager::GetThis();
     if (iom) {
       iom->cancelAll(fd);
+#ifdef MONSOON_WITH_IO_URING
+      iom->uringCancelFd(fd);
+#endif
     }
     FdMgr::GetInstance()->del(fd);
   }
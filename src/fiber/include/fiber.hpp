@@ -2,11 +2,11 @@
 #define __MONSOON_FIBER_H__
 
 #include <stdio.h>
-#include <ucontext.h>
 #include <unistd.h>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include "fiber_context.hpp"
 #include "utils.hpp"
 
 namespace monsoon {
@@ -28,7 +28,7 @@ class Fiber : public std::enable_shared_from_this<Fiber> {
   Fiber();
 
  public:
-  // 构造子协程
+  // 构造子协程，stackSz为0时用默认的128K，否则向上取整到32K~1M的档位（更大的按页取整，不缓存）
   Fiber(std::function<void()> cb, size_t stackSz = 0, bool run_in_scheduler = true);
   ~Fiber();
   // 重置协程状态，复用栈空间
@@ -54,6 +54,8 @@ class Fiber : public std::enable_shared_from_this<Fiber> {
   static void MainFunc();
   // 获取当前协程Id
   static uint64_t GetCurFiberID();
+  // 当前是否运行在调度器调度的子协程里，是的话可以yield挂起，之后由调度器再resume
+  static bool InScheduler();
 
  private:
   // 协程ID
@@ -63,13 +65,13 @@ class Fiber : public std::enable_shared_from_this<Fiber> {
   // 协程状态
   State state_ = READY;
   // 协程上下文
-  ucontext_t ctx_;
+  FiberContext ctx_;
   // 协程栈地址
   void *stack_ptr = nullptr;
   // 协程回调函数
   std::function<void()> cb_;
   // 本协程是否参与调度器调度
-  bool isRunInScheduler_;
+  bool isRunInScheduler_ = false;
 };
 }  // namespace monsoon
 
@@ -0,0 +1,63 @@
+#ifndef __MONSOON_FIBER_CONTEXT_H__
+#define __MONSOON_FIBER_CONTEXT_H__
+
+#include <stddef.h>
+
+// x86-64和aarch64上默认用手写汇编切换上下文，只保存被调用者保存的寄存器，不经过内核
+// ucontext的swapcontext每次切换都要调用一次sigprocmask，定义MONSOON_USE_UCONTEXT（CMake选项FIBER_USE_UCONTEXT）退回ucontext
+#if !defined(MONSOON_USE_UCONTEXT) && !defined(__x86_64__) && !defined(__aarch64__)
+#define MONSOON_USE_UCONTEXT
+#endif
+
+#ifdef MONSOON_USE_UCONTEXT
+#include <ucontext.h>
+#include "utils.hpp"
+#endif
+
+namespace monsoon {
+#ifdef MONSOON_USE_UCONTEXT
+
+struct FiberContext {
+  ucontext_t uc;
+};
+
+// 线程主协程的上下文，第一次切走时保存
+inline void InitMainContext(FiberContext *ctx) { CondPanic(getcontext(&ctx->uc) == 0, "getcontext error"); }
+
+// 在[stack, stack + size)上准备一个第一次切换进来时执行fn的上下文，fn不能返回
+inline void MakeContext(FiberContext *ctx, void *stack, size_t size, void (*fn)()) {
+  CondPanic(getcontext(&ctx->uc) == 0, "getcontext error");
+  ctx->uc.uc_link = nullptr;
+  ctx->uc.uc_stack.ss_sp = stack;
+  ctx->uc.uc_stack.ss_size = size;
+  makecontext(&ctx->uc, fn, 0);
+}
+
+// 保存当前上下文到from，切换到to
+inline void SwapContext(FiberContext *from, FiberContext *to) {
+  CondPanic(swapcontext(&from->uc, &to->uc) == 0, "swapcontext error");
+}
+
+#else
+
+extern "C" {
+// 实现在fiber_context.cpp的汇编里
+void monsoon_swap_context(void **from_sp, void *to_sp);
+void monsoon_fiber_entry();
+}
+
+// 保存的寄存器都压在协程自己的栈上，上下文里只需要栈指针
+struct FiberContext {
+  void *sp = nullptr;
+};
+
+inline void InitMainContext(FiberContext *ctx) { ctx->sp = nullptr; }
+
+void MakeContext(FiberContext *ctx, void *stack, size_t size, void (*fn)());
+
+inline void SwapContext(FiberContext *from, FiberContext *to) { monsoon_swap_context(&from->sp, to->sp); }
+
+#endif
+}  // namespace monsoon
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef __MONSOON_FIBER_SYNC_H__
+#define __MONSOON_FIBER_SYNC_H__
+
+#include <stdint.h>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include "fiber.hpp"
+#include "mutex.hpp"
+#include "noncopyable.hpp"
+
+namespace monsoon {
+class Scheduler;
+
+// 协程版的同步原语：在调度器的协程里等待时只挂起协程，线程去执行别的任务；不在协程里（普通线程、主协程）时阻塞线程
+// 所以同一个对象可以同时被协程和普通线程使用
+
+// 一个等待者，挂在WaitQueue的双向链表上
+struct FiberWaiter {
+  // 协程等待时记录所在的调度器、协程和线程，唤醒时调度回原来的线程：那个线程让出之后协程才会被再次执行
+  Scheduler *scheduler = nullptr;
+  Fiber::ptr fiber;
+  int thread = -1;
+  // 线程等待时用
+  std::mutex mtx;
+  std::condition_variable cv;
+  bool signalled = false;
+
+  FiberWaiter *prev = nullptr;
+  FiberWaiter *next = nullptr;
+  // 还在队列里，没有被唤醒也没有超时
+  bool queued = false;
+  // 被notify唤醒，而不是超时
+  bool notified = false;
+};
+
+// 等待队列，所有操作都要持有外部传入的mutex，mutex同时保护调用方的等待条件
+class WaitQueue : Nonecopyable {
+ public:
+  // 持有mutex时调用，挂起期间释放mutex，返回时重新持有
+  // timeoutMs为~0ull时不超时，超时返回false；被唤醒时等待的条件不一定成立，调用方要重新检查
+  // 带超时时对象必须活到定时器触发或者被取消之后，也就是等待返回之后
+  bool wait(Mutex &mutex, uint64_t timeoutMs = ~0ull);
+  // 唤醒一个或者全部等待者，返回是否唤醒了等待者，需要持有mutex
+  bool notifyOne();
+  void notifyAll();
+  bool empty() const { return head_ == nullptr; }
+
+ private:
+  void push(FiberWaiter *waiter);
+  void remove(FiberWaiter *waiter);
+  // 从队列里摘掉之后唤醒，唤醒发生在持有mutex时，等待者要重新拿到mutex才返回，不会在唤醒之前就销毁
+  static void wake(FiberWaiter *waiter);
+  bool waitThread(Mutex &mutex, FiberWaiter *waiter, uint64_t timeoutMs);
+
+  FiberWaiter *head_ = nullptr;
+  FiberWaiter *tail_ = nullptr;
+};
+
+// 协程互斥锁，接口和std::mutex一样，可以用std::unique_lock/std::lock_guard
+// 锁住时等待的协程被挂起；持有锁的协程不能在别的线程上恢复之前就依赖线程局部的状态，这和普通的协程挂起一样
+class FiberMutex : Nonecopyable {
+ public:
+  typedef ScopedLockImpl<FiberMutex> Lock;
+
+  void lock();
+  bool try_lock();
+  void unlock();
+
+ private:
+  Mutex mutex_;
+  bool locked_ = false;
+  WaitQueue waiters_;
+};
+
+// 协程条件变量，可以和FiberMutex、std::mutex或者任何有lock/unlock的锁一起用
+// 和std::mutex一起用时，持有std::mutex的时间必须很短（它会阻塞线程），等待时释放
+class FiberCondVar : Nonecopyable {
+ public:
+  template <class Lock>
+  void wait(Lock &lock) {
+    waitFor(lock, ~0ull);
+  }
+
+  template <class Lock, class Predicate>
+  void wait(Lock &lock, Predicate pred) {
+    while (!pred()) {
+      wait(lock);
+    }
+  }
+
+  // 超时返回false
+  template <class Lock>
+  bool waitFor(Lock &lock, uint64_t timeoutMs) {
+    // 先进入等待队列再释放调用方的锁，修改条件之后的notify一定能看到这个等待者
+    Mutex::Lock guard(mutex_);
+    lock.unlock();
+    bool notified = waiters_.wait(mutex_, timeoutMs);
+    guard.unlock();
+    lock.lock();
+    return notified;
+  }
+
+  // 到超时条件仍不成立返回false
+  template <class Lock, class Predicate>
+  bool waitFor(Lock &lock, uint64_t timeoutMs, Predicate pred) {
+    uint64_t deadline = GetElapsedMS() + timeoutMs;
+    while (!pred()) {
+      uint64_t now = GetElapsedMS();
+      if (now >= deadline) {
+        return false;
+      }
+      waitFor(lock, deadline - now);
+    }
+    return true;
+  }
+
+  void notifyOne();
+  void notifyAll();
+
+ private:
+  Mutex mutex_;
+  WaitQueue waiters_;
+};
+
+// 多生产者多消费者的有界通道，类似go的带缓冲chan
+// capacity为0时不限长度，push不会阻塞；close之后push失败，pop取完剩下的数据后失败
+template <class T>
+class Channel : Nonecopyable {
+ public:
+  explicit Channel(size_t capacity = 0) : capacity_(capacity) {}
+
+  // 满了等待，通道关闭返回false
+  bool push(const T &value) { return emplace(value); }
+  bool push(T &&value) { return emplace(std::move(value)); }
+
+  // 满了或者关闭了返回false
+  bool tryPush(T value) {
+    Mutex::Lock lock(mutex_);
+    if (closed_ || full()) {
+      return false;
+    }
+    queue_.push_back(std::move(value));
+    notEmpty_.notifyOne();
+    return true;
+  }
+
+  // 空了等待，通道关闭并且取完了返回false
+  bool pop(T *value) { return popFor(value, ~0ull); }
+
+  // 空了返回false
+  bool tryPop(T *value) {
+    Mutex::Lock lock(mutex_);
+    return takeLocked(value);
+  }
+
+  // 超时或者通道关闭并且取完了返回false
+  bool popFor(T *value, uint64_t timeoutMs) {
+    uint64_t deadline = timeoutMs == ~0ull ? ~0ull : GetElapsedMS() + timeoutMs;
+    Mutex::Lock lock(mutex_);
+    while (queue_.empty() && !closed_) {
+      uint64_t wait = ~0ull;
+      if (deadline != ~0ull) {
+        uint64_t now = GetElapsedMS();
+        if (now >= deadline) {
+          return false;
+        }
+        wait = deadline - now;
+      }
+      notEmpty_.wait(mutex_, wait);
+    }
+    return takeLocked(value);
+  }
+
+  // 唤醒所有等待者
+  void close() {
+    Mutex::Lock lock(mutex_);
+    closed_ = true;
+    notEmpty_.notifyAll();
+    notFull_.notifyAll();
+  }
+
+  size_t size() {
+    Mutex::Lock lock(mutex_);
+    return queue_.size();
+  }
+
+ private:
+  template <class U>
+  bool emplace(U &&value) {
+    Mutex::Lock lock(mutex_);
+    while (!closed_ && full()) {
+      notFull_.wait(mutex_);
+    }
+    if (closed_) {
+      return false;
+    }
+    queue_.push_back(std::forward<U>(value));
+    notEmpty_.notifyOne();
+    return true;
+  }
+
+  bool takeLocked(T *value) {
+    if (queue_.empty()) {
+      return false;
+    }
+    *value = std::move(queue_.front());
+    queue_.pop_front();
+    if (capacity_ > 0) {
+      notFull_.notifyOne();
+    }
+    return true;
+  }
+
+  bool full() const { return capacity_ > 0 && queue_.size() >= capacity_; }
+
+  Mutex mutex_;
+  std::deque<T> queue_;
+  size_t capacity_;
+  bool closed_ = false;
+  WaitQueue notEmpty_;
+  WaitQueue notFull_;
+};
+}  // namespace monsoon
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef __MONSOON_IO_URING_H__
+#define __MONSOON_IO_URING_H__
+
+// 只依赖内核头文件，直接用系统调用，不需要liburing；CMake选项FIBER_WITH_IO_URING打开后定义MONSOON_WITH_IO_URING
+#ifdef MONSOON_WITH_IO_URING
+
+#include <linux/io_uring.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include "noncopyable.hpp"
+
+namespace monsoon {
+// 一个io_uring实例：提交队列和完成队列都mmap到用户态，不是线程安全的，由使用者加锁
+// getSqe拿到的请求先攒着，submit时一次交给内核
+class IoUring : Nonecopyable {
+ public:
+  // 内核不支持（老内核、seccomp禁止）时valid()返回false，调用者退回原来的实现
+  explicit IoUring(unsigned entries);
+  ~IoUring();
+
+  bool valid() const { return ringFd_ >= 0; }
+  bool hasFeature(uint32_t feature) const { return (features_ & feature) != 0; }
+
+  // 取一个清零的sqe，提交队列满了返回nullptr，调用者先submit
+  io_uring_sqe *getSqe();
+  // 还没交给内核的请求数
+  unsigned unsubmitted() const { return sqeTail_ - submittedTail_; }
+  // 把所有getSqe拿到的请求交给内核，waitNr>0时等到至少waitNr个请求完成；返回提交数，失败返回-errno
+  int submit(unsigned waitNr = 0);
+
+  // 依次处理已经完成的请求，返回处理的个数
+  template <class F>
+  unsigned reap(F &&f) {
+    unsigned head = *cq_.khead;
+    unsigned tail = __atomic_load_n(cq_.ktail, __ATOMIC_ACQUIRE);
+    unsigned n = 0;
+    for (; head != tail; ++head, ++n) {
+      f(cq_.cqes[head & *cq_.kringMask]);
+    }
+    __atomic_store_n(cq_.khead, head, __ATOMIC_RELEASE);
+    return n;
+  }
+
+  // 有请求完成时写eventfd，完成事件可以和epoll的就绪事件一起等
+  bool registerEventfd(int fd);
+  // 注册固定缓冲区，READ_FIXED/WRITE_FIXED按下标使用，内核不用每次再映射用户页
+  bool registerBuffers(const struct iovec *iovs, unsigned n);
+
+  // 同步写文件，datasync为true时在同一次系统调用里链接一个fdatasync，*synced表示fdatasync是否成功执行
+  // offset为-1表示从文件当前位置写；返回写入的字节数（写不完整时fdatasync不会执行），失败返回-errno
+  ssize_t writeSync(int fd, const void *buf, size_t len, int64_t offset, bool datasync, bool *synced);
+
+ private:
+  struct SubmitQueue {
+    unsigned *khead;
+    unsigned *ktail;
+    unsigned *kringMask;
+    unsigned *kringEntries;
+    unsigned *array;
+    io_uring_sqe *sqes;
+  };
+  struct CompleteQueue {
+    unsigned *khead;
+    unsigned *ktail;
+    unsigned *kringMask;
+    io_uring_cqe *cqes;
+  };
+
+  int ringFd_ = -1;
+  uint32_t features_ = 0;
+  SubmitQueue sq_{};
+  CompleteQueue cq_{};
+  // 提交队列和完成队列在同一块映射里
+  void *ring_ = nullptr;
+  size_t ringSize_ = 0;
+  void *sqes_ = nullptr;
+  size_t sqesSize_ = 0;
+  // getSqe分配到的位置和已经放进提交队列的位置
+  unsigned sqeTail_ = 0;
+  unsigned submittedTail_ = 0;
+};
+}  // namespace monsoon
+
+#endif
+
+#endif
@@ -2,9 +2,11 @@
 #define __SYLAR_IOMANAGER_H__
 
 #include "fcntl.h"
+#include "io_uring.hpp"
 #include "scheduler.hpp"
 #include "string.h"
 #include "sys/epoll.h"
+#include "sys/eventfd.h"
 #include "timer.hpp"
 
 namespace monsoon {
@@ -18,6 +20,8 @@ struct EventContext {
   Scheduler *scheduler = nullptr;
   Fiber::ptr fiber;
   std::function<void()> cb;
+  // 注册事件的协程所在的线程，事件可能在协程yield之前就在别的线程触发，只能由原线程恢复
+  int thread = -1;
 };
 
 class FdContext {
@@ -54,6 +58,15 @@ class IOManager : public Scheduler, public TimerManager {
   // 取消所有事件
   bool cancelAll(int fd);
   static IOManager *GetThis();
+#ifdef MONSOON_WITH_IO_URING
+  // 是否用io_uring等待hook的socket读写，内核不支持时退回epoll
+  bool uringEnabled() const { return uring_ != nullptr; }
+  // 当前协程等fd可读/可写后执行一次读写：poll和读写链接成一组提交给io_uring，让出协程，完成后由原线程恢复
+  // op为IORING_OP_RECV/SEND/READ/WRITE，为IORING_OP_POLL_ADD时只等事件；返回值和对应的系统调用一样，超时返回-1，errno为ETIMEDOUT
+  ssize_t uringSocketIo(int fd, Event event, uint8_t op, void *buf, size_t len, int flags, uint64_t timeoutMs);
+  // 关闭fd之前取消它上面还没完成的io_uring请求
+  void uringCancelFd(int fd);
+#endif
 
  protected:
   // 通知调度器有任务要调度
@@ -67,14 +80,43 @@ class IOManager : public Scheduler, public TimerManager {
 
   void OnTimerInsertedAtFront() override;
   void contextResize(size_t size);
+  void afterTask() override;
+  // 调度线程各用一个时间轮，其他线程共用第0个
+  size_t currentWheel() const override { return currentWorker() + 1; }
 
  private:
   int epfd_ = 0;
-  int tickleFds_[2];
+  // eventfd，写入唤醒一个阻塞在epoll_wait上的idle线程
+  int tickleFd_ = -1;
+  // 已经写过eventfd但还没有idle线程读走，期间的tickle都不用再写
+  std::atomic<bool> signalled_ = {false};
   // 正在等待执行的IO事件数量
   std::atomic<size_t> pendingEventCnt_ = {0};
   RWMutex mutex_;
   std::vector<FdContext *> fdContexts_;
+#ifdef MONSOON_WITH_IO_URING
+  struct UringWaiter;
+  void initUring();
+  // 取一个sqe，提交队列满了先提交，需要持有uringMutex_
+  io_uring_sqe *getSqeLocked();
+  // 攒够一批，或者当前线程没有别的任务要跑、马上要进idle时，才把请求交给内核
+  void flushUring(bool force);
+  // 收割完成的请求，恢复等待的协程
+  void reapUring();
+
+  std::unique_ptr<IoUring> uring_;
+  // 保护uring_和固定缓冲区空闲列表
+  Mutex uringMutex_;
+  // 有请求完成时内核写这个eventfd，注册在epoll里
+  int uringFd_ = -1;
+  // 已经放进提交队列还没交给内核的请求数，每个任务结束后不加锁先看一眼
+  std::atomic<unsigned> uringQueued_ = {0};
+  // 还没完成的读写请求数
+  std::atomic<size_t> pendingUringCnt_ = {0};
+  // 注册给内核的固定缓冲区，小的socket读用READ_FIXED读到这里再拷出去
+  std::vector<char> fixedBufMem_;
+  std::vector<int> freeFixedBufs_;
+#endif
 };
 }  // namespace monsoon
 
@@ -3,6 +3,7 @@
 
 #include "fd_manager.hpp"
 #include "fiber.hpp"
+#include "fiber_sync.hpp"
 #include "hook.hpp"
 #include "iomanager.hpp"
 #include "thread.hpp"
@@ -3,15 +3,18 @@
 
 #include <atomic>
 #include <boost/type_index.hpp>
+#include <deque>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 #include "fiber.hpp"
 #include "mutex.hpp"
 #include "thread.hpp"
 #include "utils.hpp"
+#include "work_stealing_queue.hpp"
 
 namespace monsoon {
 // 调度任务
@@ -43,6 +46,8 @@ class SchedulerTask {
 };
 
 // N->M协程调度器
+// 每个调度线程有自己的无锁任务队列，自己的线程里添加的任务放进去，空闲时从别的线程的队列里偷
+// 其他线程添加的任务进入共享的注入队列，指定了线程的任务进入那个线程单独的队列，不会被偷走
 class Scheduler {
  public:
   typedef std::shared_ptr<Scheduler> ptr;
@@ -63,16 +68,12 @@ class Scheduler {
    */
   template <class TaskType>
   void scheduler(TaskType task, int thread = -1) {
-    bool isNeedTickle = false;
-    {
-      Mutex::Lock lock(mutex_);
-      isNeedTickle = schedulerNoLock(task, thread);
-      // std::cout << "isNeedTickle: " << isNeedTickle << std::endl;
-    }
-
-    if (isNeedTickle) {
-      tickle();  // 唤醒idle协程
+    SchedulerTask *t = new SchedulerTask(task, thread);
+    if (!t->fiber_ && !t->cb_) {
+      delete t;
+      return;
     }
+    push(t);
     // log
     // std::string tp = "[Callback Func]";
     // if (boost::typeindex::type_id_with_cvr<TaskType>().pretty_name() != "void (*)()")
@@ -99,33 +100,58 @@ class Scheduler {
   virtual void idle();
   // 返回是否可以停止
   virtual bool stopping();
+  // 每个任务resume返回之后调用，IOManager在这里批量提交io_uring请求
+  virtual void afterTask() {}
   // 设置当前线程调度器
   void setThis();
   // 返回是否有空闲进程
   bool isHasIdleThreads() { return idleThreadCnt_ > 0; }
+  // 调度线程数（包含use_caller的主线程）
+  size_t workerCount() const { return workers_.size(); }
+  // 当前线程在本调度器里的下标，不是本调度器的线程返回-1
+  int currentWorker() const;
+  // 是否有当前线程可以执行的排队任务，idle阻塞之前检查，避免和添加任务的线程错过彼此
+  bool hasRunnableTasks() const;
+  // 有空闲线程时唤醒一个，重复的唤醒由tickle合并
+  void wakeIdle();
+  // 当前线程一次添加一批任务时，先不唤醒，添加完再唤醒一次
+  void holdWakeups();
+  void releaseWakeups();
 
  private:
-  // 无锁下，添加调度任务
-  // todo 可以加入使用clang的锁检查
-  template <class TaskType>
-  bool schedulerNoLock(TaskType t, int thread) {
-    bool isNeedTickle = tasks_.empty();
-    SchedulerTask task(t, thread);
-    if (task.fiber_ || task.cb_) {
-      // std::cout << "有效task" << std::endl;
-      tasks_.push_back(task);
-    }
-    // std::cout << "scheduler noblock: isNeedTickle = " << isNeedTickle << std::endl;
-    return isNeedTickle;
-  }
+  // 一个调度线程的队列
+  struct Worker {
+    WorkStealingQueue<SchedulerTask *> local;  // 只有本线程push，取任务都走steal
+    Mutex pinnedMutex;
+    std::deque<SchedulerTask *> pinned;  // 指定在本线程执行的任务
+    std::atomic<size_t> pinnedCnt = {0};
+    std::atomic<bool> idle = {false};  // 是否在idle协程里
+  };
+  // 按任务的来源和指定的线程放进对应的队列
+  void push(SchedulerTask *task);
+  // 依次从指定本线程的队列、自己的队列、注入队列、其他线程的队列取任务
+  SchedulerTask *take(size_t self);
+  SchedulerTask *takeInjected(size_t self);
+  SchedulerTask *steal(size_t self);
+  // 是否有线程空闲着，但还有指定它执行的任务
+  bool pinnedOwnerIdle() const;
+
   // 调度器名称
   std::string name_;
-  // 互斥锁
+  // 互斥锁，保护线程池
   Mutex mutex_;
   // 线程池
   std::vector<Thread::ptr> threadPool_;
-  // 任务队列
-  std::list<SchedulerTask> tasks_;
+  // 每个调度线程一个，use_caller的主线程在最后
+  std::vector<std::unique_ptr<Worker>> workers_;
+  RWMutex workerMapMutex_;  // 调度线程启动时写，添加指定线程的任务时读
+  std::unordered_map<int, size_t> workerOfThread_;
+  // 其他线程添加的没有指定线程的任务
+  Mutex injectMutex_;
+  std::deque<SchedulerTask *> injected_;
+  std::atomic<size_t> injectedCnt_ = {0};
+  // 所有队列里的任务总数
+  std::atomic<size_t> queuedTaskCnt_ = {0};
   // 线程池id数组
   std::vector<int> threadIds_;
   // 工作线程数量（不包含use_caller的主线程）
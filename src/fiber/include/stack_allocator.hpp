@@ -0,0 +1,26 @@
+#ifndef __MONSOON_STACK_ALLOCATOR_H__
+#define __MONSOON_STACK_ALLOCATOR_H__
+
+#include <stddef.h>
+
+namespace monsoon {
+// 协程栈分配器
+// 每个栈单独mmap，最低地址放一个PROT_NONE的保护页，栈溢出直接SIGSEGV而不是踩坏别的内存
+// 物理内存在第一次写入时才分配，只有真正用到的部分占内存
+// 栈大小按2的幂取整到几个档位，结束的协程的栈按档位缓存起来复用：先放线程本地缓存，满了放全局缓存，再满才munmap
+class StackAllocator {
+ public:
+  // 最小和最大的档位，超过最大档位的栈不缓存，每次单独mmap/munmap
+  static const size_t kMinStackSize = 32 * 1024;
+  static const size_t kMaxPooledStackSize = 1024 * 1024;
+  static const size_t kDefaultStackSize = 128 * 1024;
+
+  // 取整之后实际分配的栈大小
+  static size_t RoundUp(size_t size);
+  // size需要是RoundUp之后的大小，返回可用栈空间的最低地址
+  static void *Alloc(size_t size);
+  static void Delete(void *vp, size_t size);
+};
+}  // namespace monsoon
+
+#endif
@@ -1,16 +1,20 @@
 #ifndef __MONSOON_TIMER_H__
-#  define __MONSSON_TIMER_H__
+#define __MONSOON_TIMER_H__
 
-#  include <memory>
-#  include <set>
-#  include <vector>
-#  include "mutex.hpp"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "mutex.hpp"
 
 namespace monsoon {
 class TimerManager;
+struct TimerWheel;
 
+// 定时器本身就是时间轮槽位链表的节点，挂在轮上时用self_保证不被释放
 class Timer : public std::enable_shared_from_this<Timer> {
   friend class TimerManager;
+  friend struct TimerWheel;
 
  public:
   typedef std::shared_ptr<Timer> ptr;
@@ -21,7 +25,6 @@ class Timer : public std::enable_shared_from_this<Timer> {
 
  private:
   Timer(uint64_t ms, std::function<void()> cb, bool recuring, TimerManager *manager);
-  Timer(uint64_t next);
 
   // 是否是循环定时器
   bool recurring_ = false;
@@ -33,25 +36,59 @@ class Timer : public std::enable_shared_from_this<Timer> {
   std::function<void()> cb_;
   // 管理器
   TimerManager *manager_ = nullptr;
+  // 所在的时间轮，创建后不变，cancel/refresh/reset都只加这个轮的锁
+  TimerWheel *wheel_ = nullptr;
+  // 槽位链表，pprev_指向前一个节点的nextNode_或者槽的头指针，为nullptr表示不在轮上
+  Timer **pprev_ = nullptr;
+  Timer *nextNode_ = nullptr;
+  int level_ = 0;
+  Timer::ptr self_;
+};
+
+// 分层时间轮：4层，每层64个槽，精度1ms，第一层覆盖64ms，第四层约4.6小时，更远的先放在最后一层，转到时再重新放
+// 插入和取消都是O(1)的链表操作
+struct TimerWheel {
+  static const int LEVELS = 4;
+  static const int SLOT_BITS = 6;
+  static const int SLOTS = 1 << SLOT_BITS;
+
+  explicit TimerWheel(uint64_t now);
+  // 加入轮中，需要持有mutex
+  void link(Timer *timer);
+  void unlink(Timer *timer);
+  // 走到now，到期的定时器按到期顺序放进expired，需要持有mutex
+  void advance(uint64_t now, std::vector<Timer::ptr> &expired);
+  // 最近一个可能到期的时间，轮上没有定时器为~0ull，需要持有mutex
+  uint64_t earliest() const;
+
+  Mutex mutex;
+  // 已经处理到的时间（ms）
+  uint64_t current;
+  // 每个槽一个链表头
+  Timer *slots[LEVELS][SLOTS];
+  // 每层的定时器数，低层都为空时直接跳到高层下一个槽的时间
+  size_t levelCount[LEVELS] = {};
+  std::atomic<size_t> count = {0};
+  // earliest()的缓存，不加锁就能判断这个轮是否有到期的定时器
+  std::atomic<uint64_t> nextExpire = {~0ull};
 
  private:
-  struct Comparator {
-    bool operator()(const Timer::ptr &lhs, const Timer::ptr &rhs) const;
-  };
+  void cascade(int level, int slot);
 };
 
 class TimerManager {
   friend class Timer;
 
  public:
-  TimerManager();
+  // wheels个时间轮，各个线程把定时器加到自己的轮上，避免所有线程抢一把锁
+  explicit TimerManager(size_t wheels = 1);
   virtual ~TimerManager();
   Timer::ptr addTimer(uint64_t ms, std::function<void()> cb, bool recuring = false);
   Timer::ptr addConditionTimer(uint64_t ms, std::function<void()> cb, std::weak_ptr<void> weak_cond,
                                bool recurring = false);
   // 到最近一个定时器的时间间隔（ms）
   uint64_t getNextTimer();
-  // 获取需要执行的定时器的回调函数列表
+  // 获取需要执行的定时器的回调函数列表，任何线程都会处理所有轮上已经到期的定时器
   void listExpiredCb(std::vector<std::function<void()>> &cbs);
   // 是否有定时器
   bool hasTimer();
@@ -59,21 +96,21 @@ class TimerManager {
  protected:
   // 当有新的定时器插入到定时器首部，执行该函数
   virtual void OnTimerInsertedAtFront() = 0;
-  // 将定时器添加到管理器
-  void addTimer(Timer::ptr val, RWMutex::WriteLock &lock);
+  // 当前线程使用的时间轮下标，超出范围时取模
+  virtual size_t currentWheel() const { return 0; }
 
  private:
-  // 检测服务器时间是否被调后了
-  bool detectClockRolllover(uint64_t now_ms);
-
-  RWMutex mutex_;
-  // 定时器集合
-  std::set<Timer::ptr, Timer::Comparator> timers_;
-  // 是否触发OnTimerInsertedAtFront
-  bool tickled_ = false;
-  // 上次执行时间
-  uint64_t previouseTime_ = 0;
+  // 把定时器放进自己的轮，比所有轮上已有的定时器都早时通知
+  void addTimer(const Timer::ptr &timer);
+  // 持有轮的锁时调用，返回是否需要OnTimerInsertedAtFront
+  bool linkLocked(TimerWheel *wheel, Timer *timer);
+  // 所有轮的nextExpire最小值
+  uint64_t earliest() const;
+
+  std::vector<std::unique_ptr<TimerWheel>> wheels_;
+  // getNextTimer之后是否已经通知过，避免每个更早的定时器都通知一次
+  std::atomic<bool> tickled_ = {false};
 };
 }  // namespace monsoon
 
-#endif
\ No newline at end of file
+#endif
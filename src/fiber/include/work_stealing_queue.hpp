@@ -0,0 +1,93 @@
+#ifndef __MONSOON_WORK_STEALING_QUEUE_H__
+#define __MONSOON_WORK_STEALING_QUEUE_H__
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "noncopyable.hpp"
+
+namespace monsoon {
+// Chase-Lev无锁双端队列（Lê et al. 2013 的弱内存序版本），只有所属线程可以push
+// 取任务都走steal（从顶部，先进先出），所属线程自己取也一样，反复重新调度自己的协程不会饿死排在前面的任务
+// 扩容后旧数组可能还在被steal读，析构时才释放
+template <typename T>
+class WorkStealingQueue : Nonecopyable {
+  static_assert(std::is_pointer<T>::value, "WorkStealingQueue stores pointers");
+
+ public:
+  // capacity必须是2的幂
+  explicit WorkStealingQueue(int64_t capacity = 256) : top_(0), bottom_(0), array_(new Array(capacity)) {}
+  ~WorkStealingQueue() {
+    delete array_.load(std::memory_order_relaxed);
+    for (Array *a : garbage_) {
+      delete a;
+    }
+  }
+
+  void push(T item) {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_acquire);
+    Array *a = array_.load(std::memory_order_relaxed);
+    if (b - t > a->capacity - 1) {
+      Array *bigger = a->grow(t, b);
+      garbage_.push_back(a);
+      a = bigger;
+      array_.store(a, std::memory_order_release);
+    }
+    a->put(b, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  bool steal(T *item) {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) {
+      return false;
+    }
+    Array *a = array_.load(std::memory_order_acquire);
+    T x = a->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return false;
+    }
+    *item = x;
+    return true;
+  }
+
+  // 其他线程调用时只是近似值
+  int64_t size() const {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    return b > t ? b - t : 0;
+  }
+
+ private:
+  struct Array {
+    explicit Array(int64_t cap) : capacity(cap), mask(cap - 1), items(new std::atomic<T>[cap]) {}
+    ~Array() { delete[] items; }
+
+    T get(int64_t i) const { return items[i & mask].load(std::memory_order_relaxed); }
+    void put(int64_t i, T x) { items[i & mask].store(x, std::memory_order_relaxed); }
+    Array *grow(int64_t top, int64_t bottom) const {
+      Array *a = new Array(capacity * 2);
+      for (int64_t i = top; i < bottom; ++i) {
+        a->put(i, get(i));
+      }
+      return a;
+    }
+
+    const int64_t capacity;  // 2的幂
+    const int64_t mask;
+    std::atomic<T> *items;
+  };
+
+  alignas(64) std::atomic<int64_t> top_;
+  alignas(64) std::atomic<int64_t> bottom_;
+  std::atomic<Array *> array_;
+  std::vector<Array *> garbage_;  // 只有所属线程访问
+};
+}  // namespace monsoon
+
+#endif
@@ -0,0 +1,179 @@
+#include "io_uring.hpp"
+
+#ifdef MONSOON_WITH_IO_URING
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace monsoon {
+namespace {
+int sys_io_uring_setup(unsigned entries, io_uring_params *p) { return syscall(__NR_io_uring_setup, entries, p); }
+
+int sys_io_uring_enter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+  return syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0);
+}
+
+int sys_io_uring_register(int fd, unsigned opcode, const void *arg, unsigned nrArgs) {
+  return syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs);
+}
+}  // namespace
+
+IoUring::IoUring(unsigned entries) {
+  io_uring_params p;
+  memset(&p, 0, sizeof(p));
+  int fd = sys_io_uring_setup(entries, &p);
+  if (fd < 0) {
+    return;
+  }
+  // 只支持5.4之后一次mmap映射两个环的内核
+  if (!(p.features & IORING_FEAT_SINGLE_MMAP)) {
+    close(fd);
+    return;
+  }
+  ringSize_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  size_t cqSize = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+  if (cqSize > ringSize_) {
+    ringSize_ = cqSize;
+  }
+  ring_ = mmap(nullptr, ringSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (ring_ == MAP_FAILED) {
+    ring_ = nullptr;
+    close(fd);
+    return;
+  }
+  sqesSize_ = p.sq_entries * sizeof(io_uring_sqe);
+  sqes_ = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (sqes_ == MAP_FAILED) {
+    sqes_ = nullptr;
+    munmap(ring_, ringSize_);
+    ring_ = nullptr;
+    close(fd);
+    return;
+  }
+
+  char *base = static_cast<char *>(ring_);
+  sq_.khead = reinterpret_cast<unsigned *>(base + p.sq_off.head);
+  sq_.ktail = reinterpret_cast<unsigned *>(base + p.sq_off.tail);
+  sq_.kringMask = reinterpret_cast<unsigned *>(base + p.sq_off.ring_mask);
+  sq_.kringEntries = reinterpret_cast<unsigned *>(base + p.sq_off.ring_entries);
+  sq_.array = reinterpret_cast<unsigned *>(base + p.sq_off.array);
+  sq_.sqes = static_cast<io_uring_sqe *>(sqes_);
+  cq_.khead = reinterpret_cast<unsigned *>(base + p.cq_off.head);
+  cq_.ktail = reinterpret_cast<unsigned *>(base + p.cq_off.tail);
+  cq_.kringMask = reinterpret_cast<unsigned *>(base + p.cq_off.ring_mask);
+  cq_.cqes = reinterpret_cast<io_uring_cqe *>(base + p.cq_off.cqes);
+  // sqe按顺序使用，提交队列里的下标固定对应同位置的sqe
+  for (unsigned i = 0; i < p.sq_entries; ++i) {
+    sq_.array[i] = i;
+  }
+  sqeTail_ = submittedTail_ = *sq_.ktail;
+  features_ = p.features;
+  ringFd_ = fd;
+}
+
+IoUring::~IoUring() {
+  if (sqes_ != nullptr) {
+    munmap(sqes_, sqesSize_);
+  }
+  if (ring_ != nullptr) {
+    munmap(ring_, ringSize_);
+  }
+  if (ringFd_ >= 0) {
+    close(ringFd_);
+  }
+}
+
+io_uring_sqe *IoUring::getSqe() {
+  unsigned head = __atomic_load_n(sq_.khead, __ATOMIC_ACQUIRE);
+  if (sqeTail_ - head >= *sq_.kringEntries) {
+    return nullptr;
+  }
+  io_uring_sqe *sqe = &sq_.sqes[sqeTail_ & *sq_.kringMask];
+  ++sqeTail_;
+  memset(sqe, 0, sizeof(*sqe));
+  return sqe;
+}
+
+int IoUring::submit(unsigned waitNr) {
+  unsigned toSubmit = sqeTail_ - submittedTail_;
+  if (toSubmit == 0 && waitNr == 0) {
+    return 0;
+  }
+  __atomic_store_n(sq_.ktail, sqeTail_, __ATOMIC_RELEASE);
+  int ret;
+  do {
+    ret = sys_io_uring_enter(ringFd_, toSubmit, waitNr, waitNr > 0 ? IORING_ENTER_GETEVENTS : 0);
+  } while (ret < 0 && errno == EINTR);
+  if (ret < 0) {
+    return -errno;
+  }
+  // 没被内核取走的已经放进队列了，下次submit再算
+  submittedTail_ += ret;
+  return ret;
+}
+
+bool IoUring::registerEventfd(int fd) { return sys_io_uring_register(ringFd_, IORING_REGISTER_EVENTFD, &fd, 1) == 0; }
+
+bool IoUring::registerBuffers(const struct iovec *iovs, unsigned n) {
+  return sys_io_uring_register(ringFd_, IORING_REGISTER_BUFFERS, iovs, n) == 0;
+}
+
+ssize_t IoUring::writeSync(int fd, const void *buf, size_t len, int64_t offset, bool datasync, bool *synced) {
+  *synced = false;
+  io_uring_sqe *sqe = getSqe();
+  io_uring_sqe *syncSqe = nullptr;
+  if (sqe != nullptr && datasync) {
+    syncSqe = getSqe();
+    if (syncSqe == nullptr) {
+      --sqeTail_;
+      sqe = nullptr;
+    }
+  }
+  if (sqe == nullptr) {
+    return -EBUSY;
+  }
+  sqe->opcode = IORING_OP_WRITE;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(buf);
+  sqe->len = len;
+  sqe->off = static_cast<uint64_t>(offset);
+  sqe->user_data = 1;
+  unsigned wait = 1;
+  if (syncSqe != nullptr) {
+    // 写不完整时链接断开，fdatasync以-ECANCELED完成
+    sqe->flags |= IOSQE_IO_LINK;
+    syncSqe->opcode = IORING_OP_FSYNC;
+    syncSqe->fd = fd;
+    syncSqe->fsync_flags = IORING_FSYNC_DATASYNC;
+    syncSqe->user_data = 2;
+    wait = 2;
+  }
+  int ret = submit(wait);
+  if (ret < 0) {
+    return ret;
+  }
+  ssize_t written = -EIO;
+  unsigned done = 0;
+  while (done < wait) {
+    done += reap([&](const io_uring_cqe &cqe) {
+      if (cqe.user_data == 1) {
+        written = cqe.res;
+      } else if (cqe.user_data == 2) {
+        *synced = cqe.res == 0;
+      }
+    });
+    if (done < wait) {
+      ret = submit(wait - done);
+      if (ret < 0) {
+        return ret;
+      }
+    }
+  }
+  return written;
+}
+}  // namespace monsoon
+
+#endif
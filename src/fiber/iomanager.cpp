@@ -1,6 +1,28 @@
 #include "iomanager.hpp"
+#ifdef MONSOON_WITH_IO_URING
+#include <poll.h>
+#endif
 
 namespace monsoon {
+#ifdef MONSOON_WITH_IO_URING
+// 提交队列大小，完成队列是它的两倍
+static const unsigned URING_ENTRIES = 1024;
+// 攒够这么多请求就不等线程空闲，直接提交
+static const unsigned URING_SUBMIT_BATCH = 32;
+// 固定缓冲区的个数和大小，小于等于这个大小的socket读用固定缓冲区
+static const int URING_FIXED_BUFFER_NUM = 64;
+static const size_t URING_FIXED_BUFFER_SIZE = 16 * 1024;
+
+// 一个等待io_uring完成的协程，user_data指向它；poll和取消请求的user_data最低位为1，完成时忽略
+struct IOManager::UringWaiter {
+  Fiber::ptr fiber;
+  int thread = -1;
+  int32_t res = 0;
+  // 超时，请求已经被取消
+  bool timedOut = false;
+};
+#endif
+
 // 获取事件上下文
 EventContext &FdContext::getEveContext(Event event) {
   switch (event) {
@@ -18,6 +40,7 @@ void FdContext::resetEveContext(EventContext &ctx) {
   ctx.scheduler = nullptr;
   ctx.fiber.reset();
   ctx.cb = nullptr;
+  ctx.thread = -1;
 }
 // 触发事件（只是将对应的fiber or cb 加入scheduler tasklist）
 void FdContext::triggerEvent(Event event) {
@@ -27,30 +50,31 @@ void FdContext::triggerEvent(Event event) {
   if (ctx.cb) {
     ctx.scheduler->scheduler(ctx.cb);
   } else {
-    ctx.scheduler->scheduler(ctx.fiber);
+    ctx.scheduler->scheduler(ctx.fiber, ctx.thread);
   }
   resetEveContext(ctx);
   return;
 }
 
-IOManager::IOManager(size_t threads, bool use_caller, const std::string &name) : Scheduler(threads, use_caller, name) {
+IOManager::IOManager(size_t threads, bool use_caller, const std::string &name)
+    : Scheduler(threads, use_caller, name), TimerManager(workerCount() + 1) {
   epfd_ = epoll_create(5000);
-  int ret = pipe(tickleFds_);
-  CondPanic(ret == 0, "pipe error");
+  // 边缘触发，设置非阻塞
+  tickleFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  CondPanic(tickleFd_ >= 0, "eventfd error");
 
-  // 注册pipe读句柄的可读事件，用于tickle调度协程
+  // 注册eventfd的可读事件，用于tickle调度协程
   epoll_event event{};
   memset(&event, 0, sizeof(epoll_event));
   event.events = EPOLLIN | EPOLLET;
-  event.data.fd = tickleFds_[0];
-  // 边缘触发，设置非阻塞
-  ret = fcntl(tickleFds_[0], F_SETFL, O_NONBLOCK);
-  CondPanic(ret == 0, "set fd nonblock error");
-  // 注册管道读描述符
-  ret = epoll_ctl(epfd_, EPOLL_CTL_ADD, tickleFds_[0], &event);
+  event.data.fd = tickleFd_;
+  int ret = epoll_ctl(epfd_, EPOLL_CTL_ADD, tickleFd_, &event);
   CondPanic(ret == 0, "epoll_ctl error");
 
   contextResize(32);
+#ifdef MONSOON_WITH_IO_URING
+  initUring();
+#endif
 
   // 启动scheduler，开始进行协程调度
   start();
@@ -58,8 +82,13 @@ IOManager::IOManager(size_t threads, bool use_caller, const std::string &name) :
 IOManager::~IOManager() {
   stop();
   close(epfd_);
-  close(tickleFds_[0]);
-  close(tickleFds_[1]);
+  close(tickleFd_);
+#ifdef MONSOON_WITH_IO_URING
+  uring_.reset();
+  if (uringFd_ >= 0) {
+    close(uringFd_);
+  }
+#endif
 
   for (size_t i = 0; i < fdContexts_.size(); i++) {
     if (fdContexts_[i]) {
@@ -113,9 +142,9 @@ int IOManager::addEvent(int fd, Event event, std::function<void()> cb) {
   } else {
     // 未设置回调函数，则将当前协程设置为回调任务
     event_ctx.fiber = Fiber::GetThis();
+    event_ctx.thread = GetThreadId();
     CondPanic(event_ctx.fiber->getState() == Fiber::RUNNING, "state=" + event_ctx.fiber->getState());
   }
-  std::cout << "add event success,fd = " << fd << std::endl;
   return 0;
 }
 // 删除事件 (删除前不会主动触发事件)
@@ -227,19 +256,23 @@ void IOManager::tickle() {
     // 此时没有空闲的调度线程
     return;
   }
-  // 写pipe管道，使得idle协程凑够epoll_wait退出，开始调度任务
-  int rt = write(tickleFds_[1], "T", 1);
-  CondPanic(rt == 1, "write pipe error");
+  // 上一次写入还没有被读走，已经有一个idle线程会醒来，连续的tickle合并成一次
+  if (signalled_.exchange(true)) {
+    return;
+  }
+  // 写eventfd，使得idle协程从epoll_wait退出，开始调度任务
+  uint64_t one = 1;
+  int rt = write(tickleFd_, &one, sizeof(one));
+  CondPanic(rt == sizeof(one) || errno == EAGAIN, "write eventfd error");
 }
 
 // 调度器无任务则阻塞在idle线程上
 // 当有新事件触发，则退出idle状态，则执行回调函数
 // 当有新的调度任务，则退出idle状态，并执行对应任务
 void IOManager::idle() {
-  // 以此最多检测256个就绪事件
-  const uint64_t MAX_EVENTS = 256;
-  epoll_event *events = new epoll_event[MAX_EVENTS]();
-  std::shared_ptr<epoll_event> shared_events(events, [](epoll_event *ptr) { delete[] ptr; });
+  // 一次最多处理256个就绪事件，缓冲区每个线程一个，反复进入idle不用重新分配
+  static const int MAX_EVENTS = 256;
+  static thread_local epoll_event events[MAX_EVENTS];
 
   while (true) {
     // std::cout << "[IOManager] idle begin..." << std::endl;
@@ -247,6 +280,8 @@ void IOManager::idle() {
     uint64_t next_timeout = 0;
     if (stopping(next_timeout)) {
       std::cout << "name=" << getName() << "idle stopping exit";
+      // stop()的多次tickle会被合并，退出前叫醒下一个还在epoll_wait的线程
+      tickle();
       break;
     }
 
@@ -260,6 +295,14 @@ void IOManager::idle() {
       } else {
         next_timeout = MAX_TIMEOUT;
       }
+      // 进入idle之前已经有任务加进来了，添加的线程可能没看到这个线程空闲，不能阻塞
+      if (hasRunnableTasks()) {
+        next_timeout = 0;
+      }
+#ifdef MONSOON_WITH_IO_URING
+      // 阻塞之前把攒着的io_uring请求交给内核
+      flushUring(true);
+#endif
       // 阻塞等待事件就绪
       ret = epoll_wait(epfd_, events, MAX_EVENTS, (int)next_timeout);
       // std::cout << "wait..." << std::endl;
@@ -275,6 +318,8 @@ void IOManager::idle() {
       }
     } while (true);
 
+    // 这一批定时器和就绪事件产生的任务都加完再唤醒其他线程，不用每个任务tickle一次
+    holdWakeups();
     // 收集所有超时定时器，执行回调函数
     std::vector<std::function<void()>> cbs;
     listExpiredCb(cbs);
@@ -287,14 +332,20 @@ void IOManager::idle() {
 
     for (int i = 0; i < ret; i++) {
       epoll_event &event = events[i];
-      if (event.data.fd == tickleFds_[0]) {
-        // pipe管道内数据无意义，只是tickle意义,读完即可
-        uint8_t dummy[256];
-        // TODO：ET下阻塞读取可能有问题
-        while (read(tickleFds_[0], dummy, sizeof(dummy)) > 0)
+      if (event.data.fd == tickleFd_) {
+        // 计数没有意义，读一次就清零；读完再清标记，之后的tickle才会重新写
+        uint64_t dummy;
+        while (read(tickleFd_, &dummy, sizeof(dummy)) < 0 && errno == EINTR)
           ;
+        signalled_ = false;
         continue;
       }
+#ifdef MONSOON_WITH_IO_URING
+      if (event.data.fd == uringFd_) {
+        reapUring();
+        continue;
+      }
+#endif
 
       //  通过epoll_event的私有指针获取FdContext
       FdContext *fd_ctx = (FdContext *)event.data.ptr;
@@ -339,6 +390,7 @@ void IOManager::idle() {
         --pendingEventCnt_;
       }
     }
+    releaseWakeups();
     // 处理结束，idle协程yield,此时调度协程可以执行run去tasklist中
     // 检测，拿取新任务去调度
     Fiber::ptr cur = Fiber::GetThis();
@@ -357,6 +409,11 @@ bool IOManager::stopping() {
 bool IOManager::stopping(uint64_t &timeout) {
   // 所有待调度的Io事件执行结束后，才允许退出
   timeout = getNextTimer();
+#ifdef MONSOON_WITH_IO_URING
+  if (pendingUringCnt_ > 0) {
+    return false;
+  }
+#endif
   return timeout == ~0ull && pendingEventCnt_ == 0 && Scheduler::stopping();
 }
 
@@ -369,6 +426,207 @@ void IOManager::contextResize(size_t size) {
     }
   }
 }
-void IOManager::OnTimerInsertedAtFront() { tickle(); }
+void IOManager::OnTimerInsertedAtFront() { wakeIdle(); }
+
+void IOManager::afterTask() {
+#ifdef MONSOON_WITH_IO_URING
+  if (uringQueued_ > 0) {
+    flushUring(false);
+  }
+#endif
+}
+
+#ifdef MONSOON_WITH_IO_URING
+void IOManager::initUring() {
+  uring_.reset(new IoUring(URING_ENTRIES));
+  if (!uring_->valid()) {
+    std::cout << "io_uring unavailable, fall back to epoll" << std::endl;
+    uring_.reset();
+    return;
+  }
+  uringFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  CondPanic(uringFd_ >= 0, "eventfd error");
+  CondPanic(uring_->registerEventfd(uringFd_), "io_uring register eventfd error");
+  epoll_event event{};
+  event.events = EPOLLIN | EPOLLET;
+  event.data.fd = uringFd_;
+  CondPanic(epoll_ctl(epfd_, EPOLL_CTL_ADD, uringFd_, &event) == 0, "epoll_ctl error");
+
+  // 固定缓冲区注册失败（比如RLIMIT_MEMLOCK太小）就都用普通读
+  fixedBufMem_.resize(URING_FIXED_BUFFER_NUM * URING_FIXED_BUFFER_SIZE);
+  std::vector<struct iovec> iovs(URING_FIXED_BUFFER_NUM);
+  for (int i = 0; i < URING_FIXED_BUFFER_NUM; ++i) {
+    iovs[i].iov_base = &fixedBufMem_[i * URING_FIXED_BUFFER_SIZE];
+    iovs[i].iov_len = URING_FIXED_BUFFER_SIZE;
+  }
+  if (uring_->registerBuffers(iovs.data(), iovs.size())) {
+    for (int i = URING_FIXED_BUFFER_NUM - 1; i >= 0; --i) {
+      freeFixedBufs_.push_back(i);
+    }
+  } else {
+    fixedBufMem_.clear();
+    fixedBufMem_.shrink_to_fit();
+  }
+}
+
+io_uring_sqe *IOManager::getSqeLocked() {
+  io_uring_sqe *sqe = uring_->getSqe();
+  if (sqe == nullptr) {
+    int ret = uring_->submit();
+    CondPanic(ret >= 0, "io_uring submit error");
+    uringQueued_ = uring_->unsubmitted();
+    sqe = uring_->getSqe();
+    CondPanic(sqe != nullptr, "io_uring submit queue full");
+  }
+  ++uringQueued_;
+  return sqe;
+}
+
+ssize_t IOManager::uringSocketIo(int fd, Event event, uint8_t op, void *buf, size_t len, int flags,
+                                 uint64_t timeoutMs) {
+  std::shared_ptr<UringWaiter> waiter(new UringWaiter);
+  waiter->fiber = Fiber::GetThis();
+  // 完成事件可能在协程yield之前就被别的线程收割，只能由原线程恢复
+  waiter->thread = GetThreadId();
+  uint64_t tag = reinterpret_cast<uint64_t>(waiter.get());
+  int fixedIdx = -1;
+  {
+    Mutex::Lock lock(uringMutex_);
+    if ((op == IORING_OP_RECV || op == IORING_OP_READ) && flags == 0 && len <= URING_FIXED_BUFFER_SIZE &&
+        !freeFixedBufs_.empty()) {
+      fixedIdx = freeFixedBufs_.back();
+      freeFixedBufs_.pop_back();
+    }
+    io_uring_sqe *poll = getSqeLocked();
+    poll->opcode = IORING_OP_POLL_ADD;
+    poll->fd = fd;
+    poll->poll32_events = event == READ ? POLLIN : POLLOUT;
+    poll->user_data = tag | 1;
+    if (op != IORING_OP_POLL_ADD) {
+      // 可读/可写之后才执行读写，读写的结果直接随完成事件返回，不用醒来再调一次系统调用
+      // poll不能加IOSQE_CQE_SKIP_SUCCESS：poll被取消时内核连后面读写的完成事件也不发了
+      poll->flags = IOSQE_IO_LINK;
+      io_uring_sqe *io = getSqeLocked();
+      io->fd = fd;
+      io->len = len;
+      io->user_data = tag;
+      if (fixedIdx >= 0) {
+        io->opcode = IORING_OP_READ_FIXED;
+        io->addr = reinterpret_cast<uint64_t>(&fixedBufMem_[fixedIdx * URING_FIXED_BUFFER_SIZE]);
+        io->buf_index = fixedIdx;
+      } else {
+        io->opcode = op;
+        io->addr = reinterpret_cast<uint64_t>(buf);
+        io->msg_flags = flags;
+      }
+    } else {
+      poll->user_data = tag;
+    }
+    ++pendingUringCnt_;
+  }
+
+  Timer::ptr timer;
+  if (timeoutMs != (uint64_t)-1) {
+    std::weak_ptr<UringWaiter> weak(waiter);
+    timer = addConditionTimer(
+        timeoutMs,
+        [this, weak, tag]() {
+          auto w = weak.lock();
+          if (!w) {
+            return;
+          }
+          Mutex::Lock lock(uringMutex_);
+          w->timedOut = true;
+          // 取消poll，链接在后面的读写随之以-ECANCELED完成
+          io_uring_sqe *cancel = getSqeLocked();
+          cancel->opcode = IORING_OP_ASYNC_CANCEL;
+          cancel->addr = tag | 1;
+          cancel->user_data = 1;
+          uring_->submit();
+          uringQueued_ = uring_->unsubmitted();
+        },
+        weak);
+  }
+
+  Fiber::GetThis()->yield();
+  if (timer) {
+    timer->cancel();
+  }
+  int32_t res = waiter->res;
+  if (fixedIdx >= 0) {
+    if (res > 0) {
+      memcpy(buf, &fixedBufMem_[fixedIdx * URING_FIXED_BUFFER_SIZE], res);
+    }
+    Mutex::Lock lock(uringMutex_);
+    freeFixedBufs_.push_back(fixedIdx);
+  }
+  if (res == -ECANCELED && waiter->timedOut) {
+    errno = ETIMEDOUT;
+    return -1;
+  }
+  if (res < 0) {
+    errno = -res;
+    return -1;
+  }
+  return res;
+}
+
+void IOManager::uringCancelFd(int fd) {
+  if (!uring_ || pendingUringCnt_ == 0) {
+    return;
+  }
+  Mutex::Lock lock(uringMutex_);
+  io_uring_sqe *cancel = getSqeLocked();
+  cancel->opcode = IORING_OP_ASYNC_CANCEL;
+  cancel->fd = fd;
+  cancel->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+  cancel->user_data = 1;
+  uring_->submit();
+  uringQueued_ = uring_->unsubmitted();
+}
+
+void IOManager::flushUring(bool force) {
+  if (!uring_) {
+    return;
+  }
+  // 当前线程还有任务要跑，再攒一会请求，这些任务结束之后或者攒够一批时再一起提交
+  if (!force && uringQueued_ < URING_SUBMIT_BATCH && hasRunnableTasks()) {
+    return;
+  }
+  Mutex::Lock lock(uringMutex_);
+  if (uring_->unsubmitted() == 0) {
+    return;
+  }
+  int ret = uring_->submit();
+  if (ret < 0) {
+    std::cout << "io_uring submit error: " << -ret << std::endl;
+  }
+  uringQueued_ = uring_->unsubmitted();
+}
+
+void IOManager::reapUring() {
+  uint64_t dummy;
+  while (read(uringFd_, &dummy, sizeof(dummy)) < 0 && errno == EINTR)
+    ;
+  // 先读eventfd再收割，收割之后完成的请求会重新触发eventfd
+  std::vector<std::pair<Fiber::ptr, int>> ready;
+  {
+    Mutex::Lock lock(uringMutex_);
+    uring_->reap([&](const io_uring_cqe &cqe) {
+      if (cqe.user_data & 1) {
+        return;
+      }
+      UringWaiter *w = reinterpret_cast<UringWaiter *>(cqe.user_data);
+      w->res = cqe.res;
+      ready.emplace_back(w->fiber, w->thread);
+    });
+  }
+  // 调度之后协程可能马上在原线程恢复并释放waiter，这里不能再访问它
+  for (auto &r : ready) {
+    --pendingUringCnt_;
+    scheduler(r.first, r.second);
+  }
+}
+#endif
 
 }  // namespace monsoon
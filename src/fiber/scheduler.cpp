@@ -7,6 +7,13 @@ namespace monsoon {
 static thread_local Scheduler *cur_scheduler = nullptr;
 // 当前线程的调度协程，每个线程一个 (协程级调度器)
 static thread_local Fiber *cur_scheduler_fiber = nullptr;
+// 当前线程在cur_scheduler里的worker下标，不是调度线程时为-1
+static thread_local int cur_worker = -1;
+// holdWakeups之后添加的任务先不唤醒，releaseWakeups时补一次
+static thread_local bool wakeups_held = false;
+static thread_local bool wakeups_pending = false;
+// 一次从注入队列最多搬多少个任务到自己的队列里
+static const size_t INJECT_BATCH = 32;
 
 const std::string LOG_HEAD = "[scheduler] ";
 
@@ -28,7 +35,13 @@ Scheduler::Scheduler(size_t threads, bool use_caller, const std::string &name) {
     // 设置当前线程为调度器线程（caller thread）
     cur_scheduler = this;
     // 初始化当前线程的调度协程 （该线程不会被调度器带哦都），调度结束后，返回主协程
-    rootFiber_.reset(new Fiber(std::bind(&Scheduler::run, this), 0, false));
+    int rootWorker = threads;
+    rootFiber_.reset(new Fiber(
+        [this, rootWorker]() {
+          cur_worker = rootWorker;
+          run();
+        },
+        0, false));
     std::cout << LOG_HEAD << "init caller thread's caller fiber success" << std::endl;
 
     Thread::SetName(name_);
@@ -39,6 +52,13 @@ Scheduler::Scheduler(size_t threads, bool use_caller, const std::string &name) {
     rootThread_ = -1;
   }
   threadCnt_ = threads;
+  size_t workerCnt = threads + (use_caller ? 1 : 0);
+  for (size_t i = 0; i < workerCnt; i++) {
+    workers_.emplace_back(new Worker);
+  }
+  if (use_caller) {
+    workerOfThread_[rootThread_] = threads;
+  }
   std::cout << "-------scheduler init success-------" << std::endl;
 }
 
@@ -50,6 +70,18 @@ Scheduler::~Scheduler() {
   if (GetThis() == this) {
     cur_scheduler = nullptr;
   }
+  for (auto *task : injected_) {
+    delete task;
+  }
+  for (auto &worker : workers_) {
+    SchedulerTask *task = nullptr;
+    while (worker->local.steal(&task)) {
+      delete task;
+    }
+    for (auto *t : worker->pinned) {
+      delete t;
+    }
+  }
 }
 
 // 调度器启动
@@ -64,7 +96,12 @@ void Scheduler::start() {
   CondPanic(threadPool_.empty(), "thread pool is not empty");
   threadPool_.resize(threadCnt_);
   for (size_t i = 0; i < threadCnt_; i++) {
-    threadPool_[i].reset(new Thread(std::bind(&Scheduler::run, this), name_ + "_" + std::to_string(i)));
+    threadPool_[i].reset(new Thread(
+        [this, i]() {
+          cur_worker = i;
+          run();
+        },
+        name_ + "_" + std::to_string(i)));
     threadIds_.push_back(threadPool_[i]->getId());
   }
 }
@@ -83,36 +120,31 @@ void Scheduler::run() {
   Fiber::ptr idleFiber(new Fiber(std::bind(&Scheduler::idle, this)));
   Fiber::ptr cbFiber;
 
+  {
+    RWMutex::WriteLock lock(workerMapMutex_);
+    workerOfThread_[GetThreadId()] = cur_worker;
+  }
+  CondPanic(cur_worker >= 0 && cur_worker < (int)workers_.size(), "bad worker index");
+  size_t self = cur_worker;
+
   SchedulerTask task;
   while (true) {
     task.reset();
-    // 是否通知其他线程进行任务调度
-    bool tickle_me = false;
-    {
-      Mutex::Lock lock(mutex_);
-      auto it = tasks_.begin();
-      while (it != tasks_.end()) {
-        // 发现已经指定调度线程，但是不是在当前线程进行调度
-        // 需要通知其他线程进行调度，并跳过当前任务
-        if (it->thread_ != -1 && it->thread_ != GetThreadId()) {
-          ++it;
-          tickle_me = true;
-          continue;
-        }
-        CondPanic(it->fiber_ || it->cb_, "task is nullptr");
-        if (it->fiber_) {
-          CondPanic(it->fiber_->getState() == Fiber::READY, "fiber task state error");
-        }
-        // 找到一个可进行任务，准备开始调度，从任务队列取出，活动线程加1
-        task = *it;
-        tasks_.erase(it++);
-        ++activeThreadCnt_;
-        break;
+    SchedulerTask *next = take(self);
+    if (next != nullptr) {
+      CondPanic(next->fiber_ || next->cb_, "task is nullptr");
+      if (next->fiber_) {
+        CondPanic(next->fiber_->getState() == Fiber::READY, "fiber task state error");
       }
-      // 当前线程拿出一个任务后，同时任务队列不空，那么告诉其他线程
-      tickle_me |= (it != tasks_.end());
-    }
-    if (tickle_me) {
+      // 找到一个可进行任务，准备开始调度，活动线程数在take里已经加1
+      task = std::move(*next);
+      delete next;
+      // 拿走一个之后还有任务，叫醒一个空闲线程来帮忙，它拿到任务后会再叫下一个
+      if (queuedTaskCnt_ > 0) {
+        wakeIdle();
+      }
+    } else if (queuedTaskCnt_ > 0 && !hasRunnableTasks() && pinnedOwnerIdle()) {
+      // 剩下的都是指定了别的线程的任务，被叫醒的可能不是那个线程，那个线程空闲时继续往下叫
       tickle();
     }
 
@@ -122,6 +154,7 @@ void Scheduler::run() {
       // 执行结束
       --activeThreadCnt_;
       task.reset();
+      afterTask();
     } else if (task.cb_) {
       if (cbFiber) {
         cbFiber->reset(task.cb_);
@@ -132,6 +165,7 @@ void Scheduler::run() {
       cbFiber->resume();
       --activeThreadCnt_;
       cbFiber.reset();
+      afterTask();
     } else {
       // 任务队列为空
       if (idleFiber->getState() == Fiber::TERM) {
@@ -140,20 +174,171 @@ void Scheduler::run() {
       }
       // idle协程不断空轮转
       ++idleThreadCnt_;
+      workers_[self]->idle = true;
       idleFiber->resume();
+      workers_[self]->idle = false;
       --idleThreadCnt_;
     }
   }
   std::cout << "run exit" << std::endl;
 }
 
-void Scheduler::tickle() { std::cout << "tickle" << std::endl; }
+void Scheduler::push(SchedulerTask *task) {
+  Worker *target = nullptr;
+  bool local = false;
+  if (task->thread_ != -1) {
+    RWMutex::ReadLock lock(workerMapMutex_);
+    auto it = workerOfThread_.find(task->thread_);
+    CondPanic(it != workerOfThread_.end(), "task pinned to a thread outside the scheduler");
+    target = workers_[it->second].get();
+  } else if (GetThis() == this && cur_worker >= 0) {
+    target = workers_[cur_worker].get();
+    local = true;
+  }
+  ++queuedTaskCnt_;
+  if (local) {
+    target->local.push(task);
+  } else if (target != nullptr) {
+    Mutex::Lock lock(target->pinnedMutex);
+    target->pinned.push_back(task);
+    ++target->pinnedCnt;
+  } else {
+    Mutex::Lock lock(injectMutex_);
+    injected_.push_back(task);
+    ++injectedCnt_;
+  }
+  wakeIdle();
+}
 
-bool Scheduler::stopping() {
-  Mutex::Lock lock(mutex_);
-  return isStopped_ && tasks_.empty() && activeThreadCnt_ == 0;
+SchedulerTask *Scheduler::take(size_t self) {
+  Worker &worker = *workers_[self];
+  SchedulerTask *task = nullptr;
+  if (worker.pinnedCnt > 0) {
+    Mutex::Lock lock(worker.pinnedMutex);
+    if (!worker.pinned.empty()) {
+      task = worker.pinned.front();
+      worker.pinned.pop_front();
+      --worker.pinnedCnt;
+    }
+  }
+  // steal在和别的线程竞争时会失败，队列不空就再试
+  while (task == nullptr && worker.local.size() > 0) {
+    worker.local.steal(&task);
+  }
+  if (task == nullptr) {
+    task = takeInjected(self);
+  }
+  if (task == nullptr) {
+    task = steal(self);
+  }
+  if (task != nullptr) {
+    // 先算作活动线程再减排队数，stopping()不会在两者之间看到都为0
+    ++activeThreadCnt_;
+    --queuedTaskCnt_;
+  }
+  return task;
+}
+
+SchedulerTask *Scheduler::takeInjected(size_t self) {
+  if (injectedCnt_ == 0) {
+    return nullptr;
+  }
+  // 多搬几个到自己的队列里，之后不用再抢这把锁，其他线程也可以从这里偷
+  SchedulerTask *batch[INJECT_BATCH];
+  size_t n = 0;
+  {
+    Mutex::Lock lock(injectMutex_);
+    size_t want = std::min(INJECT_BATCH, injected_.size() / workers_.size() + 1);
+    while (n < want && !injected_.empty()) {
+      batch[n++] = injected_.front();
+      injected_.pop_front();
+    }
+    injectedCnt_ -= n;
+  }
+  for (size_t i = 1; i < n; i++) {
+    workers_[self]->local.push(batch[i]);
+  }
+  return n > 0 ? batch[0] : nullptr;
 }
 
+SchedulerTask *Scheduler::steal(size_t self) {
+  size_t n = workers_.size();
+  if (n <= 1) {
+    return nullptr;
+  }
+  // 从随机的位置开始，避免所有空闲线程都去偷同一个
+  static thread_local uint32_t seed = GetThreadId() * 2654435761u + 1;
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  size_t start = seed % n;
+  SchedulerTask *task = nullptr;
+  for (size_t i = 0; i < n; i++) {
+    size_t victim = (start + i) % n;
+    if (victim == self) {
+      continue;
+    }
+    WorkStealingQueue<SchedulerTask *> &queue = workers_[victim]->local;
+    while (queue.size() > 0) {
+      if (queue.steal(&task)) {
+        return task;
+      }
+    }
+  }
+  return nullptr;
+}
+
+int Scheduler::currentWorker() const { return GetThis() == this ? cur_worker : -1; }
+
+bool Scheduler::hasRunnableTasks() const {
+  if (cur_worker < 0 || GetThis() != this) {
+    return queuedTaskCnt_ > 0;
+  }
+  if (workers_[cur_worker]->pinnedCnt > 0 || injectedCnt_ > 0) {
+    return true;
+  }
+  for (const auto &worker : workers_) {
+    if (worker->local.size() > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Scheduler::pinnedOwnerIdle() const {
+  for (const auto &worker : workers_) {
+    if (worker->pinnedCnt > 0 && worker->idle) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Scheduler::wakeIdle() {
+  if (wakeups_held) {
+    wakeups_pending = true;
+    return;
+  }
+  if (isHasIdleThreads()) {
+    tickle();
+  }
+}
+
+void Scheduler::holdWakeups() { wakeups_held = true; }
+
+void Scheduler::releaseWakeups() {
+  wakeups_held = false;
+  if (wakeups_pending) {
+    wakeups_pending = false;
+    wakeIdle();
+  }
+}
+
+// 基类的idle一直在yield，不需要唤醒
+void Scheduler::tickle() {}
+
+bool Scheduler::stopping() { return isStopped_ && queuedTaskCnt_ == 0 && activeThreadCnt_ == 0; }
+
 void Scheduler::idle() {
   while (!stopping()) {
     Fiber::GetThis()->yield();
@@ -0,0 +1,150 @@
+#include "stack_allocator.hpp"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+#include "mutex.hpp"
+#include "utils.hpp"
+
+namespace monsoon {
+namespace {
+// 32K,64K,...,1M
+const int kClassNum = 6;
+// 每个线程每个档位最多缓存的栈数
+const size_t kLocalCacheMax = 16;
+// 全局缓存每个档位最多占用的虚拟内存
+const size_t kGlobalCacheBytes = 64 * 1024 * 1024;
+
+size_t PageSize() {
+  static const size_t page = sysconf(_SC_PAGESIZE);
+  return page;
+}
+
+int ClassOf(size_t size) {
+  int cls = 0;
+  size_t classSize = StackAllocator::kMinStackSize;
+  while (classSize < size) {
+    classSize <<= 1;
+    ++cls;
+  }
+  return cls;
+}
+
+void *MapStack(size_t size) {
+  size_t page = PageSize();
+  void *base = mmap(nullptr, size + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK,
+                    -1, 0);
+  CondPanic(base != MAP_FAILED, "mmap fiber stack failed");
+  // 栈从高地址往低地址增长，保护页放在最低处
+  CondPanic(0 == mprotect(base, page, PROT_NONE), "mprotect stack guard page failed");
+  return static_cast<char *>(base) + page;
+}
+
+void UnmapStack(void *vp, size_t size) {
+  size_t page = PageSize();
+  CondPanic(0 == munmap(static_cast<char *>(vp) - page, size + page), "munmap fiber stack failed");
+}
+
+// 所有线程共享的缓存，线程本地缓存满了或者线程退出时栈放到这里
+class GlobalStackCache {
+ public:
+  void *get(int cls) {
+    Mutex::Lock lock(mutex_);
+    if (free_[cls].empty()) {
+      return nullptr;
+    }
+    void *vp = free_[cls].back();
+    free_[cls].pop_back();
+    return vp;
+  }
+
+  // 放不下返回false，由调用者munmap
+  bool put(int cls, void *vp, size_t size) {
+    {
+      Mutex::Lock lock(mutex_);
+      if ((free_[cls].size() + 1) * size > kGlobalCacheBytes) {
+        return false;
+      }
+    }
+    // 进全局缓存的栈短时间内不一定会被用到，先把物理内存还给系统，下次写入时再分配
+    madvise(vp, size, MADV_DONTNEED);
+    Mutex::Lock lock(mutex_);
+    free_[cls].push_back(vp);
+    return true;
+  }
+
+ private:
+  Mutex mutex_;
+  std::vector<void *> free_[kClassNum];
+};
+
+GlobalStackCache &GlobalCache() {
+  static GlobalStackCache *cache = new GlobalStackCache;  // 不析构，线程退出时还可能往里放
+  return *cache;
+}
+
+// 线程退出时本地缓存先析构，之后再释放的栈直接走全局缓存
+thread_local bool local_cache_gone = false;
+
+struct LocalStackCache {
+  ~LocalStackCache() {
+    local_cache_gone = true;
+    for (int cls = 0; cls < kClassNum; ++cls) {
+      size_t size = StackAllocator::kMinStackSize << cls;
+      for (void *vp : free[cls]) {
+        if (!GlobalCache().put(cls, vp, size)) {
+          UnmapStack(vp, size);
+        }
+      }
+    }
+  }
+  std::vector<void *> free[kClassNum];
+};
+
+thread_local LocalStackCache local_cache;
+}  // namespace
+
+size_t StackAllocator::RoundUp(size_t size) {
+  if (size <= kMinStackSize) {
+    return kMinStackSize;
+  }
+  if (size <= kMaxPooledStackSize) {
+    return kMinStackSize << ClassOf(size);
+  }
+  size_t page = PageSize();
+  return (size + page - 1) / page * page;
+}
+
+void *StackAllocator::Alloc(size_t size) {
+  if (size > kMaxPooledStackSize) {
+    return MapStack(size);
+  }
+  int cls = ClassOf(size);
+  if (local_cache_gone) {
+    void *vp = GlobalCache().get(cls);
+    return vp != nullptr ? vp : MapStack(size);
+  }
+  std::vector<void *> &local = local_cache.free[cls];
+  if (!local.empty()) {
+    void *vp = local.back();
+    local.pop_back();
+    return vp;
+  }
+  void *vp = GlobalCache().get(cls);
+  return vp != nullptr ? vp : MapStack(size);
+}
+
+void StackAllocator::Delete(void *vp, size_t size) {
+  if (size > kMaxPooledStackSize) {
+    UnmapStack(vp, size);
+    return;
+  }
+  int cls = ClassOf(size);
+  if (!local_cache_gone && local_cache.free[cls].size() < kLocalCacheMax) {
+    local_cache.free[cls].push_back(vp);
+    return;
+  }
+  if (!GlobalCache().put(cls, vp, size)) {
+    UnmapStack(vp, size);
+  }
+}
+}  // namespace monsoon
@@ -1,52 +1,35 @@
 #include "timer.hpp"
+#include <algorithm>
 #include "utils.hpp"
 
 namespace monsoon {
-bool Timer::Comparator::operator()(const Timer::ptr &lhs, const Timer::ptr &rhs) const {
-  if (!lhs && !rhs) {
-    return false;
-  }
-  if (!lhs) {
-    return true;
-  }
-  if (!rhs) {
-    return false;
-  }
-  if (lhs->next_ < rhs->next_) {
-    return true;
-  }
-  if (rhs->next_ < lhs->next_) {
-    return false;
-  }
-  return lhs.get() < rhs.get();
-}
 Timer::Timer(uint64_t ms, std::function<void()> cb, bool recuring, TimerManager *manager)
     : recurring_(recuring), ms_(ms), cb_(cb), manager_(manager) {
   next_ = GetElapsedMS() + ms_;
 }
-Timer::Timer(uint64_t next) : next_(next) {}
+
 bool Timer::cancel() {
-  RWMutex::WriteLock lock(manager_->mutex_);
+  Timer::ptr self;
+  Mutex::Lock lock(wheel_->mutex);
   if (cb_) {
     cb_ = nullptr;
-    auto it = manager_->timers_.find(shared_from_this());
-    manager_->timers_.erase(it);
+    if (pprev_ != nullptr) {
+      wheel_->unlink(this);
+      self.swap(self_);
+    }
     return true;
   }
   return false;
 }
+
 bool Timer::refresh() {
-  RWMutex::RWMutex::WriteLock lock(manager_->mutex_);
-  if (!cb_) {
-    return false;
-  }
-  auto it = manager_->timers_.find(shared_from_this());
-  if (it == manager_->timers_.end()) {
+  Mutex::Lock lock(wheel_->mutex);
+  if (!cb_ || pprev_ == nullptr) {
     return false;
   }
-  manager_->timers_.erase(it);
+  wheel_->unlink(this);
   next_ = GetElapsedMS() + ms_;
-  manager_->timers_.insert(shared_from_this());
+  wheel_->link(this);
   return true;
 }
 
@@ -57,35 +40,187 @@ bool Timer::reset(uint64_t ms, bool from_now) {
   if (ms == ms_ && !from_now) {
     return true;
   }
-  RWMutex::WriteLock lock(manager_->mutex_);
-  if (!cb_) {
-    return true;
-  }
-  auto it = manager_->timers_.find(shared_from_this());
-  if (it == manager_->timers_.end()) {
-    return false;
+  bool at_front = false;
+  {
+    Mutex::Lock lock(wheel_->mutex);
+    if (!cb_) {
+      return true;
+    }
+    if (pprev_ == nullptr) {
+      return false;
+    }
+    wheel_->unlink(this);
+    uint64_t start = 0;
+    if (from_now) {
+      start = GetElapsedMS();
+    } else {
+      start = next_ - ms_;
+    }
+    ms_ = ms;
+    next_ = start + ms_;
+    at_front = manager_->linkLocked(wheel_, this);
   }
-  manager_->timers_.erase(it);
-  uint64_t start = 0;
-  if (from_now) {
-    start = GetElapsedMS();
-  } else {
-    start = next_ - ms_;
+  if (at_front) {
+    manager_->OnTimerInsertedAtFront();
   }
-  ms_ = ms;
-  next_ = start + ms_;
-  manager_->addTimer(shared_from_this(), lock);
   return true;
 }
 
-TimerManager::TimerManager() { previouseTime_ = GetElapsedMS(); }
+TimerWheel::TimerWheel(uint64_t now) : current(now) {
+  for (int level = 0; level < LEVELS; ++level) {
+    for (int slot = 0; slot < SLOTS; ++slot) {
+      slots[level][slot] = nullptr;
+    }
+  }
+}
+
+void TimerWheel::link(Timer *timer) {
+  uint64_t expires = timer->next_;
+  // 已经到期的放在下一毫秒的槽，下次advance就会取出
+  if (expires <= current) {
+    expires = current + 1;
+  }
+  uint64_t delta = expires - current;
+  int level = 0;
+  while (level < LEVELS - 1 && delta >= (1ull << ((level + 1) * SLOT_BITS))) {
+    ++level;
+  }
+  if (level == LEVELS - 1 && delta >= (1ull << (LEVELS * SLOT_BITS))) {
+    // 超出整个轮的范围，先放在最后一层最远的槽，转到时按真实的到期时间重新放
+    expires = current + (1ull << (LEVELS * SLOT_BITS)) - 1;
+  }
+  int slot = (expires >> (level * SLOT_BITS)) & (SLOTS - 1);
+  Timer **head = &slots[level][slot];
+  timer->nextNode_ = *head;
+  if (*head != nullptr) {
+    (*head)->pprev_ = &timer->nextNode_;
+  }
+  *head = timer;
+  timer->pprev_ = head;
+  timer->level_ = level;
+  if (!timer->self_) {
+    timer->self_ = timer->shared_from_this();
+  }
+  ++levelCount[level];
+  ++count;
+  if (timer->next_ < nextExpire) {
+    nextExpire = timer->next_;
+  }
+}
+
+void TimerWheel::unlink(Timer *timer) {
+  *timer->pprev_ = timer->nextNode_;
+  if (timer->nextNode_ != nullptr) {
+    timer->nextNode_->pprev_ = timer->pprev_;
+  }
+  timer->pprev_ = nullptr;
+  timer->nextNode_ = nullptr;
+  --levelCount[timer->level_];
+  --count;
+}
+
+void TimerWheel::cascade(int level, int slot) {
+  Timer *timer = slots[level][slot];
+  slots[level][slot] = nullptr;
+  while (timer != nullptr) {
+    Timer *next = timer->nextNode_;
+    timer->pprev_ = nullptr;
+    timer->nextNode_ = nullptr;
+    --levelCount[level];
+    --count;
+    link(timer);
+    timer = next;
+  }
+}
+
+void TimerWheel::advance(uint64_t now, std::vector<Timer::ptr> &expired) {
+  while (current < now) {
+    if (count == 0) {
+      current = now;
+      break;
+    }
+    // 低层都是空的，中间的槽不用一个个走，直接跳到下一次需要从高层往下放的时间
+    int empty = 0;
+    while (empty < LEVELS - 1 && levelCount[empty] == 0) {
+      ++empty;
+    }
+    uint64_t next = current + 1;
+    if (empty > 0) {
+      uint64_t span = 1ull << (empty * SLOT_BITS);
+      next = (current | (span - 1)) + 1;
+      if (next > now) {
+        current = now;
+        break;
+      }
+    }
+    current = next;
+    // 走到高层一个槽的起点时，先把这个槽的定时器放到低层
+    for (int level = LEVELS - 1; level > 0; --level) {
+      if ((current & ((1ull << (level * SLOT_BITS)) - 1)) == 0) {
+        cascade(level, (current >> (level * SLOT_BITS)) & (SLOTS - 1));
+      }
+    }
+    Timer **head = &slots[0][current & (SLOTS - 1)];
+    while (*head != nullptr) {
+      Timer *timer = *head;
+      unlink(timer);
+      expired.push_back(std::move(timer->self_));
+    }
+  }
+}
+
+uint64_t TimerWheel::earliest() const {
+  if (count == 0) {
+    return ~0ull;
+  }
+  uint64_t result = ~0ull;
+  for (int level = 0; level < LEVELS; ++level) {
+    if (levelCount[level] == 0) {
+      continue;
+    }
+    int shift = level * SLOT_BITS;
+    for (uint64_t i = 1; i <= SLOTS; ++i) {
+      uint64_t block = (current >> shift) + i;
+      if (slots[level][block & (SLOTS - 1)] != nullptr) {
+        // 第一层是精确的到期时间，高层是放到下一层的时间，不会晚于其中的定时器
+        uint64_t at = block << shift;
+        if (at < result) {
+          result = at;
+        }
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+TimerManager::TimerManager(size_t wheels) {
+  uint64_t now = GetElapsedMS();
+  for (size_t i = 0; i < std::max<size_t>(wheels, 1); ++i) {
+    wheels_.emplace_back(new TimerWheel(now));
+  }
+}
 
-TimerManager::~TimerManager() {}
+TimerManager::~TimerManager() {
+  // 轮上的定时器持有自己，断开之后才能释放
+  for (auto &wheel : wheels_) {
+    std::vector<Timer::ptr> timers;
+    Mutex::Lock lock(wheel->mutex);
+    for (int level = 0; level < TimerWheel::LEVELS; ++level) {
+      for (int slot = 0; slot < TimerWheel::SLOTS; ++slot) {
+        while (wheel->slots[level][slot] != nullptr) {
+          Timer *timer = wheel->slots[level][slot];
+          wheel->unlink(timer);
+          timers.push_back(std::move(timer->self_));
+        }
+      }
+    }
+  }
+}
 
 Timer::ptr TimerManager::addTimer(uint64_t ms, std::function<void()> cb, bool recurring) {
   Timer::ptr timer(new Timer(ms, cb, recurring, this));
-  RWMutex::WriteLock lock(mutex_);
-  addTimer(timer, lock);
+  addTimer(timer);
   return timer;
 }
 
@@ -102,86 +237,79 @@ Timer::ptr TimerManager::addConditionTimer(uint64_t ms, std::function<void()> cb
 }
 
 uint64_t TimerManager::getNextTimer() {
-  RWMutex::ReadLock lock(mutex_);
   tickled_ = false;
-  if (timers_.empty()) {
+  uint64_t next = earliest();
+  if (next == ~0ull) {
     return ~0ull;
   }
-  const Timer::ptr &next = *timers_.begin();
   uint64_t now_ms = GetElapsedMS();
-  if (now_ms >= next->next_) {
+  if (now_ms >= next) {
     return 0;
   } else {
-    return next->next_ - now_ms;
+    return next - now_ms;
   }
 }
 
 void TimerManager::listExpiredCb(std::vector<std::function<void()>> &cbs) {
   uint64_t now_ms = GetElapsedMS();
   std::vector<Timer::ptr> expired;
-  {
-    RWMutex::ReadLock lock(mutex_);
-    if (timers_.empty()) {
-      return;
+  for (auto &wheel : wheels_) {
+    if (wheel->nextExpire > now_ms) {
+      continue;
     }
-  }
-  RWMutex::WriteLock lock(mutex_);
-  if (timers_.empty()) {
-    return;
-  }
-  bool rollover = false;
-  if (detectClockRolllover(now_ms)) {
-    rollover = true;
-  }
-  if (!rollover && ((*timers_.begin())->next_ > now_ms)) {
-    return;
-  }
-
-  Timer::ptr now_timer(new Timer(now_ms));
-  auto it = rollover ? timers_.end() : timers_.lower_bound(now_timer);
-  while (it != timers_.end() && (*it)->next_ == now_ms) {
-    ++it;
-  }
-  expired.insert(expired.begin(), timers_.begin(), it);
-  timers_.erase(timers_.begin(), it);
-
-  cbs.reserve(expired.size());
-  for (auto &timer : expired) {
-    cbs.push_back(timer->cb_);
-    if (timer->recurring_) {
-      // 循环计时，重新加入堆中
-      timer->next_ = now_ms + timer->ms_;
-      timers_.insert(timer);
-    } else {
-      timer->cb_ = nullptr;
+    Mutex::Lock lock(wheel->mutex);
+    size_t begin = expired.size();
+    wheel->advance(now_ms, expired);
+    for (size_t i = begin; i < expired.size(); ++i) {
+      Timer *timer = expired[i].get();
+      if (timer->recurring_) {
+        // 循环计时，重新加入时间轮
+        cbs.push_back(timer->cb_);
+        timer->next_ = now_ms + timer->ms_;
+        wheel->link(timer);
+      } else {
+        cbs.push_back(std::move(timer->cb_));
+        timer->cb_ = nullptr;
+      }
     }
+    wheel->nextExpire = wheel->earliest();
   }
 }
 
-void TimerManager::addTimer(Timer::ptr val, RWMutex::WriteLock &lock) {
-  auto it = timers_.insert(val).first;
-  bool at_front = (it == timers_.begin()) && !tickled_;
-  if (at_front) {
-    tickled_ = true;
+void TimerManager::addTimer(const Timer::ptr &timer) {
+  TimerWheel *wheel = wheels_[currentWheel() % wheels_.size()].get();
+  timer->wheel_ = wheel;
+  bool at_front = false;
+  {
+    Mutex::Lock lock(wheel->mutex);
+    at_front = linkLocked(wheel, timer.get());
   }
-  lock.unlock();
   if (at_front) {
     OnTimerInsertedAtFront();
   }
 }
 
-bool TimerManager::detectClockRolllover(uint64_t now_ms) {
-  bool rollover = false;
-  if (now_ms < previouseTime_ && now_ms < (previouseTime_ - 60 * 60 * 1000)) {
-    rollover = true;
+bool TimerManager::linkLocked(TimerWheel *wheel, Timer *timer) {
+  bool earlier = timer->next_ < earliest();
+  wheel->link(timer);
+  return earlier && !tickled_.exchange(true);
+}
+
+uint64_t TimerManager::earliest() const {
+  uint64_t next = ~0ull;
+  for (auto &wheel : wheels_) {
+    next = std::min<uint64_t>(next, wheel->nextExpire);
   }
-  previouseTime_ = now_ms;
-  return rollover;
+  return next;
 }
 
 bool TimerManager::hasTimer() {
-  RWMutex::ReadLock lock(mutex_);
-  return !timers_.empty();
+  for (auto &wheel : wheels_) {
+    if (wheel->count > 0) {
+      return true;
+    }
+  }
+  return false;
 }
 
-}  // namespace monsoon
\ No newline at end of file
+}  // namespace monsoon
@@ -7,73 +7,672 @@
 
 #include "util.h"
 
+#include <algorithm>
+#include <chrono>
+#include <random>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
-std::string Clerk::Get(std::string key) {
-  m_requestId++;
-  auto requestId = m_requestId;
-  int server = m_recentLeaderId;
+#include "monsoon.h"
+#include "mprpcchannel.h"
+
+// 一个异步请求从发出到完成的全部状态，重试时复用同一个args，requestId不变
+struct Clerk::GetCall {
+  Shard *shard;
   raftKVRpcProctoc::GetArgs args;
-  args.set_key(key);
-  args.set_clientid(m_clientId);
-  args.set_requestid(requestId);
+  raftKVRpcProctoc::GetReply reply;
+  Retry retry;
+  std::function<void(std::string)> done;
+};
+
+struct Clerk::PutAppendCall {
+  Shard *shard;
+  raftKVRpcProctoc::PutAppendArgs args;
+  raftKVRpcProctoc::PutAppendReply reply;
+  Retry retry;
+  std::function<void(const raftKVRpcProctoc::PutAppendReply &)> done;
+};
+
+struct Clerk::RegisterCall {
+  raftKVRpcProctoc::RegisterClientArgs args;
+  raftKVRpcProctoc::RegisterClientReply reply;
+  Retry retry;
+};
+
+int Clerk::nextServer(Retry* retry, bool ok, int leaderId, int leaderTerm) {
+  int n = m_servers.size();
+  if (ok && leaderTerm > 0 && leaderTerm >= retry->leaderTerm && leaderId >= 0 && leaderId < n &&
+      leaderId != retry->server) {
+    retry->leaderTerm = leaderTerm;
+    retry->server = leaderId;
+  } else {
+    retry->server = (retry->server + 1) % n;
+  }
+  // 提示也可能互相指来指去，所以不管是否跟随了提示都计数
+  if (++retry->attempts % n != 0) {
+    return 0;
+  }
+  thread_local std::mt19937 rng(std::random_device{}());
+  int delayMs = retry->backoffMs / 2 + std::uniform_int_distribution<int>(0, retry->backoffMs / 2)(rng);
+  retry->backoffMs = std::min(retry->backoffMs * 2, CLERK_RETRY_BACKOFF_MAX_MS);
+  return delayMs;
+}
+
+void Clerk::retryLater(int delayMs, std::function<void()> fn) {
+  if (delayMs > 0) {
+    MprpcChannel::ClientIOManager()->addTimer(delayMs, std::move(fn));
+  } else {
+    MprpcChannel::ClientIOManager()->scheduler(std::move(fn));
+  }
+}
+
+void Clerk::renewSession(Shard *shard, uint64_t expiredId) {
+  auto promise = std::make_shared<std::promise<void>>();
+  auto future = promise->get_future();
+  renewSessionAsync(shard, expiredId, [promise]() { promise->set_value(); });
+  future.get();
+}
+
+void Clerk::renewSessionAsync(Shard *shard, uint64_t expiredId, std::function<void()> done) {
+  {
+    std::lock_guard<std::mutex> lock(shard->sessionMtx);
+    if (shard->registering) {
+      shard->sessionWaiters.push_back(std::move(done));
+      return;
+    }
+    if (shard->clientId != expiredId) {
+      // 别的请求已经换过session了
+      retryLater(0, std::move(done));
+      return;
+    }
+    shard->registering = true;
+    shard->sessionWaiters.push_back(std::move(done));
+  }
+  // 过期之前在途的请求换了session之后不再去重，这是很少见的情况；Init里第一次注册时expiredId是0
+  DPrintf("【Clerk::renewSession】group{%d} session{%llu}过期，重新注册", shard->id,
+          static_cast<unsigned long long>(expiredId));
+  auto call = std::make_shared<RegisterCall>();
+  call->args.set_groupid(shard->id);
+  call->retry.server = *shard->recentLeaderId;
+  sendRegister(shard, std::move(call));
+}
+
+void Clerk::sendRegister(Shard *shard, std::shared_ptr<RegisterCall> call) {
+  call->reply.Clear();
+  m_servers[call->retry.server]->RegisterClientAsync(&call->args, &call->reply, [this, shard, call](bool ok) {
+    if (!ok || call->reply.err() != OK) {
+      int delayMs = nextServer(&call->retry, ok, call->reply.leaderid(), call->reply.leaderterm());
+      retryLater(delayMs, [this, shard, call]() { sendRegister(shard, call); });
+      return;
+    }
+    *shard->recentLeaderId = call->retry.server;
+    std::vector<std::function<void()>> waiters;
+    {
+      std::lock_guard<std::mutex> lock(shard->sessionMtx);
+      shard->clientId = call->reply.clientid();
+      shard->registering = false;
+      waiters.swap(shard->sessionWaiters);
+    }
+    for (auto &fn : waiters) {
+      fn();
+    }
+  });
+}
+
+int Clerk::beginRequest(Shard *shard) {
+  std::unique_lock<std::mutex> lock(shard->mtx);
+  // 排队的异步请求先拿
+  shard->inflightCv.wait(lock, [shard]() { return shard->admitQueue.empty() && shard->hasRoom(); });
+  int requestId = ++shard->requestId;
+  shard->inflight.insert(requestId);
+  return requestId;
+}
+
+void Clerk::beginRequestAsync(Shard *shard, std::function<void(int)> admit) {
+  std::unique_lock<std::mutex> lock(shard->mtx);
+  if (!shard->admitQueue.empty() || !shard->hasRoom()) {
+    shard->admitQueue.push_back(std::move(admit));
+    return;
+  }
+  int requestId = ++shard->requestId;
+  shard->inflight.insert(requestId);
+  lock.unlock();
+  admit(requestId);
+}
+
+void Clerk::endRequest(Shard *shard, int requestId) {
+  std::vector<std::pair<std::function<void(int)>, int>> admitted;
+  {
+    std::lock_guard<std::mutex> lock(shard->mtx);
+    bool oldest = *shard->inflight.begin() == requestId;
+    shard->inflight.erase(requestId);
+    // 窗口只由最旧的请求决定
+    if (!oldest) {
+      return;
+    }
+    while (!shard->admitQueue.empty() && shard->hasRoom()) {
+      int id = ++shard->requestId;
+      shard->inflight.insert(id);
+      admitted.emplace_back(std::move(shard->admitQueue.front()), id);
+      shard->admitQueue.pop_front();
+    }
+    if (shard->admitQueue.empty()) {
+      shard->inflightCv.notify_all();
+    }
+  }
+  // endRequest在完成回调里调用，不在这个调用栈里继续发送
+  for (auto &item : admitted) {
+    retryLater(0, [admit = std::move(item.first), id = item.second]() { admit(id); });
+  }
+}
+
+int Clerk::groupOf(const std::string &key) {
+  std::shared_lock<std::shared_mutex> lock(m_rangesMtx);
+  return m_ranges.groupOf(key);
+}
+
+Clerk::Shard *Clerk::shardOf(const std::string &key) {
+  for (int server = 0;; server = (server + 1) % m_servers.size()) {
+    int g = groupOf(key);
+    if (g >= 0) {
+      return m_shards[g].get();
+    }
+    // 范围正在迁移，目标组还没有收下
+    std::this_thread::sleep_for(std::chrono::milliseconds(CLERK_RETRY_BACKOFF_MIN_MS));
+    refreshRanges(server);
+  }
+}
+
+void Clerk::refreshRanges(int server) {
+  raftKVRpcProctoc::GetRangesArgs args;
+  raftKVRpcProctoc::GetRangesReply reply;
+  if (m_servers[server]->GetRanges(&args, &reply)) {
+    applyRanges(reply);
+  }
+}
+
+void Clerk::refreshRangesAsync(int server, std::function<void()> done) {
+  auto rpc = std::make_shared<std::pair<raftKVRpcProctoc::GetRangesArgs, raftKVRpcProctoc::GetRangesReply>>();
+  m_servers[server]->GetRangesAsync(&rpc->first, &rpc->second, [this, rpc, done](bool ok) {
+    if (ok) {
+      applyRanges(rpc->second);
+    }
+    done();
+  });
+}
+
+void Clerk::applyRanges(const raftKVRpcProctoc::GetRangesReply &reply) {
+  if (reply.err() != OK || reply.groups() != static_cast<int>(m_shards.size())) {
+    return;
+  }
+  std::vector<KeyRangeTable::Entry> entries;
+  for (const auto &info : reply.ranges()) {
+    if (info.groupid() < 0 || info.groupid() >= reply.groups()) {
+      return;
+    }
+    entries.push_back({info.groupid(), {info.start(), info.end()}});
+  }
+  std::unique_lock<std::shared_mutex> lock(m_rangesMtx);
+  m_ranges.Assign(reply.groups(), std::move(entries));
+}
+
+template <typename Call>
+void Clerk::reroute(std::shared_ptr<Call> call, void (Clerk::*send)(std::shared_ptr<Call>)) {
+  // 在IO线程里执行，全程不阻塞：范围表异步拉取，新组的窗口满了就排队等endRequest
+  refreshRangesAsync(call->retry.server, [this, call, send]() {
+    int g = groupOf(call->args.key());
+    if (g < 0) {
+      retryLater(CLERK_RETRY_BACKOFF_MIN_MS, [this, call, send]() { reroute(call, send); });
+      return;
+    }
+    // 旧的组没有执行这个请求，换到新的组就是一个新的请求
+    endRequest(call->shard, call->args.requestid());
+    call->shard = m_shards[g].get();
+    call->args.set_groupid(g);
+    beginRequestAsync(call->shard, [this, call, send](int requestId) {
+      call->args.set_clientid(call->shard->clientId);
+      call->args.set_requestid(requestId);
+      call->retry = Retry{*call->shard->recentLeaderId};
+      (this->*send)(call);
+    });
+  });
+}
+
+std::string Clerk::Get(std::string key) { return GetAsync(std::move(key)).get(); }
+
+std::future<std::string> Clerk::GetAsync(std::string key) {
+  auto promise = std::make_shared<std::promise<std::string>>();
+  auto future = promise->get_future();
+  GetAsync(std::move(key), [promise](std::string value) { promise->set_value(std::move(value)); });
+  return future;
+}
+
+void Clerk::GetAsync(std::string key, std::function<void(std::string)> done) {
+  auto call = std::make_shared<GetCall>();
+  call->shard = shardOf(key);
+  call->args.set_key(std::move(key));
+  call->args.set_groupid(call->shard->id);
+  call->args.set_clientid(call->shard->clientId);
+  call->args.set_requestid(beginRequest(call->shard));
+  call->retry.server = *call->shard->recentLeaderId;
+  if (m_followerRead) {
+    call->retry.server = m_nextReadServer.fetch_add(1) % m_servers.size();
+    call->args.set_followerread(true);
+    call->args.set_maxstalenessms(m_maxStalenessMs);
+  }
+  call->done = std::move(done);
+  sendGet(std::move(call));
+}
+
+void Clerk::sendGet(std::shared_ptr<GetCall> call) {
+  call->reply.Clear();
+  auto* server = m_servers[call->retry.server].get();
+  server->GetAsync(&call->args, &call->reply, [this, call](bool ok) {
+    const std::string& err = call->reply.err();
+    if (ok && err == ErrWrongGroup) {
+      retryLater(0, [this, call]() { reroute(call, &Clerk::sendGet); });
+      return;
+    }
+    if (err != OK && err != ErrNoKey) {
+      //会一直重试，因为requestId没有改变，因此可能会因为RPC的丢失或者其他情况导致重试，kvserver层来保证不重复执行（线性一致性）
+      int delayMs = nextServer(&call->retry, ok, call->reply.leaderid(), call->reply.leaderterm());
+      retryLater(delayMs, [this, call]() { sendGet(call); });
+      return;
+    }
+    if (!m_followerRead) {
+      *call->shard->recentLeaderId = call->retry.server;
+    }
+    endRequest(call->shard, call->args.requestid());
+    call->done(err == OK ? call->reply.value() : "");
+  });
+}
+
+void Clerk::SetFollowerRead(bool enable, int maxStalenessMs) {
+  m_followerRead = enable;
+  m_maxStalenessMs = maxStalenessMs;
+}
+
+void Clerk::PutAppend(std::string key, std::string value, std::string op) {
+  auto promise = std::make_shared<std::promise<void>>();
+  auto future = promise->get_future();
+  PutAppendAsync(std::move(key), std::move(value), std::move(op), [promise]() { promise->set_value(); });
+  future.get();
+}
+
+void Clerk::PutAppendAsync(std::string key, std::string value, std::string op, std::function<void()> done) {
+  raftKVRpcProctoc::PutAppendArgs args;
+  args.set_key(std::move(key));
+  args.set_value(std::move(value));
+  args.set_op(std::move(op));
+  PutAppendAsync(std::move(args), [done](const raftKVRpcProctoc::PutAppendReply &) { done(); });
+}
+
+raftKVRpcProctoc::PutAppendReply Clerk::PutAppend(raftKVRpcProctoc::PutAppendArgs args) {
+  auto promise = std::make_shared<std::promise<raftKVRpcProctoc::PutAppendReply>>();
+  auto future = promise->get_future();
+  PutAppendAsync(std::move(args), [promise](const raftKVRpcProctoc::PutAppendReply &reply) { promise->set_value(reply); });
+  return future.get();
+}
+
+void Clerk::PutAppendAsync(raftKVRpcProctoc::PutAppendArgs args,
+                           std::function<void(const raftKVRpcProctoc::PutAppendReply &)> done) {
+  auto call = std::make_shared<PutAppendCall>();
+  call->shard = shardOf(args.key());
+  call->args = std::move(args);
+  call->args.set_groupid(call->shard->id);
+  call->args.set_clientid(call->shard->clientId);
+  call->args.set_requestid(beginRequest(call->shard));
+  call->retry.server = *call->shard->recentLeaderId;
+  call->done = std::move(done);
+  sendPutAppend(std::move(call));
+}
+
+void Clerk::sendPutAppend(std::shared_ptr<PutAppendCall> call) {
+  call->reply.Clear();
+  auto* server = m_servers[call->retry.server].get();
+  server->PutAppendAsync(&call->args, &call->reply, [this, call](bool ok) {
+    if (ok && call->reply.err() == ErrSessionExpired) {
+      renewSessionAsync(call->shard, call->args.clientid(), [this, call]() {
+        call->args.set_clientid(call->shard->clientId);
+        sendPutAppend(call);
+      });
+      return;
+    }
+    if (ok && call->reply.err() == ErrWrongGroup) {
+      retryLater(0, [this, call]() { reroute(call, &Clerk::sendPutAppend); });
+      return;
+    }
+    // 原子操作的这几种结果是执行完的结论，重试也一样
+    const std::string &err = call->reply.err();
+    bool final = err == OK || err == ErrNoKey || err == ErrCompareFailed || err == ErrNotInteger ||
+                 err == ErrAlreadyApplied || err == ErrBadRequest;
+    if (!ok || !final) {
+      int before = call->retry.server;
+      int delayMs = nextServer(&call->retry, ok, call->reply.leaderid(), call->reply.leaderterm());
+      DPrintf("【Clerk::PutAppend】原以为的leader：{%d}请求失败，%dms后向新leader{%d}重试  ，操作：{%s}", before, delayMs,
+              call->retry.server, call->args.op().c_str());
+      if (!ok) {
+        DPrintf("重试原因 ，rpc失敗 ，");
+      } else {
+        DPrintf("重試原因：非leader");
+      }
+      retryLater(delayMs, [this, call]() { sendPutAppend(call); });
+      return;
+    }
+    *call->shard->recentLeaderId = call->retry.server;
+    endRequest(call->shard, call->args.requestid());
+    call->done(call->reply);
+  });
+}
+
+void Clerk::PutAsync(std::string key, std::string value, std::function<void()> done) {
+  PutAppendAsync(std::move(key), std::move(value), "Put", std::move(done));
+}
+
+std::future<void> Clerk::PutAsync(std::string key, std::string value) {
+  auto promise = std::make_shared<std::promise<void>>();
+  auto future = promise->get_future();
+  PutAsync(std::move(key), std::move(value), [promise]() { promise->set_value(); });
+  return future;
+}
+
+void Clerk::AppendAsync(std::string key, std::string value, std::function<void()> done) {
+  PutAppendAsync(std::move(key), std::move(value), "Append", std::move(done));
+}
+
+std::future<void> Clerk::AppendAsync(std::string key, std::string value) {
+  auto promise = std::make_shared<std::promise<void>>();
+  auto future = promise->get_future();
+  AppendAsync(std::move(key), std::move(value), [promise]() { promise->set_value(); });
+  return future;
+}
 
+std::vector<std::pair<std::string, std::string>> Clerk::ScanPages(raftKVRpcProctoc::ScanArgs args, int limit) {
+  std::vector<std::pair<std::string, std::string>> result;
+  const std::string &prefix = args.prefix();
+  std::string cursor = prefix.empty() ? args.startkey() : prefix;
+  // 一个组扫到它的范围结束，再从那里找下一个组，依次扫下去结果就是有序的
   while (true) {
-    raftKVRpcProctoc::GetReply reply;
-    bool ok = m_servers[server]->Get(&args, &reply);
-    if (!ok ||
-        reply.err() ==
-            ErrWrongLeader) {  //会一直重试，因为requestId没有改变，因此可能会因为RPC的丢失或者其他情况导致重试，kvserver层来保证不重复执行（线性一致性）
-      server = (server + 1) % m_servers.size();
+    Shard *shard = shardOf(cursor);
+    std::string rangeEnd;
+    if (!scanShard(shard, args, limit, &cursor, &result, &rangeEnd)) {
+      refreshRanges(*shard->recentLeaderId);
       continue;
     }
-    if (reply.err() == ErrNoKey) {
-      return "";
+    if (rangeEnd.empty() || (limit > 0 && result.size() >= limit)) {
+      break;
     }
-    if (reply.err() == OK) {
-      m_recentLeaderId = server;
-      return reply.value();
+    bool past = prefix.empty() ? !args.endkey().empty() && rangeEnd >= args.endkey()
+                               : rangeEnd.compare(0, prefix.size(), prefix) > 0;
+    if (past) {
+      break;
     }
+    cursor = rangeEnd;
   }
-  return "";
+  return result;
 }
 
-void Clerk::PutAppend(std::string key, std::string value, std::string op) {
-  // You will have to modify this function.
-  m_requestId++;
-  auto requestId = m_requestId;
-  auto server = m_recentLeaderId;
+bool Clerk::scanShard(Shard *shard, raftKVRpcProctoc::ScanArgs args, int limit, std::string *cursor,
+                      std::vector<std::pair<std::string, std::string>> *result, std::string *rangeEnd) {
+  args.set_groupid(shard->id);
+  args.set_clientid(shard->clientId);
   while (true) {
-    raftKVRpcProctoc::PutAppendArgs args;
-    args.set_key(key);
-    args.set_value(value);
-    args.set_op(op);
-    args.set_clientid(m_clientId);
+    //每一页都是一个新的请求
+    int requestId = beginRequest(shard);
     args.set_requestid(requestId);
-    raftKVRpcProctoc::PutAppendReply reply;
-    bool ok = m_servers[server]->PutAppend(&args, &reply);
-    if (!ok || reply.err() == ErrWrongLeader) {
-      DPrintf("【Clerk::PutAppend】原以为的leader：{%d}请求失败，向新leader{%d}重试  ，操作：{%s}", server, server + 1,
-              op.c_str());
-      if (!ok) {
-        DPrintf("重试原因 ，rpc失敗 ，");
+    args.set_pagetoken(*cursor);
+    if (limit > 0) {
+      args.set_limit(limit - result->size());
+    }
+    Retry retry{*shard->recentLeaderId};
+    raftKVRpcProctoc::ScanReply reply;
+    while (true) {
+      reply.Clear();
+      bool ok = m_servers[retry.server]->Scan(&args, &reply);
+      if (!ok || reply.err() == ErrWrongLeader) {
+        int delayMs = nextServer(&retry, ok, reply.leaderid(), reply.leaderterm());
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+        continue;
       }
-      if (reply.err() == ErrWrongLeader) {
-        DPrintf("重試原因：非leader");
+      if (reply.err() == OK || reply.err() == ErrWrongGroup) {
+        *shard->recentLeaderId = retry.server;
+        break;
       }
-      server = (server + 1) % m_servers.size();  // try the next server
+    }
+    endRequest(shard, requestId);
+    if (reply.err() == ErrWrongGroup) {
+      return false;
+    }
+    for (const auto& kv : reply.kvs()) {
+      result->emplace_back(kv.key(), kv.value());
+    }
+    *rangeEnd = reply.rangeend();
+    if (reply.nextpagetoken().empty() || (limit > 0 && result->size() >= limit)) {
+      return true;
+    }
+    *cursor = reply.nextpagetoken();
+  }
+}
+
+std::vector<std::pair<std::string, std::string>> Clerk::Scan(std::string start, std::string end, int limit) {
+  raftKVRpcProctoc::ScanArgs args;
+  args.set_startkey(start);
+  args.set_endkey(end);
+  return ScanPages(args, limit);
+}
+
+std::vector<std::pair<std::string, std::string>> Clerk::ScanPrefix(std::string prefix, int limit) {
+  raftKVRpcProctoc::ScanArgs args;
+  args.set_prefix(prefix);
+  return ScanPages(args, limit);
+}
+
+void Clerk::BatchPut(const std::vector<std::pair<std::string, std::string>>& kvs) {
+  std::vector<const std::pair<std::string, std::string>*> pending;
+  for (const auto& kv : kvs) {
+    pending.push_back(&kv);
+  }
+  // 按组拆开，组内保持原来的顺序；范围变了的那些组没有写入，按新的范围表重新拆
+  while (!pending.empty()) {
+    std::vector<std::vector<const std::pair<std::string, std::string>*>> byShard(m_shards.size());
+    for (const auto* kv : pending) {
+      byShard[shardOf(kv->first)->id].push_back(kv);
+    }
+    pending.clear();
+    for (size_t g = 0; g < byShard.size(); ++g) {
+      if (!byShard[g].empty() && !batchPutShard(m_shards[g].get(), byShard[g])) {
+        pending.insert(pending.end(), byShard[g].begin(), byShard[g].end());
+        refreshRanges(*m_shards[g]->recentLeaderId);
+      }
+    }
+  }
+}
+
+bool Clerk::batchPutShard(Shard *shard, const std::vector<const std::pair<std::string, std::string>*>& kvs) {
+  int requestId = beginRequest(shard);
+  raftKVRpcProctoc::BatchPutArgs args;
+  for (const auto* kv : kvs) {
+    auto* op = args.add_ops();
+    op->set_key(kv->first);
+    op->set_value(kv->second);
+  }
+  args.set_groupid(shard->id);
+  args.set_clientid(shard->clientId);
+  args.set_requestid(requestId);
+  Retry retry{*shard->recentLeaderId};
+  while (true) {
+    raftKVRpcProctoc::BatchPutReply reply;
+    bool ok = m_servers[retry.server]->BatchPut(&args, &reply);
+    if (ok && reply.err() == ErrSessionExpired) {
+      renewSession(shard, args.clientid());
+      args.set_clientid(shard->clientId);
       continue;
     }
-    if (reply.err() == OK) {  //什么时候reply errno为ok呢？？？
-      m_recentLeaderId = server;
-      return;
+    if (!ok || reply.err() == ErrWrongLeader) {
+      int delayMs = nextServer(&retry, ok, reply.leaderid(), reply.leaderterm());
+      std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+      continue;
+    }
+    if (reply.err() == OK) {
+      *shard->recentLeaderId = retry.server;
     }
+    endRequest(shard, requestId);
+    return reply.err() != ErrWrongGroup;
   }
 }
 
+std::vector<std::string> Clerk::BatchGet(const std::vector<std::string>& keys, std::vector<bool>* found) {
+  std::vector<std::string> values(keys.size());
+  if (found != nullptr) {
+    found->assign(keys.size(), false);
+  }
+  std::vector<int> pending(keys.size());
+  for (int i = 0; i < keys.size(); ++i) {
+    pending[i] = i;
+  }
+  while (!pending.empty()) {
+    std::vector<std::vector<std::string>> byShard(m_shards.size());
+    std::vector<std::vector<int>> indexes(m_shards.size());
+    for (int i : pending) {
+      int g = shardOf(keys[i])->id;
+      byShard[g].push_back(keys[i]);
+      indexes[g].push_back(i);
+    }
+    pending.clear();
+    for (size_t g = 0; g < byShard.size(); ++g) {
+      if (!byShard[g].empty() && !batchGetShard(m_shards[g].get(), byShard[g], indexes[g], &values, found)) {
+        pending.insert(pending.end(), indexes[g].begin(), indexes[g].end());
+        refreshRanges(*m_shards[g]->recentLeaderId);
+      }
+    }
+  }
+  return values;
+}
+
+bool Clerk::batchGetShard(Shard *shard, const std::vector<std::string>& keys, const std::vector<int>& indexes,
+                          std::vector<std::string>* values, std::vector<bool>* found) {
+  int requestId = beginRequest(shard);
+  raftKVRpcProctoc::BatchGetArgs args;
+  for (const auto& key : keys) {
+    args.add_keys(key);
+  }
+  args.set_groupid(shard->id);
+  args.set_clientid(shard->clientId);
+  args.set_requestid(requestId);
+  Retry retry{*shard->recentLeaderId};
+  raftKVRpcProctoc::BatchGetReply reply;
+  while (true) {
+    reply.Clear();
+    bool ok = m_servers[retry.server]->BatchGet(&args, &reply);
+    if (!ok || reply.err() == ErrWrongLeader) {
+      int delayMs = nextServer(&retry, ok, reply.leaderid(), reply.leaderterm());
+      std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+      continue;
+    }
+    if (reply.err() == OK || reply.err() == ErrWrongGroup) {
+      *shard->recentLeaderId = retry.server;
+      break;
+    }
+  }
+  endRequest(shard, requestId);
+  if (reply.err() == ErrWrongGroup) {
+    return false;
+  }
+  for (int i = 0; i < reply.results_size(); ++i) {
+    (*values)[indexes[i]] = reply.results(i).value();
+    if (found != nullptr) {
+      (*found)[indexes[i]] = reply.results(i).err() == OK;
+    }
+  }
+  return true;
+}
+
+bool Clerk::TransferLeader(int server, int groupId, int target) {
+  if (server < 0 || server >= static_cast<int>(m_servers.size())) {
+    return false;
+  }
+  raftKVRpcProctoc::TransferLeaderArgs args;
+  args.set_groupid(groupId);
+  args.set_target(target);
+  raftKVRpcProctoc::TransferLeaderReply reply;
+  return m_servers[server]->TransferLeader(&args, &reply) && reply.err() == OK;
+}
+
+bool Clerk::ChangeMembership(int kind, int nodeId, const std::string& ip, int port) {
+  bool allOk = true;
+  for (auto& shard : m_shards) {
+    raftKVRpcProctoc::ChangeMembershipArgs args;
+    args.set_groupid(shard->id);
+    args.set_kind(kind);
+    args.set_nodeid(nodeId);
+    args.set_ip(ip);
+    args.set_port(port);
+    Retry retry{*shard->recentLeaderId};
+    std::string err;
+    // 找leader、等上一次变更提交都在这里重试，几轮之后还不成功就交给调用者
+    for (int attempt = 0; attempt < CLERK_ADMIN_RETRY_ROUNDS * static_cast<int>(m_servers.size()); ++attempt) {
+      raftKVRpcProctoc::ChangeMembershipReply reply;
+      bool ok = m_servers[retry.server]->ChangeMembership(&args, &reply);
+      err = ok ? reply.err() : ErrWrongLeader;
+      if (err == OK || err == ErrBadRequest || err == ErrWrongGroup) {
+        break;
+      }
+      if (err == ErrMembershipBusy) {
+        // 找对了leader，等上一次变更提交或者learner追上日志
+        std::this_thread::sleep_for(std::chrono::milliseconds(CLERK_RETRY_BACKOFF_MAX_MS));
+        continue;
+      }
+      int delayMs = nextServer(&retry, ok, reply.leaderid(), reply.leaderterm());
+      std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+    }
+    if (err == OK) {
+      *shard->recentLeaderId = retry.server;
+    } else {
+      DPrintf("【Clerk::ChangeMembership】group{%d} kind{%d} node{%d} failed: %s", shard->id, kind, nodeId, err.c_str());
+      allOk = false;
+    }
+  }
+  return allOk;
+}
+
 void Clerk::Put(std::string key, std::string value) { PutAppend(key, value, "Put"); }
 
 void Clerk::Append(std::string key, std::string value) { PutAppend(key, value, "Append"); }
+
+bool Clerk::CompareAndSwap(std::string key, const std::string *expected, std::string value, std::string *current) {
+  raftKVRpcProctoc::PutAppendArgs args;
+  args.set_op("CompareAndSwap");
+  args.set_key(key);
+  args.set_value(value);
+  args.set_expectabsent(expected == nullptr);
+  if (expected != nullptr) {
+    args.set_expected(*expected);
+  }
+  std::lock_guard<std::mutex> lk(m_atomicMtx);
+  auto reply = PutAppend(std::move(args));
+  bool swapped = reply.err() == OK;
+  if (current != nullptr) {
+    *current = swapped ? value : reply.value();
+  }
+  return swapped;
+}
+
+bool Clerk::Increment(std::string key, int64_t delta, int64_t *result) {
+  raftKVRpcProctoc::PutAppendArgs args;
+  args.set_op("Increment");
+  args.set_key(key);
+  args.set_delta(delta);
+  std::lock_guard<std::mutex> lk(m_atomicMtx);
+  auto reply = PutAppend(std::move(args));
+  if (reply.err() != OK) {
+    return false;
+  }
+  if (result != nullptr) {
+    *result = strtoll(reply.value().c_str(), nullptr, 10);
+  }
+  return true;
+}
 //初始化客户端
 void Clerk::Init(std::string configFileName) {
   //获取所有raft节点ip、port ，并进行连接
@@ -91,13 +690,37 @@ void Clerk::Init(std::string configFileName) {
     ipPortVt.emplace_back(nodeIp, atoi(nodePortStr.c_str()));  //沒有atos方法，可以考慮自己实现
   }
   //进行连接
+  std::string cluster;
   for (const auto& item : ipPortVt) {
     std::string ip = item.first;
     short port = item.second;
+    cluster += ip + ":" + std::to_string(port) + ",";
     // 2024-01-04 todo：bug fix
     auto* rpc = new raftServerRpcUtil(ip, port);
     m_servers.push_back(std::shared_ptr<raftServerRpcUtil>(rpc));
   }
+  m_ranges.Load(config);
+  for (int g = 0; g < m_ranges.groups(); ++g) {
+    auto shard = std::make_unique<Shard>();
+    shard->id = g;
+    m_shards.push_back(std::move(shard));
+  }
+  // 新建的clerk直接从别的clerk找到的leader开始，不用再探测一遍
+  static std::mutex leadersMtx;
+  static std::unordered_map<std::string, std::shared_ptr<std::atomic<int>>> leaders;
+  {
+    std::lock_guard<std::mutex> lock(leadersMtx);
+    for (auto& shard : m_shards) {
+      auto& leader = leaders[cluster + "#" + std::to_string(shard->id)];
+      if (!leader) {
+        leader = std::make_shared<std::atomic<int>>(0);
+      }
+      shard->recentLeaderId = leader;
+    }
+  }
+  for (auto& shard : m_shards) {
+    renewSession(shard.get(), 0);
+  }
 }
 
-Clerk::Clerk() : m_clientId(Uuid()), m_requestId(0), m_recentLeaderId(0) {}
+Clerk::Clerk() : m_followerRead(false), m_maxStalenessMs(0), m_nextReadServer(0) {}
@@ -10,33 +10,161 @@
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <atomic>
 #include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
 #include <string>
 #include <vector>
+#include "keyRange.h"
 #include "kvServerRPC.pb.h"
 #include "mprpcconfig.h"
+// 可以被多个线程同时使用，也可以用异步接口同时发出多个请求
+// key空间按配置文件里的范围表分给多个raft组，每个请求按key发给它所在的组，见KeyRangeTable
+// 范围会在kvserver上分裂、合并，请求收到ErrWrongGroup时从kvserver拉取新的范围表，换到新的组重发
 class Clerk {
  private:
+  struct GetCall;
+  struct PutAppendCall;
+  struct RegisterCall;
+  // 一个请求的重试状态
+  struct Retry {
+    int server;
+    int attempts = 0;
+    int backoffMs = CLERK_RETRY_BACKOFF_MIN_MS;
+    int leaderTerm = 0;  // 已经跟随过的最新leader提示的term
+  };
+  // 一个raft组在clerk这边的状态，session、requestId和leader都是各组独立的
+  struct Shard {
+    int id;
+    // 只是有可能是领导，同一个进程里连接同一个集群同一个组的clerk共用，见Init
+    std::shared_ptr<std::atomic<int>> recentLeaderId;
+    // RegisterClient得到的session id，过期之后换新的
+    std::atomic<uint64_t> clientId{0};
+    // 同一时间只有一个注册在进行，期间要用新session的请求登记在sessionWaiters里，注册成功后一起继续
+    std::mutex sessionMtx;
+    bool registering = false;
+    std::vector<std::function<void()>> sessionWaiters;
+    // 在途请求的requestId，最新和最旧的差不能达到KV_DEDUP_WINDOW，否则kvserver会把旧的当成重复请求
+    std::mutex mtx;
+    std::condition_variable inflightCv;
+    int requestId = 0;
+    std::set<int> inflight;
+    // IO线程里等窗口的请求（reroute），endRequest腾出位置时先分给它们，再唤醒阻塞在beginRequest里的线程
+    std::deque<std::function<void(int)>> admitQueue;
+
+    // 调用前持有mtx
+    bool hasRoom() const { return inflight.empty() || requestId + 1 - *inflight.begin() < KV_DEDUP_WINDOW; }
+  };
+
   std::vector<std::shared_ptr<raftServerRpcUtil>>
       m_servers;  //保存所有raft节点的fd //todo：全部初始化为-1，表示没有连接上
-  std::string m_clientId;
-  int m_requestId;
-  int m_recentLeaderId;  //只是有可能是领导
+  std::shared_mutex m_rangesMtx;  // 保护m_ranges，范围表刷新时整体替换
+  KeyRangeTable m_ranges;
+  std::vector<std::unique_ptr<Shard>> m_shards;  // 下标就是组号
+  // follower读：Get轮流发给所有节点，m_maxStalenessMs>0时允许读这么多毫秒以内的旧数据
+  // 在发出请求之前设置好，之后不要再改
+  bool m_followerRead;
+  int m_maxStalenessMs;
+  std::atomic<int> m_nextReadServer;
+  // 原子操作一个一个地发：kvserver的session只留最后一个原子操作的结果，重试的请求才一定能拿到自己的结果
+  std::mutex m_atomicMtx;
 
-  std::string Uuid() {
-    return std::to_string(rand()) + std::to_string(rand()) + std::to_string(rand()) + std::to_string(rand());
-  }  //用于返回随机的clientId
+  // key现在所在的组，范围正在迁移、落在空隙里时返回-1
+  int groupOf(const std::string &key);
+  // 同步接口用：落在空隙里时刷新范围表并等一会儿再找，直到找到
+  Shard *shardOf(const std::string &key);
+  // 从server拉取当前的范围表，失败时保持原样
+  void refreshRanges(int server);
+  // 异步版本，IO线程里用，拉取结束（不管成功与否）后在IO线程里调用done
+  void refreshRangesAsync(int server, std::function<void()> done);
+  void applyRanges(const raftKVRpcProctoc::GetRangesReply &reply);
+  // 异步请求收到ErrWrongGroup之后：刷新范围表，在新的组里用新的requestId重发
+  template <typename Call>
+  void reroute(std::shared_ptr<Call> call, void (Clerk::*send)(std::shared_ptr<Call>));
+  // 服务端回复ErrSessionExpired时调用，expiredId还是当前的session才重新注册；阻塞到有了新的session，不能在IO线程里用
+  void renewSession(Shard *shard, uint64_t expiredId);
+  // 不阻塞的版本，IO线程里用：有了新的session之后在IO线程里调用done，注册失败时换节点一直重试
+  void renewSessionAsync(Shard *shard, uint64_t expiredId, std::function<void()> done);
+  void sendRegister(Shard *shard, std::shared_ptr<RegisterCall> call);
+  // 分配新的requestId，在途请求的跨度到了窗口大小时阻塞，直到最旧的请求完成；不能在IO线程里用
+  int beginRequest(Shard *shard);
+  // 不阻塞的版本，IO线程里用：窗口有位置时立即调用admit，否则排队，endRequest腾出位置时在IO线程里调用
+  void beginRequestAsync(Shard *shard, std::function<void(int)> admit);
+  void endRequest(Shard *shard, int requestId);
+  // 发送一次，失败或者找错了leader就在rpc客户端的IO线程里换一个节点重发，直到成功
+  void sendGet(std::shared_ptr<GetCall> call);
+  void sendPutAppend(std::shared_ptr<PutAppendCall> call);
+  // 请求没成功时选下一个节点：回复里有不旧的leader提示就直接去找它，否则换下一个
+  // 每试过一轮节点退避一次，返回重发之前要等的毫秒数
+  int nextServer(Retry* retry, bool ok, int leaderId, int leaderTerm);
+  // 在rpc客户端的IO线程里重发，立即失败时回调就在发送的调用栈里，这样也不会递归
+  static void retryLater(int delayMs, std::function<void()> fn);
 
   //    MakeClerk  todo
   void PutAppend(std::string key, std::string value, std::string op);
+  void PutAppendAsync(std::string key, std::string value, std::string op, std::function<void()> done);
+  // 原子操作要回复里的结果；Err是执行完的结论（OK、ErrCompareFailed等）之前一直重试
+  raftKVRpcProctoc::PutAppendReply PutAppend(raftKVRpcProctoc::PutAppendArgs args);
+  void PutAppendAsync(raftKVRpcProctoc::PutAppendArgs args,
+                      std::function<void(const raftKVRpcProctoc::PutAppendReply &)> done);
+  // 依次扫描和[start, end)有交集的组，每个组按页拉取，直到扫完或者凑够limit条（limit<=0表示不限）
+  std::vector<std::pair<std::string, std::string>> ScanPages(raftKVRpcProctoc::ScanArgs args, int limit);
+  // 在一个组里从*cursor开始按页拉取，结果追加到result，*rangeEnd是这个组的范围的结束位置
+  // 组不再负责*cursor时返回false，*cursor停在还没有拉取的位置
+  bool scanShard(Shard *shard, raftKVRpcProctoc::ScanArgs args, int limit, std::string *cursor,
+                 std::vector<std::pair<std::string, std::string>> *result, std::string *rangeEnd);
+  // 同一个组的kvs作为一条日志写入，key已经不在这个组里时什么都没写，返回false
+  bool batchPutShard(Shard *shard, const std::vector<const std::pair<std::string, std::string> *> &kvs);
+  // 读同一个组的一批key，结果写到values和found里keys对应的下标，key已经不在这个组里时返回false
+  bool batchGetShard(Shard *shard, const std::vector<std::string> &keys, const std::vector<int> &indexes,
+                     std::vector<std::string> *values, std::vector<bool> *found);
 
  public:
   //对外暴露的三个功能和初始化
   void Init(std::string configFileName);
   std::string Get(std::string key);
+  // 打开之后Get不再只找leader，读压力分摊到所有节点；maxStalenessMs为0时仍然是线性一致读
+  void SetFollowerRead(bool enable, int maxStalenessMs = 0);
 
   void Put(std::string key, std::string value);
   void Append(std::string key, std::string value);
+  // 在服务端原子执行的读改写，只要一次共识，多个client并发也不会丢更新
+  // key的值等于*expected时（expected为nullptr表示要求key不存在）换成value并返回true；
+  // 否则返回false，current不为空时记录当前值（key不存在时为空串）；不知道重试之前那次的结果时也返回false
+  bool CompareAndSwap(std::string key, const std::string *expected, std::string value, std::string *current = nullptr);
+  // 把key的值当作十进制的int64加上delta，key不存在时从0开始，result记录加之后的值；值不是整数或者会溢出时返回false
+  bool Increment(std::string key, int64_t delta, int64_t *result = nullptr);
+
+  // 异步接口立即返回，可以同时有多个请求在途，同一个client的请求之间不保证执行顺序
+  // 回调在rpc客户端的IO线程里执行，回调里不要调用同步接口；在途请求太多时异步接口本身也会阻塞
+  void GetAsync(std::string key, std::function<void(std::string)> done);
+  std::future<std::string> GetAsync(std::string key);
+  void PutAsync(std::string key, std::string value, std::function<void()> done);
+  std::future<void> PutAsync(std::string key, std::string value);
+  void AppendAsync(std::string key, std::string value, std::function<void()> done);
+  std::future<void> AppendAsync(std::string key, std::string value);
+  // 返回[start, end)内有序的kv，end为空表示扫到末尾
+  std::vector<std::pair<std::string, std::string>> Scan(std::string start, std::string end, int limit = 0);
+  std::vector<std::pair<std::string, std::string>> ScanPrefix(std::string prefix, int limit = 0);
+  // 同一个组里的kv作为一条日志写入，要么全部生效要么都不生效；跨组的batch在各组分别生效
+  void BatchPut(const std::vector<std::pair<std::string, std::string>>& kvs);
+  // 结果与keys一一对应，不存在的key返回空串，found不为空时记录每个key是否存在；同一个组里的key读到的是同一个状态
+  std::vector<std::string> BatchGet(const std::vector<std::string>& keys, std::vector<bool>* found = nullptr);
+
+  // 运维接口：让第server个节点交出领导权，groupId小于0表示它领导的所有组，target小于0表示由leader挑选
+  // 滚动重启时先对要重启的节点调用，返回true之后再停掉它，切换只花一次选举的时间而不用等选举超时
+  bool TransferLeader(int server, int groupId = -1, int target = -1);
+  // 运维接口：在所有组里做同一个成员变更，kind见util.h里的AddLearner等，ip和port只有AddLearner需要
+  // 换机器时先AddLearner，等它追上日志之后PromoteLearner，最后RemoveMember旧的节点，每一步返回true之后再做下一步
+  // 有组没有成功时返回false，已经成功的组再做一次也会返回成功，可以整体重试
+  bool ChangeMembership(int kind, int nodeId, const std::string& ip = "", int port = 0);
 
  public:
   Clerk();
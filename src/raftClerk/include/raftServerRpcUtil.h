@@ -5,6 +5,7 @@
 #ifndef RAFTSERVERRPC_H
 #define RAFTSERVERRPC_H
 
+#include <functional>
 #include <iostream>
 #include "kvServerRPC.pb.h"
 #include "mprpcchannel.h"
@@ -23,6 +24,23 @@ class raftServerRpcUtil {
   //响应其他节点的方法
   bool Get(raftKVRpcProctoc::GetArgs* GetArgs, raftKVRpcProctoc::GetReply* reply);
   bool PutAppend(raftKVRpcProctoc::PutAppendArgs* args, raftKVRpcProctoc::PutAppendReply* reply);
+  bool Scan(raftKVRpcProctoc::ScanArgs* args, raftKVRpcProctoc::ScanReply* reply);
+  bool BatchPut(raftKVRpcProctoc::BatchPutArgs* args, raftKVRpcProctoc::BatchPutReply* reply);
+  bool BatchGet(raftKVRpcProctoc::BatchGetArgs* args, raftKVRpcProctoc::BatchGetReply* reply);
+  bool RegisterClient(raftKVRpcProctoc::RegisterClientArgs* args, raftKVRpcProctoc::RegisterClientReply* reply);
+  bool GetRanges(raftKVRpcProctoc::GetRangesArgs* args, raftKVRpcProctoc::GetRangesReply* reply);
+  bool TransferLeader(raftKVRpcProctoc::TransferLeaderArgs* args, raftKVRpcProctoc::TransferLeaderReply* reply);
+  bool ChangeMembership(raftKVRpcProctoc::ChangeMembershipArgs* args, raftKVRpcProctoc::ChangeMembershipReply* reply);
+
+  // 异步版本立即返回，rpc结束后在rpc客户端的IO线程里调用done(rpc是否成功)，args和reply要活到done被调用
+  void GetAsync(const raftKVRpcProctoc::GetArgs* args, raftKVRpcProctoc::GetReply* reply,
+                std::function<void(bool)> done);
+  void PutAppendAsync(const raftKVRpcProctoc::PutAppendArgs* args, raftKVRpcProctoc::PutAppendReply* reply,
+                      std::function<void(bool)> done);
+  void RegisterClientAsync(const raftKVRpcProctoc::RegisterClientArgs* args,
+                           raftKVRpcProctoc::RegisterClientReply* reply, std::function<void(bool)> done);
+  void GetRangesAsync(const raftKVRpcProctoc::GetRangesArgs* args, raftKVRpcProctoc::GetRangesReply* reply,
+                      std::function<void(bool)> done);
 
   raftServerRpcUtil(std::string ip, short port);
   ~raftServerRpcUtil();
@@ -2,6 +2,27 @@
 // Created by swx on 24-1-4.
 //
 #include "raftServerRpcUtil.h"
+#include "config.h"
+#include "logger.h"
+
+namespace {
+// 一次异步调用的controller，回调执行完之后删除自己
+class AsyncCall : public google::protobuf::Closure {
+ public:
+  explicit AsyncCall(std::function<void(bool)> done) : m_done(std::move(done)) {
+    controller.SetTimeout(CLERK_RPC_TIMEOUT_MS);
+  }
+  void Run() override {
+    m_done(!controller.Failed());
+    delete this;
+  }
+
+  MprpcController controller;
+
+ private:
+  std::function<void(bool)> m_done;
+};
+}  // namespace
 
 // kvserver不同于raft节点之间，kvserver的rpc是用于clerk向kvserver调用，不会被调用，因此只用写caller功能，不用写callee功能
 //先开启服务器，再尝试连接其他的节点，中间给一个间隔时间，等待其他的rpc服务器节点启动
@@ -10,22 +31,103 @@ raftServerRpcUtil::raftServerRpcUtil(std::string ip, short port) {
   // 接收rpc设置
   //*********************************************  */
   //发送rpc设置
-  stub = new raftKVRpcProctoc::kvServerRpc_Stub(new MprpcChannel(ip, port, false));
+  stub = new raftKVRpcProctoc::kvServerRpc_Stub(new MprpcChannel(ip, port, false, true));
 }
 
 raftServerRpcUtil::~raftServerRpcUtil() { delete stub; }
 
 bool raftServerRpcUtil::Get(raftKVRpcProctoc::GetArgs *GetArgs, raftKVRpcProctoc::GetReply *reply) {
   MprpcController controller;
+  controller.SetTimeout(CLERK_RPC_TIMEOUT_MS);
   stub->Get(&controller, GetArgs, reply, nullptr);
   return !controller.Failed();
 }
 
 bool raftServerRpcUtil::PutAppend(raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply) {
   MprpcController controller;
+  controller.SetTimeout(CLERK_RPC_TIMEOUT_MS);
   stub->PutAppend(&controller, args, reply, nullptr);
   if (controller.Failed()) {
-    std::cout << controller.ErrorText() << endl;
+    LOG_WARN("PutAppend rpc failed: %s", controller.ErrorText().c_str());
   }
   return !controller.Failed();
 }
+
+bool raftServerRpcUtil::GetRanges(raftKVRpcProctoc::GetRangesArgs *args, raftKVRpcProctoc::GetRangesReply *reply) {
+  MprpcController controller;
+  controller.SetTimeout(CLERK_RPC_TIMEOUT_MS);
+  stub->GetRanges(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::TransferLeader(raftKVRpcProctoc::TransferLeaderArgs *args,
+                                       raftKVRpcProctoc::TransferLeaderReply *reply) {
+  MprpcController controller;
+  // 要等目标追上日志
+  controller.SetTimeout(CLERK_RPC_TIMEOUT_MS + RAFT_LEAD_TRANSFER_TIMEOUT_MS);
+  stub->TransferLeader(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::ChangeMembership(raftKVRpcProctoc::ChangeMembershipArgs *args,
+                                         raftKVRpcProctoc::ChangeMembershipReply *reply) {
+  MprpcController controller;
+  // 要等配置日志提交
+  controller.SetTimeout(CLERK_RPC_TIMEOUT_MS + CONSENSUS_TIMEOUT);
+  stub->ChangeMembership(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::Scan(raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply) {
+  MprpcController controller;
+  controller.SetTimeout(CLERK_RPC_TIMEOUT_MS);
+  stub->Scan(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::BatchPut(raftKVRpcProctoc::BatchPutArgs *args, raftKVRpcProctoc::BatchPutReply *reply) {
+  MprpcController controller;
+  controller.SetTimeout(CLERK_RPC_TIMEOUT_MS);
+  stub->BatchPut(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::BatchGet(raftKVRpcProctoc::BatchGetArgs *args, raftKVRpcProctoc::BatchGetReply *reply) {
+  MprpcController controller;
+  controller.SetTimeout(CLERK_RPC_TIMEOUT_MS);
+  stub->BatchGet(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+bool raftServerRpcUtil::RegisterClient(raftKVRpcProctoc::RegisterClientArgs *args,
+                                       raftKVRpcProctoc::RegisterClientReply *reply) {
+  MprpcController controller;
+  controller.SetTimeout(CLERK_RPC_TIMEOUT_MS);
+  stub->RegisterClient(&controller, args, reply, nullptr);
+  return !controller.Failed();
+}
+
+void raftServerRpcUtil::GetAsync(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetReply *reply,
+                                 std::function<void(bool)> done) {
+  auto *call = new AsyncCall(std::move(done));
+  stub->Get(&call->controller, args, reply, call);
+}
+
+void raftServerRpcUtil::PutAppendAsync(const raftKVRpcProctoc::PutAppendArgs *args,
+                                       raftKVRpcProctoc::PutAppendReply *reply, std::function<void(bool)> done) {
+  auto *call = new AsyncCall(std::move(done));
+  stub->PutAppend(&call->controller, args, reply, call);
+}
+
+void raftServerRpcUtil::RegisterClientAsync(const raftKVRpcProctoc::RegisterClientArgs *args,
+                                            raftKVRpcProctoc::RegisterClientReply *reply,
+                                            std::function<void(bool)> done) {
+  auto *call = new AsyncCall(std::move(done));
+  stub->RegisterClient(&call->controller, args, reply, call);
+}
+
+void raftServerRpcUtil::GetRangesAsync(const raftKVRpcProctoc::GetRangesArgs *args,
+                                       raftKVRpcProctoc::GetRangesReply *reply, std::function<void(bool)> done) {
+  auto *call = new AsyncCall(std::move(done));
+  stub->GetRanges(&call->controller, args, reply, call);
+}
@@ -2,120 +2,823 @@
 // Created by swx on 23-5-30.
 //
 #include "Persister.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include "config.h"
+#include "metrics.h"
+#include "snapshotCodec.h"
 #include "util.h"
 
-// todo:会涉及反复打开文件的操作，没有考虑如果文件出现问题会怎么办？？
-void Persister::Save(const std::string raftstate, const std::string snapshot) {
+// 日志记录：fixed32 bodyLen | fixed32 crc32(body) | body
+// 组0的body：char type | fixed32 index | payload
+// 其他组的body：char type | fixed32 group | fixed32 index | payload
+namespace {
+constexpr char WAL_RECORD_ENTRY = 1;
+constexpr char WAL_RECORD_TRUNCATE = 2;
+constexpr char WAL_RECORD_GROUP_ENTRY = 3;
+constexpr char WAL_RECORD_GROUP_TRUNCATE = 4;
+constexpr size_t WAL_RECORD_HEADER_SIZE = 8;
+constexpr size_t WAL_BODY_HEADER_SIZE = 5;
+constexpr size_t WAL_GROUP_BODY_HEADER_SIZE = 9;
+
+const char META_MAGIC[4] = {'R', 'F', 'M', '1'};
+const char SNAPSHOT_MAGIC[4] = {'R', 'F', 'S', '1'};
+// magic | fixed32 lastIncludedIndex | fixed32 lastIncludedTerm | fixed32 crc32(快照内容)
+constexpr size_t SNAPSHOT_FILE_HEADER_SIZE = sizeof(SNAPSHOT_MAGIC) + 12;
+// 快照内容以它开头时，前面带着快照点的成员配置：magic | fixed32 len | Membership | 上层的快照
+// 上层的快照不会以它开头，没有带配置的旧快照照常读取
+const char SNAPSHOT_CONFIG_MAGIC[4] = {'R', 'F', 'C', '1'};
+
+// 快照内容开头的成员配置，返回配置部分的长度（上层的快照从这里开始），没有带配置时为0
+size_t splitSnapshot(const char *content, size_t len, std::string *membership) {
+  membership->clear();
+  size_t headerSize = sizeof(SNAPSHOT_CONFIG_MAGIC) + 4;
+  if (len < headerSize || memcmp(content, SNAPSHOT_CONFIG_MAGIC, sizeof(SNAPSHOT_CONFIG_MAGIC)) != 0) {
+    return 0;
+  }
+  size_t configLen = DecodeFixed32(content + sizeof(SNAPSHOT_CONFIG_MAGIC));
+  if (len - headerSize < configLen) {
+    return 0;
+  }
+  membership->assign(content + headerSize, configLen);
+  return headerSize + configLen;
+}
+
+bool readWholeFile(const std::string &path, std::string *data) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  data->clear();
+  char buf[64 * 1024];
+  while (true) {
+    ssize_t n = ::read(fd, buf, sizeof(buf));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      break;
+    }
+    data->append(buf, n);
+  }
+  ::close(fd);
+  return true;
+}
+
+void writeAll(int fd, const char *data, size_t len) {
+  while (len > 0) {
+    ssize_t n = ::write(fd, data, len);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    myAssert(n > 0, format("[func-Persister] write failed: %s", strerror(errno)));
+    data += n;
+    len -= n;
+  }
+}
+
+void pwriteAll(int fd, const char *data, size_t len, off_t offset) {
+  while (len > 0) {
+    ssize_t n = ::pwrite(fd, data, len, offset);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    myAssert(n > 0, format("[func-Persister] pwrite failed: %s", strerror(errno)));
+    data += n;
+    len -= n;
+    offset += n;
+  }
+}
+
+// 读满len个字节，文件提前结束或者出错返回false
+bool preadAll(int fd, char *data, size_t len, off_t offset) {
+  while (len > 0) {
+    ssize_t n = ::pread(fd, data, len, offset);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    len -= n;
+    offset += n;
+  }
+  return true;
+}
+
+// 读出快照文件头，返回快照内容的长度，文件不是快照时返回-1
+long long readSnapshotHeader(int fd, int *lastIncludedIndex, int *lastIncludedTerm, uint32_t *crc) {
+  char header[SNAPSHOT_FILE_HEADER_SIZE];
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || !preadAll(fd, header, sizeof(header), 0) ||
+      memcmp(header, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+    return -1;
+  }
+  *lastIncludedIndex = static_cast<int>(DecodeFixed32(header + 4));
+  *lastIncludedTerm = static_cast<int>(DecodeFixed32(header + 8));
+  *crc = DecodeFixed32(header + 12);
+  return st.st_size - static_cast<long long>(SNAPSHOT_FILE_HEADER_SIZE);
+}
+
+void syncDir(const std::string &dir) {
+  int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+  if (fd >= 0) {
+    ::fsync(fd);
+    ::close(fd);
+  }
+}
+
+// 写临时文件再rename，读到的要么是旧文件要么是完整的新文件
+void writeFileAtomically(const std::string &dir, const std::string &path, const std::string &data) {
+  std::string tmp = path + ".tmp";
+  int fd = ::open(tmp.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+  myAssert(fd >= 0, format("[func-Persister] open %s failed: %s", tmp.c_str(), strerror(errno)));
+  writeAll(fd, data.data(), data.size());
+  if (PERSIST_FSYNC) {
+    ::fdatasync(fd);
+  }
+  ::close(fd);
+  myAssert(::rename(tmp.c_str(), path.c_str()) == 0,
+           format("[func-Persister] rename %s failed: %s", tmp.c_str(), strerror(errno)));
+  if (PERSIST_FSYNC) {
+    // rename本身也要落盘
+    syncDir(dir);
+  }
+}
+
+size_t bodyHeaderSize(int group) { return group == 0 ? WAL_BODY_HEADER_SIZE : WAL_GROUP_BODY_HEADER_SIZE; }
+
+// 一条日志条目在文件中的大小
+int walRecordSize(int group, size_t payloadSize) {
+  return static_cast<int>(WAL_RECORD_HEADER_SIZE + bodyHeaderSize(group) + payloadSize);
+}
+
+void appendRecordTo(std::string *out, int group, bool entry, int index, const std::string &payload) {
+  std::string body;
+  body.reserve(bodyHeaderSize(group) + payload.size());
+  if (group == 0) {
+    body.push_back(entry ? WAL_RECORD_ENTRY : WAL_RECORD_TRUNCATE);
+  } else {
+    body.push_back(entry ? WAL_RECORD_GROUP_ENTRY : WAL_RECORD_GROUP_TRUNCATE);
+    PutFixed32(&body, static_cast<uint32_t>(group));
+  }
+  PutFixed32(&body, static_cast<uint32_t>(index));
+  body.append(payload);
+  PutFixed32(out, static_cast<uint32_t>(body.size()));
+  PutFixed32(out, Crc32(body.data(), body.size()));
+  out->append(body);
+}
+}  // namespace
+
+void Persister::SaveHardState(int currentTerm, int votedFor) {
   std::lock_guard<std::mutex> lg(m_mtx);
-  clearRaftStateAndSnapshot();
-  // 将raftstate和snapshot写入本地文件
-  m_raftStateOutStream << raftstate;
-  m_snapshotOutStream << snapshot;
+  std::string data(META_MAGIC, sizeof(META_MAGIC));
+  PutFixed32(&data, static_cast<uint32_t>(currentTerm));
+  PutFixed32(&data, static_cast<uint32_t>(votedFor));
+  PutFixed32(&data, Crc32(data.data(), data.size()));
+  writeFileAtomically(m_dir, m_dir + "/meta", data);
 }
 
-std::string Persister::ReadSnapshot() {
+void Persister::AppendLog(int index, const std::string &entry) {
   std::lock_guard<std::mutex> lg(m_mtx);
-  if (m_snapshotOutStream.is_open()) {
-    m_snapshotOutStream.close();
+  appendLogLocked(index, entry);
+}
+
+void Persister::AppendLogs(int firstIndex, const std::vector<std::string> &entries) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  dropFrom(firstIndex);
+  std::vector<int> sizes;
+  m_wal->AppendEntries(m_group, firstIndex, entries, &sizes);
+  if (m_entrySizes.empty()) {
+    m_entrySizesFirstIndex = firstIndex;
   }
+  for (int size : sizes) {
+    m_entrySizes.push_back(size);
+    m_raftStateSize += size;
+  }
+}
 
-  DEFER {
-    m_snapshotOutStream.open(m_snapshotFileName);  //默认是追加
-  };
-  std::fstream ifs(m_snapshotFileName, std::ios_base::in);
-  if (!ifs.good()) {
-    return "";
+void Persister::appendLogLocked(int index, const std::string &entry) {
+  // 覆盖写：回放时index不大于上一条的记录会替换掉它及之后的日志
+  dropFrom(index);
+  if (m_entrySizes.empty()) {
+    m_entrySizesFirstIndex = index;
   }
-  std::string snapshot;
-  ifs >> snapshot;
-  ifs.close();
-  return snapshot;
+  int recordSize = m_wal->AppendEntry(m_group, index, entry);
+  m_entrySizes.push_back(recordSize);
+  m_raftStateSize += recordSize;
 }
 
-void Persister::SaveRaftState(const std::string &data) {
+void Persister::TruncateSuffix(int fromIndex) {
   std::lock_guard<std::mutex> lg(m_mtx);
-  // 将raftstate和snapshot写入本地文件
-  clearRaftState();
-  m_raftStateOutStream << data;
-  m_raftStateSize += data.size();
+  dropFrom(fromIndex);
+  m_wal->Truncate(m_group, fromIndex);
 }
 
-long long Persister::RaftStateSize() {
+void Persister::SaveSnapshot(int lastIncludedIndex, int lastIncludedTerm, const std::string &snapshot,
+                             const std::string &membership) {
   std::lock_guard<std::mutex> lg(m_mtx);
+  // 配置和快照在同一个文件里，分块发给follower时也是一起的
+  std::string content;
+  if (!membership.empty()) {
+    content.append(SNAPSHOT_CONFIG_MAGIC, sizeof(SNAPSHOT_CONFIG_MAGIC));
+    PutFixed32(&content, static_cast<uint32_t>(membership.size()));
+    content.append(membership);
+  }
+  content.append(snapshot);
+  std::string data(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+  PutFixed32(&data, static_cast<uint32_t>(lastIncludedIndex));
+  PutFixed32(&data, static_cast<uint32_t>(lastIncludedTerm));
+  PutFixed32(&data, Crc32(content.data(), content.size()));
+  data.append(content);
+  // rename成功之后快照才算生效，之后才能删除被它包含的日志
+  writeFileAtomically(m_dir, m_dir + "/snapshot", data);
+  m_mapped.reset();
+  compactPrefix(lastIncludedIndex);
+}
 
-  return m_raftStateSize;
+std::string Persister::ReadSnapshot(std::string *membership) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  auto mapped = mapSnapshotLocked();
+  if (membership != nullptr) {
+    *membership = mapped ? mapped->Membership() : std::string();
+  }
+  return mapped ? std::string(mapped->Data(), mapped->Size()) : std::string();
 }
 
-std::string Persister::ReadRaftState() {
+std::shared_ptr<Persister::MappedSnapshot> Persister::MapSnapshot() {
   std::lock_guard<std::mutex> lg(m_mtx);
+  return mapSnapshotLocked();
+}
+
+Persister::MappedSnapshot::~MappedSnapshot() { ::munmap(m_addr, m_mapSize); }
 
-  std::fstream ifs(m_raftStateFileName, std::ios_base::in);
-  if (!ifs.good()) {
-    return "";
+Persister::SnapshotFile::~SnapshotFile() { ::close(m_fd); }
+
+bool Persister::SnapshotFile::ReadAt(long long offset, size_t len, std::string *out) const {
+  if (offset < 0 || offset > m_size) {
+    return false;
   }
-  std::string snapshot;
-  ifs >> snapshot;
-  ifs.close();
-  return snapshot;
+  out->resize(static_cast<size_t>(std::min<long long>(len, m_size - offset)));
+  return preadAll(m_fd, &(*out)[0], out->size(), SNAPSHOT_FILE_HEADER_SIZE + offset);
 }
 
-Persister::Persister(const int me)
-    : m_raftStateFileName("raftstatePersist" + std::to_string(me) + ".txt"),
-      m_snapshotFileName("snapshotPersist" + std::to_string(me) + ".txt"),
-      m_raftStateSize(0) {
-  /**
-   * 检查文件状态并清空文件
-   */
-  bool fileOpenFlag = true;
-  std::fstream file(m_raftStateFileName, std::ios::out | std::ios::trunc);
-  if (file.is_open()) {
-    file.close();
-  } else {
-    fileOpenFlag = false;
+std::shared_ptr<Persister::SnapshotFile> Persister::OpenSnapshot() {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  int fd = ::open((m_dir + "/snapshot").c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  int index = 0, term = 0;
+  uint32_t crc = 0;
+  long long size = readSnapshotHeader(fd, &index, &term, &crc);
+  if (size < 0) {
+    ::close(fd);
+    return nullptr;
+  }
+  return std::make_shared<SnapshotFile>(fd, index, term, crc, size);
+}
+
+long long Persister::WriteSnapshotChunk(int lastIncludedIndex, int lastIncludedTerm, long long offset,
+                                        const std::string &data) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  if (m_recvFd < 0 || m_recvIndex != lastIncludedIndex || m_recvTerm != lastIncludedTerm) {
+    if (offset != 0) {
+      return 0;  // 不是正在接收的快照，让leader从头发
+    }
+    discardRecvSnapshot();
+    std::string path = recvSnapshotPath();
+    m_recvFd = ::open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+    myAssert(m_recvFd >= 0, format("[func-Persister] open %s failed: %s", path.c_str(), strerror(errno)));
+    // crc在收完之后才知道，先占位
+    std::string header(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    PutFixed32(&header, static_cast<uint32_t>(lastIncludedIndex));
+    PutFixed32(&header, static_cast<uint32_t>(lastIncludedTerm));
+    PutFixed32(&header, 0);
+    writeAll(m_recvFd, header.data(), header.size());
+    m_recvIndex = lastIncludedIndex;
+    m_recvTerm = lastIncludedTerm;
+    m_recvSize = 0;
+    m_recvCrc = 0;
+  }
+  if (offset != m_recvSize) {
+    return m_recvSize;
+  }
+  // 定位写，重启接着收时上次没写完的尾部会被覆盖
+  pwriteAll(m_recvFd, data.data(), data.size(), SNAPSHOT_FILE_HEADER_SIZE + offset);
+  m_recvCrc = Crc32Extend(m_recvCrc, data.data(), data.size());
+  m_recvSize += data.size();
+  return m_recvSize;
+}
+
+bool Persister::FinishSnapshotChunks(int lastIncludedIndex, int lastIncludedTerm, uint32_t crc) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  if (m_recvFd < 0 || m_recvIndex != lastIncludedIndex || m_recvTerm != lastIncludedTerm) {
+    return false;
+  }
+  if (m_recvCrc != crc) {
+    DPrintf("[func-Persister::FinishSnapshotChunks] snapshot %d checksum mismatch, discarded", lastIncludedIndex);
+    discardRecvSnapshot();
+    return false;
+  }
+  char crcBuf[4];
+  EncodeFixed32(crcBuf, crc);
+  pwriteAll(m_recvFd, crcBuf, sizeof(crcBuf), SNAPSHOT_FILE_HEADER_SIZE - 4);
+  if (PERSIST_FSYNC) {
+    ::fdatasync(m_recvFd);
+  }
+  ::close(m_recvFd);
+  m_recvFd = -1;
+  std::string path = recvSnapshotPath();
+  myAssert(::rename(path.c_str(), (m_dir + "/snapshot").c_str()) == 0,
+           format("[func-Persister] rename %s failed: %s", path.c_str(), strerror(errno)));
+  m_mapped.reset();
+  if (PERSIST_FSYNC) {
+    syncDir(m_dir);
+  }
+  compactPrefix(lastIncludedIndex);
+  return true;
+}
+
+bool Persister::Restore(int *currentTerm, int *votedFor, int *lastIncludedIndex, int *lastIncludedTerm,
+                        std::vector<std::string> *entries, std::string *membership) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  bool found = false;
+  std::string data;
+  if (readWholeFile(m_dir + "/meta", &data) && data.size() == sizeof(META_MAGIC) + 12 &&
+      memcmp(data.data(), META_MAGIC, sizeof(META_MAGIC)) == 0 &&
+      Crc32(data.data(), data.size() - 4) == DecodeFixed32(data.data() + data.size() - 4)) {
+    *currentTerm = static_cast<int>(DecodeFixed32(data.data() + 4));
+    *votedFor = static_cast<int>(DecodeFixed32(data.data() + 8));
+    found = true;
   }
-  file = std::fstream(m_snapshotFileName, std::ios::out | std::ios::trunc);
-  if (file.is_open()) {
-    file.close();
+  membership->clear();
+  if (auto mapped = mapSnapshotLocked()) {
+    *lastIncludedIndex = mapped->LastIncludedIndex();
+    *lastIncludedTerm = mapped->LastIncludedTerm();
+    *membership = mapped->Membership();
+    found = true;
   } else {
-    fileOpenFlag = false;
+    *lastIncludedIndex = 0;
+    *lastIncludedTerm = 0;
+  }
+
+  // 共用的wal在打开时已经回放过了，index不大于上一条的记录已经覆盖掉它及之后的日志
+  std::vector<std::pair<int, std::string>> logs = m_wal->TakeReplayed(m_group);
+  entries->clear();
+  m_entrySizes.clear();
+  m_raftStateSize = 0;
+  m_entrySizesFirstIndex = *lastIncludedIndex + 1;
+  for (auto &item : logs) {
+    if (item.first <= *lastIncludedIndex) {
+      continue;
+    }
+    if (item.first != m_entrySizesFirstIndex + (int)entries->size()) {
+      DPrintf("[func-Persister::Restore] group %d log gap before index %d, dropping the rest", m_group, item.first);
+      break;
+    }
+    int recordSize = walRecordSize(m_group, item.second.size());
+    m_entrySizes.push_back(recordSize);
+    m_raftStateSize += recordSize;
+    entries->push_back(std::move(item.second));
   }
-  if (!fileOpenFlag) {
-    DPrintf("[func-Persister::Persister] file open error");
+  if (!entries->empty()) {
+    found = true;
   }
-  /**
-   * 绑定流
-   */
-  m_raftStateOutStream.open(m_raftStateFileName);
-  m_snapshotOutStream.open(m_snapshotFileName);
+  // 已经被快照包含的段可以删掉了
+  compactPrefix(*lastIncludedIndex);
+  return found;
+}
+
+void Persister::Sync() { m_wal->Sync(); }
+
+long long Persister::RaftStateSize() {
+  std::lock_guard<std::mutex> lg(m_mtx);
+
+  return m_raftStateSize;
+}
+
+Persister::Persister(const int me) : Persister(me, 0, std::make_shared<WalLog>(me)) {}
+
+Persister::Persister(int me, int group, std::shared_ptr<WalLog> wal)
+    : m_group(group),
+      m_wal(std::move(wal)),
+      m_dir(group == 0 ? m_wal->Dir() : m_wal->Dir() + "/group" + std::to_string(group)),
+      m_raftStateSize(0),
+      m_entrySizesFirstIndex(1),
+      m_recvFd(-1),
+      m_recvIndex(0),
+      m_recvTerm(0),
+      m_recvSize(0),
+      m_recvCrc(0) {
+  if (::mkdir(m_dir.c_str(), 0755) != 0 && errno != EEXIST) {
+    DPrintf("[func-Persister::Persister] mkdir %s error: %s", m_dir.c_str(), strerror(errno));
+  }
+  recoverRecvSnapshot();
 }
 
 Persister::~Persister() {
-  if (m_raftStateOutStream.is_open()) {
-    m_raftStateOutStream.close();
+  if (m_recvFd >= 0) {
+    ::close(m_recvFd);  // 留着接收文件，重启后可以接着收
+  }
+}
+
+std::shared_ptr<Persister::MappedSnapshot> Persister::mapSnapshotLocked() {
+  if (m_mapped) {
+    return m_mapped;
   }
-  if (m_snapshotOutStream.is_open()) {
-    m_snapshotOutStream.close();
+  int fd = ::open((m_dir + "/snapshot").c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
   }
+  int index = 0, term = 0;
+  uint32_t crc = 0;
+  long long contentSize = readSnapshotHeader(fd, &index, &term, &crc);
+  void *addr = MAP_FAILED;
+  size_t mapSize = contentSize < 0 ? 0 : SNAPSHOT_FILE_HEADER_SIZE + static_cast<size_t>(contentSize);
+  if (contentSize >= 0) {
+    addr = ::mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  // 映射建立之后文件描述符就不需要了
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    return nullptr;
+  }
+  // 接下来校验crc和上层解码都要读完整个文件，让内核提前读进来
+  ::madvise(addr, mapSize, MADV_WILLNEED);
+  const char *content = static_cast<const char *>(addr) + SNAPSHOT_FILE_HEADER_SIZE;
+  if (Crc32(content, static_cast<size_t>(contentSize)) != crc) {
+    DPrintf("[func-Persister] snapshot checksum mismatch");
+    ::munmap(addr, mapSize);
+    return nullptr;
+  }
+  std::string membership;
+  size_t configSize = splitSnapshot(content, static_cast<size_t>(contentSize), &membership);
+  m_mapped = std::make_shared<MappedSnapshot>(addr, mapSize, index, term, SNAPSHOT_FILE_HEADER_SIZE + configSize,
+                                              std::move(membership));
+  return m_mapped;
 }
 
-void Persister::clearRaftState() {
-  m_raftStateSize = 0;
-  // 关闭文件流
-  if (m_raftStateOutStream.is_open()) {
-    m_raftStateOutStream.close();
+void Persister::recoverRecvSnapshot() {
+  std::string path = recvSnapshotPath();
+  int fd = ::open(path.c_str(), O_RDWR);
+  if (fd < 0) {
+    return;
+  }
+  uint32_t crc = 0;
+  long long size = readSnapshotHeader(fd, &m_recvIndex, &m_recvTerm, &crc);
+  if (size < 0) {
+    ::close(fd);
+    ::unlink(path.c_str());
+    return;
+  }
+  // 重新算一遍已收到内容的crc，没落盘的尾部如果坏了，收完时的校验会失败并重传
+  m_recvCrc = 0;
+  char buf[64 * 1024];
+  for (long long off = 0; off < size;) {
+    size_t n = static_cast<size_t>(std::min<long long>(sizeof(buf), size - off));
+    if (!preadAll(fd, buf, n, SNAPSHOT_FILE_HEADER_SIZE + off)) {
+      ::close(fd);
+      ::unlink(path.c_str());
+      return;
+    }
+    m_recvCrc = Crc32Extend(m_recvCrc, buf, n);
+    off += n;
+  }
+  m_recvFd = fd;
+  m_recvSize = size;
+}
+
+void Persister::discardRecvSnapshot() {
+  if (m_recvFd >= 0) {
+    ::close(m_recvFd);
+    m_recvFd = -1;
+  }
+  ::unlink(recvSnapshotPath().c_str());
+}
+
+void Persister::dropFrom(int index) {
+  while (!m_entrySizes.empty() && m_entrySizesFirstIndex + (int)m_entrySizes.size() > index) {
+    m_raftStateSize -= m_entrySizes.back();
+    m_entrySizes.pop_back();
+  }
+}
+
+void Persister::compactPrefix(int index) {
+  while (!m_entrySizes.empty() && m_entrySizesFirstIndex <= index) {
+    m_raftStateSize -= m_entrySizes.front();
+    m_entrySizes.pop_front();
+    m_entrySizesFirstIndex++;
+  }
+  if (m_entrySizes.empty()) {
+    m_entrySizesFirstIndex = std::max(m_entrySizesFirstIndex, index + 1);
+  }
+  m_wal->Compact(m_group, index);
+}
+
+WalLog::WalLog(int me)
+    : m_dir("raftPersist" + std::to_string(me)), m_walFd(-1), m_appendSeq(0), m_durableSeq(0), m_stop(false) {
+#ifdef MONSOON_WITH_IO_URING
+  // 日志段以O_APPEND打开，需要内核支持按文件当前位置写
+  m_ring.reset(new monsoon::IoUring(8));
+  if (!m_ring->valid() || !m_ring->hasFeature(IORING_FEAT_RW_CUR_POS)) {
+    m_ring.reset();
+  }
+#endif
+  if (::mkdir(m_dir.c_str(), 0755) != 0 && errno != EEXIST) {
+    DPrintf("[func-WalLog::WalLog] mkdir %s error: %s", m_dir.c_str(), strerror(errno));
+  }
+  // 找出已有的日志段，文件名中的序号递增
+  DIR *dir = ::opendir(m_dir.c_str());
+  if (dir != nullptr) {
+    while (dirent *ent = ::readdir(dir)) {
+      int seq = 0;
+      char tail = 0;
+      if (sscanf(ent->d_name, "wal-%d.lo%c", &seq, &tail) == 2 && tail == 'g') {
+        m_segments.push_back({segmentPath(seq), seq, {}, 0});
+      }
+    }
+    ::closedir(dir);
+  }
+  std::sort(m_segments.begin(), m_segments.end(),
+            [](const Segment &a, const Segment &b) { return a.seq < b.seq; });
+  replay();
+  std::lock_guard<std::mutex> lg(m_mtx);
+  if (m_segments.empty()) {
+    openNewSegment(1);
+  } else {
+    // 继续在最后一段后面追加
+    m_walFd = ::open(m_segments.back().path.c_str(), O_CREAT | O_WRONLY | O_APPEND, 0644);
+    myAssert(m_walFd >= 0, format("[func-WalLog] open %s failed", m_segments.back().path.c_str()));
+  }
+  m_syncThread = std::thread(&WalLog::syncLoop, this);
+}
+
+WalLog::~WalLog() {
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_stop = true;
+  }
+  m_syncCv.notify_all();
+  m_syncThread.join();
+  std::lock_guard<std::mutex> lg(m_mtx);
+  flushLocked();
+  if (m_walFd >= 0) {
+    ::close(m_walFd);
+  }
+}
+
+void WalLog::replay() {
+  std::string data;
+  for (size_t i = 0; i < m_segments.size(); ++i) {
+    Segment &seg = m_segments[i];
+    readWholeFile(seg.path, &data);
+    SnapshotReader reader(data.data(), data.size());
+    size_t good = 0;
+    while (reader.remaining() > 0) {
+      uint32_t len = 0, crc = 0;
+      if (!reader.GetFixed32(&len) || !reader.GetFixed32(&crc) || len < WAL_BODY_HEADER_SIZE ||
+          reader.remaining() < len || Crc32(reader.data(), len) != crc) {
+        break;
+      }
+      const char *body = reader.data();
+      reader.Skip(len);
+      good = data.size() - reader.remaining();
+      char type = body[0];
+      int group = 0;
+      size_t headerSize = WAL_BODY_HEADER_SIZE;
+      if (type == WAL_RECORD_GROUP_ENTRY || type == WAL_RECORD_GROUP_TRUNCATE) {
+        if (len < WAL_GROUP_BODY_HEADER_SIZE) {
+          continue;
+        }
+        group = static_cast<int>(DecodeFixed32(body + 1));
+        headerSize = WAL_GROUP_BODY_HEADER_SIZE;
+      }
+      int index = static_cast<int>(DecodeFixed32(body + headerSize - 4));
+      // index不大于这个组上一条的记录覆盖掉它及之后的日志
+      auto &logs = m_replayed[group];
+      while (!logs.empty() && logs.back().first >= index) {
+        logs.pop_back();
+      }
+      for (size_t j = 0; j <= i; ++j) {
+        auto it = m_segments[j].maxIndex.find(group);
+        if (it != m_segments[j].maxIndex.end()) {
+          it->second = std::min(it->second, index - 1);
+        }
+      }
+      if (type == WAL_RECORD_ENTRY || type == WAL_RECORD_GROUP_ENTRY) {
+        logs.emplace_back(index, std::string(body + headerSize, len - headerSize));
+        int &maxIndex = seg.maxIndex[group];
+        maxIndex = std::max(maxIndex, index);
+      }
+    }
+    seg.size = good;
+    if (good != data.size()) {
+      // 崩溃时写了一半的记录，截掉它，之后的段都不可信
+      DPrintf("[func-WalLog::replay] torn record in %s at offset %d, dropping the rest", seg.path.c_str(), (int)good);
+      myAssert(::truncate(seg.path.c_str(), good) == 0, format("[func-WalLog] truncate %s failed", seg.path.c_str()));
+      for (size_t j = i + 1; j < m_segments.size(); ++j) {
+        ::unlink(m_segments[j].path.c_str());
+      }
+      m_segments.resize(i + 1);
+      break;
+    }
+  }
+}
+
+std::vector<std::pair<int, std::string>> WalLog::TakeReplayed(int group) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  std::vector<std::pair<int, std::string>> logs;
+  auto it = m_replayed.find(group);
+  if (it != m_replayed.end()) {
+    logs.swap(it->second);
+    m_replayed.erase(it);
+  }
+  return logs;
+}
+
+int WalLog::AppendEntry(int group, int index, const std::string &entry) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  return appendEntryLocked(group, index, entry);
+}
+
+void WalLog::AppendEntries(int group, int firstIndex, const std::vector<std::string> &entries,
+                           std::vector<int> *sizes) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  sizes->reserve(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    sizes->push_back(appendEntryLocked(group, firstIndex + static_cast<int>(i), entries[i]));
+  }
+}
+
+int WalLog::appendEntryLocked(int group, int index, const std::string &entry) {
+  dropFrom(group, index);
+  int recordSize = appendRecord(group, true, index, entry);
+  Segment &seg = m_segments.back();
+  int &maxIndex = seg.maxIndex[group];
+  maxIndex = std::max(maxIndex, index);
+  if (seg.size >= WAL_SEGMENT_SIZE) {
+    openNewSegment(seg.seq + 1);
+  }
+  return recordSize;
+}
+
+void WalLog::Truncate(int group, int fromIndex) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  dropFrom(group, fromIndex);
+  appendRecord(group, false, fromIndex, "");
+}
+
+void WalLog::Compact(int group, int index) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  int &compactedIndex = m_compactedIndex[group];
+  compactedIndex = std::max(compactedIndex, index);
+  // 正在写的段如果也全部被快照包含，换一个新段，这样它也能被删掉
+  if (!m_segments.empty() && m_segments.back().size > 0 && compacted(m_segments.back()) && m_walFd >= 0) {
+    openNewSegment(m_segments.back().seq + 1);
+  }
+  std::vector<Segment> kept;
+  for (size_t i = 0; i < m_segments.size(); ++i) {
+    bool last = i + 1 == m_segments.size();
+    if (!last && compacted(m_segments[i])) {
+      ::unlink(m_segments[i].path.c_str());
+    } else {
+      kept.push_back(std::move(m_segments[i]));
+    }
+  }
+  m_segments.swap(kept);
+}
+
+bool WalLog::compacted(const Segment &seg) const {
+  for (const auto &item : seg.maxIndex) {
+    auto it = m_compactedIndex.find(item.first);
+    // 还没有Restore过的组没有记录，它的日志都要留着
+    if (item.second > (it == m_compactedIndex.end() ? 0 : it->second)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void WalLog::Sync() {
+  std::unique_lock<std::mutex> lk(m_mtx);
+  uint64_t target = m_appendSeq;
+  m_durableCv.wait(lk, [&]() { return m_durableSeq >= target; });
+}
+
+void WalLog::dropFrom(int group, int index) {
+  // 旧段里 >= index 的日志已经失效，不再阻止这些段被删除
+  for (auto &seg : m_segments) {
+    auto it = seg.maxIndex.find(group);
+    if (it != seg.maxIndex.end()) {
+      it->second = std::min(it->second, index - 1);
+    }
+  }
+}
+
+int WalLog::appendRecord(int group, bool entry, int index, const std::string &payload) {
+  bool wasEmpty = m_buffer.empty();
+  size_t before = m_buffer.size();
+  appendRecordTo(&m_buffer, group, entry, index, payload);
+  size_t recordSize = m_buffer.size() - before;
+  m_appendSeq += recordSize;
+  m_segments.back().size += recordSize;
+  // 第一条记录开启一个凑批窗口，攒够一批则不必等窗口结束
+  if (wasEmpty || m_buffer.size() >= GROUP_COMMIT_MAX_BATCH_BYTES) {
+    m_syncCv.notify_one();
+  }
+  return static_cast<int>(recordSize);
+}
+
+void WalLog::syncLoop() {
+  std::unique_lock<std::mutex> lk(m_mtx);
+  while (true) {
+    m_syncCv.wait(lk, [&]() { return m_stop || !m_buffer.empty(); });
+    if (m_stop) {
+      return;  // 剩下的由析构函数写完
+    }
+    m_syncCv.wait_for(lk, std::chrono::microseconds(GROUP_COMMIT_WINDOW_US),
+                      [&]() { return m_stop || m_buffer.size() >= GROUP_COMMIT_MAX_BATCH_BYTES; });
+    if (m_buffer.empty()) {
+      continue;  // 窗口期间已经被flushLocked写掉了
+    }
+    std::string batch;
+    batch.swap(m_buffer);
+    uint64_t target = m_appendSeq;
+    // 先拿到m_ioMtx再放开m_mtx，保证这一批先于之后任何flushLocked写入，并且写的是它所属的段
+    std::unique_lock<std::mutex> io(m_ioMtx);
+    int fd = m_walFd;
+    lk.unlock();
+    // 写文件和fdatasync期间，其他线程可以继续往m_buffer里追加下一批
+    writeWal(fd, batch.data(), batch.size());
+    io.unlock();
+    lk.lock();
+    m_durableSeq = std::max(m_durableSeq, target);
+    m_durableCv.notifyAll();
+  }
+}
+
+void WalLog::flushLocked() {
+  std::lock_guard<std::mutex> io(m_ioMtx);
+  if (m_walFd >= 0) {
+    writeWal(m_walFd, m_buffer.data(), m_buffer.size());
+  }
+  m_buffer.clear();
+  m_durableSeq = m_appendSeq;
+  m_durableCv.notifyAll();
+}
+
+void WalLog::writeWal(int fd, const char *data, size_t len) {
+  static LatencyHistogram *writeUs =
+      Metrics::Instance().Histogram("wal_write_us", "WAL一批记录的写入时间，PERSIST_FSYNC时包括fdatasync");
+  static MetricCounter *writes = Metrics::Instance().Counter("wal_writes_total", "WAL写入（group commit之后）的批数");
+  static MetricCounter *bytes = Metrics::Instance().Counter("wal_bytes_total", "写进WAL的字节数");
+  writes->add();
+  bytes->add(len);
+  ScopedLatency latency(writeUs);
+#ifdef MONSOON_WITH_IO_URING
+  if (m_ring && len > 0) {
+    bool synced = false;
+    ssize_t n = m_ring->writeSync(fd, data, len, -1, PERSIST_FSYNC, &synced);
+    if (n > 0) {
+      data += n;
+      len -= n;
+    }
+    if (len == 0 && (synced || !PERSIST_FSYNC)) {
+      return;
+    }
+    // 写不完整或者io_uring出错，剩下的走普通系统调用
+  }
+#endif
+  writeAll(fd, data, len);
+  if (PERSIST_FSYNC) {
+    ::fdatasync(fd);
   }
-  // 重新打开文件流并清空文件内容
-  m_raftStateOutStream.open(m_raftStateFileName, std::ios::out | std::ios::trunc);
 }
 
-void Persister::clearSnapshot() {
-  if (m_snapshotOutStream.is_open()) {
-    m_snapshotOutStream.close();
+void WalLog::openNewSegment(int seq) {
+  // 缓冲区里的记录属于当前段，换段之前写完
+  flushLocked();
+  std::lock_guard<std::mutex> io(m_ioMtx);
+  if (m_walFd >= 0) {
+    ::close(m_walFd);
   }
-  m_snapshotOutStream.open(m_snapshotFileName, std::ios::out | std::ios::trunc);
+  Segment seg{segmentPath(seq), seq, {}, 0};
+  m_walFd = ::open(seg.path.c_str(), O_CREAT | O_WRONLY | O_TRUNC | O_APPEND, 0644);
+  myAssert(m_walFd >= 0, format("[func-WalLog] open %s failed: %s", seg.path.c_str(), strerror(errno)));
+  m_segments.push_back(seg);
 }
 
-void Persister::clearRaftStateAndSnapshot() {
-  clearRaftState();
-  clearSnapshot();
+std::string WalLog::segmentPath(int seq) const {
+  char name[32];
+  snprintf(name, sizeof(name), "/wal-%010d.log", seq);
+  return m_dir + name;
 }
@@ -1,6 +1,8 @@
 #ifndef APPLYMSG_H
 #define APPLYMSG_H
+#include <cstdint>
 #include <string>
+#include <vector>
 class ApplyMsg {
  public:
   bool CommandValid;
@@ -10,6 +12,7 @@ class ApplyMsg {
   std::string Snapshot;
   int SnapshotTerm;
   int SnapshotIndex;
+  int64_t CommittedAtUs;  // leader上这条日志提交时的MetricsNowUs()，follower和不知道的时候为0
 
  public:
   //两个valid最开始要赋予false！！
@@ -19,9 +22,13 @@ class ApplyMsg {
         CommandIndex(-1),
         SnapshotValid(false),
         SnapshotTerm(-1),
-        SnapshotIndex(-1){
+        SnapshotIndex(-1),
+        CommittedAtUs(0){
 
         };
 };
 
+// raft一次交给上层的一批消息：连续的若干条日志，或者单独一个快照
+using ApplyMsgBatch = std::vector<ApplyMsg>;
+
 #endif  // APPLYMSG_H
\ No newline at end of file
@@ -4,48 +4,243 @@
 
 #ifndef SKIP_LIST_ON_RAFT_PERSISTER_H
 #define SKIP_LIST_ON_RAFT_PERSISTER_H
-#include <fstream>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "fiber_sync.hpp"
+#include "io_uring.hpp"
+
+/**
+ * 同一个进程里所有raft组共用的日志，目录 raftPersist<me>/ 下的 wal-<seq>.log 段里混着各个组的日志条目和截断标记
+ * 写满WAL_SEGMENT_SIZE后换新段，一个段里所有组的日志都被各自的快照包含之后整段删除
+ * 组0的记录保持原来的格式，所以只有一个组时日志文件和以前完全一样
+ *
+ * 日志记录先追加到内存缓冲区，由m_syncThread按GROUP_COMMIT_WINDOW_US/GROUP_COMMIT_MAX_BATCH_BYTES
+ * 攒批后一次write+fdatasync，不同组的写入也合并在同一次fdatasync里
+ * 调用者在释放自己的锁之后用Sync()等待落盘
+ */
+class WalLog {
+ public:
+  // 打开时回放所有日志段，按组保存下来，等各组的Persister::Restore来取
+  explicit WalLog(int me);
+  ~WalLog();
+
+  // index不大于这个组上一条日志时覆盖掉它及之后的日志，返回每条记录在文件中的大小
+  int AppendEntry(int group, int index, const std::string &entry);
+  // 从firstIndex开始连续的一批日志，只加一次锁，sizes记录每条的大小
+  void AppendEntries(int group, int firstIndex, const std::vector<std::string> &entries, std::vector<int> *sizes);
+  // 丢弃这个组所有 index >= fromIndex 的日志
+  void Truncate(int group, int fromIndex);
+  // 这个组 index 及之前的日志已经被快照包含，所有组都不再需要的段会被删除
+  void Compact(int group, int index);
+  // 取走打开时回放得到的这个组的日志，按index升序，每个组只能取一次
+  std::vector<std::pair<int, std::string>> TakeReplayed(int group);
+  // 等待此前追加的所有记录落盘，不要在持有上层锁的时候调用，否则无法与其他调用者合并
+  void Sync();
+
+  const std::string &Dir() const { return m_dir; }
+
+ private:
+  struct Segment {
+    std::string path;
+    int seq;  // 文件名中递增的序号
+    // 每个组在该段里出现过的最大日志index，都 <= 各自的快照点时整段可删
+    std::unordered_map<int, int> maxIndex;
+    long long size;
+  };
+
+  // 回放所有日志段，截掉崩溃时写了一半的记录
+  void replay();
+  // 这个组在所有段里 >= index 的日志已经失效，不再阻止这些段被删除
+  void dropFrom(int group, int index);
+  int appendEntryLocked(int group, int index, const std::string &entry);
+  // 返回记录的大小
+  int appendRecord(int group, bool entry, int index, const std::string &payload);
+  bool compacted(const Segment &seg) const;
+  void syncLoop();
+  // 持有m_mtx时把缓冲区同步写入当前段，切换或删除段之前调用
+  void flushLocked();
+  // 持有m_ioMtx时把一批日志记录写入fd，PERSIST_FSYNC时同时落盘
+  void writeWal(int fd, const char *data, size_t len);
+  void openNewSegment(int seq);
+  std::string segmentPath(int seq) const;
+
+  std::mutex m_mtx;
+  // 持有期间才能使用m_walFd写文件，加锁顺序：m_mtx -> m_ioMtx
+  std::mutex m_ioMtx;
+#ifdef MONSOON_WITH_IO_URING
+  // 持有m_ioMtx时使用，写日志和fdatasync链接成一组，一次系统调用提交
+  std::unique_ptr<monsoon::IoUring> m_ring;
+#endif
+  const std::string m_dir;
+  std::vector<Segment> m_segments;  // 按seq升序，最后一个是正在写的段
+  int m_walFd;
+  // 每个组已经被快照包含的最大index
+  std::unordered_map<int, int> m_compactedIndex;
+  // 回放得到、还没被取走的日志
+  std::unordered_map<int, std::vector<std::pair<int, std::string>>> m_replayed;
+
+  // group commit
+  std::string m_buffer;     // 还没写入文件的记录
+  uint64_t m_appendSeq;     // 累计追加的字节数
+  uint64_t m_durableSeq;    // 已经落盘的字节数
+  std::condition_variable m_syncCv;     // 唤醒m_syncThread
+  // 通知Sync()的等待者：调用Sync的是raft的协程，等fdatasync时只挂起协程，不占住调度器的线程
+  monsoon::FiberCondVar m_durableCv;
+  bool m_stop;
+  std::thread m_syncThread;
+};
+
+/**
+ * 一个raft组的持久化层，组0的目录是 raftPersist<me>/，其他组是 raftPersist<me>/group<g>/，下面有：
+ *   meta                 currentTerm和votedFor，整体写临时文件再rename
+ *   snapshot             快照及其lastIncludedIndex/Term、快照点的成员配置，同样写临时文件再rename
+ *   snapshot.recv        正在从leader分块接收的快照，格式同snapshot，收完校验之后rename成snapshot
+ * 日志条目写进同一节点所有组共用的WalLog，每次persist只追加新的日志，不再重写整个状态
+ */
 class Persister {
+ public:
+  // 只读打开的快照文件，之后的SaveSnapshot替换掉文件也不影响已经打开的，leader用它分块发送快照
+  class SnapshotFile {
+   public:
+    SnapshotFile(int fd, int lastIncludedIndex, int lastIncludedTerm, uint32_t crc, long long size)
+        : m_fd(fd), m_lastIncludedIndex(lastIncludedIndex), m_lastIncludedTerm(lastIncludedTerm), m_crc(crc),
+          m_size(size) {}
+    ~SnapshotFile();
+    int LastIncludedIndex() const { return m_lastIncludedIndex; }
+    int LastIncludedTerm() const { return m_lastIncludedTerm; }
+    uint32_t Crc() const { return m_crc; }  // 整个快照内容的crc32
+    long long Size() const { return m_size; }
+    // 读取快照内容中[offset, offset + len)的部分，超出末尾的部分不读
+    bool ReadAt(long long offset, size_t len, std::string *out) const;
+
+   private:
+    const int m_fd;
+    const int m_lastIncludedIndex;
+    const int m_lastIncludedTerm;
+    const uint32_t m_crc;
+    const long long m_size;
+  };
+
+  // 只读mmap的快照文件，打开时校验过crc；Data()/Size()是上层的快照（不含文件头和成员配置）
+  // 重启时上层直接在映射上解析，不用先把整个文件读进内存再拷贝一遍
+  class MappedSnapshot {
+   public:
+    MappedSnapshot(void *addr, size_t mapSize, int lastIncludedIndex, int lastIncludedTerm, size_t offset,
+                   std::string membership)
+        : m_addr(addr), m_mapSize(mapSize), m_lastIncludedIndex(lastIncludedIndex),
+          m_lastIncludedTerm(lastIncludedTerm), m_offset(offset), m_membership(std::move(membership)) {}
+    ~MappedSnapshot();
+    MappedSnapshot(const MappedSnapshot &) = delete;
+    MappedSnapshot &operator=(const MappedSnapshot &) = delete;
+    const char *Data() const { return static_cast<const char *>(m_addr) + m_offset; }
+    size_t Size() const { return m_mapSize - m_offset; }
+    int LastIncludedIndex() const { return m_lastIncludedIndex; }
+    int LastIncludedTerm() const { return m_lastIncludedTerm; }
+    const std::string &Membership() const { return m_membership; }
+
+   private:
+    void *const m_addr;
+    const size_t m_mapSize;
+    const int m_lastIncludedIndex;
+    const int m_lastIncludedTerm;
+    const size_t m_offset;
+    const std::string m_membership;
+  };
+
  private:
   std::mutex m_mtx;
-  std::string m_raftState;
-  std::string m_snapshot;
+  const int m_group;
+  std::shared_ptr<WalLog> m_wal;
+  const std::string m_dir;
   /**
-   * m_raftStateFileName: raftState文件名
-   */
-  const std::string m_raftStateFileName;
-  /**
-   * m_snapshotFileName: snapshot文件名
-   */
-  const std::string m_snapshotFileName;
-  /**
-   * 保存raftState的输出流
+   * 保存raftStateSize的大小
+   * 只统计快照点之后仍然有效的日志记录大小
    */
-  std::ofstream m_raftStateOutStream;
+  long long m_raftStateSize;
+  // 快照点之后每条日志记录的大小，m_entrySizes[0]对应index m_entrySizesFirstIndex
+  std::deque<int> m_entrySizes;
+  int m_entrySizesFirstIndex;
+
+  // 正在接收的快照，m_recvFd为-1表示没有
+  int m_recvFd;
+  int m_recvIndex;
+  int m_recvTerm;
+  long long m_recvSize;  // 已经收到的快照内容长度，不含文件头
+  uint32_t m_recvCrc;    // 已收到内容的crc32
+
+  // 最近一次映射并校验过的快照，Restore和上层安装快照共用，快照文件被替换时丢掉
+  std::shared_ptr<MappedSnapshot> m_mapped;
+
+ public:
+  // ---- hard state ----
+  void SaveHardState(int currentTerm, int votedFor);
+
+  // ---- log ----
+  // entry是序列化后的LogEntry，index必须紧接着上一条（截断之后从截断点开始）
+  void AppendLog(int index, const std::string &entry);
+  // 从firstIndex开始连续的一批日志，只加一次锁
+  void AppendLogs(int firstIndex, const std::vector<std::string> &entries);
+  // 丢弃所有 index >= fromIndex 的日志
+  void TruncateSuffix(int fromIndex);
+
+  // ---- snapshot ----
+  // 先落盘快照，再删除已经被快照包含的日志段；membership是快照点的成员配置（序列化的Membership），和快照存在一起
+  void SaveSnapshot(int lastIncludedIndex, int lastIncludedTerm, const std::string &snapshot,
+                    const std::string &membership = "");
+  // 返回上层的快照，membership不为空时取出快照点的成员配置，旧的快照没有配置时为空串
+  std::string ReadSnapshot(std::string *membership = nullptr);
+  // 没有快照时返回nullptr
+  std::shared_ptr<SnapshotFile> OpenSnapshot();
+  // 没有快照或者快照损坏时返回nullptr
+  std::shared_ptr<MappedSnapshot> MapSnapshot();
+
+  // ---- 分块接收快照 ----
   /**
-   * 保存snapshot的输出流
+   * 把leader发来的一块快照内容写到接收文件的offset处
+   * 正在接收的不是同一个快照时，只有offset为0的块才会开始新的接收
+   * @return 写完之后已经收到的长度，offset对不上时不写入，返回值就是接收方期望的下一个offset
    */
-  std::ofstream m_snapshotOutStream;
+  long long WriteSnapshotChunk(int lastIncludedIndex, int lastIncludedTerm, long long offset, const std::string &data);
+  // 全部收到之后校验crc，通过则替换当前快照并删除被它包含的日志段；失败时丢弃已收到的内容，需要从头再传
+  bool FinishSnapshotChunks(int lastIncludedIndex, int lastIncludedTerm, uint32_t crc);
+
   /**
-   * 保存raftStateSize的大小
-   * 避免每次都读取文件来获取具体的大小
+   * 读取崩溃前持久化的状态，entries是快照点之后连续的日志（序列化后的LogEntry），membership是快照点的成员配置
+   * @return 是否有持久化的状态
    */
-  long long m_raftStateSize;
+  bool Restore(int *currentTerm, int *votedFor, int *lastIncludedIndex, int *lastIncludedTerm,
+               std::vector<std::string> *entries, std::string *membership);
+
+  // 等待此前追加的所有日志记录落盘，不要在持有上层锁的时候调用，否则无法与其他调用者合并
+  void Sync();
 
- public:
-  void Save(std::string raftstate, std::string snapshot);
-  std::string ReadSnapshot();
-  void SaveRaftState(const std::string& data);
   long long RaftStateSize();
-  std::string ReadRaftState();
+  // 单独使用一份日志，只有组0
   explicit Persister(int me);
+  // 和同一节点的其他组共用wal
+  Persister(int me, int group, std::shared_ptr<WalLog> wal);
   ~Persister();
 
  private:
-  void clearRaftState();
-  void clearSnapshot();
-  void clearRaftStateAndSnapshot();
+  // 调用前需持有m_mtx
+  std::shared_ptr<MappedSnapshot> mapSnapshotLocked();
+  // 重启后接着上次没收完的快照继续接收
+  void recoverRecvSnapshot();
+  void discardRecvSnapshot();
+  std::string recvSnapshotPath() const { return m_dir + "/snapshot.recv"; }
+  // 内存中的记账：index及之后的日志作废
+  void dropFrom(int index);
+  // 调用前需持有m_mtx
+  void appendLogLocked(int index, const std::string &entry);
+  // 快照包含了index及之前的日志，调用前需持有m_mtx
+  void compactPrefix(int index);
 };
 
 #endif  // SKIP_LIST_ON_RAFT_PERSISTER_H
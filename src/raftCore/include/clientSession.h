@@ -0,0 +1,193 @@
+#ifndef SKIP_LIST_ON_RAFT_CLIENTSESSION_H
+#define SKIP_LIST_ON_RAFT_CLIENTSESSION_H
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include "config.h"
+#include "snapshotCodec.h"
+
+// 一个client最近KV_DEDUP_WINDOW个requestId里哪些已经执行过，client可以同时有多个在途的请求
+// 第i位表示maxRequestId - i；比窗口还旧的id一律当作执行过，clerk保证在途请求的id跨度小于窗口
+struct RequestWindow {
+  static constexpr int kWords = KV_DEDUP_WINDOW / 64;
+  int maxRequestId = 0;  // clerk的requestId从1开始
+  uint64_t bits[kWords] = {};
+
+  bool contains(int id) const {
+    if (id > maxRequestId) {
+      return false;
+    }
+    long long d = static_cast<long long>(maxRequestId) - id;
+    return d >= KV_DEDUP_WINDOW || (bits[d / 64] >> (d % 64) & 1);
+  }
+
+  void insert(int id) {
+    if (id > maxRequestId) {
+      shiftBy(static_cast<long long>(id) - maxRequestId);
+      maxRequestId = id;
+      bits[0] |= 1;
+      return;
+    }
+    long long d = static_cast<long long>(maxRequestId) - id;
+    if (d < KV_DEDUP_WINDOW) {
+      bits[d / 64] |= 1ull << (d % 64);
+    }
+  }
+
+  // maxRequestId之前的id都算执行过，旧格式的快照只记录了最大的id
+  void fillAll() {
+    for (auto &w : bits) {
+      w = ~0ull;
+    }
+  }
+
+ private:
+  void shiftBy(long long n) {
+    int w = n >= KV_DEDUP_WINDOW ? kWords : static_cast<int>(n / 64);
+    int b = static_cast<int>(n % 64);
+    for (int i = kWords - 1; i >= 0; --i) {
+      uint64_t v = 0;
+      if (i - w >= 0) {
+        v = bits[i - w] << b;
+        if (b != 0 && i - w - 1 >= 0) {
+          v |= bits[i - w - 1] >> (64 - b);
+        }
+      }
+      bits[i] = v;
+    }
+  }
+};
+
+// 一个clerk的session，由提交到日志里的Register操作创建，id就是那条日志的index
+struct ClientSession {
+  uint64_t id = 0;
+  int64_t lastActiveMs = 0;  // 最后一次写操作的日志时间
+  RequestWindow requests;
+  // 最后一次执行的CompareAndSwap/Increment和它的结果（见kvServer.cpp的encodeAtomicResult），重试的请求直接拿这个结果
+  // clerk同一时间只有一个在途的原子操作，所以只需要留最后一个
+  int atomicRequestId = 0;
+  std::string atomicResult;
+};
+
+// kvserver的去重表，只在apply日志的时候修改，时间也只用日志里的时间，所有副本上的内容和顺序都一样
+// 按最后活跃的时间排序，超过KV_SESSION_TIMEOUT_MS没有写操作，或者个数超过KV_MAX_SESSIONS时从最旧的开始删
+class SessionTable {
+ public:
+  SessionTable() = default;
+  SessionTable(const SessionTable &) = delete;
+  SessionTable &operator=(const SessionTable &) = delete;
+
+  const ClientSession *find(uint64_t id) const {
+    auto it = m_index.find(id);
+    return it == m_index.end() ? nullptr : &*it->second;
+  }
+
+  // 新建session，已经存在时返回原来的
+  ClientSession *create(uint64_t id, int64_t nowMs) {
+    ClientSession *session = touch(id, nowMs);
+    if (session != nullptr) {
+      return session;
+    }
+    m_lru.emplace_back();
+    m_lru.back().id = id;
+    m_lru.back().lastActiveMs = nowMs;
+    m_index[id] = std::prev(m_lru.end());
+    // 新的session在最后面，超出个数上限时删掉的是最旧的
+    expire(nowMs);
+    return &m_lru.back();
+  }
+
+  // 记录一次写操作，session不存在或者已经过期时返回nullptr
+  ClientSession *touch(uint64_t id, int64_t nowMs) {
+    auto it = m_index.find(id);
+    if (it == m_index.end()) {
+      return nullptr;
+    }
+    m_lru.splice(m_lru.end(), m_lru, it->second);
+    if (nowMs > it->second->lastActiveMs) {
+      it->second->lastActiveMs = nowMs;
+    }
+    return &*it->second;
+  }
+
+  void expire(int64_t nowMs) {
+    while (!m_lru.empty() && (m_lru.size() > static_cast<size_t>(KV_MAX_SESSIONS) ||
+                              m_lru.front().lastActiveMs + KV_SESSION_TIMEOUT_MS < nowMs)) {
+      m_index.erase(m_lru.front().id);
+      m_lru.pop_front();
+    }
+  }
+
+  size_t size() const { return m_lru.size(); }
+
+  void clear() {
+    m_lru.clear();
+    m_index.clear();
+  }
+
+  // fixed32 n | n * (fixed64 id | fixed64 lastActiveMs | fixed32 maxRequestId | fixed32 m | m * fixed64 窗口 |
+  //                  fixed32 atomicRequestId | atomicResult)
+  // 按最后活跃的时间从旧到新，窗口末尾全0的部分不写；decode时withAtomic为false表示没有最后两项的旧格式
+  void encode(std::string *out) const {
+    PutFixed32(out, static_cast<uint32_t>(m_lru.size()));
+    for (const auto &session : m_lru) {
+      PutFixed64(out, session.id);
+      PutFixed64(out, static_cast<uint64_t>(session.lastActiveMs));
+      PutFixed32(out, static_cast<uint32_t>(session.requests.maxRequestId));
+      uint32_t m = RequestWindow::kWords;
+      while (m > 0 && session.requests.bits[m - 1] == 0) {
+        --m;
+      }
+      PutFixed32(out, m);
+      for (uint32_t i = 0; i < m; ++i) {
+        PutFixed64(out, session.requests.bits[i]);
+      }
+      PutFixed32(out, static_cast<uint32_t>(session.atomicRequestId));
+      EncodeSnapshotField(out, session.atomicResult);
+    }
+  }
+
+  bool decode(SnapshotReader *reader, bool withAtomic) {
+    clear();
+    uint32_t n = 0;
+    if (!reader->GetFixed32(&n)) {
+      return false;
+    }
+    for (uint32_t i = 0; i < n; ++i) {
+      uint64_t id = 0;
+      uint64_t lastActiveMs = 0;
+      uint32_t maxRequestId = 0;
+      uint32_t m = 0;
+      if (!reader->GetFixed64(&id) || !reader->GetFixed64(&lastActiveMs) || !reader->GetFixed32(&maxRequestId) ||
+          !reader->GetFixed32(&m) || m > RequestWindow::kWords || m_index.count(id) != 0) {
+        return false;
+      }
+      m_lru.emplace_back();
+      ClientSession &session = m_lru.back();
+      session.id = id;
+      session.lastActiveMs = static_cast<int64_t>(lastActiveMs);
+      session.requests.maxRequestId = static_cast<int>(maxRequestId);
+      for (uint32_t j = 0; j < m; ++j) {
+        if (!reader->GetFixed64(&session.requests.bits[j])) {
+          return false;
+        }
+      }
+      uint32_t atomicRequestId = 0;
+      if (withAtomic &&
+          (!reader->GetFixed32(&atomicRequestId) || !DecodeSnapshotField(reader, &session.atomicResult))) {
+        return false;
+      }
+      session.atomicRequestId = static_cast<int>(atomicRequestId);
+      m_index[id] = std::prev(m_lru.end());
+    }
+    return true;
+  }
+
+ private:
+  std::list<ClientSession> m_lru;  // 最久没有写操作的在前面
+  std::unordered_map<uint64_t, std::list<ClientSession>::iterator> m_index;
+};
+
+#endif  // SKIP_LIST_ON_RAFT_CLIENTSESSION_H
@@ -0,0 +1,186 @@
+#ifndef SKIP_LIST_ON_RAFT_HOTKEYCACHE_H
+#define SKIP_LIST_ON_RAFT_HOTKEYCACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "config.h"
+#include "fiber_sync.hpp"
+
+// leader上ReadIndex读的热点key缓存，只缓存读过KV_READ_CACHE_ADMIT次以上的key（含不存在的key），每个分片按LRU淘汰
+// 一致性靠apply线程：每次改存储引擎里的key之后、推进lastApplied之前调用Invalidate，所以缓存里的内容总是当前apply状态的值，
+// 等到apply过readIndex的读请求直接用它就行
+// 缓存没命中时同一个key只有一个请求去查存储引擎，其他readIndex不比它大的请求等它的结果（它查的时候已经apply到了它们的readIndex）；
+// 查的过程中这个key被改过时结果照样回复给这些请求，但是不放进缓存
+class HotKeyCache {
+ public:
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;     // 自己去查了存储引擎
+    uint64_t coalesced = 0;  // 等了别的请求的结果
+  };
+
+  HotKeyCache() = default;
+  HotKeyCache(const HotKeyCache &) = delete;
+  HotKeyCache &operator=(const HotKeyCache &) = delete;
+
+  // 调用前本地已经apply到readIndex；load(&value)查存储引擎，返回key是否存在
+  bool Read(const std::string &key, int readIndex, std::string *value,
+            const std::function<bool(std::string *)> &load) {
+    Shard &s = m_shards[std::hash<std::string>()(key) % KV_READ_CACHE_SHARDS];
+    std::unique_lock<std::mutex> lk(s.mtx);
+    auto it = s.entries.find(key);
+    if (it != s.entries.end()) {
+      s.lru.splice(s.lru.begin(), s.lru, it->second.pos);
+      *value = it->second.value;
+      m_hits.fetch_add(1, std::memory_order_relaxed);
+      return it->second.exist;
+    }
+    auto f = s.flights.find(key);
+    if (f != s.flights.end() && f->second->readIndex >= readIndex) {
+      std::shared_ptr<Flight> flight = f->second;
+      s.cv.wait(lk, [&flight]() { return flight->done; });
+      *value = flight->value;
+      m_coalesced.fetch_add(1, std::memory_order_relaxed);
+      return flight->exist;
+    }
+    // 已经有readIndex更小的请求在查时以新的为准，旧的查完不放进缓存
+    auto flight = std::make_shared<Flight>();
+    flight->readIndex = readIndex;
+    s.flights[key] = flight;
+    bool admit = admitLocked(&s, key);
+    s.tracked.fetch_add(1);
+    lk.unlock();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    flight->exist = load(&flight->value);
+
+    lk.lock();
+    flight->done = true;
+    f = s.flights.find(key);
+    if (f != s.flights.end() && f->second == flight) {
+      s.flights.erase(f);
+      if (admit && !flight->stale && flight->value.size() <= KV_READ_CACHE_MAX_VALUE_BYTES) {
+        insertLocked(&s, key, flight->value, flight->exist);
+      }
+    }
+    s.tracked.fetch_sub(1);
+    s.cv.notifyAll();
+    *value = flight->value;
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    return flight->exist;
+  }
+
+  // apply线程改了key之后调用；分片里没有缓存也没有在查的请求时不拿锁
+  void Invalidate(const std::string &key) {
+    Shard &s = m_shards[std::hash<std::string>()(key) % KV_READ_CACHE_SHARDS];
+    // 和Read里登记之后才查存储引擎配对：这里看到0时，之后开始的查询一定能看到刚才的写入
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (s.tracked.load() == 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> lk(s.mtx);
+    auto it = s.entries.find(key);
+    if (it != s.entries.end()) {
+      eraseLocked(&s, it);
+    }
+    auto f = s.flights.find(key);
+    if (f != s.flights.end()) {
+      f->second->stale = true;
+    }
+  }
+
+  // 装快照之后整体清空
+  void Clear() {
+    for (auto &s : m_shards) {
+      std::lock_guard<std::mutex> lk(s.mtx);
+      s.tracked.fetch_sub(static_cast<int>(s.entries.size()));
+      s.entries.clear();
+      s.lru.clear();
+      for (auto &f : s.flights) {
+        f.second->stale = true;
+      }
+    }
+  }
+
+  Stats stats() const {
+    return {m_hits.load(std::memory_order_relaxed), m_misses.load(std::memory_order_relaxed),
+            m_coalesced.load(std::memory_order_relaxed)};
+  }
+
+ private:
+  struct Flight {
+    int readIndex = 0;
+    bool done = false;
+    bool stale = false;  // 查的过程中key被改过
+    bool exist = false;
+    std::string value;
+  };
+
+  struct Entry {
+    std::string value;
+    bool exist = false;
+    std::list<std::string>::iterator pos;
+  };
+
+  static constexpr int kCapacity = KV_READ_CACHE_CAPACITY / KV_READ_CACHE_SHARDS;
+  static constexpr int kAdmitSlots = 4 * kCapacity;
+
+  struct Shard {
+    std::mutex mtx;
+    // 等结果的是rpc worker上的协程，等待时只挂起协程，同一个热点key的读请求不会占满worker线程
+    monsoon::FiberCondVar cv;
+    std::unordered_map<std::string, Entry> entries;
+    std::list<std::string> lru;  // 最近用过的在前面
+    std::unordered_map<std::string, std::shared_ptr<Flight> > flights;
+    // 缓存的key数加上正在查的请求数，为0时Invalidate不用拿锁
+    std::atomic<int> tracked{0};
+    // 按key的hash计没命中的次数，到KV_READ_CACHE_ADMIT才放进缓存；计满kAdmitSlots次之后全部减半，冷下来的key慢慢忘掉
+    uint8_t admitCounts[kAdmitSlots] = {};
+    int admitSamples = 0;
+  };
+
+  bool admitLocked(Shard *s, const std::string &key) {
+    if (++s->admitSamples >= kAdmitSlots) {
+      s->admitSamples = 0;
+      for (auto &c : s->admitCounts) {
+        c >>= 1;
+      }
+    }
+    uint8_t &count = s->admitCounts[std::hash<std::string>()(key) / KV_READ_CACHE_SHARDS % kAdmitSlots];
+    if (count < UINT8_MAX) {
+      ++count;
+    }
+    return count >= KV_READ_CACHE_ADMIT;
+  }
+
+  void insertLocked(Shard *s, const std::string &key, const std::string &value, bool exist) {
+    if (static_cast<int>(s->entries.size()) >= kCapacity) {
+      eraseLocked(s, s->entries.find(s->lru.back()));
+    }
+    s->lru.push_front(key);
+    Entry &entry = s->entries[key];
+    entry.value = value;
+    entry.exist = exist;
+    entry.pos = s->lru.begin();
+    s->tracked.fetch_add(1);
+  }
+
+  void eraseLocked(Shard *s, std::unordered_map<std::string, Entry>::iterator it) {
+    s->lru.erase(it->second.pos);
+    s->entries.erase(it);
+    s->tracked.fetch_sub(1);
+  }
+
+  Shard m_shards[KV_READ_CACHE_SHARDS];
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_misses{0};
+  std::atomic<uint64_t> m_coalesced{0};
+};
+
+#endif  // SKIP_LIST_ON_RAFT_HOTKEYCACHE_H
@@ -0,0 +1,117 @@
+#ifndef SKIP_LIST_ON_RAFT_KVENGINE_H
+#define SKIP_LIST_ON_RAFT_KVENGINE_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include "skipList.h"
+
+/**
+ * KvServer状态机下面的存储引擎，所有引擎都按同一种快照格式（跳表的"SLS1"二进制快照）导入导出，
+ * 所以换引擎不影响raft快照和副本之间的快照安装
+ * 并发约定和跳表一样：写操作（Put/Delete/Load/BeginSnapshot）只在apply线程里，读操作和迭代器可以在任意线程
+ * DumpSnapshot在后台线程里和写操作并发执行，写出的是BeginSnapshot那一刻的状态
+ */
+class KvEngine {
+ public:
+  virtual ~KvEngine() = default;
+
+  // 有序迭代器，用法和SkipList::Iterator一样，只在短时间内持有
+  class Iterator {
+   public:
+    virtual ~Iterator() = default;
+    virtual bool valid() const = 0;
+    // 定位到第一个 >= target 的key
+    virtual void seek(const std::string &target) = 0;
+    virtual void next() = 0;
+    virtual std::string key() const = 0;
+    virtual std::string value() const = 0;
+  };
+
+  virtual bool Get(const std::string &key, std::string *value) = 0;
+  virtual void Put(const std::string &key, const std::string &value) = 0;
+  virtual void Delete(const std::string &key) = 0;
+  // 读改写一个key：fn(current, &next)里current为nullptr表示key不存在，返回false时不写；返回是否写了
+  // 只在apply线程里调用，fn和写入之间不会有别的写；默认实现是Get再Put
+  using UpdateFn = std::function<bool(const std::string *current, std::string *next)>;
+  virtual bool Update(const std::string &key, const UpdateFn &fn) {
+    std::string current;
+    bool exist = Get(key, &current);
+    std::string next;
+    if (!fn(exist ? &current : nullptr, &next)) {
+      return false;
+    }
+    Put(key, next);
+    return true;
+  }
+  // 在key原来的值后面接上suffix，key不存在时等于Put；只在apply线程里调用，默认实现是Update
+  virtual void Append(const std::string &key, const std::string &suffix) {
+    Update(key, [&suffix](const std::string *current, std::string *next) {
+      if (current != nullptr) {
+        next->reserve(current->size() + suffix.size());
+        next->append(*current);
+      }
+      next->append(suffix);
+      return true;
+    });
+  }
+  virtual std::unique_ptr<Iterator> NewIterator() = 0;
+  // key的个数，LSM里是估计值（还没合并掉的旧版本和删除也算在内），只用来做负载统计
+  virtual int Size() = 0;
+
+  // 已经有快照在进行时返回false
+  virtual bool BeginSnapshot() = 0;
+  virtual void DumpSnapshot(std::string *out) = 0;
+  // 当前状态的快照，和写操作并发时得到的是遍历过程中的有序视图
+  virtual void DumpTo(std::string *out) = 0;
+  // 用快照替换全部内容，快照损坏时返回false；旧版本的boost文本快照也能读
+  virtual bool Load(const char *data, size_t len) = 0;
+  // Debug时打印全部内容
+  virtual void Display() = 0;
+};
+
+// 全部数据放在内存里的跳表，点查走跳表旁边的hash索引，跳表只负责有序遍历
+class SkipListEngine : public KvEngine {
+ public:
+  SkipListEngine() : m_list(SKIPLIST_MAX_LEVEL, true) {}
+
+  bool Get(const std::string &key, std::string *value) override { return m_list.search_element(key, *value); }
+  void Put(const std::string &key, const std::string &value) override {
+    std::string k = key, v = value;
+    m_list.insert_set_element(k, v);
+  }
+  void Delete(const std::string &key) override { m_list.delete_element(key); }
+  // 在跳表里一次查找完成，已有的节点不动，只换value
+  bool Update(const std::string &key, const UpdateFn &fn) override { return m_list.update_element(key, fn); }
+  // 接在节点现有的value后面，不用每次整个拷贝一遍
+  void Append(const std::string &key, const std::string &suffix) override { m_list.append_element(key, suffix); }
+  std::unique_ptr<Iterator> NewIterator() override { return std::unique_ptr<Iterator>(new ListIterator(m_list)); }
+  int Size() override { return m_list.size(); }
+
+  bool BeginSnapshot() override { return m_list.begin_snapshot(); }
+  void DumpSnapshot(std::string *out) override { m_list.dump_snapshot(out); }
+  void DumpTo(std::string *out) override { m_list.dump_to(out); }
+  bool Load(const char *data, size_t len) override { return m_list.load_from(data, len); }
+  void Display() override { m_list.display_list(); }
+
+ private:
+  class ListIterator : public Iterator {
+   public:
+    explicit ListIterator(SkipList<std::string, std::string> &list) : m_it(list) {}
+    bool valid() const override { return m_it.valid(); }
+    void seek(const std::string &target) override { m_it.seek(target); }
+    void next() override { m_it.next(); }
+    std::string key() const override { return m_it.key(); }
+    std::string value() const override { return m_it.value(); }
+
+   private:
+    SkipList<std::string, std::string>::Iterator m_it;
+  };
+
+  SkipList<std::string, std::string> m_list;
+};
+
+// name为"lsm"时返回LsmEngine，数据文件放在dir下；其他（包括空）都是SkipListEngine
+std::unique_ptr<KvEngine> NewKvEngine(const std::string &name, const std::string &dir);
+
+#endif  // SKIP_LIST_ON_RAFT_KVENGINE_H
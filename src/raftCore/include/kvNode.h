@@ -0,0 +1,132 @@
+#ifndef SKIP_LIST_ON_RAFT_KVNODE_H
+#define SKIP_LIST_ON_RAFT_KVNODE_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "keyRange.h"
+#include "kvServer.h"
+#include "mprpcconfig.h"
+
+/**
+ * 一个节点进程：按配置文件里的key范围表为每个范围跑一个raft组（KvServer），每个节点上都有全部的组
+ * 所有组共用一个RpcProvider、一个协程调度器和一份WalLog（一次fdatasync让所有组的日志一起落盘）
+ * rpc按请求里的GroupId分给对应的组；各组的leader分散在不同节点上，写入可以随节点数扩展
+ * 每个节点定期检查自己领导的组：key数或者请求数过大的范围分裂到备用组，相邻的冷范围合并，
+ * 自己领导的组比别的节点多太多时把领导权交出去，见balanceLoop和rangeState.h
+ */
+class KvNode : public raftKVRpcProctoc::kvServerRpc {
+ public:
+  KvNode() = delete;
+  // 启动rpc服务、连接其他节点、启动所有组，然后一直阻塞
+  KvNode(int me, int maxraftstate, std::string nodeInforFileName, short port);
+
+  // 没有这个组时返回nullptr
+  KvServer *Group(int groupId);
+
+ public:  // for rpc
+  void PutAppend(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::PutAppendArgs *request,
+                 ::raftKVRpcProctoc::PutAppendReply *response, ::google::protobuf::Closure *done) override;
+
+  void Get(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetArgs *request,
+           ::raftKVRpcProctoc::GetReply *response, ::google::protobuf::Closure *done) override;
+
+  void Scan(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ScanArgs *request,
+            ::raftKVRpcProctoc::ScanReply *response, ::google::protobuf::Closure *done) override;
+
+  void BatchPut(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::BatchPutArgs *request,
+                ::raftKVRpcProctoc::BatchPutReply *response, ::google::protobuf::Closure *done) override;
+
+  void BatchGet(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::BatchGetArgs *request,
+                ::raftKVRpcProctoc::BatchGetReply *response, ::google::protobuf::Closure *done) override;
+
+  void RegisterClient(google::protobuf::RpcController *controller,
+                      const ::raftKVRpcProctoc::RegisterClientArgs *request,
+                      ::raftKVRpcProctoc::RegisterClientReply *response, ::google::protobuf::Closure *done) override;
+
+  void GetRanges(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetRangesArgs *request,
+                 ::raftKVRpcProctoc::GetRangesReply *response, ::google::protobuf::Closure *done) override;
+
+  // GroupId小于0时把本节点领导的所有组都交出去，用于滚动重启之前；不领导任何组时直接回复OK
+  void TransferLeader(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::TransferLeaderArgs *request,
+                      ::raftKVRpcProctoc::TransferLeaderReply *response, ::google::protobuf::Closure *done) override;
+
+  // 在组的leader上做一次成员变更，等到配置日志提交才回复；每个组要分别变更
+  void ChangeMembership(google::protobuf::RpcController *controller,
+                        const ::raftKVRpcProctoc::ChangeMembershipArgs *request,
+                        ::raftKVRpcProctoc::ChangeMembershipReply *response, ::google::protobuf::Closure *done) override;
+
+ private:
+  // 节点之间的raft rpc也按GroupId分给对应组的Raft
+  // 没有这个组时回复空的response：AE的AppState为Disconnected，其他回复的term为0，发送方都当作失败处理
+  class RaftRouter : public raftRpcProctoc::raftRpc {
+   public:
+    explicit RaftRouter(KvNode *node) : m_node(node) {}
+    void AppendEntries(google::protobuf::RpcController *controller, const ::raftRpcProctoc::AppendEntriesArgs *request,
+                       ::raftRpcProctoc::AppendEntriesReply *response, ::google::protobuf::Closure *done) override;
+    void InstallSnapshot(google::protobuf::RpcController *controller,
+                         const ::raftRpcProctoc::InstallSnapshotRequest *request,
+                         ::raftRpcProctoc::InstallSnapshotResponse *response,
+                         ::google::protobuf::Closure *done) override;
+    void RequestVote(google::protobuf::RpcController *controller, const ::raftRpcProctoc::RequestVoteArgs *request,
+                     ::raftRpcProctoc::RequestVoteReply *response, ::google::protobuf::Closure *done) override;
+    void ReadIndex(google::protobuf::RpcController *controller, const ::raftRpcProctoc::ReadIndexArgs *request,
+                   ::raftRpcProctoc::ReadIndexReply *response, ::google::protobuf::Closure *done) override;
+    void TimeoutNow(google::protobuf::RpcController *controller, const ::raftRpcProctoc::TimeoutNowArgs *request,
+                    ::raftRpcProctoc::TimeoutNowReply *response, ::google::protobuf::Closure *done) override;
+    void RangeAdmin(google::protobuf::RpcController *controller, const ::raftRpcProctoc::RangeAdminArgs *request,
+                    ::raftRpcProctoc::RangeAdminReply *response, ::google::protobuf::Closure *done) override;
+
+   private:
+    KvNode *m_node;
+  };
+
+  // 反复读节点信息文件，直到所有节点都写了地址、rpc端口都能连上（最多等KV_STARTUP_WAIT_MS），返回最后读到的配置
+  MprpcConfig waitPeersReady(const std::string &nodeInforFileName);
+
+  // 组存在并且keys都在它的范围里时返回这个组，否则回复ErrWrongGroup
+  template <typename Reply, typename Keys>
+  KvServer *route(int groupId, const Keys &keys, Reply *reply, ::google::protobuf::Closure *done) {
+    KvServer *group = Group(groupId);
+    if (group == nullptr || !group->Owns(keys)) {
+      reply->set_err(ErrWrongGroup);
+      done->Run();
+      return nullptr;
+    }
+    return group;
+  }
+
+  // 上一轮检查时各组的负载计数，算这一轮的增量
+  struct LoadSample {
+    uint64_t requests = 0;
+    uint64_t appliedWrites = 0;
+  };
+
+  // 每隔KV_BALANCE_INTERVAL_MS检查一次，一直不返回
+  void balanceLoop();
+  // 推进本节点领导的组参与的、还没走完的迁移，有迁移在进行时返回true
+  bool resumeMoves(int g, const std::vector<RangeState> &states);
+  // 把源组from的range交给目标组to：预留、交出、交数据、清理，中途失败的由resumeMoves接着做
+  void moveRange(int from, int to, const KeyRange &range);
+  // 源组已经交出之后，把数据交给目标组并清理源组留着的旧值
+  void finishHandoff(int from, const RangeMove &move);
+  // 在组的leader上写一条Range日志，leader在本节点时直接提交，否则通过RangeAdmin rpc
+  std::string rangeAdmin(int group, raftRpcProctoc::RangeAdminArgs *args, int *id);
+  // 本节点领导的组比leader最少的节点多出KV_LEADER_IMBALANCE个时交出一个
+  void balanceLeaders(const std::vector<RangeState> &states);
+
+  int m_me;
+  KeyRangeTable m_ranges;
+  std::vector<std::unique_ptr<KvServer> > m_groups;  // 下标就是组号
+  RaftRouter m_raftRouter;
+  // 各组到每个节点的连接，下标是组号和节点号，自己是nullptr
+  std::vector<std::vector<std::shared_ptr<RaftRpcUtil> > > m_peers;
+  std::vector<LoadSample> m_loadSamples;
+  std::vector<int> m_coldRounds;  // 连续几轮都是冷的，刚启动或者偶尔空闲一下的范围不合并
+  std::chrono::steady_clock::time_point m_lastSampleTime;
+  std::thread m_balanceThread;
+};
+
+#endif  // SKIP_LIST_ON_RAFT_KVNODE_H
@@ -15,70 +15,211 @@
 #include <boost/serialization/serialization.hpp>
 #include <boost/serialization/unordered_map.hpp>
 #include <boost/serialization/vector.hpp>
+#include <condition_variable>
 #include <iostream>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
 #include <unordered_map>
+#include "clientSession.h"
+#include "hotKeyCache.h"
+#include "keyRange.h"
+#include "kvEngine.h"
 #include "kvServerRPC.pb.h"
 #include "raft.h"
-#include "skipList.h"
+#include "rangeState.h"
 
+static const char KVSERVER_SNAPSHOT_MAGIC_V1[4] = {'K', 'V', 'S', '1'};
+static const char KVSERVER_SNAPSHOT_MAGIC_V2[4] = {'K', 'V', 'S', '2'};
+static const char KVSERVER_SNAPSHOT_MAGIC_V3[4] = {'K', 'V', 'S', '3'};
+static const char KVSERVER_SNAPSHOT_MAGIC_V4[4] = {'K', 'V', 'S', '4'};
+static const char KVSERVER_SNAPSHOT_MAGIC[4] = {'K', 'V', 'S', '5'};
+
+
+// 一个raft组的状态机，负责key空间里的一段范围；同一个进程里的多个组由KvNode统一接收rpc再分给它们
+// 各部分分开加锁：存储引擎自己处理读写并发；去重表和范围是读写锁，apply线程写、请求线程读；等待apply的请求在分片的m_waitApply里
+// m_lastSnapShotRaftLogIndex只在apply线程里访问
+// 范围会在运行中迁移（见rangeState.h），请求在进入时和apply时都检查key是否还在范围里，不在就回复ErrWrongGroup
 class KvServer : public raftKVRpcProctoc::kvServerRpc {
  private:
-  std::mutex m_mtx;
   int m_me;
+  int m_groupId;
+  // 保护m_rangeState，只有apply线程写，apply线程自己读不用加锁；和m_sessionMtx一起持有时先拿m_sessionMtx
+  mutable std::shared_mutex m_rangeMtx;
+  RangeState m_rangeState;
   std::shared_ptr<Raft> m_raftNode;
-  std::shared_ptr<LockQueue<ApplyMsg> > applyChan;  // kvServer和raft节点的通信管道
+  std::shared_ptr<MpscQueue<ApplyMsgBatch> > applyChan;  // kvServer和raft节点的通信管道，每次传一批
   int m_maxRaftState;                               // snapshot if log grows this big
 
   // Your definitions here.
   std::string m_serializedKVData;  // todo ： 序列化后的kv数据，理论上可以不用，但是目前没有找到特别好的替代方法
-  SkipList<std::string, std::string> m_skipList;
-  std::unordered_map<std::string, std::string> m_kvDB;
+  std::unique_ptr<KvEngine> m_engine;  // 状态机的数据，见kvEngine.h
+
+  // leader上ReadIndex读的热点key缓存；apply线程每次改存储引擎之后、markApplied之前让对应的key失效
+  HotKeyCache m_readCache;
+
+  // raft index -> 等待这条日志apply的请求，apply之后把日志里的Op交给它们核对
+  CompletionTable<Op> m_waitApply;
 
-  std::unordered_map<int, LockQueue<Op> *> waitApplyCh;
-  // index(raft) -> chan  //？？？字段含义   waitApplyCh是一个map，键是int，值是Op类型的管道
+  // 保护m_sessions和m_logClockMs；session按日志时间整体排序过期，各副本必须一致，所以不按client分片，只分读写
+  std::shared_mutex m_sessionMtx;
+  SessionTable m_sessions;  // 每个注册过的client最近执行过的requestId  //一个kV服务器可能连接多个client
+  int64_t m_logClockMs;     // apply过的日志里最大的Timestamp，session按它过期，与本机时钟无关
+  std::atomic<uint64_t> m_registerSeq{0};  // 区分本节点提交的Register日志和Range日志
 
-  std::unordered_map<std::string, int> m_lastRequestId;  // clientid -> requestID  //一个kV服务器可能连接多个client
+  // 负载统计，只增不减，KvNode按间隔取差值：本节点处理的请求数，apply的写操作数
+  std::atomic<uint64_t> m_requestCount{0};
+  std::atomic<uint64_t> m_appliedWriteCount{0};
 
   // last SnapShot point , raftIndex
   int m_lastSnapShotRaftLogIndex;
 
+  // 已经应用到存储引擎的最大raft index，ReadIndex读要等它追上readIndex
+  // 已经追上时读请求不加锁；没追上的读请求登记在m_applyWaiters里，apply线程只在有人等的时候才拿锁唤醒
+  std::atomic<int> m_lastAppliedIndex{0};
+  std::atomic<int> m_applyWaiters{0};
+  // 等待的是rpc worker上的协程，等的时候只挂起协程，不占住worker线程（apply可能就要在那个线程上执行）
+  std::mutex m_applyMtx;
+  monsoon::FiberCondVar m_applyCv;
+
+  // batch写入期间为奇数，BatchGet据此保证读到的多个key来自同一个状态
+  std::atomic<uint64_t> m_applySeq{0};
+
+  // 后台制作快照的线程，同一时间最多一个
+  std::thread m_snapshotThread;
+  std::atomic<bool> m_snapshotInProgress{false};
+
+  std::thread m_applyThread;
+
  public:
   KvServer() = delete;
 
-  KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port);
+  // owned为false时是没有范围的备用组；有快照时范围以快照里的为准
+  // engine和engineDir见NewKvEngine
+  KvServer(int me, int groupId, bool owned, KeyRange range, int maxraftstate, const std::string &engine = "",
+           const std::string &engineDir = "");
 
-  void StartKVServer();
+  // 连上其他节点之后调用：恢复持久化的状态，启动raft和apply线程，之后立即返回
+  // bootstrap是第一次启动时这个组的成员配置，见Raft::init
+  void StartKVServer(std::vector<std::shared_ptr<RaftRpcUtil> > peers, const raftRpcProctoc::Membership &bootstrap,
+                     std::shared_ptr<WalLog> wal, std::shared_ptr<monsoon::IOManager> ioManager);
+
+  int GroupId() const { return m_groupId; }
+  Raft *RaftNode() { return m_raftNode.get(); }
+
+  // 当前的范围和迁移进度，本节点apply到哪里就是哪里的状态
+  RangeState RangeSnapshot() const {
+    std::shared_lock<std::shared_mutex> lk(m_rangeMtx);
+    return m_rangeState;
+  }
+  // keys都在当前的范围里，keys为空时只要求组存在
+  template <typename Keys>
+  bool Owns(const Keys &keys) const {
+    std::shared_lock<std::shared_mutex> lk(m_rangeMtx);
+    for (const std::string &key : keys) {
+      if (!m_rangeState.contains(key)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  bool Owns(const std::string &key) const { return Owns(std::vector<std::string>{key}); }
+
+  struct LoadStats {
+    int keys;                   // 存储引擎里的key数
+    uint64_t requests;          // 本节点处理过的请求数
+    uint64_t appliedWrites;     // apply过的写操作数，所有副本一样
+  };
+  LoadStats Load() { return {m_engine->Size(), m_requestCount.load(), m_appliedWriteCount.load()}; }
+  // 范围里位于中间的key，作为分裂点；不到两个key时返回false
+  bool SplitKey(std::string *key);
+  // range里的全部kv，作为Accept的数据，格式见RangeCommand::data
+  std::string EncodeRangeData(const KeyRange &range);
+
+  // 提交一条Range日志并等它apply，返回OK或ErrWrongLeader；*result是apply的结果：OK，条件不满足时是ErrWrongGroup
+  // *index是这条日志的index，Reserve成功时就是迁移的id
+  std::string ProposeRange(const RangeCommand &cmd, std::string *result, int *index);
+  // 其他节点推进迁移时发来的，见RangeAdminArgs
+  void RangeAdmin(const raftRpcProctoc::RangeAdminArgs *args, raftRpcProctoc::RangeAdminReply *reply);
+  // apply线程不会结束，一直阻塞
+  void WaitApplyLoop();
 
   void DprintfKVDB();
 
+  // 在apply线程里调用；旧日志里的"Append"，和Put一样覆盖
   void ExecuteAppendOpOnKVDB(Op op);
+  // 在apply线程里调用；"AppendV2"，接在原来的值后面
+  void ExecuteAppendV2OpOnKVDB(const Op &op);
 
   void ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist);
 
+  // 在apply线程里调用
   void ExecutePutOpOnKVDB(Op op);
 
+  // 按顺序执行batch里的每个写入，在apply线程里调用
+  void ExecuteBatchOpOnKVDB(const Op &op);
+  // CompareAndSwap和Increment，在apply线程里调用；结果写进*err和*value，见PutAppendReply
+  void ExecuteCompareAndSwapOpOnKVDB(const Op &op, std::string *err, std::string *value);
+  void ExecuteIncrementOpOnKVDB(const Op &op, std::string *err, std::string *value);
+  // 写操作的key是否都在当前范围里，在apply线程里调用时不用加锁
+  bool opInRangeLocked(const Op &op) const;
+  // apply一条Range日志，返回条件是否满足，调用前需持有m_sessionMtx的写锁，见rangeState.h
+  bool applyRangeLocked(const RangeCommand &cmd, int raftIndex);
+  // 读多个key，不会看到执行了一半的batch
+  void BatchGetKVDB(const raftKVRpcProctoc::BatchGetArgs *args, raftKVRpcProctoc::BatchGetReply *reply);
+
+  // 在存储引擎上做有序扫描，结果和下一页的token直接写入reply
+  void ExecuteScanOpOnKVDB(Op op, const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply);
+  void ScanKVDB(const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply);
+
+  // 等待状态机应用到raftIndex，超时返回false
+  bool WaitApplied(int raftIndex);
+  // 记录已经应用到raftIndex并唤醒等待的读请求，在apply线程里调用
+  void markApplied(int raftIndex);
+
   void Get(const raftKVRpcProctoc::GetArgs *args,
            raftKVRpcProctoc::GetReply
                *reply);  //将 GetArgs 改为rpc调用的，因为是远程客户端，即服务器宕机对客户端来说是无感的
   /**
    * 從raft節點中獲取消息  （不要誤以爲是執行【GET】命令）
-   * @param message
+   * 一批连续的日志在一次加锁里执行，然后一起唤醒等待的请求
    */
-  void GetCommandFromRaft(ApplyMsg message);
-
-  bool ifRequestDuplicate(std::string ClientId, int RequestId);
+  void GetCommandsFromRaft(const ApplyMsg *messages, int n);
+
+  bool ifRequestDuplicate(uint64_t ClientId, int RequestId);
+  // 调用前需持有m_sessionMtx（读锁即可）
+  bool ifRequestDuplicateLocked(uint64_t ClientId, int RequestId);
+  // 这个请求是client最后一次执行的原子操作时取出当时的结果
+  bool lastAtomicResult(uint64_t ClientId, int RequestId, std::string *err, std::string *value);
+  // apply一条client的操作：session不存在（过期了）时什么都不做，已经执行过的写操作也不再执行，调用前需持有m_sessionMtx的写锁
+  // CompareAndSwap/Increment执行了，或者是重复的但结果还留在session里时把结果编码进*result（见encodeAtomicResult），
+  // 其他情况不动它
+  void applyCommandLocked(const Op &op, std::string *result);
 
   // clerk 使用RPC远程调用
   void PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcProctoc::PutAppendReply *reply);
 
+  // 与Get一样先用ReadIndex确认线性一致，再在本地存储引擎上扫描
+  void Scan(const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply);
+
+  // 写入op并等它apply，返回OK、ErrWrongLeader（让clerk换节点重试）、ErrSessionExpired，
+  // 或者ErrWrongGroup：apply时key已经不在这个组的范围里，没有执行
+  std::string ProposeAndWait(const Op &op);
+  // apply之后请求没有被记下时的原因
+  std::string notExecutedErr(const Op &op);
+
+  // 所有写入作为一条日志提交，一起生效
+  void BatchPut(const raftKVRpcProctoc::BatchPutArgs *args, raftKVRpcProctoc::BatchPutReply *reply);
+  void BatchGet(const raftKVRpcProctoc::BatchGetArgs *args, raftKVRpcProctoc::BatchGetReply *reply);
+
+  // 提交一条Register日志，它的index就是新session的id
+  void RegisterClient(const raftKVRpcProctoc::RegisterClientArgs *args, raftKVRpcProctoc::RegisterClientReply *reply);
+
   ////一直等待raft传来的applyCh
   void ReadRaftApplyCommandLoop();
 
   void ReadSnapShotToInstall(std::string snapshot);
 
-  bool SendMessageToWaitChan(const Op &op, int raftIndex);
-
   // 检查是否需要制作快照，需要的话就向raft之下制作快照
   void IfNeedToSendSnapShotCommand(int raftIndex, int proportion);
 
@@ -87,6 +228,27 @@ class KvServer : public raftKVRpcProctoc::kvServerRpc {
 
   std::string MakeSnapShot();
 
+  // 在当前apply位置定下一个时间点，后台线程序列化完成后再调用Raft::Snapshot，apply线程不用等待
+  void MakeSnapShotInBackground(int raftIndex);
+
+  // 等待正在进行的后台快照结束
+  void WaitBackgroundSnapShot();
+
+  // 让clerk换节点时告诉它leader是谁，省得挨个去试
+  template <typename Reply>
+  void setLeaderHint(Reply *reply) {
+    if (reply->err() != ErrWrongLeader) {
+      return;
+    }
+    int leaderId = -1;
+    int term = 0;
+    m_raftNode->GetLeaderHint(&leaderId, &term);
+    if (leaderId >= 0) {
+      reply->set_leaderid(leaderId);
+      reply->set_leaderterm(term);
+    }
+  }
+
  public:  // for rpc
   void PutAppend(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::PutAppendArgs *request,
                  ::raftKVRpcProctoc::PutAppendReply *response, ::google::protobuf::Closure *done) override;
@@ -94,6 +256,19 @@ class KvServer : public raftKVRpcProctoc::kvServerRpc {
   void Get(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetArgs *request,
            ::raftKVRpcProctoc::GetReply *response, ::google::protobuf::Closure *done) override;
 
+  void Scan(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ScanArgs *request,
+            ::raftKVRpcProctoc::ScanReply *response, ::google::protobuf::Closure *done) override;
+
+  void BatchPut(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::BatchPutArgs *request,
+                ::raftKVRpcProctoc::BatchPutReply *response, ::google::protobuf::Closure *done) override;
+
+  void BatchGet(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::BatchGetArgs *request,
+                ::raftKVRpcProctoc::BatchGetReply *response, ::google::protobuf::Closure *done) override;
+
+  void RegisterClient(google::protobuf::RpcController *controller,
+                      const ::raftKVRpcProctoc::RegisterClientArgs *request,
+                      ::raftKVRpcProctoc::RegisterClientReply *response, ::google::protobuf::Closure *done) override;
+
   /////////////////serialiazation start ///////////////////////////////
   // notice ： func serialize
  private:
@@ -108,24 +283,101 @@ class KvServer : public raftKVRpcProctoc::kvServerRpc {
     ar &m_serializedKVData;
 
     // ar & m_kvDB;
-    ar &m_lastRequestId;
+    // 只用来读取旧的boost文本快照，里面每个client只有最后一个requestId
+    std::unordered_map<std::string, int> lastRequestId;
+    ar &lastRequestId;
+    m_sessions.clear();
+    m_logClockMs = 0;
+    for (const auto &item : lastRequestId) {
+      addLegacySession(item.first, item.second)->requests.fillAll();
+    }
+  }
+
+  // 旧格式快照里的client没有session，按字符串id补建，它们在第一条带时间的日志apply时就会过期
+  ClientSession *addLegacySession(const std::string &clientId, int maxRequestId) {
+    ClientSession *session = m_sessions.create(Op::legacyClientId(clientId), 0);
+    session->requests.maxRequestId = maxRequestId;
+    return session;
   }
 
+  // 快照格式： "KVS5" | fixed64 日志时间 | session表（见SessionTable::encode） | 范围（见RangeState::encode） | 存储引擎的快照（跳表的二进制快照格式）
+  // "KVS4"的session里没有最后一次原子操作的结果，"KVS3"没有范围，用构造时的范围；"KVS2"里是fixed32 n | n * (clientId | fixed32 maxRequestId | fixed32 m | m * fixed64 窗口)，
+  // "KVS1"没有窗口
+  // 全部直接写入同一个string，不再经过boost文本归档做多次拷贝
   std::string getSnapshotData() {
-    m_serializedKVData = m_skipList.dump_file();
-    std::stringstream ss;
-    boost::archive::text_oarchive oa(ss);
-    oa << *this;
-    m_serializedKVData.clear();
-    return ss.str();
+    std::string out;
+    encodeSnapshotHeader(&out);
+    m_engine->DumpTo(&out);
+    return out;
+  }
+
+  // 调用前需持有m_sessionMtx（读锁即可）
+  void encodeSnapshotHeader(std::string *out) const {
+    out->append(KVSERVER_SNAPSHOT_MAGIC, sizeof(KVSERVER_SNAPSHOT_MAGIC));
+    PutFixed64(out, static_cast<uint64_t>(m_logClockMs));
+    m_sessions.encode(out);
+    m_rangeState.encode(out);
+  }
+
+  static bool hasMagic(const char *data, size_t len, const char (&magic)[4]) {
+    return len >= sizeof(magic) && memcmp(data, magic, sizeof(magic)) == 0;
   }
 
-  void parseFromString(const std::string &str) {
-    std::stringstream ss(str);
-    boost::archive::text_iarchive ia(ss);
-    ia >> *this;
-    m_skipList.load_file(m_serializedKVData);
-    m_serializedKVData.clear();
+  void parseFromString(const std::string &str) { parseFromArray(str.data(), str.size()); }
+
+  // data可以直接指向mmap的快照文件，存储引擎从里面解码，不需要先整个拷贝出来
+  void parseFromArray(const char *data, size_t len) {
+    int version = hasMagic(data, len, KVSERVER_SNAPSHOT_MAGIC)      ? 5
+                  : hasMagic(data, len, KVSERVER_SNAPSHOT_MAGIC_V4) ? 4
+                  : hasMagic(data, len, KVSERVER_SNAPSHOT_MAGIC_V3) ? 3
+                  : hasMagic(data, len, KVSERVER_SNAPSHOT_MAGIC_V2) ? 2
+                  : hasMagic(data, len, KVSERVER_SNAPSHOT_MAGIC_V1) ? 1
+                                                                    : 0;
+    if (version == 0) {
+      // 旧版本的boost文本快照
+      std::stringstream ss(std::string(data, len));
+      boost::archive::text_iarchive ia(ss);
+      ia >> *this;
+      bool ok = m_engine->Load(m_serializedKVData.data(), m_serializedKVData.size());
+      myAssert(ok, format("[KvServer::parseFromString-kvserver{%d}] bad snapshot", m_me));
+      m_serializedKVData.clear();
+      return;
+    }
+    SnapshotReader reader(data + sizeof(KVSERVER_SNAPSHOT_MAGIC), len - sizeof(KVSERVER_SNAPSHOT_MAGIC));
+    bool ok = true;
+    if (version >= 3) {
+      uint64_t clock = 0;
+      ok = reader.GetFixed64(&clock) && m_sessions.decode(&reader, version >= 5);
+      m_logClockMs = static_cast<int64_t>(clock);
+      if (ok && version >= 4) {
+        RangeState state;
+        ok = state.decode(&reader);
+        std::unique_lock<std::shared_mutex> lk(m_rangeMtx);
+        m_rangeState = std::move(state);
+      }
+    } else {
+      m_sessions.clear();
+      m_logClockMs = 0;
+      uint32_t n = 0;
+      ok = reader.GetFixed32(&n);
+      for (uint32_t i = 0; ok && i < n; ++i) {
+        std::string clientId;
+        uint32_t requestId = 0;
+        ok = DecodeSnapshotField(&reader, &clientId) && reader.GetFixed32(&requestId);
+        RequestWindow &window = addLegacySession(clientId, static_cast<int>(requestId))->requests;
+        if (version == 1) {
+          window.fillAll();
+          continue;
+        }
+        uint32_t m = 0;
+        ok = ok && reader.GetFixed32(&m) && m <= RequestWindow::kWords;
+        for (uint32_t j = 0; ok && j < m; ++j) {
+          ok = reader.GetFixed64(&window.bits[j]);
+        }
+      }
+    }
+    ok = ok && m_engine->Load(reader.data(), reader.remaining());
+    myAssert(ok, format("[KvServer::parseFromString-kvserver{%d}] bad snapshot", m_me));
   }
 
   /////////////////serialiazation end ///////////////////////////////
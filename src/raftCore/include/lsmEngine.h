@@ -0,0 +1,95 @@
+#ifndef SKIP_LIST_ON_RAFT_LSMENGINE_H
+#define SKIP_LIST_ON_RAFT_LSMENGINE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "config.h"
+#include "kvEngine.h"
+#include "sstable.h"
+
+/**
+ * memtable + 分层的SSTable（LSM）
+ * 写入进memtable（带hash索引的跳表，值带类型字节，删除写一条删除记录），写满后冻结，后台线程把冻结的memtable写成L0的文件；
+ * L0的文件互相重叠，个数够了整体合并进L1；L1往下每层内部按key有序不重叠，超过大小上限时轮流挑一个文件合并进下一层
+ * 读的时候按 memtable -> 冻结的memtable（新的在前） -> L0（新的在前） -> L1 ... 的顺序找，先找到的就是最新的
+ *
+ * 当前的内存表和文件列表是一个不可变的LsmVersion，读操作和迭代器只在开始时拿m_mtx复制一份shared_ptr，之后不加锁；
+ * 后台线程做完一次落盘或者合并后生成新版本替换，被替换掉的文件等最后一个引用它的版本放掉时才删除
+ *
+ * 文件只是这个进程的工作空间：raft快照里仍然是全部数据，重启时清空目录，从快照和日志里重新建立
+ */
+class LsmEngine : public KvEngine {
+ public:
+  explicit LsmEngine(const std::string &dir);
+  ~LsmEngine() override;
+
+  bool Get(const std::string &key, std::string *value) override;
+  void Put(const std::string &key, const std::string &value) override;
+  void Delete(const std::string &key) override;
+  std::unique_ptr<Iterator> NewIterator() override;
+  int Size() override;
+
+  bool BeginSnapshot() override;
+  void DumpSnapshot(std::string *out) override;
+  void DumpTo(std::string *out) override;
+  bool Load(const char *data, size_t len) override;
+  void Display() override;
+
+ private:
+  struct MemTable {
+    MemTable() : list(SKIPLIST_MAX_LEVEL, true) {}
+    SkipList<std::string, std::string> list;
+    std::atomic<long long> bytes{0};
+  };
+
+  struct LsmVersion {
+    std::shared_ptr<MemTable> mem;
+    std::vector<std::shared_ptr<MemTable> > imm;                 // 新的在前
+    std::vector<std::shared_ptr<SSTable> > levels[LSM_MAX_LEVELS];  // L0新的在前，其他层按Smallest升序
+  };
+
+  // 一次合并：inputs[0]是level层被选中的文件，inputs[1]是下一层和它们重叠的文件
+  struct Compaction {
+    int level = -1;
+    std::vector<std::shared_ptr<SSTable> > inputs[2];
+  };
+
+  class MergingIterator;
+
+  std::shared_ptr<const LsmVersion> current();
+  // 把记录写进当前的memtable，写满了就冻结
+  void write(const std::string &key, const std::string &record);
+  // 调用前持有m_mtx；冻结当前的memtable，空的不冻结；冻结的太多时等后台线程
+  void freezeMemTable(std::unique_lock<std::mutex> &lk);
+  void backgroundLoop();
+  // 调用前持有m_mtx，没有事情做时返回false
+  bool pickCompaction(const LsmVersion &version, Compaction *c);
+  // 把it里的记录写成一个或多个文件；dropDeletions时删除记录不再写出
+  // 返回false时已经写出的文件都删掉了
+  template <typename It>
+  bool writeTables(It &it, bool dropDeletions, std::vector<std::shared_ptr<SSTable> > *outputs);
+  std::string tablePath(uint64_t number) const;
+  static uint64_t levelLimit(int level);
+
+  std::string m_dir;
+  std::mutex m_mtx;
+  std::condition_variable m_cv;           // 后台线程等活干，写入等冻结的memtable落盘
+  std::shared_ptr<const LsmVersion> m_current;
+  std::atomic<uint64_t> m_nextFileNumber;
+  uint64_t m_generation;                  // Load整体替换内容时加一，后台线程据此丢弃替换前开始的落盘和合并
+  std::string m_compactCursor[LSM_MAX_LEVELS];  // 每层上次合并到的位置，轮流挑文件
+  bool m_stop;
+
+  // BeginSnapshot时的版本（不含当时的memtable，它已经被冻结进imm），DumpSnapshot读它
+  std::shared_ptr<const LsmVersion> m_snapshotVersion;
+  std::atomic<bool> m_snapshotActive{false};
+
+  std::thread m_background;
+};
+
+#endif  // SKIP_LIST_ON_RAFT_LSMENGINE_H
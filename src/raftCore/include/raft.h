@@ -5,6 +5,7 @@
 #include <boost/serialization/vector.hpp>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -17,6 +18,8 @@
 #include "boost/serialization/serialization.hpp"
 #include "config.h"
 #include "monsoon.h"
+#include "mpscQueue.h"
+#include "raftLog.h"
 #include "raftRpcUtil.h"
 #include "util.h"
 /// @brief //////////// 网络状态表示  todo：可以在rpc中删除该字段，实际生产中是用不到的.
@@ -34,12 +37,14 @@ constexpr int Normal = 3;
 class Raft : public raftRpcProctoc::raftRpc {
  private:
   std::mutex m_mtx;
+  // 下标是节点号，有RAFT_MAX_NODES个，不是成员的位置不用；一个节点号的连接建好之后不再替换
   std::vector<std::shared_ptr<RaftRpcUtil>> m_peers;
   std::shared_ptr<Persister> m_persister;
   int m_me;                                       // 当前节点ID
+  int m_groupId = 0;                              // 同一个进程里可以有多个raft组，发出的rpc都带上组号
   int m_currentTerm;
   int m_votedFor;
-  std::vector<raftRpcProctoc::LogEntry> m_logs;  // 日志条目数组，包含了状态机要执行的指令集，以及收到领导时的任期号
+  RaftLogStore m_logs;  // 日志条目数组，包含了状态机要执行的指令集，以及收到领导时的任期号
                                                  // 这两个状态所有结点都在维护，易失
   int m_commitIndex;
   int m_lastApplied;  // 已经汇报给状态机（上层应用）的log 的index
@@ -52,28 +57,105 @@ class Raft : public raftRpcProctoc::raftRpc {
   // 身份
   Status m_status;
 
-  std::shared_ptr<LockQueue<ApplyMsg>> applyChan;  // client从这里取日志（2B），client与raft通信的接口
+  std::shared_ptr<MpscQueue<ApplyMsgBatch>> applyChan;  // client从这里取日志（2B），client与raft通信的接口
+  monsoon::FiberCondVar m_applierCv;  // commitIndex前进时唤醒applierTicker
   
 
   // 选举超时
   std::chrono::_V2::system_clock::time_point m_lastResetElectionTime;
-  // 心跳超时，用于leader
-  std::chrono::_V2::system_clock::time_point m_lastResetHearBeatTime;
+  // 当前这次定时用的随机超时时间
+  std::chrono::milliseconds m_electionTimeout{0};
+  // 最近一次收到当前leader的AE或快照的时间，租约读模式下这之后minRandomizedElectionTime内不给别人投票
+  std::chrono::system_clock::time_point m_lastLeaderContactTime;
+  // 最近一次联系上的leader和它的term，term不等于m_currentTerm时说明已经不知道leader是谁了
+  int m_leaderId;
+  int m_leaderTerm;
+
+  // ReadIndex：每个follower最近一次确认的AE的发送时间，多数派的确认时间晚于读请求到达时间就说明发出请求时自己仍是leader
+  std::vector<std::chrono::system_clock::time_point> m_ackSendTime;
+  // 收到确认或者身份变化时通知等待ReadIndex（以及TransferLeadership、ChangeMembership）的请求
+  // 等待的是rpc worker上的协程，用协程的条件变量，等一轮心跳期间让出线程给别的请求
+  monsoon::FiberCondVar m_readCv;
+
+  // 日志复制：每个follower有RAFT_MAX_INFLIGHT_APPENDS个replicator协程，共享它的nextIndex
+  // 有新日志、身份变化或收到回复时唤醒所有挂起的replicator
+  struct ReplicatorWaiter {
+    monsoon::Fiber::ptr fiber;
+    pid_t thread;  // 挂起时所在的线程，只在这个线程上恢复
+    bool woken = false;
+    // 带超时的等待的定时器，先被信号唤醒时取消掉，不留下到时才去抢m_mtx的回调
+    monsoon::Timer::ptr timer;
+  };
+  std::vector<std::shared_ptr<ReplicatorWaiter>> m_replicatorWaiters;
+  std::vector<int> m_inflight;            // 每个follower在途的rpc数量
+  std::vector<bool> m_replicating;        // false：探测nextIndex，只允许一个在途；true：可以流水线发送
+  std::vector<int> m_pipelineEpoch;  // nextIndex每次回退加一，之前发出的AE的失败回复不再处理
+  std::vector<std::chrono::system_clock::time_point> m_lastSendTime;  // 超过HeartBeatTimeout没发过就发心跳
+  // 分块发送快照的进度：follower确认收到的offset，断线之后同一个快照从这里接着发
+  struct SnapshotTransfer {
+    int lastIncludedIndex = 0;
+    long long offset = 0;
+  };
+  std::vector<SnapshotTransfer> m_snapshotTransfers;
+  // 正在把领导权交给谁，-1表示没有；交出期间不接受新的提议，也不再用租约读，新leader可能已经当选
+  int m_leadTransferee = -1;
+  std::chrono::system_clock::time_point m_leadTransferTime;
+  // 当选的时间，刚当选的一个选举超时内还没有机会收到多数派的回复，不做CheckQuorum
+  std::chrono::system_clock::time_point m_leaderSince;
+  // 第几轮预投票，旧一轮的回复不再计数
+  int m_preVoteRound = 0;
+
+  // 成员配置：每次只增删一个投票成员，新配置写进日志（或者从leader收到）就生效，不等提交，见ChangeMembership
+  // 选举、提交、ReadIndex和CheckQuorum的多数派都只算投票成员；learner照常复制日志，落后太多时收快照
+  enum Role { NonMember, Voter, Learner };
+  raftRpcProctoc::Membership m_snapshotMembership;  // 快照点的配置，没有快照时是启动配置
+  std::vector<std::pair<int, raftRpcProctoc::Membership>> m_configLog;  // 快照点之后日志里的配置，index升序
+  std::vector<Role> m_roles;        // 按当前配置，下标是节点号
+  int m_voters = 0;
+  std::vector<int> m_replicatorCount;  // 每个节点正在运行的replicator协程数，被移除的成员的replicator自己退出
 
   // 2D中用于传入快照点
   // 储存了快照中的最后一个日志的Index和Term
   int m_lastSnapshotIncludeIndex;
   int m_lastSnapshotIncludeTerm;
 
-  // 协程
-  std::unique_ptr<monsoon::IOManager> m_ioManager = nullptr;
+  // 已经写入persister的状态，persist()只写和它不同的部分
+  int m_persistedTerm;
+  int m_persistedVotedFor;
+  int m_persistedLastLogIndex;
+
+  // 协程，同一个进程里的raft组共用
+  std::shared_ptr<monsoon::IOManager> m_ioManager = nullptr;
+
+  // 合并并发的Start：提议放在调用者的栈上，由当时的combiner一起写进日志后把done置为true
+  struct Proposal {
+    std::string command;
+    int index = -1;
+    int term = -1;
+    bool isLeader = false;
+    bool done = false;
+    int64_t proposedUs = 0;  // 进入Start的时间
+  };
+  std::mutex m_proposeMtx;  // 保护下面三个，不和m_mtx同时持有
+  monsoon::FiberCondVar m_proposeCv;  // 等combiner的提议者是rpc worker上的协程，等待时让出线程
+  std::vector<Proposal *> m_proposals;
+  bool m_proposing = false;  // 是否已经有combiner
+
+  // leader上最近RAFT_TRACE_RING条日志各阶段的时间（MetricsNowUs），按index取模存放，后来的index覆盖前面的
+  // 由m_mtx保护；提交时用来算 写入->提交 的延迟，apply时把提交时间带给上层
+  struct ProposalTrace {
+    int index = 0;
+    int64_t appendedUs = 0;
+    int64_t committedUs = 0;
+  };
+  std::vector<ProposalTrace> m_traces;
 
  public:
   //处理AppendEntries RPC的核心逻辑
   void AppendEntries1(const raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *reply);
 
-   //日志应用定时器
-   //功能：定期检查已提交但未应用的日志，将其封装为ApplyMsg并推送到applyChan，供上层应用处理
+   //日志应用线程
+   //功能：commitIndex前进时把已提交但未应用的日志整批推送到applyChan，供上层应用处理
   void applierTicker();
 
   /**
@@ -87,14 +169,28 @@ class Raft : public raftRpcProctoc::raftRpc {
   bool CondInstallSnapshot(int lastIncludedTerm, int lastIncludedIndex, std::string snapshot);
 
 
-  void doElection();
+  // transfer为true时是收到TimeoutNow之后的选举，投票的节点不用管租约
+  void doElection(bool transfer = false);
+  // 预投票，多数派认可之后才调用doElection，见RAFT_PRE_VOTE
+  void doPreVote();
   
-  //发起心跳，只有leader才需要发起心跳
+  //让所有replicator立即发送心跳，只有leader才需要发起心跳，调用前需持有m_mtx
   void doHeartBeat();
+  // 按m_nextIndex[server]构造AE，调用前需持有m_mtx
+  void buildAppendEntriesArgs(int server, raftRpcProctoc::AppendEntriesArgs *args);
+  // 向server复制日志的常驻协程，有新日志立即发送，空闲时发送心跳
+  void replicator(int server);
+  // 挂起当前replicator协程直到notifyReplicators或超时（timeoutMs < 0 不超时），调用前持有m_mtx
+  void waitReplicateSignal(std::unique_lock<std::mutex> &lk, int64_t timeoutMs);
+  void wakeReplicator(const std::shared_ptr<ReplicatorWaiter> &waiter);
+  // 调用前需持有m_mtx
+  void notifyReplicators();
 
-  // 每隔一段时间检查睡眠时间内有没有重置定时器，没有则说明超时了,负责监控节点是否长时间未收到 Leader 的心跳（或有效的 RPC），并在超时后触发新的选举（doElection()
-  // 如果有则设置合适睡眠时间：睡眠到重置时间+超时时间
+  // 选举定时器的回调，检查定时期间有没有重置定时器，没有则说明超时了，负责监控节点是否长时间未收到 Leader 的心跳（或有效的 RPC），并在超时后触发新的选举（doElection()
+  // 有则按重置时间+超时时间重新定时
   void electionTimeOutTicker();
+  // 按m_lastResetElectionTime加一个随机超时时间设置选举定时器
+  void armElectionTimer();
 
   /**
    * @brief 获取需应用的日志
@@ -109,19 +205,55 @@ class Raft : public raftRpcProctoc::raftRpc {
   void getPrevLogInfo(int server, int *preIndex, int *preTerm);
   //获取当前节点状态
   void GetState(int *term, bool *isLeader);
+  // 本节点知道的当前term的leader，不知道时*leaderId为-1
+  void GetLeaderHint(int *leaderId, int *term);
   //处理InstallSnapshot RPC  Follower 日志落后于 Leader 过多（甚至落后于 Leader 已压缩的快照）时，通过接收并安装 Leader 的快照快照来快速同步状态
   void InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest *args,
                        raftRpcProctoc::InstallSnapshotResponse *reply);
-  //定期触发领导者发送心跳（调用doHeartBeat），维持领导地位
-  void leaderHearBeatTicker();
   //领导者向指定服务器发送快照,当跟随者日志落后过多时，领导者直接发送快照而非逐条日志，减少数据传输
   void leaderSendSnapShot(int server);
-  //领导者更新提交索引
+  //领导者根据投票成员的m_matchIndex（包括自己）更新提交索引
   void leaderUpdateCommitIndex();
+  // 选举成功，初始化nextIndex、matchIndex，调用前需持有m_mtx
+  void becomeLeader();
   //验证日志是否匹配
   bool matchLog(int logIndex, int logTerm);
+  // 把领导权交给target（小于0时选日志最新的follower）：先停止接受提议，等target追上日志之后发送TimeoutNow让它立即选举
+  // 阻塞到TimeoutNow发出，最多RAFT_LEAD_TRANSFER_TIMEOUT_MS；成功只表示TimeoutNow已经发出，target当选之后本节点收到更大的term才下台
+  // target没有及时当选时恢复接受提议
+  bool TransferLeadership(int target);
+  void TimeoutNow(const raftRpcProctoc::TimeoutNowArgs *args, raftRpcProctoc::TimeoutNowReply *reply);
+  /**
+   * 成员变更，只有leader能做：kind见util.h里的AddLearner等，写一条带着新配置的日志，等它提交，最多CONSENSUS_TIMEOUT
+   * 新节点先作为learner加入，追上日志之后再提升为投票成员；leader把自己移除时，配置提交之后下台
+   * @return OK；ErrWrongLeader；ErrBadRequest：变更不合法；ErrMembershipBusy：上一次变更还没提交、
+   * 本term还没有提交过日志或者learner还没追上，稍后再试
+   */
+  std::string ChangeMembership(int kind, int nodeId, const std::string &ip, int port);
+  // node是不是当前配置里的投票成员
+  bool IsVoter(int node);
+  // 以下调用前需持有m_mtx
+  const raftRpcProctoc::Membership &currentMembership();
+  // 日志index处生效的配置，index不能早于快照点
+  const raftRpcProctoc::Membership &membershipAt(int index);
+  // 配置变了之后调用：更新m_roles，给新成员建连接、启动replicator，已经不是成员的replicator醒来之后退出
+  void applyMembership();
+  // 投票成员的多数派
+  int quorum() const { return m_voters / 2 + 1; }
+  // leader已经不是投票成员，并且这个配置已经提交时下台
+  void stepDownIfRemoved();
+  // 投票成员的多数派（包括自己）确认的AE中，最晚的发送时间不早于t，调用前需持有m_mtx
+  bool quorumAckedSince(std::chrono::system_clock::time_point t);
+  // 租约读模式下leader的租约是否还有效，以及follower是不是还在承诺不投票的时间内，调用前需持有m_mtx
+  bool inReadLease();
+
+  // init的最后调用，在Metrics里注册本组的gauge
+  void registerMetrics();
 
+  // 只把变化的term/votedFor和尚未写入的新日志追加到WAL
   void persist();
+  // 丢弃 index >= logIndex 的日志（内存和WAL）
+  void truncateLogSuffix(int logIndex);
   void RequestVote(const raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *reply);
   //判断候选者日志是否更新
   bool UpToDate(int index, int term);
@@ -137,19 +269,38 @@ class Raft : public raftRpcProctoc::raftRpc {
   int GetRaftStateSize();
   //将日志全局索引转换为本地日志数组的下标
   int getSlicesIndexFromLogIndex(int logIndex);
+  // (快照点, hi]里第一条term >= term的日志，没有就返回hi + 1；term沿日志单调不减，二分查找
+  int firstLogIndexWithTermAtLeast(int term, int hi);
 
   bool sendRequestVote(int server, std::shared_ptr<raftRpcProctoc::RequestVoteArgs> args,
                        std::shared_ptr<raftRpcProctoc::RequestVoteReply> reply, std::shared_ptr<int> votedNum);
-  bool sendAppendEntries(int server, std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> args,
-                         std::shared_ptr<raftRpcProctoc::AppendEntriesReply> reply, std::shared_ptr<int> appendNums);
+  void sendPreVote(int server, std::shared_ptr<raftRpcProctoc::RequestVoteArgs> args,
+                   std::shared_ptr<raftRpcProctoc::RequestVoteReply> reply, std::shared_ptr<int> granted, int round);
+  // sendTime是这次AE的发送时间，回复用来确认ReadIndex
+  bool sendAppendEntries(int server, const raftRpcProctoc::AppendEntriesArgs* args,
+                         raftRpcProctoc::AppendEntriesReply* reply, int epoch,
+                         std::chrono::system_clock::time_point sendTime);
 
-  //将ApplyMsg推送到KV服务
+  //将ApplyMsg推送到KV服务，调用前需持有m_mtx，保证和applierTicker推送的日志之间的顺序
   void pushMsgToKvServer(ApplyMsg msg);
   //从持久化数据恢复Raft状态
-  void readPersist(std::string data);
-  std::string persistData();
+  void readPersist();
 
+  // 并发调用时会合并成一批，一次persist、一次唤醒replicator
   void Start(Op command, int *newLogIndex, int *newLogTerm, bool *isLeader);
+  // 把一批提议追加到日志并persist，不是leader时返回false
+  bool appendProposals(const std::vector<Proposal *> &batch, int *lastLogIndex, int *term);
+
+  /**
+   * 线性一致读，不写日志：确认自己此刻仍是leader后返回commitIndex，上层等apply到readIndex后直接读本地状态
+   * 确认方式是一轮心跳得到多数派回复；打开RAFT_READ_LEASE时在租约内不用等心跳
+   * @return 失败时*isLeader为true表示刚当选还没有提交过本term的日志，commitIndex不可信，需要走日志读
+   */
+  bool ReadIndex(int *readIndex, bool *isLeader);
+  // follower读：向当前leader要readIndex，不知道leader或者leader确认失败时返回false
+  bool FollowerReadIndex(int *readIndex);
+  // 允许读旧数据的follower读：maxStalenessMs内联系过leader就直接用本地的commitIndex
+  bool StaleReadIndex(int maxStalenessMs, int *readIndex);
 
   
   // index代表是快照apply应用的index,而snapshot代表的是上层service传来的快照字节流，包括了Index之前的数据
@@ -167,37 +318,18 @@ class Raft : public raftRpcProctoc::raftRpc {
                        ::raftRpcProctoc::InstallSnapshotResponse *response, ::google::protobuf::Closure *done) override;
   void RequestVote(google::protobuf::RpcController *controller, const ::raftRpcProctoc::RequestVoteArgs *request,
                    ::raftRpcProctoc::RequestVoteReply *response, ::google::protobuf::Closure *done) override;
+  void ReadIndex(google::protobuf::RpcController *controller, const ::raftRpcProctoc::ReadIndexArgs *request,
+                 ::raftRpcProctoc::ReadIndexReply *response, ::google::protobuf::Closure *done) override;
+  void TimeoutNow(google::protobuf::RpcController *controller, const ::raftRpcProctoc::TimeoutNowArgs *request,
+                  ::raftRpcProctoc::TimeoutNowReply *response, ::google::protobuf::Closure *done) override;
 
  public:
-  void init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
-            std::shared_ptr<LockQueue<ApplyMsg>> applyCh);
-
- private:
-  // for persist
-
-  class BoostPersistRaftNode {
-   public:
-    friend class boost::serialization::access;
-    // When the class Archive corresponds to an output archive, the
-    // & operator is defined similar to <<.  Likewise, when the class Archive
-    // is a type of input archive the & operator is defined similar to >>.
-    template <class Archive>
-    void serialize(Archive &ar, const unsigned int version) {
-      ar &m_currentTerm;
-      ar &m_votedFor;
-      ar &m_lastSnapshotIncludeIndex;
-      ar &m_lastSnapshotIncludeTerm;
-      ar &m_logs;
-    }
-    int m_currentTerm;
-    int m_votedFor;
-    int m_lastSnapshotIncludeIndex;
-    int m_lastSnapshotIncludeTerm;
-    std::vector<std::string> m_logs;
-    std::unordered_map<std::string, int> umap;
-
-   public:
-  };
+  // peers的下标是节点号，自己是nullptr；bootstrap是没有持久化的配置时（第一次启动）的成员配置
+  // 不在bootstrap里的节点启动之后只等leader把它加进来，不会发起选举
+  // ioManager为空时自己创建一个
+  void init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, const raftRpcProctoc::Membership &bootstrap, int me,
+            std::shared_ptr<Persister> persister, std::shared_ptr<MpscQueue<ApplyMsgBatch>> applyCh, int groupId = 0,
+            std::shared_ptr<monsoon::IOManager> ioManager = nullptr);
 };
 
 #endif  // RAFT_H
\ No newline at end of file
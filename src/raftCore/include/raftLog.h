@@ -0,0 +1,91 @@
+#ifndef SKIP_LIST_ON_RAFT_RAFTLOG_H
+#define SKIP_LIST_ON_RAFT_RAFTLOG_H
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "raftRPC.pb.h"
+
+/**
+ * raft内存里的日志，按kBlockSize条一块分块存放，下标是在日志里的物理位置（从0开始），和logIndex的换算由Raft负责
+ * 快照丢掉前缀只移动起点、整块释放，截断后缀只释放被截掉的条目，都不会挪动或者拷贝剩下的日志
+ * 起点所在的那一块里已经丢掉的条目要等整块都被丢掉时才释放，最多多占一块的内存
+ */
+class RaftLogStore {
+ public:
+  using Entry = raftRpcProctoc::LogEntry;
+  static constexpr size_t kBlockSize = 256;
+
+  bool empty() const { return m_size == 0; }
+  size_t size() const { return m_size; }
+
+  Entry &operator[](size_t i) { return at(i); }
+  const Entry &operator[](size_t i) const { return const_cast<RaftLogStore *>(this)->at(i); }
+  Entry &back() { return at(m_size - 1); }
+
+  void push_back(const Entry &entry) { tailBlock()->push_back(entry); ++m_size; }
+  void push_back(Entry &&entry) { tailBlock()->push_back(std::move(entry)); ++m_size; }
+  void emplace_back(Entry &&entry) { push_back(std::move(entry)); }
+
+  // 丢掉前n条
+  void dropPrefix(size_t n) {
+    if (n >= m_size) {
+      clear();
+      return;
+    }
+    m_head += n;
+    m_size -= n;
+    while (m_head >= kBlockSize) {
+      m_blocks.pop_front();
+      m_head -= kBlockSize;
+    }
+  }
+
+  // 只保留前n条
+  void truncate(size_t n) {
+    if (n >= m_size) {
+      return;
+    }
+    if (n == 0) {
+      clear();
+      return;
+    }
+    size_t end = m_head + n;  // 相对第一块开头的结束位置
+    size_t blocks = (end + kBlockSize - 1) / kBlockSize;
+    while (m_blocks.size() > blocks) {
+      m_blocks.pop_back();
+    }
+    std::vector<Entry> &last = *m_blocks.back();
+    last.erase(last.begin() + static_cast<std::ptrdiff_t>(end - (blocks - 1) * kBlockSize), last.end());
+    m_size = n;
+  }
+
+  void clear() {
+    m_blocks.clear();
+    m_head = 0;
+    m_size = 0;
+  }
+
+ private:
+  Entry &at(size_t i) {
+    size_t pos = m_head + i;
+    return (*m_blocks[pos / kBlockSize])[pos % kBlockSize];
+  }
+
+  // 下一条应该写进的块，写满了就新开一块；除最后一块以外每块都是满的，所以最后一块的长度就是写入位置
+  std::vector<Entry> *tailBlock() {
+    if (m_blocks.empty() || m_blocks.back()->size() == kBlockSize) {
+      m_blocks.push_back(std::make_unique<std::vector<Entry> >());
+      m_blocks.back()->reserve(kBlockSize);
+    }
+    return m_blocks.back().get();
+  }
+
+  std::deque<std::unique_ptr<std::vector<Entry> > > m_blocks;
+  size_t m_head = 0;  // 第一条在第一块里的位置
+  size_t m_size = 0;
+};
+
+#endif  // SKIP_LIST_ON_RAFT_RAFTLOG_H
@@ -8,16 +8,21 @@
 #include "raftRPC.pb.h"
 
 /// @brief 维护当前节点对其他某一个结点的所有rpc发送通信的功能
-// 对于一个raft节点来说，对于任意其他的节点都要维护一个rpc连接，即MprpcChannel
+// 对于一个raft节点来说，对于任意其他的节点都要维护一个MprpcChannel，里面是RPC_CONNECTIONS_PER_PEER条连接
+// 连接是多路复用的，同一时间可以有多个在途的rpc；对端不可达时按退避重连，期间的rpc直接失败
 class RaftRpcUtil {
  private:
   raftRpcProctoc::raftRpc_Stub *stub_;
 
  public:
   //主动调用其他节点的三个方法,可以按照mit6824来调用，但是别的节点调用自己的好像就不行了，要继承protoc提供的service类才行
-  bool AppendEntries(raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *response);
+  bool AppendEntries(const raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *response);
   bool InstallSnapshot(raftRpcProctoc::InstallSnapshotRequest *args, raftRpcProctoc::InstallSnapshotResponse *response);
   bool RequestVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response);
+  bool ReadIndex(raftRpcProctoc::ReadIndexArgs *args, raftRpcProctoc::ReadIndexReply *response);
+  bool TimeoutNow(raftRpcProctoc::TimeoutNowArgs *args, raftRpcProctoc::TimeoutNowReply *response);
+  // 对端的组要写日志，按CONSENSUS_TIMEOUT等
+  bool RangeAdmin(raftRpcProctoc::RangeAdminArgs *args, raftRpcProctoc::RangeAdminReply *response);
   //响应其他节点的方法
   /**
    *
@@ -0,0 +1,146 @@
+#ifndef SKIP_LIST_ON_RAFT_RANGESTATE_H
+#define SKIP_LIST_ON_RAFT_RANGESTATE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include "keyRange.h"
+#include "snapshotCodec.h"
+
+// 一段key范围从源组迁到目标组的过程，每一步都是对应组里的一条日志，见KvNode的负载均衡：
+//   目标组 Reserve(from, range)   预留，这条日志的index就是这次迁移的id
+//   源组   Handoff(to, id, range) 交出：范围里的key不再接受读写，旧值留在跳表里；不满足条件时拒绝
+//   目标组 Accept(from, id, data) 收下源组交出时的数据，范围并入自己的
+//   源组   HandoffDone(to, id)    确认目标组已经收下之后，删掉跳表里留着的旧值
+//   Handoff被拒绝时目标组 Unreserve(id)
+// 每一步都可以重复提交，leader换了之后由新的leader接着推进
+// 分裂：目标是备用组（没有范围），交出的是源组范围的后一半；合并：目标和源相邻，交出的是源的整个范围
+struct RangeMove {
+  int id = 0;  // 0表示没有
+  int group = -1;  // 对端的组
+  KeyRange range;
+};
+
+// 一个组的范围和迁移进度，只在apply日志时修改，所有副本上一样，记在快照里
+struct RangeState {
+  bool owned = true;  // false：备用组，没有范围
+  KeyRange range;
+  RangeMove reserved;  // 作为目标预留的迁移
+  RangeMove outgoing;  // 作为源已经交出、还没确认的迁移
+  std::map<int, std::pair<int, bool> > decided;  // 目标组 -> 最近一次Handoff的id和是否交出
+  std::map<int, int> accepted;  // 源组 -> 最近一次收下的id
+
+  bool contains(const std::string &key) const { return owned && range.contains(key); }
+
+  // fixed32 owned | range | reserved | outgoing | fixed32 n | n * (fixed32 to, fixed32 id, fixed32 ok)
+  // | fixed32 m | m * (fixed32 from, fixed32 id)，range是start和end两个字段，move是fixed32 id、fixed32 group、range
+  void encode(std::string *out) const {
+    PutFixed32(out, owned ? 1 : 0);
+    encodeRange(out, range);
+    encodeMove(out, reserved);
+    encodeMove(out, outgoing);
+    PutFixed32(out, static_cast<uint32_t>(decided.size()));
+    for (const auto &item : decided) {
+      PutFixed32(out, static_cast<uint32_t>(item.first));
+      PutFixed32(out, static_cast<uint32_t>(item.second.first));
+      PutFixed32(out, item.second.second ? 1 : 0);
+    }
+    PutFixed32(out, static_cast<uint32_t>(accepted.size()));
+    for (const auto &item : accepted) {
+      PutFixed32(out, static_cast<uint32_t>(item.first));
+      PutFixed32(out, static_cast<uint32_t>(item.second));
+    }
+  }
+
+  bool decode(SnapshotReader *reader) {
+    uint32_t flag = 0;
+    uint32_t n = 0;
+    if (!reader->GetFixed32(&flag) || !decodeRange(reader, &range) || !decodeMove(reader, &reserved) ||
+        !decodeMove(reader, &outgoing) || !reader->GetFixed32(&n)) {
+      return false;
+    }
+    owned = flag != 0;
+    decided.clear();
+    for (uint32_t i = 0; i < n; ++i) {
+      uint32_t to = 0, id = 0, ok = 0;
+      if (!reader->GetFixed32(&to) || !reader->GetFixed32(&id) || !reader->GetFixed32(&ok)) {
+        return false;
+      }
+      decided[static_cast<int>(to)] = {static_cast<int>(id), ok != 0};
+    }
+    accepted.clear();
+    if (!reader->GetFixed32(&n)) {
+      return false;
+    }
+    for (uint32_t i = 0; i < n; ++i) {
+      uint32_t from = 0, id = 0;
+      if (!reader->GetFixed32(&from) || !reader->GetFixed32(&id)) {
+        return false;
+      }
+      accepted[static_cast<int>(from)] = static_cast<int>(id);
+    }
+    return true;
+  }
+
+ private:
+  static void encodeRange(std::string *out, const KeyRange &r) {
+    EncodeSnapshotField(out, r.start);
+    EncodeSnapshotField(out, r.end);
+  }
+
+  static bool decodeRange(SnapshotReader *reader, KeyRange *r) {
+    return DecodeSnapshotField(reader, &r->start) && DecodeSnapshotField(reader, &r->end);
+  }
+
+  static void encodeMove(std::string *out, const RangeMove &m) {
+    PutFixed32(out, static_cast<uint32_t>(m.id));
+    PutFixed32(out, static_cast<uint32_t>(m.group));
+    encodeRange(out, m.range);
+  }
+
+  static bool decodeMove(SnapshotReader *reader, RangeMove *m) {
+    uint32_t id = 0, group = 0;
+    if (!reader->GetFixed32(&id) || !reader->GetFixed32(&group)) {
+      return false;
+    }
+    m->id = static_cast<int>(id);
+    m->group = static_cast<int>(group);
+    return decodeRange(reader, &m->range);
+  }
+};
+
+// "Range"日志的Value：kind | fixed32 peer | fixed32 id | start | end | data
+struct RangeCommand {
+  std::string kind;  // "Reserve" "Handoff" "Accept" "HandoffDone" "Unreserve"
+  int peer = -1;     // Reserve、Accept、Unreserve里是源组，Handoff、HandoffDone里是目标组
+  int id = 0;
+  KeyRange range;
+  std::string data;  // Accept时源组交出的kv，fixed32 n | n * (key | value)
+
+  std::string encode() const {
+    std::string out;
+    EncodeSnapshotField(&out, kind);
+    PutFixed32(&out, static_cast<uint32_t>(peer));
+    PutFixed32(&out, static_cast<uint32_t>(id));
+    EncodeSnapshotField(&out, range.start);
+    EncodeSnapshotField(&out, range.end);
+    EncodeSnapshotField(&out, data);
+    return out;
+  }
+
+  bool decode(const std::string &str) {
+    SnapshotReader reader(str.data(), str.size());
+    uint32_t p = 0, i = 0;
+    if (!DecodeSnapshotField(&reader, &kind) || !reader.GetFixed32(&p) || !reader.GetFixed32(&i) ||
+        !DecodeSnapshotField(&reader, &range.start) || !DecodeSnapshotField(&reader, &range.end) ||
+        !DecodeSnapshotField(&reader, &data)) {
+      return false;
+    }
+    peer = static_cast<int>(p);
+    id = static_cast<int>(i);
+    return reader.remaining() == 0;
+  }
+};
+
+#endif  // SKIP_LIST_ON_RAFT_RANGESTATE_H
@@ -0,0 +1,128 @@
+#ifndef SKIP_LIST_ON_RAFT_SSTABLE_H
+#define SKIP_LIST_ON_RAFT_SSTABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// LSM里一条记录的值：第一个字节是类型，后面是用户的value；删除也是一条记录，保证盖住更老的层里的同一个key
+constexpr char LSM_TYPE_VALUE = 'v';
+constexpr char LSM_TYPE_DELETION = 'd';
+
+/**
+ * 不可变的有序文件，LSM引擎的一个文件
+ * 格式：数据块 ... | 索引块 | 布隆过滤器 | 尾部
+ *   数据块 = n * (fixed32 keyLen | key | fixed32 recordLen | record) | fixed32 crc32
+ *   索引块 = fixed32 smallestLen | smallest | fixed32 n | n * (fixed32 lastKeyLen | lastKey | fixed64 offset | fixed32 size)
+ *            | fixed32 crc32，size不含块末尾的crc
+ *   布隆过滤器 = bits | fixed32 crc32
+ *   尾部 = fixed64 索引偏移 | fixed32 索引长度 | fixed64 过滤器偏移 | fixed32 过滤器长度 | fixed32 hash个数
+ *          | fixed64 记录数 | "SST1"
+ * 打开时只把索引和过滤器读进内存，点查先问过滤器，再二分索引读一个数据块
+ */
+class SSTable {
+ public:
+  // 打不开或者格式不对返回nullptr
+  static std::shared_ptr<SSTable> Open(const std::string &path, uint64_t number);
+  ~SSTable();
+  SSTable(const SSTable &) = delete;
+  SSTable &operator=(const SSTable &) = delete;
+
+  // 找到key时把记录（带类型字节）写进record
+  bool Get(const std::string &key, std::string *record) const;
+
+  uint64_t Number() const { return m_number; }
+  uint64_t FileSize() const { return m_fileSize; }
+  uint64_t Entries() const { return m_entries; }
+  const std::string &Smallest() const { return m_smallest; }
+  const std::string &Largest() const { return m_index.back().lastKey; }
+  bool Overlaps(const std::string &smallest, const std::string &largest) const {
+    return !(Largest() < smallest) && !(largest < Smallest());
+  }
+  // 不再属于任何版本，最后一个引用放掉时删除文件
+  void MarkObsolete() { m_obsolete.store(true); }
+
+  class Iterator {
+   public:
+    explicit Iterator(std::shared_ptr<const SSTable> table);
+    bool valid() const { return m_valid; }
+    void seek(const std::string &target);
+    void seekToFirst();
+    void next();
+    const std::string &key() const { return m_key; }
+    const std::string &record() const { return m_record; }
+
+   private:
+    bool loadBlock(size_t block);
+    void parseNext();
+
+    std::shared_ptr<const SSTable> m_table;
+    size_t m_block;
+    std::string m_data;
+    size_t m_pos;
+    bool m_valid;
+    std::string m_key;
+    std::string m_record;
+  };
+
+ private:
+  struct IndexEntry {
+    std::string lastKey;
+    uint64_t offset;
+    uint32_t size;
+  };
+
+  SSTable() = default;
+  bool readBlock(size_t block, std::string *data) const;
+  // 第一个lastKey >= key的块，没有就返回块数
+  size_t findBlock(const std::string &key) const;
+  bool mayContain(const std::string &key) const;
+
+  std::string m_path;
+  uint64_t m_number = 0;
+  int m_fd = -1;
+  uint64_t m_fileSize = 0;
+  uint64_t m_entries = 0;
+  std::string m_smallest;
+  std::vector<IndexEntry> m_index;
+  std::string m_bloom;
+  uint32_t m_bloomHashes = 0;
+  std::atomic<bool> m_obsolete{false};
+};
+
+// 按key升序写一个SSTable，Finish之后文件已经落盘，可以用SSTable::Open打开
+class SSTableBuilder {
+ public:
+  explicit SSTableBuilder(const std::string &path);
+  ~SSTableBuilder();
+  SSTableBuilder(const SSTableBuilder &) = delete;
+  SSTableBuilder &operator=(const SSTableBuilder &) = delete;
+
+  void Add(const std::string &key, const std::string &record);
+  bool Finish();
+  // 写到一半不要了，删掉文件
+  void Abandon();
+  uint64_t Entries() const { return m_entries; }
+  // 已经写出的和还在缓冲里的字节数
+  uint64_t EstimatedSize() const { return m_offset + m_block.size(); }
+
+ private:
+  void flushBlock();
+  bool writeOut(const std::string &data);
+
+  std::string m_path;
+  int m_fd;
+  bool m_ok;
+  uint64_t m_offset;
+  uint64_t m_entries;
+  std::string m_block;
+  std::string m_lastKey;
+  std::string m_smallest;
+  std::string m_index;  // 不含smallest和块数，Finish时拼上
+  uint32_t m_blocks;
+  std::vector<uint32_t> m_keyHashes;
+};
+
+#endif  // SKIP_LIST_ON_RAFT_SSTABLE_H
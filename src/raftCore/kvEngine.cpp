@@ -0,0 +1,9 @@
+#include "kvEngine.h"
+#include "lsmEngine.h"
+
+std::unique_ptr<KvEngine> NewKvEngine(const std::string &name, const std::string &dir) {
+  if (name == "lsm") {
+    return std::unique_ptr<KvEngine>(new LsmEngine(dir));
+  }
+  return std::unique_ptr<KvEngine>(new SkipListEngine());
+}
@@ -0,0 +1,602 @@
+#include "kvNode.h"
+
+#include <rpcprovider.h>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+
+#include "mprpcconfig.h"
+
+namespace {
+// 非阻塞connect，timeoutMs内连上返回true；只用来判断对端是否已经在监听，连上就关掉
+bool probePort(const std::string &ip, short port, int timeoutMs) {
+  int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return false;
+  }
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(static_cast<uint16_t>(port));
+  bool ok = inet_pton(AF_INET, ip.c_str(), &addr.sin_addr) == 1;
+  if (ok && connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0) {
+    ok = false;
+    if (errno == EINPROGRESS) {
+      pollfd pfd{fd, POLLOUT, 0};
+      int err = 0;
+      socklen_t len = sizeof(err);
+      ok = poll(&pfd, 1, timeoutMs) == 1 && getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0;
+    }
+  }
+  close(fd);
+  return ok;
+}
+}  // namespace
+
+MprpcConfig KvNode::waitPeersReady(const std::string &nodeInforFileName) {
+  // 节点数由启动脚本写在nodeNum里；没有写时等到节点数KV_STARTUP_SETTLE_MS内不再变化
+  auto start = std::chrono::steady_clock::now();
+  auto elapsedMs = [&start]() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+  };
+  MprpcConfig config;
+  int expected = 0;
+  int known = 0;
+  auto lastChange = elapsedMs();
+  std::vector<bool> ready;
+  int backoffMs = RPC_RECONNECT_BACKOFF_MIN_MS;
+  while (true) {
+    config = MprpcConfig();
+    config.LoadConfigFile(nodeInforFileName.c_str());
+    expected = atoi(config.Load("nodeNum").c_str());
+    int n = 0;
+    while (!config.Load("node" + std::to_string(n) + "ip").empty() &&
+           !config.Load("node" + std::to_string(n) + "port").empty()) {
+      ++n;
+    }
+    if (n != known) {
+      known = n;
+      lastChange = elapsedMs();
+    }
+    ready.resize(known, false);
+    // 自己的端口也探测一下：provider线程写完配置文件之后才开始监听
+    int readyCount = 0;
+    for (int i = 0; i < known; ++i) {
+      if (!ready[i]) {
+        std::string node = "node" + std::to_string(i);
+        ready[i] = probePort(config.Load(node + "ip"), static_cast<short>(atoi(config.Load(node + "port").c_str())),
+                             RPC_CONNECT_TIMEOUT_MS);
+      }
+      readyCount += ready[i] ? 1 : 0;
+    }
+    bool allListed = expected > 0 ? known >= expected : known > m_me && elapsedMs() - lastChange >= KV_STARTUP_SETTLE_MS;
+    if (allListed && readyCount == known) {
+      LOG_INFO("node%d all %d nodes ready after %lldms", m_me, known, static_cast<long long>(elapsedMs()));
+      return config;
+    }
+    if (elapsedMs() >= KV_STARTUP_WAIT_MS && known > m_me) {
+      LOG_WARN("node%d start with %d/%d nodes ready after %lldms, the rest will be reconnected", m_me, readyCount,
+               std::max(expected, known), static_cast<long long>(elapsedMs()));
+      return config;
+    }
+    // 节点列表还没写全时按固定间隔重读，只是在等端口时才退避
+    int waitMs = allListed ? backoffMs : KV_STARTUP_POLL_MS;
+    if (allListed) {
+      backoffMs = std::min(backoffMs * 2, RPC_RECONNECT_BACKOFF_MAX_MS);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(waitMs));
+  }
+}
+
+KvNode::KvNode(int me, int maxraftstate, std::string nodeInforFileName, short port) : m_me(me), m_raftRouter(this) {
+  // 范围表由启动脚本在节点启动之前写好，先建好所有组，rpc服务一启动就能分发
+  MprpcConfig config;
+  config.LoadConfigFile(nodeInforFileName.c_str());
+  m_ranges.Load(config);
+  // storageEngine=lsm时数据写到磁盘上的SSTable里，每个组一个目录；不配置时全部在内存的跳表里
+  std::string engine = config.Load("storageEngine");
+  for (int g = 0; g < m_ranges.groups(); ++g) {
+    KeyRange range;
+    bool owned = m_ranges.initialRange(g, &range);
+    std::string engineDir = "raftPersist" + std::to_string(m_me) + "/lsm" + std::to_string(g);
+    m_groups.emplace_back(new KvServer(m_me, g, owned, range, maxraftstate, engine, engineDir));
+  }
+
+  ////////////////clerk层面 kvserver开启rpc接受功能
+  //    同时raft与raft节点之间也要开启rpc功能，因此有两个注册，所有组共用
+  std::thread t([this, port]() -> void {
+    // provider是一个rpc网络服务对象。把UserService对象发布到rpc节点上
+    RpcProvider provider;
+    provider.NotifyService(this);
+    // raft的AE是流水线发送的，同一连接上要按顺序处理；ReadIndex要等一轮心跳，RangeAdmin要等日志提交，不能挡住后面的请求
+    provider.NotifyService(&m_raftRouter, true, {"ReadIndex", "RangeAdmin"});
+    // 启动一个rpc服务发布节点   Run以后，进程进入阻塞状态，等待远程的rpc调用请求
+    provider.Run(m_me, port);
+  });
+  t.detach();
+
+  // 等所有节点都把地址写进配置文件、rpc端口都能连上再建连接；不再固定睡几秒，启动时间只取决于数据量
+  config = waitPeersReady(nodeInforFileName);
+  std::vector<std::pair<std::string, short> > ipPortVt;
+  // 第一次启动时每个组的成员：node<i>role=learner的节点是learner，node<i>role=join的节点不在里面，
+  // 启动之后等运维用ChangeMembership把它加进来；已经有持久化的配置时以持久化的为准
+  raftRpcProctoc::Membership bootstrap;
+  for (int i = 0; i < INT_MAX - 1; ++i) {
+    std::string node = "node" + std::to_string(i);
+
+    std::string nodeIp = config.Load(node + "ip");
+    std::string nodePortStr = config.Load(node + "port");
+    if (nodeIp.empty()) {
+      break;
+    }
+    ipPortVt.emplace_back(nodeIp, atoi(nodePortStr.c_str()));  //沒有atos方法，可以考慮自己实现
+    std::string role = config.Load(node + "role");
+    if (role != "join") {
+      auto *member = bootstrap.add_members();
+      member->set_id(i);
+      member->set_ip(nodeIp);
+      member->set_port(ipPortVt.back().second);
+      member->set_learner(role == "learner");
+    }
+  }
+  // 每个组到每个节点各用一条连接：对端按连接顺序处理AE，组之间不会互相排队
+  m_peers.resize(m_groups.size());
+  for (size_t g = 0; g < m_groups.size(); ++g) {
+    for (int i = 0; i < ipPortVt.size(); ++i) {
+      if (i == m_me) {
+        m_peers[g].push_back(nullptr);
+        continue;
+      }
+      m_peers[g].push_back(std::make_shared<RaftRpcUtil>(ipPortVt[i].first, ipPortVt[i].second));
+    }
+  }
+  // 连接是异步建立的、断了会按退避重连，还没连上的节点由raft的心跳和PreVote自己补上，这里不用再等
+  LOG_INFO("node%d peers:%zu groups:%zu", m_me, ipPortVt.size() - 1, m_groups.size());
+
+  // 所有组的日志写进同一个wal，协程都在同一个调度器上；等fdatasync时只挂起协程，线程数不用随组数增加
+  auto wal = std::make_shared<WalLog>(m_me);
+  auto ioManager = std::make_shared<monsoon::IOManager>(FIBER_THREAD_NUM, FIBER_USE_CALLER_THREAD);
+  for (size_t g = 0; g < m_groups.size(); ++g) {
+    m_groups[g]->StartKVServer(m_peers[g], bootstrap, wal, ioManager);
+  }
+  m_balanceThread = std::thread(&KvNode::balanceLoop, this);
+  for (auto &group : m_groups) {
+    group->WaitApplyLoop();  //由於apply线程一直不會結束，达到一直卡在这的目的
+  }
+}
+
+KvServer *KvNode::Group(int groupId) {
+  if (groupId < 0 || groupId >= static_cast<int>(m_groups.size())) {
+    return nullptr;
+  }
+  return m_groups[groupId].get();
+}
+
+void KvNode::PutAppend(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::PutAppendArgs *request,
+                       ::raftKVRpcProctoc::PutAppendReply *response, ::google::protobuf::Closure *done) {
+  if (KvServer *group = route(request->groupid(), std::vector<std::string>{request->key()}, response, done)) {
+    group->PutAppend(controller, request, response, done);
+  }
+}
+
+void KvNode::Get(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetArgs *request,
+                 ::raftKVRpcProctoc::GetReply *response, ::google::protobuf::Closure *done) {
+  if (KvServer *group = route(request->groupid(), std::vector<std::string>{request->key()}, response, done)) {
+    group->Get(controller, request, response, done);
+  }
+}
+
+void KvNode::Scan(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ScanArgs *request,
+                  ::raftKVRpcProctoc::ScanReply *response, ::google::protobuf::Closure *done) {
+  // 起始位置要等ReadIndex之后才知道是否还在范围里，由组自己检查
+  if (KvServer *group = route(request->groupid(), std::vector<std::string>{}, response, done)) {
+    group->Scan(controller, request, response, done);
+  }
+}
+
+void KvNode::BatchPut(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::BatchPutArgs *request,
+                      ::raftKVRpcProctoc::BatchPutReply *response, ::google::protobuf::Closure *done) {
+  std::vector<std::string> keys;
+  keys.reserve(request->ops_size());
+  for (const auto &op : request->ops()) {
+    keys.push_back(op.key());
+  }
+  if (KvServer *group = route(request->groupid(), keys, response, done)) {
+    group->BatchPut(controller, request, response, done);
+  }
+}
+
+void KvNode::BatchGet(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::BatchGetArgs *request,
+                      ::raftKVRpcProctoc::BatchGetReply *response, ::google::protobuf::Closure *done) {
+  if (KvServer *group = route(request->groupid(), request->keys(), response, done)) {
+    group->BatchGet(controller, request, response, done);
+  }
+}
+
+void KvNode::RegisterClient(google::protobuf::RpcController *controller,
+                            const ::raftKVRpcProctoc::RegisterClientArgs *request,
+                            ::raftKVRpcProctoc::RegisterClientReply *response, ::google::protobuf::Closure *done) {
+  if (KvServer *group = route(request->groupid(), std::vector<std::string>{}, response, done)) {
+    group->RegisterClient(controller, request, response, done);
+  }
+}
+
+void KvNode::GetRanges(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetRangesArgs *request,
+                       ::raftKVRpcProctoc::GetRangesReply *response, ::google::protobuf::Closure *done) {
+  // 本节点apply到的范围，可能比leader上的旧，clerk遇到ErrWrongGroup会再来拉取
+  response->set_groups(static_cast<int>(m_groups.size()));
+  for (auto &group : m_groups) {
+    RangeState state = group->RangeSnapshot();
+    if (!state.owned) {
+      continue;
+    }
+    auto *info = response->add_ranges();
+    info->set_groupid(group->GroupId());
+    info->set_start(state.range.start);
+    info->set_end(state.range.end);
+  }
+  response->set_err(OK);
+  done->Run();
+}
+
+void KvNode::TransferLeader(google::protobuf::RpcController *controller,
+                            const ::raftKVRpcProctoc::TransferLeaderArgs *request,
+                            ::raftKVRpcProctoc::TransferLeaderReply *response, ::google::protobuf::Closure *done) {
+  std::vector<KvServer *> groups;
+  if (request->groupid() >= 0) {
+    KvServer *group = Group(request->groupid());
+    if (group == nullptr) {
+      response->set_err(ErrWrongGroup);
+      done->Run();
+      return;
+    }
+    groups.push_back(group);
+  } else {
+    for (auto &group : m_groups) {
+      groups.push_back(group.get());
+    }
+  }
+  std::string err = OK;
+  for (KvServer *group : groups) {
+    int term = 0;
+    bool isLeader = false;
+    group->RaftNode()->GetState(&term, &isLeader);
+    if (!isLeader) {
+      // 只问一个组时告诉运维leader在哪
+      if (request->groupid() >= 0) {
+        err = ErrWrongLeader;
+        response->set_err(err);
+        group->setLeaderHint(response);
+      }
+      continue;
+    }
+    if (!group->RaftNode()->TransferLeadership(request->target())) {
+      err = ErrTransferFailed;
+    }
+  }
+  response->set_err(err);
+  done->Run();
+}
+
+void KvNode::ChangeMembership(google::protobuf::RpcController *controller,
+                              const ::raftKVRpcProctoc::ChangeMembershipArgs *request,
+                              ::raftKVRpcProctoc::ChangeMembershipReply *response, ::google::protobuf::Closure *done) {
+  KvServer *group = Group(request->groupid());
+  if (group == nullptr) {
+    response->set_err(ErrWrongGroup);
+    done->Run();
+    return;
+  }
+  std::string err =
+      group->RaftNode()->ChangeMembership(request->kind(), request->nodeid(), request->ip(), request->port());
+  response->set_err(err);
+  group->setLeaderHint(response);
+  done->Run();
+}
+
+void KvNode::balanceLoop() {
+  m_loadSamples.assign(m_groups.size(), LoadSample());
+  m_coldRounds.assign(m_groups.size(), 0);
+  m_lastSampleTime = std::chrono::steady_clock::now();
+  while (true) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(KV_BALANCE_INTERVAL_MS));
+    auto current = std::chrono::steady_clock::now();
+    double seconds = std::max(std::chrono::duration<double>(current - m_lastSampleTime).count(), 0.001);
+    m_lastSampleTime = current;
+
+    // 读请求只在处理它的节点上计数，别的节点领导的组只能看到apply的写入数
+    std::vector<RangeState> states;
+    std::vector<int> keys;
+    std::vector<double> qps;
+    std::vector<bool> leading;
+    for (size_t g = 0; g < m_groups.size(); ++g) {
+      states.push_back(m_groups[g]->RangeSnapshot());
+      KvServer::LoadStats load = m_groups[g]->Load();
+      uint64_t requests = load.requests - m_loadSamples[g].requests;
+      uint64_t writes = load.appliedWrites - m_loadSamples[g].appliedWrites;
+      m_loadSamples[g] = {load.requests, load.appliedWrites};
+      keys.push_back(load.keys);
+      qps.push_back(static_cast<double>(std::max(requests, writes)) / seconds);
+      bool cold = states[g].owned && load.keys < KV_MERGE_MAX_KEYS && qps[g] < KV_MERGE_QPS;
+      m_coldRounds[g] = cold ? m_coldRounds[g] + 1 : 0;
+      int term = 0;
+      bool isLeader = false;
+      m_groups[g]->RaftNode()->GetState(&term, &isLeader);
+      leading.push_back(isLeader);
+    }
+
+    bool moving = false;
+    for (size_t g = 0; g < m_groups.size(); ++g) {
+      if (leading[g]) {
+        moving = resumeMoves(static_cast<int>(g), states) || moving;
+      }
+    }
+    // 一轮最多发起一次迁移，等它走完、范围表稳定了再看下一次
+    for (size_t g = 0; g < m_groups.size() && !moving; ++g) {
+      const RangeState &st = states[g];
+      if (!leading[g] || !st.owned || st.reserved.id != 0 || st.outgoing.id != 0) {
+        continue;
+      }
+      auto idle = [&states](size_t t) { return states[t].reserved.id == 0 && states[t].outgoing.id == 0; };
+      std::string splitKey;
+      if ((keys[g] > KV_SPLIT_MAX_KEYS || qps[g] > KV_SPLIT_QPS) && m_groups[g]->SplitKey(&splitKey)) {
+        for (size_t t = 0; t < m_groups.size(); ++t) {
+          if (t != g && !states[t].owned && idle(t)) {
+            DPrintf("[KvNode::balanceLoop-node{%d}] split group{%d} keys:%d qps:%.0f at key{%s} to group{%d}", m_me,
+                    static_cast<int>(g), keys[g], qps[g], splitKey.c_str(), static_cast<int>(t));
+            moveRange(static_cast<int>(g), static_cast<int>(t), {splitKey, st.range.end});
+            moving = true;
+            break;
+          }
+        }
+        continue;
+      }
+      if (m_coldRounds[g] < KV_MERGE_COLD_ROUNDS) {
+        continue;
+      }
+      for (size_t t = 0; t < m_groups.size(); ++t) {
+        bool adjacent = states[t].owned && (st.range.followedBy(states[t].range) || states[t].range.followedBy(st.range));
+        if (t != g && adjacent && idle(t) && m_coldRounds[t] >= KV_MERGE_COLD_ROUNDS &&
+            keys[g] + keys[t] < KV_SPLIT_MAX_KEYS / 2) {
+          DPrintf("[KvNode::balanceLoop-node{%d}] merge group{%d} into group{%d}", m_me, static_cast<int>(g),
+                  static_cast<int>(t));
+          moveRange(static_cast<int>(g), static_cast<int>(t), st.range);
+          moving = true;
+          break;
+        }
+      }
+    }
+    balanceLeaders(states);
+  }
+}
+
+bool KvNode::resumeMoves(int g, const std::vector<RangeState> &states) {
+  const RangeState &st = states[g];
+  bool moving = false;
+  std::string result;
+  int index = -1;
+  if (st.outgoing.id != 0) {
+    finishHandoff(g, st.outgoing);
+    moving = true;
+  }
+  if (st.reserved.id != 0) {
+    moving = true;
+    // 源组交出了就等它把数据交过来；拒绝了，或者已经决定了更新的预留，这个预留就不会再有人推进
+    auto it = states[st.reserved.group].decided.find(g);
+    if (it != states[st.reserved.group].decided.end() &&
+        (it->second.first > st.reserved.id || (it->second.first == st.reserved.id && !it->second.second))) {
+      RangeCommand cmd;
+      cmd.kind = "Unreserve";
+      cmd.peer = st.reserved.group;
+      cmd.id = st.reserved.id;
+      m_groups[g]->ProposeRange(cmd, &result, &index);
+    }
+  }
+  // 别的组为本组预留了、本组还没有决定的迁移：发起迁移的leader换掉了，由现在的leader来决定
+  for (size_t t = 0; t < states.size(); ++t) {
+    const RangeMove &reserved = states[t].reserved;
+    if (static_cast<int>(t) == g || reserved.id == 0 || reserved.group != g) {
+      continue;
+    }
+    auto it = st.decided.find(static_cast<int>(t));
+    if (it != st.decided.end() && it->second.first >= reserved.id) {
+      continue;
+    }
+    moving = true;
+    RangeCommand handoff;
+    handoff.kind = "Handoff";
+    handoff.peer = static_cast<int>(t);
+    handoff.id = reserved.id;
+    handoff.range = reserved.range;
+    if (m_groups[g]->ProposeRange(handoff, &result, &index) == OK && result != OK) {
+      raftRpcProctoc::RangeAdminArgs args;
+      args.set_groupid(static_cast<int>(t));
+      args.set_op("Unreserve");
+      args.set_from(g);
+      args.set_id(reserved.id);
+      int _ = 0;
+      rangeAdmin(static_cast<int>(t), &args, &_);
+    }
+  }
+  return moving;
+}
+
+void KvNode::moveRange(int from, int to, const KeyRange &range) {
+  raftRpcProctoc::RangeAdminArgs args;
+  args.set_groupid(to);
+  args.set_op("Reserve");
+  args.set_from(from);
+  args.set_start(range.start);
+  args.set_end(range.end);
+  int id = 0;
+  if (rangeAdmin(to, &args, &id) != OK) {
+    // 目标组有别的迁移在进行，或者暂时找不到它的leader，下一轮再看
+    return;
+  }
+  RangeCommand handoff;
+  handoff.kind = "Handoff";
+  handoff.peer = to;
+  handoff.id = id;
+  handoff.range = range;
+  std::string result;
+  int index = -1;
+  if (m_groups[from]->ProposeRange(handoff, &result, &index) != OK) {
+    // 不确定有没有交出，下一轮由resumeMoves接着做
+    return;
+  }
+  if (result != OK) {
+    args.set_op("Unreserve");
+    args.set_id(id);
+    rangeAdmin(to, &args, &id);
+    return;
+  }
+  finishHandoff(from, {id, to, range});
+}
+
+void KvNode::finishHandoff(int from, const RangeMove &move) {
+  // 目标组已经收下了就不用再传一遍数据，比如上一次HandoffDone没有提交成功
+  RangeState target = m_groups[move.group]->RangeSnapshot();
+  auto it = target.accepted.find(from);
+  if (it == target.accepted.end() || it->second < move.id) {
+    raftRpcProctoc::RangeAdminArgs args;
+    args.set_groupid(move.group);
+    args.set_op("Accept");
+    args.set_from(from);
+    args.set_id(move.id);
+    args.set_data(m_groups[from]->EncodeRangeData(move.range));
+    int _ = 0;
+    if (rangeAdmin(move.group, &args, &_) != OK) {
+      return;
+    }
+  }
+  RangeCommand done;
+  done.kind = "HandoffDone";
+  done.peer = move.group;
+  done.id = move.id;
+  std::string result;
+  int index = -1;
+  m_groups[from]->ProposeRange(done, &result, &index);
+}
+
+std::string KvNode::rangeAdmin(int group, raftRpcProctoc::RangeAdminArgs *args, int *id) {
+  int leaderId = -1;
+  int term = 0;
+  m_groups[group]->RaftNode()->GetLeaderHint(&leaderId, &term);
+  raftRpcProctoc::RangeAdminReply reply;
+  if (leaderId == m_me) {
+    m_groups[group]->RangeAdmin(args, &reply);
+  } else if (leaderId < 0 || leaderId >= static_cast<int>(m_peers[group].size()) ||
+             !m_peers[group][leaderId]->RangeAdmin(args, &reply)) {
+    return ErrWrongLeader;
+  }
+  if (reply.err() == OK) {
+    *id = reply.id();
+  }
+  return reply.err();
+}
+
+void KvNode::balanceLeaders(const std::vector<RangeState> &states) {
+  if (m_peers.empty()) {
+    return;
+  }
+  // 每个节点领导了几个组，以本节点知道的leader为准
+  std::vector<int> leaders(m_peers[0].size(), 0);
+  std::vector<int> mine;
+  for (size_t g = 0; g < m_groups.size(); ++g) {
+    int leaderId = -1;
+    int term = 0;
+    m_groups[g]->RaftNode()->GetLeaderHint(&leaderId, &term);
+    if (leaderId < 0 || leaderId >= static_cast<int>(leaders.size())) {
+      continue;
+    }
+    ++leaders[leaderId];
+    if (leaderId == m_me) {
+      mine.push_back(static_cast<int>(g));
+    }
+  }
+  // 只能交给投票成员，learner不参与比较
+  int target = -1;
+  for (int i = 0; i < static_cast<int>(leaders.size()); ++i) {
+    if (m_groups[0]->RaftNode()->IsVoter(i) && (target < 0 || leaders[i] < leaders[target])) {
+      target = i;
+    }
+  }
+  if (target < 0 || leaders[m_me] - leaders[target] < KV_LEADER_IMBALANCE) {
+    return;
+  }
+  // 有迁移在进行的组换了leader还要重新推进，先交出别的
+  for (int g : mine) {
+    if (states[g].reserved.id == 0 && states[g].outgoing.id == 0 && m_groups[g]->RaftNode()->TransferLeadership(target)) {
+      DPrintf("[KvNode::balanceLeaders-node{%d}] transfer group{%d} leadership to node{%d}, leaders:%d/%d", m_me, g,
+              target, leaders[m_me], leaders[target]);
+      return;
+    }
+  }
+}
+
+void KvNode::RaftRouter::AppendEntries(google::protobuf::RpcController *controller,
+                                       const ::raftRpcProctoc::AppendEntriesArgs *request,
+                                       ::raftRpcProctoc::AppendEntriesReply *response,
+                                       ::google::protobuf::Closure *done) {
+  if (KvServer *group = m_node->Group(request->groupid())) {
+    group->RaftNode()->AppendEntries(controller, request, response, done);
+    return;
+  }
+  done->Run();
+}
+
+void KvNode::RaftRouter::InstallSnapshot(google::protobuf::RpcController *controller,
+                                         const ::raftRpcProctoc::InstallSnapshotRequest *request,
+                                         ::raftRpcProctoc::InstallSnapshotResponse *response,
+                                         ::google::protobuf::Closure *done) {
+  if (KvServer *group = m_node->Group(request->groupid())) {
+    group->RaftNode()->InstallSnapshot(controller, request, response, done);
+    return;
+  }
+  done->Run();
+}
+
+void KvNode::RaftRouter::RequestVote(google::protobuf::RpcController *controller,
+                                     const ::raftRpcProctoc::RequestVoteArgs *request,
+                                     ::raftRpcProctoc::RequestVoteReply *response, ::google::protobuf::Closure *done) {
+  if (KvServer *group = m_node->Group(request->groupid())) {
+    group->RaftNode()->RequestVote(controller, request, response, done);
+    return;
+  }
+  done->Run();
+}
+
+void KvNode::RaftRouter::ReadIndex(google::protobuf::RpcController *controller,
+                                   const ::raftRpcProctoc::ReadIndexArgs *request,
+                                   ::raftRpcProctoc::ReadIndexReply *response, ::google::protobuf::Closure *done) {
+  if (KvServer *group = m_node->Group(request->groupid())) {
+    group->RaftNode()->ReadIndex(controller, request, response, done);
+    return;
+  }
+  done->Run();
+}
+
+void KvNode::RaftRouter::TimeoutNow(google::protobuf::RpcController *controller,
+                                    const ::raftRpcProctoc::TimeoutNowArgs *request,
+                                    ::raftRpcProctoc::TimeoutNowReply *response, ::google::protobuf::Closure *done) {
+  if (KvServer *group = m_node->Group(request->groupid())) {
+    group->RaftNode()->TimeoutNow(controller, request, response, done);
+    return;
+  }
+  done->Run();
+}
+
+void KvNode::RaftRouter::RangeAdmin(google::protobuf::RpcController *controller,
+                                    const ::raftRpcProctoc::RangeAdminArgs *request,
+                                    ::raftRpcProctoc::RangeAdminReply *response, ::google::protobuf::Closure *done) {
+  if (KvServer *group = m_node->Group(request->groupid())) {
+    group->RangeAdmin(request, response);
+  } else {
+    response->set_err(ErrWrongGroup);
+  }
+  done->Run();
+}
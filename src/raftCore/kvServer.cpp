@@ -1,48 +1,103 @@
 #include "kvServer.h"
 
-#include <rpcprovider.h>
+#include <cerrno>
+#include "metrics.h"
 
-#include "mprpcconfig.h"
+namespace {
+// 写进日志的Timestamp，leader的墙上时钟
+int64_t NowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
 
-void KvServer::DprintfKVDB() {
-  if (!Debug) {
-    return;
+// 一个请求在kvserver里的各段时间，同一进程的所有组共用
+struct KvMetrics {
+  LatencyHistogram *put = Metrics::Instance().Histogram("kv_request_us{op=\"put_append\"}", "kvserver处理一个请求的时间");
+  LatencyHistogram *get = Metrics::Instance().Histogram("kv_request_us{op=\"get\"}", "kvserver处理一个请求的时间");
+  LatencyHistogram *scan = Metrics::Instance().Histogram("kv_request_us{op=\"scan\"}", "kvserver处理一个请求的时间");
+  LatencyHistogram *batchPut =
+      Metrics::Instance().Histogram("kv_request_us{op=\"batch_put\"}", "kvserver处理一个请求的时间");
+  LatencyHistogram *batchGet =
+      Metrics::Instance().Histogram("kv_request_us{op=\"batch_get\"}", "kvserver处理一个请求的时间");
+  LatencyHistogram *propose = Metrics::Instance().Histogram("kv_propose_us", "写请求在raft Start里的时间（合并、写日志）");
+  LatencyHistogram *waitApply = Metrics::Instance().Histogram("kv_wait_apply_us", "写请求Start返回后等到apply的时间");
+  LatencyHistogram *commitToApply =
+      Metrics::Instance().Histogram("kv_commit_to_apply_us", "leader上日志提交到在状态机上执行完的时间");
+  LatencyHistogram *applyBatch = Metrics::Instance().Histogram("kv_apply_batch_us", "apply线程执行一批日志的时间");
+};
+
+KvMetrics &kvMetrics() {
+  static KvMetrics metrics;
+  return metrics;
+}
+
+// 结果要跟着日志里的Op交给等待的handler，和Range日志一样放在Op.Value里：Err | '\0' | Value，Err里没有'\0'
+bool isAtomicOp(const std::string &operation) { return operation == "CompareAndSwap" || operation == "Increment"; }
+
+std::string encodeAtomicResult(const std::string &err, const std::string &value) {
+  std::string out;
+  out.reserve(err.size() + 1 + value.size());
+  out += err;
+  out.push_back('\0');
+  out += value;
+  return out;
+}
+
+bool decodeAtomicResult(const std::string &data, std::string *err, std::string *value) {
+  size_t pos = data.find('\0');
+  if (pos == std::string::npos) {
+    return false;
   }
-  std::lock_guard<std::mutex> lg(m_mtx);
-  DEFER {
-    // for (const auto &item: m_kvDB) {
-    //     DPrintf("[DBInfo ----]Key : %s, Value : %s", &item.first, &item.second);
-    // }
-    m_skipList.display_list();
-  };
+  err->assign(data, 0, pos);
+  value->assign(data, pos + 1, std::string::npos);
+  return true;
+}
+
+// 整个字符串是一个十进制的int64
+bool parseInt64(const std::string &s, int64_t *v) {
+  if (s.empty()) {
+    return false;
+  }
+  errno = 0;
+  char *end = nullptr;
+  long long n = strtoll(s.c_str(), &end, 10);
+  if (errno != 0 || end != s.c_str() + s.size()) {
+    return false;
+  }
+  *v = n;
+  return true;
+}
+}  // namespace
+
+void KvServer::DprintfKVDB() {
+  // 每批apply之后都会调用，只打印大小；要看全部内容用m_engine->Display()
+  DPrintf("[DBInfo ----] kvserver{%d} group{%d} keys:%d lastApplied:%d", m_me, m_groupId, m_engine->Size(),
+          m_lastAppliedIndex.load());
 }
 
 void KvServer::ExecuteAppendOpOnKVDB(Op op) {
   // if op.IfDuplicate {   //get请求是可重复执行的，因此可以不用判复
   //	return
   // }
-  m_mtx.lock();
-
-  m_skipList.insert_set_element(op.Key, op.Value);
-
-  // if (m_kvDB.find(op.Key) != m_kvDB.end()) {
-  //     m_kvDB[op.Key] = m_kvDB[op.Key] + op.Value;
-  // } else {
-  //     m_kvDB.insert(std::make_pair(op.Key, op.Value));
-  // }
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
+  // 存储引擎自己处理和读的并发，不需要加锁
+  // 旧版本一直是覆盖写，已经提交的"Append"日志重放时要得到同样的状态，不能改成拼接
+  m_engine->Put(op.Key, op.Value);
+  m_readCache.Invalidate(op.Key);
 
   //    DPrintf("[KVServerExeAPPEND-----]ClientId :%d ,RequestID :%d ,Key : %v, value : %v", op.ClientId, op.RequestId,
   //    op.Key, op.Value)
-  DprintfKVDB();
+}
+
+void KvServer::ExecuteAppendV2OpOnKVDB(const Op &op) {
+  // 在原来的值后面接上，跳表里直接接在现有的value上，见SkipList::append_element
+  m_engine->Append(op.Key, op.Value);
+  m_readCache.Invalidate(op.Key);
 }
 
 void KvServer::ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist) {
-  m_mtx.lock();
   *value = "";
   *exist = false;
-  if (m_skipList.search_element(op.Key, *value)) {
+  if (m_engine->Get(op.Key, value)) {
     *exist = true;
     // *value = m_skipList.se //value已经完成赋值了
   }
@@ -50,8 +105,7 @@ void KvServer::ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist) {
   //     *exist = true;
   //     *value = m_kvDB[op.Key];
   // }
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
+  // requestId在apply的时候已经记下了
 
   if (*exist) {
     //                DPrintf("[KVServerExeGET----]ClientId :%d ,RequestID :%d ,Key : %v, value :%v", op.ClientId,
@@ -64,29 +118,240 @@ void KvServer::ExecuteGetOpOnKVDB(Op op, std::string *value, bool *exist) {
 }
 
 void KvServer::ExecutePutOpOnKVDB(Op op) {
-  m_mtx.lock();
-  m_skipList.insert_set_element(op.Key, op.Value);
+  m_engine->Put(op.Key, op.Value);
+  m_readCache.Invalidate(op.Key);
   // m_kvDB[op.Key] = op.Value;
-  m_lastRequestId[op.ClientId] = op.RequestId;
-  m_mtx.unlock();
 
   //    DPrintf("[KVServerExePUT----]ClientId :%d ,RequestID :%d ,Key : %v, value : %v", op.ClientId, op.RequestId,
   //    op.Key, op.Value)
-  DprintfKVDB();
+}
+
+void KvServer::ExecuteBatchOpOnKVDB(const Op &op) {
+  std::vector<Op> ops;
+  bool ok = Op::decodeBatch(op.Value, &ops);
+  myAssert(ok, format("[KvServer::ExecuteBatchOpOnKVDB-kvserver{%d}] bad batch", m_me));
+  // 写的过程中m_applySeq是奇数，BatchGet看到奇数或者前后不一致就重读，不会读到只写了一半的batch
+  m_applySeq.fetch_add(1, std::memory_order_acq_rel);
+  for (auto &sub : ops) {
+    sub.ClientId = op.ClientId;
+    sub.RequestId = op.RequestId;
+    if (sub.Operation == "Append") {
+      ExecuteAppendOpOnKVDB(sub);
+    } else if (sub.Operation == "AppendV2") {
+      ExecuteAppendV2OpOnKVDB(sub);
+    } else {
+      ExecutePutOpOnKVDB(sub);
+    }
+  }
+  m_applySeq.fetch_add(1, std::memory_order_release);
+}
+
+void KvServer::ExecuteCompareAndSwapOpOnKVDB(const Op &op, std::string *err, std::string *value) {
+  std::string expected, newValue;
+  bool expectAbsent = false;
+  bool ok = Op::decodeCompareAndSwap(op.Value, &expected, &expectAbsent, &newValue);
+  myAssert(ok, format("[KvServer::ExecuteCompareAndSwapOpOnKVDB-kvserver{%d}] bad compare-and-swap", m_me));
+  bool swapped = m_engine->Update(op.Key, [&](const std::string *current, std::string *next) {
+    bool match = expectAbsent ? current == nullptr : current != nullptr && *current == expected;
+    if (!match) {
+      *err = current == nullptr ? ErrNoKey : ErrCompareFailed;
+      *value = current == nullptr ? "" : *current;
+      return false;
+    }
+    *next = std::move(newValue);
+    return true;
+  });
+  if (swapped) {
+    m_readCache.Invalidate(op.Key);
+    *err = OK;
+    value->clear();
+  }
+}
+
+void KvServer::ExecuteIncrementOpOnKVDB(const Op &op, std::string *err, std::string *value) {
+  int64_t delta = 0;
+  bool ok = parseInt64(op.Value, &delta);
+  myAssert(ok, format("[KvServer::ExecuteIncrementOpOnKVDB-kvserver{%d}] bad delta", m_me));
+  bool written = m_engine->Update(op.Key, [&](const std::string *current, std::string *next) {
+    int64_t n = 0;
+    if ((current != nullptr && !parseInt64(*current, &n)) || __builtin_add_overflow(n, delta, &n)) {
+      *err = ErrNotInteger;
+      value->clear();
+      return false;
+    }
+    *next = std::to_string(n);
+    *value = *next;
+    return true;
+  });
+  if (written) {
+    m_readCache.Invalidate(op.Key);
+    *err = OK;
+  }
+}
+
+void KvServer::BatchGetKVDB(const raftKVRpcProctoc::BatchGetArgs *args, raftKVRpcProctoc::BatchGetReply *reply) {
+  if (!Owns(args->keys())) {
+    reply->set_err(ErrWrongGroup);
+    return;
+  }
+  auto readAll = [&]() {
+    reply->clear_results();
+    for (const auto &key : args->keys()) {
+      auto *result = reply->add_results();
+      std::string value;
+      if (m_engine->Get(key, &value)) {
+        result->set_err(OK);
+        result->set_value(value);
+      } else {
+        result->set_err(ErrNoKey);
+      }
+    }
+  };
+  for (int i = 0; i < KV_BATCH_GET_OPTIMISTIC_TRIES; ++i) {
+    uint64_t seq = m_applySeq.load(std::memory_order_acquire);
+    if (seq & 1) {
+      continue;
+    }
+    readAll();
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_applySeq.load(std::memory_order_relaxed) == seq) {
+      reply->set_err(OK);
+      return;
+    }
+  }
+  // apply线程执行整批日志时持有写锁，拿到读锁时没有写了一半的batch
+  std::shared_lock<std::shared_mutex> lk(m_sessionMtx);
+  readAll();
+  reply->set_err(OK);
+}
+
+void KvServer::ExecuteScanOpOnKVDB(Op op, const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply) {
+  ScanKVDB(args, reply);
+}
+
+void KvServer::ScanKVDB(const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply) {
+  int limit = args->limit();
+  if (limit <= 0 || limit > SCAN_MAX_LIMIT) {
+    limit = SCAN_MAX_LIMIT;
+  }
+  const std::string &prefix = args->prefix();
+  std::string start = prefix.empty() ? args->startkey() : prefix;
+  if (args->pagetoken() > start) {
+    // 从上一页停下的位置继续
+    start = args->pagetoken();
+  }
+  // 只扫到这个组的范围结束为止，后面的由clerk去下一个组扫
+  KeyRange owned;
+  {
+    std::shared_lock<std::shared_mutex> lk(m_rangeMtx);
+    if (!m_rangeState.contains(start)) {
+      reply->set_err(ErrWrongGroup);
+      return;
+    }
+    owned = m_rangeState.range;
+  }
+  reply->set_rangeend(owned.end);
+  // prefix非空时end不起作用，遇到第一个不带前缀的key就结束
+  bool hasEnd = prefix.empty() && !args->endkey().empty();
+  auto inRange = [&](const std::string &key) {
+    if (!prefix.empty()) {
+      return key.compare(0, prefix.size(), prefix) == 0;
+    }
+    return !hasEnd || key < args->endkey();
+  };
+
+  reply->clear_kvs();
+  reply->clear_nextpagetoken();
+  std::unique_ptr<KvEngine::Iterator> it = m_engine->NewIterator();
+  it->seek(start);
+  int count = 0;
+  for (; it->valid(); it->next()) {
+    std::string key = it->key();
+    if (!inRange(key) || !owned.contains(key)) {
+      break;
+    }
+    if (count == limit) {
+      reply->set_nextpagetoken(key);
+      break;
+    }
+    auto *kv = reply->add_kvs();
+    kv->set_key(key);
+    kv->set_value(it->value());
+    ++count;
+  }
+  reply->set_err(OK);
+}
+
+bool KvServer::WaitApplied(int raftIndex) {
+  if (m_lastAppliedIndex.load() >= raftIndex) {
+    return true;
+  }
+  // 先登记再检查，和markApplied里先写index再看有没有人等配对，不会错过唤醒
+  std::unique_lock<std::mutex> lk(m_applyMtx);
+  ++m_applyWaiters;
+  bool applied = m_applyCv.waitFor(lk, CONSENSUS_TIMEOUT, [&]() { return m_lastAppliedIndex.load() >= raftIndex; });
+  --m_applyWaiters;
+  return applied;
+}
+
+void KvServer::markApplied(int raftIndex) {
+  if (raftIndex <= m_lastAppliedIndex.load(std::memory_order_relaxed)) {
+    return;
+  }
+  m_lastAppliedIndex.store(raftIndex);
+  if (m_applyWaiters.load() > 0) {
+    std::lock_guard<std::mutex> lg(m_applyMtx);
+    m_applyCv.notifyAll();
+  }
 }
 
 // 处理来自clerk的Get RPC
 void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetReply *reply) {
+  // ReadIndex：确认leader身份后等本地apply到readIndex，直接读存储引擎，不写日志
+  int readIndex = -1;
+  bool isLeader = false;
+  bool ready = m_raftNode->ReadIndex(&readIndex, &isLeader);
+  if (!ready && !isLeader && args->followerread()) {
+    // follower读：能接受旧数据时只看自己和leader最近的联系，否则找leader要readIndex，之后同样等本地apply
+    ready = (args->maxstalenessms() > 0 && m_raftNode->StaleReadIndex(args->maxstalenessms(), &readIndex)) ||
+            m_raftNode->FollowerReadIndex(&readIndex);
+  }
+  if (ready) {
+    std::string value;
+    bool exist = false;
+    if (!WaitApplied(readIndex)) {
+      reply->set_err(ErrWrongLeader);
+      return;
+    } else if (!Owns(args->key())) {
+      reply->set_err(ErrWrongGroup);
+      return;
+    } else if (isLeader) {
+      // leader上的读走热点缓存，同一个key同时没命中的读只查一次存储引擎，见hotKeyCache.h
+      exist = m_readCache.Read(args->key(), readIndex, &value,
+                               [this, args](std::string *out) { return m_engine->Get(args->key(), out); });
+    } else {
+      exist = m_engine->Get(args->key(), &value);
+    }
+    reply->set_err(exist ? OK : ErrNoKey);
+    reply->set_value(exist ? value : "");
+    return;
+  }
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    return;
+  }
+  // 刚当选的leader还不知道准确的commitIndex，这次读照旧写进日志，它提交之后的读就都可以走ReadIndex了
   Op op;
   op.Operation = "Get";
   op.Key = args->key();
   op.Value = "";
   op.ClientId = args->clientid();
   op.RequestId = args->requestid();
+  op.Timestamp = NowMs();
 
   int raftIndex = -1;
   int _ = -1;
-  bool isLeader = false;
+  isLeader = false;
   m_raftNode->Start(op, &raftIndex, &_,
                     &isLeader);  // raftIndex：raft预计的logIndex
                                  // ，虽然是预计，但是正确情况下是准确的，op的具体内容对raft来说 是隔离的
@@ -96,20 +361,13 @@ void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetR
     return;
   }
 
-  // create waitForCh
-  m_mtx.lock();
-
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    waitApplyCh.insert(std::make_pair(raftIndex, new LockQueue<Op>()));
-  }
-  auto chForRaftIndex = waitApplyCh[raftIndex];
-
-  m_mtx.unlock();  //直接解锁，等待任务执行完成，不能一直拿锁等待
-
-  // timeout
+  // 在raftIndex上等待apply的结果
   Op raftCommitOp;
 
-  if (!chForRaftIndex->timeOutPop(CONSENSUS_TIMEOUT, &raftCommitOp)) {
+  int64_t waitUs = MetricsNowUs();
+  bool applied = m_waitApply.Wait(raftIndex, CONSENSUS_TIMEOUT, &raftCommitOp);
+  RecordSince(kvMetrics().waitApply, waitUs);
+  if (!applied) {
     //        DPrintf("[GET TIMEOUT!!!]From Client %d (Request %d) To Server %d, key %v, raftIndex %d", args.ClientId,
     //        args.RequestId, kv.me, op.Key, raftIndex)
     // todo 2023年06月01日
@@ -139,7 +397,9 @@ void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetR
     //         %d, Opreation %v, Key :%v, Value :%v", kv.me, raftIndex, op.ClientId, op.RequestId, op.Operation, op.Key,
     //         op.Value)
     // todo 这里还要再次检验的原因：感觉不用检验，因为leader只要正确的提交了，那么这些肯定是符合的
-    if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
+    if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId && !Owns(op.Key)) {
+      reply->set_err(ErrWrongGroup);
+    } else if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
       std::string value;
       bool exist = false;
       ExecuteGetOpOnKVDB(op, &value, &exist);
@@ -156,54 +416,396 @@ void KvServer::Get(const raftKVRpcProctoc::GetArgs *args, raftKVRpcProctoc::GetR
       //            == op.RequestId{%v}", raftCommitOp.ClientId, op.ClientId, raftCommitOp.RequestId, op.RequestId)
     }
   }
-  m_mtx.lock();  // todo 這個可以先弄一個defer，因爲刪除優先級並不高，先把rpc發回去更加重要
-  auto tmp = waitApplyCh[raftIndex];
-  waitApplyCh.erase(raftIndex);
-  delete tmp;
-  m_mtx.unlock();
 }
 
-void KvServer::GetCommandFromRaft(ApplyMsg message) {
+void KvServer::Scan(const raftKVRpcProctoc::ScanArgs *args, raftKVRpcProctoc::ScanReply *reply) {
+  int readIndex = -1;
+  bool isLeader = false;
+  if (m_raftNode->ReadIndex(&readIndex, &isLeader)) {
+    if (WaitApplied(readIndex)) {
+      ScanKVDB(args, reply);
+    } else {
+      reply->set_err(ErrWrongLeader);
+    }
+    return;
+  }
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    return;
+  }
+  // 与Get相同，刚当选时先走一次日志
   Op op;
-  op.parseFromString(message.Command);
+  op.Operation = "Scan";
+  op.Key = args->prefix().empty() ? args->startkey() : args->prefix();
+  op.Value = "";
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = NowMs();
 
-  DPrintf(
-      "[KvServer::GetCommandFromRaft-kvserver{%d}] , Got Command --> Index:{%d} , ClientId {%s}, RequestId {%d}, "
-      "Opreation {%s}, Key :{%s}, Value :{%s}",
-      m_me, message.CommandIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-  if (message.CommandIndex <= m_lastSnapShotRaftLogIndex) {
+  int raftIndex = -1;
+  int _ = -1;
+  isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    return;
+  }
+
+  Op raftCommitOp;
+  if (!m_waitApply.Wait(raftIndex, CONSENSUS_TIMEOUT, &raftCommitOp)) {
+    int _ = -1;
+    bool isLeader = false;
+    m_raftNode->GetState(&_, &isLeader);
+    // 与Get相同，已经提交过的读请求可以再执行
+    if (ifRequestDuplicate(op.ClientId, op.RequestId) && isLeader) {
+      ExecuteScanOpOnKVDB(op, args, reply);
+    } else {
+      reply->set_err(ErrWrongLeader);
+    }
+  } else if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
+    ExecuteScanOpOnKVDB(op, args, reply);
+  } else {
+    reply->set_err(ErrWrongLeader);
+  }
+}
+
+void KvServer::GetCommandsFromRaft(const ApplyMsg *messages, int n) {
+  ScopedLatency latency(kvMetrics().applyBatch);
+  // 整批日志在一次加锁里执行完，之后一起唤醒等待的请求
+  std::vector<std::pair<int, Op>> applied;
+  applied.reserve(n);
+  int lastIndex = -1;
+  {
+    std::unique_lock<std::shared_mutex> lk(m_sessionMtx);
+    for (int i = 0; i < n; ++i) {
+      const ApplyMsg &message = messages[i];
+      if (message.CommandIndex <= m_lastSnapShotRaftLogIndex) {
+        continue;
+      }
+      if (message.Command.empty()) {
+        // raft的成员变更日志，只推进apply的位置，等在这个index上的ReadIndex读才能返回
+        lastIndex = message.CommandIndex;
+        continue;
+      }
+      Op op;
+      bool parsed = op.parseFromString(message.Command);
+      myAssert(parsed, format("[KvServer::GetCommandsFromRaft-kvserver{%d}] bad command at index %d", m_me,
+                              message.CommandIndex));
+      DPrintf(
+          "[KvServer::GetCommandsFromRaft-kvserver{%d}] , Got Command --> Index:{%d} , ClientId {%llu}, RequestId "
+          "{%d}, Opreation {%s}, Key :{%s}, Value :{%s}",
+          m_me, message.CommandIndex, static_cast<unsigned long long>(op.ClientId), op.RequestId,
+          op.Operation.c_str(), op.Key.c_str(), op.Value.c_str());
+
+      // 每一条日志都先推进日志时间、清理过期的session，所有副本在同一条日志上看到的session表都一样
+      if (op.Timestamp > m_logClockMs) {
+        m_logClockMs = op.Timestamp;
+      }
+      m_sessions.expire(m_logClockMs);
+      if (op.Operation == "Register") {
+        m_sessions.create(message.CommandIndex, m_logClockMs);
+      } else if (op.Operation == "Range") {
+        RangeCommand cmd;
+        bool ok = cmd.decode(op.Value);
+        myAssert(ok, format("[KvServer::GetCommandsFromRaft-kvserver{%d}] bad range command at index %d", m_me,
+                            message.CommandIndex));
+        // 等待的一方只需要结果，Accept带的数据不用再交给它
+        op.Value = applyRangeLocked(cmd, message.CommandIndex) ? OK : ErrWrongGroup;
+      } else {
+        std::string result;
+        applyCommandLocked(op, &result);
+        if (isAtomicOp(op.Operation)) {
+          // 没有执行（重复、session过期、key不在范围里）时为空，handler据此判断
+          op.Value = std::move(result);
+        }
+      }
+      lastIndex = message.CommandIndex;
+      applied.emplace_back(lastIndex, std::move(op));
+    }
+  }
+  markApplied(lastIndex);
+  for (int i = 0; i < n; ++i) {
+    RecordSince(kvMetrics().commitToApply, messages[i].CommittedAtUs);
+  }
+  if (applied.empty()) {
     return;
   }
+  DprintfKVDB();
+  //如果raft的log太大（大于指定的比例）就把制作快照，此时存储引擎正好是lastIndex处的状态
+  if (m_maxRaftState != -1) {
+    IfNeedToSendSnapShotCommand(lastIndex, 9);
+  }
+  // 没有人在等的index直接跳过
+  m_waitApply.CompleteBatch(applied);
+}
 
+void KvServer::applyCommandLocked(const Op &op, std::string *result) {
+  ClientSession *session = m_sessions.touch(op.ClientId, m_logClockMs);
+  if (session == nullptr && op.Timestamp == Op::kNoTimestamp) {
+    // 有session之前写下的日志，第一次见到这个client时补建
+    session = m_sessions.create(op.ClientId, m_logClockMs);
+  }
   // State Machine (KVServer solute the duplicate problem)
   // duplicate command will not be exed
-  if (!ifRequestDuplicate(op.ClientId, op.RequestId)) {
-    // execute command
-    if (op.Operation == "Put") {
-      ExecutePutOpOnKVDB(op);
+  if (session == nullptr) {
+    return;
+  }
+  if (session->requests.contains(op.RequestId)) {
+    // 重试的原子操作：把第一次执行时的结果交给等待的请求
+    if (isAtomicOp(op.Operation) && session->atomicRequestId == op.RequestId) {
+      *result = session->atomicResult;
     }
-    if (op.Operation == "Append") {
-      ExecuteAppendOpOnKVDB(op);
+    return;
+  }
+  // key已经交给别的组了，不执行也不记下，handler据此回复ErrWrongGroup让clerk去新的组
+  if (!opInRangeLocked(op)) {
+    return;
+  }
+  if (op.Operation == "Put" || op.Operation == "Append" || op.Operation == "AppendV2" || op.Operation == "Batch" ||
+      isAtomicOp(op.Operation)) {
+    m_appliedWriteCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  // execute command
+  if (op.Operation == "Put") {
+    ExecutePutOpOnKVDB(op);
+  }
+  if (op.Operation == "Append") {
+    ExecuteAppendOpOnKVDB(op);
+  }
+  if (op.Operation == "AppendV2") {
+    ExecuteAppendV2OpOnKVDB(op);
+  }
+  if (op.Operation == "Batch") {
+    ExecuteBatchOpOnKVDB(op);
+  }
+  if (isAtomicOp(op.Operation)) {
+    std::string err, value;
+    if (op.Operation == "CompareAndSwap") {
+      ExecuteCompareAndSwapOpOnKVDB(op, &err, &value);
+    } else {
+      ExecuteIncrementOpOnKVDB(op, &err, &value);
     }
-    //  kv.lastRequestId[op.ClientId] = op.RequestId  在Executexxx函数里面更新的
+    *result = encodeAtomicResult(err, value);
+    session->atomicRequestId = op.RequestId;
+    session->atomicResult = *result;
   }
-  //到这里kvDB已经制作了快照
-  if (m_maxRaftState != -1) {
-    IfNeedToSendSnapShotCommand(message.CommandIndex, 9);
-    //如果raft的log太大（大于指定的比例）就把制作快照
+  // 读请求也记下，超时之后handler可以据此判断它是否已经提交
+  session->requests.insert(op.RequestId);
+}
+
+bool KvServer::opInRangeLocked(const Op &op) const {
+  if (op.Operation == "Put" || op.Operation == "Append" || op.Operation == "AppendV2" || isAtomicOp(op.Operation)) {
+    return m_rangeState.contains(op.Key);
   }
+  if (op.Operation != "Batch") {
+    return true;
+  }
+  std::vector<Op> ops;
+  Op::decodeBatch(op.Value, &ops);
+  for (const auto &sub : ops) {
+    if (!m_rangeState.contains(sub.Key)) {
+      return false;
+    }
+  }
+  return true;
+}
 
-  // Send message to the chan of op.ClientId
-  SendMessageToWaitChan(op, message.CommandIndex);
+bool KvServer::applyRangeLocked(const RangeCommand &cmd, int raftIndex) {
+  RangeState &st = m_rangeState;
+  const KeyRange &r = cmd.range;
+  if (cmd.kind == "Reserve") {
+    // 目标没有别的迁移在进行：备用组要等上一次交出的旧值删完，有范围的组只能并入相邻的范围
+    bool fits = !st.owned ? st.outgoing.id == 0 : st.range.followedBy(r) || r.followedBy(st.range);
+    if (st.reserved.id != 0 || cmd.peer == m_groupId || !fits) {
+      return false;
+    }
+    std::unique_lock<std::shared_mutex> lk(m_rangeMtx);
+    st.reserved = {raftIndex, cmd.peer, r};
+    return true;
+  }
+  if (cmd.kind == "Handoff") {
+    auto it = st.decided.find(cmd.peer);
+    if (it != st.decided.end() && it->second.first >= cmd.id) {
+      // 重复提交的按第一次的结果；比已经决定过的还旧的预留不会再有人推进
+      return it->second.first == cmd.id && it->second.second;
+    }
+    // 只能整个交出，或者交出后面的一段；自己在等别人交过来的时候不交出
+    bool whole = st.owned && r.start == st.range.start && r.end == st.range.end;
+    bool suffix = st.owned && r.start > st.range.start && st.range.contains(r.start) && r.end == st.range.end;
+    bool ok = (whole || suffix) && st.reserved.id == 0 && st.outgoing.id == 0;
+    std::unique_lock<std::shared_mutex> lk(m_rangeMtx);
+    st.decided[cmd.peer] = {cmd.id, ok};
+    if (!ok) {
+      return false;
+    }
+    if (whole) {
+      st.owned = false;
+      st.range = KeyRange();
+    } else {
+      st.range.end = r.start;
+    }
+    st.outgoing = {cmd.id, cmd.peer, r};
+    return true;
+  }
+  if (cmd.kind == "Accept") {
+    if (st.reserved.id != cmd.id || st.reserved.group != cmd.peer) {
+      auto it = st.accepted.find(cmd.peer);
+      return it != st.accepted.end() && it->second >= cmd.id;
+    }
+    SnapshotReader reader(cmd.data.data(), cmd.data.size());
+    uint32_t n = 0;
+    bool ok = reader.GetFixed32(&n);
+    std::string key, value;
+    for (uint32_t i = 0; ok && i < n; ++i) {
+      ok = DecodeSnapshotField(&reader, &key) && DecodeSnapshotField(&reader, &value);
+      if (ok && st.reserved.range.contains(key)) {
+        m_engine->Put(key, value);
+        m_readCache.Invalidate(key);
+      }
+    }
+    myAssert(ok, format("[KvServer::applyRangeLocked-kvserver{%d}] bad range data at index %d", m_me, raftIndex));
+    std::unique_lock<std::shared_mutex> lk(m_rangeMtx);
+    if (!st.owned) {
+      st.owned = true;
+      st.range = st.reserved.range;
+    } else if (st.range.followedBy(st.reserved.range)) {
+      st.range.end = st.reserved.range.end;
+    } else {
+      st.range.start = st.reserved.range.start;
+    }
+    st.accepted[cmd.peer] = cmd.id;
+    st.reserved = RangeMove();
+    return true;
+  }
+  if (cmd.kind == "HandoffDone") {
+    if (st.outgoing.id != cmd.id || st.outgoing.group != cmd.peer) {
+      return true;
+    }
+    std::vector<std::string> keys;
+    {
+      std::unique_ptr<KvEngine::Iterator> it = m_engine->NewIterator();
+      for (it->seek(st.outgoing.range.start); it->valid() && st.outgoing.range.contains(it->key()); it->next()) {
+        keys.push_back(it->key());
+      }
+    }
+    for (const auto &key : keys) {
+      m_engine->Delete(key);
+      m_readCache.Invalidate(key);
+    }
+    std::unique_lock<std::shared_mutex> lk(m_rangeMtx);
+    st.outgoing = RangeMove();
+    return true;
+  }
+  if (cmd.kind == "Unreserve") {
+    if (st.reserved.id == cmd.id && st.reserved.group == cmd.peer) {
+      std::unique_lock<std::shared_mutex> lk(m_rangeMtx);
+      st.reserved = RangeMove();
+    }
+    return true;
+  }
+  return false;
 }
 
-bool KvServer::ifRequestDuplicate(std::string ClientId, int RequestId) {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  if (m_lastRequestId.find(ClientId) == m_lastRequestId.end()) {
+bool KvServer::SplitKey(std::string *key) {
+  KeyRange range = RangeSnapshot().range;
+  int n = 0;
+  {
+    std::unique_ptr<KvEngine::Iterator> it = m_engine->NewIterator();
+    for (it->seek(range.start); it->valid() && range.contains(it->key()); it->next()) {
+      ++n;
+    }
+  }
+  if (n < 2) {
+    return false;
+  }
+  std::unique_ptr<KvEngine::Iterator> it = m_engine->NewIterator();
+  it->seek(range.start);
+  for (int i = 0; i < n / 2 && it->valid(); ++i) {
+    it->next();
+  }
+  if (!it->valid() || !range.contains(it->key())) {
     return false;
-    // todo :不存在这个client就创建
   }
-  return RequestId <= m_lastRequestId[ClientId];
+  *key = it->key();
+  return true;
+}
+
+std::string KvServer::EncodeRangeData(const KeyRange &range) {
+  // 交出去的范围已经不再接受写入，读到的就是交出时的状态
+  std::string out;
+  PutFixed32(&out, 0);
+  uint32_t n = 0;
+  std::unique_ptr<KvEngine::Iterator> it = m_engine->NewIterator();
+  for (it->seek(range.start); it->valid() && range.contains(it->key()); it->next()) {
+    EncodeSnapshotField(&out, it->key());
+    EncodeSnapshotField(&out, it->value());
+    ++n;
+  }
+  EncodeFixed32(&out[0], n);
+  return out;
+}
+
+std::string KvServer::ProposeRange(const RangeCommand &cmd, std::string *result, int *index) {
+  Op op;
+  op.Operation = "Range";
+  op.Timestamp = NowMs();
+  // 和Register一样靠Key认出自己提交的日志
+  op.Key = std::to_string(m_me) + "-" + std::to_string(op.Timestamp) + "-" + std::to_string(++m_registerSeq);
+  op.Value = cmd.encode();
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, index, &_, &isLeader);
+  if (!isLeader) {
+    return ErrWrongLeader;
+  }
+  Op raftCommitOp;
+  if (!m_waitApply.Wait(*index, CONSENSUS_TIMEOUT, &raftCommitOp) || raftCommitOp.Operation != "Range" ||
+      raftCommitOp.Key != op.Key) {
+    // 每一步都可以重复提交，不确定的结果由调用方下次再推进
+    return ErrWrongLeader;
+  }
+  *result = raftCommitOp.Value;
+  return OK;
+}
+
+void KvServer::RangeAdmin(const raftRpcProctoc::RangeAdminArgs *args, raftRpcProctoc::RangeAdminReply *reply) {
+  // 别的节点只会让目标组写这三种日志，Handoff和HandoffDone由源组的leader在本地提交
+  if (args->op() != "Reserve" && args->op() != "Accept" && args->op() != "Unreserve") {
+    reply->set_err(ErrBadRequest);
+    return;
+  }
+  RangeCommand cmd;
+  cmd.kind = args->op();
+  cmd.peer = args->from();
+  cmd.id = args->id();
+  cmd.range = {args->start(), args->end()};
+  cmd.data = args->data();
+  std::string result;
+  int index = -1;
+  std::string err = ProposeRange(cmd, &result, &index);
+  reply->set_err(err == OK ? result : err);
+  if (err == OK && result == OK) {
+    reply->set_id(index);
+  }
+  setLeaderHint(reply);
+}
+
+bool KvServer::ifRequestDuplicate(uint64_t ClientId, int RequestId) {
+  std::shared_lock<std::shared_mutex> lk(m_sessionMtx);
+  return ifRequestDuplicateLocked(ClientId, RequestId);
+}
+
+bool KvServer::ifRequestDuplicateLocked(uint64_t ClientId, int RequestId) {
+  const ClientSession *session = m_sessions.find(ClientId);
+  return session != nullptr && session->requests.contains(RequestId);
+}
+
+bool KvServer::lastAtomicResult(uint64_t ClientId, int RequestId, std::string *err, std::string *value) {
+  std::shared_lock<std::shared_mutex> lk(m_sessionMtx);
+  const ClientSession *session = m_sessions.find(ClientId);
+  return session != nullptr && session->atomicRequestId == RequestId &&
+         decodeAtomicResult(session->atomicResult, err, value);
 }
 
 // get和put//append執行的具體細節是不一樣的
@@ -213,85 +815,218 @@ void KvServer::PutAppend(const raftKVRpcProctoc::PutAppendArgs *args, raftKVRpcP
   Op op;
   op.Operation = args->op();
   op.Key = args->key();
-  op.Value = args->value();
+  if (op.Operation == "CompareAndSwap") {
+    op.Value = Op::encodeCompareAndSwap(args->expected(), args->expectabsent(), args->value());
+  } else if (op.Operation == "Increment") {
+    op.Value = std::to_string(args->delta());
+  } else if (op.Operation == "Put") {
+    op.Value = args->value();
+  } else if (op.Operation == "Append") {
+    // 客户端的Append要接在原值后面，日志里用新的opcode，旧的"Append"日志照旧覆盖
+    op.Operation = "AppendV2";
+    op.Value = args->value();
+  } else {
+    reply->set_err(ErrBadRequest);
+    return;
+  }
   op.ClientId = args->clientid();
   op.RequestId = args->requestid();
+  op.Timestamp = NowMs();
   int raftIndex = -1;
   int _ = -1;
   bool isleader = false;
 
+  int64_t startUs = MetricsNowUs();
   m_raftNode->Start(op, &raftIndex, &_, &isleader);
+  RecordSince(kvMetrics().propose, startUs);
 
   if (!isleader) {
     DPrintf(
-        "[func -KvServer::PutAppend -kvserver{%d}]From Client %s (Request %d) To Server %d, key %s, raftIndex %d , but "
-        "not leader",
-        m_me, &args->clientid(), args->requestid(), m_me, &op.Key, raftIndex);
+        "[func -KvServer::PutAppend -kvserver{%d}]From Client %llu (Request %d) To Server %d, key %s, raftIndex %d , "
+        "but not leader",
+        m_me, static_cast<unsigned long long>(op.ClientId), args->requestid(), m_me, op.Key.c_str(), raftIndex);
 
     reply->set_err(ErrWrongLeader);
     return;
   }
   DPrintf(
-      "[func -KvServer::PutAppend -kvserver{%d}]From Client %s (Request %d) To Server %d, key %s, raftIndex %d , is "
-      "leader ",
-      m_me, &args->clientid(), args->requestid(), m_me, &op.Key, raftIndex);
-  m_mtx.lock();
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    waitApplyCh.insert(std::make_pair(raftIndex, new LockQueue<Op>()));
-  }
-  auto chForRaftIndex = waitApplyCh[raftIndex];
-
-  m_mtx.unlock();  //直接解锁，等待任务执行完成，不能一直拿锁等待
-
-  // timeout
+      "[func -KvServer::PutAppend -kvserver{%d}]From Client %llu (Request %d) To Server %d, key %s, raftIndex %d , "
+      "is leader ",
+      m_me, static_cast<unsigned long long>(op.ClientId), args->requestid(), m_me, op.Key.c_str(), raftIndex);
+  // 不拿任何KvServer的锁，等待期间apply线程可以正常执行
   Op raftCommitOp;
 
-  if (!chForRaftIndex->timeOutPop(CONSENSUS_TIMEOUT, &raftCommitOp)) {
+  if (!m_waitApply.Wait(raftIndex, CONSENSUS_TIMEOUT, &raftCommitOp)) {
     DPrintf(
         "[func -KvServer::PutAppend -kvserver{%d}]TIMEOUT PUTAPPEND !!!! Server %d , get Command <-- Index:%d , "
-        "ClientId %s, RequestId %s, Opreation %s Key :%s, Value :%s",
-        m_me, m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
+        "ClientId %llu, RequestId %d, Opreation %s Key :%s, Value :%s",
+        m_me, m_me, raftIndex, static_cast<unsigned long long>(op.ClientId), op.RequestId, op.Operation.c_str(),
+        op.Key.c_str(), op.Value.c_str());
 
-    if (ifRequestDuplicate(op.ClientId, op.RequestId)) {
-      reply->set_err(OK);  // 超时了,但因为是重复的请求，返回ok，实际上就算没有超时，在真正执行的时候也要判断是否重复
+    std::string err, value;
+    if (isAtomicOp(op.Operation) && lastAtomicResult(op.ClientId, op.RequestId, &err, &value)) {
+      // 超时了，但是已经执行过，结果还留在session里
+      reply->set_err(err);
+      reply->set_value(value);
+    } else if (ifRequestDuplicate(op.ClientId, op.RequestId)) {
+      // 超时了,但因为是重复的请求，返回ok，实际上就算没有超时，在真正执行的时候也要判断是否重复
+      // 原子操作的结果已经被这个client后来的原子操作替换掉了
+      reply->set_err(isAtomicOp(op.Operation) ? ErrAlreadyApplied : OK);
     } else {
       reply->set_err(ErrWrongLeader);  ///这里返回这个的目的让clerk重新尝试
     }
   } else {
     DPrintf(
         "[func -KvServer::PutAppend -kvserver{%d}]WaitChanGetRaftApplyMessage<--Server %d , get Command <-- Index:%d , "
-        "ClientId %s, RequestId %d, Opreation %s, Key :%s, Value :%s",
-        m_me, m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-    if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
-      //可能发生leader的变更导致日志被覆盖，因此必须检查
-      reply->set_err(OK);
+        "ClientId %llu, RequestId %d, Opreation %s, Key :%s, Value :%s",
+        m_me, m_me, raftIndex, static_cast<unsigned long long>(op.ClientId), op.RequestId, op.Operation.c_str(),
+        op.Key.c_str(), op.Value.c_str());
+    std::string err, value;
+    if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId &&
+        isAtomicOp(op.Operation) && decodeAtomicResult(raftCommitOp.Value, &err, &value)) {
+      reply->set_err(err);
+      reply->set_value(value);
+    } else if (raftCommitOp.ClientId == op.ClientId && raftCommitOp.RequestId == op.RequestId) {
+      //可能发生leader的变更导致日志被覆盖，因此必须检查；session过期或者key已经不在范围里的请求apply时什么都没做
+      // 原子操作执行过但是没有结果的，结果已经被这个client后来的原子操作替换掉了
+      bool executed = ifRequestDuplicate(op.ClientId, op.RequestId);
+      reply->set_err(executed ? (isAtomicOp(op.Operation) ? ErrAlreadyApplied : OK) : notExecutedErr(op));
     } else {
       reply->set_err(ErrWrongLeader);
     }
   }
+}
 
-  m_mtx.lock();
+std::string KvServer::ProposeAndWait(const Op &op) {
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    return ErrWrongLeader;
+  }
+  Op raftCommitOp;
+  if (!m_waitApply.Wait(raftIndex, CONSENSUS_TIMEOUT, &raftCommitOp)) {
+    // 与PutAppend相同，超时但已经执行过的请求算成功
+    return ifRequestDuplicate(op.ClientId, op.RequestId) ? OK : ErrWrongLeader;
+  }
+  //可能发生leader的变更导致日志被覆盖，因此必须检查
+  if (raftCommitOp.ClientId != op.ClientId || raftCommitOp.RequestId != op.RequestId) {
+    return ErrWrongLeader;
+  }
+  return ifRequestDuplicate(op.ClientId, op.RequestId) ? OK : notExecutedErr(op);
+}
 
-  auto tmp = waitApplyCh[raftIndex];
-  waitApplyCh.erase(raftIndex);
-  delete tmp;
-  m_mtx.unlock();
+std::string KvServer::notExecutedErr(const Op &op) {
+  std::shared_lock<std::shared_mutex> lk(m_rangeMtx);
+  return opInRangeLocked(op) ? ErrSessionExpired : ErrWrongGroup;
 }
 
-void KvServer::ReadRaftApplyCommandLoop() {
-  while (true) {
-    //如果只操作applyChan不用拿锁，因为applyChan自己带锁
-    auto message = applyChan->Pop();  //阻塞弹出
-    DPrintf(
-        "---------------tmp-------------[func-KvServer::ReadRaftApplyCommandLoop()-kvserver{%d}] 收到了下raft的消息",
-        m_me);
-    // listen to every command applied by its raft ,delivery to relative RPC Handler
+void KvServer::BatchPut(const raftKVRpcProctoc::BatchPutArgs *args, raftKVRpcProctoc::BatchPutReply *reply) {
+  std::vector<Op> ops;
+  ops.reserve(args->ops_size());
+  for (const auto &item : args->ops()) {
+    Op sub;
+    sub.Operation = item.op().empty() ? "Put" : item.op();
+    if (sub.Operation == "Append") {
+      sub.Operation = "AppendV2";
+    } else if (sub.Operation != "Put") {
+      reply->set_err(ErrBadRequest);
+      return;
+    }
+    sub.Key = item.key();
+    sub.Value = item.value();
+    sub.RequestId = 0;
+    ops.push_back(std::move(sub));
+  }
+  Op op;
+  op.Operation = "Batch";
+  op.Value = Op::encodeBatch(ops);
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = NowMs();
+  reply->set_err(ProposeAndWait(op));
+}
 
-    if (message.CommandValid) {
-      GetCommandFromRaft(message);
+void KvServer::BatchGet(const raftKVRpcProctoc::BatchGetArgs *args, raftKVRpcProctoc::BatchGetReply *reply) {
+  int readIndex = -1;
+  bool isLeader = false;
+  if (m_raftNode->ReadIndex(&readIndex, &isLeader)) {
+    if (WaitApplied(readIndex)) {
+      BatchGetKVDB(args, reply);
+    } else {
+      reply->set_err(ErrWrongLeader);
     }
-    if (message.SnapshotValid) {
-      GetSnapShotFromRaft(message);
+    return;
+  }
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    return;
+  }
+  // 刚当选时先提交一条空的batch，它apply之后本地状态就不旧于请求到达的时刻，读不需要session
+  Op op;
+  op.Operation = "Batch";
+  op.ClientId = args->clientid();
+  op.RequestId = args->requestid();
+  op.Timestamp = NowMs();
+  if (ProposeAndWait(op) != ErrWrongLeader) {
+    BatchGetKVDB(args, reply);
+  } else {
+    reply->set_err(ErrWrongLeader);
+  }
+}
+
+void KvServer::RegisterClient(const raftKVRpcProctoc::RegisterClientArgs *args,
+                              raftKVRpcProctoc::RegisterClientReply *reply) {
+  Op op;
+  op.Operation = "Register";
+  op.Timestamp = NowMs();
+  // 同一个index上如果换成了别的节点提交的Register，靠Key区分开
+  op.Key = std::to_string(m_me) + "-" + std::to_string(op.Timestamp) + "-" + std::to_string(++m_registerSeq);
+  int raftIndex = -1;
+  int _ = -1;
+  bool isLeader = false;
+  m_raftNode->Start(op, &raftIndex, &_, &isLeader);
+  if (!isLeader) {
+    reply->set_err(ErrWrongLeader);
+    return;
+  }
+  Op raftCommitOp;
+  if (!m_waitApply.Wait(raftIndex, CONSENSUS_TIMEOUT, &raftCommitOp) || raftCommitOp.Operation != "Register" ||
+      raftCommitOp.Key != op.Key) {
+    // 没有确认的Register即使提交了也只是多一个没人用的session，会自己过期
+    reply->set_err(ErrWrongLeader);
+    return;
+  }
+  reply->set_err(OK);
+  reply->set_clientid(raftIndex);
+}
+
+void KvServer::ReadRaftApplyCommandLoop() {
+  std::vector<ApplyMsgBatch> batches;
+  while (true) {
+    // applyChan只有这一个消费者，不用拿锁；阻塞到有数据，再把已经推送的批一起取走
+    batches.clear();
+    applyChan->drain(&batches, RAFT_APPLY_QUEUE_CAPACITY);
+    for (auto &batch : batches) {
+      DPrintf(
+          "---------------tmp-------------[func-KvServer::ReadRaftApplyCommandLoop()-kvserver{%d}] 收到了下raft的消息{%zu}条",
+          m_me, batch.size());
+      // listen to every command applied by its raft ,delivery to relative RPC Handler
+      // 连续的日志一起执行，遇到快照单独安装
+      size_t begin = 0;
+      for (size_t i = 0; i <= batch.size(); ++i) {
+        if (i < batch.size() && batch[i].CommandValid) {
+          continue;
+        }
+        if (i > begin) {
+          GetCommandsFromRaft(&batch[begin], i - begin);
+        }
+        if (i < batch.size() && batch[i].SnapshotValid) {
+          GetSnapShotFromRaft(batch[i]);
+        }
+        begin = i + 1;
+      }
     }
   }
 }
@@ -321,130 +1056,183 @@ void KvServer::ReadSnapShotToInstall(std::string snapshot) {
   //    }
 }
 
-bool KvServer::SendMessageToWaitChan(const Op &op, int raftIndex) {
-  std::lock_guard<std::mutex> lg(m_mtx);
-  DPrintf(
-      "[RaftApplyMessageSendToWaitChan--> raftserver{%d}] , Send Command --> Index:{%d} , ClientId {%d}, RequestId "
-      "{%d}, Opreation {%v}, Key :{%v}, Value :{%v}",
-      m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-
-  if (waitApplyCh.find(raftIndex) == waitApplyCh.end()) {
-    return false;
-  }
-  waitApplyCh[raftIndex]->Push(op);
-  DPrintf(
-      "[RaftApplyMessageSendToWaitChan--> raftserver{%d}] , Send Command --> Index:{%d} , ClientId {%d}, RequestId "
-      "{%d}, Opreation {%v}, Key :{%v}, Value :{%v}",
-      m_me, raftIndex, &op.ClientId, op.RequestId, &op.Operation, &op.Key, &op.Value);
-  return true;
-}
-
 void KvServer::IfNeedToSendSnapShotCommand(int raftIndex, int proportion) {
   if (m_raftNode->GetRaftStateSize() > m_maxRaftState / 10.0) {
     // Send SnapShot Command
-    auto snapshot = MakeSnapShot();
+    // 上一个快照还没做完就先不做，日志会在下一次检查时再触发
+    if (!m_snapshotInProgress.load()) {
+      MakeSnapShotInBackground(raftIndex);
+    }
+  }
+}
+
+void KvServer::MakeSnapShotInBackground(int raftIndex) {
+  WaitBackgroundSnapShot();
+  // 运行在apply线程中，此时存储引擎和m_sessions正好是raftIndex处的状态
+  if (!m_engine->BeginSnapshot()) {
+    return;
+  }
+  // session表不大，直接在这里编码好，后台线程只需要写存储引擎的数据
+  std::string header;
+  {
+    std::shared_lock<std::shared_mutex> lk(m_sessionMtx);
+    encodeSnapshotHeader(&header);
+  }
+  m_snapshotInProgress.store(true);
+  m_snapshotThread = std::thread([this, raftIndex, snapshot = std::move(header)]() mutable {
+    m_engine->DumpSnapshot(&snapshot);
     m_raftNode->Snapshot(raftIndex, snapshot);
+    m_snapshotInProgress.store(false);
+  });
+}
+
+void KvServer::WaitBackgroundSnapShot() {
+  if (m_snapshotThread.joinable()) {
+    m_snapshotThread.join();
   }
 }
 
 void KvServer::GetSnapShotFromRaft(ApplyMsg message) {
-  std::lock_guard<std::mutex> lg(m_mtx);
+  // 安装快照会整体替换存储引擎的内容，不能与后台快照并发
+  WaitBackgroundSnapShot();
 
   if (m_raftNode->CondInstallSnapshot(message.SnapshotTerm, message.SnapshotIndex, message.Snapshot)) {
-    ReadSnapShotToInstall(message.Snapshot);
+    {
+      std::unique_lock<std::shared_mutex> lk(m_sessionMtx);
+      ReadSnapShotToInstall(message.Snapshot);
+      m_readCache.Clear();
+    }
     m_lastSnapShotRaftLogIndex = message.SnapshotIndex;
+    markApplied(message.SnapshotIndex);
   }
 }
 
 std::string KvServer::MakeSnapShot() {
-  std::lock_guard<std::mutex> lg(m_mtx);
+  std::shared_lock<std::shared_mutex> lk(m_sessionMtx);
   std::string snapshotData = getSnapshotData();
   return snapshotData;
 }
 
 void KvServer::PutAppend(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::PutAppendArgs *request,
                          ::raftKVRpcProctoc::PutAppendReply *response, ::google::protobuf::Closure *done) {
-  KvServer::PutAppend(request, response);
+  m_requestCount.fetch_add(1, std::memory_order_relaxed);
+  {
+    ScopedLatency latency(kvMetrics().put);
+    KvServer::PutAppend(request, response);
+  }
+  setLeaderHint(response);
   done->Run();
 }
 
 void KvServer::Get(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::GetArgs *request,
                    ::raftKVRpcProctoc::GetReply *response, ::google::protobuf::Closure *done) {
-  KvServer::Get(request, response);
+  m_requestCount.fetch_add(1, std::memory_order_relaxed);
+  {
+    ScopedLatency latency(kvMetrics().get);
+    KvServer::Get(request, response);
+  }
+  setLeaderHint(response);
   done->Run();
 }
 
-KvServer::KvServer(int me, int maxraftstate, std::string nodeInforFileName, short port) : m_skipList(6) {
-  std::shared_ptr<Persister> persister = std::make_shared<Persister>(me);
+void KvServer::Scan(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::ScanArgs *request,
+                    ::raftKVRpcProctoc::ScanReply *response, ::google::protobuf::Closure *done) {
+  m_requestCount.fetch_add(1, std::memory_order_relaxed);
+  {
+    ScopedLatency latency(kvMetrics().scan);
+    KvServer::Scan(request, response);
+  }
+  setLeaderHint(response);
+  done->Run();
+}
 
-  m_me = me;
-  m_maxRaftState = maxraftstate;
+void KvServer::BatchPut(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::BatchPutArgs *request,
+                        ::raftKVRpcProctoc::BatchPutReply *response, ::google::protobuf::Closure *done) {
+  m_requestCount.fetch_add(1, std::memory_order_relaxed);
+  {
+    ScopedLatency latency(kvMetrics().batchPut);
+    KvServer::BatchPut(request, response);
+  }
+  setLeaderHint(response);
+  done->Run();
+}
 
-  applyChan = std::make_shared<LockQueue<ApplyMsg> >();
+void KvServer::RegisterClient(google::protobuf::RpcController *controller,
+                              const ::raftKVRpcProctoc::RegisterClientArgs *request,
+                              ::raftKVRpcProctoc::RegisterClientReply *response, ::google::protobuf::Closure *done) {
+  KvServer::RegisterClient(request, response);
+  setLeaderHint(response);
+  done->Run();
+}
 
-  m_raftNode = std::make_shared<Raft>();
-  ////////////////clerk层面 kvserver开启rpc接受功能
-  //    同时raft与raft节点之间也要开启rpc功能，因此有两个注册
-  std::thread t([this, port]() -> void {
-    // provider是一个rpc网络服务对象。把UserService对象发布到rpc节点上
-    RpcProvider provider;
-    provider.NotifyService(this);
-    provider.NotifyService(
-        this->m_raftNode.get());  // todo：这里获取了原始指针，后面检查一下有没有泄露的问题 或者 shareptr释放的问题
-    // 启动一个rpc服务发布节点   Run以后，进程进入阻塞状态，等待远程的rpc调用请求
-    provider.Run(m_me, port);
-  });
-  t.detach();
-
-  ////开启rpc远程调用能力，需要注意必须要保证所有节点都开启rpc接受功能之后才能开启rpc远程调用能力
-  ////这里使用睡眠来保证
-  std::cout << "raftServer node:" << m_me << " start to sleep to wait all ohter raftnode start!!!!" << std::endl;
-  sleep(6);
-  std::cout << "raftServer node:" << m_me << " wake up!!!! start to connect other raftnode" << std::endl;
-  //获取所有raft节点ip、port ，并进行连接  ,要排除自己
-  MprpcConfig config;
-  config.LoadConfigFile(nodeInforFileName.c_str());
-  std::vector<std::pair<std::string, short> > ipPortVt;
-  for (int i = 0; i < INT_MAX - 1; ++i) {
-    std::string node = "node" + std::to_string(i);
-
-    std::string nodeIp = config.Load(node + "ip");
-    std::string nodePortStr = config.Load(node + "port");
-    if (nodeIp.empty()) {
-      break;
-    }
-    ipPortVt.emplace_back(nodeIp, atoi(nodePortStr.c_str()));  //沒有atos方法，可以考慮自己实现
+void KvServer::BatchGet(google::protobuf::RpcController *controller, const ::raftKVRpcProctoc::BatchGetArgs *request,
+                        ::raftKVRpcProctoc::BatchGetReply *response, ::google::protobuf::Closure *done) {
+  m_requestCount.fetch_add(1, std::memory_order_relaxed);
+  {
+    ScopedLatency latency(kvMetrics().batchGet);
+    KvServer::BatchGet(request, response);
   }
-  std::vector<std::shared_ptr<RaftRpcUtil> > servers;
-  //进行连接
-  for (int i = 0; i < ipPortVt.size(); ++i) {
-    if (i == m_me) {
-      servers.push_back(nullptr);
-      continue;
-    }
-    std::string otherNodeIp = ipPortVt[i].first;
-    short otherNodePort = ipPortVt[i].second;
-    auto *rpc = new RaftRpcUtil(otherNodeIp, otherNodePort);
-    servers.push_back(std::shared_ptr<RaftRpcUtil>(rpc));
+  setLeaderHint(response);
+  done->Run();
+}
 
-    std::cout << "node" << m_me << " 连接node" << i << "success!" << std::endl;
-  }
-  sleep(ipPortVt.size() - me);  //等待所有节点相互连接成功，再启动raft
-  m_raftNode->init(servers, m_me, persister, applyChan);
+KvServer::KvServer(int me, int groupId, bool owned, KeyRange range, int maxraftstate, const std::string &engine,
+                   const std::string &engineDir)
+    : m_me(me), m_groupId(groupId), m_maxRaftState(maxraftstate), m_engine(NewKvEngine(engine, engineDir)) {
+  m_rangeState.owned = owned;
+  m_rangeState.range = owned ? std::move(range) : KeyRange();
+  m_logClockMs = 0;
+  m_lastSnapShotRaftLogIndex = 0;  // todo:感覺這個函數沒什麼用，不如直接調用raft節點中的snapshot值？？？
+  applyChan = std::make_shared<MpscQueue<ApplyMsgBatch> >(RAFT_APPLY_QUEUE_CAPACITY);
+  // 先建好raft对象，rpc服务启动之后就能收到发给这个组的请求
+  m_raftNode = std::make_shared<Raft>();
+}
+
+void KvServer::StartKVServer(std::vector<std::shared_ptr<RaftRpcUtil> > peers,
+                             const raftRpcProctoc::Membership &bootstrap, std::shared_ptr<WalLog> wal,
+                             std::shared_ptr<monsoon::IOManager> ioManager) {
+  auto persister = std::make_shared<Persister>(m_me, m_groupId, std::move(wal));
   // kv的server直接与raft通信，但kv不直接与raft通信，所以需要把ApplyMsg的chan传递下去用于通信，两者的persist也是共用的
+  m_raftNode->init(peers, bootstrap, m_me, persister, applyChan, m_groupId, std::move(ioManager));
 
-  //////////////////////////////////
+  // 直接在mmap的快照文件上解析，raft的Restore已经校验过同一个映射；存储引擎按块并行解码、顺序建表
+  auto snapshot = persister->MapSnapshot();
+  if (snapshot && snapshot->Size() > 0) {
+    int64_t startUs = MetricsNowUs();
+    parseFromArray(snapshot->Data(), snapshot->Size());
+    // raft从快照点之后开始apply，ReadIndex读要知道快照已经包含了哪些日志
+    m_lastSnapShotRaftLogIndex = snapshot->LastIncludedIndex();
+    LOG_INFO("kvserver{%d} group{%d} loaded snapshot at index %d: %zu bytes, %d keys in %lld ms", m_me, m_groupId,
+             m_lastSnapShotRaftLogIndex, snapshot->Size(), m_engine->Size(),
+             static_cast<long long>((MetricsNowUs() - startUs) / 1000));
+  }
+  m_lastAppliedIndex = m_lastSnapShotRaftLogIndex;
 
-  // You may need initialization code here.
-  // m_kvDB; //kvdb初始化
-  m_skipList;
-  waitApplyCh;
-  m_lastRequestId;
-  m_lastSnapShotRaftLogIndex = 0;  // todo:感覺這個函數沒什麼用，不如直接調用raft節點中的snapshot值？？？
-  auto snapshot = persister->ReadSnapshot();
-  if (!snapshot.empty()) {
-    ReadSnapShotToInstall(snapshot);
+  std::string label = format("{group=\"%d\"}", m_groupId);
+  Metrics::Instance().Gauge("kv_keys" + label, "存储引擎里的key数", [this]() {
+    return static_cast<double>(m_engine->Size());
+  });
+  Metrics::Instance().Gauge("kv_sessions" + label, "session表里的client数", [this]() {
+    std::shared_lock<std::shared_mutex> lk(m_sessionMtx);
+    return static_cast<double>(m_sessions.size());
+  });
+  Metrics::Instance().Gauge("kv_read_cache_hits" + label, "leader读命中热点缓存的次数", [this]() {
+    return static_cast<double>(m_readCache.stats().hits);
+  });
+  Metrics::Instance().Gauge("kv_read_cache_misses" + label, "leader读没命中、自己查了存储引擎的次数", [this]() {
+    return static_cast<double>(m_readCache.stats().misses);
+  });
+  Metrics::Instance().Gauge("kv_read_cache_coalesced" + label, "leader读没命中、等了同一个key上别的读的结果的次数", [this]() {
+    return static_cast<double>(m_readCache.stats().coalesced);
+  });
+  Metrics::Instance().Gauge("kv_last_applied" + label, "在状态机上执行到的raft index", [this]() {
+    return static_cast<double>(m_lastAppliedIndex.load());
+  });
+  m_applyThread = std::thread(&KvServer::ReadRaftApplyCommandLoop, this);
+}
+
+void KvServer::WaitApplyLoop() {
+  if (m_applyThread.joinable()) {
+    m_applyThread.join();
   }
-  std::thread t2(&KvServer::ReadRaftApplyCommandLoop, this);  //马上向其他节点宣告自己就是leader
-  t2.join();  //由於ReadRaftApplyCommandLoop一直不會結束，达到一直卡在这的目的
 }
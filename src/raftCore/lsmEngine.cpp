@@ -0,0 +1,712 @@
+#include "lsmEngine.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "snapshotCodec.h"
+#include "util.h"
+
+namespace {
+// 记录在key和record之外估计的内存开销，只用来判断memtable什么时候写满
+constexpr long long LSM_RECORD_OVERHEAD = 64;
+
+// 合并的输入之一，key升序，同一个来源里key不重复
+class LsmSource {
+ public:
+  virtual ~LsmSource() = default;
+  virtual bool valid() const = 0;
+  virtual void seek(const std::string &target) = 0;
+  virtual void seekToFirst() = 0;
+  virtual void next() = 0;
+  virtual const std::string &key() const = 0;
+  virtual const std::string &record() const = 0;
+};
+
+class MemSource : public LsmSource {
+ public:
+  explicit MemSource(std::shared_ptr<SkipList<std::string, std::string> > list)
+      : m_list(std::move(list)), m_it(*m_list) {}
+  bool valid() const override { return m_it.valid(); }
+  void seek(const std::string &target) override {
+    m_it.seek(target);
+    load();
+  }
+  void seekToFirst() override {
+    m_it.seek_to_first();
+    load();
+  }
+  void next() override {
+    m_it.next();
+    load();
+  }
+  const std::string &key() const override { return m_key; }
+  const std::string &record() const override { return m_record; }
+
+ private:
+  void load() {
+    if (m_it.valid()) {
+      m_key = m_it.key();
+      m_record = m_it.value();
+    }
+  }
+
+  std::shared_ptr<SkipList<std::string, std::string> > m_list;  // 要比m_it活得久
+  SkipList<std::string, std::string>::Iterator m_it;
+  std::string m_key;
+  std::string m_record;
+};
+
+class TableSource : public LsmSource {
+ public:
+  explicit TableSource(std::shared_ptr<const SSTable> table) : m_it(std::move(table)) {}
+  bool valid() const override { return m_it.valid(); }
+  void seek(const std::string &target) override { m_it.seek(target); }
+  void seekToFirst() override { m_it.seekToFirst(); }
+  void next() override { m_it.next(); }
+  const std::string &key() const override { return m_it.key(); }
+  const std::string &record() const override { return m_it.record(); }
+
+ private:
+  SSTable::Iterator m_it;
+};
+
+// 同一层里按key有序、互不重叠的一串文件，一个文件读完接着读下一个
+class LevelSource : public LsmSource {
+ public:
+  explicit LevelSource(std::vector<std::shared_ptr<SSTable> > tables) : m_tables(std::move(tables)), m_table(0) {}
+  bool valid() const override { return m_it != nullptr && m_it->valid(); }
+  void seek(const std::string &target) override {
+    auto it = std::lower_bound(
+        m_tables.begin(), m_tables.end(), target,
+        [](const std::shared_ptr<SSTable> &table, const std::string &k) { return table->Largest() < k; });
+    m_table = it - m_tables.begin();
+    if (open()) {
+      m_it->seek(target);
+      skipExhausted();
+    }
+  }
+  void seekToFirst() override {
+    m_table = 0;
+    if (open()) {
+      m_it->seekToFirst();
+      skipExhausted();
+    }
+  }
+  void next() override {
+    m_it->next();
+    skipExhausted();
+  }
+  const std::string &key() const override { return m_it->key(); }
+  const std::string &record() const override { return m_it->record(); }
+
+ private:
+  bool open() {
+    if (m_table >= m_tables.size()) {
+      m_it.reset();
+      return false;
+    }
+    m_it.reset(new SSTable::Iterator(m_tables[m_table]));
+    return true;
+  }
+  void skipExhausted() {
+    while (!m_it->valid()) {
+      ++m_table;
+      if (!open()) {
+        return;
+      }
+      m_it->seekToFirst();
+    }
+  }
+
+  std::vector<std::shared_ptr<SSTable> > m_tables;
+  size_t m_table;
+  std::unique_ptr<SSTable::Iterator> m_it;
+};
+
+// 快照（跳表的"SLS1"格式）里的全部kv，变成值记录，Load用它直接写文件
+class SnapshotRecords {
+ public:
+  SnapshotRecords(const char *data, size_t len)
+      : m_reader(data, len), m_block(nullptr, 0), m_left(0), m_count(0), m_valid(true), m_ok(true) {
+    next();
+  }
+  bool valid() const { return m_valid; }
+  bool ok() const { return m_ok; }
+  void next() {
+    while (m_left == 0) {
+      uint32_t count = 0, payloadLen = 0, crc = 0;
+      if (!m_reader.GetFixed32(&count) || !m_reader.GetFixed32(&payloadLen) || !m_reader.GetFixed32(&crc) ||
+          (count > 0 && (m_reader.remaining() < payloadLen || Crc32(m_reader.data(), payloadLen) != crc))) {
+        fail();
+        return;
+      }
+      if (count == 0) {
+        m_valid = false;
+        return;
+      }
+      m_block = SnapshotReader(m_reader.data(), payloadLen);
+      m_reader.Skip(payloadLen);
+      m_left = count;
+    }
+    std::string value;
+    std::string key;
+    if (!DecodeSnapshotField(&m_block, &key) || !DecodeSnapshotField(&m_block, &value) ||
+        (m_count > 0 && !(m_key < key))) {
+      fail();
+      return;
+    }
+    m_key = std::move(key);
+    m_record.assign(1, LSM_TYPE_VALUE);
+    m_record.append(value);
+    --m_left;
+    ++m_count;
+  }
+  const std::string &key() const { return m_key; }
+  const std::string &record() const { return m_record; }
+
+ private:
+  void fail() {
+    m_valid = false;
+    m_ok = false;
+  }
+
+  SnapshotReader m_reader;
+  SnapshotReader m_block;
+  uint32_t m_left;
+  uint64_t m_count;
+  bool m_valid;
+  bool m_ok;
+  std::string m_key;
+  std::string m_record;
+};
+
+// 旧版本的boost文本快照先读进一个临时的跳表，再从这里写文件
+class ListRecords {
+ public:
+  explicit ListRecords(SkipList<std::string, std::string> &list) : m_it(list) {
+    m_it.seek_to_first();
+    load();
+  }
+  bool valid() const { return m_it.valid(); }
+  bool ok() const { return true; }
+  void next() {
+    m_it.next();
+    load();
+  }
+  const std::string &key() const { return m_key; }
+  const std::string &record() const { return m_record; }
+
+ private:
+  void load() {
+    if (m_it.valid()) {
+      m_key = m_it.key();
+      m_record.assign(1, LSM_TYPE_VALUE);
+      m_record.append(m_it.value());
+    }
+  }
+
+  SkipList<std::string, std::string>::Iterator m_it;
+  std::string m_key;
+  std::string m_record;
+};
+
+void makeDirs(const std::string &dir) {
+  for (size_t pos = dir.find('/', 1); ; pos = dir.find('/', pos + 1)) {
+    std::string prefix = dir.substr(0, pos);
+    if (::mkdir(prefix.c_str(), 0755) != 0 && errno != EEXIST) {
+      DPrintf("[func-LsmEngine] mkdir %s error: %s", prefix.c_str(), strerror(errno));
+    }
+    if (pos == std::string::npos) {
+      return;
+    }
+  }
+}
+
+bool isTableFile(const std::string &name) {
+  return name.size() > 4 && name.compare(name.size() - 4, 4, ".sst") == 0;
+}
+}  // namespace
+
+// 多个来源的归并，来源按新旧排好，同一个key以最新的来源为准
+// keepDeletions为false时跳过删除记录，只给出还存在的key（KvEngine::Iterator的语义）；合并时要保留删除记录
+class LsmEngine::MergingIterator : public KvEngine::Iterator {
+ public:
+  MergingIterator(std::shared_ptr<const LsmVersion> version, std::vector<std::unique_ptr<LsmSource> > sources,
+                  bool keepDeletions)
+      : m_version(std::move(version)), m_sources(std::move(sources)), m_keepDeletions(keepDeletions), m_current(-1) {}
+
+  // version里的全部来源，withMem为false时不含当前的memtable
+  static std::unique_ptr<MergingIterator> Over(std::shared_ptr<const LsmVersion> version, bool withMem,
+                                               bool keepDeletions) {
+    std::vector<std::unique_ptr<LsmSource> > sources;
+    if (withMem) {
+      sources.emplace_back(new MemSource(listOf(version->mem)));
+    }
+    for (const auto &mem : version->imm) {
+      sources.emplace_back(new MemSource(listOf(mem)));
+    }
+    for (const auto &table : version->levels[0]) {
+      sources.emplace_back(new TableSource(table));
+    }
+    for (int level = 1; level < LSM_MAX_LEVELS; ++level) {
+      if (!version->levels[level].empty()) {
+        sources.emplace_back(new LevelSource(version->levels[level]));
+      }
+    }
+    return std::unique_ptr<MergingIterator>(new MergingIterator(std::move(version), std::move(sources), keepDeletions));
+  }
+
+  static std::shared_ptr<SkipList<std::string, std::string> > listOf(const std::shared_ptr<MemTable> &mem) {
+    return std::shared_ptr<SkipList<std::string, std::string> >(mem, &mem->list);
+  }
+
+  bool valid() const override { return m_current >= 0; }
+  void seek(const std::string &target) override {
+    for (auto &source : m_sources) {
+      source->seek(target);
+    }
+    settle();
+  }
+  void seekToFirst() {
+    for (auto &source : m_sources) {
+      source->seekToFirst();
+    }
+    settle();
+  }
+  void next() override {
+    skipCurrentKey();
+    settle();
+  }
+  std::string key() const override { return m_sources[m_current]->key(); }
+  std::string value() const override { return m_sources[m_current]->record().substr(1); }
+  const std::string &rawKey() const { return m_sources[m_current]->key(); }
+  const std::string &record() const { return m_sources[m_current]->record(); }
+
+ private:
+  // 最小的key所在的来源，相同的key取最新的来源
+  void findSmallest() {
+    m_current = -1;
+    for (int i = 0; i < static_cast<int>(m_sources.size()); ++i) {
+      if (m_sources[i]->valid() && (m_current < 0 || m_sources[i]->key() < m_sources[m_current]->key())) {
+        m_current = i;
+      }
+    }
+  }
+  // 所有来源都越过当前的key
+  void skipCurrentKey() {
+    std::string key = m_sources[m_current]->key();
+    for (auto &source : m_sources) {
+      if (source->valid() && source->key() == key) {
+        source->next();
+      }
+    }
+  }
+  void settle() {
+    while (true) {
+      findSmallest();
+      if (m_current < 0 || m_keepDeletions || record()[0] != LSM_TYPE_DELETION) {
+        return;
+      }
+      skipCurrentKey();
+    }
+  }
+
+  std::shared_ptr<const LsmVersion> m_version;  // 来源里的memtable和文件都靠它保持存活
+  std::vector<std::unique_ptr<LsmSource> > m_sources;
+  bool m_keepDeletions;
+  int m_current;
+};
+
+LsmEngine::LsmEngine(const std::string &dir) : m_dir(dir), m_nextFileNumber(1), m_generation(0), m_stop(false) {
+  makeDirs(m_dir);
+  // 上次运行留下的文件不再有用，内容会从raft快照和日志里重新建立
+  DIR *d = ::opendir(m_dir.c_str());
+  if (d != nullptr) {
+    while (struct dirent *entry = ::readdir(d)) {
+      std::string name = entry->d_name;
+      if (isTableFile(name)) {
+        ::unlink((m_dir + "/" + name).c_str());
+      }
+    }
+    ::closedir(d);
+  }
+  auto version = std::make_shared<LsmVersion>();
+  version->mem = std::make_shared<MemTable>();
+  m_current = version;
+  m_background = std::thread(&LsmEngine::backgroundLoop, this);
+}
+
+LsmEngine::~LsmEngine() {
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  m_background.join();
+}
+
+std::shared_ptr<const LsmEngine::LsmVersion> LsmEngine::current() {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  return m_current;
+}
+
+std::string LsmEngine::tablePath(uint64_t number) const {
+  char name[32];
+  snprintf(name, sizeof(name), "/%06llu.sst", static_cast<unsigned long long>(number));
+  return m_dir + name;
+}
+
+uint64_t LsmEngine::levelLimit(int level) {
+  uint64_t limit = LSM_LEVEL1_BYTES;
+  for (int i = 1; i < level; ++i) {
+    limit *= LSM_LEVEL_MULTIPLIER;
+  }
+  return limit;
+}
+
+bool LsmEngine::Get(const std::string &key, std::string *value) {
+  std::shared_ptr<const LsmVersion> version = current();
+  std::string record;
+  bool found = version->mem->list.search_element(key, record);
+  for (size_t i = 0; !found && i < version->imm.size(); ++i) {
+    found = version->imm[i]->list.search_element(key, record);
+  }
+  for (size_t i = 0; !found && i < version->levels[0].size(); ++i) {
+    found = version->levels[0][i]->Get(key, &record);
+  }
+  for (int level = 1; !found && level < LSM_MAX_LEVELS; ++level) {
+    const auto &tables = version->levels[level];
+    auto it = std::lower_bound(
+        tables.begin(), tables.end(), key,
+        [](const std::shared_ptr<SSTable> &table, const std::string &k) { return table->Largest() < k; });
+    found = it != tables.end() && (*it)->Get(key, &record);
+  }
+  if (!found || record.empty() || record[0] != LSM_TYPE_VALUE) {
+    return false;
+  }
+  value->assign(record, 1, std::string::npos);
+  return true;
+}
+
+void LsmEngine::Put(const std::string &key, const std::string &value) {
+  std::string record(1, LSM_TYPE_VALUE);
+  record.append(value);
+  write(key, record);
+}
+
+void LsmEngine::Delete(const std::string &key) { write(key, std::string(1, LSM_TYPE_DELETION)); }
+
+void LsmEngine::write(const std::string &key, const std::string &record) {
+  // 只有apply线程写，拿到的memtable在写完之前不会被别人冻结
+  std::shared_ptr<const LsmVersion> version = current();
+  std::string k = key;
+  std::string r = record;
+  version->mem->list.insert_set_element(k, r);
+  long long bytes = version->mem->bytes.fetch_add(key.size() + record.size() + LSM_RECORD_OVERHEAD) + key.size() +
+                    record.size() + LSM_RECORD_OVERHEAD;
+  if (bytes >= LSM_MEMTABLE_BYTES) {
+    std::unique_lock<std::mutex> lk(m_mtx);
+    freezeMemTable(lk);
+  }
+}
+
+void LsmEngine::freezeMemTable(std::unique_lock<std::mutex> &lk) {
+  if (m_current->mem->bytes.load() == 0) {
+    return;
+  }
+  // 后台线程落盘跟不上时写入在这里等，冻结的memtable不会无限增长
+  m_cv.wait(lk, [this]() { return m_stop || m_current->imm.size() < LSM_MAX_IMMUTABLE_MEMTABLES; });
+  auto version = std::make_shared<LsmVersion>(*m_current);
+  version->imm.insert(version->imm.begin(), version->mem);
+  version->mem = std::make_shared<MemTable>();
+  m_current = version;
+  m_cv.notify_all();
+}
+
+std::unique_ptr<KvEngine::Iterator> LsmEngine::NewIterator() {
+  return MergingIterator::Over(current(), true, false);
+}
+
+int LsmEngine::Size() {
+  std::shared_ptr<const LsmVersion> version = current();
+  long long n = version->mem->list.size();
+  for (const auto &mem : version->imm) {
+    n += mem->list.size();
+  }
+  for (const auto &level : version->levels) {
+    for (const auto &table : level) {
+      n += table->Entries();
+    }
+  }
+  return static_cast<int>(std::min<long long>(n, INT32_MAX));
+}
+
+bool LsmEngine::BeginSnapshot() {
+  if (m_snapshotActive.load()) {
+    return false;
+  }
+  std::unique_lock<std::mutex> lk(m_mtx);
+  // 冻结之后这一刻的数据都在imm和文件里，后面的写入只进新的memtable
+  freezeMemTable(lk);
+  m_snapshotVersion = m_current;
+  m_snapshotActive.store(true);
+  return true;
+}
+
+void LsmEngine::DumpSnapshot(std::string *out) {
+  out->append(SKIPLIST_SNAPSHOT_MAGIC, sizeof(SKIPLIST_SNAPSHOT_MAGIC));
+  SnapshotBlockWriter writer(out);
+  auto it = MergingIterator::Over(m_snapshotVersion, false, false);
+  for (it->seekToFirst(); it->valid(); it->next()) {
+    writer.add(it->rawKey(), it->value());
+  }
+  writer.finish();
+  it.reset();
+  m_snapshotVersion.reset();
+  m_snapshotActive.store(false);
+}
+
+void LsmEngine::DumpTo(std::string *out) {
+  out->append(SKIPLIST_SNAPSHOT_MAGIC, sizeof(SKIPLIST_SNAPSHOT_MAGIC));
+  SnapshotBlockWriter writer(out);
+  auto it = MergingIterator::Over(current(), true, false);
+  for (it->seekToFirst(); it->valid(); it->next()) {
+    writer.add(it->rawKey(), it->value());
+  }
+  writer.finish();
+}
+
+bool LsmEngine::Load(const char *data, size_t len) {
+  if (len == 0) {
+    return true;
+  }
+  // 快照本身有序，直接写成最底层的文件，不经过memtable和合并
+  std::vector<std::shared_ptr<SSTable> > tables;
+  bool ok = false;
+  if (len >= sizeof(SKIPLIST_SNAPSHOT_MAGIC) &&
+      memcmp(data, SKIPLIST_SNAPSHOT_MAGIC, sizeof(SKIPLIST_SNAPSHOT_MAGIC)) == 0) {
+    SnapshotRecords records(data + sizeof(SKIPLIST_SNAPSHOT_MAGIC), len - sizeof(SKIPLIST_SNAPSHOT_MAGIC));
+    ok = writeTables(records, false, &tables) && records.ok();
+  } else {
+    SkipList<std::string, std::string> legacy;
+    if (legacy.load_from(data, len)) {
+      ListRecords records(legacy);
+      ok = writeTables(records, false, &tables);
+    }
+  }
+  if (!ok) {
+    for (auto &table : tables) {
+      table->MarkObsolete();
+    }
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lg(m_mtx);
+  for (const auto &level : m_current->levels) {
+    for (const auto &table : level) {
+      table->MarkObsolete();
+    }
+  }
+  auto version = std::make_shared<LsmVersion>();
+  version->mem = std::make_shared<MemTable>();
+  version->levels[LSM_MAX_LEVELS - 1] = std::move(tables);
+  m_current = version;
+  ++m_generation;
+  for (auto &cursor : m_compactCursor) {
+    cursor.clear();
+  }
+  m_cv.notify_all();
+  return true;
+}
+
+void LsmEngine::Display() {
+  auto it = MergingIterator::Over(current(), true, false);
+  std::cout << "\n*****LSM*****" << std::endl;
+  for (it->seekToFirst(); it->valid(); it->next()) {
+    std::cout << it->rawKey() << ":" << it->value() << ";";
+  }
+  std::cout << std::endl;
+}
+
+template <typename It>
+bool LsmEngine::writeTables(It &it, bool dropDeletions, std::vector<std::shared_ptr<SSTable> > *outputs) {
+  std::unique_ptr<SSTableBuilder> builder;
+  uint64_t number = 0;
+  bool ok = true;
+  auto finishTable = [&]() {
+    std::shared_ptr<SSTable> table;
+    ok = builder->Finish() && (table = SSTable::Open(tablePath(number), number)) != nullptr;
+    if (table) {
+      outputs->push_back(std::move(table));
+    }
+    builder.reset();
+  };
+  for (; ok && it.valid(); it.next()) {
+    if (dropDeletions && it.record()[0] == LSM_TYPE_DELETION) {
+      continue;
+    }
+    if (!builder) {
+      number = m_nextFileNumber.fetch_add(1);
+      builder.reset(new SSTableBuilder(tablePath(number)));
+    }
+    builder->Add(it.key(), it.record());
+    if (builder->EstimatedSize() >= static_cast<uint64_t>(LSM_TABLE_BYTES)) {
+      finishTable();
+    }
+  }
+  if (ok && builder) {
+    finishTable();
+  }
+  if (!ok) {
+    if (builder) {
+      builder->Abandon();
+    }
+    for (auto &table : *outputs) {
+      table->MarkObsolete();
+    }
+    outputs->clear();
+  }
+  return ok;
+}
+
+bool LsmEngine::pickCompaction(const LsmVersion &version, Compaction *c) {
+  std::string smallest, largest;
+  if (static_cast<int>(version.levels[0].size()) >= LSM_L0_COMPACTION_TRIGGER) {
+    c->level = 0;
+    c->inputs[0] = version.levels[0];
+  } else {
+    for (int level = 1; level + 1 < LSM_MAX_LEVELS && c->level < 0; ++level) {
+      uint64_t bytes = 0;
+      for (const auto &table : version.levels[level]) {
+        bytes += table->FileSize();
+      }
+      if (bytes <= levelLimit(level)) {
+        continue;
+      }
+      // 从上次停下的位置往后挑一个，整层轮流合并下去
+      const auto &tables = version.levels[level];
+      auto it = std::find_if(tables.begin(), tables.end(), [&](const std::shared_ptr<SSTable> &table) {
+        return m_compactCursor[level] < table->Smallest();
+      });
+      const auto &picked = it == tables.end() ? tables.front() : *it;
+      m_compactCursor[level] = picked->Largest();
+      c->level = level;
+      c->inputs[0] = {picked};
+    }
+    if (c->level < 0) {
+      return false;
+    }
+  }
+  smallest = c->inputs[0].front()->Smallest();
+  largest = c->inputs[0].front()->Largest();
+  for (const auto &table : c->inputs[0]) {
+    smallest = std::min(smallest, table->Smallest());
+    largest = std::max(largest, table->Largest());
+  }
+  for (const auto &table : version.levels[c->level + 1]) {
+    if (table->Overlaps(smallest, largest)) {
+      c->inputs[1].push_back(table);
+    }
+  }
+  return true;
+}
+
+void LsmEngine::backgroundLoop() {
+  std::unique_lock<std::mutex> lk(m_mtx);
+  while (!m_stop) {
+    std::shared_ptr<const LsmVersion> version = m_current;
+    uint64_t generation = m_generation;
+    std::vector<std::shared_ptr<SSTable> > outputs;
+
+    if (!version->imm.empty()) {
+      // 最老的冻结memtable写成L0的文件，删除记录要留着盖住更下层的旧值
+      std::shared_ptr<MemTable> mem = version->imm.back();
+      lk.unlock();
+      std::vector<std::unique_ptr<LsmSource> > sources;
+      sources.emplace_back(new MemSource(MergingIterator::listOf(mem)));
+      MergingIterator it(version, std::move(sources), true);
+      it.seekToFirst();
+      bool ok = writeTables(it, false, &outputs);
+      lk.lock();
+      if (!ok || generation != m_generation) {
+        for (auto &table : outputs) {
+          table->MarkObsolete();
+        }
+        if (!ok) {
+          // 磁盘出错时不要空转，写入会在LSM_MAX_IMMUTABLE_MEMTABLES处等着
+          m_cv.wait_for(lk, std::chrono::seconds(1));
+        }
+        continue;
+      }
+      auto next = std::make_shared<LsmVersion>(*m_current);
+      next->imm.erase(std::find(next->imm.begin(), next->imm.end(), mem));
+      next->levels[0].insert(next->levels[0].begin(), outputs.begin(), outputs.end());
+      m_current = next;
+      m_cv.notify_all();
+      continue;
+    }
+
+    Compaction c;
+    if (!pickCompaction(*version, &c)) {
+      m_cv.wait(lk);
+      continue;
+    }
+    int output = c.level + 1;
+    // 更下层没有和这次的范围重叠的文件时，删除记录已经没有要盖住的东西了
+    bool dropDeletions = true;
+    for (int level = output + 1; level < LSM_MAX_LEVELS && dropDeletions; ++level) {
+      for (const auto &table : version->levels[level]) {
+        for (const auto &input : c.inputs[0]) {
+          dropDeletions = dropDeletions && !table->Overlaps(input->Smallest(), input->Largest());
+        }
+        for (const auto &input : c.inputs[1]) {
+          dropDeletions = dropDeletions && !table->Overlaps(input->Smallest(), input->Largest());
+        }
+      }
+    }
+    lk.unlock();
+    std::vector<std::unique_ptr<LsmSource> > sources;
+    if (c.level == 0) {
+      for (const auto &table : c.inputs[0]) {
+        sources.emplace_back(new TableSource(table));
+      }
+    } else {
+      sources.emplace_back(new LevelSource(c.inputs[0]));
+    }
+    if (!c.inputs[1].empty()) {
+      sources.emplace_back(new LevelSource(c.inputs[1]));
+    }
+    MergingIterator it(version, std::move(sources), true);
+    it.seekToFirst();
+    bool ok = writeTables(it, dropDeletions, &outputs);
+    lk.lock();
+    if (!ok || generation != m_generation) {
+      for (auto &table : outputs) {
+        table->MarkObsolete();
+      }
+      if (!ok) {
+        m_cv.wait_for(lk, std::chrono::seconds(1));
+      }
+      continue;
+    }
+    auto next = std::make_shared<LsmVersion>(*m_current);
+    for (int i = 0; i < 2; ++i) {
+      auto &tables = next->levels[c.level + i];
+      for (const auto &input : c.inputs[i]) {
+        tables.erase(std::find(tables.begin(), tables.end(), input));
+        input->MarkObsolete();
+      }
+    }
+    auto &tables = next->levels[output];
+    tables.insert(tables.end(), outputs.begin(), outputs.end());
+    std::sort(tables.begin(), tables.end(), [](const std::shared_ptr<SSTable> &a, const std::shared_ptr<SSTable> &b) {
+      return a->Smallest() < b->Smallest();
+    });
+    m_current = next;
+    m_cv.notify_all();
+  }
+}
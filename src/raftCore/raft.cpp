@@ -1,10 +1,35 @@
 #include "raft.h"
-#include <boost/archive/text_iarchive.hpp>
-#include <boost/archive/text_oarchive.hpp>
+#include <google/protobuf/arena.h>
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include "config.h"
+#include "metrics.h"
 #include "util.h"
 
+namespace {
+
+// 同一进程里的raft组共用这些指标；分组的状态在init里按组注册成gauge
+struct RaftMetrics {
+  MetricCounter *proposals = Metrics::Instance().Counter("raft_proposals_total", "Start收到的提议数");
+  MetricCounter *committed = Metrics::Instance().Counter("raft_committed_entries_total", "leader上提交的日志条数");
+  MetricCounter *applied = Metrics::Instance().Counter("raft_applied_entries_total", "交给上层的日志条数");
+  MetricCounter *elections = Metrics::Instance().Counter("raft_elections_total", "发起的正式选举次数");
+  MetricCounter *leaderChanges = Metrics::Instance().Counter("raft_became_leader_total", "成为leader的次数");
+  LatencyHistogram *proposeQueue =
+      Metrics::Instance().Histogram("raft_propose_queue_us", "进入Start到被combiner写进日志的时间");
+  LatencyHistogram *persist = Metrics::Instance().Histogram("raft_persist_us", "leader一批新日志的落盘时间");
+  LatencyHistogram *commit = Metrics::Instance().Histogram("raft_commit_us", "leader上日志写入到提交的时间");
+  LatencyHistogram *applyLag = Metrics::Instance().Histogram("raft_apply_lag_us", "提交到交给applyChan的时间");
+};
+
+RaftMetrics &raftMetrics() {
+  static RaftMetrics metrics;
+  return metrics;
+}
+
+}  // namespace
+
 void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpcProctoc::AppendEntriesReply* reply) {
   std::lock_guard<std::mutex> locker(m_mtx);
   reply->set_appstate(AppNormal);  // 能接收到代表网络是正常的
@@ -15,7 +40,7 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     reply->set_success(false);
     reply->set_term(m_currentTerm);
     reply->set_updatenextindex(-100);  // 让领导人可以及时更新自己
-    DPrintf("[func-AppendEntries-rf{%d}] 拒绝了 因为Leader{%d}的term{%v}< rf{%d}.term{%d}\n", m_me, args->leaderid(),
+    DPrintf("[func-AppendEntries-rf{%d}] 拒绝了 因为Leader{%d}的term{%d}< rf{%d}.term{%d}\n", m_me, args->leaderid(),
             args->term(), m_me, m_currentTerm);
     return;  // 从过期的领导人收到消息不重设定时器
   }
@@ -33,6 +58,9 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
  
   m_status = Follower;  // candidate收到同一个term的leader的AE，需要变成follower
   m_lastResetElectionTime = now();
+  m_lastLeaderContactTime = m_lastResetElectionTime;
+  m_leaderId = args->leaderid();
+  m_leaderTerm = m_currentTerm;
  
   // 不能无脑的从prevlogIndex开始阶段日志，因为rpc可能会延迟，导致发过来的log是很久之前的
 
@@ -41,6 +69,7 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     reply->set_success(false);
     reply->set_term(m_currentTerm);
     reply->set_updatenextindex(getLastLogIndex() + 1);
+    reply->set_conflictterm(0);
     //  DPrintf("[func-AppendEntries-rf{%v}] 拒绝了节点{%v}，因为日志太新,args.PrevLogIndex{%v} >
  
     return;
@@ -50,7 +79,7 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     reply->set_term(m_currentTerm);
     reply->set_updatenextindex(m_lastSnapshotIncludeIndex +1);  
     //  DPrintf("[func-AppendEntries-rf{%v}] 拒绝了节点{%v}，因为log太老，返回值：{%v}\n", rf.me, args.LeaderId, reply)
-    
+    return;
   }
   //冲突(same index,different term),截断日志
   // 注意：这里目前当args.PrevLogIndex == rf.lastSnapshotIncludeIndex与不等的时候要分开考虑
@@ -60,11 +89,13 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     // 那意思是不是可能会有一段发来的AE中的logs中前半是匹配的，后半是不匹配的，这种应该：1.follower如何处理？ 2.如何给leader回复
     // 3. leader如何处理
 
+    bool configChanged = false;
     for (int i = 0; i < args->entries_size(); i++) {
-      auto log = args->entries(i);
+      const auto& log = args->entries(i);
       if (log.logindex() > getLastLogIndex()) {
         //超过就直接添加日志
         m_logs.push_back(log);
+        configChanged |= log.has_config();
       } else {
         //没超过就比较是否匹配，不匹配再更新，而不是直接截断
         
@@ -79,10 +110,22 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
                                  log.command()));
         }
         if (m_logs[getSlicesIndexFromLogIndex(log.logindex())].logterm() != log.logterm()) {
-          //不匹配就更新
-          m_logs[getSlicesIndexFromLogIndex(log.logindex())] = log;
+          //不匹配就截断，冲突位置之后的日志一定也是过期的
+          truncateLogSuffix(log.logindex());
+          m_logs.push_back(log);
+          configChanged |= log.has_config();
+        }
+      }
+    }
+    if (configChanged) {
+      // 配置日志收到就生效，后面的AE也可能把它截掉，那时退回之前的配置
+      for (int i = 0; i < args->entries_size(); i++) {
+        const auto& log = args->entries(i);
+        if (log.has_config() && (m_configLog.empty() || m_configLog.back().first < log.logindex())) {
+          m_configLog.emplace_back(log.logindex(), log.config());
         }
       }
+      applyMembership();
     }
 
     // 错误写法like：  rf.shrinkLogsToIndex(args.PrevLogIndex)
@@ -97,8 +140,9 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     // rf.currentTerm, len(rf.logs))
     // }
     if (args->leadercommit() > m_commitIndex) {
-      m_commitIndex = std::min(args->leadercommit(), getLastLogIndex());
-      // 这个地方不能无脑跟上getLastLogIndex()，因为可能存在args->leadercommit()落后于 getLastLogIndex()的情况
+      m_commitIndex = std::min(args->leadercommit(), args->prevlogindex() + args->entries_size());
+      // 这个地方不能无脑跟上getLastLogIndex()，AE只带了一批日志，这一批之后的本地日志还没有和leader确认过
+      m_applierCv.notifyOne();
     }
 
     // 领导会一次发送完所有的日志
@@ -115,17 +159,14 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
     return;
   } else {
     // 优化
-    // PrevLogIndex 长度合适，但是不匹配，因此往前寻找 矛盾的term的第一个元素
+    // PrevLogIndex 长度合适，但是不匹配，回复冲突的term和follower上这个term的第一条日志
     // 为什么该term的日志都是矛盾的呢？也不一定都是矛盾的，只是这么优化减少rpc而已
     // ？什么时候term会矛盾呢？很多情况，比如leader接收了日志之后马上就崩溃等等
-    reply->set_updatenextindex(args->prevlogindex());
-
-    for (int index = args->prevlogindex(); index >= m_lastSnapshotIncludeIndex; --index) {
-      if (getLogTermFromLogIndex(index) != getLogTermFromLogIndex(args->prevlogindex())) {
-        reply->set_updatenextindex(index + 1);
-        break;
-      }
-    }
+    // leader自己也有这个term的话从它自己这个term的最后一条之后开始发，没有的话整个term都跳过
+    int conflictTerm = getLogTermFromLogIndex(args->prevlogindex());
+    reply->set_conflictterm(conflictTerm);
+    reply->set_updatenextindex(
+        std::min(firstLogIndexWithTermAtLeast(conflictTerm, args->prevlogindex()), args->prevlogindex()));
     reply->set_success(false);
     reply->set_term(m_currentTerm);
     
@@ -136,26 +177,25 @@ void Raft::AppendEntries1(const raftRpcProctoc::AppendEntriesArgs* args, raftRpc
 }
 
 
-//日志应用定时器
-//功能：定期检查已提交但未应用的日志，将其封装为ApplyMsg并推送到applyChan，供上层应用处理
+//日志应用线程
+//功能：commitIndex前进时立即被唤醒，把已提交但未应用的日志整批推送到applyChan，供上层应用处理
 void Raft::applierTicker() {
+  std::unique_lock<std::mutex> lk(m_mtx);
   while (true) {
-    m_mtx.lock();
+    m_applierCv.wait(lk, [this]() { return m_lastApplied < m_commitIndex; });
+    if (applyChan->full()) {
+      // kvserver处理不过来，不能持锁等它（它安装快照时要拿m_mtx），日志留在log里，稍后再推
+      m_applierCv.waitFor(lk, 1);
+      continue;
+    }
     if (m_status == Leader) {
       DPrintf("[Raft::applierTicker() - raft{%d}]  m_lastApplied{%d}   m_commitIndex{%d}", m_me, m_lastApplied,
               m_commitIndex);
     }
     auto applyMsgs = getApplyLogs();
-    m_mtx.unlock();
-    
-    if (!applyMsgs.empty()) {
-      DPrintf("[func- Raft::applierTicker()-raft{%d}] 向kvserver报告的applyMsgs长度为:{%d}", m_me, applyMsgs.size());
-    }
-    for (auto& message : applyMsgs) {
-      applyChan->Push(message);
-    }
-    
-    sleepNMilliseconds(ApplyInterval);
+    DPrintf("[func- Raft::applierTicker()-raft{%d}] 向kvserver报告的applyMsgs长度为:{%zu}", m_me, applyMsgs.size());
+    // 持锁推送，和InstallSnapshot推送的快照保持先后顺序；生产者都持有m_mtx，上面检查过有空位，不会失败
+    applyChan->tryPush(std::move(applyMsgs));
   }
 }
 
@@ -185,7 +225,7 @@ bool Raft::CondInstallSnapshot(int lastIncludedTerm, int lastIncludedIndex, std:
   // return true
 }
 
-void Raft::doElection() {
+void Raft::doElection(bool transfer) {
   std::lock_guard<std::mutex> g(m_mtx);
 
   if (m_status == Leader) {
@@ -200,147 +240,268 @@ void Raft::doElection() {
     m_status = Candidate;
     ///开始新一轮的选举
     m_currentTerm += 1;
+    raftMetrics().elections->add();
     m_votedFor = m_me;  //即是自己给自己投，也避免candidate给同辈的candidate投
     persist();
     std::shared_ptr<int> votedNum = std::make_shared<int>(1);  // 使用 make_shared 函数初始化 
     //	重新设置定时器
     m_lastResetElectionTime = now();
-    //	发布RequestVote RPC
+    if (*votedNum >= quorum()) {
+      // 只剩自己一个投票成员
+      *votedNum = 0;
+      becomeLeader();
+      return;
+    }
+    //	发布RequestVote RPC，只有投票成员的票才算数
     for (int i = 0; i < m_peers.size(); i++) {
-      if (i == m_me) {
+      if (i == m_me || m_roles[i] != Voter || !m_peers[i]) {
         continue;
       }
       int lastLogIndex = -1, lastLogTerm = -1;
       getLastLogIndexAndTerm(&lastLogIndex, &lastLogTerm);  //获取最后一个log的term和下标
 
-      std::shared_ptr<raftRpcProctoc::RequestVoteArgs> requestVoteArgs =std::make_shared<raftRpcProctoc::RequestVoteArgs>();
+      // 请求和回复分配在同一个arena上，两个shared_ptr共同持有arena，都释放之后arena才析构
+      auto arena = std::make_shared<google::protobuf::Arena>();
+      std::shared_ptr<raftRpcProctoc::RequestVoteArgs> requestVoteArgs(
+          arena, google::protobuf::Arena::CreateMessage<raftRpcProctoc::RequestVoteArgs>(arena.get()));
       requestVoteArgs->set_term(m_currentTerm);
       requestVoteArgs->set_candidateid(m_me);
+      requestVoteArgs->set_groupid(m_groupId);
       requestVoteArgs->set_lastlogindex(lastLogIndex);
       requestVoteArgs->set_lastlogterm(lastLogTerm);
-      auto requestVoteReply = std::make_shared<raftRpcProctoc::RequestVoteReply>();
-
-      //使用匿名函数执行避免其拿到锁
-
-      std::thread t(&Raft::sendRequestVote, this, i, requestVoteArgs, requestVoteReply,
-                    votedNum);  // 创建新线程并执行b函数，并传递参数
-      t.detach();
+      requestVoteArgs->set_leadertransfer(transfer);
+      std::shared_ptr<raftRpcProctoc::RequestVoteReply> requestVoteReply(
+          arena, google::protobuf::Arena::CreateMessage<raftRpcProctoc::RequestVoteReply>(arena.get()));
+
+      //使用匿名函数执行避免其拿到锁，rpc在协程里等待回复时会让出线程
+      m_ioManager->scheduler([this, i, requestVoteArgs, requestVoteReply, votedNum]() {
+        sendRequestVote(i, requestVoteArgs, requestVoteReply, votedNum);
+      });
     }
   }
 }
 
-void Raft::doHeartBeat() {
+void Raft::doPreVote() {
   std::lock_guard<std::mutex> g(m_mtx);
-
   if (m_status == Leader) {
-    DPrintf("[func-Raft::doHeartBeat()-Leader: {%d}] Leader的心跳定时器触发了且拿到mutex,开始发送AE\n", m_me);
-    auto appendNums = std::make_shared<int>(1);  //正确返回的节点的数量
-
-    //对Follower（除了自己外的所有节点发送AE）
-    // todo 这里肯定是要修改的，最好使用一个单独的goruntime来负责管理发送log，因为后面的log发送涉及优化之类的
-    //最少要单独写一个函数来管理，而不是在这一坨
-    for (int i = 0; i < m_peers.size(); i++) {
-      if (i == m_me) {
-        continue;
-      }
-      DPrintf("[func-Raft::doHeartBeat()-Leader: {%d}] Leader的心跳定时器触发了 index:{%d}\n", m_me, i);
-      myAssert(m_nextIndex[i] >= 1, format("rf.nextIndex[%d] = {%d}", i, m_nextIndex[i]));
-      //如果落后太多要判断是发送快照还是发送AE
-      if (m_nextIndex[i] <= m_lastSnapshotIncludeIndex) {
-        std::thread t(&Raft::leaderSendSnapShot, this, i);  // 创建新线程并执行b函数，并传递参数
-        t.detach();
-        continue;
-      }
-      //构造发送值
-      int preLogIndex = -1;
-      int PrevLogTerm = -1;
-      getPrevLogInfo(i, &preLogIndex, &PrevLogTerm);
-      std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> appendEntriesArgs =
-          std::make_shared<raftRpcProctoc::AppendEntriesArgs>();
-      appendEntriesArgs->set_term(m_currentTerm);
-      appendEntriesArgs->set_leaderid(m_me);
-      appendEntriesArgs->set_prevlogindex(preLogIndex);
-      appendEntriesArgs->set_prevlogterm(PrevLogTerm);
-      appendEntriesArgs->clear_entries();
-      appendEntriesArgs->set_leadercommit(m_commitIndex);
-      if (preLogIndex != m_lastSnapshotIncludeIndex) //m_lastSnapshotIncludeIndex - 快照中的最后一个日志的Index
-      {
-        for (int j = getSlicesIndexFromLogIndex(preLogIndex) + 1; j < m_logs.size(); ++j) {
-          raftRpcProctoc::LogEntry* sendEntryPtr = appendEntriesArgs->add_entries();
-          *sendEntryPtr = m_logs[j];  
-        }
-      } else {
-        for (const auto& item : m_logs) {
-          raftRpcProctoc::LogEntry* sendEntryPtr = appendEntriesArgs->add_entries();
-          *sendEntryPtr = item;  
-        }
-      }
-      int lastLogIndex = getLastLogIndex();
-      // leader对每个节点发送的日志长短不一，但是都保证从prevIndex发送直到最后
-      myAssert(appendEntriesArgs->prevlogindex() + appendEntriesArgs->entries_size() == lastLogIndex,
-               format("appendEntriesArgs.PrevLogIndex{%d}+len(appendEntriesArgs.Entries){%d} != lastLogIndex{%d}",
-                      appendEntriesArgs->prevlogindex(), appendEntriesArgs->entries_size(), lastLogIndex));
-      //构造返回值
-      const std::shared_ptr<raftRpcProctoc::AppendEntriesReply> appendEntriesReply =
-          std::make_shared<raftRpcProctoc::AppendEntriesReply>();
-      appendEntriesReply->set_appstate(Disconnected);
-
-      std::thread t(&Raft::sendAppendEntries, this, i, appendEntriesArgs, appendEntriesReply,
-                    appendNums);  // 创建新线程并执行b函数，并传递参数
-      t.detach();
+    return;
+  }
+  DPrintf("[       ticker-func-rf(%d)              ]  选举定时器到期，开始预投票 term:{%d}\n", m_me, m_currentTerm + 1);
+  int round = ++m_preVoteRound;
+  // 预投票没有通过也要等一个超时再试
+  m_lastResetElectionTime = now();
+  auto granted = std::make_shared<int>(1);
+  if (*granted >= quorum()) {
+    m_ioManager->scheduler([this]() { doElection(); });
+    return;
+  }
+  int lastLogIndex = -1, lastLogTerm = -1;
+  getLastLogIndexAndTerm(&lastLogIndex, &lastLogTerm);
+  for (int i = 0; i < m_peers.size(); i++) {
+    if (i == m_me || m_roles[i] != Voter || !m_peers[i]) {
+      continue;
     }
-    m_lastResetHearBeatTime = now();  // leader发送心跳，就不是随机时间了
+    auto arena = std::make_shared<google::protobuf::Arena>();
+    std::shared_ptr<raftRpcProctoc::RequestVoteArgs> args(
+        arena, google::protobuf::Arena::CreateMessage<raftRpcProctoc::RequestVoteArgs>(arena.get()));
+    args->set_term(m_currentTerm + 1);
+    args->set_candidateid(m_me);
+    args->set_groupid(m_groupId);
+    args->set_lastlogindex(lastLogIndex);
+    args->set_lastlogterm(lastLogTerm);
+    args->set_prevote(true);
+    std::shared_ptr<raftRpcProctoc::RequestVoteReply> reply(
+        arena, google::protobuf::Arena::CreateMessage<raftRpcProctoc::RequestVoteReply>(arena.get()));
+    m_ioManager->scheduler([this, i, args, reply, granted, round]() { sendPreVote(i, args, reply, granted, round); });
   }
 }
 
-void Raft::electionTimeOutTicker() //负责监控节点是否长时间未收到 Leader 的心跳（或有效的 RPC），并在超时后触发新的选举（doElection()
-{
-  
-  while (true) {
-    /**
-     * 如果不睡眠，那么对于leader，这个函数会一直空转，浪费cpu。且加入协程之后，空转会导致其他协程无法运行，对于时间敏感的AE，会导致心跳无法正常发送导致异常
-     */
-    while (m_status == Leader) {
-      usleep(HeartBeatTimeout);  //定时时间没有严谨设置，因为HeartBeatTimeout比选举超时一般小一个数量级，因此就设置为HeartBeatTimeout了
-    }
-    std::chrono::duration<signed long int, std::ratio<1, 1000000000>> suitableSleepTime{};
-    std::chrono::system_clock::time_point wakeTime{};
-    {
-      m_mtx.lock();
-      wakeTime = now();
-      suitableSleepTime = getRandomizedElectionTimeout() + m_lastResetElectionTime - wakeTime;
-      //即从当前时刻开始，睡多久后若仍无重置事件，就触发选举
-      m_mtx.unlock();
-    }
+void Raft::doHeartBeat() {
+  if (m_status != Leader) {
+    return;
+  }
+  DPrintf("[func-Raft::doHeartBeat()-Leader: {%d}] 唤醒replicator立即发送心跳\n", m_me);
+  for (int i = 0; i < m_peers.size(); i++) {
+    m_lastSendTime[i] = std::chrono::system_clock::time_point{};
+  }
+  notifyReplicators();
+}
 
-    // 若需要休眠的时间大于1ms，则执行休眠
-    if (std::chrono::duration<double, std::milli>(suitableSleepTime).count() > 1) {
-      // 获取当前时间点
-      auto start = std::chrono::steady_clock::now();
+void Raft::buildAppendEntriesArgs(int server, raftRpcProctoc::AppendEntriesArgs* args) {
+  myAssert(m_nextIndex[server] >= 1, format("rf.nextIndex[%d] = {%d}", server, m_nextIndex[server]));
+  int preLogIndex = -1;
+  int PrevLogTerm = -1;
+  getPrevLogInfo(server, &preLogIndex, &PrevLogTerm);
+  args->set_term(m_currentTerm);
+  args->set_leaderid(m_me);
+  args->set_groupid(m_groupId);
+  args->set_prevlogindex(preLogIndex);
+  args->set_prevlogterm(PrevLogTerm);
+  args->clear_entries();
+  args->set_leadercommit(m_commitIndex);
+  // 一次最多RAFT_MAX_APPEND_ENTRIES条、约RAFT_MAX_APPEND_BYTES字节，剩下的由后续AE接着发
+  // 至少带一条，否则单条超过字节上限的日志永远发不出去
+  int lastLogIndex = getLastLogIndex();
+  long long bytes = 0;
+  for (int index = preLogIndex + 1; index <= lastLogIndex && args->entries_size() < RAFT_MAX_APPEND_ENTRIES; ++index) {
+    const auto& entry = m_logs[getSlicesIndexFromLogIndex(index)];
+    bytes += entry.ByteSizeLong();
+    if (args->entries_size() > 0 && bytes > RAFT_MAX_APPEND_BYTES) {
+      break;
+    }
+    *args->add_entries() = entry;
+  }
+  myAssert(args->prevlogindex() + args->entries_size() <= lastLogIndex,
+           format("appendEntriesArgs.PrevLogIndex{%d}+len(appendEntriesArgs.Entries){%d} > lastLogIndex{%d}",
+                  args->prevlogindex(), args->entries_size(), lastLogIndex));
+}
 
-      usleep(std::chrono::duration_cast<std::chrono::microseconds>(suitableSleepTime).count());
-      
+void Raft::waitReplicateSignal(std::unique_lock<std::mutex>& lk, int64_t timeoutMs) {
+  auto waiter = std::make_shared<ReplicatorWaiter>();
+  waiter->fiber = monsoon::Fiber::GetThis();
+  waiter->thread = monsoon::GetThreadId();
+  m_replicatorWaiters.push_back(waiter);
+  if (timeoutMs >= 0) {
+    waiter->timer = m_ioManager->addTimer(timeoutMs, [this, waiter]() {
+      std::lock_guard<std::mutex> lg(m_mtx);
+      wakeReplicator(waiter);
+    });
+  }
+  lk.unlock();
+  // 唤醒时只会调度回原来的线程，这个线程让出之后协程才可能被再次执行
+  monsoon::Fiber::GetThis()->yield();
+  lk.lock();
+}
 
-      // 获取函数运行结束后的时间点
-      auto end = std::chrono::steady_clock::now();
+void Raft::wakeReplicator(const std::shared_ptr<ReplicatorWaiter>& waiter) {
+  if (waiter->woken) {
+    return;  // 信号和超时只有先到的那个生效
+  }
+  waiter->woken = true;
+  if (waiter->timer) {
+    // 超时触发时回调已经取出来了，cancel什么都不做
+    waiter->timer->cancel();
+    waiter->timer.reset();
+  }
+  m_ioManager->scheduler(waiter->fiber, waiter->thread);
+}
 
-      // 计算时间差并输出结果（单位为毫秒）
-      std::chrono::duration<double, std::milli> duration = end - start;
+void Raft::notifyReplicators() {
+  for (auto& waiter : m_replicatorWaiters) {
+    wakeReplicator(waiter);
+  }
+  m_replicatorWaiters.clear();
+}
 
-      // 使用ANSI控制序列将输出颜色修改为紫色
-      std::cout << "\033[1;35m electionTimeOutTicker();函数设置睡眠时间为: "
-                << std::chrono::duration_cast<std::chrono::milliseconds>(suitableSleepTime).count() << " 毫秒\033[0m"
-                << std::endl;
-      std::cout << "\033[1;35m electionTimeOutTicker();函数实际睡眠时间为: " << duration.count() << " 毫秒\033[0m"
-                << std::endl;
+void Raft::replicator(int server) {
+  // 同一个replicator同时只有一轮AE，每轮复用这块内存作为arena的第一块
+  std::vector<char> arenaBlock(RPC_ARENA_BLOCK_SIZE);
+  std::unique_lock<std::mutex> lk(m_mtx);
+  while (true) {
+    if (m_roles[server] == NonMember) {
+      // 已经被移除了，再加入时重新启动
+      m_replicatorCount[server]--;
+      return;
+    }
+    if (m_status != Leader) {
+      waitReplicateSignal(lk, -1);
+      continue;
+    }
+    // 探测阶段nextIndex可能不对，只允许一个在途，确认之后才流水线发送
+    int window = m_replicating[server] ? RAFT_MAX_INFLIGHT_APPENDS : 1;
+    if (m_inflight[server] >= window) {
+      waitReplicateSignal(lk, -1);
+      continue;
+    }
+    auto heartbeatDue = m_lastSendTime[server] + std::chrono::milliseconds(HeartBeatTimeout);
+    bool hasNewLog = m_nextIndex[server] <= getLastLogIndex();
+    if (!hasNewLog && now() < heartbeatDue) {
+      // 空闲时才退化为定时心跳
+      auto waitMs = std::chrono::duration_cast<std::chrono::milliseconds>(heartbeatDue - now()).count() + 1;
+      waitReplicateSignal(lk, waitMs);
+      continue;
     }
 
-    if (std::chrono::duration<double, std::milli>(m_lastResetElectionTime - wakeTime).count() > 0) {
-      //说明睡眠的这段时间有重置定时器，那么就没有超时，再次睡眠
+    //如果落后太多要判断是发送快照还是发送AE
+    if (m_nextIndex[server] <= m_lastSnapshotIncludeIndex) {
+      if (m_inflight[server] > 0) {
+        waitReplicateSignal(lk, -1);
+        continue;
+      }
+      m_inflight[server]++;
+      m_lastSendTime[server] = now();
+      lk.unlock();
+      leaderSendSnapShot(server);
+      lk.lock();
+      m_inflight[server]--;
+      notifyReplicators();
       continue;
     }
-    doElection();
+
+    // 这一轮AE的请求和回复都分配在arena上，arena先用arenaBlock，放不下才去堆上申请，一轮结束整体释放
+    google::protobuf::ArenaOptions arenaOptions;
+    arenaOptions.initial_block = arenaBlock.data();
+    arenaOptions.initial_block_size = arenaBlock.size();
+    google::protobuf::Arena arena(arenaOptions);
+    auto appendEntriesArgs = google::protobuf::Arena::CreateMessage<raftRpcProctoc::AppendEntriesArgs>(&arena);
+    buildAppendEntriesArgs(server, appendEntriesArgs);
+    // 乐观地推进nextIndex，下一个AE不等这次的回复就从这一批之后接着发
+    m_nextIndex[server] = appendEntriesArgs->prevlogindex() + appendEntriesArgs->entries_size() + 1;
+    int epoch = m_pipelineEpoch[server];
+    m_inflight[server]++;
+    auto sendTime = now();
+    m_lastSendTime[server] = sendTime;
+    lk.unlock();
+
+    auto appendEntriesReply = google::protobuf::Arena::CreateMessage<raftRpcProctoc::AppendEntriesReply>(&arena);
+    appendEntriesReply->set_appstate(Disconnected);
+    sendAppendEntries(server, appendEntriesArgs, appendEntriesReply, epoch, sendTime);
+
+    lk.lock();
+    m_inflight[server]--;
+    notifyReplicators();
+  }
+}
+
+// 选举定时器到期：这段时间里有重置（收到心跳、投出选票）就按新的重置时间重新定时，否则发起选举
+// 心跳到达时只更新m_lastResetElectionTime，不去动定时器，一个选举超时里最多到期一次
+void Raft::electionTimeOutTicker() {
+  bool elect = false;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    auto current = now();
+    // learner和还没被加进来的节点不发起选举
+    elect = m_status != Leader && m_roles[m_me] == Voter && m_lastResetElectionTime + m_electionTimeout <= current;
+    // CheckQuorum：leader每个超时检查一次，这段时间里收不到多数派的回复就下台，不再接受写入和读请求
+    if (RAFT_CHECK_QUORUM && m_status == Leader && current - m_leaderSince >= m_electionTimeout &&
+        !quorumAckedSince(current - m_electionTimeout)) {
+      DPrintf("[func-electionTimeOutTicker-rf{%d}] term{%d} 一个选举超时内没有收到多数派的回复，下台", m_me,
+              m_currentTerm);
+      m_status = Follower;
+      m_leaderId = -1;
+      m_lastResetElectionTime = current;
+      m_readCv.notifyAll();
+    }
+  }
+  if (elect) {
+    if (RAFT_PRE_VOTE) {
+      doPreVote();
+    } else {
+      doElection();
+    }
   }
+  armElectionTimer();
+}
+
+void Raft::armElectionTimer() {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  // 每次定时重新随机超时时间；leader不会选举，隔一个超时时间再检查是不是已经下台了
+  m_electionTimeout = getRandomizedElectionTimeout();
+  auto delay = m_electionTimeout;
+  if (m_status != Leader) {
+    delay = std::chrono::duration_cast<std::chrono::milliseconds>(m_lastResetElectionTime + m_electionTimeout - now());
+  }
+  m_ioManager->addTimer(std::max<int64_t>(delay.count(), 1), [this]() { electionTimeOutTicker(); });
 }
 
 std::vector<ApplyMsg> Raft::getApplyLogs() {
@@ -348,6 +509,7 @@ std::vector<ApplyMsg> Raft::getApplyLogs() {
   myAssert(m_commitIndex <= getLastLogIndex(), format("[func-getApplyLogs-rf{%d}] commitIndex{%d} >getLastLogIndex{%d}",
                                                       m_me, m_commitIndex, getLastLogIndex()));
 
+  applyMsgs.reserve(m_commitIndex - m_lastApplied);
   while (m_lastApplied < m_commitIndex) {
     m_lastApplied++;
     myAssert(m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].logindex() == m_lastApplied,
@@ -356,11 +518,18 @@ std::vector<ApplyMsg> Raft::getApplyLogs() {
     ApplyMsg applyMsg;
     applyMsg.CommandValid = true;
     applyMsg.SnapshotValid = false;
+    // 配置日志的Command为空，上层只用它推进apply的位置
     applyMsg.Command = m_logs[getSlicesIndexFromLogIndex(m_lastApplied)].command();
     applyMsg.CommandIndex = m_lastApplied;
-    applyMsgs.emplace_back(applyMsg);
+    const ProposalTrace& trace = m_traces[m_lastApplied % m_traces.size()];
+    if (trace.index == m_lastApplied && trace.committedUs > 0) {
+      applyMsg.CommittedAtUs = trace.committedUs;
+      RecordSince(raftMetrics().applyLag, trace.committedUs);
+    }
+    applyMsgs.emplace_back(std::move(applyMsg));
     
   }
+  raftMetrics().applied->add(applyMsgs.size());
   return applyMsgs;
 }
 
@@ -397,6 +566,18 @@ void Raft::GetState(int* term, bool* isLeader) {
   *isLeader = (m_status == Leader);
 }
 
+void Raft::GetLeaderHint(int* leaderId, int* term) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  *term = m_currentTerm;
+  if (m_status == Leader) {
+    *leaderId = m_me;
+  } else if (m_status == Follower && m_leaderTerm == m_currentTerm) {
+    *leaderId = m_leaderId;
+  } else {
+    *leaderId = -1;
+  }
+}
+
 //Follower 日志落后于 Leader 过多（甚至落后于 Leader 已压缩的快照）时，通过接收并安装 Leader 的快照快照来快速同步状态
 void Raft::InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest* args,
                            raftRpcProctoc::InstallSnapshotResponse* reply) {
@@ -418,9 +599,31 @@ void Raft::InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest* args,
   }
   m_status = Follower;
   m_lastResetElectionTime = now();
+  m_lastLeaderContactTime = m_lastResetElectionTime;
+  m_leaderId = args->leaderid();
+  m_leaderTerm = m_currentTerm;
+  reply->set_term(m_currentTerm);
   // 若请求的快照最后索引 ≤ 本地已有的快照索引 → 快照过时，无需处理
   if (args->lastsnapshotincludeindex() <= m_lastSnapshotIncludeIndex) {
-    
+    reply->set_installed(true);
+    return;
+  }
+  if (args->done() && applyChan->full()) {
+    // 快照装好后要推给kvserver，它积压太多时先不收最后一块，leader稍后重发这一块
+    reply->set_nextoffset(args->offset());
+    return;
+  }
+  // 快照是分块发来的，每块直接写进接收文件，不在内存里攒整个快照
+  // offset对不上（重传、断线重连）时不写入，告诉leader从哪里接着发
+  long long received = m_persister->WriteSnapshotChunk(args->lastsnapshotincludeindex(),
+                                                       args->lastsnapshotincludeterm(), args->offset(), args->data());
+  reply->set_nextoffset(received);
+  if (!args->done() || received != args->offset() + static_cast<long long>(args->data().size())) {
+    return;
+  }
+  if (!m_persister->FinishSnapshotChunks(args->lastsnapshotincludeindex(), args->lastsnapshotincludeterm(),
+                                         args->crc())) {
+    reply->set_nextoffset(0);  // 校验失败，接收的内容已经丢弃，从头再传
     return;
   }
   //截断日志，修改commitIndex和lastApplied
@@ -429,141 +632,152 @@ void Raft::InstallSnapshot(const raftRpcProctoc::InstallSnapshotRequest* args,
   auto lastLogIndex = getLastLogIndex();
 
   if (lastLogIndex > args->lastsnapshotincludeindex()) {
-    m_logs.erase(m_logs.begin(), m_logs.begin() + getSlicesIndexFromLogIndex(args->lastsnapshotincludeindex()) + 1);
+    m_logs.dropPrefix(getSlicesIndexFromLogIndex(args->lastsnapshotincludeindex()) + 1);
   } else {
     m_logs.clear();
   }
   m_commitIndex = std::max(m_commitIndex, args->lastsnapshotincludeindex());
   m_lastApplied = std::max(m_lastApplied, args->lastsnapshotincludeindex());
+  // 快照点之前的配置日志跟着丢掉，快照里带着快照点的配置
+  raftRpcProctoc::Membership snapshotMembership = membershipAt(args->lastsnapshotincludeindex());
+  std::string membership;
+  std::string snapshot = m_persister->ReadSnapshot(&membership);
+  if (!membership.empty()) {
+    snapshotMembership.ParseFromString(membership);
+  }
+  while (!m_configLog.empty() && m_configLog.front().first <= args->lastsnapshotincludeindex()) {
+    m_configLog.erase(m_configLog.begin());
+  }
+  m_snapshotMembership = std::move(snapshotMembership);
   m_lastSnapshotIncludeIndex = args->lastsnapshotincludeindex();
   m_lastSnapshotIncludeTerm = args->lastsnapshotincludeterm();
+  applyMembership();
+  reply->set_installed(true);
 
-  reply->set_term(m_currentTerm);
+  // 快照已经落盘，上层从文件里读出来安装
   ApplyMsg msg;
   msg.SnapshotValid = true;
-  msg.Snapshot = args->data();
+  msg.Snapshot = std::move(snapshot);
   msg.SnapshotTerm = args->lastsnapshotincludeterm();
   msg.SnapshotIndex = args->lastsnapshotincludeindex();
 
-  std::thread t(&Raft::pushMsgToKvServer, this, msg);  // 创建新线程并执行b函数，并传递参数
-  t.detach();
-  //看下这里能不能再优化
-  //    DPrintf("[func-InstallSnapshot-rf{%v}] receive snapshot from {%v} ,LastSnapShotIncludeIndex ={%v} ", rf.me,
-  //    args.LeaderId, args.LastSnapShotIncludeIndex)
-  //持久化
-  m_persister->Save(persistData(), args->data());
+  pushMsgToKvServer(std::move(msg));
 }
 
-void Raft::pushMsgToKvServer(ApplyMsg msg) { applyChan->Push(msg); }
+void Raft::pushMsgToKvServer(ApplyMsg msg) {
+  ApplyMsgBatch batch;
+  batch.push_back(std::move(msg));
+  myAssert(applyChan->tryPush(std::move(batch)), "applyChan is full");
+}
+
+// 从磁盘分块读出快照发给follower，每块等到确认再发下一块；中途失败时记下follower确认过的offset，下次从那里继续
+void Raft::leaderSendSnapShot(int server) {
+  // 打开之后本地再生成新快照也不影响这次发送的内容
+  auto snapshot = m_persister->OpenSnapshot();
+  if (!snapshot) {
+    return;
+  }
+  m_mtx.lock();
+  raftRpcProctoc::InstallSnapshotRequest args;
+  args.set_leaderid(m_me);
+  args.set_groupid(m_groupId);
+  args.set_term(m_currentTerm);
+  args.set_lastsnapshotincludeindex(snapshot->LastIncludedIndex());
+  args.set_lastsnapshotincludeterm(snapshot->LastIncludedTerm());
+  SnapshotTransfer &transfer = m_snapshotTransfers[server];
+  if (transfer.lastIncludedIndex != snapshot->LastIncludedIndex()) {
+    transfer = {snapshot->LastIncludedIndex(), 0};
+  }
+  long long offset = transfer.offset;
+  m_mtx.unlock();
 
-void Raft::leaderHearBeatTicker() {
   while (true) {
-    //不是leader的话就没有必要进行后续操作，况且还要拿锁，很影响性能，目前是睡眠，后面再优化优化
-    while (m_status != Leader) {
-      usleep(1000 * HeartBeatTimeout);
-      // std::this_thread::sleep_for(std::chrono::milliseconds(HeartBeatTimeout));
+    if (offset < 0 || offset > snapshot->Size()) {
+      offset = 0;
     }
-    static std::atomic<int32_t> atomicCount = 0;
-
-    std::chrono::duration<signed long int, std::ratio<1, 1000000000>> suitableSleepTime{};
-    std::chrono::system_clock::time_point wakeTime{};
-    {
-      std::lock_guard<std::mutex> lock(m_mtx);
-      wakeTime = now();
-      suitableSleepTime = std::chrono::milliseconds(HeartBeatTimeout) + m_lastResetHearBeatTime - wakeTime;
+    std::string* chunk = args.mutable_data();
+    if (!snapshot->ReadAt(offset, RAFT_SNAPSHOT_CHUNK_SIZE, chunk)) {
+      DPrintf("[func-leaderSendSnapShot-rf{%d}] read snapshot at offset %lld failed", m_me, offset);
+      return;
     }
+    bool done = offset + static_cast<long long>(chunk->size()) == snapshot->Size();
+    args.set_offset(offset);
+    args.set_done(done);
+    args.set_crc(done ? snapshot->Crc() : 0);
 
-    if (std::chrono::duration<double, std::milli>(suitableSleepTime).count() > 1) {
-      std::cout << atomicCount << "\033[1;35m leaderHearBeatTicker();函数设置睡眠时间为: "
-                << std::chrono::duration_cast<std::chrono::milliseconds>(suitableSleepTime).count() << " 毫秒\033[0m"
-                << std::endl;
-      // 获取当前时间点
-      auto start = std::chrono::steady_clock::now();
-
-      usleep(std::chrono::duration_cast<std::chrono::microseconds>(suitableSleepTime).count());
-      // std::this_thread::sleep_for(suitableSleepTime);
-
-      // 获取函数运行结束后的时间点
-      auto end = std::chrono::steady_clock::now();
-
-      // 计算时间差并输出结果（单位为毫秒）
-      std::chrono::duration<double, std::milli> duration = end - start;
-
-      // 使用ANSI控制序列将输出颜色修改为紫色
-      std::cout << atomicCount << "\033[1;35m leaderHearBeatTicker();函数实际睡眠时间为: " << duration.count()
-                << " 毫秒\033[0m" << std::endl;
-      ++atomicCount;
+    raftRpcProctoc::InstallSnapshotResponse reply;
+    bool ok = m_peers[server]->InstallSnapshot(&args, &reply);
+    m_mtx.lock();
+    DEFER { m_mtx.unlock(); };
+    if (!ok) {
+      return;
     }
-
-    if (std::chrono::duration<double, std::milli>(m_lastResetHearBeatTime - wakeTime).count() > 0) {
-      //睡眠的这段时间有重置定时器，没有超时，再次睡眠
-      continue;
+    if (m_status != Leader || m_currentTerm != args.term()) {
+      return;  //中间释放过锁，可能状态已经改变了
     }
-    // DPrintf("[func-Raft::doHeartBeat()-Leader: {%d}] Leader的心跳定时器触发了\n", m_me);
-    doHeartBeat();
+    //	无论什么时候都要判断term
+    if (reply.term() > m_currentTerm) {
+      //三变
+      m_currentTerm = reply.term();
+      m_votedFor = -1;
+      m_status = Follower;
+      persist();
+      m_lastResetElectionTime = now();
+      return;
+    }
+    m_lastSendTime[server] = now();
+    if (reply.installed()) {
+      m_snapshotTransfers[server] = {};
+      m_matchIndex[server] = std::max(m_matchIndex[server], args.lastsnapshotincludeindex());
+      m_nextIndex[server] = m_matchIndex[server] + 1;
+      // 快照之后的nextIndex还要重新探测
+      m_replicating[server] = false;
+      return;
+    }
+    offset = reply.nextoffset();
+    m_snapshotTransfers[server] = {args.lastsnapshotincludeindex(), offset};
   }
 }
 
-void Raft::leaderSendSnapShot(int server) {
-  m_mtx.lock();
-  raftRpcProctoc::InstallSnapshotRequest args;
-  args.set_leaderid(m_me);
-  args.set_term(m_currentTerm);
-  args.set_lastsnapshotincludeindex(m_lastSnapshotIncludeIndex);
-  args.set_lastsnapshotincludeterm(m_lastSnapshotIncludeTerm);
-  args.set_data(m_persister->ReadSnapshot());
-
-  raftRpcProctoc::InstallSnapshotResponse reply;
-  m_mtx.unlock();
-  bool ok = m_peers[server]->InstallSnapshot(&args, &reply);
-  m_mtx.lock();
-  DEFER { m_mtx.unlock(); };
-  if (!ok) {
+void Raft::leaderUpdateCommitIndex() {
+  // m_matchIndex[m_me]是leader自己已经落盘的最后一条日志，leader已经被移除时不算
+  // 第quorum()大的matchIndex就是多数派都已经复制到的位置，不用再从日志末尾往回逐条数
+  int matched[RAFT_MAX_NODES];
+  int n = 0;
+  for (int i = 0; i < m_peers.size(); i++) {
+    if (m_roles[i] == Voter) {
+      matched[n++] = m_matchIndex[i];
+    }
+  }
+  int need = quorum();
+  if (n < need) {
     return;
   }
-  if (m_status != Leader || m_currentTerm != args.term()) {
-    return;  //中间释放过锁，可能状态已经改变了
+  std::nth_element(matched, matched + need - 1, matched + n, std::greater<int>());
+  int index = std::min(matched[need - 1], getLastLogIndex());
+  if (index <= std::max(m_commitIndex, m_lastSnapshotIncludeIndex)) {
+    return;
   }
-  //	无论什么时候都要判断term
-  if (reply.term() > m_currentTerm) {
-    //三变
-    m_currentTerm = reply.term();
-    m_votedFor = -1;
-    m_status = Follower;
-    persist();
-    m_lastResetElectionTime = now();
+  //        !!!只有当前term有新提交的，才会更新commitIndex！！！！
+  // term随index单调不减，这一条不是当前term的话更前面的也都不是
+  if (getLogTermFromLogIndex(index) != m_currentTerm) {
     return;
   }
-  m_matchIndex[server] = args.lastsnapshotincludeindex();
-  m_nextIndex[server] = m_matchIndex[server] + 1;
-}
-
-void Raft::leaderUpdateCommitIndex() {
-  m_commitIndex = m_lastSnapshotIncludeIndex;
-  // for index := rf.commitIndex+1;index < len(rf.log);index++ {
-  // for index := rf.getLastIndex();index>=rf.commitIndex+1;index--{
-  for (int index = getLastLogIndex(); index >= m_lastSnapshotIncludeIndex + 1; index--) {
-    int sum = 0;
-    for (int i = 0; i < m_peers.size(); i++) {
-      if (i == m_me) {
-        sum += 1;
-        continue;
-      }
-      if (m_matchIndex[i] >= index) {
-        sum += 1;
-      }
-    }
-
-    //        !!!只有当前term有新提交的，才会更新commitIndex！！！！
-    // log.Printf("lastSSP:%d, index: %d, commitIndex: %d, lastIndex: %d",rf.lastSSPointIndex, index, rf.commitIndex,
-    // rf.getLastIndex())
-    if (sum >= m_peers.size() / 2 + 1 && getLogTermFromLogIndex(index) == m_currentTerm) {
-      m_commitIndex = index;
-      break;
+  int64_t nowUs = MetricsNowUs();
+  int from = std::max(std::max(m_commitIndex, m_lastSnapshotIncludeIndex) + 1,
+                      index - static_cast<int>(m_traces.size()) + 1);
+  for (int i = from; i <= index; i++) {
+    ProposalTrace& trace = m_traces[i % m_traces.size()];
+    if (trace.index == i && trace.committedUs == 0) {
+      trace.committedUs = nowUs;
+      raftMetrics().commit->record(nowUs - trace.appendedUs);
     }
   }
-  //    DPrintf("[func-leaderUpdateCommitIndex()-rf{%v}] Leader %d(term%d) commitIndex
-  //    %d",rf.me,rf.me,rf.currentTerm,rf.commitIndex)
+  raftMetrics().committed->add(index - std::max(m_commitIndex, m_lastSnapshotIncludeIndex));
+  m_commitIndex = index;
+  m_applierCv.notifyOne();
+  m_readCv.notifyAll();  // 等配置日志提交的ChangeMembership
+  stepDownIfRemoved();
 }
 
 //进来前要保证logIndex是存在的，即≥rf.lastSnapshotIncludeIndex	，而且小于等于rf.getLastLogIndex()
@@ -580,10 +794,43 @@ bool Raft::matchLog(int logIndex, int logTerm) {
 }
 
 void Raft::persist() {
-  
-  auto data = persistData();
-  m_persister->SaveRaftState(data);
-  
+  if (m_currentTerm != m_persistedTerm || m_votedFor != m_persistedVotedFor) {
+    m_persister->SaveHardState(m_currentTerm, m_votedFor);
+    m_persistedTerm = m_currentTerm;
+    m_persistedVotedFor = m_votedFor;
+  }
+  // 快照点之前的日志已经不在m_logs里了
+  int lastLogIndex = getLastLogIndex();
+  int firstIndex = std::max(m_persistedLastLogIndex, m_lastSnapshotIncludeIndex) + 1;
+  if (firstIndex <= lastLogIndex) {
+    std::vector<std::string> entries;
+    entries.reserve(lastLogIndex - firstIndex + 1);
+    for (int index = firstIndex; index <= lastLogIndex; ++index) {
+      entries.push_back(m_logs[getSlicesIndexFromLogIndex(index)].SerializeAsString());
+    }
+    m_persister->AppendLogs(firstIndex, entries);
+  }
+  m_persistedLastLogIndex = lastLogIndex;
+}
+
+void Raft::truncateLogSuffix(int logIndex) {
+  myAssert(logIndex > m_lastSnapshotIncludeIndex,
+           format("[func-truncateLogSuffix-rf{%d}] index{%d} <= lastSnapshotIncludeIndex{%d}", m_me, logIndex,
+                  m_lastSnapshotIncludeIndex));
+  m_logs.truncate(getSlicesIndexFromLogIndex(logIndex));
+  if (m_persistedLastLogIndex >= logIndex) {
+    m_persister->TruncateSuffix(logIndex);
+    m_persistedLastLogIndex = logIndex - 1;
+  }
+  // 被截掉的配置不再生效，退回到之前的配置
+  bool configChanged = false;
+  while (!m_configLog.empty() && m_configLog.back().first >= logIndex) {
+    m_configLog.pop_back();
+    configChanged = true;
+  }
+  if (configChanged) {
+    applyMembership();
+  }
 }
 
 void Raft::RequestVote(const raftRpcProctoc::RequestVoteArgs* args, raftRpcProctoc::RequestVoteReply* reply) {
@@ -594,6 +841,16 @@ void Raft::RequestVote(const raftRpcProctoc::RequestVoteArgs* args, raftRpcProct
     //应该先持久化，再撤销lock
     persist();
   };
+  if (args->prevote()) {
+    // 不更新term也不记录投票；最近还收到过leader的消息说明leader还在，不支持换届
+    bool leaderAlive = m_status == Leader || (m_leaderId >= 0 && m_leaderTerm == m_currentTerm &&
+                                              now() - m_lastResetElectionTime < std::chrono::milliseconds(minRandomizedElectionTime));
+    reply->set_term(m_currentTerm);
+    reply->set_votestate(Normal);
+    reply->set_votegranted(args->term() > m_currentTerm && !(RAFT_CHECK_QUORUM && leaderAlive) &&
+                           UpToDate(args->lastlogindex(), args->lastlogterm()));
+    return;
+  }
   //对args的term的三种情况分别进行处理，大于小于等于自己的term都是不同的处理
   // reason: 出现网络分区，该竞选者已经OutOfDate(过时）
   if (args->term() < m_currentTerm) {
@@ -602,6 +859,13 @@ void Raft::RequestVote(const raftRpcProctoc::RequestVoteArgs* args, raftRpcProct
     reply->set_votegranted(false);
     return;
   }
+  // 租约读依赖这一点：leader租约内以及follower刚收到leader消息的一段时间内不认可新的candidate
+  if (RAFT_READ_LEASE && args->term() > m_currentTerm && !args->leadertransfer() && inReadLease()) {
+    reply->set_term(m_currentTerm);
+    reply->set_votestate(Voted);
+    reply->set_votegranted(false);
+    return;
+  }
   // fig2:右下角，如果任何时候rpc请求或者响应的term大于自己的term，更新term，并变成follower
   if (args->term() > m_currentTerm) {
     //        DPrintf("[	    func-RequestVote-rf(%v)		] : 变成follower且更新term
@@ -675,8 +939,8 @@ void Raft::getLastLogIndexAndTerm(int* lastLogIndex, int* lastLogTerm) {
     *lastLogTerm = m_lastSnapshotIncludeTerm;
     return;
   } else {
-    *lastLogIndex = m_logs[m_logs.size() - 1].logindex();
-    *lastLogTerm = m_logs[m_logs.size() - 1].logterm();
+    *lastLogIndex = m_logs.back().logindex();
+    *lastLogTerm = m_logs.back().logterm();
     return;
   }
 }
@@ -699,6 +963,19 @@ int Raft::getLastLogTerm() {
   return lastLogTerm;
 }
 
+int Raft::firstLogIndexWithTermAtLeast(int term, int hi) {
+  int lo = m_lastSnapshotIncludeIndex + 1;
+  while (lo <= hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (m_logs[getSlicesIndexFromLogIndex(mid)].logterm() >= term) {
+      hi = mid - 1;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
 /**
  *
  * @param logIndex log的逻辑index。注意区别于m_logs的物理index
@@ -742,10 +1019,10 @@ bool Raft::sendRequestVote(int server, std::shared_ptr<raftRpcProctoc::RequestVo
   // ok := rf.peers[server].Call("Raft.RequestVote", args, reply)
   // todo
   auto start = now();
-  DPrintf("[func-sendRequestVote rf{%d}] 向server{%d} 發送 RequestVote 開始", m_me, m_currentTerm, getLastLogIndex());
+  DPrintf("[func-sendRequestVote rf{%d}] 向server{%d} 發送 RequestVote 開始", m_me, server);
   bool ok = m_peers[server]->RequestVote(args.get(), reply.get());
-  DPrintf("[func-sendRequestVote rf{%d}] 向server{%d} 發送 RequestVote 完畢，耗時:{%d} ms", m_me, m_currentTerm,
-          getLastLogIndex(), now() - start);
+  DPrintf("[func-sendRequestVote rf{%d}] 向server{%d} 發送 RequestVote 完畢，耗時:{%lld} ms", m_me, server,
+          static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(now() - start).count()));
 
   if (!ok) {
     return ok;  //不知道为什么不加这个的话如果服务器宕机会出现问题的，通不过2B  todo
@@ -771,57 +1048,100 @@ bool Raft::sendRequestVote(int server, std::shared_ptr<raftRpcProctoc::RequestVo
   myAssert(reply->term() == m_currentTerm, format("assert {reply.Term==rf.currentTerm} fail"));
 
   // todo：这里没有按博客写
-  if (!reply->votegranted()) {
+  // 投票期间配置变了，对方已经不是投票成员时它的票不算
+  if (!reply->votegranted() || m_roles[server] != Voter || m_status != Candidate) {
     return true;
   }
 
   *votedNum = *votedNum + 1;
-  if (*votedNum >= m_peers.size() / 2 + 1) {
+  if (*votedNum >= quorum()) {
     //变成leader
     *votedNum = 0;
-    if (m_status == Leader) {
-      //如果已经是leader了，那么是就是了，不会进行下一步处理了k
-      myAssert(false,
-               format("[func-sendRequestVote-rf{%d}]  term:{%d} 同一个term当两次领导，error", m_me, m_currentTerm));
-    }
-    //	第一次变成leader，初始化状态和nextIndex、matchIndex
-    m_status = Leader;
+    becomeLeader();
+  }
+  return true;
+}
 
-    DPrintf("[func-sendRequestVote rf{%d}] elect success  ,current term:{%d} ,lastLogIndex:{%d}\n", m_me, m_currentTerm,
-            getLastLogIndex());
+void Raft::becomeLeader() {
+  if (m_status == Leader) {
+    //如果已经是leader了，那么是就是了，不会进行下一步处理了k
+    myAssert(false, format("[func-sendRequestVote-rf{%d}]  term:{%d} 同一个term当两次领导，error", m_me, m_currentTerm));
+  }
+  //	第一次变成leader，初始化状态和nextIndex、matchIndex
+  raftMetrics().leaderChanges->add();
+  m_status = Leader;
+  m_leaderId = m_me;
+  m_leaderTerm = m_currentTerm;
+  m_leadTransferee = -1;
+  m_leaderSince = now();
 
-    int lastLogIndex = getLastLogIndex();
-    for (int i = 0; i < m_nextIndex.size(); i++) {
-      m_nextIndex[i] = lastLogIndex + 1;  //有效下标从1开始，因此要+1
-      m_matchIndex[i] = 0;                //每换一个领导都是从0开始，见fig2
-    }
-    std::thread t(&Raft::doHeartBeat, this);  //马上向其他节点宣告自己就是leader
-    t.detach();
+  DPrintf("[func-sendRequestVote rf{%d}] elect success  ,current term:{%d} ,lastLogIndex:{%d}\n", m_me, m_currentTerm,
+          getLastLogIndex());
 
-    persist();
+  int lastLogIndex = getLastLogIndex();
+  for (int i = 0; i < m_nextIndex.size(); i++) {
+    m_nextIndex[i] = lastLogIndex + 1;  //有效下标从1开始，因此要+1
+    m_matchIndex[i] = 0;                //每换一个领导都是从0开始，见fig2
+    m_replicating[i] = false;
+    m_pipelineEpoch[i]++;
+    m_ackSendTime[i] = std::chrono::system_clock::time_point{};
   }
-  return true;
+  // 自己的日志在成为candidate之前就已经落盘了
+  m_matchIndex[m_me] = lastLogIndex;
+  doHeartBeat();  //马上向其他节点宣告自己就是leader
+
+  persist();
+}
+
+void Raft::sendPreVote(int server, std::shared_ptr<raftRpcProctoc::RequestVoteArgs> args,
+                       std::shared_ptr<raftRpcProctoc::RequestVoteReply> reply, std::shared_ptr<int> granted,
+                       int round) {
+  if (!m_peers[server]->RequestVote(args.get(), reply.get())) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (reply->term() > m_currentTerm) {
+      m_status = Follower;
+      m_currentTerm = reply->term();
+      m_votedFor = -1;
+      persist();
+      return;
+    }
+    // 已经开始了新一轮预投票，或者term变了、已经当选了，这一轮的结果不再有意义
+    if (round != m_preVoteRound || m_status == Leader || args->term() != m_currentTerm + 1 || !reply->votegranted() ||
+        m_roles[server] != Voter) {
+      return;
+    }
+    // 只在刚好凑够多数派的时候发起一次选举
+    if (++*granted != quorum()) {
+      return;
+    }
+  }
+  doElection();
 }
 
-bool Raft::sendAppendEntries(int server, std::shared_ptr<raftRpcProctoc::AppendEntriesArgs> args,
-                             std::shared_ptr<raftRpcProctoc::AppendEntriesReply> reply,
-                             std::shared_ptr<int> appendNums) {
+bool Raft::sendAppendEntries(int server, const raftRpcProctoc::AppendEntriesArgs* args,
+                             raftRpcProctoc::AppendEntriesReply* reply, int epoch,
+                             std::chrono::system_clock::time_point sendTime) {
   //这个ok是网络是否正常通信的ok，而不是requestVote rpc是否投票的rpc
   // 如果网络不通的话肯定是没有返回的，不用一直重试
-  // todo： paper中5.3节第一段末尾提到，如果append失败应该不断的retries ,直到这个log成功的被store
   DPrintf("[func-Raft::sendAppendEntries-raft{%d}] leader 向节点{%d}发送AE rpc開始 ， args->entries_size():{%d}", m_me,
           server, args->entries_size());
-  bool ok = m_peers[server]->AppendEntries(args.get(), reply.get());
+  bool ok = m_peers[server]->AppendEntries(args, reply);
 
-  if (!ok) {
+  std::lock_guard<std::mutex> lg1(m_mtx);
+  if (!ok || reply->appstate() == Disconnected) {
     DPrintf("[func-Raft::sendAppendEntries-raft{%d}] leader 向节点{%d}发送AE rpc失敗", m_me, server);
-    return ok;
+    // 乐观推进的nextIndex可能对方根本没有收到，退回到已确认的位置重新探测
+    if (m_status == Leader && args->term() == m_currentTerm && epoch == m_pipelineEpoch[server]) {
+      m_nextIndex[server] = std::min(m_nextIndex[server], args->prevlogindex() + 1);
+      m_replicating[server] = false;
+      m_pipelineEpoch[server]++;
+    }
+    return false;
   }
   DPrintf("[func-Raft::sendAppendEntries-raft{%d}] leader 向节点{%d}发送AE rpc成功", m_me, server);
-  if (reply->appstate() == Disconnected) {
-    return ok;
-  }
-  std::lock_guard<std::mutex> lg1(m_mtx);
 
   //对reply进行处理
   // 对于rpc通信，无论什么时候都要检查term
@@ -829,6 +1149,8 @@ bool Raft::sendAppendEntries(int server, std::shared_ptr<raftRpcProctoc::AppendE
     m_status = Follower;
     m_currentTerm = reply->term();
     m_votedFor = -1;
+    persist();
+    m_readCv.notifyAll();
     return ok;
   } else if (reply->term() < m_currentTerm) {
     DPrintf("[func -sendAppendEntries  rf{%d}]  节点：{%d}的term{%d}<rf{%d}的term{%d}\n", m_me, server, reply->term(),
@@ -836,66 +1158,51 @@ bool Raft::sendAppendEntries(int server, std::shared_ptr<raftRpcProctoc::AppendE
     return ok;
   }
 
-  if (m_status != Leader) {
-    //如果不是leader，那么就不要对返回的情况进行处理了
+  if (m_status != Leader || args->term() != m_currentTerm) {
+    //如果不是leader，或者是上一个任期发出的AE，那么就不要对返回的情况进行处理了
     return ok;
   }
-  // term相等
+  // term相等，不管日志是否匹配，对方都认可了这次AE发出时自己是leader
+  if (sendTime > m_ackSendTime[server]) {
+    m_ackSendTime[server] = sendTime;
+    m_readCv.notifyAll();
+  }
 
   myAssert(reply->term() == m_currentTerm,
            format("reply.Term{%d} != rf.currentTerm{%d}   ", reply->term(), m_currentTerm));
   if (!reply->success()) {
-    //日志不匹配，正常来说就是index要往前-1，既然能到这里，第一个日志（idnex =
-    // 1）发送后肯定是匹配的，因此不用考虑变成负数 因为真正的环境不会知道是服务器宕机还是发生网络分区了
-    if (reply->updatenextindex() != -100) {
-      // todo:待总结，就算term匹配，失败的时候nextIndex也不是照单全收的，因为如果发生rpc延迟，leader的term可能从不符合term要求
-      //变得符合term要求
-      //但是不能直接赋值reply.UpdateNextIndex
+    // 同一轮流水线里后面的AE也会被拒绝，只按第一个拒绝回退nextIndex
+    if (reply->updatenextindex() != -100 && epoch == m_pipelineEpoch[server]) {
       DPrintf("[func -sendAppendEntries  rf{%d}]  返回的日志term相等，但是不匹配，回缩nextIndex[%d]：{%d}\n", m_me,
               server, reply->updatenextindex());
-      m_nextIndex[server] = reply->updatenextindex();  //失败是不更新mathIndex的
+      int nextIndex = reply->updatenextindex();
+      if (reply->conflictterm() > 0 && args->prevlogindex() <= getLastLogIndex()) {
+        // leader也有冲突的这个term时，这个term在两边是从同一个leader来的，从leader这个term的最后一条之后接着对
+        int last = firstLogIndexWithTermAtLeast(reply->conflictterm() + 1, args->prevlogindex()) - 1;
+        if (last > m_lastSnapshotIncludeIndex && getLogTermFromLogIndex(last) == reply->conflictterm()) {
+          nextIndex = last + 1;
+        }
+      }
+      m_nextIndex[server] = nextIndex;  //失败是不更新mathIndex的
+      m_replicating[server] = false;
+      m_pipelineEpoch[server]++;
     }
-    //	怎么越写越感觉rf.nextIndex数组是冗余的呢，看下论文fig2，其实不是冗余的
   } else {
-    *appendNums = *appendNums + 1;
-    DPrintf("---------------------------tmp------------------------- 節點{%d}返回true,當前*appendNums{%d}", server,
-            *appendNums);
-    // rf.matchIndex[server] = len(args.Entries) //只要返回一个响应就对其matchIndex应该对其做出反应，
-    //但是这么修改是有问题的，如果对某个消息发送了多遍（心跳时就会再发送），那么一条消息会导致n次上涨
+    //如果对某个消息发送了多遍（心跳时就会再发送），那么一条消息会导致n次上涨，因此取max
     m_matchIndex[server] = std::max(m_matchIndex[server], args->prevlogindex() + args->entries_size());
-    m_nextIndex[server] = m_matchIndex[server] + 1;
+    // 流水线中nextIndex可能已经越过了这个回复
+    m_nextIndex[server] = std::max(m_nextIndex[server], m_matchIndex[server] + 1);
+    m_replicating[server] = true;
     int lastLogIndex = getLastLogIndex();
 
     myAssert(m_nextIndex[server] <= lastLogIndex + 1,
              format("error msg:rf.nextIndex[%d] > lastLogIndex+1, len(rf.logs) = %d   lastLogIndex{%d} = %d", server,
                     m_logs.size(), server, lastLogIndex));
-    if (*appendNums >= 1 + m_peers.size() / 2) {
-      //可以commit了
-      //两种方法保证幂等性，1.赋值为0 	2.上面≥改为==
-
-      *appendNums = 0;
-      // 不断遍历来统计rf.commitIndex
-      // leader只有在当前term有日志提交的时候才更新commitIndex，因为raft无法保证之前term的Index是否提交
-      //只有当前term有日志提交，之前term的log才可以被提交，只有这样才能保证“领导人完备性{当选领导人的节点拥有之前被提交的所有log，当然也可能有一些没有被提交的}”
-      // rf.leaderUpdateCommitIndex()
-      if (args->entries_size() > 0) {
-        DPrintf("args->entries(args->entries_size()-1).logterm(){%d}   m_currentTerm{%d}",
-                args->entries(args->entries_size() - 1).logterm(), m_currentTerm);
-      }
-      if (args->entries_size() > 0 && args->entries(args->entries_size() - 1).logterm() == m_currentTerm) {
-        DPrintf(
-            "---------------------------tmp------------------------- 當前term有log成功提交,更新leader的m_commitIndex "
-            "from{%d} to{%d}",
-            m_commitIndex, args->prevlogindex() + args->entries_size());
-
-        m_commitIndex = std::max(m_commitIndex, args->prevlogindex() + args->entries_size());
-      }
-      myAssert(m_commitIndex <= lastLogIndex,
-               format("[func-sendAppendEntries,rf{%d}] lastLogIndex:%d  rf.commitIndex:%d\n", m_me, lastLogIndex,
-                      m_commitIndex));
-      // fmt.Printf("[func-sendAppendEntries,rf{%v}] len(rf.logs):%v  rf.commitIndex:%v\n", rf.me, len(rf.logs),
-      // rf.commitIndex)
-    }
+    // leader只有在当前term有日志提交的时候才更新commitIndex，因为raft无法保证之前term的Index是否提交
+    leaderUpdateCommitIndex();
+    myAssert(m_commitIndex <= lastLogIndex,
+             format("[func-sendAppendEntries,rf{%d}] lastLogIndex:%d  rf.commitIndex:%d\n", m_me, lastLogIndex,
+                    m_commitIndex));
   }
   return ok;
 }
@@ -904,6 +1211,8 @@ void Raft::AppendEntries(google::protobuf::RpcController* controller,
                          const ::raftRpcProctoc::AppendEntriesArgs* request,
                          ::raftRpcProctoc::AppendEntriesReply* response, ::google::protobuf::Closure* done) {
   AppendEntries1(request, response);
+  // 回复之前日志必须已经落盘，Sync在锁外等待，和同时到达的其他写入共用一次fdatasync
+  m_persister->Sync();
   done->Run();
 }
 
@@ -911,6 +1220,7 @@ void Raft::InstallSnapshot(google::protobuf::RpcController* controller,
                            const ::raftRpcProctoc::InstallSnapshotRequest* request,
                            ::raftRpcProctoc::InstallSnapshotResponse* response, ::google::protobuf::Closure* done) {
   InstallSnapshot(request, response);
+  m_persister->Sync();
 
   done->Run();
 }
@@ -918,46 +1228,475 @@ void Raft::InstallSnapshot(google::protobuf::RpcController* controller,
 void Raft::RequestVote(google::protobuf::RpcController* controller, const ::raftRpcProctoc::RequestVoteArgs* request,
                        ::raftRpcProctoc::RequestVoteReply* response, ::google::protobuf::Closure* done) {
   RequestVote(request, response);
+  m_persister->Sync();
+  done->Run();
+}
+
+void Raft::ReadIndex(google::protobuf::RpcController* controller, const ::raftRpcProctoc::ReadIndexArgs* request,
+                     ::raftRpcProctoc::ReadIndexReply* response, ::google::protobuf::Closure* done) {
+  int readIndex = -1;
+  bool isLeader = false;
+  response->set_success(ReadIndex(&readIndex, &isLeader));
+  response->set_readindex(readIndex);
+  int term = -1;
+  GetState(&term, &isLeader);
+  response->set_term(term);
+  done->Run();
+}
+
+void Raft::TimeoutNow(google::protobuf::RpcController* controller, const ::raftRpcProctoc::TimeoutNowArgs* request,
+                      ::raftRpcProctoc::TimeoutNowReply* response, ::google::protobuf::Closure* done) {
+  TimeoutNow(request, response);
   done->Run();
 }
 
 void Raft::Start(Op command, int* newLogIndex, int* newLogTerm, bool* isLeader) {
-  std::lock_guard<std::mutex> lg1(m_mtx);
-  //    m_mtx.lock();
-  //    Defer ec1([this]()->void {
-  //       m_mtx.unlock();
-  //    });
-  if (m_status != Leader) {
-    DPrintf("[func-Start-rf{%d}]  is not leader");
-    *newLogIndex = -1;
-    *newLogTerm = -1;
+  // 编码不需要持锁
+  Proposal proposal;
+  proposal.proposedUs = MetricsNowUs();
+  proposal.command = command.asString();
+  raftMetrics().proposals->add();
+
+  // 并发的Start排进m_proposals，由其中一个线程（combiner）把当时排着的全部一起写进日志
+  std::unique_lock<std::mutex> lk(m_proposeMtx);
+  m_proposals.push_back(&proposal);
+  while (!proposal.done) {
+    if (m_proposing) {
+      m_proposeCv.wait(lk, [&]() { return proposal.done || !m_proposing; });
+      continue;
+    }
+    m_proposing = true;
+    // 凑批的窗口比协程定时器的精度（ms）短，分成小段sleep：协程里hook成让出，同一线程上的其他提议者可以进来排队
+    int64_t windowEnd = MetricsNowUs() + RAFT_PROPOSE_BATCH_WINDOW_US;
+    for (int64_t left = RAFT_PROPOSE_BATCH_WINDOW_US; left > 0 && m_proposals.size() < RAFT_PROPOSE_BATCH_MAX;
+         left = windowEnd - MetricsNowUs()) {
+      lk.unlock();
+      usleep(static_cast<useconds_t>(std::min<int64_t>(left, RAFT_PROPOSE_BATCH_SLICE_US)));
+      lk.lock();
+    }
+    std::vector<Proposal*> batch;
+    batch.swap(m_proposals);
+    lk.unlock();
+    int lastLogIndex = -1;
+    int term = -1;
+    bool leader = appendProposals(batch, &lastLogIndex, &term);
+    lk.lock();
+    for (auto* p : batch) {
+      p->done = true;
+    }
+    // 放开combiner的身份，等落盘期间下一批可以接着写进日志，和这一批共用一次fdatasync
+    m_proposing = false;
+    m_proposeCv.notifyAll();
+    lk.unlock();
+    if (leader) {
+      // 落盘之后leader自己才算这批日志的一票
+      int64_t syncStart = MetricsNowUs();
+      m_persister->Sync();
+      RecordSince(raftMetrics().persist, syncStart);
+      std::lock_guard<std::mutex> lg(m_mtx);
+      if (m_status == Leader && m_currentTerm == term) {
+        m_matchIndex[m_me] = std::max(m_matchIndex[m_me], lastLogIndex);
+        leaderUpdateCommitIndex();
+      }
+    }
+    lk.lock();
+  }
+  *newLogIndex = proposal.index;
+  *newLogTerm = proposal.term;
+  *isLeader = proposal.isLeader;
+}
+
+bool Raft::appendProposals(const std::vector<Proposal*>& batch, int* lastLogIndex, int* term) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  // 正在交出领导权时当作不是leader，clerk会去找新的leader
+  if (m_status != Leader || m_leadTransferee >= 0) {
+    DPrintf("[func-Start-rf{%d}]  is not leader", m_me);
+    for (auto* p : batch) {
+      p->index = -1;
+      p->term = -1;
+      p->isLeader = false;
+    }
+    return false;
+  }
+  int64_t appendedUs = MetricsNowUs();
+  for (auto* p : batch) {
+    raftRpcProctoc::LogEntry newLogEntry;
+    newLogEntry.set_command(std::move(p->command));
+    newLogEntry.set_logterm(m_currentTerm);
+    newLogEntry.set_logindex(getNewCommandIndex());
+    p->index = newLogEntry.logindex();
+    p->term = m_currentTerm;
+    p->isLeader = true;
+    m_logs.emplace_back(std::move(newLogEntry));
+    ProposalTrace& trace = m_traces[p->index % m_traces.size()];
+    trace.index = p->index;
+    trace.appendedUs = appendedUs;
+    trace.committedUs = 0;
+    raftMetrics().proposeQueue->record(appendedUs - p->proposedUs);
+  }
+  *lastLogIndex = getLastLogIndex();
+  *term = m_currentTerm;
+  DPrintf("[func-Start-rf{%d}]  lastLogIndex:%d, batch:%zu\n", m_me, *lastLogIndex, batch.size());
+  // 一批只persist一次；新的日志马上交给replicator发送，不等下一次心跳，本地落盘和发送同时进行
+  persist();
+  notifyReplicators();
+  return true;
+}
+
+bool Raft::ReadIndex(int* readIndex, bool* isLeader) {
+  std::unique_lock<std::mutex> lk(m_mtx);
+  *isLeader = m_status == Leader;
+  if (!*isLeader) {
+    return false;
+  }
+  // 新leader提交本term的第一条日志之前，commitIndex可能比之前的leader提交过的小
+  if (getLogTermFromLogIndex(m_commitIndex) != m_currentTerm) {
+    return false;
+  }
+  *readIndex = m_commitIndex;
+  int term = m_currentTerm;
+  auto start = now();
+  if (RAFT_READ_LEASE && inReadLease()) {
+    return true;
+  }
+  // 已经有一轮被要求立即发送、还没发出去的心跳时就等它，不再重复触发
+  bool pending = true;
+  for (int i = 0; i < m_peers.size(); i++) {
+    if (i != m_me && m_lastSendTime[i] != std::chrono::system_clock::time_point{}) {
+      pending = false;
+    }
+  }
+  if (!pending) {
+    doHeartBeat();
+  }
+  bool confirmed = m_readCv.waitFor(lk, CONSENSUS_TIMEOUT, [&]() {
+    return m_status != Leader || m_currentTerm != term || quorumAckedSince(start);
+  });
+  if (!confirmed || m_status != Leader || m_currentTerm != term) {
     *isLeader = false;
-    return;
+    return false;
   }
+  return true;
+}
 
-  raftRpcProctoc::LogEntry newLogEntry;
-  newLogEntry.set_command(command.asString());
-  newLogEntry.set_logterm(m_currentTerm);
-  newLogEntry.set_logindex(getNewCommandIndex());
-  m_logs.emplace_back(newLogEntry);
+bool Raft::FollowerReadIndex(int* readIndex) {
+  raftRpcProctoc::ReadIndexArgs args;
+  int leader = -1;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_status != Follower || m_leaderTerm != m_currentTerm || m_leaderId < 0 || m_leaderId == m_me) {
+      return false;
+    }
+    leader = m_leaderId;
+    if (!m_peers[leader]) {
+      return false;  // 不知道这个leader的地址
+    }
+    args.set_term(m_currentTerm);
+    args.set_groupid(m_groupId);
+  }
+  raftRpcProctoc::ReadIndexReply reply;
+  if (!m_peers[leader]->ReadIndex(&args, &reply) || !reply.success()) {
+    return false;
+  }
+  // leader确认的commitIndex自己可能还没收到，上层等apply追上就行，这里只需要知道它确实是leader
+  *readIndex = reply.readindex();
+  return true;
+}
 
-  int lastLogIndex = getLastLogIndex();
+bool Raft::StaleReadIndex(int maxStalenessMs, int* readIndex) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  if (m_status != Follower || m_leaderTerm != m_currentTerm) {
+    return false;
+  }
+  // 本地的commitIndex是最近一次AE带来的，这期间leader新提交的写入看不到，旧的程度约等于距离上次联系的时间
+  if (now() - m_lastLeaderContactTime > std::chrono::milliseconds(maxStalenessMs)) {
+    return false;
+  }
+  *readIndex = m_commitIndex;
+  return true;
+}
 
-  // leader应该不停的向各个Follower发送AE来维护心跳和保持日志同步，目前的做法是新的命令来了不会直接执行，而是等待leader的心跳触发
-  DPrintf("[func-Start-rf{%d}]  lastLogIndex:%d,command:%s\n", m_me, lastLogIndex, &command);
-  // rf.timer.Reset(10) //接收到命令后马上给follower发送,改成这样不知为何会出现问题，待修正 todo
-  persist();
-  *newLogIndex = newLogEntry.logindex();
-  *newLogTerm = newLogEntry.logterm();
-  *isLeader = true;
+bool Raft::TransferLeadership(int target) {
+  raftRpcProctoc::TimeoutNowArgs args;
+  int term = 0;
+  {
+    std::unique_lock<std::mutex> lk(m_mtx);
+    // 只能交给投票成员
+    if (target < 0) {
+      for (int i = 0; i < m_peers.size(); i++) {
+        if (i != m_me && m_roles[i] == Voter && (target < 0 || m_matchIndex[i] > m_matchIndex[target])) {
+          target = i;
+        }
+      }
+    }
+    if (m_status != Leader || m_leadTransferee >= 0 || target == m_me || target < 0 ||
+        target >= static_cast<int>(m_peers.size()) || m_roles[target] != Voter || !m_peers[target]) {
+      return false;
+    }
+    // 从现在起不接受新的提议，日志不再变长，target追上的就是全部日志；也不再相信租约，target的选举不受租约的限制
+    term = m_currentTerm;
+    m_leadTransferee = target;
+    m_leadTransferTime = now();
+    doHeartBeat();
+    bool caughtUp = m_readCv.waitFor(lk, RAFT_LEAD_TRANSFER_TIMEOUT_MS, [&]() {
+      return m_status != Leader || m_currentTerm != term || m_matchIndex[target] >= getLastLogIndex();
+    });
+    if (m_status != Leader || m_currentTerm != term) {
+      return false;
+    }
+    if (!caughtUp) {
+      DPrintf("[func-TransferLeadership-rf{%d}] 节点{%d}没有追上日志，放弃交出领导权", m_me, target);
+      m_leadTransferee = -1;
+      return false;
+    }
+    args.set_term(m_currentTerm);
+    args.set_leaderid(m_me);
+    args.set_groupid(m_groupId);
+  }
+  raftRpcProctoc::TimeoutNowReply reply;
+  bool sent = m_peers[target]->TimeoutNow(&args, &reply) && reply.success();
+  std::lock_guard<std::mutex> lg(m_mtx);
+  if (!sent) {
+    if (m_status == Leader && m_currentTerm == term && m_leadTransferee == target) {
+      m_leadTransferee = -1;
+    }
+    return false;
+  }
+  // target没能当选（比如刚好和别的节点断开了），过一段时间还是自己领导就恢复接受提议
+  m_ioManager->addTimer(RAFT_LEAD_TRANSFER_TIMEOUT_MS, [this, term, target]() {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_status == Leader && m_currentTerm == term && m_leadTransferee == target) {
+      DPrintf("[func-TransferLeadership-rf{%d}] 节点{%d}没有当选，恢复接受提议", m_me, target);
+      m_leadTransferee = -1;
+    }
+  });
+  DPrintf("[func-TransferLeadership-rf{%d}] term{%d} 领导权交给节点{%d}", m_me, term, target);
+  return true;
+}
+
+void Raft::TimeoutNow(const raftRpcProctoc::TimeoutNowArgs* args, raftRpcProctoc::TimeoutNowReply* reply) {
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    reply->set_term(m_currentTerm);
+    // 只接受当前leader的让位，旧term的TimeoutNow可能来自已经下台的leader
+    if (args->term() != m_currentTerm || m_status != Follower || m_leaderId != args->leaderid() ||
+        m_roles[m_me] != Voter) {
+      reply->set_success(false);
+      return;
+    }
+  }
+  reply->set_success(true);
+  m_ioManager->scheduler([this]() { doElection(true); });
+}
+
+bool Raft::quorumAckedSince(std::chrono::system_clock::time_point t) {
+  int acked = m_roles[m_me] == Voter ? 1 : 0;  // 自己
+  for (int i = 0; i < m_peers.size(); i++) {
+    if (i != m_me && m_roles[i] == Voter && m_ackSendTime[i] >= t) {
+      acked++;
+    }
+  }
+  return acked >= quorum();
+}
+
+bool Raft::inReadLease() {
+  auto current = now();
+  if (m_status == Follower) {
+    return current - m_lastLeaderContactTime < std::chrono::milliseconds(minRandomizedElectionTime);
+  }
+  if (m_status != Leader) {
+    return false;
+  }
+  if (m_leadTransferee >= 0 && current - m_leadTransferTime < std::chrono::milliseconds(maxRandomizedElectionTime)) {
+    return false;
+  }
+  // 多数派里最早的那个确认时间，加上租约时长就是租约的到期时间
+  std::vector<std::chrono::system_clock::time_point> acks;
+  for (int i = 0; i < m_peers.size(); i++) {
+    if (i != m_me && m_roles[i] == Voter) {
+      acks.push_back(m_ackSendTime[i]);
+    }
+  }
+  int need = quorum() - (m_roles[m_me] == Voter ? 1 : 0);  // 除自己以外还需要的确认数
+  if (need <= 0) {
+    return true;
+  }
+  if (need > static_cast<int>(acks.size())) {
+    return false;
+  }
+  std::nth_element(acks.begin(), acks.begin() + need - 1, acks.end(), std::greater<>());
+  return current < acks[need - 1] + std::chrono::milliseconds(RAFT_READ_LEASE_MS);
+}
+
+
+std::string Raft::ChangeMembership(int kind, int nodeId, const std::string& ip, int port) {
+  int index = -1;
+  int term = -1;
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_status != Leader || m_leadTransferee >= 0) {
+      return ErrWrongLeader;
+    }
+    if (nodeId < 0 || nodeId >= RAFT_MAX_NODES) {
+      return ErrBadRequest;
+    }
+    // 一次只变一个成员，新旧两个配置的多数派一定有交集；上一条配置日志提交之前再变就不能保证了
+    // 本term没提交过日志时，上一任leader留下的配置日志可能还没提交
+    int configIndex = m_configLog.empty() ? m_lastSnapshotIncludeIndex : m_configLog.back().first;
+    if (getLogTermFromLogIndex(m_commitIndex) != m_currentTerm || configIndex > m_commitIndex) {
+      return ErrMembershipBusy;
+    }
+    raftRpcProctoc::Membership config = currentMembership();
+    int pos = -1;
+    for (int i = 0; i < config.members_size(); i++) {
+      if (config.members(i).id() == nodeId) {
+        pos = i;
+      }
+    }
+    // 重复的请求（比如上一次等提交超时了）直接回复OK
+    if (kind == AddLearner) {
+      if (pos >= 0) {
+        return config.members(pos).learner() ? OK : ErrBadRequest;
+      }
+      if (ip.empty() || port <= 0) {
+        return ErrBadRequest;
+      }
+      auto* member = config.add_members();
+      member->set_id(nodeId);
+      member->set_ip(ip);
+      member->set_port(port);
+      member->set_learner(true);
+    } else if (kind == PromoteLearner) {
+      if (pos < 0) {
+        return ErrBadRequest;
+      }
+      if (!config.members(pos).learner()) {
+        return OK;
+      }
+      if (m_matchIndex[nodeId] + RAFT_PROMOTE_MAX_LAG < getLastLogIndex()) {
+        return ErrMembershipBusy;
+      }
+      config.mutable_members(pos)->set_learner(false);
+    } else if (kind == RemoveMember) {
+      if (pos < 0) {
+        return OK;
+      }
+      if (!config.members(pos).learner() && m_voters <= 1) {
+        return ErrBadRequest;  // 不能移除最后一个投票成员
+      }
+      config.mutable_members()->DeleteSubrange(pos, 1);
+    } else {
+      return ErrBadRequest;
+    }
+    raftRpcProctoc::LogEntry entry;
+    entry.set_logterm(m_currentTerm);
+    entry.set_logindex(getNewCommandIndex());
+    *entry.mutable_config() = config;
+    index = entry.logindex();
+    term = m_currentTerm;
+    m_logs.emplace_back(std::move(entry));
+    m_configLog.emplace_back(index, std::move(config));
+    DPrintf("[func-ChangeMembership-rf{%d}] term{%d} index{%d} kind{%d} node{%d}", m_me, term, index, kind, nodeId);
+    applyMembership();
+    persist();
+    notifyReplicators();
+  }
+  // 和Start一样，落盘之后自己才算一票
+  m_persister->Sync();
+  std::unique_lock<std::mutex> lk(m_mtx);
+  if (m_status == Leader && m_currentTerm == term) {
+    m_matchIndex[m_me] = std::max(m_matchIndex[m_me], index);
+    leaderUpdateCommitIndex();
+  }
+  // 把自己移除的leader在提交之后已经下台了，commitIndex仍然说明提交了
+  m_readCv.waitFor(lk, CONSENSUS_TIMEOUT,
+                   [&]() { return m_currentTerm != term || m_status != Leader || m_commitIndex >= index; });
+  if (m_currentTerm != term || m_commitIndex < index) {
+    return ErrWrongLeader;
+  }
+  return OK;
+}
+
+bool Raft::IsVoter(int node) {
+  std::lock_guard<std::mutex> lg(m_mtx);
+  return node >= 0 && node < static_cast<int>(m_roles.size()) && m_roles[node] == Voter;
+}
+
+const raftRpcProctoc::Membership& Raft::currentMembership() {
+  return m_configLog.empty() ? m_snapshotMembership : m_configLog.back().second;
+}
+
+const raftRpcProctoc::Membership& Raft::membershipAt(int index) {
+  for (auto it = m_configLog.rbegin(); it != m_configLog.rend(); ++it) {
+    if (it->first <= index) {
+      return it->second;
+    }
+  }
+  return m_snapshotMembership;
+}
+
+void Raft::applyMembership() {
+  std::vector<Role> roles(RAFT_MAX_NODES, NonMember);
+  int voters = 0;
+  for (const auto& member : currentMembership().members()) {
+    if (member.id() < 0 || member.id() >= RAFT_MAX_NODES) {
+      continue;
+    }
+    roles[member.id()] = member.learner() ? Learner : Voter;
+    voters += member.learner() ? 0 : 1;
+    // 连接在第一次使用时才建立，可以持锁创建；同一个节点号的连接一直不换，锁外读m_peers[i]的地方不会读到正在写的指针
+    if (member.id() != m_me && !m_peers[member.id()] && !member.ip().empty()) {
+      m_peers[member.id()] = std::make_shared<RaftRpcUtil>(member.ip(), static_cast<short>(member.port()));
+    }
+  }
+  m_roles.swap(roles);
+  m_voters = voters;
+  // init里调度器建好之后再启动replicator
+  if (m_ioManager) {
+    int lastLogIndex = getLastLogIndex();
+    for (int i = 0; i < RAFT_MAX_NODES; i++) {
+      if (i == m_me || m_roles[i] == NonMember || !m_peers[i] || m_replicatorCount[i] > 0) {
+        continue;
+      }
+      // 新成员从leader的日志末尾开始探测，落后到快照之前时先收快照
+      m_nextIndex[i] = lastLogIndex + 1;
+      m_matchIndex[i] = 0;
+      m_replicating[i] = false;
+      m_pipelineEpoch[i]++;
+      m_ackSendTime[i] = std::chrono::system_clock::time_point{};
+      // 每个成员RAFT_MAX_INFLIGHT_APPENDS个常驻的replicator协程，即流水线窗口大小；心跳也由它们在空闲时发送
+      m_replicatorCount[i] = RAFT_MAX_INFLIGHT_APPENDS;
+      for (int j = 0; j < RAFT_MAX_INFLIGHT_APPENDS; j++) {
+        m_ioManager->scheduler([this, i]() -> void { this->replicator(i); });
+      }
+    }
+  }
+  notifyReplicators();
+  m_readCv.notifyAll();
 }
 
+void Raft::stepDownIfRemoved() {
+  int configIndex = m_configLog.empty() ? m_lastSnapshotIncludeIndex : m_configLog.back().first;
+  if (m_status != Leader || m_roles[m_me] == Voter || configIndex > m_commitIndex) {
+    return;
+  }
+  DPrintf("[func-stepDownIfRemoved-rf{%d}] term{%d} 自己已经不是投票成员，下台", m_me, m_currentTerm);
+  m_status = Follower;
+  m_leaderId = -1;
+  m_lastResetElectionTime = now();
+  m_readCv.notifyAll();
+}
 
-void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
-                std::shared_ptr<LockQueue<ApplyMsg>> applyCh) {
-  m_peers = peers;
+void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, const raftRpcProctoc::Membership& bootstrap, int me,
+                std::shared_ptr<Persister> persister, std::shared_ptr<MpscQueue<ApplyMsgBatch>> applyCh, int groupId,
+                std::shared_ptr<monsoon::IOManager> ioManager) {
+  m_peers.assign(RAFT_MAX_NODES, nullptr);
+  for (int i = 0; i < static_cast<int>(peers.size()) && i < RAFT_MAX_NODES; i++) {
+    m_peers[i] = peers[i];
+  }
   m_persister = persister;
   m_me = me;
+  m_groupId = groupId;
   // Your initialization code here (2A, 2B, 2C).
   m_mtx.lock();
 
@@ -969,19 +1708,31 @@ void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::sh
   m_commitIndex = 0;
   m_lastApplied = 0;
   m_logs.clear();
+  m_snapshotMembership = bootstrap;
+  m_configLog.clear();
+  m_roles.assign(RAFT_MAX_NODES, NonMember);
+  m_replicatorCount.assign(RAFT_MAX_NODES, 0);
   for (int i = 0; i < m_peers.size(); i++) {
     m_matchIndex.push_back(0);
     m_nextIndex.push_back(0);
+    m_inflight.push_back(0);
+    m_replicating.push_back(false);
+    m_pipelineEpoch.push_back(0);
+    m_lastSendTime.emplace_back();
+    m_snapshotTransfers.emplace_back();
+    m_ackSendTime.emplace_back();
   }
   m_votedFor = -1;
+  m_leaderId = -1;
+  m_leaderTerm = 0;
 
   m_lastSnapshotIncludeIndex = 0;
   m_lastSnapshotIncludeTerm = 0;
   m_lastResetElectionTime = now();
-  m_lastResetHearBeatTime = now();
+  m_traces.assign(RAFT_TRACE_RING, ProposalTrace());
 
   // initialize from state persisted before a crash
-  readPersist(m_persister->ReadRaftState());
+  readPersist();
   if (m_lastSnapshotIncludeIndex > 0) {
     m_lastApplied = m_lastSnapshotIncludeIndex;
     // rf.commitIndex = rf.lastSnapshotIncludeIndex   todo ：崩溃恢复为何不能读取commitIndex
@@ -992,57 +1743,69 @@ void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::sh
 
   m_mtx.unlock();
 
-  m_ioManager = std::make_unique<monsoon::IOManager>(FIBER_THREAD_NUM, FIBER_USE_CALLER_THREAD);
+  m_ioManager = ioManager ? ioManager
+                          : std::make_shared<monsoon::IOManager>(FIBER_THREAD_NUM, FIBER_USE_CALLER_THREAD);
 
-  // start ticker fiber to start elections
-  // 启动三个循环定时器
-  // todo:原来是启动了三个线程，现在是直接使用了协程，三个函数中leaderHearBeatTicker
-  // 、electionTimeOutTicker执行时间是恒定的，applierTicker时间受到数据库响应延迟和两次apply之间请求数量的影响，这个随着数据量增多可能不太合理，最好其还是启用一个线程。
-  m_ioManager->scheduler([this]() -> void { this->leaderHearBeatTicker(); });
-  m_ioManager->scheduler([this]() -> void { this->electionTimeOutTicker(); });
-
-  std::thread t3(&Raft::applierTicker, this);
-  t3.detach();
-
-
-}
-
-std::string Raft::persistData() {
-  BoostPersistRaftNode boostPersistRaftNode;
-  boostPersistRaftNode.m_currentTerm = m_currentTerm;
-  boostPersistRaftNode.m_votedFor = m_votedFor;
-  boostPersistRaftNode.m_lastSnapshotIncludeIndex = m_lastSnapshotIncludeIndex;
-  boostPersistRaftNode.m_lastSnapshotIncludeTerm = m_lastSnapshotIncludeTerm;
-  for (auto& item : m_logs) {
-    boostPersistRaftNode.m_logs.push_back(item.SerializeAsString());
+  // 按恢复出来的配置给每个成员启动replicator
+  {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    applyMembership();
   }
 
-  std::stringstream ss;
-  boost::archive::text_oarchive oa(ss);
-  oa << boostPersistRaftNode;
-  return ss.str();
+  // 选举由定时器驱动，不再有轮询的协程
+  // applierTicker等待的是协程条件变量，也作为协程运行，推送只是挂到applyChan上，不会阻塞线程
+  armElectionTimer();
+  m_ioManager->scheduler([this]() -> void { this->applierTicker(); });
+  registerMetrics();
 }
 
-void Raft::readPersist(std::string data) {
-  if (data.empty()) {
-    return;
-  }
-  std::stringstream iss(data);
-  boost::archive::text_iarchive ia(iss);
-  // read class state from archive
-  BoostPersistRaftNode boostPersistRaftNode;
-  ia >> boostPersistRaftNode;
+void Raft::registerMetrics() {
+  // raft对象和进程同生命周期，gauge直接引用this
+  std::string label = format("{group=\"%d\"}", m_groupId);
+  auto locked = [this](std::function<double()> fn) {
+    return [this, fn]() {
+      std::lock_guard<std::mutex> lg(m_mtx);
+      return fn();
+    };
+  };
+  Metrics& metrics = Metrics::Instance();
+  metrics.Gauge("raft_term" + label, "当前term", locked([this]() { return m_currentTerm; }));
+  metrics.Gauge("raft_is_leader" + label, "是否是leader", locked([this]() { return m_status == Leader ? 1 : 0; }));
+  metrics.Gauge("raft_commit_index" + label, "commitIndex", locked([this]() { return m_commitIndex; }));
+  metrics.Gauge("raft_last_applied" + label, "lastApplied", locked([this]() { return m_lastApplied; }));
+  metrics.Gauge("raft_log_entries" + label, "内存里快照之后的日志条数",
+                locked([this]() { return static_cast<double>(m_logs.size()); }));
+  metrics.Gauge("raft_apply_queue_depth" + label, "applyChan里还没被上层取走的批数",
+                [this]() { return static_cast<double>(applyChan->size()); });
+}
 
-  m_currentTerm = boostPersistRaftNode.m_currentTerm;
-  m_votedFor = boostPersistRaftNode.m_votedFor;
-  m_lastSnapshotIncludeIndex = boostPersistRaftNode.m_lastSnapshotIncludeIndex;
-  m_lastSnapshotIncludeTerm = boostPersistRaftNode.m_lastSnapshotIncludeTerm;
-  m_logs.clear();
-  for (auto& item : boostPersistRaftNode.m_logs) {
-    raftRpcProctoc::LogEntry logEntry;
-    logEntry.ParseFromString(item);
-    m_logs.emplace_back(logEntry);
+void Raft::readPersist() {
+  int term = 0, votedFor = -1, snapshotIndex = 0, snapshotTerm = 0;
+  std::vector<std::string> entries;
+  std::string membership;
+  if (m_persister->Restore(&term, &votedFor, &snapshotIndex, &snapshotTerm, &entries, &membership)) {
+    m_currentTerm = term;
+    m_votedFor = votedFor;
+    m_lastSnapshotIncludeIndex = snapshotIndex;
+    m_lastSnapshotIncludeTerm = snapshotTerm;
+    // 没有快照或者快照里没带配置时仍用启动配置
+    if (!membership.empty()) {
+      m_snapshotMembership.ParseFromString(membership);
+    }
+    m_logs.clear();
+    m_configLog.clear();
+    for (auto& item : entries) {
+      raftRpcProctoc::LogEntry logEntry;
+      logEntry.ParseFromString(item);
+      if (logEntry.has_config()) {
+        m_configLog.emplace_back(logEntry.logindex(), logEntry.config());
+      }
+      m_logs.emplace_back(std::move(logEntry));
+    }
   }
+  m_persistedTerm = m_currentTerm;
+  m_persistedVotedFor = m_votedFor;
+  m_persistedLastLogIndex = getLastLogIndex();
 }
 
 void Raft::Snapshot(int index, std::string snapshot) {
@@ -1060,22 +1823,21 @@ void Raft::Snapshot(int index, std::string snapshot) {
   //制造完此快照后剩余的所有日志
   int newLastSnapshotIncludeIndex = index;
   int newLastSnapshotIncludeTerm = m_logs[getSlicesIndexFromLogIndex(index)].logterm();
-  std::vector<raftRpcProctoc::LogEntry> trunckedLogs;
-  // todo :这种写法有点笨，待改进，而且有内存泄漏的风险
-  for (int i = index + 1; i <= getLastLogIndex(); i++) {
-    //注意有=，因为要拿到最后一个日志
-    trunckedLogs.push_back(m_logs[getSlicesIndexFromLogIndex(i)]);
-  }
+  // 直接丢掉快照点及之前的日志，剩下的不用搬动
+  m_logs.dropPrefix(getSlicesIndexFromLogIndex(index) + 1);
   m_lastSnapshotIncludeIndex = newLastSnapshotIncludeIndex;
   m_lastSnapshotIncludeTerm = newLastSnapshotIncludeTerm;
-  m_logs = trunckedLogs;
   m_commitIndex = std::max(m_commitIndex, index);
   m_lastApplied = std::max(m_lastApplied, index);
+  // 被快照包含的配置日志也丢掉了，快照点的配置和快照存在一起
+  m_snapshotMembership = membershipAt(index);
+  while (!m_configLog.empty() && m_configLog.front().first <= index) {
+    m_configLog.erase(m_configLog.begin());
+  }
 
+  m_persister->SaveSnapshot(index, newLastSnapshotIncludeTerm, snapshot, m_snapshotMembership.SerializeAsString());
 
-  m_persister->Save(persistData(), snapshot);
-
-  DPrintf("[SnapShot]Server %d snapshot snapshot index {%d}, term {%d}, loglen {%d}", m_me, index,
+  DPrintf("[SnapShot]Server %d snapshot snapshot index {%d}, term {%d}, loglen {%zu}", m_me, index,
           m_lastSnapshotIncludeTerm, m_logs.size());
   myAssert(m_logs.size() + m_lastSnapshotIncludeIndex == lastLogIndex,
            format("len(rf.logs){%d} + rf.lastSnapshotIncludeIndex{%d} != lastLogjInde{%d}", m_logs.size(),
@@ -6,9 +6,12 @@
 
 #include <mprpcchannel.h>
 #include <mprpccontroller.h>
+#include "config.h"
 
-bool RaftRpcUtil::AppendEntries(raftRpcProctoc::AppendEntriesArgs *args, raftRpcProctoc::AppendEntriesReply *response) {
+bool RaftRpcUtil::AppendEntries(const raftRpcProctoc::AppendEntriesArgs *args,
+                                raftRpcProctoc::AppendEntriesReply *response) {
   MprpcController controller;
+  controller.SetTimeout(RAFT_RPC_TIMEOUT_MS);
   stub_->AppendEntries(&controller, args, response, nullptr);
   return !controller.Failed();
 }
@@ -16,22 +19,49 @@ bool RaftRpcUtil::AppendEntries(raftRpcProctoc::AppendEntriesArgs *args, raftRpc
 bool RaftRpcUtil::InstallSnapshot(raftRpcProctoc::InstallSnapshotRequest *args,
                                   raftRpcProctoc::InstallSnapshotResponse *response) {
   MprpcController controller;
+  controller.SetTimeout(RAFT_INSTALL_SNAPSHOT_TIMEOUT_MS);
   stub_->InstallSnapshot(&controller, args, response, nullptr);
   return !controller.Failed();
 }
 
 bool RaftRpcUtil::RequestVote(raftRpcProctoc::RequestVoteArgs *args, raftRpcProctoc::RequestVoteReply *response) {
   MprpcController controller;
+  controller.SetTimeout(RAFT_RPC_TIMEOUT_MS);
   stub_->RequestVote(&controller, args, response, nullptr);
   return !controller.Failed();
 }
 
+bool RaftRpcUtil::ReadIndex(raftRpcProctoc::ReadIndexArgs *args, raftRpcProctoc::ReadIndexReply *response) {
+  MprpcController controller;
+  // leader要等一轮心跳的确认
+  controller.SetTimeout(CONSENSUS_TIMEOUT);
+  stub_->ReadIndex(&controller, args, response, nullptr);
+  return !controller.Failed();
+}
+
+bool RaftRpcUtil::TimeoutNow(raftRpcProctoc::TimeoutNowArgs *args, raftRpcProctoc::TimeoutNowReply *response) {
+  MprpcController controller;
+  controller.SetTimeout(RAFT_RPC_TIMEOUT_MS);
+  stub_->TimeoutNow(&controller, args, response, nullptr);
+  return !controller.Failed();
+}
+
+bool RaftRpcUtil::RangeAdmin(raftRpcProctoc::RangeAdminArgs *args, raftRpcProctoc::RangeAdminReply *response) {
+  MprpcController controller;
+  controller.SetTimeout(CONSENSUS_TIMEOUT);
+  stub_->RangeAdmin(&controller, args, response, nullptr);
+  return !controller.Failed();
+}
+
 //先开启服务器，再尝试连接其他的节点，中间给一个间隔时间，等待其他的rpc服务器节点启动
 
 RaftRpcUtil::RaftRpcUtil(std::string ip, short port) {
   //*********************************************  */
   //发送rpc设置
-  stub_ = new raftRpcProctoc::raftRpc_Stub(new MprpcChannel(ip, port, true));
+  // 异步多路复用的channel，流水线发送的AE和投票共用一条连接；调用方是协程，等待回复时会让出线程
+  // 连接在第一次使用时才建立；只用一条连接，AE按发送顺序到达follower
+  stub_ = new raftRpcProctoc::raftRpc_Stub(new MprpcChannel(ip, port, false, true, 1),
+                                           google::protobuf::Service::STUB_OWNS_CHANNEL);
 }
 
 RaftRpcUtil::~RaftRpcUtil() { delete stub_; }
@@ -0,0 +1,348 @@
+#include "sstable.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include "config.h"
+#include "snapshotCodec.h"
+#include "util.h"
+
+namespace {
+const char SSTABLE_MAGIC[4] = {'S', 'S', 'T', '1'};
+constexpr size_t SSTABLE_FOOTER_SIZE = 8 + 4 + 8 + 4 + 4 + 8 + sizeof(SSTABLE_MAGIC);
+
+uint64_t DecodeFixed64(const char *p) {
+  return static_cast<uint64_t>(DecodeFixed32(p + 4)) << 32 | DecodeFixed32(p);
+}
+
+// 布隆过滤器用的hash，和index里的std::hash没关系，写进文件的结果不能随标准库实现变化
+uint32_t BloomHash(const std::string &key) {
+  uint32_t h = 2166136261u;
+  for (unsigned char c : key) {
+    h ^= c;
+    h *= 16777619u;
+  }
+  h ^= h >> 15;
+  h *= 0x2c1b3c6du;
+  h ^= h >> 12;
+  return h;
+}
+
+bool preadAll(int fd, uint64_t offset, size_t len, std::string *out) {
+  out->resize(len);
+  size_t done = 0;
+  while (done < len) {
+    ssize_t n = ::pread(fd, &(*out)[done], len - done, static_cast<off_t>(offset + done));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    done += n;
+  }
+  return true;
+}
+
+// data的最后4个字节是前面内容的crc32，校验通过后去掉
+bool checkAndStripCrc(std::string *data) {
+  if (data->size() < 4) {
+    return false;
+  }
+  size_t len = data->size() - 4;
+  if (Crc32(data->data(), len) != DecodeFixed32(data->data() + len)) {
+    return false;
+  }
+  data->resize(len);
+  return true;
+}
+}  // namespace
+
+std::shared_ptr<SSTable> SSTable::Open(const std::string &path, uint64_t number) {
+  std::shared_ptr<SSTable> table(new SSTable());
+  table->m_path = path;
+  table->m_number = number;
+  table->m_fd = ::open(path.c_str(), O_RDONLY);
+  if (table->m_fd < 0) {
+    DPrintf("[func-SSTable::Open] open %s error: %s", path.c_str(), strerror(errno));
+    return nullptr;
+  }
+  struct stat st;
+  if (::fstat(table->m_fd, &st) != 0 || static_cast<size_t>(st.st_size) < SSTABLE_FOOTER_SIZE) {
+    return nullptr;
+  }
+  table->m_fileSize = st.st_size;
+  std::string footer;
+  if (!preadAll(table->m_fd, table->m_fileSize - SSTABLE_FOOTER_SIZE, SSTABLE_FOOTER_SIZE, &footer) ||
+      memcmp(footer.data() + SSTABLE_FOOTER_SIZE - sizeof(SSTABLE_MAGIC), SSTABLE_MAGIC, sizeof(SSTABLE_MAGIC)) != 0) {
+    return nullptr;
+  }
+  uint64_t indexOffset = DecodeFixed64(footer.data());
+  uint32_t indexSize = DecodeFixed32(footer.data() + 8);
+  uint64_t bloomOffset = DecodeFixed64(footer.data() + 12);
+  uint32_t bloomSize = DecodeFixed32(footer.data() + 20);
+  table->m_bloomHashes = DecodeFixed32(footer.data() + 24);
+  table->m_entries = DecodeFixed64(footer.data() + 28);
+
+  std::string index;
+  if (!preadAll(table->m_fd, indexOffset, indexSize + 4, &index) || !checkAndStripCrc(&index) ||
+      !preadAll(table->m_fd, bloomOffset, bloomSize + 4, &table->m_bloom) || !checkAndStripCrc(&table->m_bloom)) {
+    DPrintf("[func-SSTable::Open] %s is corrupted", path.c_str());
+    return nullptr;
+  }
+  SnapshotReader reader(index.data(), index.size());
+  uint32_t blocks = 0;
+  bool ok = DecodeSnapshotField(&reader, &table->m_smallest) && reader.GetFixed32(&blocks) && blocks > 0;
+  for (uint32_t i = 0; ok && i < blocks; ++i) {
+    IndexEntry entry;
+    uint64_t offset = 0;
+    ok = DecodeSnapshotField(&reader, &entry.lastKey) && reader.GetFixed64(&offset) && reader.GetFixed32(&entry.size);
+    entry.offset = offset;
+    table->m_index.push_back(std::move(entry));
+  }
+  if (!ok) {
+    DPrintf("[func-SSTable::Open] %s has a bad index", path.c_str());
+    return nullptr;
+  }
+  return table;
+}
+
+SSTable::~SSTable() {
+  if (m_fd >= 0) {
+    ::close(m_fd);
+  }
+  if (m_obsolete.load()) {
+    ::unlink(m_path.c_str());
+  }
+}
+
+bool SSTable::readBlock(size_t block, std::string *data) const {
+  const IndexEntry &entry = m_index[block];
+  if (!preadAll(m_fd, entry.offset, entry.size + 4, data) || !checkAndStripCrc(data)) {
+    DPrintf("[func-SSTable::readBlock] %s block %d is corrupted", m_path.c_str(), static_cast<int>(block));
+    return false;
+  }
+  return true;
+}
+
+size_t SSTable::findBlock(const std::string &key) const {
+  auto it = std::lower_bound(m_index.begin(), m_index.end(), key,
+                             [](const IndexEntry &entry, const std::string &k) { return entry.lastKey < k; });
+  return it - m_index.begin();
+}
+
+bool SSTable::mayContain(const std::string &key) const {
+  size_t bits = m_bloom.size() * 8;
+  if (bits == 0) {
+    return true;
+  }
+  uint32_t h = BloomHash(key);
+  uint32_t delta = (h >> 17) | (h << 15);
+  for (uint32_t i = 0; i < m_bloomHashes; ++i) {
+    size_t bit = h % bits;
+    if ((static_cast<unsigned char>(m_bloom[bit / 8]) & (1 << (bit % 8))) == 0) {
+      return false;
+    }
+    h += delta;
+  }
+  return true;
+}
+
+bool SSTable::Get(const std::string &key, std::string *record) const {
+  if (key < m_smallest || Largest() < key || !mayContain(key)) {
+    return false;
+  }
+  size_t block = findBlock(key);
+  std::string data;
+  if (block == m_index.size() || !readBlock(block, &data)) {
+    return false;
+  }
+  SnapshotReader reader(data.data(), data.size());
+  std::string k;
+  while (reader.remaining() > 0) {
+    const char *p = nullptr;
+    uint32_t len = 0;
+    if (!DecodeSnapshotField(&reader, &k) || !reader.GetBytes(&p, &len)) {
+      return false;
+    }
+    if (k == key) {
+      record->assign(p, len);
+      return true;
+    }
+    if (key < k) {
+      return false;
+    }
+  }
+  return false;
+}
+
+SSTable::Iterator::Iterator(std::shared_ptr<const SSTable> table)
+    : m_table(std::move(table)), m_block(0), m_pos(0), m_valid(false) {}
+
+bool SSTable::Iterator::loadBlock(size_t block) {
+  m_block = block;
+  m_pos = 0;
+  m_data.clear();
+  return block < m_table->m_index.size() && m_table->readBlock(block, &m_data);
+}
+
+void SSTable::Iterator::parseNext() {
+  while (m_pos >= m_data.size()) {
+    if (!loadBlock(m_block + 1)) {
+      m_valid = false;
+      return;
+    }
+  }
+  SnapshotReader reader(m_data.data() + m_pos, m_data.size() - m_pos);
+  m_valid = DecodeSnapshotField(&reader, &m_key) && DecodeSnapshotField(&reader, &m_record);
+  m_pos = m_data.size() - reader.remaining();
+}
+
+void SSTable::Iterator::seekToFirst() {
+  if (!loadBlock(0)) {
+    m_valid = false;
+    return;
+  }
+  parseNext();
+}
+
+void SSTable::Iterator::seek(const std::string &target) {
+  size_t block = m_table->findBlock(target);
+  if (!loadBlock(block)) {
+    m_valid = false;
+    return;
+  }
+  parseNext();
+  while (m_valid && m_key < target) {
+    parseNext();
+  }
+}
+
+void SSTable::Iterator::next() { parseNext(); }
+
+SSTableBuilder::SSTableBuilder(const std::string &path)
+    : m_path(path), m_ok(true), m_offset(0), m_entries(0), m_blocks(0) {
+  m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (m_fd < 0) {
+    DPrintf("[func-SSTableBuilder] open %s error: %s", path.c_str(), strerror(errno));
+    m_ok = false;
+  }
+}
+
+SSTableBuilder::~SSTableBuilder() {
+  if (m_fd >= 0) {
+    ::close(m_fd);
+  }
+}
+
+bool SSTableBuilder::writeOut(const std::string &data) {
+  const char *p = data.data();
+  size_t left = data.size();
+  while (m_ok && left > 0) {
+    ssize_t n = ::write(m_fd, p, left);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      DPrintf("[func-SSTableBuilder] write %s error: %s", m_path.c_str(), strerror(errno));
+      m_ok = false;
+      break;
+    }
+    p += n;
+    left -= n;
+  }
+  m_offset += data.size();
+  return m_ok;
+}
+
+void SSTableBuilder::Add(const std::string &key, const std::string &record) {
+  myAssert(m_entries == 0 || m_lastKey < key,
+           format("[func-SSTableBuilder::Add] keys out of order in %s", m_path.c_str()));
+  if (m_entries == 0) {
+    m_smallest = key;
+  }
+  EncodeSnapshotField(&m_block, key);
+  EncodeSnapshotField(&m_block, record);
+  m_keyHashes.push_back(BloomHash(key));
+  m_lastKey = key;
+  ++m_entries;
+  if (m_block.size() >= static_cast<size_t>(SSTABLE_BLOCK_BYTES)) {
+    flushBlock();
+  }
+}
+
+void SSTableBuilder::flushBlock() {
+  if (m_block.empty()) {
+    return;
+  }
+  EncodeSnapshotField(&m_index, m_lastKey);
+  PutFixed64(&m_index, m_offset);
+  PutFixed32(&m_index, static_cast<uint32_t>(m_block.size()));
+  ++m_blocks;
+  PutFixed32(&m_block, Crc32(m_block.data(), m_block.size()));
+  writeOut(m_block);
+  m_block.clear();
+}
+
+bool SSTableBuilder::Finish() {
+  flushBlock();
+  myAssert(m_blocks > 0, format("[func-SSTableBuilder::Finish] empty table %s", m_path.c_str()));
+
+  std::string index;
+  EncodeSnapshotField(&index, m_smallest);
+  PutFixed32(&index, m_blocks);
+  index.append(m_index);
+  uint64_t indexOffset = m_offset;
+  uint32_t indexSize = static_cast<uint32_t>(index.size());
+  PutFixed32(&index, Crc32(index.data(), index.size()));
+  writeOut(index);
+
+  // k = bitsPerKey * ln2 时误判率最低
+  uint32_t hashes = std::max(1, std::min(30, SSTABLE_BLOOM_BITS_PER_KEY * 69 / 100));
+  size_t bits = std::max<size_t>(64, m_keyHashes.size() * SSTABLE_BLOOM_BITS_PER_KEY);
+  std::string bloom((bits + 7) / 8, '\0');
+  bits = bloom.size() * 8;
+  for (uint32_t h : m_keyHashes) {
+    uint32_t delta = (h >> 17) | (h << 15);
+    for (uint32_t i = 0; i < hashes; ++i) {
+      size_t bit = h % bits;
+      bloom[bit / 8] = static_cast<char>(bloom[bit / 8] | (1 << (bit % 8)));
+      h += delta;
+    }
+  }
+  uint64_t bloomOffset = m_offset;
+  uint32_t bloomSize = static_cast<uint32_t>(bloom.size());
+  PutFixed32(&bloom, Crc32(bloom.data(), bloom.size()));
+  writeOut(bloom);
+
+  std::string footer;
+  PutFixed64(&footer, indexOffset);
+  PutFixed32(&footer, indexSize);
+  PutFixed64(&footer, bloomOffset);
+  PutFixed32(&footer, bloomSize);
+  PutFixed32(&footer, hashes);
+  PutFixed64(&footer, m_entries);
+  footer.append(SSTABLE_MAGIC, sizeof(SSTABLE_MAGIC));
+  writeOut(footer);
+
+  if (m_ok && PERSIST_FSYNC && ::fdatasync(m_fd) != 0) {
+    DPrintf("[func-SSTableBuilder] fdatasync %s error: %s", m_path.c_str(), strerror(errno));
+    m_ok = false;
+  }
+  ::close(m_fd);
+  m_fd = -1;
+  if (!m_ok) {
+    ::unlink(m_path.c_str());
+  }
+  return m_ok;
+}
+
+void SSTableBuilder::Abandon() {
+  if (m_fd >= 0) {
+    ::close(m_fd);
+    m_fd = -1;
+  }
+  ::unlink(m_path.c_str());
+}
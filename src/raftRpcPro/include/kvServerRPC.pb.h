@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,8 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -44,46 +43,111 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_kvServerRPC_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[4]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kvServerRPC_2eproto;
 namespace raftKVRpcProctoc {
+class BatchGetArgs;
+struct BatchGetArgsDefaultTypeInternal;
+extern BatchGetArgsDefaultTypeInternal _BatchGetArgs_default_instance_;
+class BatchGetReply;
+struct BatchGetReplyDefaultTypeInternal;
+extern BatchGetReplyDefaultTypeInternal _BatchGetReply_default_instance_;
+class BatchOp;
+struct BatchOpDefaultTypeInternal;
+extern BatchOpDefaultTypeInternal _BatchOp_default_instance_;
+class BatchPutArgs;
+struct BatchPutArgsDefaultTypeInternal;
+extern BatchPutArgsDefaultTypeInternal _BatchPutArgs_default_instance_;
+class BatchPutReply;
+struct BatchPutReplyDefaultTypeInternal;
+extern BatchPutReplyDefaultTypeInternal _BatchPutReply_default_instance_;
+class ChangeMembershipArgs;
+struct ChangeMembershipArgsDefaultTypeInternal;
+extern ChangeMembershipArgsDefaultTypeInternal _ChangeMembershipArgs_default_instance_;
+class ChangeMembershipReply;
+struct ChangeMembershipReplyDefaultTypeInternal;
+extern ChangeMembershipReplyDefaultTypeInternal _ChangeMembershipReply_default_instance_;
 class GetArgs;
-class GetArgsDefaultTypeInternal;
+struct GetArgsDefaultTypeInternal;
 extern GetArgsDefaultTypeInternal _GetArgs_default_instance_;
+class GetRangesArgs;
+struct GetRangesArgsDefaultTypeInternal;
+extern GetRangesArgsDefaultTypeInternal _GetRangesArgs_default_instance_;
+class GetRangesReply;
+struct GetRangesReplyDefaultTypeInternal;
+extern GetRangesReplyDefaultTypeInternal _GetRangesReply_default_instance_;
 class GetReply;
-class GetReplyDefaultTypeInternal;
+struct GetReplyDefaultTypeInternal;
 extern GetReplyDefaultTypeInternal _GetReply_default_instance_;
+class KeyResult;
+struct KeyResultDefaultTypeInternal;
+extern KeyResultDefaultTypeInternal _KeyResult_default_instance_;
+class KeyValue;
+struct KeyValueDefaultTypeInternal;
+extern KeyValueDefaultTypeInternal _KeyValue_default_instance_;
 class PutAppendArgs;
-class PutAppendArgsDefaultTypeInternal;
+struct PutAppendArgsDefaultTypeInternal;
 extern PutAppendArgsDefaultTypeInternal _PutAppendArgs_default_instance_;
 class PutAppendReply;
-class PutAppendReplyDefaultTypeInternal;
+struct PutAppendReplyDefaultTypeInternal;
 extern PutAppendReplyDefaultTypeInternal _PutAppendReply_default_instance_;
+class RangeInfo;
+struct RangeInfoDefaultTypeInternal;
+extern RangeInfoDefaultTypeInternal _RangeInfo_default_instance_;
+class RegisterClientArgs;
+struct RegisterClientArgsDefaultTypeInternal;
+extern RegisterClientArgsDefaultTypeInternal _RegisterClientArgs_default_instance_;
+class RegisterClientReply;
+struct RegisterClientReplyDefaultTypeInternal;
+extern RegisterClientReplyDefaultTypeInternal _RegisterClientReply_default_instance_;
+class ScanArgs;
+struct ScanArgsDefaultTypeInternal;
+extern ScanArgsDefaultTypeInternal _ScanArgs_default_instance_;
+class ScanReply;
+struct ScanReplyDefaultTypeInternal;
+extern ScanReplyDefaultTypeInternal _ScanReply_default_instance_;
+class TransferLeaderArgs;
+struct TransferLeaderArgsDefaultTypeInternal;
+extern TransferLeaderArgsDefaultTypeInternal _TransferLeaderArgs_default_instance_;
+class TransferLeaderReply;
+struct TransferLeaderReplyDefaultTypeInternal;
+extern TransferLeaderReplyDefaultTypeInternal _TransferLeaderReply_default_instance_;
 }  // namespace raftKVRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
+template<> ::raftKVRpcProctoc::BatchGetArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::BatchGetArgs>(Arena*);
+template<> ::raftKVRpcProctoc::BatchGetReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::BatchGetReply>(Arena*);
+template<> ::raftKVRpcProctoc::BatchOp* Arena::CreateMaybeMessage<::raftKVRpcProctoc::BatchOp>(Arena*);
+template<> ::raftKVRpcProctoc::BatchPutArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::BatchPutArgs>(Arena*);
+template<> ::raftKVRpcProctoc::BatchPutReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::BatchPutReply>(Arena*);
+template<> ::raftKVRpcProctoc::ChangeMembershipArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ChangeMembershipArgs>(Arena*);
+template<> ::raftKVRpcProctoc::ChangeMembershipReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ChangeMembershipReply>(Arena*);
 template<> ::raftKVRpcProctoc::GetArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetArgs>(Arena*);
+template<> ::raftKVRpcProctoc::GetRangesArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetRangesArgs>(Arena*);
+template<> ::raftKVRpcProctoc::GetRangesReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetRangesReply>(Arena*);
 template<> ::raftKVRpcProctoc::GetReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::GetReply>(Arena*);
+template<> ::raftKVRpcProctoc::KeyResult* Arena::CreateMaybeMessage<::raftKVRpcProctoc::KeyResult>(Arena*);
+template<> ::raftKVRpcProctoc::KeyValue* Arena::CreateMaybeMessage<::raftKVRpcProctoc::KeyValue>(Arena*);
 template<> ::raftKVRpcProctoc::PutAppendArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutAppendArgs>(Arena*);
 template<> ::raftKVRpcProctoc::PutAppendReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::PutAppendReply>(Arena*);
+template<> ::raftKVRpcProctoc::RangeInfo* Arena::CreateMaybeMessage<::raftKVRpcProctoc::RangeInfo>(Arena*);
+template<> ::raftKVRpcProctoc::RegisterClientArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::RegisterClientArgs>(Arena*);
+template<> ::raftKVRpcProctoc::RegisterClientReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::RegisterClientReply>(Arena*);
+template<> ::raftKVRpcProctoc::ScanArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ScanArgs>(Arena*);
+template<> ::raftKVRpcProctoc::ScanReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::ScanReply>(Arena*);
+template<> ::raftKVRpcProctoc::TransferLeaderArgs* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TransferLeaderArgs>(Arena*);
+template<> ::raftKVRpcProctoc::TransferLeaderReply* Arena::CreateMaybeMessage<::raftKVRpcProctoc::TransferLeaderReply>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace raftKVRpcProctoc {
 
 // ===================================================================
 
-class GetArgs PROTOBUF_FINAL :
+class GetArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetArgs) */ {
  public:
-  inline GetArgs() : GetArgs(nullptr) {};
-  virtual ~GetArgs();
+  inline GetArgs() : GetArgs(nullptr) {}
+  ~GetArgs() override;
+  explicit PROTOBUF_CONSTEXPR GetArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetArgs(const GetArgs& from);
   GetArgs(GetArgs&& from) noexcept
@@ -96,8 +160,13 @@ class GetArgs PROTOBUF_FINAL :
     return *this;
   }
   inline GetArgs& operator=(GetArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -108,14 +177,14 @@ class GetArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetArgs* internal_default_instance() {
     return reinterpret_cast<const GetArgs*>(
                &_GetArgs_default_instance_);
@@ -128,7 +197,12 @@ class GetArgs PROTOBUF_FINAL :
   }
   inline void Swap(GetArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -136,56 +210,53 @@ class GetArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetArgs* New() const final {
-    return CreateMaybeMessage<GetArgs>(nullptr);
-  }
-
-  GetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetArgs& from);
-  void MergeFrom(const GetArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetArgs& from) {
+    GetArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.GetArgs";
   }
   protected:
-  explicit GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -195,64 +266,67 @@ class GetArgs PROTOBUF_FINAL :
     kKeyFieldNumber = 1,
     kClientIdFieldNumber = 2,
     kRequestIdFieldNumber = 3,
+    kFollowerReadFieldNumber = 4,
+    kMaxStalenessMsFieldNumber = 5,
+    kGroupIdFieldNumber = 6,
   };
   // bytes Key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
-  // bytes ClientId = 2;
+  // uint64 ClientId = 2;
   void clear_clientid();
-  const std::string& clientid() const;
-  void set_clientid(const std::string& value);
-  void set_clientid(std::string&& value);
-  void set_clientid(const char* value);
-  void set_clientid(const void* value, size_t size);
-  std::string* mutable_clientid();
-  std::string* release_clientid();
-  void set_allocated_clientid(std::string* clientid);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_clientid();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_clientid(
-      std::string* clientid);
-  private:
-  const std::string& _internal_clientid() const;
-  void _internal_set_clientid(const std::string& value);
-  std::string* _internal_mutable_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
   public:
 
   // int32 RequestId = 3;
   void clear_requestid();
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid() const;
-  void set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_requestid() const;
-  void _internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // bool FollowerRead = 4;
+  void clear_followerread();
+  bool followerread() const;
+  void set_followerread(bool value);
+  private:
+  bool _internal_followerread() const;
+  void _internal_set_followerread(bool value);
+  public:
+
+  // int32 MaxStalenessMs = 5;
+  void clear_maxstalenessms();
+  int32_t maxstalenessms() const;
+  void set_maxstalenessms(int32_t value);
+  private:
+  int32_t _internal_maxstalenessms() const;
+  void _internal_set_maxstalenessms(int32_t value);
+  public:
+
+  // int32 GroupId = 6;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.GetArgs)
@@ -262,19 +336,26 @@ class GetArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    bool followerread_;
+    int32_t maxstalenessms_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetReply PROTOBUF_FINAL :
+class GetReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetReply) */ {
  public:
-  inline GetReply() : GetReply(nullptr) {};
-  virtual ~GetReply();
+  inline GetReply() : GetReply(nullptr) {}
+  ~GetReply() override;
+  explicit PROTOBUF_CONSTEXPR GetReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetReply(const GetReply& from);
   GetReply(GetReply&& from) noexcept
@@ -287,8 +368,13 @@ class GetReply PROTOBUF_FINAL :
     return *this;
   }
   inline GetReply& operator=(GetReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -299,14 +385,14 @@ class GetReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetReply* internal_default_instance() {
     return reinterpret_cast<const GetReply*>(
                &_GetReply_default_instance_);
@@ -319,7 +405,12 @@ class GetReply PROTOBUF_FINAL :
   }
   inline void Swap(GetReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -327,56 +418,53 @@ class GetReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetReply* New() const final {
-    return CreateMaybeMessage<GetReply>(nullptr);
-  }
-
-  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetReply& from);
-  void MergeFrom(const GetReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetReply& from) {
+    GetReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.GetReply";
   }
   protected:
-  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -385,57 +473,55 @@ class GetReply PROTOBUF_FINAL :
   enum : int {
     kErrFieldNumber = 1,
     kValueFieldNumber = 2,
+    kLeaderIdFieldNumber = 3,
+    kLeaderTermFieldNumber = 4,
   };
   // bytes Err = 1;
   void clear_err();
   const std::string& err() const;
-  void set_err(const std::string& value);
-  void set_err(std::string&& value);
-  void set_err(const char* value);
-  void set_err(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
   std::string* mutable_err();
-  std::string* release_err();
+  PROTOBUF_NODISCARD std::string* release_err();
   void set_allocated_err(std::string* err);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_err();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_err(
-      std::string* err);
   private:
   const std::string& _internal_err() const;
-  void _internal_set_err(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
   std::string* _internal_mutable_err();
   public:
 
   // bytes Value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
+  // int32 LeaderId = 3;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 LeaderTerm = 4;
+  void clear_leaderterm();
+  int32_t leaderterm() const;
+  void set_leaderterm(int32_t value);
+  private:
+  int32_t _internal_leaderterm() const;
+  void _internal_set_leaderterm(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.GetReply)
  private:
   class _Internal;
@@ -443,18 +529,24 @@ class GetReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t leaderid_;
+    int32_t leaderterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutAppendArgs PROTOBUF_FINAL :
+class PutAppendArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutAppendArgs) */ {
  public:
-  inline PutAppendArgs() : PutAppendArgs(nullptr) {};
-  virtual ~PutAppendArgs();
+  inline PutAppendArgs() : PutAppendArgs(nullptr) {}
+  ~PutAppendArgs() override;
+  explicit PROTOBUF_CONSTEXPR PutAppendArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutAppendArgs(const PutAppendArgs& from);
   PutAppendArgs(PutAppendArgs&& from) noexcept
@@ -467,8 +559,13 @@ class PutAppendArgs PROTOBUF_FINAL :
     return *this;
   }
   inline PutAppendArgs& operator=(PutAppendArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -479,14 +576,14 @@ class PutAppendArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutAppendArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutAppendArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PutAppendArgs* internal_default_instance() {
     return reinterpret_cast<const PutAppendArgs*>(
                &_PutAppendArgs_default_instance_);
@@ -499,7 +596,12 @@ class PutAppendArgs PROTOBUF_FINAL :
   }
   inline void Swap(PutAppendArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -507,56 +609,53 @@ class PutAppendArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutAppendArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutAppendArgs* New() const final {
-    return CreateMaybeMessage<PutAppendArgs>(nullptr);
-  }
-
-  PutAppendArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutAppendArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutAppendArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutAppendArgs& from);
-  void MergeFrom(const PutAppendArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutAppendArgs& from) {
+    PutAppendArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutAppendArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.PutAppendArgs";
   }
   protected:
-  explicit PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -566,116 +665,112 @@ class PutAppendArgs PROTOBUF_FINAL :
     kKeyFieldNumber = 1,
     kValueFieldNumber = 2,
     kOpFieldNumber = 3,
+    kExpectedFieldNumber = 7,
     kClientIdFieldNumber = 4,
     kRequestIdFieldNumber = 5,
+    kGroupIdFieldNumber = 6,
+    kDeltaFieldNumber = 9,
+    kExpectAbsentFieldNumber = 8,
   };
   // bytes Key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // bytes Value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
   // bytes Op = 3;
   void clear_op();
   const std::string& op() const;
-  void set_op(const std::string& value);
-  void set_op(std::string&& value);
-  void set_op(const char* value);
-  void set_op(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
   std::string* mutable_op();
-  std::string* release_op();
+  PROTOBUF_NODISCARD std::string* release_op();
   void set_allocated_op(std::string* op);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_op();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_op(
-      std::string* op);
   private:
   const std::string& _internal_op() const;
-  void _internal_set_op(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
   std::string* _internal_mutable_op();
   public:
 
-  // bytes ClientId = 4;
+  // bytes Expected = 7;
+  void clear_expected();
+  const std::string& expected() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_expected(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_expected();
+  PROTOBUF_NODISCARD std::string* release_expected();
+  void set_allocated_expected(std::string* expected);
+  private:
+  const std::string& _internal_expected() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_expected(const std::string& value);
+  std::string* _internal_mutable_expected();
+  public:
+
+  // uint64 ClientId = 4;
   void clear_clientid();
-  const std::string& clientid() const;
-  void set_clientid(const std::string& value);
-  void set_clientid(std::string&& value);
-  void set_clientid(const char* value);
-  void set_clientid(const void* value, size_t size);
-  std::string* mutable_clientid();
-  std::string* release_clientid();
-  void set_allocated_clientid(std::string* clientid);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_clientid();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_clientid(
-      std::string* clientid);
-  private:
-  const std::string& _internal_clientid() const;
-  void _internal_set_clientid(const std::string& value);
-  std::string* _internal_mutable_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
   public:
 
   // int32 RequestId = 5;
   void clear_requestid();
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid() const;
-  void set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // int32 GroupId = 6;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // int64 Delta = 9;
+  void clear_delta();
+  int64_t delta() const;
+  void set_delta(int64_t value);
+  private:
+  int64_t _internal_delta() const;
+  void _internal_set_delta(int64_t value);
+  public:
+
+  // bool ExpectAbsent = 8;
+  void clear_expectabsent();
+  bool expectabsent() const;
+  void set_expectabsent(bool value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_requestid() const;
-  void _internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  bool _internal_expectabsent() const;
+  void _internal_set_expectabsent(bool value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.PutAppendArgs)
@@ -685,21 +780,29 @@ class PutAppendArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 requestid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr expected_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    int32_t groupid_;
+    int64_t delta_;
+    bool expectabsent_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutAppendReply PROTOBUF_FINAL :
+class PutAppendReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.PutAppendReply) */ {
  public:
-  inline PutAppendReply() : PutAppendReply(nullptr) {};
-  virtual ~PutAppendReply();
+  inline PutAppendReply() : PutAppendReply(nullptr) {}
+  ~PutAppendReply() override;
+  explicit PROTOBUF_CONSTEXPR PutAppendReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutAppendReply(const PutAppendReply& from);
   PutAppendReply(PutAppendReply&& from) noexcept
@@ -712,8 +815,13 @@ class PutAppendReply PROTOBUF_FINAL :
     return *this;
   }
   inline PutAppendReply& operator=(PutAppendReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -724,14 +832,14 @@ class PutAppendReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutAppendReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutAppendReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PutAppendReply* internal_default_instance() {
     return reinterpret_cast<const PutAppendReply*>(
                &_PutAppendReply_default_instance_);
@@ -744,7 +852,12 @@ class PutAppendReply PROTOBUF_FINAL :
   }
   inline void Swap(PutAppendReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -752,56 +865,53 @@ class PutAppendReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutAppendReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutAppendReply* New() const final {
-    return CreateMaybeMessage<PutAppendReply>(nullptr);
-  }
-
-  PutAppendReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutAppendReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutAppendReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutAppendReply& from);
-  void MergeFrom(const PutAppendReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutAppendReply& from) {
+    PutAppendReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutAppendReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftKVRpcProctoc.PutAppendReply";
   }
   protected:
-  explicit PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kvServerRPC_2eproto);
-    return ::descriptor_table_kvServerRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -809,32 +919,56 @@ class PutAppendReply PROTOBUF_FINAL :
 
   enum : int {
     kErrFieldNumber = 1,
+    kValueFieldNumber = 4,
+    kLeaderIdFieldNumber = 2,
+    kLeaderTermFieldNumber = 3,
   };
   // bytes Err = 1;
   void clear_err();
   const std::string& err() const;
-  void set_err(const std::string& value);
-  void set_err(std::string&& value);
-  void set_err(const char* value);
-  void set_err(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
   std::string* mutable_err();
-  std::string* release_err();
+  PROTOBUF_NODISCARD std::string* release_err();
   void set_allocated_err(std::string* err);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_err();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_err(
-      std::string* err);
   private:
   const std::string& _internal_err() const;
-  void _internal_set_err(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
   std::string* _internal_mutable_err();
   public:
 
+  // bytes Value = 4;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int32 LeaderId = 2;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 LeaderTerm = 3;
+  void clear_leaderterm();
+  int32_t leaderterm() const;
+  void set_leaderterm(int32_t value);
+  private:
+  int32_t _internal_leaderterm() const;
+  void _internal_set_leaderterm(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.PutAppendReply)
  private:
   class _Internal;
@@ -842,867 +976,6260 @@ class PutAppendReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t leaderid_;
+    int32_t leaderterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kvServerRPC_2eproto;
 };
-// ===================================================================
-
-class kvServerRpc_Stub;
+// -------------------------------------------------------------------
 
-class kvServerRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
- protected:
-  // This class should be treated as an abstract interface.
-  inline kvServerRpc() {};
+class KeyValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.KeyValue) */ {
  public:
-  virtual ~kvServerRpc();
+  inline KeyValue() : KeyValue(nullptr) {}
+  ~KeyValue() override;
+  explicit PROTOBUF_CONSTEXPR KeyValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  typedef kvServerRpc_Stub Stub;
+  KeyValue(const KeyValue& from);
+  KeyValue(KeyValue&& from) noexcept
+    : KeyValue() {
+    *this = ::std::move(from);
+  }
 
-  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+  inline KeyValue& operator=(const KeyValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeyValue& operator=(KeyValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  virtual void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::PutAppendArgs* request,
-                       ::raftKVRpcProctoc::PutAppendReply* response,
-                       ::google::protobuf::Closure* done);
-  virtual void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::GetArgs* request,
-                       ::raftKVRpcProctoc::GetReply* response,
-                       ::google::protobuf::Closure* done);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeyValue* internal_default_instance() {
+    return reinterpret_cast<const KeyValue*>(
+               &_KeyValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  // implements Service ----------------------------------------------
+  friend void swap(KeyValue& a, KeyValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeyValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
-                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
-                  ::PROTOBUF_NAMESPACE_ID::Message* response,
-                  ::google::protobuf::Closure* done);
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  // implements Message ----------------------------------------------
 
- private:
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc);
-};
+  KeyValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeyValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeyValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyValue& from) {
+    KeyValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-class kvServerRpc_Stub : public kvServerRpc {
- public:
-  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
-  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
-                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
-  ~kvServerRpc_Stub();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeyValue* other);
 
-  // implements kvServerRpc ------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.KeyValue";
+  }
+  protected:
+  explicit KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::PutAppendArgs* request,
-                       ::raftKVRpcProctoc::PutAppendReply* response,
-                       ::google::protobuf::Closure* done);
-  void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftKVRpcProctoc::GetArgs* request,
-                       ::raftKVRpcProctoc::GetReply* response,
-                       ::google::protobuf::Closure* done);
- private:
-  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
-  bool owns_channel_;
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc_Stub);
-};
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-// ===================================================================
+  // nested types ----------------------------------------------------
 
+  // accessors -------------------------------------------------------
 
-// ===================================================================
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// GetArgs
+  // bytes Value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
 
-// bytes Key = 1;
-inline void GetArgs::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& GetArgs::key() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.Key)
-  return _internal_key();
-}
-inline void GetArgs::set_key(const std::string& value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.Key)
-}
-inline std::string* GetArgs::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.Key)
-  return _internal_mutable_key();
-}
-inline const std::string& GetArgs::_internal_key() const {
-  return key_.Get();
-}
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.KeyValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScanArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ScanArgs) */ {
+ public:
+  inline ScanArgs() : ScanArgs(nullptr) {}
+  ~ScanArgs() override;
+  explicit PROTOBUF_CONSTEXPR ScanArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScanArgs(const ScanArgs& from);
+  ScanArgs(ScanArgs&& from) noexcept
+    : ScanArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline ScanArgs& operator=(const ScanArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScanArgs& operator=(ScanArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanArgs* internal_default_instance() {
+    return reinterpret_cast<const ScanArgs*>(
+               &_ScanArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ScanArgs& a, ScanArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScanArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanArgs& from) {
+    ScanArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ScanArgs";
+  }
+  protected:
+  explicit ScanArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartKeyFieldNumber = 1,
+    kEndKeyFieldNumber = 2,
+    kPrefixFieldNumber = 3,
+    kPageTokenFieldNumber = 5,
+    kLimitFieldNumber = 4,
+    kRequestIdFieldNumber = 7,
+    kClientIdFieldNumber = 6,
+    kGroupIdFieldNumber = 8,
+  };
+  // bytes StartKey = 1;
+  void clear_startkey();
+  const std::string& startkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_startkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_startkey();
+  PROTOBUF_NODISCARD std::string* release_startkey();
+  void set_allocated_startkey(std::string* startkey);
+  private:
+  const std::string& _internal_startkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_startkey(const std::string& value);
+  std::string* _internal_mutable_startkey();
+  public:
+
+  // bytes EndKey = 2;
+  void clear_endkey();
+  const std::string& endkey() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endkey(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endkey();
+  PROTOBUF_NODISCARD std::string* release_endkey();
+  void set_allocated_endkey(std::string* endkey);
+  private:
+  const std::string& _internal_endkey() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endkey(const std::string& value);
+  std::string* _internal_mutable_endkey();
+  public:
+
+  // bytes Prefix = 3;
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
+  private:
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
+  public:
+
+  // bytes PageToken = 5;
+  void clear_pagetoken();
+  const std::string& pagetoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pagetoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pagetoken();
+  PROTOBUF_NODISCARD std::string* release_pagetoken();
+  void set_allocated_pagetoken(std::string* pagetoken);
+  private:
+  const std::string& _internal_pagetoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pagetoken(const std::string& value);
+  std::string* _internal_mutable_pagetoken();
+  public:
+
+  // int32 Limit = 4;
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // int32 RequestId = 7;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // uint64 ClientId = 6;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 GroupId = 8;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ScanArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr startkey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endkey_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pagetoken_;
+    int32_t limit_;
+    int32_t requestid_;
+    uint64_t clientid_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScanReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ScanReply) */ {
+ public:
+  inline ScanReply() : ScanReply(nullptr) {}
+  ~ScanReply() override;
+  explicit PROTOBUF_CONSTEXPR ScanReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScanReply(const ScanReply& from);
+  ScanReply(ScanReply&& from) noexcept
+    : ScanReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ScanReply& operator=(const ScanReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScanReply& operator=(ScanReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanReply* internal_default_instance() {
+    return reinterpret_cast<const ScanReply*>(
+               &_ScanReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ScanReply& a, ScanReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScanReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanReply& from) {
+    ScanReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ScanReply";
+  }
+  protected:
+  explicit ScanReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKvsFieldNumber = 2,
+    kErrFieldNumber = 1,
+    kNextPageTokenFieldNumber = 3,
+    kRangeEndFieldNumber = 6,
+    kLeaderIdFieldNumber = 4,
+    kLeaderTermFieldNumber = 5,
+  };
+  // repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+  int kvs_size() const;
+  private:
+  int _internal_kvs_size() const;
+  public:
+  void clear_kvs();
+  ::raftKVRpcProctoc::KeyValue* mutable_kvs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >*
+      mutable_kvs();
+  private:
+  const ::raftKVRpcProctoc::KeyValue& _internal_kvs(int index) const;
+  ::raftKVRpcProctoc::KeyValue* _internal_add_kvs();
+  public:
+  const ::raftKVRpcProctoc::KeyValue& kvs(int index) const;
+  ::raftKVRpcProctoc::KeyValue* add_kvs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >&
+      kvs() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bytes NextPageToken = 3;
+  void clear_nextpagetoken();
+  const std::string& nextpagetoken() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nextpagetoken(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nextpagetoken();
+  PROTOBUF_NODISCARD std::string* release_nextpagetoken();
+  void set_allocated_nextpagetoken(std::string* nextpagetoken);
+  private:
+  const std::string& _internal_nextpagetoken() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nextpagetoken(const std::string& value);
+  std::string* _internal_mutable_nextpagetoken();
+  public:
+
+  // bytes RangeEnd = 6;
+  void clear_rangeend();
+  const std::string& rangeend() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rangeend(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rangeend();
+  PROTOBUF_NODISCARD std::string* release_rangeend();
+  void set_allocated_rangeend(std::string* rangeend);
+  private:
+  const std::string& _internal_rangeend() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rangeend(const std::string& value);
+  std::string* _internal_mutable_rangeend();
+  public:
+
+  // int32 LeaderId = 4;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 LeaderTerm = 5;
+  void clear_leaderterm();
+  int32_t leaderterm() const;
+  void set_leaderterm(int32_t value);
+  private:
+  int32_t _internal_leaderterm() const;
+  void _internal_set_leaderterm(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ScanReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue > kvs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nextpagetoken_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rangeend_;
+    int32_t leaderid_;
+    int32_t leaderterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.BatchOp) */ {
+ public:
+  inline BatchOp() : BatchOp(nullptr) {}
+  ~BatchOp() override;
+  explicit PROTOBUF_CONSTEXPR BatchOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchOp(const BatchOp& from);
+  BatchOp(BatchOp&& from) noexcept
+    : BatchOp() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchOp& operator=(const BatchOp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchOp& operator=(BatchOp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchOp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchOp* internal_default_instance() {
+    return reinterpret_cast<const BatchOp*>(
+               &_BatchOp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(BatchOp& a, BatchOp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchOp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchOp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchOp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchOp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchOp& from) {
+    BatchOp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchOp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.BatchOp";
+  }
+  protected:
+  explicit BatchOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kOpFieldNumber = 3,
+  };
+  // bytes Key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes Value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // bytes Op = 3;
+  void clear_op();
+  const std::string& op() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_op();
+  PROTOBUF_NODISCARD std::string* release_op();
+  void set_allocated_op(std::string* op);
+  private:
+  const std::string& _internal_op() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
+  std::string* _internal_mutable_op();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.BatchOp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchPutArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.BatchPutArgs) */ {
+ public:
+  inline BatchPutArgs() : BatchPutArgs(nullptr) {}
+  ~BatchPutArgs() override;
+  explicit PROTOBUF_CONSTEXPR BatchPutArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchPutArgs(const BatchPutArgs& from);
+  BatchPutArgs(BatchPutArgs&& from) noexcept
+    : BatchPutArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchPutArgs& operator=(const BatchPutArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchPutArgs& operator=(BatchPutArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchPutArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchPutArgs* internal_default_instance() {
+    return reinterpret_cast<const BatchPutArgs*>(
+               &_BatchPutArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(BatchPutArgs& a, BatchPutArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchPutArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchPutArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchPutArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchPutArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchPutArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchPutArgs& from) {
+    BatchPutArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchPutArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.BatchPutArgs";
+  }
+  protected:
+  explicit BatchPutArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpsFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+    kRequestIdFieldNumber = 3,
+    kGroupIdFieldNumber = 4,
+  };
+  // repeated .raftKVRpcProctoc.BatchOp Ops = 1;
+  int ops_size() const;
+  private:
+  int _internal_ops_size() const;
+  public:
+  void clear_ops();
+  ::raftKVRpcProctoc::BatchOp* mutable_ops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::BatchOp >*
+      mutable_ops();
+  private:
+  const ::raftKVRpcProctoc::BatchOp& _internal_ops(int index) const;
+  ::raftKVRpcProctoc::BatchOp* _internal_add_ops();
+  public:
+  const ::raftKVRpcProctoc::BatchOp& ops(int index) const;
+  ::raftKVRpcProctoc::BatchOp* add_ops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::BatchOp >&
+      ops() const;
+
+  // uint64 ClientId = 2;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 RequestId = 3;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // int32 GroupId = 4;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.BatchPutArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::BatchOp > ops_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchPutReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.BatchPutReply) */ {
+ public:
+  inline BatchPutReply() : BatchPutReply(nullptr) {}
+  ~BatchPutReply() override;
+  explicit PROTOBUF_CONSTEXPR BatchPutReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchPutReply(const BatchPutReply& from);
+  BatchPutReply(BatchPutReply&& from) noexcept
+    : BatchPutReply() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchPutReply& operator=(const BatchPutReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchPutReply& operator=(BatchPutReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchPutReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchPutReply* internal_default_instance() {
+    return reinterpret_cast<const BatchPutReply*>(
+               &_BatchPutReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(BatchPutReply& a, BatchPutReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchPutReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchPutReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchPutReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchPutReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchPutReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchPutReply& from) {
+    BatchPutReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchPutReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.BatchPutReply";
+  }
+  protected:
+  explicit BatchPutReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+    kLeaderTermFieldNumber = 3,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int32 LeaderId = 2;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 LeaderTerm = 3;
+  void clear_leaderterm();
+  int32_t leaderterm() const;
+  void set_leaderterm(int32_t value);
+  private:
+  int32_t _internal_leaderterm() const;
+  void _internal_set_leaderterm(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.BatchPutReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int32_t leaderid_;
+    int32_t leaderterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchGetArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.BatchGetArgs) */ {
+ public:
+  inline BatchGetArgs() : BatchGetArgs(nullptr) {}
+  ~BatchGetArgs() override;
+  explicit PROTOBUF_CONSTEXPR BatchGetArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchGetArgs(const BatchGetArgs& from);
+  BatchGetArgs(BatchGetArgs&& from) noexcept
+    : BatchGetArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchGetArgs& operator=(const BatchGetArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchGetArgs& operator=(BatchGetArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchGetArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchGetArgs* internal_default_instance() {
+    return reinterpret_cast<const BatchGetArgs*>(
+               &_BatchGetArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(BatchGetArgs& a, BatchGetArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchGetArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchGetArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchGetArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchGetArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchGetArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchGetArgs& from) {
+    BatchGetArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchGetArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.BatchGetArgs";
+  }
+  protected:
+  explicit BatchGetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+    kRequestIdFieldNumber = 3,
+    kGroupIdFieldNumber = 4,
+  };
+  // repeated bytes Keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const void* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // uint64 ClientId = 2;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 RequestId = 3;
+  void clear_requestid();
+  int32_t requestid() const;
+  void set_requestid(int32_t value);
+  private:
+  int32_t _internal_requestid() const;
+  void _internal_set_requestid(int32_t value);
+  public:
+
+  // int32 GroupId = 4;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.BatchGetArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    uint64_t clientid_;
+    int32_t requestid_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeyResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.KeyResult) */ {
+ public:
+  inline KeyResult() : KeyResult(nullptr) {}
+  ~KeyResult() override;
+  explicit PROTOBUF_CONSTEXPR KeyResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeyResult(const KeyResult& from);
+  KeyResult(KeyResult&& from) noexcept
+    : KeyResult() {
+    *this = ::std::move(from);
+  }
+
+  inline KeyResult& operator=(const KeyResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeyResult& operator=(KeyResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeyResult* internal_default_instance() {
+    return reinterpret_cast<const KeyResult*>(
+               &_KeyResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(KeyResult& a, KeyResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeyResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeyResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeyResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeyResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyResult& from) {
+    KeyResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeyResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.KeyResult";
+  }
+  protected:
+  explicit KeyResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // bytes Value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.KeyResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchGetReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.BatchGetReply) */ {
+ public:
+  inline BatchGetReply() : BatchGetReply(nullptr) {}
+  ~BatchGetReply() override;
+  explicit PROTOBUF_CONSTEXPR BatchGetReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchGetReply(const BatchGetReply& from);
+  BatchGetReply(BatchGetReply&& from) noexcept
+    : BatchGetReply() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchGetReply& operator=(const BatchGetReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchGetReply& operator=(BatchGetReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchGetReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchGetReply* internal_default_instance() {
+    return reinterpret_cast<const BatchGetReply*>(
+               &_BatchGetReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(BatchGetReply& a, BatchGetReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchGetReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchGetReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchGetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchGetReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchGetReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchGetReply& from) {
+    BatchGetReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchGetReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.BatchGetReply";
+  }
+  protected:
+  explicit BatchGetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 2,
+    kErrFieldNumber = 1,
+    kLeaderIdFieldNumber = 3,
+    kLeaderTermFieldNumber = 4,
+  };
+  // repeated .raftKVRpcProctoc.KeyResult Results = 2;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::raftKVRpcProctoc::KeyResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyResult >*
+      mutable_results();
+  private:
+  const ::raftKVRpcProctoc::KeyResult& _internal_results(int index) const;
+  ::raftKVRpcProctoc::KeyResult* _internal_add_results();
+  public:
+  const ::raftKVRpcProctoc::KeyResult& results(int index) const;
+  ::raftKVRpcProctoc::KeyResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyResult >&
+      results() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int32 LeaderId = 3;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 LeaderTerm = 4;
+  void clear_leaderterm();
+  int32_t leaderterm() const;
+  void set_leaderterm(int32_t value);
+  private:
+  int32_t _internal_leaderterm() const;
+  void _internal_set_leaderterm(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.BatchGetReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyResult > results_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int32_t leaderid_;
+    int32_t leaderterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterClientArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.RegisterClientArgs) */ {
+ public:
+  inline RegisterClientArgs() : RegisterClientArgs(nullptr) {}
+  ~RegisterClientArgs() override;
+  explicit PROTOBUF_CONSTEXPR RegisterClientArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterClientArgs(const RegisterClientArgs& from);
+  RegisterClientArgs(RegisterClientArgs&& from) noexcept
+    : RegisterClientArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterClientArgs& operator=(const RegisterClientArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterClientArgs& operator=(RegisterClientArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterClientArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterClientArgs* internal_default_instance() {
+    return reinterpret_cast<const RegisterClientArgs*>(
+               &_RegisterClientArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(RegisterClientArgs& a, RegisterClientArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterClientArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterClientArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterClientArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterClientArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterClientArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterClientArgs& from) {
+    RegisterClientArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterClientArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.RegisterClientArgs";
+  }
+  protected:
+  explicit RegisterClientArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGroupIdFieldNumber = 1,
+  };
+  // int32 GroupId = 1;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.RegisterClientArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterClientReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.RegisterClientReply) */ {
+ public:
+  inline RegisterClientReply() : RegisterClientReply(nullptr) {}
+  ~RegisterClientReply() override;
+  explicit PROTOBUF_CONSTEXPR RegisterClientReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterClientReply(const RegisterClientReply& from);
+  RegisterClientReply(RegisterClientReply&& from) noexcept
+    : RegisterClientReply() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterClientReply& operator=(const RegisterClientReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterClientReply& operator=(RegisterClientReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterClientReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterClientReply* internal_default_instance() {
+    return reinterpret_cast<const RegisterClientReply*>(
+               &_RegisterClientReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(RegisterClientReply& a, RegisterClientReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterClientReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterClientReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterClientReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterClientReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterClientReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterClientReply& from) {
+    RegisterClientReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterClientReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.RegisterClientReply";
+  }
+  protected:
+  explicit RegisterClientReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kClientIdFieldNumber = 2,
+    kLeaderIdFieldNumber = 3,
+    kLeaderTermFieldNumber = 4,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // uint64 ClientId = 2;
+  void clear_clientid();
+  uint64_t clientid() const;
+  void set_clientid(uint64_t value);
+  private:
+  uint64_t _internal_clientid() const;
+  void _internal_set_clientid(uint64_t value);
+  public:
+
+  // int32 LeaderId = 3;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 LeaderTerm = 4;
+  void clear_leaderterm();
+  int32_t leaderterm() const;
+  void set_leaderterm(int32_t value);
+  private:
+  int32_t _internal_leaderterm() const;
+  void _internal_set_leaderterm(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.RegisterClientReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    uint64_t clientid_;
+    int32_t leaderid_;
+    int32_t leaderterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetRangesArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetRangesArgs) */ {
+ public:
+  inline GetRangesArgs() : GetRangesArgs(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR GetRangesArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetRangesArgs(const GetRangesArgs& from);
+  GetRangesArgs(GetRangesArgs&& from) noexcept
+    : GetRangesArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline GetRangesArgs& operator=(const GetRangesArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetRangesArgs& operator=(GetRangesArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetRangesArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetRangesArgs* internal_default_instance() {
+    return reinterpret_cast<const GetRangesArgs*>(
+               &_GetRangesArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(GetRangesArgs& a, GetRangesArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetRangesArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetRangesArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetRangesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetRangesArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const GetRangesArgs& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const GetRangesArgs& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.GetRangesArgs";
+  }
+  protected:
+  explicit GetRangesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.GetRangesArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RangeInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.RangeInfo) */ {
+ public:
+  inline RangeInfo() : RangeInfo(nullptr) {}
+  ~RangeInfo() override;
+  explicit PROTOBUF_CONSTEXPR RangeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RangeInfo(const RangeInfo& from);
+  RangeInfo(RangeInfo&& from) noexcept
+    : RangeInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline RangeInfo& operator=(const RangeInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RangeInfo& operator=(RangeInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RangeInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RangeInfo* internal_default_instance() {
+    return reinterpret_cast<const RangeInfo*>(
+               &_RangeInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(RangeInfo& a, RangeInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RangeInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RangeInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RangeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RangeInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RangeInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RangeInfo& from) {
+    RangeInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RangeInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.RangeInfo";
+  }
+  protected:
+  explicit RangeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartFieldNumber = 2,
+    kEndFieldNumber = 3,
+    kGroupIdFieldNumber = 1,
+  };
+  // bytes Start = 2;
+  void clear_start();
+  const std::string& start() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_start(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_start();
+  PROTOBUF_NODISCARD std::string* release_start();
+  void set_allocated_start(std::string* start);
+  private:
+  const std::string& _internal_start() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start(const std::string& value);
+  std::string* _internal_mutable_start();
+  public:
+
+  // bytes End = 3;
+  void clear_end();
+  const std::string& end() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_end(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_end();
+  PROTOBUF_NODISCARD std::string* release_end();
+  void set_allocated_end(std::string* end);
+  private:
+  const std::string& _internal_end() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end(const std::string& value);
+  std::string* _internal_mutable_end();
+  public:
+
+  // int32 GroupId = 1;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.RangeInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetRangesReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.GetRangesReply) */ {
+ public:
+  inline GetRangesReply() : GetRangesReply(nullptr) {}
+  ~GetRangesReply() override;
+  explicit PROTOBUF_CONSTEXPR GetRangesReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetRangesReply(const GetRangesReply& from);
+  GetRangesReply(GetRangesReply&& from) noexcept
+    : GetRangesReply() {
+    *this = ::std::move(from);
+  }
+
+  inline GetRangesReply& operator=(const GetRangesReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetRangesReply& operator=(GetRangesReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetRangesReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetRangesReply* internal_default_instance() {
+    return reinterpret_cast<const GetRangesReply*>(
+               &_GetRangesReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(GetRangesReply& a, GetRangesReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetRangesReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetRangesReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetRangesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetRangesReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetRangesReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetRangesReply& from) {
+    GetRangesReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetRangesReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.GetRangesReply";
+  }
+  protected:
+  explicit GetRangesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRangesFieldNumber = 3,
+    kErrFieldNumber = 1,
+    kGroupsFieldNumber = 2,
+  };
+  // repeated .raftKVRpcProctoc.RangeInfo Ranges = 3;
+  int ranges_size() const;
+  private:
+  int _internal_ranges_size() const;
+  public:
+  void clear_ranges();
+  ::raftKVRpcProctoc::RangeInfo* mutable_ranges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::RangeInfo >*
+      mutable_ranges();
+  private:
+  const ::raftKVRpcProctoc::RangeInfo& _internal_ranges(int index) const;
+  ::raftKVRpcProctoc::RangeInfo* _internal_add_ranges();
+  public:
+  const ::raftKVRpcProctoc::RangeInfo& ranges(int index) const;
+  ::raftKVRpcProctoc::RangeInfo* add_ranges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::RangeInfo >&
+      ranges() const;
+
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int32 Groups = 2;
+  void clear_groups();
+  int32_t groups() const;
+  void set_groups(int32_t value);
+  private:
+  int32_t _internal_groups() const;
+  void _internal_set_groups(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.GetRangesReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::RangeInfo > ranges_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int32_t groups_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferLeaderArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TransferLeaderArgs) */ {
+ public:
+  inline TransferLeaderArgs() : TransferLeaderArgs(nullptr) {}
+  ~TransferLeaderArgs() override;
+  explicit PROTOBUF_CONSTEXPR TransferLeaderArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferLeaderArgs(const TransferLeaderArgs& from);
+  TransferLeaderArgs(TransferLeaderArgs&& from) noexcept
+    : TransferLeaderArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferLeaderArgs& operator=(const TransferLeaderArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferLeaderArgs& operator=(TransferLeaderArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferLeaderArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferLeaderArgs* internal_default_instance() {
+    return reinterpret_cast<const TransferLeaderArgs*>(
+               &_TransferLeaderArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(TransferLeaderArgs& a, TransferLeaderArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferLeaderArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferLeaderArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferLeaderArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferLeaderArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferLeaderArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferLeaderArgs& from) {
+    TransferLeaderArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferLeaderArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TransferLeaderArgs";
+  }
+  protected:
+  explicit TransferLeaderArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGroupIdFieldNumber = 1,
+    kTargetFieldNumber = 2,
+  };
+  // int32 GroupId = 1;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // int32 Target = 2;
+  void clear_target();
+  int32_t target() const;
+  void set_target(int32_t value);
+  private:
+  int32_t _internal_target() const;
+  void _internal_set_target(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TransferLeaderArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t groupid_;
+    int32_t target_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferLeaderReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.TransferLeaderReply) */ {
+ public:
+  inline TransferLeaderReply() : TransferLeaderReply(nullptr) {}
+  ~TransferLeaderReply() override;
+  explicit PROTOBUF_CONSTEXPR TransferLeaderReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferLeaderReply(const TransferLeaderReply& from);
+  TransferLeaderReply(TransferLeaderReply&& from) noexcept
+    : TransferLeaderReply() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferLeaderReply& operator=(const TransferLeaderReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferLeaderReply& operator=(TransferLeaderReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferLeaderReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferLeaderReply* internal_default_instance() {
+    return reinterpret_cast<const TransferLeaderReply*>(
+               &_TransferLeaderReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(TransferLeaderReply& a, TransferLeaderReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferLeaderReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferLeaderReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferLeaderReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferLeaderReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferLeaderReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferLeaderReply& from) {
+    TransferLeaderReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferLeaderReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.TransferLeaderReply";
+  }
+  protected:
+  explicit TransferLeaderReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+    kLeaderTermFieldNumber = 3,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int32 LeaderId = 2;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 LeaderTerm = 3;
+  void clear_leaderterm();
+  int32_t leaderterm() const;
+  void set_leaderterm(int32_t value);
+  private:
+  int32_t _internal_leaderterm() const;
+  void _internal_set_leaderterm(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.TransferLeaderReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int32_t leaderid_;
+    int32_t leaderterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangeMembershipArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ChangeMembershipArgs) */ {
+ public:
+  inline ChangeMembershipArgs() : ChangeMembershipArgs(nullptr) {}
+  ~ChangeMembershipArgs() override;
+  explicit PROTOBUF_CONSTEXPR ChangeMembershipArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangeMembershipArgs(const ChangeMembershipArgs& from);
+  ChangeMembershipArgs(ChangeMembershipArgs&& from) noexcept
+    : ChangeMembershipArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangeMembershipArgs& operator=(const ChangeMembershipArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangeMembershipArgs& operator=(ChangeMembershipArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangeMembershipArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangeMembershipArgs* internal_default_instance() {
+    return reinterpret_cast<const ChangeMembershipArgs*>(
+               &_ChangeMembershipArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(ChangeMembershipArgs& a, ChangeMembershipArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangeMembershipArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangeMembershipArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangeMembershipArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangeMembershipArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangeMembershipArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangeMembershipArgs& from) {
+    ChangeMembershipArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangeMembershipArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ChangeMembershipArgs";
+  }
+  protected:
+  explicit ChangeMembershipArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIpFieldNumber = 4,
+    kGroupIdFieldNumber = 1,
+    kKindFieldNumber = 2,
+    kNodeIdFieldNumber = 3,
+    kPortFieldNumber = 5,
+  };
+  // bytes Ip = 4;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // int32 GroupId = 1;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // int32 Kind = 2;
+  void clear_kind();
+  int32_t kind() const;
+  void set_kind(int32_t value);
+  private:
+  int32_t _internal_kind() const;
+  void _internal_set_kind(int32_t value);
+  public:
+
+  // int32 NodeId = 3;
+  void clear_nodeid();
+  int32_t nodeid() const;
+  void set_nodeid(int32_t value);
+  private:
+  int32_t _internal_nodeid() const;
+  void _internal_set_nodeid(int32_t value);
+  public:
+
+  // int32 Port = 5;
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ChangeMembershipArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t groupid_;
+    int32_t kind_;
+    int32_t nodeid_;
+    int32_t port_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangeMembershipReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftKVRpcProctoc.ChangeMembershipReply) */ {
+ public:
+  inline ChangeMembershipReply() : ChangeMembershipReply(nullptr) {}
+  ~ChangeMembershipReply() override;
+  explicit PROTOBUF_CONSTEXPR ChangeMembershipReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangeMembershipReply(const ChangeMembershipReply& from);
+  ChangeMembershipReply(ChangeMembershipReply&& from) noexcept
+    : ChangeMembershipReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangeMembershipReply& operator=(const ChangeMembershipReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangeMembershipReply& operator=(ChangeMembershipReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangeMembershipReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangeMembershipReply* internal_default_instance() {
+    return reinterpret_cast<const ChangeMembershipReply*>(
+               &_ChangeMembershipReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(ChangeMembershipReply& a, ChangeMembershipReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangeMembershipReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangeMembershipReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangeMembershipReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangeMembershipReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangeMembershipReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangeMembershipReply& from) {
+    ChangeMembershipReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangeMembershipReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftKVRpcProctoc.ChangeMembershipReply";
+  }
+  protected:
+  explicit ChangeMembershipReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+    kLeaderTermFieldNumber = 3,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int32 LeaderId = 2;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 LeaderTerm = 3;
+  void clear_leaderterm();
+  int32_t leaderterm() const;
+  void set_leaderterm(int32_t value);
+  private:
+  int32_t _internal_leaderterm() const;
+  void _internal_set_leaderterm(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftKVRpcProctoc.ChangeMembershipReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int32_t leaderid_;
+    int32_t leaderterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvServerRPC_2eproto;
+};
+// ===================================================================
+
+class kvServerRpc_Stub;
+
+class kvServerRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline kvServerRpc() {};
+ public:
+  virtual ~kvServerRpc();
+
+  typedef kvServerRpc_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutAppendArgs* request,
+                       ::raftKVRpcProctoc::PutAppendReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetArgs* request,
+                       ::raftKVRpcProctoc::GetReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ScanArgs* request,
+                       ::raftKVRpcProctoc::ScanReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void BatchPut(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::BatchPutArgs* request,
+                       ::raftKVRpcProctoc::BatchPutReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void BatchGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::BatchGetArgs* request,
+                       ::raftKVRpcProctoc::BatchGetReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void RegisterClient(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::RegisterClientArgs* request,
+                       ::raftKVRpcProctoc::RegisterClientReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void GetRanges(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetRangesArgs* request,
+                       ::raftKVRpcProctoc::GetRangesReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void TransferLeader(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::TransferLeaderArgs* request,
+                       ::raftKVRpcProctoc::TransferLeaderReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void ChangeMembership(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ChangeMembershipArgs* request,
+                       ::raftKVRpcProctoc::ChangeMembershipReply* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc);
+};
+
+class kvServerRpc_Stub : public kvServerRpc {
+ public:
+  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  kvServerRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~kvServerRpc_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements kvServerRpc ------------------------------------------
+
+  void PutAppend(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::PutAppendArgs* request,
+                       ::raftKVRpcProctoc::PutAppendReply* response,
+                       ::google::protobuf::Closure* done);
+  void Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetArgs* request,
+                       ::raftKVRpcProctoc::GetReply* response,
+                       ::google::protobuf::Closure* done);
+  void Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ScanArgs* request,
+                       ::raftKVRpcProctoc::ScanReply* response,
+                       ::google::protobuf::Closure* done);
+  void BatchPut(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::BatchPutArgs* request,
+                       ::raftKVRpcProctoc::BatchPutReply* response,
+                       ::google::protobuf::Closure* done);
+  void BatchGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::BatchGetArgs* request,
+                       ::raftKVRpcProctoc::BatchGetReply* response,
+                       ::google::protobuf::Closure* done);
+  void RegisterClient(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::RegisterClientArgs* request,
+                       ::raftKVRpcProctoc::RegisterClientReply* response,
+                       ::google::protobuf::Closure* done);
+  void GetRanges(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::GetRangesArgs* request,
+                       ::raftKVRpcProctoc::GetRangesReply* response,
+                       ::google::protobuf::Closure* done);
+  void TransferLeader(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::TransferLeaderArgs* request,
+                       ::raftKVRpcProctoc::TransferLeaderReply* response,
+                       ::google::protobuf::Closure* done);
+  void ChangeMembership(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftKVRpcProctoc::ChangeMembershipArgs* request,
+                       ::raftKVRpcProctoc::ChangeMembershipReply* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(kvServerRpc_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GetArgs
+
+// bytes Key = 1;
+inline void GetArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& GetArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.Key)
+}
+inline std::string* GetArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.Key)
+  return _s;
+}
+inline const std::string& GetArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
 inline void GetArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void GetArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.Key)
+}
+
+// uint64 ClientId = 2;
+inline void GetArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t GetArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t GetArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.ClientId)
+  return _internal_clientid();
+}
+inline void GetArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void GetArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.ClientId)
+}
+
+// int32 RequestId = 3;
+inline void GetArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t GetArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t GetArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.RequestId)
+  return _internal_requestid();
+}
+inline void GetArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void GetArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.RequestId)
+}
+
+// bool FollowerRead = 4;
+inline void GetArgs::clear_followerread() {
+  _impl_.followerread_ = false;
+}
+inline bool GetArgs::_internal_followerread() const {
+  return _impl_.followerread_;
+}
+inline bool GetArgs::followerread() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.FollowerRead)
+  return _internal_followerread();
+}
+inline void GetArgs::_internal_set_followerread(bool value) {
+  
+  _impl_.followerread_ = value;
+}
+inline void GetArgs::set_followerread(bool value) {
+  _internal_set_followerread(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.FollowerRead)
+}
+
+// int32 MaxStalenessMs = 5;
+inline void GetArgs::clear_maxstalenessms() {
+  _impl_.maxstalenessms_ = 0;
+}
+inline int32_t GetArgs::_internal_maxstalenessms() const {
+  return _impl_.maxstalenessms_;
+}
+inline int32_t GetArgs::maxstalenessms() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.MaxStalenessMs)
+  return _internal_maxstalenessms();
+}
+inline void GetArgs::_internal_set_maxstalenessms(int32_t value) {
+  
+  _impl_.maxstalenessms_ = value;
+}
+inline void GetArgs::set_maxstalenessms(int32_t value) {
+  _internal_set_maxstalenessms(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.MaxStalenessMs)
+}
+
+// int32 GroupId = 6;
+inline void GetArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t GetArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t GetArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.GroupId)
+  return _internal_groupid();
+}
+inline void GetArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void GetArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.GroupId)
+}
+
+// -------------------------------------------------------------------
+
+// GetReply
+
+// bytes Err = 1;
+inline void GetReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& GetReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Err)
+}
+inline std::string* GetReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Err)
+  return _s;
+}
+inline const std::string& GetReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void GetReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Err)
+  return _impl_.err_.Release();
+}
+inline void GetReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Err)
+}
+
+// bytes Value = 2;
+inline void GetReply::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GetReply::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Value)
+}
+inline std::string* GetReply::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Value)
+  return _s;
+}
+inline const std::string& GetReply::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetReply::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Value)
+  return _impl_.value_.Release();
+}
+inline void GetReply::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Value)
+}
+
+// int32 LeaderId = 3;
+inline void GetReply::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t GetReply::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t GetReply::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.LeaderId)
+  return _internal_leaderid();
+}
+inline void GetReply::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void GetReply::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.LeaderId)
+}
+
+// int32 LeaderTerm = 4;
+inline void GetReply::clear_leaderterm() {
+  _impl_.leaderterm_ = 0;
+}
+inline int32_t GetReply::_internal_leaderterm() const {
+  return _impl_.leaderterm_;
+}
+inline int32_t GetReply::leaderterm() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.LeaderTerm)
+  return _internal_leaderterm();
+}
+inline void GetReply::_internal_set_leaderterm(int32_t value) {
+  
+  _impl_.leaderterm_ = value;
+}
+inline void GetReply::set_leaderterm(int32_t value) {
+  _internal_set_leaderterm(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.LeaderTerm)
+}
+
+// -------------------------------------------------------------------
+
+// PutAppendArgs
+
+// bytes Key = 1;
+inline void PutAppendArgs::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Key)
+}
+inline std::string* PutAppendArgs::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Key)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PutAppendArgs::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Key)
+  return _impl_.key_.Release();
+}
+inline void PutAppendArgs::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
+}
+
+// bytes Value = 2;
+inline void PutAppendArgs::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Value)
+}
+inline std::string* PutAppendArgs::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Value)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutAppendArgs::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Value)
+  return _impl_.value_.Release();
+}
+inline void PutAppendArgs::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
+}
+
+// bytes Op = 3;
+inline void PutAppendArgs::clear_op() {
+  _impl_.op_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::op() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Op)
+  return _internal_op();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_op(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Op)
+}
+inline std::string* PutAppendArgs::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Op)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void PutAppendArgs::_internal_set_op(const std::string& value) {
+  
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_op() {
+  
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_op() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Op)
+  return _impl_.op_.Release();
+}
+inline void PutAppendArgs::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
+}
+
+// uint64 ClientId = 4;
+inline void PutAppendArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t PutAppendArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t PutAppendArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.ClientId)
+  return _internal_clientid();
+}
+inline void PutAppendArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void PutAppendArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.ClientId)
+}
+
+// int32 RequestId = 5;
+inline void PutAppendArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t PutAppendArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t PutAppendArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.RequestId)
+  return _internal_requestid();
+}
+inline void PutAppendArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void PutAppendArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.RequestId)
+}
+
+// int32 GroupId = 6;
+inline void PutAppendArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t PutAppendArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t PutAppendArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.GroupId)
+  return _internal_groupid();
+}
+inline void PutAppendArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void PutAppendArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.GroupId)
+}
+
+// bytes Expected = 7;
+inline void PutAppendArgs::clear_expected() {
+  _impl_.expected_.ClearToEmpty();
+}
+inline const std::string& PutAppendArgs::expected() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Expected)
+  return _internal_expected();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendArgs::set_expected(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.expected_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Expected)
+}
+inline std::string* PutAppendArgs::mutable_expected() {
+  std::string* _s = _internal_mutable_expected();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Expected)
+  return _s;
+}
+inline const std::string& PutAppendArgs::_internal_expected() const {
+  return _impl_.expected_.Get();
+}
+inline void PutAppendArgs::_internal_set_expected(const std::string& value) {
+  
+  _impl_.expected_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::_internal_mutable_expected() {
+  
+  return _impl_.expected_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendArgs::release_expected() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Expected)
+  return _impl_.expected_.Release();
+}
+inline void PutAppendArgs::set_allocated_expected(std::string* expected) {
+  if (expected != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.expected_.SetAllocated(expected, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.expected_.IsDefault()) {
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Expected)
+}
+
+// bool ExpectAbsent = 8;
+inline void PutAppendArgs::clear_expectabsent() {
+  _impl_.expectabsent_ = false;
+}
+inline bool PutAppendArgs::_internal_expectabsent() const {
+  return _impl_.expectabsent_;
+}
+inline bool PutAppendArgs::expectabsent() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.ExpectAbsent)
+  return _internal_expectabsent();
+}
+inline void PutAppendArgs::_internal_set_expectabsent(bool value) {
+  
+  _impl_.expectabsent_ = value;
+}
+inline void PutAppendArgs::set_expectabsent(bool value) {
+  _internal_set_expectabsent(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.ExpectAbsent)
+}
+
+// int64 Delta = 9;
+inline void PutAppendArgs::clear_delta() {
+  _impl_.delta_ = int64_t{0};
+}
+inline int64_t PutAppendArgs::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline int64_t PutAppendArgs::delta() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Delta)
+  return _internal_delta();
+}
+inline void PutAppendArgs::_internal_set_delta(int64_t value) {
+  
+  _impl_.delta_ = value;
+}
+inline void PutAppendArgs::set_delta(int64_t value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Delta)
+}
+
+// -------------------------------------------------------------------
+
+// PutAppendReply
+
+// bytes Err = 1;
+inline void PutAppendReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& PutAppendReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.Err)
+}
+inline std::string* PutAppendReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendReply.Err)
+  return _s;
+}
+inline const std::string& PutAppendReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void PutAppendReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendReply.Err)
+  return _impl_.err_.Release();
+}
+inline void PutAppendReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+}
+
+// int32 LeaderId = 2;
+inline void PutAppendReply::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t PutAppendReply::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t PutAppendReply::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.LeaderId)
+  return _internal_leaderid();
+}
+inline void PutAppendReply::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void PutAppendReply::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.LeaderId)
+}
+
+// int32 LeaderTerm = 3;
+inline void PutAppendReply::clear_leaderterm() {
+  _impl_.leaderterm_ = 0;
+}
+inline int32_t PutAppendReply::_internal_leaderterm() const {
+  return _impl_.leaderterm_;
+}
+inline int32_t PutAppendReply::leaderterm() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.LeaderTerm)
+  return _internal_leaderterm();
+}
+inline void PutAppendReply::_internal_set_leaderterm(int32_t value) {
+  
+  _impl_.leaderterm_ = value;
+}
+inline void PutAppendReply::set_leaderterm(int32_t value) {
+  _internal_set_leaderterm(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.LeaderTerm)
+}
+
+// bytes Value = 4;
+inline void PutAppendReply::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PutAppendReply::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutAppendReply::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.Value)
+}
+inline std::string* PutAppendReply::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendReply.Value)
+  return _s;
+}
+inline const std::string& PutAppendReply::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutAppendReply::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutAppendReply::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutAppendReply::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendReply.Value)
+  return _impl_.value_.Release();
+}
+inline void PutAppendReply::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendReply.Value)
+}
+
+// -------------------------------------------------------------------
+
+// KeyValue
+
+// bytes Key = 1;
+inline void KeyValue::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& KeyValue::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.KeyValue.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.KeyValue.Key)
+}
+inline std::string* KeyValue::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.KeyValue.Key)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void KeyValue::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.KeyValue.Key)
+  return _impl_.key_.Release();
+}
+inline void KeyValue::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.KeyValue.Key)
+}
+
+// bytes Value = 2;
+inline void KeyValue::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& KeyValue::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.KeyValue.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.KeyValue.Value)
+}
+inline std::string* KeyValue::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.KeyValue.Value)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void KeyValue::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.KeyValue.Value)
+  return _impl_.value_.Release();
+}
+inline void KeyValue::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.KeyValue.Value)
+}
+
+// -------------------------------------------------------------------
+
+// ScanArgs
+
+// bytes StartKey = 1;
+inline void ScanArgs::clear_startkey() {
+  _impl_.startkey_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::startkey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.StartKey)
+  return _internal_startkey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_startkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.startkey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.StartKey)
+}
+inline std::string* ScanArgs::mutable_startkey() {
+  std::string* _s = _internal_mutable_startkey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.StartKey)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_startkey() const {
+  return _impl_.startkey_.Get();
+}
+inline void ScanArgs::_internal_set_startkey(const std::string& value) {
+  
+  _impl_.startkey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_startkey() {
+  
+  return _impl_.startkey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_startkey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.StartKey)
+  return _impl_.startkey_.Release();
+}
+inline void ScanArgs::set_allocated_startkey(std::string* startkey) {
+  if (startkey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.startkey_.SetAllocated(startkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.startkey_.IsDefault()) {
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.StartKey)
+}
+
+// bytes EndKey = 2;
+inline void ScanArgs::clear_endkey() {
+  _impl_.endkey_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::endkey() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.EndKey)
+  return _internal_endkey();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_endkey(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.endkey_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.EndKey)
+}
+inline std::string* ScanArgs::mutable_endkey() {
+  std::string* _s = _internal_mutable_endkey();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.EndKey)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_endkey() const {
+  return _impl_.endkey_.Get();
+}
+inline void ScanArgs::_internal_set_endkey(const std::string& value) {
+  
+  _impl_.endkey_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_endkey() {
+  
+  return _impl_.endkey_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_endkey() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.EndKey)
+  return _impl_.endkey_.Release();
+}
+inline void ScanArgs::set_allocated_endkey(std::string* endkey) {
+  if (endkey != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.endkey_.SetAllocated(endkey, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.endkey_.IsDefault()) {
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.EndKey)
+}
+
+// bytes Prefix = 3;
+inline void ScanArgs::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::prefix() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.Prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_prefix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.Prefix)
+}
+inline std::string* ScanArgs::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.Prefix)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void ScanArgs::_internal_set_prefix(const std::string& value) {
+  
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_prefix() {
+  
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_prefix() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.Prefix)
+  return _impl_.prefix_.Release();
+}
+inline void ScanArgs::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.Prefix)
+}
+
+// int32 Limit = 4;
+inline void ScanArgs::clear_limit() {
+  _impl_.limit_ = 0;
+}
+inline int32_t ScanArgs::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t ScanArgs::limit() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.Limit)
+  return _internal_limit();
+}
+inline void ScanArgs::_internal_set_limit(int32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void ScanArgs::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.Limit)
+}
+
+// bytes PageToken = 5;
+inline void ScanArgs::clear_pagetoken() {
+  _impl_.pagetoken_.ClearToEmpty();
+}
+inline const std::string& ScanArgs::pagetoken() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.PageToken)
+  return _internal_pagetoken();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanArgs::set_pagetoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pagetoken_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.PageToken)
+}
+inline std::string* ScanArgs::mutable_pagetoken() {
+  std::string* _s = _internal_mutable_pagetoken();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanArgs.PageToken)
+  return _s;
+}
+inline const std::string& ScanArgs::_internal_pagetoken() const {
+  return _impl_.pagetoken_.Get();
+}
+inline void ScanArgs::_internal_set_pagetoken(const std::string& value) {
+  
+  _impl_.pagetoken_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanArgs::_internal_mutable_pagetoken() {
+  
+  return _impl_.pagetoken_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanArgs::release_pagetoken() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanArgs.PageToken)
+  return _impl_.pagetoken_.Release();
+}
+inline void ScanArgs::set_allocated_pagetoken(std::string* pagetoken) {
+  if (pagetoken != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.pagetoken_.SetAllocated(pagetoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pagetoken_.IsDefault()) {
+    _impl_.pagetoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanArgs.PageToken)
+}
+
+// uint64 ClientId = 6;
+inline void ScanArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t ScanArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t ScanArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.ClientId)
+  return _internal_clientid();
+}
+inline void ScanArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void ScanArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.ClientId)
+}
+
+// int32 RequestId = 7;
+inline void ScanArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t ScanArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t ScanArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.RequestId)
+  return _internal_requestid();
+}
+inline void ScanArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void ScanArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.RequestId)
+}
+
+// int32 GroupId = 8;
+inline void ScanArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t ScanArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t ScanArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanArgs.GroupId)
+  return _internal_groupid();
+}
+inline void ScanArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void ScanArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanArgs.GroupId)
+}
+
+// -------------------------------------------------------------------
+
+// ScanReply
+
+// bytes Err = 1;
+inline void ScanReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& ScanReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.Err)
+}
+inline std::string* ScanReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.Err)
+  return _s;
+}
+inline const std::string& ScanReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void ScanReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanReply.Err)
+  return _impl_.err_.Release();
+}
+inline void ScanReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanReply.Err)
+}
+
+// repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+inline int ScanReply::_internal_kvs_size() const {
+  return _impl_.kvs_.size();
+}
+inline int ScanReply::kvs_size() const {
+  return _internal_kvs_size();
+}
+inline void ScanReply::clear_kvs() {
+  _impl_.kvs_.Clear();
+}
+inline ::raftKVRpcProctoc::KeyValue* ScanReply::mutable_kvs(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.Kvs)
+  return _impl_.kvs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >*
+ScanReply::mutable_kvs() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.ScanReply.Kvs)
+  return &_impl_.kvs_;
+}
+inline const ::raftKVRpcProctoc::KeyValue& ScanReply::_internal_kvs(int index) const {
+  return _impl_.kvs_.Get(index);
+}
+inline const ::raftKVRpcProctoc::KeyValue& ScanReply::kvs(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.Kvs)
+  return _internal_kvs(index);
+}
+inline ::raftKVRpcProctoc::KeyValue* ScanReply::_internal_add_kvs() {
+  return _impl_.kvs_.Add();
+}
+inline ::raftKVRpcProctoc::KeyValue* ScanReply::add_kvs() {
+  ::raftKVRpcProctoc::KeyValue* _add = _internal_add_kvs();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.ScanReply.Kvs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyValue >&
+ScanReply::kvs() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.ScanReply.Kvs)
+  return _impl_.kvs_;
+}
+
+// bytes NextPageToken = 3;
+inline void ScanReply::clear_nextpagetoken() {
+  _impl_.nextpagetoken_.ClearToEmpty();
+}
+inline const std::string& ScanReply::nextpagetoken() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.NextPageToken)
+  return _internal_nextpagetoken();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanReply::set_nextpagetoken(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.nextpagetoken_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.NextPageToken)
+}
+inline std::string* ScanReply::mutable_nextpagetoken() {
+  std::string* _s = _internal_mutable_nextpagetoken();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.NextPageToken)
+  return _s;
+}
+inline const std::string& ScanReply::_internal_nextpagetoken() const {
+  return _impl_.nextpagetoken_.Get();
+}
+inline void ScanReply::_internal_set_nextpagetoken(const std::string& value) {
+  
+  _impl_.nextpagetoken_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanReply::_internal_mutable_nextpagetoken() {
+  
+  return _impl_.nextpagetoken_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanReply::release_nextpagetoken() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanReply.NextPageToken)
+  return _impl_.nextpagetoken_.Release();
+}
+inline void ScanReply::set_allocated_nextpagetoken(std::string* nextpagetoken) {
+  if (nextpagetoken != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.nextpagetoken_.SetAllocated(nextpagetoken, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nextpagetoken_.IsDefault()) {
+    _impl_.nextpagetoken_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanReply.NextPageToken)
+}
+
+// int32 LeaderId = 4;
+inline void ScanReply::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t ScanReply::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t ScanReply::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.LeaderId)
+  return _internal_leaderid();
+}
+inline void ScanReply::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void ScanReply::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.LeaderId)
+}
+
+// int32 LeaderTerm = 5;
+inline void ScanReply::clear_leaderterm() {
+  _impl_.leaderterm_ = 0;
+}
+inline int32_t ScanReply::_internal_leaderterm() const {
+  return _impl_.leaderterm_;
+}
+inline int32_t ScanReply::leaderterm() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.LeaderTerm)
+  return _internal_leaderterm();
+}
+inline void ScanReply::_internal_set_leaderterm(int32_t value) {
+  
+  _impl_.leaderterm_ = value;
+}
+inline void ScanReply::set_leaderterm(int32_t value) {
+  _internal_set_leaderterm(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.LeaderTerm)
+}
+
+// bytes RangeEnd = 6;
+inline void ScanReply::clear_rangeend() {
+  _impl_.rangeend_.ClearToEmpty();
+}
+inline const std::string& ScanReply::rangeend() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ScanReply.RangeEnd)
+  return _internal_rangeend();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanReply::set_rangeend(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rangeend_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ScanReply.RangeEnd)
+}
+inline std::string* ScanReply::mutable_rangeend() {
+  std::string* _s = _internal_mutable_rangeend();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ScanReply.RangeEnd)
+  return _s;
+}
+inline const std::string& ScanReply::_internal_rangeend() const {
+  return _impl_.rangeend_.Get();
+}
+inline void ScanReply::_internal_set_rangeend(const std::string& value) {
+  
+  _impl_.rangeend_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanReply::_internal_mutable_rangeend() {
+  
+  return _impl_.rangeend_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanReply::release_rangeend() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ScanReply.RangeEnd)
+  return _impl_.rangeend_.Release();
+}
+inline void ScanReply::set_allocated_rangeend(std::string* rangeend) {
+  if (rangeend != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rangeend_.SetAllocated(rangeend, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rangeend_.IsDefault()) {
+    _impl_.rangeend_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ScanReply.RangeEnd)
+}
+
+// -------------------------------------------------------------------
+
+// BatchOp
+
+// bytes Key = 1;
+inline void BatchOp::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& BatchOp::key() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchOp.Key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchOp::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchOp.Key)
+}
+inline std::string* BatchOp::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchOp.Key)
+  return _s;
+}
+inline const std::string& BatchOp::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void BatchOp::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchOp::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchOp::release_key() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.BatchOp.Key)
+  return _impl_.key_.Release();
+}
+inline void BatchOp::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.BatchOp.Key)
+}
+
+// bytes Value = 2;
+inline void BatchOp::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& BatchOp::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchOp.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchOp::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchOp.Value)
+}
+inline std::string* BatchOp::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchOp.Value)
+  return _s;
+}
+inline const std::string& BatchOp::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void BatchOp::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchOp::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchOp::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.BatchOp.Value)
+  return _impl_.value_.Release();
+}
+inline void BatchOp::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.BatchOp.Value)
+}
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// bytes Op = 3;
+inline void BatchOp::clear_op() {
+  _impl_.op_.ClearToEmpty();
+}
+inline const std::string& BatchOp::op() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchOp.Op)
+  return _internal_op();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchOp::set_op(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchOp.Op)
+}
+inline std::string* BatchOp::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchOp.Op)
+  return _s;
+}
+inline const std::string& BatchOp::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void BatchOp::_internal_set_op(const std::string& value) {
+  
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchOp::_internal_mutable_op() {
+  
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchOp::release_op() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.BatchOp.Op)
+  return _impl_.op_.Release();
+}
+inline void BatchOp::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.BatchOp.Op)
 }
-inline void GetArgs::set_key(std::string&& value) {
 
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetArgs.Key)
+// -------------------------------------------------------------------
+
+// BatchPutArgs
+
+// repeated .raftKVRpcProctoc.BatchOp Ops = 1;
+inline int BatchPutArgs::_internal_ops_size() const {
+  return _impl_.ops_.size();
+}
+inline int BatchPutArgs::ops_size() const {
+  return _internal_ops_size();
+}
+inline void BatchPutArgs::clear_ops() {
+  _impl_.ops_.Clear();
+}
+inline ::raftKVRpcProctoc::BatchOp* BatchPutArgs::mutable_ops(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchPutArgs.Ops)
+  return _impl_.ops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::BatchOp >*
+BatchPutArgs::mutable_ops() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.BatchPutArgs.Ops)
+  return &_impl_.ops_;
+}
+inline const ::raftKVRpcProctoc::BatchOp& BatchPutArgs::_internal_ops(int index) const {
+  return _impl_.ops_.Get(index);
+}
+inline const ::raftKVRpcProctoc::BatchOp& BatchPutArgs::ops(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchPutArgs.Ops)
+  return _internal_ops(index);
+}
+inline ::raftKVRpcProctoc::BatchOp* BatchPutArgs::_internal_add_ops() {
+  return _impl_.ops_.Add();
+}
+inline ::raftKVRpcProctoc::BatchOp* BatchPutArgs::add_ops() {
+  ::raftKVRpcProctoc::BatchOp* _add = _internal_add_ops();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.BatchPutArgs.Ops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::BatchOp >&
+BatchPutArgs::ops() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.BatchPutArgs.Ops)
+  return _impl_.ops_;
 }
-inline void GetArgs::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetArgs.Key)
+// uint64 ClientId = 2;
+inline void BatchPutArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t BatchPutArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t BatchPutArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchPutArgs.ClientId)
+  return _internal_clientid();
+}
+inline void BatchPutArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void BatchPutArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchPutArgs.ClientId)
 }
-inline void GetArgs::set_key(const void* value,
-    size_t size) {
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetArgs.Key)
+// int32 RequestId = 3;
+inline void BatchPutArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t BatchPutArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t BatchPutArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchPutArgs.RequestId)
+  return _internal_requestid();
+}
+inline void BatchPutArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void BatchPutArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchPutArgs.RequestId)
 }
-inline std::string* GetArgs::_internal_mutable_key() {
 
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int32 GroupId = 4;
+inline void BatchPutArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
 }
-inline std::string* GetArgs::release_key() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.Key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int32_t BatchPutArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t BatchPutArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchPutArgs.GroupId)
+  return _internal_groupid();
+}
+inline void BatchPutArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void BatchPutArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchPutArgs.GroupId)
 }
-inline void GetArgs::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
 
-  } else {
+// -------------------------------------------------------------------
 
-  }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.Key)
-}
-inline std::string* GetArgs::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetArgs.Key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+// BatchPutReply
 
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// bytes Err = 1;
+inline void BatchPutReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-inline void GetArgs::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-
+inline const std::string& BatchPutReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchPutReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchPutReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchPutReply.Err)
+}
+inline std::string* BatchPutReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchPutReply.Err)
+  return _s;
+}
+inline const std::string& BatchPutReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void BatchPutReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchPutReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchPutReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.BatchPutReply.Err)
+  return _impl_.err_.Release();
+}
+inline void BatchPutReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
   } else {
-
+    
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetArgs.Key)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.BatchPutReply.Err)
 }
 
-// bytes ClientId = 2;
-inline void GetArgs::clear_clientid() {
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int32 LeaderId = 2;
+inline void BatchPutReply::clear_leaderid() {
+  _impl_.leaderid_ = 0;
 }
-inline const std::string& GetArgs::clientid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.ClientId)
-  return _internal_clientid();
+inline int32_t BatchPutReply::_internal_leaderid() const {
+  return _impl_.leaderid_;
 }
-inline void GetArgs::set_clientid(const std::string& value) {
-  _internal_set_clientid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.ClientId)
+inline int32_t BatchPutReply::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchPutReply.LeaderId)
+  return _internal_leaderid();
 }
-inline std::string* GetArgs::mutable_clientid() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetArgs.ClientId)
-  return _internal_mutable_clientid();
+inline void BatchPutReply::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
 }
-inline const std::string& GetArgs::_internal_clientid() const {
-  return clientid_.Get();
+inline void BatchPutReply::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchPutReply.LeaderId)
 }
-inline void GetArgs::_internal_set_clientid(const std::string& value) {
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// int32 LeaderTerm = 3;
+inline void BatchPutReply::clear_leaderterm() {
+  _impl_.leaderterm_ = 0;
+}
+inline int32_t BatchPutReply::_internal_leaderterm() const {
+  return _impl_.leaderterm_;
+}
+inline int32_t BatchPutReply::leaderterm() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchPutReply.LeaderTerm)
+  return _internal_leaderterm();
+}
+inline void BatchPutReply::_internal_set_leaderterm(int32_t value) {
+  
+  _impl_.leaderterm_ = value;
+}
+inline void BatchPutReply::set_leaderterm(int32_t value) {
+  _internal_set_leaderterm(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchPutReply.LeaderTerm)
 }
-inline void GetArgs::set_clientid(std::string&& value) {
 
-  clientid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetArgs.ClientId)
+// -------------------------------------------------------------------
+
+// BatchGetArgs
+
+// repeated bytes Keys = 1;
+inline int BatchGetArgs::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int BatchGetArgs::keys_size() const {
+  return _internal_keys_size();
+}
+inline void BatchGetArgs::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* BatchGetArgs::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:raftKVRpcProctoc.BatchGetArgs.Keys)
+  return _s;
+}
+inline const std::string& BatchGetArgs::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& BatchGetArgs::keys(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchGetArgs.Keys)
+  return _internal_keys(index);
+}
+inline std::string* BatchGetArgs::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchGetArgs.Keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void BatchGetArgs::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchGetArgs.Keys)
+}
+inline void BatchGetArgs::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchGetArgs.Keys)
+}
+inline void BatchGetArgs::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.BatchGetArgs.Keys)
+}
+inline void BatchGetArgs::set_keys(int index, const void* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.BatchGetArgs.Keys)
+}
+inline std::string* BatchGetArgs::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void BatchGetArgs::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.BatchGetArgs.Keys)
 }
-inline void GetArgs::set_clientid(const char* value) {
+inline void BatchGetArgs::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.BatchGetArgs.Keys)
+}
+inline void BatchGetArgs::add_keys(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:raftKVRpcProctoc.BatchGetArgs.Keys)
+}
+inline void BatchGetArgs::add_keys(const void* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:raftKVRpcProctoc.BatchGetArgs.Keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchGetArgs::keys() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.BatchGetArgs.Keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchGetArgs::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.BatchGetArgs.Keys)
+  return &_impl_.keys_;
+}
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetArgs.ClientId)
+// uint64 ClientId = 2;
+inline void BatchGetArgs::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t BatchGetArgs::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t BatchGetArgs::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchGetArgs.ClientId)
+  return _internal_clientid();
+}
+inline void BatchGetArgs::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void BatchGetArgs::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchGetArgs.ClientId)
 }
-inline void GetArgs::set_clientid(const void* value,
-    size_t size) {
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetArgs.ClientId)
+// int32 RequestId = 3;
+inline void BatchGetArgs::clear_requestid() {
+  _impl_.requestid_ = 0;
+}
+inline int32_t BatchGetArgs::_internal_requestid() const {
+  return _impl_.requestid_;
+}
+inline int32_t BatchGetArgs::requestid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchGetArgs.RequestId)
+  return _internal_requestid();
+}
+inline void BatchGetArgs::_internal_set_requestid(int32_t value) {
+  
+  _impl_.requestid_ = value;
+}
+inline void BatchGetArgs::set_requestid(int32_t value) {
+  _internal_set_requestid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchGetArgs.RequestId)
 }
-inline std::string* GetArgs::_internal_mutable_clientid() {
 
-  return clientid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int32 GroupId = 4;
+inline void BatchGetArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t BatchGetArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t BatchGetArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchGetArgs.GroupId)
+  return _internal_groupid();
 }
-inline std::string* GetArgs::release_clientid() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetArgs.ClientId)
-  return clientid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void BatchGetArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void BatchGetArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchGetArgs.GroupId)
 }
-inline void GetArgs::set_allocated_clientid(std::string* clientid) {
-  if (clientid != nullptr) {
 
-  } else {
+// -------------------------------------------------------------------
+
+// KeyResult
 
+// bytes Err = 1;
+inline void KeyResult::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& KeyResult::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.KeyResult.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyResult::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.KeyResult.Err)
+}
+inline std::string* KeyResult::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.KeyResult.Err)
+  return _s;
+}
+inline const std::string& KeyResult::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void KeyResult::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyResult::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyResult::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.KeyResult.Err)
+  return _impl_.err_.Release();
+}
+inline void KeyResult::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
   }
-  clientid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), clientid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetArgs.ClientId)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.KeyResult.Err)
 }
-inline std::string* GetArgs::unsafe_arena_release_clientid() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetArgs.ClientId)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return clientid_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// bytes Value = 2;
+inline void KeyResult::clear_value() {
+  _impl_.value_.ClearToEmpty();
 }
-inline void GetArgs::unsafe_arena_set_allocated_clientid(
-    std::string* clientid) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (clientid != nullptr) {
-
+inline const std::string& KeyResult::value() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.KeyResult.Value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyResult::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.KeyResult.Value)
+}
+inline std::string* KeyResult::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.KeyResult.Value)
+  return _s;
+}
+inline const std::string& KeyResult::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void KeyResult::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyResult::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyResult::release_value() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.KeyResult.Value)
+  return _impl_.value_.Release();
+}
+inline void KeyResult::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
   } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.KeyResult.Value)
+}
+
+// -------------------------------------------------------------------
+
+// BatchGetReply
 
+// bytes Err = 1;
+inline void BatchGetReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& BatchGetReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchGetReply.Err)
+  return _internal_err();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchGetReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchGetReply.Err)
+}
+inline std::string* BatchGetReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchGetReply.Err)
+  return _s;
+}
+inline const std::string& BatchGetReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void BatchGetReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchGetReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchGetReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.BatchGetReply.Err)
+  return _impl_.err_.Release();
+}
+inline void BatchGetReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
   }
-  clientid_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      clientid, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetArgs.ClientId)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.BatchGetReply.Err)
 }
 
-// int32 RequestId = 3;
-inline void GetArgs::clear_requestid() {
-  requestid_ = 0;
+// repeated .raftKVRpcProctoc.KeyResult Results = 2;
+inline int BatchGetReply::_internal_results_size() const {
+  return _impl_.results_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetArgs::_internal_requestid() const {
-  return requestid_;
+inline int BatchGetReply::results_size() const {
+  return _internal_results_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetArgs::requestid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetArgs.RequestId)
-  return _internal_requestid();
+inline void BatchGetReply::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::raftKVRpcProctoc::KeyResult* BatchGetReply::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.BatchGetReply.Results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyResult >*
+BatchGetReply::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.BatchGetReply.Results)
+  return &_impl_.results_;
+}
+inline const ::raftKVRpcProctoc::KeyResult& BatchGetReply::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::raftKVRpcProctoc::KeyResult& BatchGetReply::results(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchGetReply.Results)
+  return _internal_results(index);
+}
+inline ::raftKVRpcProctoc::KeyResult* BatchGetReply::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::raftKVRpcProctoc::KeyResult* BatchGetReply::add_results() {
+  ::raftKVRpcProctoc::KeyResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.BatchGetReply.Results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::KeyResult >&
+BatchGetReply::results() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.BatchGetReply.Results)
+  return _impl_.results_;
 }
-inline void GetArgs::_internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  requestid_ = value;
+// int32 LeaderId = 3;
+inline void BatchGetReply::clear_leaderid() {
+  _impl_.leaderid_ = 0;
 }
-inline void GetArgs::set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_requestid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetArgs.RequestId)
+inline int32_t BatchGetReply::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t BatchGetReply::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchGetReply.LeaderId)
+  return _internal_leaderid();
+}
+inline void BatchGetReply::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void BatchGetReply::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchGetReply.LeaderId)
+}
+
+// int32 LeaderTerm = 4;
+inline void BatchGetReply::clear_leaderterm() {
+  _impl_.leaderterm_ = 0;
+}
+inline int32_t BatchGetReply::_internal_leaderterm() const {
+  return _impl_.leaderterm_;
+}
+inline int32_t BatchGetReply::leaderterm() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.BatchGetReply.LeaderTerm)
+  return _internal_leaderterm();
+}
+inline void BatchGetReply::_internal_set_leaderterm(int32_t value) {
+  
+  _impl_.leaderterm_ = value;
+}
+inline void BatchGetReply::set_leaderterm(int32_t value) {
+  _internal_set_leaderterm(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.BatchGetReply.LeaderTerm)
 }
 
 // -------------------------------------------------------------------
 
-// GetReply
+// RegisterClientArgs
+
+// int32 GroupId = 1;
+inline void RegisterClientArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t RegisterClientArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t RegisterClientArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterClientArgs.GroupId)
+  return _internal_groupid();
+}
+inline void RegisterClientArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void RegisterClientArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterClientArgs.GroupId)
+}
+
+// -------------------------------------------------------------------
+
+// RegisterClientReply
 
 // bytes Err = 1;
-inline void GetReply::clear_err() {
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void RegisterClientReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-inline const std::string& GetReply::err() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Err)
+inline const std::string& RegisterClientReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterClientReply.Err)
   return _internal_err();
 }
-inline void GetReply::set_err(const std::string& value) {
-  _internal_set_err(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Err)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterClientReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterClientReply.Err)
 }
-inline std::string* GetReply::mutable_err() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Err)
-  return _internal_mutable_err();
+inline std::string* RegisterClientReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.RegisterClientReply.Err)
+  return _s;
 }
-inline const std::string& GetReply::_internal_err() const {
-  return err_.Get();
+inline const std::string& RegisterClientReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void RegisterClientReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterClientReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterClientReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.RegisterClientReply.Err)
+  return _impl_.err_.Release();
+}
+inline void RegisterClientReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.RegisterClientReply.Err)
+}
+
+// uint64 ClientId = 2;
+inline void RegisterClientReply::clear_clientid() {
+  _impl_.clientid_ = uint64_t{0u};
+}
+inline uint64_t RegisterClientReply::_internal_clientid() const {
+  return _impl_.clientid_;
+}
+inline uint64_t RegisterClientReply::clientid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterClientReply.ClientId)
+  return _internal_clientid();
+}
+inline void RegisterClientReply::_internal_set_clientid(uint64_t value) {
+  
+  _impl_.clientid_ = value;
+}
+inline void RegisterClientReply::set_clientid(uint64_t value) {
+  _internal_set_clientid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterClientReply.ClientId)
+}
+
+// int32 LeaderId = 3;
+inline void RegisterClientReply::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t RegisterClientReply::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t RegisterClientReply::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterClientReply.LeaderId)
+  return _internal_leaderid();
+}
+inline void RegisterClientReply::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void RegisterClientReply::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterClientReply.LeaderId)
+}
+
+// int32 LeaderTerm = 4;
+inline void RegisterClientReply::clear_leaderterm() {
+  _impl_.leaderterm_ = 0;
+}
+inline int32_t RegisterClientReply::_internal_leaderterm() const {
+  return _impl_.leaderterm_;
+}
+inline int32_t RegisterClientReply::leaderterm() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RegisterClientReply.LeaderTerm)
+  return _internal_leaderterm();
+}
+inline void RegisterClientReply::_internal_set_leaderterm(int32_t value) {
+  
+  _impl_.leaderterm_ = value;
+}
+inline void RegisterClientReply::set_leaderterm(int32_t value) {
+  _internal_set_leaderterm(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RegisterClientReply.LeaderTerm)
+}
+
+// -------------------------------------------------------------------
+
+// GetRangesArgs
+
+// -------------------------------------------------------------------
+
+// RangeInfo
+
+// int32 GroupId = 1;
+inline void RangeInfo::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t RangeInfo::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t RangeInfo::groupid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RangeInfo.GroupId)
+  return _internal_groupid();
+}
+inline void RangeInfo::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void RangeInfo::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RangeInfo.GroupId)
+}
+
+// bytes Start = 2;
+inline void RangeInfo::clear_start() {
+  _impl_.start_.ClearToEmpty();
+}
+inline const std::string& RangeInfo::start() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RangeInfo.Start)
+  return _internal_start();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RangeInfo::set_start(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.start_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RangeInfo.Start)
+}
+inline std::string* RangeInfo::mutable_start() {
+  std::string* _s = _internal_mutable_start();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.RangeInfo.Start)
+  return _s;
+}
+inline const std::string& RangeInfo::_internal_start() const {
+  return _impl_.start_.Get();
+}
+inline void RangeInfo::_internal_set_start(const std::string& value) {
+  
+  _impl_.start_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RangeInfo::_internal_mutable_start() {
+  
+  return _impl_.start_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RangeInfo::release_start() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.RangeInfo.Start)
+  return _impl_.start_.Release();
+}
+inline void RangeInfo::set_allocated_start(std::string* start) {
+  if (start != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.start_.SetAllocated(start, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.start_.IsDefault()) {
+    _impl_.start_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.RangeInfo.Start)
 }
-inline void GetReply::_internal_set_err(const std::string& value) {
 
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// bytes End = 3;
+inline void RangeInfo::clear_end() {
+  _impl_.end_.ClearToEmpty();
 }
-inline void GetReply::set_err(std::string&& value) {
+inline const std::string& RangeInfo::end() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.RangeInfo.End)
+  return _internal_end();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RangeInfo::set_end(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.end_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.RangeInfo.End)
+}
+inline std::string* RangeInfo::mutable_end() {
+  std::string* _s = _internal_mutable_end();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.RangeInfo.End)
+  return _s;
+}
+inline const std::string& RangeInfo::_internal_end() const {
+  return _impl_.end_.Get();
+}
+inline void RangeInfo::_internal_set_end(const std::string& value) {
+  
+  _impl_.end_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RangeInfo::_internal_mutable_end() {
+  
+  return _impl_.end_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RangeInfo::release_end() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.RangeInfo.End)
+  return _impl_.end_.Release();
+}
+inline void RangeInfo::set_allocated_end(std::string* end) {
+  if (end != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.end_.SetAllocated(end, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_.IsDefault()) {
+    _impl_.end_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.RangeInfo.End)
+}
+
+// -------------------------------------------------------------------
+
+// GetRangesReply
 
-  err_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetReply.Err)
+// bytes Err = 1;
+inline void GetRangesReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
+}
+inline const std::string& GetRangesReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetRangesReply.Err)
+  return _internal_err();
 }
-inline void GetReply::set_err(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetReply.Err)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetRangesReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetRangesReply.Err)
 }
-inline void GetReply::set_err(const void* value,
-    size_t size) {
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetReply.Err)
+inline std::string* GetRangesReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetRangesReply.Err)
+  return _s;
 }
-inline std::string* GetReply::_internal_mutable_err() {
-
-  return err_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const std::string& GetRangesReply::_internal_err() const {
+  return _impl_.err_.Get();
 }
-inline std::string* GetReply::release_err() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Err)
-  return err_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void GetRangesReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
 }
-inline void GetReply::set_allocated_err(std::string* err) {
-  if (err != nullptr) {
-
-  } else {
-
-  }
-  err_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), err,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Err)
+inline std::string* GetRangesReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetReply::unsafe_arena_release_err() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetReply.Err)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return err_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline std::string* GetRangesReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetRangesReply.Err)
+  return _impl_.err_.Release();
 }
-inline void GetReply::unsafe_arena_set_allocated_err(
-    std::string* err) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline void GetRangesReply::set_allocated_err(std::string* err) {
   if (err != nullptr) {
-
+    
   } else {
-
+    
   }
-  err_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      err, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetReply.Err)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetRangesReply.Err)
 }
 
-// bytes Value = 2;
-inline void GetReply::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int32 Groups = 2;
+inline void GetRangesReply::clear_groups() {
+  _impl_.groups_ = 0;
 }
-inline const std::string& GetReply::value() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetReply.Value)
-  return _internal_value();
+inline int32_t GetRangesReply::_internal_groups() const {
+  return _impl_.groups_;
 }
-inline void GetReply::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetReply.Value)
+inline int32_t GetRangesReply::groups() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetRangesReply.Groups)
+  return _internal_groups();
 }
-inline std::string* GetReply::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetReply.Value)
-  return _internal_mutable_value();
+inline void GetRangesReply::_internal_set_groups(int32_t value) {
+  
+  _impl_.groups_ = value;
 }
-inline const std::string& GetReply::_internal_value() const {
-  return value_.Get();
+inline void GetRangesReply::set_groups(int32_t value) {
+  _internal_set_groups(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.GetRangesReply.Groups)
 }
-inline void GetReply::_internal_set_value(const std::string& value) {
 
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// repeated .raftKVRpcProctoc.RangeInfo Ranges = 3;
+inline int GetRangesReply::_internal_ranges_size() const {
+  return _impl_.ranges_.size();
 }
-inline void GetReply::set_value(std::string&& value) {
-
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.GetReply.Value)
+inline int GetRangesReply::ranges_size() const {
+  return _internal_ranges_size();
 }
-inline void GetReply::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.GetReply.Value)
+inline void GetRangesReply::clear_ranges() {
+  _impl_.ranges_.Clear();
 }
-inline void GetReply::set_value(const void* value,
-    size_t size) {
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.GetReply.Value)
+inline ::raftKVRpcProctoc::RangeInfo* GetRangesReply::mutable_ranges(int index) {
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.GetRangesReply.Ranges)
+  return _impl_.ranges_.Mutable(index);
 }
-inline std::string* GetReply::_internal_mutable_value() {
-
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::RangeInfo >*
+GetRangesReply::mutable_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:raftKVRpcProctoc.GetRangesReply.Ranges)
+  return &_impl_.ranges_;
 }
-inline std::string* GetReply::release_value() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.GetReply.Value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::raftKVRpcProctoc::RangeInfo& GetRangesReply::_internal_ranges(int index) const {
+  return _impl_.ranges_.Get(index);
 }
-inline void GetReply::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-
-  } else {
-
-  }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.GetReply.Value)
+inline const ::raftKVRpcProctoc::RangeInfo& GetRangesReply::ranges(int index) const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.GetRangesReply.Ranges)
+  return _internal_ranges(index);
 }
-inline std::string* GetReply::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.GetReply.Value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline ::raftKVRpcProctoc::RangeInfo* GetRangesReply::_internal_add_ranges() {
+  return _impl_.ranges_.Add();
 }
-inline void GetReply::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-
-  } else {
-
-  }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.GetReply.Value)
+inline ::raftKVRpcProctoc::RangeInfo* GetRangesReply::add_ranges() {
+  ::raftKVRpcProctoc::RangeInfo* _add = _internal_add_ranges();
+  // @@protoc_insertion_point(field_add:raftKVRpcProctoc.GetRangesReply.Ranges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftKVRpcProctoc::RangeInfo >&
+GetRangesReply::ranges() const {
+  // @@protoc_insertion_point(field_list:raftKVRpcProctoc.GetRangesReply.Ranges)
+  return _impl_.ranges_;
 }
 
 // -------------------------------------------------------------------
 
-// PutAppendArgs
+// TransferLeaderArgs
 
-// bytes Key = 1;
-inline void PutAppendArgs::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& PutAppendArgs::key() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Key)
-  return _internal_key();
-}
-inline void PutAppendArgs::set_key(const std::string& value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Key)
+// int32 GroupId = 1;
+inline void TransferLeaderArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
 }
-inline std::string* PutAppendArgs::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Key)
-  return _internal_mutable_key();
-}
-inline const std::string& PutAppendArgs::_internal_key() const {
-  return key_.Get();
+inline int32_t TransferLeaderArgs::_internal_groupid() const {
+  return _impl_.groupid_;
 }
-inline void PutAppendArgs::_internal_set_key(const std::string& value) {
-
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline int32_t TransferLeaderArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TransferLeaderArgs.GroupId)
+  return _internal_groupid();
 }
-inline void PutAppendArgs::set_key(std::string&& value) {
-
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Key)
+inline void TransferLeaderArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
 }
-inline void PutAppendArgs::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Key)
+inline void TransferLeaderArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TransferLeaderArgs.GroupId)
 }
-inline void PutAppendArgs::set_key(const void* value,
-    size_t size) {
 
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Key)
+// int32 Target = 2;
+inline void TransferLeaderArgs::clear_target() {
+  _impl_.target_ = 0;
 }
-inline std::string* PutAppendArgs::_internal_mutable_key() {
-
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int32_t TransferLeaderArgs::_internal_target() const {
+  return _impl_.target_;
 }
-inline std::string* PutAppendArgs::release_key() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int32_t TransferLeaderArgs::target() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TransferLeaderArgs.Target)
+  return _internal_target();
 }
-inline void PutAppendArgs::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-
-  } else {
-
-  }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
+inline void TransferLeaderArgs::_internal_set_target(int32_t value) {
+  
+  _impl_.target_ = value;
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.Key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline void TransferLeaderArgs::set_target(int32_t value) {
+  _internal_set_target(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TransferLeaderArgs.Target)
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
 
-  } else {
+// -------------------------------------------------------------------
 
-  }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.Key)
-}
+// TransferLeaderReply
 
-// bytes Value = 2;
-inline void PutAppendArgs::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// bytes Err = 1;
+inline void TransferLeaderReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-inline const std::string& PutAppendArgs::value() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Value)
-  return _internal_value();
+inline const std::string& TransferLeaderReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TransferLeaderReply.Err)
+  return _internal_err();
 }
-inline void PutAppendArgs::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Value)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferLeaderReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TransferLeaderReply.Err)
 }
-inline std::string* PutAppendArgs::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Value)
-  return _internal_mutable_value();
+inline std::string* TransferLeaderReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.TransferLeaderReply.Err)
+  return _s;
 }
-inline const std::string& PutAppendArgs::_internal_value() const {
-  return value_.Get();
+inline const std::string& TransferLeaderReply::_internal_err() const {
+  return _impl_.err_.Get();
 }
-inline void PutAppendArgs::_internal_set_value(const std::string& value) {
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void TransferLeaderReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
 }
-inline void PutAppendArgs::set_value(std::string&& value) {
-
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Value)
+inline std::string* TransferLeaderReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
 }
-inline void PutAppendArgs::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Value)
+inline std::string* TransferLeaderReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.TransferLeaderReply.Err)
+  return _impl_.err_.Release();
 }
-inline void PutAppendArgs::set_value(const void* value,
-    size_t size) {
-
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Value)
+inline void TransferLeaderReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.TransferLeaderReply.Err)
 }
-inline std::string* PutAppendArgs::_internal_mutable_value() {
 
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int32 LeaderId = 2;
+inline void TransferLeaderReply::clear_leaderid() {
+  _impl_.leaderid_ = 0;
 }
-inline std::string* PutAppendArgs::release_value() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int32_t TransferLeaderReply::_internal_leaderid() const {
+  return _impl_.leaderid_;
 }
-inline void PutAppendArgs::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-
-  } else {
-
-  }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
+inline int32_t TransferLeaderReply::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TransferLeaderReply.LeaderId)
+  return _internal_leaderid();
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.Value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline void TransferLeaderReply::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-
-  } else {
-
-  }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.Value)
+inline void TransferLeaderReply::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TransferLeaderReply.LeaderId)
 }
 
-// bytes Op = 3;
-inline void PutAppendArgs::clear_op() {
-  op_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int32 LeaderTerm = 3;
+inline void TransferLeaderReply::clear_leaderterm() {
+  _impl_.leaderterm_ = 0;
 }
-inline const std::string& PutAppendArgs::op() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.Op)
-  return _internal_op();
+inline int32_t TransferLeaderReply::_internal_leaderterm() const {
+  return _impl_.leaderterm_;
 }
-inline void PutAppendArgs::set_op(const std::string& value) {
-  _internal_set_op(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.Op)
+inline int32_t TransferLeaderReply::leaderterm() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.TransferLeaderReply.LeaderTerm)
+  return _internal_leaderterm();
 }
-inline std::string* PutAppendArgs::mutable_op() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.Op)
-  return _internal_mutable_op();
+inline void TransferLeaderReply::_internal_set_leaderterm(int32_t value) {
+  
+  _impl_.leaderterm_ = value;
 }
-inline const std::string& PutAppendArgs::_internal_op() const {
-  return op_.Get();
+inline void TransferLeaderReply::set_leaderterm(int32_t value) {
+  _internal_set_leaderterm(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.TransferLeaderReply.LeaderTerm)
 }
-inline void PutAppendArgs::_internal_set_op(const std::string& value) {
 
-  op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void PutAppendArgs::set_op(std::string&& value) {
+// -------------------------------------------------------------------
 
-  op_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.Op)
-}
-inline void PutAppendArgs::set_op(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+// ChangeMembershipArgs
 
-  op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.Op)
+// int32 GroupId = 1;
+inline void ChangeMembershipArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
 }
-inline void PutAppendArgs::set_op(const void* value,
-    size_t size) {
-
-  op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.Op)
+inline int32_t ChangeMembershipArgs::_internal_groupid() const {
+  return _impl_.groupid_;
 }
-inline std::string* PutAppendArgs::_internal_mutable_op() {
-
-  return op_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline int32_t ChangeMembershipArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipArgs.GroupId)
+  return _internal_groupid();
 }
-inline std::string* PutAppendArgs::release_op() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.Op)
-  return op_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void ChangeMembershipArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
 }
-inline void PutAppendArgs::set_allocated_op(std::string* op) {
-  if (op != nullptr) {
-
-  } else {
-
-  }
-  op_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), op,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
+inline void ChangeMembershipArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipArgs.GroupId)
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_op() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.Op)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return op_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// int32 Kind = 2;
+inline void ChangeMembershipArgs::clear_kind() {
+  _impl_.kind_ = 0;
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_op(
-    std::string* op) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (op != nullptr) {
-
-  } else {
-
-  }
-  op_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      op, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.Op)
+inline int32_t ChangeMembershipArgs::_internal_kind() const {
+  return _impl_.kind_;
+}
+inline int32_t ChangeMembershipArgs::kind() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipArgs.Kind)
+  return _internal_kind();
+}
+inline void ChangeMembershipArgs::_internal_set_kind(int32_t value) {
+  
+  _impl_.kind_ = value;
+}
+inline void ChangeMembershipArgs::set_kind(int32_t value) {
+  _internal_set_kind(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipArgs.Kind)
 }
 
-// bytes ClientId = 4;
-inline void PutAppendArgs::clear_clientid() {
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int32 NodeId = 3;
+inline void ChangeMembershipArgs::clear_nodeid() {
+  _impl_.nodeid_ = 0;
 }
-inline const std::string& PutAppendArgs::clientid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return _internal_clientid();
+inline int32_t ChangeMembershipArgs::_internal_nodeid() const {
+  return _impl_.nodeid_;
 }
-inline void PutAppendArgs::set_clientid(const std::string& value) {
-  _internal_set_clientid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline int32_t ChangeMembershipArgs::nodeid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipArgs.NodeId)
+  return _internal_nodeid();
 }
-inline std::string* PutAppendArgs::mutable_clientid() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return _internal_mutable_clientid();
+inline void ChangeMembershipArgs::_internal_set_nodeid(int32_t value) {
+  
+  _impl_.nodeid_ = value;
 }
-inline const std::string& PutAppendArgs::_internal_clientid() const {
-  return clientid_.Get();
+inline void ChangeMembershipArgs::set_nodeid(int32_t value) {
+  _internal_set_nodeid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipArgs.NodeId)
 }
-inline void PutAppendArgs::_internal_set_clientid(const std::string& value) {
 
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+// bytes Ip = 4;
+inline void ChangeMembershipArgs::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
 }
-inline void PutAppendArgs::set_clientid(std::string&& value) {
-
-  clientid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline const std::string& ChangeMembershipArgs::ip() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
+  return _internal_ip();
 }
-inline void PutAppendArgs::set_clientid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendArgs.ClientId)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChangeMembershipArgs::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
 }
-inline void PutAppendArgs::set_clientid(const void* value,
-    size_t size) {
-
-  clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline std::string* ChangeMembershipArgs::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
+  return _s;
 }
-inline std::string* PutAppendArgs::_internal_mutable_clientid() {
-
-  return clientid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const std::string& ChangeMembershipArgs::_internal_ip() const {
+  return _impl_.ip_.Get();
 }
-inline std::string* PutAppendArgs::release_clientid() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  return clientid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void ChangeMembershipArgs::_internal_set_ip(const std::string& value) {
+  
+  _impl_.ip_.Set(value, GetArenaForAllocation());
 }
-inline void PutAppendArgs::set_allocated_clientid(std::string* clientid) {
-  if (clientid != nullptr) {
-
-  } else {
-
-  }
-  clientid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), clientid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendArgs.ClientId)
+inline std::string* ChangeMembershipArgs::_internal_mutable_ip() {
+  
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
 }
-inline std::string* PutAppendArgs::unsafe_arena_release_clientid() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendArgs.ClientId)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-
-  return clientid_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline std::string* ChangeMembershipArgs::release_ip() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
+  return _impl_.ip_.Release();
 }
-inline void PutAppendArgs::unsafe_arena_set_allocated_clientid(
-    std::string* clientid) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (clientid != nullptr) {
-
+inline void ChangeMembershipArgs::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    
   } else {
-
+    
   }
-  clientid_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      clientid, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendArgs.ClientId)
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ChangeMembershipArgs.Ip)
 }
 
-// int32 RequestId = 5;
-inline void PutAppendArgs::clear_requestid() {
-  requestid_ = 0;
+// int32 Port = 5;
+inline void ChangeMembershipArgs::clear_port() {
+  _impl_.port_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PutAppendArgs::_internal_requestid() const {
-  return requestid_;
+inline int32_t ChangeMembershipArgs::_internal_port() const {
+  return _impl_.port_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PutAppendArgs::requestid() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendArgs.RequestId)
-  return _internal_requestid();
+inline int32_t ChangeMembershipArgs::port() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipArgs.Port)
+  return _internal_port();
 }
-inline void PutAppendArgs::_internal_set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  requestid_ = value;
+inline void ChangeMembershipArgs::_internal_set_port(int32_t value) {
+  
+  _impl_.port_ = value;
 }
-inline void PutAppendArgs::set_requestid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_requestid(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendArgs.RequestId)
+inline void ChangeMembershipArgs::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipArgs.Port)
 }
 
 // -------------------------------------------------------------------
 
-// PutAppendReply
+// ChangeMembershipReply
 
 // bytes Err = 1;
-inline void PutAppendReply::clear_err() {
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void ChangeMembershipReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-inline const std::string& PutAppendReply::err() const {
-  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.PutAppendReply.Err)
+inline const std::string& ChangeMembershipReply::err() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipReply.Err)
   return _internal_err();
 }
-inline void PutAppendReply::set_err(const std::string& value) {
-  _internal_set_err(value);
-  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.PutAppendReply.Err)
-}
-inline std::string* PutAppendReply::mutable_err() {
-  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.PutAppendReply.Err)
-  return _internal_mutable_err();
-}
-inline const std::string& PutAppendReply::_internal_err() const {
-  return err_.Get();
-}
-inline void PutAppendReply::_internal_set_err(const std::string& value) {
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChangeMembershipReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipReply.Err)
 }
-inline void PutAppendReply::set_err(std::string&& value) {
-
-  err_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftKVRpcProctoc.PutAppendReply.Err)
+inline std::string* ChangeMembershipReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftKVRpcProctoc.ChangeMembershipReply.Err)
+  return _s;
 }
-inline void PutAppendReply::set_err(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftKVRpcProctoc.PutAppendReply.Err)
+inline const std::string& ChangeMembershipReply::_internal_err() const {
+  return _impl_.err_.Get();
 }
-inline void PutAppendReply::set_err(const void* value,
-    size_t size) {
-
-  err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftKVRpcProctoc.PutAppendReply.Err)
+inline void ChangeMembershipReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
 }
-inline std::string* PutAppendReply::_internal_mutable_err() {
-
-  return err_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* ChangeMembershipReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
 }
-inline std::string* PutAppendReply::release_err() {
-  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.PutAppendReply.Err)
-  return err_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* ChangeMembershipReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftKVRpcProctoc.ChangeMembershipReply.Err)
+  return _impl_.err_.Release();
 }
-inline void PutAppendReply::set_allocated_err(std::string* err) {
+inline void ChangeMembershipReply::set_allocated_err(std::string* err) {
   if (err != nullptr) {
-
+    
   } else {
-
+    
   }
-  err_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), err,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftKVRpcProctoc.ChangeMembershipReply.Err)
 }
-inline std::string* PutAppendReply::unsafe_arena_release_err() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftKVRpcProctoc.PutAppendReply.Err)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return err_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// int32 LeaderId = 2;
+inline void ChangeMembershipReply::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t ChangeMembershipReply::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t ChangeMembershipReply::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipReply.LeaderId)
+  return _internal_leaderid();
+}
+inline void ChangeMembershipReply::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void ChangeMembershipReply::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipReply.LeaderId)
 }
-inline void PutAppendReply::unsafe_arena_set_allocated_err(
-    std::string* err) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (err != nullptr) {
-
-  } else {
 
-  }
-  err_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      err, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftKVRpcProctoc.PutAppendReply.Err)
+// int32 LeaderTerm = 3;
+inline void ChangeMembershipReply::clear_leaderterm() {
+  _impl_.leaderterm_ = 0;
+}
+inline int32_t ChangeMembershipReply::_internal_leaderterm() const {
+  return _impl_.leaderterm_;
+}
+inline int32_t ChangeMembershipReply::leaderterm() const {
+  // @@protoc_insertion_point(field_get:raftKVRpcProctoc.ChangeMembershipReply.LeaderTerm)
+  return _internal_leaderterm();
+}
+inline void ChangeMembershipReply::_internal_set_leaderterm(int32_t value) {
+  
+  _impl_.leaderterm_ = value;
+}
+inline void ChangeMembershipReply::set_leaderterm(int32_t value) {
+  _internal_set_leaderterm(value);
+  // @@protoc_insertion_point(field_set:raftKVRpcProctoc.ChangeMembershipReply.LeaderTerm)
 }
 
 #ifdef __GNUC__
@@ -1714,6 +7241,42 @@ inline void PutAppendReply::unsafe_arena_set_allocated_err(
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1722,4 +7285,4 @@ inline void PutAppendReply::unsafe_arena_set_allocated_err(
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kvServerRPC_2eproto
\ No newline at end of file
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kvServerRPC_2eproto
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -44,39 +42,55 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_raftRPC_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[7]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_raftRPC_2eproto;
 namespace raftRpcProctoc {
 class AppendEntriesArgs;
-class AppendEntriesArgsDefaultTypeInternal;
+struct AppendEntriesArgsDefaultTypeInternal;
 extern AppendEntriesArgsDefaultTypeInternal _AppendEntriesArgs_default_instance_;
 class AppendEntriesReply;
-class AppendEntriesReplyDefaultTypeInternal;
+struct AppendEntriesReplyDefaultTypeInternal;
 extern AppendEntriesReplyDefaultTypeInternal _AppendEntriesReply_default_instance_;
 class InstallSnapshotRequest;
-class InstallSnapshotRequestDefaultTypeInternal;
+struct InstallSnapshotRequestDefaultTypeInternal;
 extern InstallSnapshotRequestDefaultTypeInternal _InstallSnapshotRequest_default_instance_;
 class InstallSnapshotResponse;
-class InstallSnapshotResponseDefaultTypeInternal;
+struct InstallSnapshotResponseDefaultTypeInternal;
 extern InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
 class LogEntry;
-class LogEntryDefaultTypeInternal;
+struct LogEntryDefaultTypeInternal;
 extern LogEntryDefaultTypeInternal _LogEntry_default_instance_;
+class Member;
+struct MemberDefaultTypeInternal;
+extern MemberDefaultTypeInternal _Member_default_instance_;
+class Membership;
+struct MembershipDefaultTypeInternal;
+extern MembershipDefaultTypeInternal _Membership_default_instance_;
+class RangeAdminArgs;
+struct RangeAdminArgsDefaultTypeInternal;
+extern RangeAdminArgsDefaultTypeInternal _RangeAdminArgs_default_instance_;
+class RangeAdminReply;
+struct RangeAdminReplyDefaultTypeInternal;
+extern RangeAdminReplyDefaultTypeInternal _RangeAdminReply_default_instance_;
+class ReadIndexArgs;
+struct ReadIndexArgsDefaultTypeInternal;
+extern ReadIndexArgsDefaultTypeInternal _ReadIndexArgs_default_instance_;
+class ReadIndexReply;
+struct ReadIndexReplyDefaultTypeInternal;
+extern ReadIndexReplyDefaultTypeInternal _ReadIndexReply_default_instance_;
 class RequestVoteArgs;
-class RequestVoteArgsDefaultTypeInternal;
+struct RequestVoteArgsDefaultTypeInternal;
 extern RequestVoteArgsDefaultTypeInternal _RequestVoteArgs_default_instance_;
 class RequestVoteReply;
-class RequestVoteReplyDefaultTypeInternal;
+struct RequestVoteReplyDefaultTypeInternal;
 extern RequestVoteReplyDefaultTypeInternal _RequestVoteReply_default_instance_;
+class TimeoutNowArgs;
+struct TimeoutNowArgsDefaultTypeInternal;
+extern TimeoutNowArgsDefaultTypeInternal _TimeoutNowArgs_default_instance_;
+class TimeoutNowReply;
+struct TimeoutNowReplyDefaultTypeInternal;
+extern TimeoutNowReplyDefaultTypeInternal _TimeoutNowReply_default_instance_;
 }  // namespace raftRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
 template<> ::raftRpcProctoc::AppendEntriesArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::AppendEntriesArgs>(Arena*);
@@ -84,18 +98,370 @@ template<> ::raftRpcProctoc::AppendEntriesReply* Arena::CreateMaybeMessage<::raf
 template<> ::raftRpcProctoc::InstallSnapshotRequest* Arena::CreateMaybeMessage<::raftRpcProctoc::InstallSnapshotRequest>(Arena*);
 template<> ::raftRpcProctoc::InstallSnapshotResponse* Arena::CreateMaybeMessage<::raftRpcProctoc::InstallSnapshotResponse>(Arena*);
 template<> ::raftRpcProctoc::LogEntry* Arena::CreateMaybeMessage<::raftRpcProctoc::LogEntry>(Arena*);
+template<> ::raftRpcProctoc::Member* Arena::CreateMaybeMessage<::raftRpcProctoc::Member>(Arena*);
+template<> ::raftRpcProctoc::Membership* Arena::CreateMaybeMessage<::raftRpcProctoc::Membership>(Arena*);
+template<> ::raftRpcProctoc::RangeAdminArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::RangeAdminArgs>(Arena*);
+template<> ::raftRpcProctoc::RangeAdminReply* Arena::CreateMaybeMessage<::raftRpcProctoc::RangeAdminReply>(Arena*);
+template<> ::raftRpcProctoc::ReadIndexArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::ReadIndexArgs>(Arena*);
+template<> ::raftRpcProctoc::ReadIndexReply* Arena::CreateMaybeMessage<::raftRpcProctoc::ReadIndexReply>(Arena*);
 template<> ::raftRpcProctoc::RequestVoteArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::RequestVoteArgs>(Arena*);
 template<> ::raftRpcProctoc::RequestVoteReply* Arena::CreateMaybeMessage<::raftRpcProctoc::RequestVoteReply>(Arena*);
+template<> ::raftRpcProctoc::TimeoutNowArgs* Arena::CreateMaybeMessage<::raftRpcProctoc::TimeoutNowArgs>(Arena*);
+template<> ::raftRpcProctoc::TimeoutNowReply* Arena::CreateMaybeMessage<::raftRpcProctoc::TimeoutNowReply>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace raftRpcProctoc {
 
 // ===================================================================
 
-class LogEntry PROTOBUF_FINAL :
+class Member final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.Member) */ {
+ public:
+  inline Member() : Member(nullptr) {}
+  ~Member() override;
+  explicit PROTOBUF_CONSTEXPR Member(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Member(const Member& from);
+  Member(Member&& from) noexcept
+    : Member() {
+    *this = ::std::move(from);
+  }
+
+  inline Member& operator=(const Member& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Member& operator=(Member&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Member& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Member* internal_default_instance() {
+    return reinterpret_cast<const Member*>(
+               &_Member_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Member& a, Member& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Member* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Member* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Member* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Member>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Member& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Member& from) {
+    Member::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Member* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.Member";
+  }
+  protected:
+  explicit Member(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIpFieldNumber = 2,
+    kIdFieldNumber = 1,
+    kPortFieldNumber = 3,
+    kLearnerFieldNumber = 4,
+  };
+  // bytes Ip = 2;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // int32 Id = 1;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // int32 Port = 3;
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // bool Learner = 4;
+  void clear_learner();
+  bool learner() const;
+  void set_learner(bool value);
+  private:
+  bool _internal_learner() const;
+  void _internal_set_learner(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.Member)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t id_;
+    int32_t port_;
+    bool learner_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Membership final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.Membership) */ {
+ public:
+  inline Membership() : Membership(nullptr) {}
+  ~Membership() override;
+  explicit PROTOBUF_CONSTEXPR Membership(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Membership(const Membership& from);
+  Membership(Membership&& from) noexcept
+    : Membership() {
+    *this = ::std::move(from);
+  }
+
+  inline Membership& operator=(const Membership& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Membership& operator=(Membership&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Membership& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Membership* internal_default_instance() {
+    return reinterpret_cast<const Membership*>(
+               &_Membership_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Membership& a, Membership& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Membership* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Membership* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Membership* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Membership>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Membership& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Membership& from) {
+    Membership::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Membership* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.Membership";
+  }
+  protected:
+  explicit Membership(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMembersFieldNumber = 1,
+  };
+  // repeated .raftRpcProctoc.Member Members = 1;
+  int members_size() const;
+  private:
+  int _internal_members_size() const;
+  public:
+  void clear_members();
+  ::raftRpcProctoc::Member* mutable_members(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member >*
+      mutable_members();
+  private:
+  const ::raftRpcProctoc::Member& _internal_members(int index) const;
+  ::raftRpcProctoc::Member* _internal_add_members();
+  public:
+  const ::raftRpcProctoc::Member& members(int index) const;
+  ::raftRpcProctoc::Member* add_members();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member >&
+      members() const;
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.Membership)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member > members_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogEntry final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.LogEntry) */ {
  public:
-  inline LogEntry() : LogEntry(nullptr) {};
-  virtual ~LogEntry();
+  inline LogEntry() : LogEntry(nullptr) {}
+  ~LogEntry() override;
+  explicit PROTOBUF_CONSTEXPR LogEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LogEntry(const LogEntry& from);
   LogEntry(LogEntry&& from) noexcept
@@ -108,8 +474,13 @@ class LogEntry PROTOBUF_FINAL :
     return *this;
   }
   inline LogEntry& operator=(LogEntry&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -120,27 +491,32 @@ class LogEntry PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogEntry& default_instance() {
+    return *internal_default_instance();
   }
-  static const LogEntry& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const LogEntry* internal_default_instance() {
     return reinterpret_cast<const LogEntry*>(
                &_LogEntry_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    2;
 
   friend void swap(LogEntry& a, LogEntry& b) {
     a.Swap(&b);
   }
   inline void Swap(LogEntry* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -148,56 +524,53 @@ class LogEntry PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(LogEntry* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LogEntry* New() const final {
-    return CreateMaybeMessage<LogEntry>(nullptr);
-  }
-
-  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LogEntry>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LogEntry& from);
-  void MergeFrom(const LogEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogEntry& from) {
+    LogEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LogEntry* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.LogEntry";
   }
   protected:
-  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -205,50 +578,58 @@ class LogEntry PROTOBUF_FINAL :
 
   enum : int {
     kCommandFieldNumber = 1,
+    kConfigFieldNumber = 4,
     kLogTermFieldNumber = 2,
     kLogIndexFieldNumber = 3,
   };
   // bytes Command = 1;
   void clear_command();
   const std::string& command() const;
-  void set_command(const std::string& value);
-  void set_command(std::string&& value);
-  void set_command(const char* value);
-  void set_command(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
   std::string* mutable_command();
-  std::string* release_command();
+  PROTOBUF_NODISCARD std::string* release_command();
   void set_allocated_command(std::string* command);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_command();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_command(
-      std::string* command);
   private:
   const std::string& _internal_command() const;
-  void _internal_set_command(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
   std::string* _internal_mutable_command();
   public:
 
+  // .raftRpcProctoc.Membership Config = 4;
+  bool has_config() const;
+  private:
+  bool _internal_has_config() const;
+  public:
+  void clear_config();
+  const ::raftRpcProctoc::Membership& config() const;
+  PROTOBUF_NODISCARD ::raftRpcProctoc::Membership* release_config();
+  ::raftRpcProctoc::Membership* mutable_config();
+  void set_allocated_config(::raftRpcProctoc::Membership* config);
+  private:
+  const ::raftRpcProctoc::Membership& _internal_config() const;
+  ::raftRpcProctoc::Membership* _internal_mutable_config();
+  public:
+  void unsafe_arena_set_allocated_config(
+      ::raftRpcProctoc::Membership* config);
+  ::raftRpcProctoc::Membership* unsafe_arena_release_config();
+
   // int32 LogTerm = 2;
   void clear_logterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 logterm() const;
-  void set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t logterm() const;
+  void set_logterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_logterm() const;
-  void _internal_set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_logterm() const;
+  void _internal_set_logterm(int32_t value);
   public:
 
   // int32 LogIndex = 3;
   void clear_logindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 logindex() const;
-  void set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t logindex() const;
+  void set_logindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_logindex() const;
-  void _internal_set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_logindex() const;
+  void _internal_set_logindex(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.LogEntry)
@@ -258,19 +639,24 @@ class LogEntry PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
-  ::PROTOBUF_NAMESPACE_ID::int32 logterm_;
-  ::PROTOBUF_NAMESPACE_ID::int32 logindex_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    ::raftRpcProctoc::Membership* config_;
+    int32_t logterm_;
+    int32_t logindex_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesArgs PROTOBUF_FINAL :
+class AppendEntriesArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.AppendEntriesArgs) */ {
  public:
-  inline AppendEntriesArgs() : AppendEntriesArgs(nullptr) {};
-  virtual ~AppendEntriesArgs();
+  inline AppendEntriesArgs() : AppendEntriesArgs(nullptr) {}
+  ~AppendEntriesArgs() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AppendEntriesArgs(const AppendEntriesArgs& from);
   AppendEntriesArgs(AppendEntriesArgs&& from) noexcept
@@ -283,8 +669,13 @@ class AppendEntriesArgs PROTOBUF_FINAL :
     return *this;
   }
   inline AppendEntriesArgs& operator=(AppendEntriesArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -295,27 +686,32 @@ class AppendEntriesArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const AppendEntriesArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const AppendEntriesArgs* internal_default_instance() {
     return reinterpret_cast<const AppendEntriesArgs*>(
                &_AppendEntriesArgs_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    3;
 
   friend void swap(AppendEntriesArgs& a, AppendEntriesArgs& b) {
     a.Swap(&b);
   }
   inline void Swap(AppendEntriesArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -323,56 +719,53 @@ class AppendEntriesArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(AppendEntriesArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesArgs* New() const final {
-    return CreateMaybeMessage<AppendEntriesArgs>(nullptr);
-  }
-
-  AppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  AppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<AppendEntriesArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AppendEntriesArgs& from);
-  void MergeFrom(const AppendEntriesArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesArgs& from) {
+    AppendEntriesArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(AppendEntriesArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.AppendEntriesArgs";
   }
   protected:
-  explicit AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -385,6 +778,7 @@ class AppendEntriesArgs PROTOBUF_FINAL :
     kPrevLogIndexFieldNumber = 3,
     kPrevLogTermFieldNumber = 4,
     kLeaderCommitFieldNumber = 6,
+    kGroupIdFieldNumber = 7,
   };
   // repeated .raftRpcProctoc.LogEntry Entries = 5;
   int entries_size() const;
@@ -406,47 +800,56 @@ class AppendEntriesArgs PROTOBUF_FINAL :
 
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // int32 LeaderId = 2;
   void clear_leaderid();
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid() const;
-  void set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leaderid() const;
-  void _internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
   public:
 
   // int32 PrevLogIndex = 3;
   void clear_prevlogindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogindex() const;
-  void set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t prevlogindex() const;
+  void set_prevlogindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_prevlogindex() const;
-  void _internal_set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_prevlogindex() const;
+  void _internal_set_prevlogindex(int32_t value);
   public:
 
   // int32 PrevLogTerm = 4;
   void clear_prevlogterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogterm() const;
-  void set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t prevlogterm() const;
+  void set_prevlogterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_prevlogterm() const;
-  void _internal_set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_prevlogterm() const;
+  void _internal_set_prevlogterm(int32_t value);
   public:
 
   // int32 LeaderCommit = 6;
   void clear_leadercommit();
-  ::PROTOBUF_NAMESPACE_ID::int32 leadercommit() const;
-  void set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t leadercommit() const;
+  void set_leadercommit(int32_t value);
+  private:
+  int32_t _internal_leadercommit() const;
+  void _internal_set_leadercommit(int32_t value);
+  public:
+
+  // int32 GroupId = 7;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leadercommit() const;
-  void _internal_set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.AppendEntriesArgs)
@@ -456,22 +859,27 @@ class AppendEntriesArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry > entries_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogterm_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leadercommit_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry > entries_;
+    int32_t term_;
+    int32_t leaderid_;
+    int32_t prevlogindex_;
+    int32_t prevlogterm_;
+    int32_t leadercommit_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesReply PROTOBUF_FINAL :
+class AppendEntriesReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.AppendEntriesReply) */ {
  public:
-  inline AppendEntriesReply() : AppendEntriesReply(nullptr) {};
-  virtual ~AppendEntriesReply();
+  inline AppendEntriesReply() : AppendEntriesReply(nullptr) {}
+  ~AppendEntriesReply() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AppendEntriesReply(const AppendEntriesReply& from);
   AppendEntriesReply(AppendEntriesReply&& from) noexcept
@@ -484,8 +892,13 @@ class AppendEntriesReply PROTOBUF_FINAL :
     return *this;
   }
   inline AppendEntriesReply& operator=(AppendEntriesReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -496,27 +909,32 @@ class AppendEntriesReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const AppendEntriesReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const AppendEntriesReply* internal_default_instance() {
     return reinterpret_cast<const AppendEntriesReply*>(
                &_AppendEntriesReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    4;
 
   friend void swap(AppendEntriesReply& a, AppendEntriesReply& b) {
     a.Swap(&b);
   }
   inline void Swap(AppendEntriesReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -524,56 +942,53 @@ class AppendEntriesReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(AppendEntriesReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesReply* New() const final {
-    return CreateMaybeMessage<AppendEntriesReply>(nullptr);
-  }
-
-  AppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  AppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<AppendEntriesReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AppendEntriesReply& from);
-  void MergeFrom(const AppendEntriesReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesReply& from) {
+    AppendEntriesReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(AppendEntriesReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.AppendEntriesReply";
   }
   protected:
-  explicit AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -584,14 +999,15 @@ class AppendEntriesReply PROTOBUF_FINAL :
     kSuccessFieldNumber = 2,
     kUpdateNextIndexFieldNumber = 3,
     kAppStateFieldNumber = 4,
+    kConflictTermFieldNumber = 5,
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // bool Success = 2;
@@ -605,20 +1021,29 @@ class AppendEntriesReply PROTOBUF_FINAL :
 
   // int32 UpdateNextIndex = 3;
   void clear_updatenextindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 updatenextindex() const;
-  void set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t updatenextindex() const;
+  void set_updatenextindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_updatenextindex() const;
-  void _internal_set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_updatenextindex() const;
+  void _internal_set_updatenextindex(int32_t value);
   public:
 
   // int32 AppState = 4;
   void clear_appstate();
-  ::PROTOBUF_NAMESPACE_ID::int32 appstate() const;
-  void set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t appstate() const;
+  void set_appstate(int32_t value);
+  private:
+  int32_t _internal_appstate() const;
+  void _internal_set_appstate(int32_t value);
+  public:
+
+  // int32 ConflictTerm = 5;
+  void clear_conflictterm();
+  int32_t conflictterm() const;
+  void set_conflictterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_appstate() const;
-  void _internal_set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_conflictterm() const;
+  void _internal_set_conflictterm(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.AppendEntriesReply)
@@ -628,20 +1053,25 @@ class AppendEntriesReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  bool success_;
-  ::PROTOBUF_NAMESPACE_ID::int32 updatenextindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 appstate_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    bool success_;
+    int32_t updatenextindex_;
+    int32_t appstate_;
+    int32_t conflictterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RequestVoteArgs PROTOBUF_FINAL :
+class RequestVoteArgs final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.RequestVoteArgs) */ {
  public:
-  inline RequestVoteArgs() : RequestVoteArgs(nullptr) {};
-  virtual ~RequestVoteArgs();
+  inline RequestVoteArgs() : RequestVoteArgs(nullptr) {}
+  ~RequestVoteArgs() override;
+  explicit PROTOBUF_CONSTEXPR RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RequestVoteArgs(const RequestVoteArgs& from);
   RequestVoteArgs(RequestVoteArgs&& from) noexcept
@@ -654,8 +1084,13 @@ class RequestVoteArgs PROTOBUF_FINAL :
     return *this;
   }
   inline RequestVoteArgs& operator=(RequestVoteArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -666,27 +1101,32 @@ class RequestVoteArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestVoteArgs& default_instance() {
+    return *internal_default_instance();
   }
-  static const RequestVoteArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RequestVoteArgs* internal_default_instance() {
     return reinterpret_cast<const RequestVoteArgs*>(
                &_RequestVoteArgs_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    5;
 
   friend void swap(RequestVoteArgs& a, RequestVoteArgs& b) {
     a.Swap(&b);
   }
   inline void Swap(RequestVoteArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -694,56 +1134,53 @@ class RequestVoteArgs PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RequestVoteArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RequestVoteArgs* New() const final {
-    return CreateMaybeMessage<RequestVoteArgs>(nullptr);
-  }
-
-  RequestVoteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RequestVoteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RequestVoteArgs>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RequestVoteArgs& from);
-  void MergeFrom(const RequestVoteArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestVoteArgs& from) {
+    RequestVoteArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RequestVoteArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.RequestVoteArgs";
   }
   protected:
-  explicit RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
 
   // nested types ----------------------------------------------------
 
@@ -754,41 +1191,71 @@ class RequestVoteArgs PROTOBUF_FINAL :
     kCandidateIdFieldNumber = 2,
     kLastLogIndexFieldNumber = 3,
     kLastLogTermFieldNumber = 4,
+    kGroupIdFieldNumber = 5,
+    kLeaderTransferFieldNumber = 6,
+    kPreVoteFieldNumber = 7,
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // int32 CandidateId = 2;
   void clear_candidateid();
-  ::PROTOBUF_NAMESPACE_ID::int32 candidateid() const;
-  void set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t candidateid() const;
+  void set_candidateid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_candidateid() const;
-  void _internal_set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_candidateid() const;
+  void _internal_set_candidateid(int32_t value);
   public:
 
   // int32 LastLogIndex = 3;
   void clear_lastlogindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogindex() const;
-  void set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastlogindex() const;
+  void set_lastlogindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastlogindex() const;
-  void _internal_set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_lastlogindex() const;
+  void _internal_set_lastlogindex(int32_t value);
   public:
 
   // int32 LastLogTerm = 4;
   void clear_lastlogterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogterm() const;
-  void set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastlogterm() const;
+  void set_lastlogterm(int32_t value);
+  private:
+  int32_t _internal_lastlogterm() const;
+  void _internal_set_lastlogterm(int32_t value);
+  public:
+
+  // int32 GroupId = 5;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // bool LeaderTransfer = 6;
+  void clear_leadertransfer();
+  bool leadertransfer() const;
+  void set_leadertransfer(bool value);
+  private:
+  bool _internal_leadertransfer() const;
+  void _internal_set_leadertransfer(bool value);
+  public:
+
+  // bool PreVote = 7;
+  void clear_prevote();
+  bool prevote() const;
+  void set_prevote(bool value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastlogterm() const;
-  void _internal_set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  bool _internal_prevote() const;
+  void _internal_set_prevote(bool value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.RequestVoteArgs)
@@ -798,20 +1265,27 @@ class RequestVoteArgs PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 candidateid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogterm_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t candidateid_;
+    int32_t lastlogindex_;
+    int32_t lastlogterm_;
+    int32_t groupid_;
+    bool leadertransfer_;
+    bool prevote_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RequestVoteReply PROTOBUF_FINAL :
+class RequestVoteReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.RequestVoteReply) */ {
  public:
-  inline RequestVoteReply() : RequestVoteReply(nullptr) {};
-  virtual ~RequestVoteReply();
+  inline RequestVoteReply() : RequestVoteReply(nullptr) {}
+  ~RequestVoteReply() override;
+  explicit PROTOBUF_CONSTEXPR RequestVoteReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RequestVoteReply(const RequestVoteReply& from);
   RequestVoteReply(RequestVoteReply&& from) noexcept
@@ -824,8 +1298,13 @@ class RequestVoteReply PROTOBUF_FINAL :
     return *this;
   }
   inline RequestVoteReply& operator=(RequestVoteReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -836,27 +1315,32 @@ class RequestVoteReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestVoteReply& default_instance() {
+    return *internal_default_instance();
   }
-  static const RequestVoteReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RequestVoteReply* internal_default_instance() {
     return reinterpret_cast<const RequestVoteReply*>(
                &_RequestVoteReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    6;
 
   friend void swap(RequestVoteReply& a, RequestVoteReply& b) {
     a.Swap(&b);
   }
   inline void Swap(RequestVoteReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -864,56 +1348,53 @@ class RequestVoteReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RequestVoteReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RequestVoteReply* New() const final {
-    return CreateMaybeMessage<RequestVoteReply>(nullptr);
-  }
-
-  RequestVoteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RequestVoteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RequestVoteReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RequestVoteReply& from);
-  void MergeFrom(const RequestVoteReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestVoteReply& from) {
+    RequestVoteReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RequestVoteReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.RequestVoteReply";
   }
   protected:
-  explicit RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -926,11 +1407,11 @@ class RequestVoteReply PROTOBUF_FINAL :
   };
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // bool VoteGranted = 2;
@@ -944,11 +1425,11 @@ class RequestVoteReply PROTOBUF_FINAL :
 
   // int32 VoteState = 3;
   void clear_votestate();
-  ::PROTOBUF_NAMESPACE_ID::int32 votestate() const;
-  void set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t votestate() const;
+  void set_votestate(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_votestate() const;
-  void _internal_set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_votestate() const;
+  void _internal_set_votestate(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.RequestVoteReply)
@@ -958,19 +1439,23 @@ class RequestVoteReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  bool votegranted_;
-  ::PROTOBUF_NAMESPACE_ID::int32 votestate_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t term_;
+    bool votegranted_;
+    int32_t votestate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InstallSnapshotRequest PROTOBUF_FINAL :
+class InstallSnapshotRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.InstallSnapshotRequest) */ {
  public:
-  inline InstallSnapshotRequest() : InstallSnapshotRequest(nullptr) {};
-  virtual ~InstallSnapshotRequest();
+  inline InstallSnapshotRequest() : InstallSnapshotRequest(nullptr) {}
+  ~InstallSnapshotRequest() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   InstallSnapshotRequest(const InstallSnapshotRequest& from);
   InstallSnapshotRequest(InstallSnapshotRequest&& from) noexcept
@@ -983,8 +1468,13 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
     return *this;
   }
   inline InstallSnapshotRequest& operator=(InstallSnapshotRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -995,27 +1485,32 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const InstallSnapshotRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const InstallSnapshotRequest* internal_default_instance() {
     return reinterpret_cast<const InstallSnapshotRequest*>(
                &_InstallSnapshotRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    7;
 
   friend void swap(InstallSnapshotRequest& a, InstallSnapshotRequest& b) {
     a.Swap(&b);
   }
   inline void Swap(InstallSnapshotRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1023,56 +1518,53 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(InstallSnapshotRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InstallSnapshotRequest* New() const final {
-    return CreateMaybeMessage<InstallSnapshotRequest>(nullptr);
-  }
-
-  InstallSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  InstallSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<InstallSnapshotRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const InstallSnapshotRequest& from);
-  void MergeFrom(const InstallSnapshotRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotRequest& from) {
+    InstallSnapshotRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(InstallSnapshotRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.InstallSnapshotRequest";
   }
   protected:
-  explicit InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1084,66 +1576,95 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
     kTermFieldNumber = 2,
     kLastSnapShotIncludeIndexFieldNumber = 3,
     kLastSnapShotIncludeTermFieldNumber = 4,
+    kOffsetFieldNumber = 6,
+    kDoneFieldNumber = 7,
+    kCrcFieldNumber = 8,
+    kGroupIdFieldNumber = 9,
   };
   // bytes Data = 5;
   void clear_data();
   const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
   std::string* mutable_data();
-  std::string* release_data();
+  PROTOBUF_NODISCARD std::string* release_data();
   void set_allocated_data(std::string* data);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_data();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_data(
-      std::string* data);
   private:
   const std::string& _internal_data() const;
-  void _internal_set_data(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
   std::string* _internal_mutable_data();
   public:
 
   // int32 LeaderId = 1;
   void clear_leaderid();
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid() const;
-  void set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leaderid() const;
-  void _internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
   public:
 
   // int32 Term = 2;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
   // int32 LastSnapShotIncludeIndex = 3;
   void clear_lastsnapshotincludeindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeindex() const;
-  void set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastsnapshotincludeindex() const;
+  void set_lastsnapshotincludeindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastsnapshotincludeindex() const;
-  void _internal_set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_lastsnapshotincludeindex() const;
+  void _internal_set_lastsnapshotincludeindex(int32_t value);
   public:
 
   // int32 LastSnapShotIncludeTerm = 4;
   void clear_lastsnapshotincludeterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeterm() const;
-  void set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t lastsnapshotincludeterm() const;
+  void set_lastsnapshotincludeterm(int32_t value);
+  private:
+  int32_t _internal_lastsnapshotincludeterm() const;
+  void _internal_set_lastsnapshotincludeterm(int32_t value);
+  public:
+
+  // int64 Offset = 6;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // bool Done = 7;
+  void clear_done();
+  bool done() const;
+  void set_done(bool value);
+  private:
+  bool _internal_done() const;
+  void _internal_set_done(bool value);
+  public:
+
+  // uint32 Crc = 8;
+  void clear_crc();
+  uint32_t crc() const;
+  void set_crc(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastsnapshotincludeterm() const;
-  void _internal_set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  uint32_t _internal_crc() const;
+  void _internal_set_crc(uint32_t value);
+  public:
+
+  // int32 GroupId = 9;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.InstallSnapshotRequest)
@@ -1153,21 +1674,29 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeterm_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int32_t leaderid_;
+    int32_t term_;
+    int32_t lastsnapshotincludeindex_;
+    int32_t lastsnapshotincludeterm_;
+    int64_t offset_;
+    bool done_;
+    uint32_t crc_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InstallSnapshotResponse PROTOBUF_FINAL :
+class InstallSnapshotResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.InstallSnapshotResponse) */ {
  public:
-  inline InstallSnapshotResponse() : InstallSnapshotResponse(nullptr) {};
-  virtual ~InstallSnapshotResponse();
+  inline InstallSnapshotResponse() : InstallSnapshotResponse(nullptr) {}
+  ~InstallSnapshotResponse() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   InstallSnapshotResponse(const InstallSnapshotResponse& from);
   InstallSnapshotResponse(InstallSnapshotResponse&& from) noexcept
@@ -1180,8 +1709,13 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
     return *this;
   }
   inline InstallSnapshotResponse& operator=(InstallSnapshotResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1192,27 +1726,32 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const InstallSnapshotResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const InstallSnapshotResponse* internal_default_instance() {
     return reinterpret_cast<const InstallSnapshotResponse*>(
                &_InstallSnapshotResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    8;
 
   friend void swap(InstallSnapshotResponse& a, InstallSnapshotResponse& b) {
     a.Swap(&b);
   }
   inline void Swap(InstallSnapshotResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1220,71 +1759,88 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(InstallSnapshotResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InstallSnapshotResponse* New() const final {
-    return CreateMaybeMessage<InstallSnapshotResponse>(nullptr);
-  }
-
-  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<InstallSnapshotResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const InstallSnapshotResponse& from);
-  void MergeFrom(const InstallSnapshotResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotResponse& from) {
+    InstallSnapshotResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(InstallSnapshotResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProctoc.InstallSnapshotResponse";
   }
   protected:
-  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
+    kNextOffsetFieldNumber = 2,
     kTermFieldNumber = 1,
+    kInstalledFieldNumber = 3,
   };
+  // int64 NextOffset = 2;
+  void clear_nextoffset();
+  int64_t nextoffset() const;
+  void set_nextoffset(int64_t value);
+  private:
+  int64_t _internal_nextoffset() const;
+  void _internal_set_nextoffset(int64_t value);
+  public:
+
   // int32 Term = 1;
   void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // bool Installed = 3;
+  void clear_installed();
+  bool installed() const;
+  void set_installed(bool value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  bool _internal_installed() const;
+  void _internal_set_installed(bool value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProctoc.InstallSnapshotResponse)
@@ -1294,779 +1850,2887 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int64_t nextoffset_;
+    int32_t term_;
+    bool installed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
-// ===================================================================
-
-class raftRpc_Stub;
+// -------------------------------------------------------------------
 
-class raftRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
- protected:
-  // This class should be treated as an abstract interface.
-  inline raftRpc() {};
+class ReadIndexArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.ReadIndexArgs) */ {
  public:
-  virtual ~raftRpc();
-
-  typedef raftRpc_Stub Stub;
-
-  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+  inline ReadIndexArgs() : ReadIndexArgs(nullptr) {}
+  ~ReadIndexArgs() override;
+  explicit PROTOBUF_CONSTEXPR ReadIndexArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  virtual void AppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::AppendEntriesArgs* request,
-                       ::raftRpcProctoc::AppendEntriesReply* response,
-                       ::google::protobuf::Closure* done);
-  virtual void InstallSnapshot(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::InstallSnapshotRequest* request,
-                       ::raftRpcProctoc::InstallSnapshotResponse* response,
-                       ::google::protobuf::Closure* done);
-  virtual void RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::RequestVoteArgs* request,
-                       ::raftRpcProctoc::RequestVoteReply* response,
-                       ::google::protobuf::Closure* done);
-
-  // implements Service ----------------------------------------------
-
-  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
-                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
-                  ::PROTOBUF_NAMESPACE_ID::Message* response,
-                  ::google::protobuf::Closure* done);
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  ReadIndexArgs(const ReadIndexArgs& from);
+  ReadIndexArgs(ReadIndexArgs&& from) noexcept
+    : ReadIndexArgs() {
+    *this = ::std::move(from);
+  }
 
- private:
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(raftRpc);
-};
+  inline ReadIndexArgs& operator=(const ReadIndexArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadIndexArgs& operator=(ReadIndexArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-class raftRpc_Stub : public raftRpc {
- public:
-  raftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
-  raftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
-                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
-  ~raftRpc_Stub();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadIndexArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadIndexArgs* internal_default_instance() {
+    return reinterpret_cast<const ReadIndexArgs*>(
+               &_ReadIndexArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+  friend void swap(ReadIndexArgs& a, ReadIndexArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadIndexArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadIndexArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  // implements raftRpc ------------------------------------------
+  // implements Message ----------------------------------------------
 
-  void AppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::AppendEntriesArgs* request,
-                       ::raftRpcProctoc::AppendEntriesReply* response,
-                       ::google::protobuf::Closure* done);
-  void InstallSnapshot(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::InstallSnapshotRequest* request,
-                       ::raftRpcProctoc::InstallSnapshotResponse* response,
-                       ::google::protobuf::Closure* done);
-  void RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::raftRpcProctoc::RequestVoteArgs* request,
-                       ::raftRpcProctoc::RequestVoteReply* response,
-                       ::google::protobuf::Closure* done);
- private:
-  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
-  bool owns_channel_;
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(raftRpc_Stub);
-};
+  ReadIndexArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadIndexArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadIndexArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadIndexArgs& from) {
+    ReadIndexArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// ===================================================================
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadIndexArgs* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.ReadIndexArgs";
+  }
+  protected:
+  explicit ReadIndexArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-// ===================================================================
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// LogEntry
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-// bytes Command = 1;
-inline void LogEntry::clear_command() {
-  command_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& LogEntry::command() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.Command)
-  return _internal_command();
-}
-inline void LogEntry::set_command(const std::string& value) {
-  _internal_set_command(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.Command)
-}
-inline std::string* LogEntry::mutable_command() {
-  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.LogEntry.Command)
-  return _internal_mutable_command();
-}
-inline const std::string& LogEntry::_internal_command() const {
-  return command_.Get();
-}
-inline void LogEntry::_internal_set_command(const std::string& value) {
+  // nested types ----------------------------------------------------
 
-  command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void LogEntry::set_command(std::string&& value) {
+  // accessors -------------------------------------------------------
 
-  command_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftRpcProctoc.LogEntry.Command)
-}
-inline void LogEntry::set_command(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+  enum : int {
+    kTermFieldNumber = 1,
+    kGroupIdFieldNumber = 2,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
 
-  command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftRpcProctoc.LogEntry.Command)
-}
-inline void LogEntry::set_command(const void* value,
-    size_t size) {
+  // int32 GroupId = 2;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
 
-  command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftRpcProctoc.LogEntry.Command)
-}
-inline std::string* LogEntry::_internal_mutable_command() {
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.ReadIndexArgs)
+ private:
+  class _Internal;
 
-  return command_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* LogEntry::release_command() {
-  // @@protoc_insertion_point(field_release:raftRpcProctoc.LogEntry.Command)
-  return command_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void LogEntry::set_allocated_command(std::string* command) {
-  if (command != nullptr) {
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
 
-  } else {
+class ReadIndexReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.ReadIndexReply) */ {
+ public:
+  inline ReadIndexReply() : ReadIndexReply(nullptr) {}
+  ~ReadIndexReply() override;
+  explicit PROTOBUF_CONSTEXPR ReadIndexReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
+  ReadIndexReply(const ReadIndexReply& from);
+  ReadIndexReply(ReadIndexReply&& from) noexcept
+    : ReadIndexReply() {
+    *this = ::std::move(from);
   }
-  command_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), command,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.LogEntry.Command)
-}
-inline std::string* LogEntry::unsafe_arena_release_command() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftRpcProctoc.LogEntry.Command)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return command_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  inline ReadIndexReply& operator=(const ReadIndexReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadIndexReply& operator=(ReadIndexReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadIndexReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadIndexReply* internal_default_instance() {
+    return reinterpret_cast<const ReadIndexReply*>(
+               &_ReadIndexReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ReadIndexReply& a, ReadIndexReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadIndexReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadIndexReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadIndexReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadIndexReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadIndexReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadIndexReply& from) {
+    ReadIndexReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadIndexReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.ReadIndexReply";
+  }
+  protected:
+  explicit ReadIndexReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+    kReadIndexFieldNumber = 3,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // bool Success = 2;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // int32 ReadIndex = 3;
+  void clear_readindex();
+  int32_t readindex() const;
+  void set_readindex(int32_t value);
+  private:
+  int32_t _internal_readindex() const;
+  void _internal_set_readindex(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.ReadIndexReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    bool success_;
+    int32_t readindex_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TimeoutNowArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.TimeoutNowArgs) */ {
+ public:
+  inline TimeoutNowArgs() : TimeoutNowArgs(nullptr) {}
+  ~TimeoutNowArgs() override;
+  explicit PROTOBUF_CONSTEXPR TimeoutNowArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimeoutNowArgs(const TimeoutNowArgs& from);
+  TimeoutNowArgs(TimeoutNowArgs&& from) noexcept
+    : TimeoutNowArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline TimeoutNowArgs& operator=(const TimeoutNowArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimeoutNowArgs& operator=(TimeoutNowArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimeoutNowArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimeoutNowArgs* internal_default_instance() {
+    return reinterpret_cast<const TimeoutNowArgs*>(
+               &_TimeoutNowArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(TimeoutNowArgs& a, TimeoutNowArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeoutNowArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeoutNowArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TimeoutNowArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimeoutNowArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimeoutNowArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimeoutNowArgs& from) {
+    TimeoutNowArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeoutNowArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.TimeoutNowArgs";
+  }
+  protected:
+  explicit TimeoutNowArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+    kGroupIdFieldNumber = 3,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // int32 LeaderId = 2;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 GroupId = 3;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.TimeoutNowArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t leaderid_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TimeoutNowReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.TimeoutNowReply) */ {
+ public:
+  inline TimeoutNowReply() : TimeoutNowReply(nullptr) {}
+  ~TimeoutNowReply() override;
+  explicit PROTOBUF_CONSTEXPR TimeoutNowReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimeoutNowReply(const TimeoutNowReply& from);
+  TimeoutNowReply(TimeoutNowReply&& from) noexcept
+    : TimeoutNowReply() {
+    *this = ::std::move(from);
+  }
+
+  inline TimeoutNowReply& operator=(const TimeoutNowReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimeoutNowReply& operator=(TimeoutNowReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimeoutNowReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimeoutNowReply* internal_default_instance() {
+    return reinterpret_cast<const TimeoutNowReply*>(
+               &_TimeoutNowReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(TimeoutNowReply& a, TimeoutNowReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeoutNowReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeoutNowReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TimeoutNowReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimeoutNowReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimeoutNowReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimeoutNowReply& from) {
+    TimeoutNowReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeoutNowReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.TimeoutNowReply";
+  }
+  protected:
+  explicit TimeoutNowReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // bool Success = 2;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.TimeoutNowReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RangeAdminArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.RangeAdminArgs) */ {
+ public:
+  inline RangeAdminArgs() : RangeAdminArgs(nullptr) {}
+  ~RangeAdminArgs() override;
+  explicit PROTOBUF_CONSTEXPR RangeAdminArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RangeAdminArgs(const RangeAdminArgs& from);
+  RangeAdminArgs(RangeAdminArgs&& from) noexcept
+    : RangeAdminArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline RangeAdminArgs& operator=(const RangeAdminArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RangeAdminArgs& operator=(RangeAdminArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RangeAdminArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RangeAdminArgs* internal_default_instance() {
+    return reinterpret_cast<const RangeAdminArgs*>(
+               &_RangeAdminArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(RangeAdminArgs& a, RangeAdminArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RangeAdminArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RangeAdminArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RangeAdminArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RangeAdminArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RangeAdminArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RangeAdminArgs& from) {
+    RangeAdminArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RangeAdminArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.RangeAdminArgs";
+  }
+  protected:
+  explicit RangeAdminArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpFieldNumber = 2,
+    kStartFieldNumber = 5,
+    kEndFieldNumber = 6,
+    kDataFieldNumber = 7,
+    kGroupIdFieldNumber = 1,
+    kFromFieldNumber = 3,
+    kIdFieldNumber = 4,
+  };
+  // bytes Op = 2;
+  void clear_op();
+  const std::string& op() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_op();
+  PROTOBUF_NODISCARD std::string* release_op();
+  void set_allocated_op(std::string* op);
+  private:
+  const std::string& _internal_op() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
+  std::string* _internal_mutable_op();
+  public:
+
+  // bytes Start = 5;
+  void clear_start();
+  const std::string& start() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_start(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_start();
+  PROTOBUF_NODISCARD std::string* release_start();
+  void set_allocated_start(std::string* start);
+  private:
+  const std::string& _internal_start() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start(const std::string& value);
+  std::string* _internal_mutable_start();
+  public:
+
+  // bytes End = 6;
+  void clear_end();
+  const std::string& end() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_end(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_end();
+  PROTOBUF_NODISCARD std::string* release_end();
+  void set_allocated_end(std::string* end);
+  private:
+  const std::string& _internal_end() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end(const std::string& value);
+  std::string* _internal_mutable_end();
+  public:
+
+  // bytes Data = 7;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // int32 GroupId = 1;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // int32 From = 3;
+  void clear_from();
+  int32_t from() const;
+  void set_from(int32_t value);
+  private:
+  int32_t _internal_from() const;
+  void _internal_set_from(int32_t value);
+  public:
+
+  // int32 Id = 4;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.RangeAdminArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int32_t groupid_;
+    int32_t from_;
+    int32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RangeAdminReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProctoc.RangeAdminReply) */ {
+ public:
+  inline RangeAdminReply() : RangeAdminReply(nullptr) {}
+  ~RangeAdminReply() override;
+  explicit PROTOBUF_CONSTEXPR RangeAdminReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RangeAdminReply(const RangeAdminReply& from);
+  RangeAdminReply(RangeAdminReply&& from) noexcept
+    : RangeAdminReply() {
+    *this = ::std::move(from);
+  }
+
+  inline RangeAdminReply& operator=(const RangeAdminReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RangeAdminReply& operator=(RangeAdminReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RangeAdminReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RangeAdminReply* internal_default_instance() {
+    return reinterpret_cast<const RangeAdminReply*>(
+               &_RangeAdminReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(RangeAdminReply& a, RangeAdminReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RangeAdminReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RangeAdminReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RangeAdminReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RangeAdminReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RangeAdminReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RangeAdminReply& from) {
+    RangeAdminReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RangeAdminReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProctoc.RangeAdminReply";
+  }
+  protected:
+  explicit RangeAdminReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kLeaderIdFieldNumber = 3,
+    kLeaderTermFieldNumber = 4,
+  };
+  // bytes Err = 1;
+  void clear_err();
+  const std::string& err() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_err(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_err();
+  PROTOBUF_NODISCARD std::string* release_err();
+  void set_allocated_err(std::string* err);
+  private:
+  const std::string& _internal_err() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_err(const std::string& value);
+  std::string* _internal_mutable_err();
+  public:
+
+  // int32 Id = 2;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // int32 LeaderId = 3;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 LeaderTerm = 4;
+  void clear_leaderterm();
+  int32_t leaderterm() const;
+  void set_leaderterm(int32_t value);
+  private:
+  int32_t _internal_leaderterm() const;
+  void _internal_set_leaderterm(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProctoc.RangeAdminReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr err_;
+    int32_t id_;
+    int32_t leaderid_;
+    int32_t leaderterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// ===================================================================
+
+class raftRpc_Stub;
+
+class raftRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline raftRpc() {};
+ public:
+  virtual ~raftRpc();
+
+  typedef raftRpc_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void AppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::AppendEntriesArgs* request,
+                       ::raftRpcProctoc::AppendEntriesReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void InstallSnapshot(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::InstallSnapshotRequest* request,
+                       ::raftRpcProctoc::InstallSnapshotResponse* response,
+                       ::google::protobuf::Closure* done);
+  virtual void RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::RequestVoteArgs* request,
+                       ::raftRpcProctoc::RequestVoteReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void ReadIndex(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::ReadIndexArgs* request,
+                       ::raftRpcProctoc::ReadIndexReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::TimeoutNowArgs* request,
+                       ::raftRpcProctoc::TimeoutNowReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void RangeAdmin(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::RangeAdminArgs* request,
+                       ::raftRpcProctoc::RangeAdminReply* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(raftRpc);
+};
+
+class raftRpc_Stub : public raftRpc {
+ public:
+  raftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  raftRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~raftRpc_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements raftRpc ------------------------------------------
+
+  void AppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::AppendEntriesArgs* request,
+                       ::raftRpcProctoc::AppendEntriesReply* response,
+                       ::google::protobuf::Closure* done);
+  void InstallSnapshot(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::InstallSnapshotRequest* request,
+                       ::raftRpcProctoc::InstallSnapshotResponse* response,
+                       ::google::protobuf::Closure* done);
+  void RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::RequestVoteArgs* request,
+                       ::raftRpcProctoc::RequestVoteReply* response,
+                       ::google::protobuf::Closure* done);
+  void ReadIndex(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::ReadIndexArgs* request,
+                       ::raftRpcProctoc::ReadIndexReply* response,
+                       ::google::protobuf::Closure* done);
+  void TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::TimeoutNowArgs* request,
+                       ::raftRpcProctoc::TimeoutNowReply* response,
+                       ::google::protobuf::Closure* done);
+  void RangeAdmin(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProctoc::RangeAdminArgs* request,
+                       ::raftRpcProctoc::RangeAdminReply* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(raftRpc_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Member
+
+// int32 Id = 1;
+inline void Member::clear_id() {
+  _impl_.id_ = 0;
+}
+inline int32_t Member::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Member::id() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.Member.Id)
+  return _internal_id();
+}
+inline void Member::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Member::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.Member.Id)
+}
+
+// bytes Ip = 2;
+inline void Member::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+}
+inline const std::string& Member::ip() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.Member.Ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Member::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.Member.Ip)
+}
+inline std::string* Member::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.Member.Ip)
+  return _s;
+}
+inline const std::string& Member::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void Member::_internal_set_ip(const std::string& value) {
+  
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Member::_internal_mutable_ip() {
+  
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Member::release_ip() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.Member.Ip)
+  return _impl_.ip_.Release();
+}
+inline void Member::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.Member.Ip)
+}
+
+// int32 Port = 3;
+inline void Member::clear_port() {
+  _impl_.port_ = 0;
+}
+inline int32_t Member::_internal_port() const {
+  return _impl_.port_;
+}
+inline int32_t Member::port() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.Member.Port)
+  return _internal_port();
+}
+inline void Member::_internal_set_port(int32_t value) {
+  
+  _impl_.port_ = value;
+}
+inline void Member::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.Member.Port)
+}
+
+// bool Learner = 4;
+inline void Member::clear_learner() {
+  _impl_.learner_ = false;
+}
+inline bool Member::_internal_learner() const {
+  return _impl_.learner_;
+}
+inline bool Member::learner() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.Member.Learner)
+  return _internal_learner();
+}
+inline void Member::_internal_set_learner(bool value) {
+  
+  _impl_.learner_ = value;
+}
+inline void Member::set_learner(bool value) {
+  _internal_set_learner(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.Member.Learner)
+}
+
+// -------------------------------------------------------------------
+
+// Membership
+
+// repeated .raftRpcProctoc.Member Members = 1;
+inline int Membership::_internal_members_size() const {
+  return _impl_.members_.size();
+}
+inline int Membership::members_size() const {
+  return _internal_members_size();
+}
+inline void Membership::clear_members() {
+  _impl_.members_.Clear();
+}
+inline ::raftRpcProctoc::Member* Membership::mutable_members(int index) {
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.Membership.Members)
+  return _impl_.members_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member >*
+Membership::mutable_members() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProctoc.Membership.Members)
+  return &_impl_.members_;
+}
+inline const ::raftRpcProctoc::Member& Membership::_internal_members(int index) const {
+  return _impl_.members_.Get(index);
+}
+inline const ::raftRpcProctoc::Member& Membership::members(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.Membership.Members)
+  return _internal_members(index);
+}
+inline ::raftRpcProctoc::Member* Membership::_internal_add_members() {
+  return _impl_.members_.Add();
+}
+inline ::raftRpcProctoc::Member* Membership::add_members() {
+  ::raftRpcProctoc::Member* _add = _internal_add_members();
+  // @@protoc_insertion_point(field_add:raftRpcProctoc.Membership.Members)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::Member >&
+Membership::members() const {
+  // @@protoc_insertion_point(field_list:raftRpcProctoc.Membership.Members)
+  return _impl_.members_;
+}
+
+// -------------------------------------------------------------------
+
+// LogEntry
+
+// bytes Command = 1;
+inline void LogEntry::clear_command() {
+  _impl_.command_.ClearToEmpty();
+}
+inline const std::string& LogEntry::command() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.Command)
+  return _internal_command();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogEntry::set_command(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.command_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.Command)
+}
+inline std::string* LogEntry::mutable_command() {
+  std::string* _s = _internal_mutable_command();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.LogEntry.Command)
+  return _s;
+}
+inline const std::string& LogEntry::_internal_command() const {
+  return _impl_.command_.Get();
+}
+inline void LogEntry::_internal_set_command(const std::string& value) {
+  
+  _impl_.command_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogEntry::_internal_mutable_command() {
+  
+  return _impl_.command_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogEntry::release_command() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.LogEntry.Command)
+  return _impl_.command_.Release();
+}
+inline void LogEntry::set_allocated_command(std::string* command) {
+  if (command != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.LogEntry.Command)
+}
+
+// int32 LogTerm = 2;
+inline void LogEntry::clear_logterm() {
+  _impl_.logterm_ = 0;
+}
+inline int32_t LogEntry::_internal_logterm() const {
+  return _impl_.logterm_;
+}
+inline int32_t LogEntry::logterm() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogTerm)
+  return _internal_logterm();
+}
+inline void LogEntry::_internal_set_logterm(int32_t value) {
+  
+  _impl_.logterm_ = value;
+}
+inline void LogEntry::set_logterm(int32_t value) {
+  _internal_set_logterm(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogTerm)
+}
+
+// int32 LogIndex = 3;
+inline void LogEntry::clear_logindex() {
+  _impl_.logindex_ = 0;
+}
+inline int32_t LogEntry::_internal_logindex() const {
+  return _impl_.logindex_;
+}
+inline int32_t LogEntry::logindex() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogIndex)
+  return _internal_logindex();
+}
+inline void LogEntry::_internal_set_logindex(int32_t value) {
+  
+  _impl_.logindex_ = value;
+}
+inline void LogEntry::set_logindex(int32_t value) {
+  _internal_set_logindex(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogIndex)
+}
+
+// .raftRpcProctoc.Membership Config = 4;
+inline bool LogEntry::_internal_has_config() const {
+  return this != internal_default_instance() && _impl_.config_ != nullptr;
+}
+inline bool LogEntry::has_config() const {
+  return _internal_has_config();
+}
+inline void LogEntry::clear_config() {
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+}
+inline const ::raftRpcProctoc::Membership& LogEntry::_internal_config() const {
+  const ::raftRpcProctoc::Membership* p = _impl_.config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::raftRpcProctoc::Membership&>(
+      ::raftRpcProctoc::_Membership_default_instance_);
+}
+inline const ::raftRpcProctoc::Membership& LogEntry::config() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.Config)
+  return _internal_config();
+}
+inline void LogEntry::unsafe_arena_set_allocated_config(
+    ::raftRpcProctoc::Membership* config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_);
+  }
+  _impl_.config_ = config;
+  if (config) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProctoc.LogEntry.Config)
+}
+inline ::raftRpcProctoc::Membership* LogEntry::release_config() {
+  
+  ::raftRpcProctoc::Membership* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::raftRpcProctoc::Membership* LogEntry::unsafe_arena_release_config() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.LogEntry.Config)
+  
+  ::raftRpcProctoc::Membership* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+  return temp;
+}
+inline ::raftRpcProctoc::Membership* LogEntry::_internal_mutable_config() {
+  
+  if (_impl_.config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::raftRpcProctoc::Membership>(GetArenaForAllocation());
+    _impl_.config_ = p;
+  }
+  return _impl_.config_;
+}
+inline ::raftRpcProctoc::Membership* LogEntry::mutable_config() {
+  ::raftRpcProctoc::Membership* _msg = _internal_mutable_config();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.LogEntry.Config)
+  return _msg;
+}
+inline void LogEntry::set_allocated_config(::raftRpcProctoc::Membership* config) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.config_;
+  }
+  if (config) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config);
+    if (message_arena != submessage_arena) {
+      config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, config, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.config_ = config;
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.LogEntry.Config)
+}
+
+// -------------------------------------------------------------------
+
+// AppendEntriesArgs
+
+// int32 Term = 1;
+inline void AppendEntriesArgs::clear_term() {
+  _impl_.term_ = 0;
+}
+inline int32_t AppendEntriesArgs::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t AppendEntriesArgs::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.Term)
+  return _internal_term();
+}
+inline void AppendEntriesArgs::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void AppendEntriesArgs::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.Term)
+}
+
+// int32 LeaderId = 2;
+inline void AppendEntriesArgs::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t AppendEntriesArgs::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t AppendEntriesArgs::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.LeaderId)
+  return _internal_leaderid();
+}
+inline void AppendEntriesArgs::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void AppendEntriesArgs::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.LeaderId)
+}
+
+// int32 PrevLogIndex = 3;
+inline void AppendEntriesArgs::clear_prevlogindex() {
+  _impl_.prevlogindex_ = 0;
+}
+inline int32_t AppendEntriesArgs::_internal_prevlogindex() const {
+  return _impl_.prevlogindex_;
+}
+inline int32_t AppendEntriesArgs::prevlogindex() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.PrevLogIndex)
+  return _internal_prevlogindex();
+}
+inline void AppendEntriesArgs::_internal_set_prevlogindex(int32_t value) {
+  
+  _impl_.prevlogindex_ = value;
+}
+inline void AppendEntriesArgs::set_prevlogindex(int32_t value) {
+  _internal_set_prevlogindex(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.PrevLogIndex)
+}
+
+// int32 PrevLogTerm = 4;
+inline void AppendEntriesArgs::clear_prevlogterm() {
+  _impl_.prevlogterm_ = 0;
+}
+inline int32_t AppendEntriesArgs::_internal_prevlogterm() const {
+  return _impl_.prevlogterm_;
+}
+inline int32_t AppendEntriesArgs::prevlogterm() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.PrevLogTerm)
+  return _internal_prevlogterm();
+}
+inline void AppendEntriesArgs::_internal_set_prevlogterm(int32_t value) {
+  
+  _impl_.prevlogterm_ = value;
+}
+inline void AppendEntriesArgs::set_prevlogterm(int32_t value) {
+  _internal_set_prevlogterm(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.PrevLogTerm)
+}
+
+// repeated .raftRpcProctoc.LogEntry Entries = 5;
+inline int AppendEntriesArgs::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int AppendEntriesArgs::entries_size() const {
+  return _internal_entries_size();
+}
+inline void AppendEntriesArgs::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.AppendEntriesArgs.Entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry >*
+AppendEntriesArgs::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProctoc.AppendEntriesArgs.Entries)
+  return &_impl_.entries_;
+}
+inline const ::raftRpcProctoc::LogEntry& AppendEntriesArgs::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::raftRpcProctoc::LogEntry& AppendEntriesArgs::entries(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.Entries)
+  return _internal_entries(index);
+}
+inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::add_entries() {
+  ::raftRpcProctoc::LogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:raftRpcProctoc.AppendEntriesArgs.Entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry >&
+AppendEntriesArgs::entries() const {
+  // @@protoc_insertion_point(field_list:raftRpcProctoc.AppendEntriesArgs.Entries)
+  return _impl_.entries_;
+}
+
+// int32 LeaderCommit = 6;
+inline void AppendEntriesArgs::clear_leadercommit() {
+  _impl_.leadercommit_ = 0;
+}
+inline int32_t AppendEntriesArgs::_internal_leadercommit() const {
+  return _impl_.leadercommit_;
+}
+inline int32_t AppendEntriesArgs::leadercommit() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.LeaderCommit)
+  return _internal_leadercommit();
+}
+inline void AppendEntriesArgs::_internal_set_leadercommit(int32_t value) {
+  
+  _impl_.leadercommit_ = value;
+}
+inline void AppendEntriesArgs::set_leadercommit(int32_t value) {
+  _internal_set_leadercommit(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.LeaderCommit)
+}
+
+// int32 GroupId = 7;
+inline void AppendEntriesArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t AppendEntriesArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t AppendEntriesArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.GroupId)
+  return _internal_groupid();
+}
+inline void AppendEntriesArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void AppendEntriesArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.GroupId)
+}
+
+// -------------------------------------------------------------------
+
+// AppendEntriesReply
+
+// int32 Term = 1;
+inline void AppendEntriesReply::clear_term() {
+  _impl_.term_ = 0;
+}
+inline int32_t AppendEntriesReply::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t AppendEntriesReply::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.Term)
+  return _internal_term();
+}
+inline void AppendEntriesReply::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void AppendEntriesReply::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.Term)
 }
-inline void LogEntry::unsafe_arena_set_allocated_command(
-    std::string* command) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (command != nullptr) {
 
-  } else {
+// bool Success = 2;
+inline void AppendEntriesReply::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool AppendEntriesReply::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool AppendEntriesReply::success() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.Success)
+  return _internal_success();
+}
+inline void AppendEntriesReply::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void AppendEntriesReply::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.Success)
+}
 
-  }
-  command_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      command, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProctoc.LogEntry.Command)
+// int32 UpdateNextIndex = 3;
+inline void AppendEntriesReply::clear_updatenextindex() {
+  _impl_.updatenextindex_ = 0;
+}
+inline int32_t AppendEntriesReply::_internal_updatenextindex() const {
+  return _impl_.updatenextindex_;
+}
+inline int32_t AppendEntriesReply::updatenextindex() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.UpdateNextIndex)
+  return _internal_updatenextindex();
+}
+inline void AppendEntriesReply::_internal_set_updatenextindex(int32_t value) {
+  
+  _impl_.updatenextindex_ = value;
+}
+inline void AppendEntriesReply::set_updatenextindex(int32_t value) {
+  _internal_set_updatenextindex(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.UpdateNextIndex)
 }
 
-// int32 LogTerm = 2;
-inline void LogEntry::clear_logterm() {
-  logterm_ = 0;
+// int32 AppState = 4;
+inline void AppendEntriesReply::clear_appstate() {
+  _impl_.appstate_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::_internal_logterm() const {
-  return logterm_;
+inline int32_t AppendEntriesReply::_internal_appstate() const {
+  return _impl_.appstate_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::logterm() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogTerm)
-  return _internal_logterm();
+inline int32_t AppendEntriesReply::appstate() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.AppState)
+  return _internal_appstate();
+}
+inline void AppendEntriesReply::_internal_set_appstate(int32_t value) {
+  
+  _impl_.appstate_ = value;
+}
+inline void AppendEntriesReply::set_appstate(int32_t value) {
+  _internal_set_appstate(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.AppState)
 }
-inline void LogEntry::_internal_set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  logterm_ = value;
+// int32 ConflictTerm = 5;
+inline void AppendEntriesReply::clear_conflictterm() {
+  _impl_.conflictterm_ = 0;
 }
-inline void LogEntry::set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_logterm(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogTerm)
+inline int32_t AppendEntriesReply::_internal_conflictterm() const {
+  return _impl_.conflictterm_;
+}
+inline int32_t AppendEntriesReply::conflictterm() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.ConflictTerm)
+  return _internal_conflictterm();
+}
+inline void AppendEntriesReply::_internal_set_conflictterm(int32_t value) {
+  
+  _impl_.conflictterm_ = value;
+}
+inline void AppendEntriesReply::set_conflictterm(int32_t value) {
+  _internal_set_conflictterm(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.ConflictTerm)
 }
 
-// int32 LogIndex = 3;
-inline void LogEntry::clear_logindex() {
-  logindex_ = 0;
+// -------------------------------------------------------------------
+
+// RequestVoteArgs
+
+// int32 Term = 1;
+inline void RequestVoteArgs::clear_term() {
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::_internal_logindex() const {
-  return logindex_;
+inline int32_t RequestVoteArgs::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::logindex() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.LogEntry.LogIndex)
-  return _internal_logindex();
+inline int32_t RequestVoteArgs::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.Term)
+  return _internal_term();
+}
+inline void RequestVoteArgs::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void RequestVoteArgs::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.Term)
 }
-inline void LogEntry::_internal_set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  logindex_ = value;
+// int32 CandidateId = 2;
+inline void RequestVoteArgs::clear_candidateid() {
+  _impl_.candidateid_ = 0;
 }
-inline void LogEntry::set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_logindex(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.LogEntry.LogIndex)
+inline int32_t RequestVoteArgs::_internal_candidateid() const {
+  return _impl_.candidateid_;
+}
+inline int32_t RequestVoteArgs::candidateid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.CandidateId)
+  return _internal_candidateid();
+}
+inline void RequestVoteArgs::_internal_set_candidateid(int32_t value) {
+  
+  _impl_.candidateid_ = value;
+}
+inline void RequestVoteArgs::set_candidateid(int32_t value) {
+  _internal_set_candidateid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.CandidateId)
+}
+
+// int32 LastLogIndex = 3;
+inline void RequestVoteArgs::clear_lastlogindex() {
+  _impl_.lastlogindex_ = 0;
+}
+inline int32_t RequestVoteArgs::_internal_lastlogindex() const {
+  return _impl_.lastlogindex_;
+}
+inline int32_t RequestVoteArgs::lastlogindex() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LastLogIndex)
+  return _internal_lastlogindex();
+}
+inline void RequestVoteArgs::_internal_set_lastlogindex(int32_t value) {
+  
+  _impl_.lastlogindex_ = value;
+}
+inline void RequestVoteArgs::set_lastlogindex(int32_t value) {
+  _internal_set_lastlogindex(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LastLogIndex)
+}
+
+// int32 LastLogTerm = 4;
+inline void RequestVoteArgs::clear_lastlogterm() {
+  _impl_.lastlogterm_ = 0;
+}
+inline int32_t RequestVoteArgs::_internal_lastlogterm() const {
+  return _impl_.lastlogterm_;
+}
+inline int32_t RequestVoteArgs::lastlogterm() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LastLogTerm)
+  return _internal_lastlogterm();
+}
+inline void RequestVoteArgs::_internal_set_lastlogterm(int32_t value) {
+  
+  _impl_.lastlogterm_ = value;
+}
+inline void RequestVoteArgs::set_lastlogterm(int32_t value) {
+  _internal_set_lastlogterm(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LastLogTerm)
+}
+
+// int32 GroupId = 5;
+inline void RequestVoteArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t RequestVoteArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t RequestVoteArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.GroupId)
+  return _internal_groupid();
+}
+inline void RequestVoteArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void RequestVoteArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.GroupId)
+}
+
+// bool LeaderTransfer = 6;
+inline void RequestVoteArgs::clear_leadertransfer() {
+  _impl_.leadertransfer_ = false;
+}
+inline bool RequestVoteArgs::_internal_leadertransfer() const {
+  return _impl_.leadertransfer_;
+}
+inline bool RequestVoteArgs::leadertransfer() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LeaderTransfer)
+  return _internal_leadertransfer();
+}
+inline void RequestVoteArgs::_internal_set_leadertransfer(bool value) {
+  
+  _impl_.leadertransfer_ = value;
+}
+inline void RequestVoteArgs::set_leadertransfer(bool value) {
+  _internal_set_leadertransfer(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LeaderTransfer)
+}
+
+// bool PreVote = 7;
+inline void RequestVoteArgs::clear_prevote() {
+  _impl_.prevote_ = false;
+}
+inline bool RequestVoteArgs::_internal_prevote() const {
+  return _impl_.prevote_;
+}
+inline bool RequestVoteArgs::prevote() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.PreVote)
+  return _internal_prevote();
+}
+inline void RequestVoteArgs::_internal_set_prevote(bool value) {
+  
+  _impl_.prevote_ = value;
+}
+inline void RequestVoteArgs::set_prevote(bool value) {
+  _internal_set_prevote(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.PreVote)
 }
 
 // -------------------------------------------------------------------
 
-// AppendEntriesArgs
+// RequestVoteReply
 
 // int32 Term = 1;
-inline void AppendEntriesArgs::clear_term() {
-  term_ = 0;
+inline void RequestVoteReply::clear_term() {
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_term() const {
-  return term_;
+inline int32_t RequestVoteReply::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::term() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.Term)
+inline int32_t RequestVoteReply::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.Term)
   return _internal_term();
 }
-inline void AppendEntriesArgs::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void RequestVoteReply::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void AppendEntriesArgs::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::set_term(int32_t value) {
   _internal_set_term(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.Term)
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.Term)
 }
 
-// int32 LeaderId = 2;
-inline void AppendEntriesArgs::clear_leaderid() {
-  leaderid_ = 0;
+// bool VoteGranted = 2;
+inline void RequestVoteReply::clear_votegranted() {
+  _impl_.votegranted_ = false;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_leaderid() const {
-  return leaderid_;
+inline bool RequestVoteReply::_internal_votegranted() const {
+  return _impl_.votegranted_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::leaderid() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.LeaderId)
-  return _internal_leaderid();
+inline bool RequestVoteReply::votegranted() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.VoteGranted)
+  return _internal_votegranted();
+}
+inline void RequestVoteReply::_internal_set_votegranted(bool value) {
+  
+  _impl_.votegranted_ = value;
+}
+inline void RequestVoteReply::set_votegranted(bool value) {
+  _internal_set_votegranted(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.VoteGranted)
 }
-inline void AppendEntriesArgs::_internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  leaderid_ = value;
+// int32 VoteState = 3;
+inline void RequestVoteReply::clear_votestate() {
+  _impl_.votestate_ = 0;
+}
+inline int32_t RequestVoteReply::_internal_votestate() const {
+  return _impl_.votestate_;
+}
+inline int32_t RequestVoteReply::votestate() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.VoteState)
+  return _internal_votestate();
+}
+inline void RequestVoteReply::_internal_set_votestate(int32_t value) {
+  
+  _impl_.votestate_ = value;
+}
+inline void RequestVoteReply::set_votestate(int32_t value) {
+  _internal_set_votestate(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.VoteState)
+}
+
+// -------------------------------------------------------------------
+
+// InstallSnapshotRequest
+
+// int32 LeaderId = 1;
+inline void InstallSnapshotRequest::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t InstallSnapshotRequest::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t InstallSnapshotRequest::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LeaderId)
+  return _internal_leaderid();
 }
-inline void AppendEntriesArgs::set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void InstallSnapshotRequest::set_leaderid(int32_t value) {
   _internal_set_leaderid(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.LeaderId)
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LeaderId)
 }
 
-// int32 PrevLogIndex = 3;
-inline void AppendEntriesArgs::clear_prevlogindex() {
-  prevlogindex_ = 0;
+// int32 Term = 2;
+inline void InstallSnapshotRequest::clear_term() {
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_prevlogindex() const {
-  return prevlogindex_;
+inline int32_t InstallSnapshotRequest::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::prevlogindex() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.PrevLogIndex)
-  return _internal_prevlogindex();
+inline int32_t InstallSnapshotRequest::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Term)
+  return _internal_term();
+}
+inline void InstallSnapshotRequest::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void InstallSnapshotRequest::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Term)
 }
-inline void AppendEntriesArgs::_internal_set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  prevlogindex_ = value;
+// int32 LastSnapShotIncludeIndex = 3;
+inline void InstallSnapshotRequest::clear_lastsnapshotincludeindex() {
+  _impl_.lastsnapshotincludeindex_ = 0;
 }
-inline void AppendEntriesArgs::set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_prevlogindex(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.PrevLogIndex)
+inline int32_t InstallSnapshotRequest::_internal_lastsnapshotincludeindex() const {
+  return _impl_.lastsnapshotincludeindex_;
+}
+inline int32_t InstallSnapshotRequest::lastsnapshotincludeindex() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeIndex)
+  return _internal_lastsnapshotincludeindex();
+}
+inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeindex(int32_t value) {
+  
+  _impl_.lastsnapshotincludeindex_ = value;
+}
+inline void InstallSnapshotRequest::set_lastsnapshotincludeindex(int32_t value) {
+  _internal_set_lastsnapshotincludeindex(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeIndex)
 }
 
-// int32 PrevLogTerm = 4;
-inline void AppendEntriesArgs::clear_prevlogterm() {
-  prevlogterm_ = 0;
+// int32 LastSnapShotIncludeTerm = 4;
+inline void InstallSnapshotRequest::clear_lastsnapshotincludeterm() {
+  _impl_.lastsnapshotincludeterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_prevlogterm() const {
-  return prevlogterm_;
+inline int32_t InstallSnapshotRequest::_internal_lastsnapshotincludeterm() const {
+  return _impl_.lastsnapshotincludeterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::prevlogterm() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.PrevLogTerm)
-  return _internal_prevlogterm();
+inline int32_t InstallSnapshotRequest::lastsnapshotincludeterm() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeTerm)
+  return _internal_lastsnapshotincludeterm();
+}
+inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeterm(int32_t value) {
+  
+  _impl_.lastsnapshotincludeterm_ = value;
+}
+inline void InstallSnapshotRequest::set_lastsnapshotincludeterm(int32_t value) {
+  _internal_set_lastsnapshotincludeterm(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeTerm)
 }
-inline void AppendEntriesArgs::_internal_set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  prevlogterm_ = value;
+// bytes Data = 5;
+inline void InstallSnapshotRequest::clear_data() {
+  _impl_.data_.ClearToEmpty();
 }
-inline void AppendEntriesArgs::set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_prevlogterm(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.PrevLogTerm)
+inline const std::string& InstallSnapshotRequest::data() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InstallSnapshotRequest::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Data)
+}
+inline std::string* InstallSnapshotRequest::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.InstallSnapshotRequest.Data)
+  return _s;
+}
+inline const std::string& InstallSnapshotRequest::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void InstallSnapshotRequest::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InstallSnapshotRequest::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InstallSnapshotRequest::release_data() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.InstallSnapshotRequest.Data)
+  return _impl_.data_.Release();
+}
+inline void InstallSnapshotRequest::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.InstallSnapshotRequest.Data)
 }
 
-// repeated .raftRpcProctoc.LogEntry Entries = 5;
-inline int AppendEntriesArgs::_internal_entries_size() const {
-  return entries_.size();
+// int64 Offset = 6;
+inline void InstallSnapshotRequest::clear_offset() {
+  _impl_.offset_ = int64_t{0};
 }
-inline int AppendEntriesArgs::entries_size() const {
-  return _internal_entries_size();
+inline int64_t InstallSnapshotRequest::_internal_offset() const {
+  return _impl_.offset_;
 }
-inline void AppendEntriesArgs::clear_entries() {
-  entries_.Clear();
+inline int64_t InstallSnapshotRequest::offset() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Offset)
+  return _internal_offset();
 }
-inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::mutable_entries(int index) {
-  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return entries_.Mutable(index);
+inline void InstallSnapshotRequest::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry >*
-AppendEntriesArgs::mutable_entries() {
-  // @@protoc_insertion_point(field_mutable_list:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return &entries_;
+inline void InstallSnapshotRequest::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Offset)
 }
-inline const ::raftRpcProctoc::LogEntry& AppendEntriesArgs::_internal_entries(int index) const {
-  return entries_.Get(index);
+
+// bool Done = 7;
+inline void InstallSnapshotRequest::clear_done() {
+  _impl_.done_ = false;
 }
-inline const ::raftRpcProctoc::LogEntry& AppendEntriesArgs::entries(int index) const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return _internal_entries(index);
+inline bool InstallSnapshotRequest::_internal_done() const {
+  return _impl_.done_;
 }
-inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::_internal_add_entries() {
-  return entries_.Add();
+inline bool InstallSnapshotRequest::done() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Done)
+  return _internal_done();
 }
-inline ::raftRpcProctoc::LogEntry* AppendEntriesArgs::add_entries() {
-  // @@protoc_insertion_point(field_add:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return _internal_add_entries();
+inline void InstallSnapshotRequest::_internal_set_done(bool value) {
+  
+  _impl_.done_ = value;
+}
+inline void InstallSnapshotRequest::set_done(bool value) {
+  _internal_set_done(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Done)
+}
+
+// uint32 Crc = 8;
+inline void InstallSnapshotRequest::clear_crc() {
+  _impl_.crc_ = 0u;
+}
+inline uint32_t InstallSnapshotRequest::_internal_crc() const {
+  return _impl_.crc_;
+}
+inline uint32_t InstallSnapshotRequest::crc() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Crc)
+  return _internal_crc();
+}
+inline void InstallSnapshotRequest::_internal_set_crc(uint32_t value) {
+  
+  _impl_.crc_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProctoc::LogEntry >&
-AppendEntriesArgs::entries() const {
-  // @@protoc_insertion_point(field_list:raftRpcProctoc.AppendEntriesArgs.Entries)
-  return entries_;
+inline void InstallSnapshotRequest::set_crc(uint32_t value) {
+  _internal_set_crc(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Crc)
 }
 
-// int32 LeaderCommit = 6;
-inline void AppendEntriesArgs::clear_leadercommit() {
-  leadercommit_ = 0;
+// int32 GroupId = 9;
+inline void InstallSnapshotRequest::clear_groupid() {
+  _impl_.groupid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_leadercommit() const {
-  return leadercommit_;
+inline int32_t InstallSnapshotRequest::_internal_groupid() const {
+  return _impl_.groupid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::leadercommit() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesArgs.LeaderCommit)
-  return _internal_leadercommit();
+inline int32_t InstallSnapshotRequest::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.GroupId)
+  return _internal_groupid();
 }
-inline void AppendEntriesArgs::_internal_set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  leadercommit_ = value;
+inline void InstallSnapshotRequest::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
 }
-inline void AppendEntriesArgs::set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_leadercommit(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesArgs.LeaderCommit)
+inline void InstallSnapshotRequest::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.GroupId)
 }
 
 // -------------------------------------------------------------------
 
-// AppendEntriesReply
+// InstallSnapshotResponse
 
 // int32 Term = 1;
-inline void AppendEntriesReply::clear_term() {
-  term_ = 0;
+inline void InstallSnapshotResponse::clear_term() {
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_term() const {
-  return term_;
+inline int32_t InstallSnapshotResponse::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::term() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.Term)
+inline int32_t InstallSnapshotResponse::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotResponse.Term)
   return _internal_term();
 }
-inline void AppendEntriesReply::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void InstallSnapshotResponse::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void AppendEntriesReply::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotResponse::set_term(int32_t value) {
   _internal_set_term(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.Term)
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotResponse.Term)
 }
 
-// bool Success = 2;
-inline void AppendEntriesReply::clear_success() {
-  success_ = false;
+// int64 NextOffset = 2;
+inline void InstallSnapshotResponse::clear_nextoffset() {
+  _impl_.nextoffset_ = int64_t{0};
 }
-inline bool AppendEntriesReply::_internal_success() const {
-  return success_;
+inline int64_t InstallSnapshotResponse::_internal_nextoffset() const {
+  return _impl_.nextoffset_;
 }
-inline bool AppendEntriesReply::success() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.Success)
-  return _internal_success();
+inline int64_t InstallSnapshotResponse::nextoffset() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotResponse.NextOffset)
+  return _internal_nextoffset();
 }
-inline void AppendEntriesReply::_internal_set_success(bool value) {
-
-  success_ = value;
+inline void InstallSnapshotResponse::_internal_set_nextoffset(int64_t value) {
+  
+  _impl_.nextoffset_ = value;
 }
-inline void AppendEntriesReply::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.Success)
+inline void InstallSnapshotResponse::set_nextoffset(int64_t value) {
+  _internal_set_nextoffset(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotResponse.NextOffset)
 }
 
-// int32 UpdateNextIndex = 3;
-inline void AppendEntriesReply::clear_updatenextindex() {
-  updatenextindex_ = 0;
+// bool Installed = 3;
+inline void InstallSnapshotResponse::clear_installed() {
+  _impl_.installed_ = false;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_updatenextindex() const {
-  return updatenextindex_;
+inline bool InstallSnapshotResponse::_internal_installed() const {
+  return _impl_.installed_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::updatenextindex() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.UpdateNextIndex)
-  return _internal_updatenextindex();
+inline bool InstallSnapshotResponse::installed() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotResponse.Installed)
+  return _internal_installed();
 }
-inline void AppendEntriesReply::_internal_set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  updatenextindex_ = value;
+inline void InstallSnapshotResponse::_internal_set_installed(bool value) {
+  
+  _impl_.installed_ = value;
 }
-inline void AppendEntriesReply::set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_updatenextindex(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.UpdateNextIndex)
+inline void InstallSnapshotResponse::set_installed(bool value) {
+  _internal_set_installed(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotResponse.Installed)
 }
 
-// int32 AppState = 4;
-inline void AppendEntriesReply::clear_appstate() {
-  appstate_ = 0;
+// -------------------------------------------------------------------
+
+// ReadIndexArgs
+
+// int32 Term = 1;
+inline void ReadIndexArgs::clear_term() {
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_appstate() const {
-  return appstate_;
+inline int32_t ReadIndexArgs::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::appstate() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.AppendEntriesReply.AppState)
-  return _internal_appstate();
+inline int32_t ReadIndexArgs::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.ReadIndexArgs.Term)
+  return _internal_term();
+}
+inline void ReadIndexArgs::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void ReadIndexArgs::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.ReadIndexArgs.Term)
 }
-inline void AppendEntriesReply::_internal_set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  appstate_ = value;
+// int32 GroupId = 2;
+inline void ReadIndexArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
 }
-inline void AppendEntriesReply::set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_appstate(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.AppendEntriesReply.AppState)
+inline int32_t ReadIndexArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t ReadIndexArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.ReadIndexArgs.GroupId)
+  return _internal_groupid();
+}
+inline void ReadIndexArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void ReadIndexArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.ReadIndexArgs.GroupId)
 }
 
 // -------------------------------------------------------------------
 
-// RequestVoteArgs
+// ReadIndexReply
 
 // int32 Term = 1;
-inline void RequestVoteArgs::clear_term() {
-  term_ = 0;
+inline void ReadIndexReply::clear_term() {
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_term() const {
-  return term_;
+inline int32_t ReadIndexReply::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::term() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.Term)
+inline int32_t ReadIndexReply::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.ReadIndexReply.Term)
   return _internal_term();
 }
-inline void RequestVoteArgs::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void ReadIndexReply::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void RequestVoteArgs::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void ReadIndexReply::set_term(int32_t value) {
   _internal_set_term(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.Term)
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.ReadIndexReply.Term)
 }
 
-// int32 CandidateId = 2;
-inline void RequestVoteArgs::clear_candidateid() {
-  candidateid_ = 0;
+// bool Success = 2;
+inline void ReadIndexReply::clear_success() {
+  _impl_.success_ = false;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_candidateid() const {
-  return candidateid_;
+inline bool ReadIndexReply::_internal_success() const {
+  return _impl_.success_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::candidateid() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.CandidateId)
-  return _internal_candidateid();
+inline bool ReadIndexReply::success() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.ReadIndexReply.Success)
+  return _internal_success();
 }
-inline void RequestVoteArgs::_internal_set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  candidateid_ = value;
+inline void ReadIndexReply::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
 }
-inline void RequestVoteArgs::set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_candidateid(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.CandidateId)
+inline void ReadIndexReply::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.ReadIndexReply.Success)
 }
 
-// int32 LastLogIndex = 3;
-inline void RequestVoteArgs::clear_lastlogindex() {
-  lastlogindex_ = 0;
+// int32 ReadIndex = 3;
+inline void ReadIndexReply::clear_readindex() {
+  _impl_.readindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_lastlogindex() const {
-  return lastlogindex_;
+inline int32_t ReadIndexReply::_internal_readindex() const {
+  return _impl_.readindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::lastlogindex() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LastLogIndex)
-  return _internal_lastlogindex();
+inline int32_t ReadIndexReply::readindex() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.ReadIndexReply.ReadIndex)
+  return _internal_readindex();
+}
+inline void ReadIndexReply::_internal_set_readindex(int32_t value) {
+  
+  _impl_.readindex_ = value;
 }
-inline void RequestVoteArgs::_internal_set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void ReadIndexReply::set_readindex(int32_t value) {
+  _internal_set_readindex(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.ReadIndexReply.ReadIndex)
+}
+
+// -------------------------------------------------------------------
+
+// TimeoutNowArgs
 
-  lastlogindex_ = value;
+// int32 Term = 1;
+inline void TimeoutNowArgs::clear_term() {
+  _impl_.term_ = 0;
 }
-inline void RequestVoteArgs::set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_lastlogindex(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LastLogIndex)
+inline int32_t TimeoutNowArgs::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t TimeoutNowArgs::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.TimeoutNowArgs.Term)
+  return _internal_term();
+}
+inline void TimeoutNowArgs::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void TimeoutNowArgs::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.TimeoutNowArgs.Term)
 }
 
-// int32 LastLogTerm = 4;
-inline void RequestVoteArgs::clear_lastlogterm() {
-  lastlogterm_ = 0;
+// int32 LeaderId = 2;
+inline void TimeoutNowArgs::clear_leaderid() {
+  _impl_.leaderid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_lastlogterm() const {
-  return lastlogterm_;
+inline int32_t TimeoutNowArgs::_internal_leaderid() const {
+  return _impl_.leaderid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::lastlogterm() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteArgs.LastLogTerm)
-  return _internal_lastlogterm();
+inline int32_t TimeoutNowArgs::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.TimeoutNowArgs.LeaderId)
+  return _internal_leaderid();
+}
+inline void TimeoutNowArgs::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void TimeoutNowArgs::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.TimeoutNowArgs.LeaderId)
 }
-inline void RequestVoteArgs::_internal_set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  lastlogterm_ = value;
+// int32 GroupId = 3;
+inline void TimeoutNowArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
 }
-inline void RequestVoteArgs::set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_lastlogterm(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteArgs.LastLogTerm)
+inline int32_t TimeoutNowArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t TimeoutNowArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.TimeoutNowArgs.GroupId)
+  return _internal_groupid();
+}
+inline void TimeoutNowArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void TimeoutNowArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.TimeoutNowArgs.GroupId)
 }
 
 // -------------------------------------------------------------------
 
-// RequestVoteReply
+// TimeoutNowReply
 
 // int32 Term = 1;
-inline void RequestVoteReply::clear_term() {
-  term_ = 0;
+inline void TimeoutNowReply::clear_term() {
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::_internal_term() const {
-  return term_;
+inline int32_t TimeoutNowReply::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::term() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.Term)
+inline int32_t TimeoutNowReply::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.TimeoutNowReply.Term)
   return _internal_term();
 }
-inline void RequestVoteReply::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  term_ = value;
+inline void TimeoutNowReply::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
 }
-inline void RequestVoteReply::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TimeoutNowReply::set_term(int32_t value) {
   _internal_set_term(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.Term)
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.TimeoutNowReply.Term)
 }
 
-// bool VoteGranted = 2;
-inline void RequestVoteReply::clear_votegranted() {
-  votegranted_ = false;
+// bool Success = 2;
+inline void TimeoutNowReply::clear_success() {
+  _impl_.success_ = false;
 }
-inline bool RequestVoteReply::_internal_votegranted() const {
-  return votegranted_;
+inline bool TimeoutNowReply::_internal_success() const {
+  return _impl_.success_;
 }
-inline bool RequestVoteReply::votegranted() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.VoteGranted)
-  return _internal_votegranted();
+inline bool TimeoutNowReply::success() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.TimeoutNowReply.Success)
+  return _internal_success();
 }
-inline void RequestVoteReply::_internal_set_votegranted(bool value) {
-
-  votegranted_ = value;
+inline void TimeoutNowReply::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
 }
-inline void RequestVoteReply::set_votegranted(bool value) {
-  _internal_set_votegranted(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.VoteGranted)
+inline void TimeoutNowReply::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.TimeoutNowReply.Success)
 }
 
-// int32 VoteState = 3;
-inline void RequestVoteReply::clear_votestate() {
-  votestate_ = 0;
+// -------------------------------------------------------------------
+
+// RangeAdminArgs
+
+// int32 GroupId = 1;
+inline void RangeAdminArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::_internal_votestate() const {
-  return votestate_;
+inline int32_t RangeAdminArgs::_internal_groupid() const {
+  return _impl_.groupid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::votestate() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.RequestVoteReply.VoteState)
-  return _internal_votestate();
+inline int32_t RangeAdminArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminArgs.GroupId)
+  return _internal_groupid();
 }
-inline void RequestVoteReply::_internal_set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  votestate_ = value;
+inline void RangeAdminArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
 }
-inline void RequestVoteReply::set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_votestate(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.RequestVoteReply.VoteState)
+inline void RangeAdminArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminArgs.GroupId)
 }
 
-// -------------------------------------------------------------------
-
-// InstallSnapshotRequest
-
-// int32 LeaderId = 1;
-inline void InstallSnapshotRequest::clear_leaderid() {
-  leaderid_ = 0;
+// bytes Op = 2;
+inline void RangeAdminArgs::clear_op() {
+  _impl_.op_.ClearToEmpty();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_leaderid() const {
-  return leaderid_;
+inline const std::string& RangeAdminArgs::op() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminArgs.Op)
+  return _internal_op();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::leaderid() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LeaderId)
-  return _internal_leaderid();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RangeAdminArgs::set_op(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.op_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminArgs.Op)
 }
-inline void InstallSnapshotRequest::_internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-
-  leaderid_ = value;
+inline std::string* RangeAdminArgs::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.RangeAdminArgs.Op)
+  return _s;
 }
-inline void InstallSnapshotRequest::set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_leaderid(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LeaderId)
+inline const std::string& RangeAdminArgs::_internal_op() const {
+  return _impl_.op_.Get();
 }
-
-// int32 Term = 2;
-inline void InstallSnapshotRequest::clear_term() {
-  term_ = 0;
+inline void RangeAdminArgs::_internal_set_op(const std::string& value) {
+  
+  _impl_.op_.Set(value, GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_term() const {
-  return term_;
+inline std::string* RangeAdminArgs::_internal_mutable_op() {
+  
+  return _impl_.op_.Mutable(GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::term() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Term)
-  return _internal_term();
+inline std::string* RangeAdminArgs::release_op() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.RangeAdminArgs.Op)
+  return _impl_.op_.Release();
+}
+inline void RangeAdminArgs::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.RangeAdminArgs.Op)
 }
-inline void InstallSnapshotRequest::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  term_ = value;
+// int32 From = 3;
+inline void RangeAdminArgs::clear_from() {
+  _impl_.from_ = 0;
 }
-inline void InstallSnapshotRequest::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_term(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Term)
+inline int32_t RangeAdminArgs::_internal_from() const {
+  return _impl_.from_;
 }
-
-// int32 LastSnapShotIncludeIndex = 3;
-inline void InstallSnapshotRequest::clear_lastsnapshotincludeindex() {
-  lastsnapshotincludeindex_ = 0;
+inline int32_t RangeAdminArgs::from() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminArgs.From)
+  return _internal_from();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_lastsnapshotincludeindex() const {
-  return lastsnapshotincludeindex_;
+inline void RangeAdminArgs::_internal_set_from(int32_t value) {
+  
+  _impl_.from_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::lastsnapshotincludeindex() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeIndex)
-  return _internal_lastsnapshotincludeindex();
+inline void RangeAdminArgs::set_from(int32_t value) {
+  _internal_set_from(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminArgs.From)
 }
-inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  lastsnapshotincludeindex_ = value;
+// int32 Id = 4;
+inline void RangeAdminArgs::clear_id() {
+  _impl_.id_ = 0;
 }
-inline void InstallSnapshotRequest::set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_lastsnapshotincludeindex(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeIndex)
+inline int32_t RangeAdminArgs::_internal_id() const {
+  return _impl_.id_;
 }
-
-// int32 LastSnapShotIncludeTerm = 4;
-inline void InstallSnapshotRequest::clear_lastsnapshotincludeterm() {
-  lastsnapshotincludeterm_ = 0;
+inline int32_t RangeAdminArgs::id() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminArgs.Id)
+  return _internal_id();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_lastsnapshotincludeterm() const {
-  return lastsnapshotincludeterm_;
+inline void RangeAdminArgs::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::lastsnapshotincludeterm() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeTerm)
-  return _internal_lastsnapshotincludeterm();
+inline void RangeAdminArgs::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminArgs.Id)
 }
-inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  lastsnapshotincludeterm_ = value;
+// bytes Start = 5;
+inline void RangeAdminArgs::clear_start() {
+  _impl_.start_.ClearToEmpty();
 }
-inline void InstallSnapshotRequest::set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_lastsnapshotincludeterm(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.LastSnapShotIncludeTerm)
+inline const std::string& RangeAdminArgs::start() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminArgs.Start)
+  return _internal_start();
 }
-
-// bytes Data = 5;
-inline void InstallSnapshotRequest::clear_data() {
-  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RangeAdminArgs::set_start(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.start_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminArgs.Start)
 }
-inline const std::string& InstallSnapshotRequest::data() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotRequest.Data)
-  return _internal_data();
+inline std::string* RangeAdminArgs::mutable_start() {
+  std::string* _s = _internal_mutable_start();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.RangeAdminArgs.Start)
+  return _s;
 }
-inline void InstallSnapshotRequest::set_data(const std::string& value) {
-  _internal_set_data(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotRequest.Data)
+inline const std::string& RangeAdminArgs::_internal_start() const {
+  return _impl_.start_.Get();
 }
-inline std::string* InstallSnapshotRequest::mutable_data() {
-  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.InstallSnapshotRequest.Data)
-  return _internal_mutable_data();
+inline void RangeAdminArgs::_internal_set_start(const std::string& value) {
+  
+  _impl_.start_.Set(value, GetArenaForAllocation());
 }
-inline const std::string& InstallSnapshotRequest::_internal_data() const {
-  return data_.Get();
+inline std::string* RangeAdminArgs::_internal_mutable_start() {
+  
+  return _impl_.start_.Mutable(GetArenaForAllocation());
 }
-inline void InstallSnapshotRequest::_internal_set_data(const std::string& value) {
-
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline std::string* RangeAdminArgs::release_start() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.RangeAdminArgs.Start)
+  return _impl_.start_.Release();
 }
-inline void InstallSnapshotRequest::set_data(std::string&& value) {
-
-  data_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftRpcProctoc.InstallSnapshotRequest.Data)
+inline void RangeAdminArgs::set_allocated_start(std::string* start) {
+  if (start != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.start_.SetAllocated(start, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.start_.IsDefault()) {
+    _impl_.start_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.RangeAdminArgs.Start)
 }
-inline void InstallSnapshotRequest::set_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
 
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftRpcProctoc.InstallSnapshotRequest.Data)
+// bytes End = 6;
+inline void RangeAdminArgs::clear_end() {
+  _impl_.end_.ClearToEmpty();
 }
-inline void InstallSnapshotRequest::set_data(const void* value,
-    size_t size) {
-
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftRpcProctoc.InstallSnapshotRequest.Data)
+inline const std::string& RangeAdminArgs::end() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminArgs.End)
+  return _internal_end();
 }
-inline std::string* InstallSnapshotRequest::_internal_mutable_data() {
-
-  return data_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RangeAdminArgs::set_end(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.end_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminArgs.End)
 }
-inline std::string* InstallSnapshotRequest::release_data() {
-  // @@protoc_insertion_point(field_release:raftRpcProctoc.InstallSnapshotRequest.Data)
-  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* RangeAdminArgs::mutable_end() {
+  std::string* _s = _internal_mutable_end();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.RangeAdminArgs.End)
+  return _s;
 }
-inline void InstallSnapshotRequest::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
-
+inline const std::string& RangeAdminArgs::_internal_end() const {
+  return _impl_.end_.Get();
+}
+inline void RangeAdminArgs::_internal_set_end(const std::string& value) {
+  
+  _impl_.end_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RangeAdminArgs::_internal_mutable_end() {
+  
+  return _impl_.end_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RangeAdminArgs::release_end() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.RangeAdminArgs.End)
+  return _impl_.end_.Release();
+}
+inline void RangeAdminArgs::set_allocated_end(std::string* end) {
+  if (end != nullptr) {
+    
   } else {
-
+    
   }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.InstallSnapshotRequest.Data)
+  _impl_.end_.SetAllocated(end, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_.IsDefault()) {
+    _impl_.end_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.RangeAdminArgs.End)
 }
-inline std::string* InstallSnapshotRequest::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftRpcProctoc.InstallSnapshotRequest.Data)
-  GOOGLE_DCHECK(GetArena() != nullptr);
 
-  return data_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+// bytes Data = 7;
+inline void RangeAdminArgs::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& RangeAdminArgs::data() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminArgs.Data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RangeAdminArgs::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminArgs.Data)
+}
+inline std::string* RangeAdminArgs::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.RangeAdminArgs.Data)
+  return _s;
 }
-inline void InstallSnapshotRequest::unsafe_arena_set_allocated_data(
-    std::string* data) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline const std::string& RangeAdminArgs::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void RangeAdminArgs::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RangeAdminArgs::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RangeAdminArgs::release_data() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.RangeAdminArgs.Data)
+  return _impl_.data_.Release();
+}
+inline void RangeAdminArgs::set_allocated_data(std::string* data) {
   if (data != nullptr) {
-
+    
   } else {
-
+    
   }
-  data_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      data, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProctoc.InstallSnapshotRequest.Data)
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.RangeAdminArgs.Data)
 }
 
 // -------------------------------------------------------------------
 
-// InstallSnapshotResponse
+// RangeAdminReply
 
-// int32 Term = 1;
-inline void InstallSnapshotResponse::clear_term() {
-  term_ = 0;
+// bytes Err = 1;
+inline void RangeAdminReply::clear_err() {
+  _impl_.err_.ClearToEmpty();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotResponse::_internal_term() const {
-  return term_;
+inline const std::string& RangeAdminReply::err() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminReply.Err)
+  return _internal_err();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotResponse::term() const {
-  // @@protoc_insertion_point(field_get:raftRpcProctoc.InstallSnapshotResponse.Term)
-  return _internal_term();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RangeAdminReply::set_err(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.err_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminReply.Err)
+}
+inline std::string* RangeAdminReply::mutable_err() {
+  std::string* _s = _internal_mutable_err();
+  // @@protoc_insertion_point(field_mutable:raftRpcProctoc.RangeAdminReply.Err)
+  return _s;
+}
+inline const std::string& RangeAdminReply::_internal_err() const {
+  return _impl_.err_.Get();
+}
+inline void RangeAdminReply::_internal_set_err(const std::string& value) {
+  
+  _impl_.err_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RangeAdminReply::_internal_mutable_err() {
+  
+  return _impl_.err_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RangeAdminReply::release_err() {
+  // @@protoc_insertion_point(field_release:raftRpcProctoc.RangeAdminReply.Err)
+  return _impl_.err_.Release();
+}
+inline void RangeAdminReply::set_allocated_err(std::string* err) {
+  if (err != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.err_.SetAllocated(err, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.err_.IsDefault()) {
+    _impl_.err_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProctoc.RangeAdminReply.Err)
 }
-inline void InstallSnapshotResponse::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
-  term_ = value;
+// int32 Id = 2;
+inline void RangeAdminReply::clear_id() {
+  _impl_.id_ = 0;
 }
-inline void InstallSnapshotResponse::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_term(value);
-  // @@protoc_insertion_point(field_set:raftRpcProctoc.InstallSnapshotResponse.Term)
+inline int32_t RangeAdminReply::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t RangeAdminReply::id() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminReply.Id)
+  return _internal_id();
+}
+inline void RangeAdminReply::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void RangeAdminReply::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminReply.Id)
+}
+
+// int32 LeaderId = 3;
+inline void RangeAdminReply::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t RangeAdminReply::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t RangeAdminReply::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminReply.LeaderId)
+  return _internal_leaderid();
+}
+inline void RangeAdminReply::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void RangeAdminReply::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminReply.LeaderId)
+}
+
+// int32 LeaderTerm = 4;
+inline void RangeAdminReply::clear_leaderterm() {
+  _impl_.leaderterm_ = 0;
+}
+inline int32_t RangeAdminReply::_internal_leaderterm() const {
+  return _impl_.leaderterm_;
+}
+inline int32_t RangeAdminReply::leaderterm() const {
+  // @@protoc_insertion_point(field_get:raftRpcProctoc.RangeAdminReply.LeaderTerm)
+  return _internal_leaderterm();
+}
+inline void RangeAdminReply::_internal_set_leaderterm(int32_t value) {
+  
+  _impl_.leaderterm_ = value;
+}
+inline void RangeAdminReply::set_leaderterm(int32_t value) {
+  _internal_set_leaderterm(value);
+  // @@protoc_insertion_point(field_set:raftRpcProctoc.RangeAdminReply.LeaderTerm)
 }
 
 #ifdef __GNUC__
@@ -2084,6 +4748,22 @@ inline void InstallSnapshotResponse::set_term(::PROTOBUF_NAMESPACE_ID::int32 val
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -2092,4 +4772,4 @@ inline void InstallSnapshotResponse::set_term(::PROTOBUF_NAMESPACE_ID::int32 val
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_raftRPC_2eproto
\ No newline at end of file
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_raftRPC_2eproto
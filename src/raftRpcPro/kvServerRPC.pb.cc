@@ -14,320 +14,928 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-namespace raftKVRpcProctoc {
-class GetArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetArgs> _instance;
-} _GetArgs_default_instance_;
-class GetReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetReply> _instance;
-} _GetReply_default_instance_;
-class PutAppendArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PutAppendArgs> _instance;
-} _PutAppendArgs_default_instance_;
-class PutAppendReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PutAppendReply> _instance;
-} _PutAppendReply_default_instance_;
-}  // namespace raftKVRpcProctoc
-static void InitDefaultsscc_info_GetArgs_kvServerRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftKVRpcProctoc::_GetArgs_default_instance_;
-    new (ptr) ::raftKVRpcProctoc::GetArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftKVRpcProctoc::GetArgs::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetArgs_kvServerRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GetArgs_kvServerRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_GetReply_kvServerRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftKVRpcProctoc::_GetReply_default_instance_;
-    new (ptr) ::raftKVRpcProctoc::GetReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftKVRpcProctoc::GetReply::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetReply_kvServerRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GetReply_kvServerRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_PutAppendArgs_kvServerRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::raftKVRpcProctoc::_PutAppendArgs_default_instance_;
-    new (ptr) ::raftKVRpcProctoc::PutAppendArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftKVRpcProctoc::PutAppendArgs::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PutAppendArgs_kvServerRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PutAppendArgs_kvServerRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_PutAppendReply_kvServerRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-  {
-    void* ptr = &::raftKVRpcProctoc::_PutAppendReply_default_instance_;
-    new (ptr) ::raftKVRpcProctoc::PutAppendReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftKVRpcProctoc::PutAppendReply::InitAsDefaultInstance();
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PutAppendReply_kvServerRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PutAppendReply_kvServerRPC_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_kvServerRPC_2eproto[4];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_kvServerRPC_2eproto = nullptr;
-static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* file_level_service_descriptors_kvServerRPC_2eproto[1];
+namespace raftKVRpcProctoc {
+PROTOBUF_CONSTEXPR GetArgs::GetArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_.followerread_)*/false
+  , /*decltype(_impl_.maxstalenessms_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetArgsDefaultTypeInternal() {}
+  union {
+    GetArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetArgsDefaultTypeInternal _GetArgs_default_instance_;
+PROTOBUF_CONSTEXPR GetReply::GetReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.leaderterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetReplyDefaultTypeInternal() {}
+  union {
+    GetReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetReplyDefaultTypeInternal _GetReply_default_instance_;
+PROTOBUF_CONSTEXPR PutAppendArgs::PutAppendArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.expected_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_.delta_)*/int64_t{0}
+  , /*decltype(_impl_.expectabsent_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PutAppendArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PutAppendArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PutAppendArgsDefaultTypeInternal() {}
+  union {
+    PutAppendArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PutAppendArgsDefaultTypeInternal _PutAppendArgs_default_instance_;
+PROTOBUF_CONSTEXPR PutAppendReply::PutAppendReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.leaderterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PutAppendReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PutAppendReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PutAppendReplyDefaultTypeInternal() {}
+  union {
+    PutAppendReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PutAppendReplyDefaultTypeInternal _PutAppendReply_default_instance_;
+PROTOBUF_CONSTEXPR KeyValue::KeyValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KeyValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeyValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeyValueDefaultTypeInternal() {}
+  union {
+    KeyValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeyValueDefaultTypeInternal _KeyValue_default_instance_;
+PROTOBUF_CONSTEXPR ScanArgs::ScanArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.startkey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.endkey_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pagetoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.limit_)*/0
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScanArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScanArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScanArgsDefaultTypeInternal() {}
+  union {
+    ScanArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScanArgsDefaultTypeInternal _ScanArgs_default_instance_;
+PROTOBUF_CONSTEXPR ScanReply::ScanReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.kvs_)*/{}
+  , /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nextpagetoken_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.rangeend_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.leaderterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScanReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScanReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScanReplyDefaultTypeInternal() {}
+  union {
+    ScanReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScanReplyDefaultTypeInternal _ScanReply_default_instance_;
+PROTOBUF_CONSTEXPR BatchOp::BatchOp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchOpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchOpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchOpDefaultTypeInternal() {}
+  union {
+    BatchOp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchOpDefaultTypeInternal _BatchOp_default_instance_;
+PROTOBUF_CONSTEXPR BatchPutArgs::BatchPutArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ops_)*/{}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchPutArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchPutArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchPutArgsDefaultTypeInternal() {}
+  union {
+    BatchPutArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchPutArgsDefaultTypeInternal _BatchPutArgs_default_instance_;
+PROTOBUF_CONSTEXPR BatchPutReply::BatchPutReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.leaderterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchPutReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchPutReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchPutReplyDefaultTypeInternal() {}
+  union {
+    BatchPutReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchPutReplyDefaultTypeInternal _BatchPutReply_default_instance_;
+PROTOBUF_CONSTEXPR BatchGetArgs::BatchGetArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.requestid_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchGetArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchGetArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchGetArgsDefaultTypeInternal() {}
+  union {
+    BatchGetArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchGetArgsDefaultTypeInternal _BatchGetArgs_default_instance_;
+PROTOBUF_CONSTEXPR KeyResult::KeyResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KeyResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeyResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeyResultDefaultTypeInternal() {}
+  union {
+    KeyResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeyResultDefaultTypeInternal _KeyResult_default_instance_;
+PROTOBUF_CONSTEXPR BatchGetReply::BatchGetReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.leaderterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchGetReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchGetReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchGetReplyDefaultTypeInternal() {}
+  union {
+    BatchGetReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchGetReplyDefaultTypeInternal _BatchGetReply_default_instance_;
+PROTOBUF_CONSTEXPR RegisterClientArgs::RegisterClientArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RegisterClientArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterClientArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterClientArgsDefaultTypeInternal() {}
+  union {
+    RegisterClientArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterClientArgsDefaultTypeInternal _RegisterClientArgs_default_instance_;
+PROTOBUF_CONSTEXPR RegisterClientReply::RegisterClientReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/uint64_t{0u}
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.leaderterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RegisterClientReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterClientReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterClientReplyDefaultTypeInternal() {}
+  union {
+    RegisterClientReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterClientReplyDefaultTypeInternal _RegisterClientReply_default_instance_;
+PROTOBUF_CONSTEXPR GetRangesArgs::GetRangesArgs(
+    ::_pbi::ConstantInitialized) {}
+struct GetRangesArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetRangesArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetRangesArgsDefaultTypeInternal() {}
+  union {
+    GetRangesArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRangesArgsDefaultTypeInternal _GetRangesArgs_default_instance_;
+PROTOBUF_CONSTEXPR RangeInfo::RangeInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.start_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.end_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RangeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RangeInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RangeInfoDefaultTypeInternal() {}
+  union {
+    RangeInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RangeInfoDefaultTypeInternal _RangeInfo_default_instance_;
+PROTOBUF_CONSTEXPR GetRangesReply::GetRangesReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ranges_)*/{}
+  , /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.groups_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetRangesReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetRangesReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetRangesReplyDefaultTypeInternal() {}
+  union {
+    GetRangesReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRangesReplyDefaultTypeInternal _GetRangesReply_default_instance_;
+PROTOBUF_CONSTEXPR TransferLeaderArgs::TransferLeaderArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_.target_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransferLeaderArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferLeaderArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferLeaderArgsDefaultTypeInternal() {}
+  union {
+    TransferLeaderArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferLeaderArgsDefaultTypeInternal _TransferLeaderArgs_default_instance_;
+PROTOBUF_CONSTEXPR TransferLeaderReply::TransferLeaderReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.leaderterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransferLeaderReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferLeaderReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferLeaderReplyDefaultTypeInternal() {}
+  union {
+    TransferLeaderReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferLeaderReplyDefaultTypeInternal _TransferLeaderReply_default_instance_;
+PROTOBUF_CONSTEXPR ChangeMembershipArgs::ChangeMembershipArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_.kind_)*/0
+  , /*decltype(_impl_.nodeid_)*/0
+  , /*decltype(_impl_.port_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChangeMembershipArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChangeMembershipArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChangeMembershipArgsDefaultTypeInternal() {}
+  union {
+    ChangeMembershipArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChangeMembershipArgsDefaultTypeInternal _ChangeMembershipArgs_default_instance_;
+PROTOBUF_CONSTEXPR ChangeMembershipReply::ChangeMembershipReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.leaderterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChangeMembershipReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChangeMembershipReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChangeMembershipReplyDefaultTypeInternal() {}
+  union {
+    ChangeMembershipReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChangeMembershipReplyDefaultTypeInternal _ChangeMembershipReply_default_instance_;
+}  // namespace raftKVRpcProctoc
+static ::_pb::Metadata file_level_metadata_kvServerRPC_2eproto[22];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_kvServerRPC_2eproto = nullptr;
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_kvServerRPC_2eproto[1];
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_kvServerRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_kvServerRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, key_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, clientid_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, requestid_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _impl_.requestid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _impl_.followerread_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _impl_.maxstalenessms_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetArgs, _impl_.groupid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, err_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetReply, _impl_.leaderterm_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, key_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, value_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, op_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, clientid_),
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, requestid_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.requestid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.expected_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.expectabsent_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendArgs, _impl_.delta_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, err_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, _impl_.leaderterm_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::PutAppendReply, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::KeyValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::KeyValue, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::KeyValue, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.startkey_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.endkey_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.prefix_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.pagetoken_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.requestid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanArgs, _impl_.groupid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.kvs_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.nextpagetoken_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.leaderterm_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ScanReply, _impl_.rangeend_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchOp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchOp, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchOp, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchOp, _impl_.op_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchPutArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchPutArgs, _impl_.ops_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchPutArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchPutArgs, _impl_.requestid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchPutArgs, _impl_.groupid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchPutReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchPutReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchPutReply, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchPutReply, _impl_.leaderterm_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetArgs, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetArgs, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetArgs, _impl_.requestid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetArgs, _impl_.groupid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::KeyResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::KeyResult, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::KeyResult, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetReply, _impl_.results_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetReply, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::BatchGetReply, _impl_.leaderterm_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterClientArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterClientArgs, _impl_.groupid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterClientReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterClientReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterClientReply, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterClientReply, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RegisterClientReply, _impl_.leaderterm_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetRangesArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RangeInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RangeInfo, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RangeInfo, _impl_.start_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::RangeInfo, _impl_.end_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetRangesReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetRangesReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetRangesReply, _impl_.groups_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::GetRangesReply, _impl_.ranges_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TransferLeaderArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TransferLeaderArgs, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TransferLeaderArgs, _impl_.target_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TransferLeaderReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TransferLeaderReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TransferLeaderReply, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::TransferLeaderReply, _impl_.leaderterm_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipArgs, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipArgs, _impl_.kind_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipArgs, _impl_.nodeid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipArgs, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipArgs, _impl_.port_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipReply, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftKVRpcProctoc::ChangeMembershipReply, _impl_.leaderterm_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::raftKVRpcProctoc::GetArgs)},
-  { 8, -1, sizeof(::raftKVRpcProctoc::GetReply)},
-  { 15, -1, sizeof(::raftKVRpcProctoc::PutAppendArgs)},
-  { 25, -1, sizeof(::raftKVRpcProctoc::PutAppendReply)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::raftKVRpcProctoc::GetArgs)},
+  { 12, -1, -1, sizeof(::raftKVRpcProctoc::GetReply)},
+  { 22, -1, -1, sizeof(::raftKVRpcProctoc::PutAppendArgs)},
+  { 37, -1, -1, sizeof(::raftKVRpcProctoc::PutAppendReply)},
+  { 47, -1, -1, sizeof(::raftKVRpcProctoc::KeyValue)},
+  { 55, -1, -1, sizeof(::raftKVRpcProctoc::ScanArgs)},
+  { 69, -1, -1, sizeof(::raftKVRpcProctoc::ScanReply)},
+  { 81, -1, -1, sizeof(::raftKVRpcProctoc::BatchOp)},
+  { 90, -1, -1, sizeof(::raftKVRpcProctoc::BatchPutArgs)},
+  { 100, -1, -1, sizeof(::raftKVRpcProctoc::BatchPutReply)},
+  { 109, -1, -1, sizeof(::raftKVRpcProctoc::BatchGetArgs)},
+  { 119, -1, -1, sizeof(::raftKVRpcProctoc::KeyResult)},
+  { 127, -1, -1, sizeof(::raftKVRpcProctoc::BatchGetReply)},
+  { 137, -1, -1, sizeof(::raftKVRpcProctoc::RegisterClientArgs)},
+  { 144, -1, -1, sizeof(::raftKVRpcProctoc::RegisterClientReply)},
+  { 154, -1, -1, sizeof(::raftKVRpcProctoc::GetRangesArgs)},
+  { 160, -1, -1, sizeof(::raftKVRpcProctoc::RangeInfo)},
+  { 169, -1, -1, sizeof(::raftKVRpcProctoc::GetRangesReply)},
+  { 178, -1, -1, sizeof(::raftKVRpcProctoc::TransferLeaderArgs)},
+  { 186, -1, -1, sizeof(::raftKVRpcProctoc::TransferLeaderReply)},
+  { 195, -1, -1, sizeof(::raftKVRpcProctoc::ChangeMembershipArgs)},
+  { 206, -1, -1, sizeof(::raftKVRpcProctoc::ChangeMembershipReply)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftKVRpcProctoc::_GetArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftKVRpcProctoc::_GetReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftKVRpcProctoc::_PutAppendArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftKVRpcProctoc::_PutAppendReply_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::raftKVRpcProctoc::_GetArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_GetReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_PutAppendArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_PutAppendReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_KeyValue_default_instance_._instance,
+  &::raftKVRpcProctoc::_ScanArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_ScanReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_BatchOp_default_instance_._instance,
+  &::raftKVRpcProctoc::_BatchPutArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_BatchPutReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_BatchGetArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_KeyResult_default_instance_._instance,
+  &::raftKVRpcProctoc::_BatchGetReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_RegisterClientArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_RegisterClientReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_GetRangesArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_RangeInfo_default_instance_._instance,
+  &::raftKVRpcProctoc::_GetRangesReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_TransferLeaderArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_TransferLeaderReply_default_instance_._instance,
+  &::raftKVRpcProctoc::_ChangeMembershipArgs_default_instance_._instance,
+  &::raftKVRpcProctoc::_ChangeMembershipReply_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_kvServerRPC_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\021kvServerRPC.proto\022\020raftKVRpcProctoc\";\n"
-  "\007GetArgs\022\013\n\003Key\030\001 \001(\014\022\020\n\010ClientId\030\002 \001(\014\022"
-  "\021\n\tRequestId\030\003 \001(\005\"&\n\010GetReply\022\013\n\003Err\030\001 "
-  "\001(\014\022\r\n\005Value\030\002 \001(\014\"\\\n\rPutAppendArgs\022\013\n\003K"
-  "ey\030\001 \001(\014\022\r\n\005Value\030\002 \001(\014\022\n\n\002Op\030\003 \001(\014\022\020\n\010C"
-  "lientId\030\004 \001(\014\022\021\n\tRequestId\030\005 \001(\005\"\035\n\016PutA"
-  "ppendReply\022\013\n\003Err\030\001 \001(\0142\233\001\n\013kvServerRpc\022"
-  "N\n\tPutAppend\022\037.raftKVRpcProctoc.PutAppen"
-  "dArgs\032 .raftKVRpcProctoc.PutAppendReply\022"
-  "<\n\003Get\022\031.raftKVRpcProctoc.GetArgs\032\032.raft"
-  "KVRpcProctoc.GetReplyB\003\200\001\001b\006proto3"
+  "\n\021kvServerRPC.proto\022\020raftKVRpcProctoc\"z\n"
+  "\007GetArgs\022\013\n\003Key\030\001 \001(\014\022\020\n\010ClientId\030\002 \001(\004\022"
+  "\021\n\tRequestId\030\003 \001(\005\022\024\n\014FollowerRead\030\004 \001(\010"
+  "\022\026\n\016MaxStalenessMs\030\005 \001(\005\022\017\n\007GroupId\030\006 \001("
+  "\005\"L\n\010GetReply\022\013\n\003Err\030\001 \001(\014\022\r\n\005Value\030\002 \001("
+  "\014\022\020\n\010LeaderId\030\003 \001(\005\022\022\n\nLeaderTerm\030\004 \001(\005\""
+  "\244\001\n\rPutAppendArgs\022\013\n\003Key\030\001 \001(\014\022\r\n\005Value\030"
+  "\002 \001(\014\022\n\n\002Op\030\003 \001(\014\022\020\n\010ClientId\030\004 \001(\004\022\021\n\tR"
+  "equestId\030\005 \001(\005\022\017\n\007GroupId\030\006 \001(\005\022\020\n\010Expec"
+  "ted\030\007 \001(\014\022\024\n\014ExpectAbsent\030\010 \001(\010\022\r\n\005Delta"
+  "\030\t \001(\003\"R\n\016PutAppendReply\022\013\n\003Err\030\001 \001(\014\022\020\n"
+  "\010LeaderId\030\002 \001(\005\022\022\n\nLeaderTerm\030\003 \001(\005\022\r\n\005V"
+  "alue\030\004 \001(\014\"&\n\010KeyValue\022\013\n\003Key\030\001 \001(\014\022\r\n\005V"
+  "alue\030\002 \001(\014\"\224\001\n\010ScanArgs\022\020\n\010StartKey\030\001 \001("
+  "\014\022\016\n\006EndKey\030\002 \001(\014\022\016\n\006Prefix\030\003 \001(\014\022\r\n\005Lim"
+  "it\030\004 \001(\005\022\021\n\tPageToken\030\005 \001(\014\022\020\n\010ClientId\030"
+  "\006 \001(\004\022\021\n\tRequestId\030\007 \001(\005\022\017\n\007GroupId\030\010 \001("
+  "\005\"\220\001\n\tScanReply\022\013\n\003Err\030\001 \001(\014\022\'\n\003Kvs\030\002 \003("
+  "\0132\032.raftKVRpcProctoc.KeyValue\022\025\n\rNextPag"
+  "eToken\030\003 \001(\014\022\020\n\010LeaderId\030\004 \001(\005\022\022\n\nLeader"
+  "Term\030\005 \001(\005\022\020\n\010RangeEnd\030\006 \001(\014\"1\n\007BatchOp\022"
+  "\013\n\003Key\030\001 \001(\014\022\r\n\005Value\030\002 \001(\014\022\n\n\002Op\030\003 \001(\014\""
+  "l\n\014BatchPutArgs\022&\n\003Ops\030\001 \003(\0132\031.raftKVRpc"
+  "Proctoc.BatchOp\022\020\n\010ClientId\030\002 \001(\004\022\021\n\tReq"
+  "uestId\030\003 \001(\005\022\017\n\007GroupId\030\004 \001(\005\"B\n\rBatchPu"
+  "tReply\022\013\n\003Err\030\001 \001(\014\022\020\n\010LeaderId\030\002 \001(\005\022\022\n"
+  "\nLeaderTerm\030\003 \001(\005\"R\n\014BatchGetArgs\022\014\n\004Key"
+  "s\030\001 \003(\014\022\020\n\010ClientId\030\002 \001(\004\022\021\n\tRequestId\030\003"
+  " \001(\005\022\017\n\007GroupId\030\004 \001(\005\"\'\n\tKeyResult\022\013\n\003Er"
+  "r\030\001 \001(\014\022\r\n\005Value\030\002 \001(\014\"p\n\rBatchGetReply\022"
+  "\013\n\003Err\030\001 \001(\014\022,\n\007Results\030\002 \003(\0132\033.raftKVRp"
+  "cProctoc.KeyResult\022\020\n\010LeaderId\030\003 \001(\005\022\022\n\n"
+  "LeaderTerm\030\004 \001(\005\"%\n\022RegisterClientArgs\022\017"
+  "\n\007GroupId\030\001 \001(\005\"Z\n\023RegisterClientReply\022\013"
+  "\n\003Err\030\001 \001(\014\022\020\n\010ClientId\030\002 \001(\004\022\020\n\010LeaderI"
+  "d\030\003 \001(\005\022\022\n\nLeaderTerm\030\004 \001(\005\"\017\n\rGetRanges"
+  "Args\"8\n\tRangeInfo\022\017\n\007GroupId\030\001 \001(\005\022\r\n\005St"
+  "art\030\002 \001(\014\022\013\n\003End\030\003 \001(\014\"Z\n\016GetRangesReply"
+  "\022\013\n\003Err\030\001 \001(\014\022\016\n\006Groups\030\002 \001(\005\022+\n\006Ranges\030"
+  "\003 \003(\0132\033.raftKVRpcProctoc.RangeInfo\"5\n\022Tr"
+  "ansferLeaderArgs\022\017\n\007GroupId\030\001 \001(\005\022\016\n\006Tar"
+  "get\030\002 \001(\005\"H\n\023TransferLeaderReply\022\013\n\003Err\030"
+  "\001 \001(\014\022\020\n\010LeaderId\030\002 \001(\005\022\022\n\nLeaderTerm\030\003 "
+  "\001(\005\"_\n\024ChangeMembershipArgs\022\017\n\007GroupId\030\001"
+  " \001(\005\022\014\n\004Kind\030\002 \001(\005\022\016\n\006NodeId\030\003 \001(\005\022\n\n\002Ip"
+  "\030\004 \001(\014\022\014\n\004Port\030\005 \001(\005\"J\n\025ChangeMembership"
+  "Reply\022\013\n\003Err\030\001 \001(\014\022\020\n\010LeaderId\030\002 \001(\005\022\022\n\n"
+  "LeaderTerm\030\003 \001(\0052\351\005\n\013kvServerRpc\022N\n\tPutA"
+  "ppend\022\037.raftKVRpcProctoc.PutAppendArgs\032 "
+  ".raftKVRpcProctoc.PutAppendReply\022<\n\003Get\022"
+  "\031.raftKVRpcProctoc.GetArgs\032\032.raftKVRpcPr"
+  "octoc.GetReply\022\?\n\004Scan\022\032.raftKVRpcProcto"
+  "c.ScanArgs\032\033.raftKVRpcProctoc.ScanReply\022"
+  "K\n\010BatchPut\022\036.raftKVRpcProctoc.BatchPutA"
+  "rgs\032\037.raftKVRpcProctoc.BatchPutReply\022K\n\010"
+  "BatchGet\022\036.raftKVRpcProctoc.BatchGetArgs"
+  "\032\037.raftKVRpcProctoc.BatchGetReply\022]\n\016Reg"
+  "isterClient\022$.raftKVRpcProctoc.RegisterC"
+  "lientArgs\032%.raftKVRpcProctoc.RegisterCli"
+  "entReply\022N\n\tGetRanges\022\037.raftKVRpcProctoc"
+  ".GetRangesArgs\032 .raftKVRpcProctoc.GetRan"
+  "gesReply\022]\n\016TransferLeader\022$.raftKVRpcPr"
+  "octoc.TransferLeaderArgs\032%.raftKVRpcProc"
+  "toc.TransferLeaderReply\022c\n\020ChangeMembers"
+  "hip\022&.raftKVRpcProctoc.ChangeMembershipA"
+  "rgs\032\'.raftKVRpcProctoc.ChangeMembershipR"
+  "eplyB\003\200\001\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_kvServerRPC_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_kvServerRPC_2eproto_sccs[4] = {
-  &scc_info_GetArgs_kvServerRPC_2eproto.base,
-  &scc_info_GetReply_kvServerRPC_2eproto.base,
-  &scc_info_PutAppendArgs_kvServerRPC_2eproto.base,
-  &scc_info_PutAppendReply_kvServerRPC_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_kvServerRPC_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kvServerRPC_2eproto = {
-  false, false, descriptor_table_protodef_kvServerRPC_2eproto, "kvServerRPC.proto", 434,
-  &descriptor_table_kvServerRPC_2eproto_once, descriptor_table_kvServerRPC_2eproto_sccs, descriptor_table_kvServerRPC_2eproto_deps, 4, 0,
-  schemas, file_default_instances, TableStruct_kvServerRPC_2eproto::offsets,
-  file_level_metadata_kvServerRPC_2eproto, 4, file_level_enum_descriptors_kvServerRPC_2eproto, file_level_service_descriptors_kvServerRPC_2eproto,
+static ::_pbi::once_flag descriptor_table_kvServerRPC_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_kvServerRPC_2eproto = {
+    false, false, 2657, descriptor_table_protodef_kvServerRPC_2eproto,
+    "kvServerRPC.proto",
+    &descriptor_table_kvServerRPC_2eproto_once, nullptr, 0, 22,
+    schemas, file_default_instances, TableStruct_kvServerRPC_2eproto::offsets,
+    file_level_metadata_kvServerRPC_2eproto, file_level_enum_descriptors_kvServerRPC_2eproto,
+    file_level_service_descriptors_kvServerRPC_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_kvServerRPC_2eproto_getter() {
+  return &descriptor_table_kvServerRPC_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_kvServerRPC_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_kvServerRPC_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_kvServerRPC_2eproto(&descriptor_table_kvServerRPC_2eproto);
 namespace raftKVRpcProctoc {
 
 // ===================================================================
 
-void GetArgs::InitAsDefaultInstance() {
-}
 class GetArgs::_Internal {
  public:
 };
 
-GetArgs::GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+GetArgs::GetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.GetArgs)
 }
 GetArgs::GetArgs(const GetArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , decltype(_impl_.followerread_){}
+    , decltype(_impl_.maxstalenessms_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_key().empty()) {
-    key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_key(),
-      GetArena());
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
   }
-  clientid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_clientid().empty()) {
-    clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_clientid(),
-      GetArena());
-  }
-  requestid_ = from.requestid_;
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.groupid_));
   // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.GetArgs)
 }
 
-void GetArgs::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetArgs_kvServerRPC_2eproto.base);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  clientid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  requestid_ = 0;
+inline void GetArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.requestid_){0}
+    , decltype(_impl_.followerread_){false}
+    , decltype(_impl_.maxstalenessms_){0}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GetArgs::~GetArgs() {
   // @@protoc_insertion_point(destructor:raftKVRpcProctoc.GetArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void GetArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  key_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  clientid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GetArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
 }
 
-void GetArgs::ArenaDtor(void* object) {
-  GetArgs* _this = reinterpret_cast< GetArgs* >(object);
-  (void)_this;
-}
-void GetArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void GetArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GetArgs& GetArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetArgs_kvServerRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GetArgs::Clear() {
 // @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.GetArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  requestid_ = 0;
+  _impl_.key_.ClearToEmpty();
+  ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.groupid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GetArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Key = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_key();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bytes ClientId = 2;
+      // uint64 ClientId = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_clientid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 RequestId = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool FollowerRead = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.followerread_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 MaxStalenessMs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.maxstalenessms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GetArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GetArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.GetArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_key(), target);
   }
 
-  // bytes ClientId = 2;
-  if (this->clientid().size() > 0) {
-    target = stream->WriteBytesMaybeAliased(
-        2, this->_internal_clientid(), target);
+  // uint64 ClientId = 2;
+  if (this->_internal_clientid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientid(), target);
   }
 
   // int32 RequestId = 3;
-  if (this->requestid() != 0) {
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_requestid(), target);
+  }
+
+  // bool FollowerRead = 4;
+  if (this->_internal_followerread() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_followerread(), target);
+  }
+
+  // int32 MaxStalenessMs = 5;
+  if (this->_internal_maxstalenessms() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_requestid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_maxstalenessms(), target);
+  }
+
+  // int32 GroupId = 6;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_groupid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.GetArgs)
@@ -338,78 +946,79 @@ size_t GetArgs::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.GetArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_key());
   }
 
-  // bytes ClientId = 2;
-  if (this->clientid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_clientid());
+  // uint64 ClientId = 2;
+  if (this->_internal_clientid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
   }
 
   // int32 RequestId = 3;
-  if (this->requestid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_requestid());
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // bool FollowerRead = 4;
+  if (this->_internal_followerread() != 0) {
+    total_size += 1 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GetArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftKVRpcProctoc.GetArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GetArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftKVRpcProctoc.GetArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftKVRpcProctoc.GetArgs)
-    MergeFrom(*source);
+  // int32 MaxStalenessMs = 5;
+  if (this->_internal_maxstalenessms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_maxstalenessms());
   }
+
+  // int32 GroupId = 6;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GetArgs::MergeFrom(const GetArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetArgs::GetClassData() const { return &_class_data_; }
+
+
+void GetArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetArgs*>(&to_msg);
+  auto& from = static_cast<const GetArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.key().size() > 0) {
-    _internal_set_key(from._internal_key());
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
   }
-  if (from.clientid().size() > 0) {
-    _internal_set_clientid(from._internal_clientid());
+  if (from._internal_clientid() != 0) {
+    _this->_internal_set_clientid(from._internal_clientid());
   }
-  if (from.requestid() != 0) {
-    _internal_set_requestid(from._internal_requestid());
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
   }
-}
-
-void GetArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftKVRpcProctoc.GetArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_followerread() != 0) {
+    _this->_internal_set_followerread(from._internal_followerread());
+  }
+  if (from._internal_maxstalenessms() != 0) {
+    _this->_internal_set_maxstalenessms(from._internal_maxstalenessms());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GetArgs::CopyFrom(const GetArgs& from) {
@@ -425,157 +1034,221 @@ bool GetArgs::IsInitialized() const {
 
 void GetArgs::InternalSwap(GetArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  key_.Swap(&other->key_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  clientid_.Swap(&other->clientid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(requestid_, other->requestid_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetArgs, _impl_.groupid_)
+      + sizeof(GetArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(GetArgs, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GetArgs::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void GetReply::InitAsDefaultInstance() {
-}
 class GetReply::_Internal {
  public:
 };
 
-GetReply::GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+GetReply::GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.GetReply)
 }
 GetReply::GetReply(const GetReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.leaderterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  err_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_err().empty()) {
-    err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_err(),
-      GetArena());
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
   }
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_value().empty()) {
-    value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_value(),
-      GetArena());
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
   }
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderterm_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
   // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.GetReply)
 }
 
-void GetReply::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetReply_kvServerRPC_2eproto.base);
-  err_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GetReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.leaderterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GetReply::~GetReply() {
   // @@protoc_insertion_point(destructor:raftKVRpcProctoc.GetReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void GetReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  err_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GetReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-void GetReply::ArenaDtor(void* object) {
-  GetReply* _this = reinterpret_cast< GetReply* >(object);
-  (void)_this;
-}
-void GetReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void GetReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GetReply& GetReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetReply_kvServerRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GetReply::Clear() {
 // @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.GetReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.err_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderterm_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GetReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Err = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_err();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes Value = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.leaderterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GetReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GetReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.GetReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Err = 1;
-  if (this->err().size() > 0) {
+  if (!this->_internal_err().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_err(), target);
   }
 
   // bytes Value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     target = stream->WriteBytesMaybeAliased(
         2, this->_internal_value(), target);
   }
 
+  // int32 LeaderId = 3;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_leaderid(), target);
+  }
+
+  // int32 LeaderTerm = 4;
+  if (this->_internal_leaderterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_leaderterm(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.GetReply)
@@ -586,68 +1259,65 @@ size_t GetReply::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.GetReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Err = 1;
-  if (this->err().size() > 0) {
+  if (!this->_internal_err().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_err());
   }
 
   // bytes Value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_value());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 LeaderId = 3;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GetReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftKVRpcProctoc.GetReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GetReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftKVRpcProctoc.GetReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftKVRpcProctoc.GetReply)
-    MergeFrom(*source);
+  // int32 LeaderTerm = 4;
+  if (this->_internal_leaderterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderterm());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GetReply::MergeFrom(const GetReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetReply::GetClassData() const { return &_class_data_; }
+
+
+void GetReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetReply*>(&to_msg);
+  auto& from = static_cast<const GetReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.err().size() > 0) {
-    _internal_set_err(from._internal_err());
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
   }
-  if (from.value().size() > 0) {
-    _internal_set_value(from._internal_value());
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
   }
-}
-
-void GetReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftKVRpcProctoc.GetReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_leaderterm() != 0) {
+    _this->_internal_set_leaderterm(from._internal_leaderterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GetReply::CopyFrom(const GetReply& from) {
@@ -663,216 +1333,335 @@ bool GetReply::IsInitialized() const {
 
 void GetReply::InternalSwap(GetReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  err_.Swap(&other->err_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetReply, _impl_.leaderterm_)
+      + sizeof(GetReply::_impl_.leaderterm_)
+      - PROTOBUF_FIELD_OFFSET(GetReply, _impl_.leaderid_)>(
+          reinterpret_cast<char*>(&_impl_.leaderid_),
+          reinterpret_cast<char*>(&other->_impl_.leaderid_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GetReply::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void PutAppendArgs::InitAsDefaultInstance() {
-}
 class PutAppendArgs::_Internal {
  public:
 };
 
-PutAppendArgs::PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+PutAppendArgs::PutAppendArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.PutAppendArgs)
 }
 PutAppendArgs::PutAppendArgs(const PutAppendArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PutAppendArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.expected_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , decltype(_impl_.groupid_){}
+    , decltype(_impl_.delta_){}
+    , decltype(_impl_.expectabsent_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_key().empty()) {
-    key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_key(),
-      GetArena());
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
   }
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_value().empty()) {
-    value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_value(),
-      GetArena());
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
   }
-  op_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_op().empty()) {
-    op_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_op(),
-      GetArena());
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
   }
-  clientid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_clientid().empty()) {
-    clientid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_clientid(),
-      GetArena());
+  _impl_.expected_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_expected().empty()) {
+    _this->_impl_.expected_.Set(from._internal_expected(), 
+      _this->GetArenaForAllocation());
   }
-  requestid_ = from.requestid_;
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.expectabsent_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.expectabsent_));
   // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.PutAppendArgs)
 }
 
-void PutAppendArgs::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PutAppendArgs_kvServerRPC_2eproto.base);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  op_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  clientid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  requestid_ = 0;
+inline void PutAppendArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.expected_){}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.requestid_){0}
+    , decltype(_impl_.groupid_){0}
+    , decltype(_impl_.delta_){int64_t{0}}
+    , decltype(_impl_.expectabsent_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.expected_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PutAppendArgs::~PutAppendArgs() {
   // @@protoc_insertion_point(destructor:raftKVRpcProctoc.PutAppendArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PutAppendArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  key_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  op_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  clientid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void PutAppendArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+  _impl_.op_.Destroy();
+  _impl_.expected_.Destroy();
 }
 
-void PutAppendArgs::ArenaDtor(void* object) {
-  PutAppendArgs* _this = reinterpret_cast< PutAppendArgs* >(object);
-  (void)_this;
-}
-void PutAppendArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void PutAppendArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const PutAppendArgs& PutAppendArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PutAppendArgs_kvServerRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void PutAppendArgs::Clear() {
 // @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.PutAppendArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  op_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  clientid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  requestid_ = 0;
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.op_.ClearToEmpty();
+  _impl_.expected_.ClearToEmpty();
+  ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.expectabsent_) -
+      reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.expectabsent_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* PutAppendArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* PutAppendArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Key = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_key();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes Value = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bytes Op = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_op();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bytes ClientId = 4;
+      // uint64 ClientId = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          auto str = _internal_mutable_clientid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 RequestId = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Expected = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_expected();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool ExpectAbsent = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.expectabsent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Delta = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* PutAppendArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* PutAppendArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.PutAppendArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_key(), target);
   }
 
   // bytes Value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     target = stream->WriteBytesMaybeAliased(
         2, this->_internal_value(), target);
   }
 
   // bytes Op = 3;
-  if (this->op().size() > 0) {
+  if (!this->_internal_op().empty()) {
     target = stream->WriteBytesMaybeAliased(
         3, this->_internal_op(), target);
   }
 
-  // bytes ClientId = 4;
-  if (this->clientid().size() > 0) {
-    target = stream->WriteBytesMaybeAliased(
-        4, this->_internal_clientid(), target);
+  // uint64 ClientId = 4;
+  if (this->_internal_clientid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_clientid(), target);
   }
 
   // int32 RequestId = 5;
-  if (this->requestid() != 0) {
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_requestid(), target);
+  }
+
+  // int32 GroupId = 6;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_groupid(), target);
+  }
+
+  // bytes Expected = 7;
+  if (!this->_internal_expected().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_expected(), target);
+  }
+
+  // bool ExpectAbsent = 8;
+  if (this->_internal_expectabsent() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_expectabsent(), target);
+  }
+
+  // int64 Delta = 9;
+  if (this->_internal_delta() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_requestid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_delta(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.PutAppendArgs)
@@ -883,330 +1672,5207 @@ size_t PutAppendArgs::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.PutAppendArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_key());
   }
 
   // bytes Value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_value());
   }
 
   // bytes Op = 3;
-  if (this->op().size() > 0) {
+  if (!this->_internal_op().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_op());
   }
 
-  // bytes ClientId = 4;
-  if (this->clientid().size() > 0) {
+  // bytes Expected = 7;
+  if (!this->_internal_expected().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_clientid());
+        this->_internal_expected());
+  }
+
+  // uint64 ClientId = 4;
+  if (this->_internal_clientid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
   }
 
   // int32 RequestId = 5;
-  if (this->requestid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_requestid());
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 GroupId = 6;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  // int64 Delta = 9;
+  if (this->_internal_delta() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_delta());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void PutAppendArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftKVRpcProctoc.PutAppendArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PutAppendArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PutAppendArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftKVRpcProctoc.PutAppendArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftKVRpcProctoc.PutAppendArgs)
-    MergeFrom(*source);
+  // bool ExpectAbsent = 8;
+  if (this->_internal_expectabsent() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PutAppendArgs::MergeFrom(const PutAppendArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.PutAppendArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutAppendArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PutAppendArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutAppendArgs::GetClassData() const { return &_class_data_; }
+
+
+void PutAppendArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PutAppendArgs*>(&to_msg);
+  auto& from = static_cast<const PutAppendArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.PutAppendArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.key().size() > 0) {
-    _internal_set_key(from._internal_key());
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
   }
-  if (from.value().size() > 0) {
-    _internal_set_value(from._internal_value());
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
   }
-  if (from.op().size() > 0) {
-    _internal_set_op(from._internal_op());
+  if (!from._internal_op().empty()) {
+    _this->_internal_set_op(from._internal_op());
+  }
+  if (!from._internal_expected().empty()) {
+    _this->_internal_set_expected(from._internal_expected());
+  }
+  if (from._internal_clientid() != 0) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  if (from._internal_delta() != 0) {
+    _this->_internal_set_delta(from._internal_delta());
+  }
+  if (from._internal_expectabsent() != 0) {
+    _this->_internal_set_expectabsent(from._internal_expectabsent());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PutAppendArgs::CopyFrom(const PutAppendArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.PutAppendArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PutAppendArgs::IsInitialized() const {
+  return true;
+}
+
+void PutAppendArgs::InternalSwap(PutAppendArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.expected_, lhs_arena,
+      &other->_impl_.expected_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PutAppendArgs, _impl_.expectabsent_)
+      + sizeof(PutAppendArgs::_impl_.expectabsent_)
+      - PROTOBUF_FIELD_OFFSET(PutAppendArgs, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PutAppendArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[2]);
+}
+
+// ===================================================================
+
+class PutAppendReply::_Internal {
+ public:
+};
+
+PutAppendReply::PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.PutAppendReply)
+}
+PutAppendReply::PutAppendReply(const PutAppendReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PutAppendReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.leaderterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderterm_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.PutAppendReply)
+}
+
+inline void PutAppendReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.leaderterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PutAppendReply::~PutAppendReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.PutAppendReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PutAppendReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void PutAppendReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PutAppendReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.PutAppendReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderterm_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PutAppendReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderTerm = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.leaderterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PutAppendReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.PutAppendReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
+  }
+
+  // int32 LeaderTerm = 3;
+  if (this->_internal_leaderterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_leaderterm(), target);
+  }
+
+  // bytes Value = 4;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.PutAppendReply)
+  return target;
+}
+
+size_t PutAppendReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.PutAppendReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // bytes Value = 4;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 LeaderTerm = 3;
+  if (this->_internal_leaderterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderterm());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutAppendReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PutAppendReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutAppendReply::GetClassData() const { return &_class_data_; }
+
+
+void PutAppendReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PutAppendReply*>(&to_msg);
+  auto& from = static_cast<const PutAppendReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.PutAppendReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_leaderterm() != 0) {
+    _this->_internal_set_leaderterm(from._internal_leaderterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PutAppendReply::CopyFrom(const PutAppendReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.PutAppendReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PutAppendReply::IsInitialized() const {
+  return true;
+}
+
+void PutAppendReply::InternalSwap(PutAppendReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PutAppendReply, _impl_.leaderterm_)
+      + sizeof(PutAppendReply::_impl_.leaderterm_)
+      - PROTOBUF_FIELD_OFFSET(PutAppendReply, _impl_.leaderid_)>(
+          reinterpret_cast<char*>(&_impl_.leaderid_),
+          reinterpret_cast<char*>(&other->_impl_.leaderid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PutAppendReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[3]);
+}
+
+// ===================================================================
+
+class KeyValue::_Internal {
+ public:
+};
+
+KeyValue::KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.KeyValue)
+}
+KeyValue::KeyValue(const KeyValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KeyValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.KeyValue)
+}
+
+inline void KeyValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+KeyValue::~KeyValue() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.KeyValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void KeyValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void KeyValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void KeyValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.KeyValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KeyValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KeyValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.KeyValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.KeyValue)
+  return target;
+}
+
+size_t KeyValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.KeyValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KeyValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KeyValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KeyValue::GetClassData() const { return &_class_data_; }
+
+
+void KeyValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KeyValue*>(&to_msg);
+  auto& from = static_cast<const KeyValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.KeyValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KeyValue::CopyFrom(const KeyValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.KeyValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KeyValue::IsInitialized() const {
+  return true;
+}
+
+void KeyValue::InternalSwap(KeyValue* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata KeyValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[4]);
+}
+
+// ===================================================================
+
+class ScanArgs::_Internal {
+ public:
+};
+
+ScanArgs::ScanArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.ScanArgs)
+}
+ScanArgs::ScanArgs(const ScanArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScanArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.startkey_){}
+    , decltype(_impl_.endkey_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.pagetoken_){}
+    , decltype(_impl_.limit_){}
+    , decltype(_impl_.requestid_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.startkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_startkey().empty()) {
+    _this->_impl_.startkey_.Set(from._internal_startkey(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.endkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_endkey().empty()) {
+    _this->_impl_.endkey_.Set(from._internal_endkey(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_prefix().empty()) {
+    _this->_impl_.prefix_.Set(from._internal_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.pagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pagetoken().empty()) {
+    _this->_impl_.pagetoken_.Set(from._internal_pagetoken(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.limit_, &from._impl_.limit_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.ScanArgs)
+}
+
+inline void ScanArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.startkey_){}
+    , decltype(_impl_.endkey_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.pagetoken_){}
+    , decltype(_impl_.limit_){0}
+    , decltype(_impl_.requestid_){0}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.startkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.startkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.endkey_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.endkey_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.pagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ScanArgs::~ScanArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.ScanArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScanArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.startkey_.Destroy();
+  _impl_.endkey_.Destroy();
+  _impl_.prefix_.Destroy();
+  _impl_.pagetoken_.Destroy();
+}
+
+void ScanArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScanArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.ScanArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.startkey_.ClearToEmpty();
+  _impl_.endkey_.ClearToEmpty();
+  _impl_.prefix_.ClearToEmpty();
+  _impl_.pagetoken_.ClearToEmpty();
+  ::memset(&_impl_.limit_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.groupid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScanArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes StartKey = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_startkey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes EndKey = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_endkey();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Prefix = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Limit = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes PageToken = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_pagetoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ClientId = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScanArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.ScanArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes StartKey = 1;
+  if (!this->_internal_startkey().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_startkey(), target);
+  }
+
+  // bytes EndKey = 2;
+  if (!this->_internal_endkey().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_endkey(), target);
+  }
+
+  // bytes Prefix = 3;
+  if (!this->_internal_prefix().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_prefix(), target);
+  }
+
+  // int32 Limit = 4;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_limit(), target);
+  }
+
+  // bytes PageToken = 5;
+  if (!this->_internal_pagetoken().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_pagetoken(), target);
+  }
+
+  // uint64 ClientId = 6;
+  if (this->_internal_clientid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 7;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_requestid(), target);
+  }
+
+  // int32 GroupId = 8;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_groupid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.ScanArgs)
+  return target;
+}
+
+size_t ScanArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.ScanArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes StartKey = 1;
+  if (!this->_internal_startkey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_startkey());
+  }
+
+  // bytes EndKey = 2;
+  if (!this->_internal_endkey().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_endkey());
+  }
+
+  // bytes Prefix = 3;
+  if (!this->_internal_prefix().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_prefix());
+  }
+
+  // bytes PageToken = 5;
+  if (!this->_internal_pagetoken().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_pagetoken());
+  }
+
+  // int32 Limit = 4;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_limit());
+  }
+
+  // int32 RequestId = 7;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  // uint64 ClientId = 6;
+  if (this->_internal_clientid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  // int32 GroupId = 8;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScanArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScanArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScanArgs::GetClassData() const { return &_class_data_; }
+
+
+void ScanArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScanArgs*>(&to_msg);
+  auto& from = static_cast<const ScanArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.ScanArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_startkey().empty()) {
+    _this->_internal_set_startkey(from._internal_startkey());
+  }
+  if (!from._internal_endkey().empty()) {
+    _this->_internal_set_endkey(from._internal_endkey());
+  }
+  if (!from._internal_prefix().empty()) {
+    _this->_internal_set_prefix(from._internal_prefix());
+  }
+  if (!from._internal_pagetoken().empty()) {
+    _this->_internal_set_pagetoken(from._internal_pagetoken());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  if (from._internal_clientid() != 0) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScanArgs::CopyFrom(const ScanArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.ScanArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScanArgs::IsInitialized() const {
+  return true;
+}
+
+void ScanArgs::InternalSwap(ScanArgs* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.startkey_, lhs_arena,
+      &other->_impl_.startkey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.endkey_, lhs_arena,
+      &other->_impl_.endkey_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prefix_, lhs_arena,
+      &other->_impl_.prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pagetoken_, lhs_arena,
+      &other->_impl_.pagetoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScanArgs, _impl_.groupid_)
+      + sizeof(ScanArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(ScanArgs, _impl_.limit_)>(
+          reinterpret_cast<char*>(&_impl_.limit_),
+          reinterpret_cast<char*>(&other->_impl_.limit_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScanArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[5]);
+}
+
+// ===================================================================
+
+class ScanReply::_Internal {
+ public:
+};
+
+ScanReply::ScanReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.ScanReply)
+}
+ScanReply::ScanReply(const ScanReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScanReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kvs_){from._impl_.kvs_}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.nextpagetoken_){}
+    , decltype(_impl_.rangeend_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.leaderterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.nextpagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nextpagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_nextpagetoken().empty()) {
+    _this->_impl_.nextpagetoken_.Set(from._internal_nextpagetoken(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.rangeend_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rangeend_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rangeend().empty()) {
+    _this->_impl_.rangeend_.Set(from._internal_rangeend(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderterm_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.ScanReply)
+}
+
+inline void ScanReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kvs_){arena}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.nextpagetoken_){}
+    , decltype(_impl_.rangeend_){}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.leaderterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.nextpagetoken_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nextpagetoken_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.rangeend_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rangeend_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ScanReply::~ScanReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.ScanReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScanReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.kvs_.~RepeatedPtrField();
+  _impl_.err_.Destroy();
+  _impl_.nextpagetoken_.Destroy();
+  _impl_.rangeend_.Destroy();
+}
+
+void ScanReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScanReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.ScanReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.kvs_.Clear();
+  _impl_.err_.ClearToEmpty();
+  _impl_.nextpagetoken_.ClearToEmpty();
+  _impl_.rangeend_.ClearToEmpty();
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderterm_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScanReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_kvs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes NextPageToken = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_nextpagetoken();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderTerm = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.leaderterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes RangeEnd = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_rangeend();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScanReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.ScanReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_kvs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_kvs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes NextPageToken = 3;
+  if (!this->_internal_nextpagetoken().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_nextpagetoken(), target);
+  }
+
+  // int32 LeaderId = 4;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_leaderid(), target);
+  }
+
+  // int32 LeaderTerm = 5;
+  if (this->_internal_leaderterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_leaderterm(), target);
+  }
+
+  // bytes RangeEnd = 6;
+  if (!this->_internal_rangeend().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_rangeend(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.ScanReply)
+  return target;
+}
+
+size_t ScanReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.ScanReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.KeyValue Kvs = 2;
+  total_size += 1UL * this->_internal_kvs_size();
+  for (const auto& msg : this->_impl_.kvs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // bytes NextPageToken = 3;
+  if (!this->_internal_nextpagetoken().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_nextpagetoken());
+  }
+
+  // bytes RangeEnd = 6;
+  if (!this->_internal_rangeend().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_rangeend());
+  }
+
+  // int32 LeaderId = 4;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 LeaderTerm = 5;
+  if (this->_internal_leaderterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderterm());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScanReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScanReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScanReply::GetClassData() const { return &_class_data_; }
+
+
+void ScanReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScanReply*>(&to_msg);
+  auto& from = static_cast<const ScanReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.ScanReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.kvs_.MergeFrom(from._impl_.kvs_);
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (!from._internal_nextpagetoken().empty()) {
+    _this->_internal_set_nextpagetoken(from._internal_nextpagetoken());
+  }
+  if (!from._internal_rangeend().empty()) {
+    _this->_internal_set_rangeend(from._internal_rangeend());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_leaderterm() != 0) {
+    _this->_internal_set_leaderterm(from._internal_leaderterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScanReply::CopyFrom(const ScanReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.ScanReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScanReply::IsInitialized() const {
+  return true;
+}
+
+void ScanReply::InternalSwap(ScanReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.kvs_.InternalSwap(&other->_impl_.kvs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nextpagetoken_, lhs_arena,
+      &other->_impl_.nextpagetoken_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rangeend_, lhs_arena,
+      &other->_impl_.rangeend_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScanReply, _impl_.leaderterm_)
+      + sizeof(ScanReply::_impl_.leaderterm_)
+      - PROTOBUF_FIELD_OFFSET(ScanReply, _impl_.leaderid_)>(
+          reinterpret_cast<char*>(&_impl_.leaderid_),
+          reinterpret_cast<char*>(&other->_impl_.leaderid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScanReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[6]);
+}
+
+// ===================================================================
+
+class BatchOp::_Internal {
+ public:
+};
+
+BatchOp::BatchOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.BatchOp)
+}
+BatchOp::BatchOp(const BatchOp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchOp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_op().empty()) {
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.BatchOp)
+}
+
+inline void BatchOp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchOp::~BatchOp() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.BatchOp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchOp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+  _impl_.op_.Destroy();
+}
+
+void BatchOp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchOp::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.BatchOp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.op_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchOp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Op = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_op();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchOp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.BatchOp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  // bytes Op = 3;
+  if (!this->_internal_op().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_op(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.BatchOp)
+  return target;
+}
+
+size_t BatchOp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.BatchOp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // bytes Op = 3;
+  if (!this->_internal_op().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_op());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchOp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchOp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchOp::GetClassData() const { return &_class_data_; }
+
+
+void BatchOp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchOp*>(&to_msg);
+  auto& from = static_cast<const BatchOp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.BatchOp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (!from._internal_op().empty()) {
+    _this->_internal_set_op(from._internal_op());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchOp::CopyFrom(const BatchOp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.BatchOp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchOp::IsInitialized() const {
+  return true;
+}
+
+void BatchOp::InternalSwap(BatchOp* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchOp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[7]);
+}
+
+// ===================================================================
+
+class BatchPutArgs::_Internal {
+ public:
+};
+
+BatchPutArgs::BatchPutArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.BatchPutArgs)
+}
+BatchPutArgs::BatchPutArgs(const BatchPutArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchPutArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){from._impl_.ops_}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.BatchPutArgs)
+}
+
+inline void BatchPutArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){arena}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.requestid_){0}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BatchPutArgs::~BatchPutArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.BatchPutArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchPutArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ops_.~RepeatedPtrField();
+}
+
+void BatchPutArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchPutArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.BatchPutArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ops_.Clear();
+  ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.groupid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchPutArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .raftKVRpcProctoc.BatchOp Ops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ClientId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchPutArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.BatchPutArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.BatchOp Ops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 ClientId = 2;
+  if (this->_internal_clientid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_requestid(), target);
+  }
+
+  // int32 GroupId = 4;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_groupid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.BatchPutArgs)
+  return target;
+}
+
+size_t BatchPutArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.BatchPutArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.BatchOp Ops = 1;
+  total_size += 1UL * this->_internal_ops_size();
+  for (const auto& msg : this->_impl_.ops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 ClientId = 2;
+  if (this->_internal_clientid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  // int32 GroupId = 4;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchPutArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchPutArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchPutArgs::GetClassData() const { return &_class_data_; }
+
+
+void BatchPutArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchPutArgs*>(&to_msg);
+  auto& from = static_cast<const BatchPutArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.BatchPutArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ops_.MergeFrom(from._impl_.ops_);
+  if (from._internal_clientid() != 0) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchPutArgs::CopyFrom(const BatchPutArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.BatchPutArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchPutArgs::IsInitialized() const {
+  return true;
+}
+
+void BatchPutArgs::InternalSwap(BatchPutArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ops_.InternalSwap(&other->_impl_.ops_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchPutArgs, _impl_.groupid_)
+      + sizeof(BatchPutArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(BatchPutArgs, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchPutArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[8]);
+}
+
+// ===================================================================
+
+class BatchPutReply::_Internal {
+ public:
+};
+
+BatchPutReply::BatchPutReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.BatchPutReply)
+}
+BatchPutReply::BatchPutReply(const BatchPutReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchPutReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.leaderterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderterm_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.BatchPutReply)
+}
+
+inline void BatchPutReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.leaderterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchPutReply::~BatchPutReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.BatchPutReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchPutReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+}
+
+void BatchPutReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchPutReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.BatchPutReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderterm_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchPutReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderTerm = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.leaderterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchPutReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.BatchPutReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
+  }
+
+  // int32 LeaderTerm = 3;
+  if (this->_internal_leaderterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_leaderterm(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.BatchPutReply)
+  return target;
+}
+
+size_t BatchPutReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.BatchPutReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 LeaderTerm = 3;
+  if (this->_internal_leaderterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderterm());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchPutReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchPutReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchPutReply::GetClassData() const { return &_class_data_; }
+
+
+void BatchPutReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchPutReply*>(&to_msg);
+  auto& from = static_cast<const BatchPutReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.BatchPutReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_leaderterm() != 0) {
+    _this->_internal_set_leaderterm(from._internal_leaderterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchPutReply::CopyFrom(const BatchPutReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.BatchPutReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchPutReply::IsInitialized() const {
+  return true;
+}
+
+void BatchPutReply::InternalSwap(BatchPutReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchPutReply, _impl_.leaderterm_)
+      + sizeof(BatchPutReply::_impl_.leaderterm_)
+      - PROTOBUF_FIELD_OFFSET(BatchPutReply, _impl_.leaderid_)>(
+          reinterpret_cast<char*>(&_impl_.leaderid_),
+          reinterpret_cast<char*>(&other->_impl_.leaderid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchPutReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[9]);
+}
+
+// ===================================================================
+
+class BatchGetArgs::_Internal {
+ public:
+};
+
+BatchGetArgs::BatchGetArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.BatchGetArgs)
+}
+BatchGetArgs::BatchGetArgs(const BatchGetArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchGetArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.requestid_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.BatchGetArgs)
+}
+
+inline void BatchGetArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.requestid_){0}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BatchGetArgs::~BatchGetArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.BatchGetArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchGetArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+}
+
+void BatchGetArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchGetArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.BatchGetArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.groupid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchGetArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes Keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ClientId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 RequestId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.requestid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchGetArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.BatchGetArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes Keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  // uint64 ClientId = 2;
+  if (this->_internal_clientid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientid(), target);
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_requestid(), target);
+  }
+
+  // int32 GroupId = 4;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_groupid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.BatchGetArgs)
+  return target;
+}
+
+size_t BatchGetArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.BatchGetArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes Keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.keys_.Get(i));
+  }
+
+  // uint64 ClientId = 2;
+  if (this->_internal_clientid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  // int32 RequestId = 3;
+  if (this->_internal_requestid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_requestid());
+  }
+
+  // int32 GroupId = 4;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchGetArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchGetArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchGetArgs::GetClassData() const { return &_class_data_; }
+
+
+void BatchGetArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchGetArgs*>(&to_msg);
+  auto& from = static_cast<const BatchGetArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.BatchGetArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  if (from._internal_clientid() != 0) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_requestid() != 0) {
+    _this->_internal_set_requestid(from._internal_requestid());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchGetArgs::CopyFrom(const BatchGetArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.BatchGetArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchGetArgs::IsInitialized() const {
+  return true;
+}
+
+void BatchGetArgs::InternalSwap(BatchGetArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchGetArgs, _impl_.groupid_)
+      + sizeof(BatchGetArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(BatchGetArgs, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchGetArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[10]);
+}
+
+// ===================================================================
+
+class KeyResult::_Internal {
+ public:
+};
+
+KeyResult::KeyResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.KeyResult)
+}
+KeyResult::KeyResult(const KeyResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KeyResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.KeyResult)
+}
+
+inline void KeyResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+KeyResult::~KeyResult() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.KeyResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void KeyResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void KeyResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void KeyResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.KeyResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KeyResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KeyResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.KeyResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.KeyResult)
+  return target;
+}
+
+size_t KeyResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.KeyResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // bytes Value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KeyResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KeyResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KeyResult::GetClassData() const { return &_class_data_; }
+
+
+void KeyResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KeyResult*>(&to_msg);
+  auto& from = static_cast<const KeyResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.KeyResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KeyResult::CopyFrom(const KeyResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.KeyResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KeyResult::IsInitialized() const {
+  return true;
+}
+
+void KeyResult::InternalSwap(KeyResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata KeyResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[11]);
+}
+
+// ===================================================================
+
+class BatchGetReply::_Internal {
+ public:
+};
+
+BatchGetReply::BatchGetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.BatchGetReply)
+}
+BatchGetReply::BatchGetReply(const BatchGetReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchGetReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.leaderterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderterm_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.BatchGetReply)
+}
+
+inline void BatchGetReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.leaderterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchGetReply::~BatchGetReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.BatchGetReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchGetReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+  _impl_.err_.Destroy();
+}
+
+void BatchGetReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchGetReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.BatchGetReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  _impl_.err_.ClearToEmpty();
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderterm_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchGetReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.KeyResult Results = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.leaderterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchGetReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.BatchGetReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.KeyResult Results = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 LeaderId = 3;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_leaderid(), target);
+  }
+
+  // int32 LeaderTerm = 4;
+  if (this->_internal_leaderterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_leaderterm(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.BatchGetReply)
+  return target;
+}
+
+size_t BatchGetReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.BatchGetReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.KeyResult Results = 2;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // int32 LeaderId = 3;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 LeaderTerm = 4;
+  if (this->_internal_leaderterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderterm());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchGetReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchGetReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchGetReply::GetClassData() const { return &_class_data_; }
+
+
+void BatchGetReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchGetReply*>(&to_msg);
+  auto& from = static_cast<const BatchGetReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.BatchGetReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_leaderterm() != 0) {
+    _this->_internal_set_leaderterm(from._internal_leaderterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchGetReply::CopyFrom(const BatchGetReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.BatchGetReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchGetReply::IsInitialized() const {
+  return true;
+}
+
+void BatchGetReply::InternalSwap(BatchGetReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchGetReply, _impl_.leaderterm_)
+      + sizeof(BatchGetReply::_impl_.leaderterm_)
+      - PROTOBUF_FIELD_OFFSET(BatchGetReply, _impl_.leaderid_)>(
+          reinterpret_cast<char*>(&_impl_.leaderid_),
+          reinterpret_cast<char*>(&other->_impl_.leaderid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchGetReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[12]);
+}
+
+// ===================================================================
+
+class RegisterClientArgs::_Internal {
+ public:
+};
+
+RegisterClientArgs::RegisterClientArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.RegisterClientArgs)
+}
+RegisterClientArgs::RegisterClientArgs(const RegisterClientArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RegisterClientArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.groupid_ = from._impl_.groupid_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.RegisterClientArgs)
+}
+
+inline void RegisterClientArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RegisterClientArgs::~RegisterClientArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.RegisterClientArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RegisterClientArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RegisterClientArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RegisterClientArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.RegisterClientArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.groupid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RegisterClientArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 GroupId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RegisterClientArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.RegisterClientArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_groupid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.RegisterClientArgs)
+  return target;
+}
+
+size_t RegisterClientArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.RegisterClientArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RegisterClientArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RegisterClientArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RegisterClientArgs::GetClassData() const { return &_class_data_; }
+
+
+void RegisterClientArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RegisterClientArgs*>(&to_msg);
+  auto& from = static_cast<const RegisterClientArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.RegisterClientArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterClientArgs::CopyFrom(const RegisterClientArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.RegisterClientArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RegisterClientArgs::IsInitialized() const {
+  return true;
+}
+
+void RegisterClientArgs::InternalSwap(RegisterClientArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.groupid_, other->_impl_.groupid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RegisterClientArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[13]);
+}
+
+// ===================================================================
+
+class RegisterClientReply::_Internal {
+ public:
+};
+
+RegisterClientReply::RegisterClientReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.RegisterClientReply)
+}
+RegisterClientReply::RegisterClientReply(const RegisterClientReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RegisterClientReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.clientid_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.leaderterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.clientid_, &from._impl_.clientid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderterm_) -
+    reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.leaderterm_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.RegisterClientReply)
+}
+
+inline void RegisterClientReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.clientid_){uint64_t{0u}}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.leaderterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RegisterClientReply::~RegisterClientReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.RegisterClientReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RegisterClientReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+}
+
+void RegisterClientReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RegisterClientReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.RegisterClientReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  ::memset(&_impl_.clientid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderterm_) -
+      reinterpret_cast<char*>(&_impl_.clientid_)) + sizeof(_impl_.leaderterm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RegisterClientReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ClientId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.leaderterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RegisterClientReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.RegisterClientReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // uint64 ClientId = 2;
+  if (this->_internal_clientid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_clientid(), target);
+  }
+
+  // int32 LeaderId = 3;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_leaderid(), target);
+  }
+
+  // int32 LeaderTerm = 4;
+  if (this->_internal_leaderterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_leaderterm(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.RegisterClientReply)
+  return target;
+}
+
+size_t RegisterClientReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.RegisterClientReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // uint64 ClientId = 2;
+  if (this->_internal_clientid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_clientid());
+  }
+
+  // int32 LeaderId = 3;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 LeaderTerm = 4;
+  if (this->_internal_leaderterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderterm());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RegisterClientReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RegisterClientReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RegisterClientReply::GetClassData() const { return &_class_data_; }
+
+
+void RegisterClientReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RegisterClientReply*>(&to_msg);
+  auto& from = static_cast<const RegisterClientReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.RegisterClientReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_clientid() != 0) {
+    _this->_internal_set_clientid(from._internal_clientid());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_leaderterm() != 0) {
+    _this->_internal_set_leaderterm(from._internal_leaderterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterClientReply::CopyFrom(const RegisterClientReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.RegisterClientReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RegisterClientReply::IsInitialized() const {
+  return true;
+}
+
+void RegisterClientReply::InternalSwap(RegisterClientReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RegisterClientReply, _impl_.leaderterm_)
+      + sizeof(RegisterClientReply::_impl_.leaderterm_)
+      - PROTOBUF_FIELD_OFFSET(RegisterClientReply, _impl_.clientid_)>(
+          reinterpret_cast<char*>(&_impl_.clientid_),
+          reinterpret_cast<char*>(&other->_impl_.clientid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RegisterClientReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[14]);
+}
+
+// ===================================================================
+
+class GetRangesArgs::_Internal {
+ public:
+};
+
+GetRangesArgs::GetRangesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.GetRangesArgs)
+}
+GetRangesArgs::GetRangesArgs(const GetRangesArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  GetRangesArgs* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.GetRangesArgs)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetRangesArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetRangesArgs::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetRangesArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[15]);
+}
+
+// ===================================================================
+
+class RangeInfo::_Internal {
+ public:
+};
+
+RangeInfo::RangeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.RangeInfo)
+}
+RangeInfo::RangeInfo(const RangeInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RangeInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_start().empty()) {
+    _this->_impl_.start_.Set(from._internal_start(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_end().empty()) {
+    _this->_impl_.end_.Set(from._internal_end(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.groupid_ = from._impl_.groupid_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.RangeInfo)
+}
+
+inline void RangeInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RangeInfo::~RangeInfo() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.RangeInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RangeInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.start_.Destroy();
+  _impl_.end_.Destroy();
+}
+
+void RangeInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RangeInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.RangeInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.start_.ClearToEmpty();
+  _impl_.end_.ClearToEmpty();
+  _impl_.groupid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RangeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 GroupId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Start = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_start();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes End = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_end();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RangeInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.RangeInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_groupid(), target);
+  }
+
+  // bytes Start = 2;
+  if (!this->_internal_start().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_start(), target);
+  }
+
+  // bytes End = 3;
+  if (!this->_internal_end().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_end(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.RangeInfo)
+  return target;
+}
+
+size_t RangeInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.RangeInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Start = 2;
+  if (!this->_internal_start().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_start());
+  }
+
+  // bytes End = 3;
+  if (!this->_internal_end().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_end());
+  }
+
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RangeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RangeInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RangeInfo::GetClassData() const { return &_class_data_; }
+
+
+void RangeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RangeInfo*>(&to_msg);
+  auto& from = static_cast<const RangeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.RangeInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_start().empty()) {
+    _this->_internal_set_start(from._internal_start());
+  }
+  if (!from._internal_end().empty()) {
+    _this->_internal_set_end(from._internal_end());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RangeInfo::CopyFrom(const RangeInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.RangeInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RangeInfo::IsInitialized() const {
+  return true;
+}
+
+void RangeInfo::InternalSwap(RangeInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.start_, lhs_arena,
+      &other->_impl_.start_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.end_, lhs_arena,
+      &other->_impl_.end_, rhs_arena
+  );
+  swap(_impl_.groupid_, other->_impl_.groupid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RangeInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[16]);
+}
+
+// ===================================================================
+
+class GetRangesReply::_Internal {
+ public:
+};
+
+GetRangesReply::GetRangesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.GetRangesReply)
+}
+GetRangesReply::GetRangesReply(const GetRangesReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetRangesReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ranges_){from._impl_.ranges_}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.groups_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.groups_ = from._impl_.groups_;
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.GetRangesReply)
+}
+
+inline void GetRangesReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ranges_){arena}
+    , decltype(_impl_.err_){}
+    , decltype(_impl_.groups_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetRangesReply::~GetRangesReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.GetRangesReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetRangesReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ranges_.~RepeatedPtrField();
+  _impl_.err_.Destroy();
+}
+
+void GetRangesReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetRangesReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.GetRangesReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ranges_.Clear();
+  _impl_.err_.ClearToEmpty();
+  _impl_.groups_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetRangesReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Groups = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.groups_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftKVRpcProctoc.RangeInfo Ranges = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ranges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetRangesReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.GetRangesReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // int32 Groups = 2;
+  if (this->_internal_groups() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_groups(), target);
+  }
+
+  // repeated .raftKVRpcProctoc.RangeInfo Ranges = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ranges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ranges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.GetRangesReply)
+  return target;
+}
+
+size_t GetRangesReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.GetRangesReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftKVRpcProctoc.RangeInfo Ranges = 3;
+  total_size += 1UL * this->_internal_ranges_size();
+  for (const auto& msg : this->_impl_.ranges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // int32 Groups = 2;
+  if (this->_internal_groups() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groups());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetRangesReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetRangesReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetRangesReply::GetClassData() const { return &_class_data_; }
+
+
+void GetRangesReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetRangesReply*>(&to_msg);
+  auto& from = static_cast<const GetRangesReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.GetRangesReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ranges_.MergeFrom(from._impl_.ranges_);
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_groups() != 0) {
+    _this->_internal_set_groups(from._internal_groups());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetRangesReply::CopyFrom(const GetRangesReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.GetRangesReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetRangesReply::IsInitialized() const {
+  return true;
+}
+
+void GetRangesReply::InternalSwap(GetRangesReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ranges_.InternalSwap(&other->_impl_.ranges_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  swap(_impl_.groups_, other->_impl_.groups_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetRangesReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[17]);
+}
+
+// ===================================================================
+
+class TransferLeaderArgs::_Internal {
+ public:
+};
+
+TransferLeaderArgs::TransferLeaderArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.TransferLeaderArgs)
+}
+TransferLeaderArgs::TransferLeaderArgs(const TransferLeaderArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferLeaderArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.groupid_){}
+    , decltype(_impl_.target_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.groupid_, &from._impl_.groupid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.target_) -
+    reinterpret_cast<char*>(&_impl_.groupid_)) + sizeof(_impl_.target_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.TransferLeaderArgs)
+}
+
+inline void TransferLeaderArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.groupid_){0}
+    , decltype(_impl_.target_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TransferLeaderArgs::~TransferLeaderArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.TransferLeaderArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferLeaderArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TransferLeaderArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferLeaderArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.TransferLeaderArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.groupid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.target_) -
+      reinterpret_cast<char*>(&_impl_.groupid_)) + sizeof(_impl_.target_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferLeaderArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 GroupId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Target = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.target_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransferLeaderArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.TransferLeaderArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_groupid(), target);
+  }
+
+  // int32 Target = 2;
+  if (this->_internal_target() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_target(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.TransferLeaderArgs)
+  return target;
+}
+
+size_t TransferLeaderArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.TransferLeaderArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  // int32 Target = 2;
+  if (this->_internal_target() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_target());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferLeaderArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferLeaderArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferLeaderArgs::GetClassData() const { return &_class_data_; }
+
+
+void TransferLeaderArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferLeaderArgs*>(&to_msg);
+  auto& from = static_cast<const TransferLeaderArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.TransferLeaderArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  if (from._internal_target() != 0) {
+    _this->_internal_set_target(from._internal_target());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransferLeaderArgs::CopyFrom(const TransferLeaderArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.TransferLeaderArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferLeaderArgs::IsInitialized() const {
+  return true;
+}
+
+void TransferLeaderArgs::InternalSwap(TransferLeaderArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TransferLeaderArgs, _impl_.target_)
+      + sizeof(TransferLeaderArgs::_impl_.target_)
+      - PROTOBUF_FIELD_OFFSET(TransferLeaderArgs, _impl_.groupid_)>(
+          reinterpret_cast<char*>(&_impl_.groupid_),
+          reinterpret_cast<char*>(&other->_impl_.groupid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferLeaderArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[18]);
+}
+
+// ===================================================================
+
+class TransferLeaderReply::_Internal {
+ public:
+};
+
+TransferLeaderReply::TransferLeaderReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.TransferLeaderReply)
+}
+TransferLeaderReply::TransferLeaderReply(const TransferLeaderReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferLeaderReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.leaderterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderterm_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.TransferLeaderReply)
+}
+
+inline void TransferLeaderReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.leaderterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TransferLeaderReply::~TransferLeaderReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.TransferLeaderReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferLeaderReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
+}
+
+void TransferLeaderReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferLeaderReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.TransferLeaderReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.err_.ClearToEmpty();
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderterm_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferLeaderReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Err = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderTerm = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.leaderterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransferLeaderReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.TransferLeaderReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
+  }
+
+  // int32 LeaderTerm = 3;
+  if (this->_internal_leaderterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_leaderterm(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.TransferLeaderReply)
+  return target;
+}
+
+size_t TransferLeaderReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.TransferLeaderReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 LeaderTerm = 3;
+  if (this->_internal_leaderterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderterm());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferLeaderReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferLeaderReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferLeaderReply::GetClassData() const { return &_class_data_; }
+
+
+void TransferLeaderReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferLeaderReply*>(&to_msg);
+  auto& from = static_cast<const TransferLeaderReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.TransferLeaderReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_leaderterm() != 0) {
+    _this->_internal_set_leaderterm(from._internal_leaderterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransferLeaderReply::CopyFrom(const TransferLeaderReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.TransferLeaderReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferLeaderReply::IsInitialized() const {
+  return true;
+}
+
+void TransferLeaderReply::InternalSwap(TransferLeaderReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TransferLeaderReply, _impl_.leaderterm_)
+      + sizeof(TransferLeaderReply::_impl_.leaderterm_)
+      - PROTOBUF_FIELD_OFFSET(TransferLeaderReply, _impl_.leaderid_)>(
+          reinterpret_cast<char*>(&_impl_.leaderid_),
+          reinterpret_cast<char*>(&other->_impl_.leaderid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferLeaderReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[19]);
+}
+
+// ===================================================================
+
+class ChangeMembershipArgs::_Internal {
+ public:
+};
+
+ChangeMembershipArgs::ChangeMembershipArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.ChangeMembershipArgs)
+}
+ChangeMembershipArgs::ChangeMembershipArgs(const ChangeMembershipArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChangeMembershipArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.groupid_){}
+    , decltype(_impl_.kind_){}
+    , decltype(_impl_.nodeid_){}
+    , decltype(_impl_.port_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip().empty()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.groupid_, &from._impl_.groupid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port_) -
+    reinterpret_cast<char*>(&_impl_.groupid_)) + sizeof(_impl_.port_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.ChangeMembershipArgs)
+}
+
+inline void ChangeMembershipArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.groupid_){0}
+    , decltype(_impl_.kind_){0}
+    , decltype(_impl_.nodeid_){0}
+    , decltype(_impl_.port_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChangeMembershipArgs::~ChangeMembershipArgs() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.ChangeMembershipArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChangeMembershipArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
+}
+
+void ChangeMembershipArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChangeMembershipArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.ChangeMembershipArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ip_.ClearToEmpty();
+  ::memset(&_impl_.groupid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.port_) -
+      reinterpret_cast<char*>(&_impl_.groupid_)) + sizeof(_impl_.port_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChangeMembershipArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 GroupId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Kind = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.kind_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 NodeId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.nodeid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Ip = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Port = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChangeMembershipArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.ChangeMembershipArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_groupid(), target);
+  }
+
+  // int32 Kind = 2;
+  if (this->_internal_kind() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_kind(), target);
+  }
+
+  // int32 NodeId = 3;
+  if (this->_internal_nodeid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_nodeid(), target);
+  }
+
+  // bytes Ip = 4;
+  if (!this->_internal_ip().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_ip(), target);
+  }
+
+  // int32 Port = 5;
+  if (this->_internal_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_port(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.ChangeMembershipArgs)
+  return target;
+}
+
+size_t ChangeMembershipArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.ChangeMembershipArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Ip = 4;
+  if (!this->_internal_ip().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
   }
-  if (from.clientid().size() > 0) {
-    _internal_set_clientid(from._internal_clientid());
+
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  // int32 Kind = 2;
+  if (this->_internal_kind() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_kind());
+  }
+
+  // int32 NodeId = 3;
+  if (this->_internal_nodeid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nodeid());
   }
-  if (from.requestid() != 0) {
-    _internal_set_requestid(from._internal_requestid());
+
+  // int32 Port = 5;
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PutAppendArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftKVRpcProctoc.PutAppendArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChangeMembershipArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChangeMembershipArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChangeMembershipArgs::GetClassData() const { return &_class_data_; }
+
+
+void ChangeMembershipArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChangeMembershipArgs*>(&to_msg);
+  auto& from = static_cast<const ChangeMembershipArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.ChangeMembershipArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_ip().empty()) {
+    _this->_internal_set_ip(from._internal_ip());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  if (from._internal_kind() != 0) {
+    _this->_internal_set_kind(from._internal_kind());
+  }
+  if (from._internal_nodeid() != 0) {
+    _this->_internal_set_nodeid(from._internal_nodeid());
+  }
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PutAppendArgs::CopyFrom(const PutAppendArgs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.PutAppendArgs)
+void ChangeMembershipArgs::CopyFrom(const ChangeMembershipArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.ChangeMembershipArgs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PutAppendArgs::IsInitialized() const {
+bool ChangeMembershipArgs::IsInitialized() const {
   return true;
 }
 
-void PutAppendArgs::InternalSwap(PutAppendArgs* other) {
+void ChangeMembershipArgs::InternalSwap(ChangeMembershipArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  key_.Swap(&other->key_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  op_.Swap(&other->op_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  clientid_.Swap(&other->clientid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(requestid_, other->requestid_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ChangeMembershipArgs, _impl_.port_)
+      + sizeof(ChangeMembershipArgs::_impl_.port_)
+      - PROTOBUF_FIELD_OFFSET(ChangeMembershipArgs, _impl_.groupid_)>(
+          reinterpret_cast<char*>(&_impl_.groupid_),
+          reinterpret_cast<char*>(&other->_impl_.groupid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata PutAppendArgs::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ChangeMembershipArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[20]);
 }
 
-
 // ===================================================================
 
-void PutAppendReply::InitAsDefaultInstance() {
-}
-class PutAppendReply::_Internal {
+class ChangeMembershipReply::_Internal {
  public:
 };
 
-PutAppendReply::PutAppendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.PutAppendReply)
+ChangeMembershipReply::ChangeMembershipReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftKVRpcProctoc.ChangeMembershipReply)
 }
-PutAppendReply::PutAppendReply(const PutAppendReply& from)
+ChangeMembershipReply::ChangeMembershipReply(const ChangeMembershipReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChangeMembershipReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.leaderterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  err_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_err().empty()) {
-    err_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_err(),
-      GetArena());
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.PutAppendReply)
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderterm_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
+  // @@protoc_insertion_point(copy_constructor:raftKVRpcProctoc.ChangeMembershipReply)
 }
 
-void PutAppendReply::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PutAppendReply_kvServerRPC_2eproto.base);
-  err_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ChangeMembershipReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.leaderterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-PutAppendReply::~PutAppendReply() {
-  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.PutAppendReply)
+ChangeMembershipReply::~ChangeMembershipReply() {
+  // @@protoc_insertion_point(destructor:raftKVRpcProctoc.ChangeMembershipReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PutAppendReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  err_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ChangeMembershipReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
 }
 
-void PutAppendReply::ArenaDtor(void* object) {
-  PutAppendReply* _this = reinterpret_cast< PutAppendReply* >(object);
-  (void)_this;
-}
-void PutAppendReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void ChangeMembershipReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-void PutAppendReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const PutAppendReply& PutAppendReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PutAppendReply_kvServerRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void PutAppendReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.PutAppendReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ChangeMembershipReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftKVRpcProctoc.ChangeMembershipReply)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  err_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.err_.ClearToEmpty();
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderterm_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.leaderterm_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* PutAppendReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ChangeMembershipReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Err = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_err();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderTerm = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.leaderterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* PutAppendReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.PutAppendReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ChangeMembershipReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftKVRpcProctoc.ChangeMembershipReply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Err = 1;
-  if (this->err().size() > 0) {
+  if (!this->_internal_err().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_err(), target);
   }
 
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
+  }
+
+  // int32 LeaderTerm = 3;
+  if (this->_internal_leaderterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_leaderterm(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.PutAppendReply)
+  // @@protoc_insertion_point(serialize_to_array_end:raftKVRpcProctoc.ChangeMembershipReply)
   return target;
 }
 
-size_t PutAppendReply::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.PutAppendReply)
+size_t ChangeMembershipReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftKVRpcProctoc.ChangeMembershipReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Err = 1;
-  if (this->err().size() > 0) {
+  if (!this->_internal_err().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_err());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void PutAppendReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftKVRpcProctoc.PutAppendReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PutAppendReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PutAppendReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftKVRpcProctoc.PutAppendReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftKVRpcProctoc.PutAppendReply)
-    MergeFrom(*source);
+  // int32 LeaderTerm = 3;
+  if (this->_internal_leaderterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderterm());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PutAppendReply::MergeFrom(const PutAppendReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.PutAppendReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChangeMembershipReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChangeMembershipReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChangeMembershipReply::GetClassData() const { return &_class_data_; }
+
+
+void ChangeMembershipReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChangeMembershipReply*>(&to_msg);
+  auto& from = static_cast<const ChangeMembershipReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftKVRpcProctoc.ChangeMembershipReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.err().size() > 0) {
-    _internal_set_err(from._internal_err());
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
   }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_leaderterm() != 0) {
+    _this->_internal_set_leaderterm(from._internal_leaderterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PutAppendReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftKVRpcProctoc.PutAppendReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void PutAppendReply::CopyFrom(const PutAppendReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.PutAppendReply)
+void ChangeMembershipReply::CopyFrom(const ChangeMembershipReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftKVRpcProctoc.ChangeMembershipReply)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PutAppendReply::IsInitialized() const {
+bool ChangeMembershipReply::IsInitialized() const {
   return true;
 }
 
-void PutAppendReply::InternalSwap(PutAppendReply* other) {
+void ChangeMembershipReply::InternalSwap(ChangeMembershipReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  err_.Swap(&other->err_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ChangeMembershipReply, _impl_.leaderterm_)
+      + sizeof(ChangeMembershipReply::_impl_.leaderterm_)
+      - PROTOBUF_FIELD_OFFSET(ChangeMembershipReply, _impl_.leaderid_)>(
+          reinterpret_cast<char*>(&_impl_.leaderid_),
+          reinterpret_cast<char*>(&other->_impl_.leaderid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata PutAppendReply::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ChangeMembershipReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvServerRPC_2eproto_getter, &descriptor_table_kvServerRPC_2eproto_once,
+      file_level_metadata_kvServerRPC_2eproto[21]);
 }
 
-
 // ===================================================================
 
 kvServerRpc::~kvServerRpc() {}
@@ -1236,6 +6902,62 @@ void kvServerRpc::Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
   done->Run();
 }
 
+void kvServerRpc::Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::ScanArgs*,
+                         ::raftKVRpcProctoc::ScanReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Scan() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::BatchPut(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::BatchPutArgs*,
+                         ::raftKVRpcProctoc::BatchPutReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method BatchPut() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::BatchGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::BatchGetArgs*,
+                         ::raftKVRpcProctoc::BatchGetReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method BatchGet() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::RegisterClient(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::RegisterClientArgs*,
+                         ::raftKVRpcProctoc::RegisterClientReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method RegisterClient() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::GetRanges(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::GetRangesArgs*,
+                         ::raftKVRpcProctoc::GetRangesReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method GetRanges() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::TransferLeader(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::TransferLeaderArgs*,
+                         ::raftKVRpcProctoc::TransferLeaderReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method TransferLeader() not implemented.");
+  done->Run();
+}
+
+void kvServerRpc::ChangeMembership(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftKVRpcProctoc::ChangeMembershipArgs*,
+                         ::raftKVRpcProctoc::ChangeMembershipReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method ChangeMembership() not implemented.");
+  done->Run();
+}
+
 void kvServerRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
                              ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                              const ::PROTOBUF_NAMESPACE_ID::Message* request,
@@ -1259,6 +6981,62 @@ void kvServerRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* me
                  response),
              done);
       break;
+    case 2:
+      Scan(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::ScanArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::ScanReply*>(
+                 response),
+             done);
+      break;
+    case 3:
+      BatchPut(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::BatchPutArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::BatchPutReply*>(
+                 response),
+             done);
+      break;
+    case 4:
+      BatchGet(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::BatchGetArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::BatchGetReply*>(
+                 response),
+             done);
+      break;
+    case 5:
+      RegisterClient(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::RegisterClientArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::RegisterClientReply*>(
+                 response),
+             done);
+      break;
+    case 6:
+      GetRanges(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::GetRangesArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::GetRangesReply*>(
+                 response),
+             done);
+      break;
+    case 7:
+      TransferLeader(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::TransferLeaderArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::TransferLeaderReply*>(
+                 response),
+             done);
+      break;
+    case 8:
+      ChangeMembership(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftKVRpcProctoc::ChangeMembershipArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftKVRpcProctoc::ChangeMembershipReply*>(
+                 response),
+             done);
+      break;
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       break;
@@ -1273,6 +7051,20 @@ const ::PROTOBUF_NAMESPACE_ID::Message& kvServerRpc::GetRequestPrototype(
       return ::raftKVRpcProctoc::PutAppendArgs::default_instance();
     case 1:
       return ::raftKVRpcProctoc::GetArgs::default_instance();
+    case 2:
+      return ::raftKVRpcProctoc::ScanArgs::default_instance();
+    case 3:
+      return ::raftKVRpcProctoc::BatchPutArgs::default_instance();
+    case 4:
+      return ::raftKVRpcProctoc::BatchGetArgs::default_instance();
+    case 5:
+      return ::raftKVRpcProctoc::RegisterClientArgs::default_instance();
+    case 6:
+      return ::raftKVRpcProctoc::GetRangesArgs::default_instance();
+    case 7:
+      return ::raftKVRpcProctoc::TransferLeaderArgs::default_instance();
+    case 8:
+      return ::raftKVRpcProctoc::ChangeMembershipArgs::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
@@ -1288,6 +7080,20 @@ const ::PROTOBUF_NAMESPACE_ID::Message& kvServerRpc::GetResponsePrototype(
       return ::raftKVRpcProctoc::PutAppendReply::default_instance();
     case 1:
       return ::raftKVRpcProctoc::GetReply::default_instance();
+    case 2:
+      return ::raftKVRpcProctoc::ScanReply::default_instance();
+    case 3:
+      return ::raftKVRpcProctoc::BatchPutReply::default_instance();
+    case 4:
+      return ::raftKVRpcProctoc::BatchGetReply::default_instance();
+    case 5:
+      return ::raftKVRpcProctoc::RegisterClientReply::default_instance();
+    case 6:
+      return ::raftKVRpcProctoc::GetRangesReply::default_instance();
+    case 7:
+      return ::raftKVRpcProctoc::TransferLeaderReply::default_instance();
+    case 8:
+      return ::raftKVRpcProctoc::ChangeMembershipReply::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
@@ -1320,23 +7126,148 @@ void kvServerRpc_Stub::Get(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
   channel_->CallMethod(descriptor()->method(1),
                        controller, request, response, done);
 }
+void kvServerRpc_Stub::Scan(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::ScanArgs* request,
+                              ::raftKVRpcProctoc::ScanReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(2),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::BatchPut(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::BatchPutArgs* request,
+                              ::raftKVRpcProctoc::BatchPutReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(3),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::BatchGet(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::BatchGetArgs* request,
+                              ::raftKVRpcProctoc::BatchGetReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(4),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::RegisterClient(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::RegisterClientArgs* request,
+                              ::raftKVRpcProctoc::RegisterClientReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(5),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::GetRanges(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::GetRangesArgs* request,
+                              ::raftKVRpcProctoc::GetRangesReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(6),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::TransferLeader(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::TransferLeaderArgs* request,
+                              ::raftKVRpcProctoc::TransferLeaderReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(7),
+                       controller, request, response, done);
+}
+void kvServerRpc_Stub::ChangeMembership(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftKVRpcProctoc::ChangeMembershipArgs* request,
+                              ::raftKVRpcProctoc::ChangeMembershipReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(8),
+                       controller, request, response, done);
+}
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace raftKVRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetArgs* Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetArgs >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetArgs >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftKVRpcProctoc::GetArgs >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetReply* Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftKVRpcProctoc::GetReply >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::PutAppendArgs* Arena::CreateMaybeMessage< ::raftKVRpcProctoc::PutAppendArgs >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::PutAppendArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::PutAppendArgs >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftKVRpcProctoc::PutAppendArgs >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::PutAppendReply* Arena::CreateMaybeMessage< ::raftKVRpcProctoc::PutAppendReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::PutAppendReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::PutAppendReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftKVRpcProctoc::PutAppendReply >(arena);
 }
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::KeyValue*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::KeyValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::KeyValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::ScanArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::ScanArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::ScanArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::ScanReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::ScanReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::ScanReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::BatchOp*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::BatchOp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::BatchOp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::BatchPutArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::BatchPutArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::BatchPutArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::BatchPutReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::BatchPutReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::BatchPutReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::BatchGetArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::BatchGetArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::BatchGetArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::KeyResult*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::KeyResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::KeyResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::BatchGetReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::BatchGetReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::BatchGetReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::RegisterClientArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::RegisterClientArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::RegisterClientArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::RegisterClientReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::RegisterClientReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::RegisterClientReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetRangesArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetRangesArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::GetRangesArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::RangeInfo*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::RangeInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::RangeInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::GetRangesReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::GetRangesReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::GetRangesReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::TransferLeaderArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::TransferLeaderArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::TransferLeaderArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::TransferLeaderReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::TransferLeaderReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::TransferLeaderReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::ChangeMembershipArgs*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::ChangeMembershipArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::ChangeMembershipArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftKVRpcProctoc::ChangeMembershipReply*
+Arena::CreateMaybeMessage< ::raftKVRpcProctoc::ChangeMembershipReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftKVRpcProctoc::ChangeMembershipReply >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
-#include <google/protobuf/port_undef.inc>
\ No newline at end of file
+#include <google/protobuf/port_undef.inc>
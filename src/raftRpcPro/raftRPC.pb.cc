@@ -2,6 +2,7 @@
 // source: raftRPC.proto
 
 #include "raftRPC.pb.h"
+
 #include <algorithm>
 
 #include <google/protobuf/io/coded_stream.h>
@@ -13,2183 +14,4708 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_raftRPC_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LogEntry_raftRPC_2eproto;
-namespace raftRpcProctoc {
-class LogEntryDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<LogEntry> _instance;
-} _LogEntry_default_instance_;
-class AppendEntriesArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppendEntriesArgs> _instance;
-} _AppendEntriesArgs_default_instance_;
-class AppendEntriesReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppendEntriesReply> _instance;
-} _AppendEntriesReply_default_instance_;
-class RequestVoteArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RequestVoteArgs> _instance;
-} _RequestVoteArgs_default_instance_;
-class RequestVoteReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RequestVoteReply> _instance;
-} _RequestVoteReply_default_instance_;
-class InstallSnapshotRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InstallSnapshotRequest> _instance;
-} _InstallSnapshotRequest_default_instance_;
-class InstallSnapshotResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InstallSnapshotResponse> _instance;
-} _InstallSnapshotResponse_default_instance_;
-}  // namespace raftRpcProctoc
-static void InitDefaultsscc_info_AppendEntriesArgs_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_AppendEntriesArgs_default_instance_;
-    new (ptr) ::raftRpcProctoc::AppendEntriesArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProctoc::AppendEntriesArgs::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AppendEntriesArgs_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AppendEntriesArgs_raftRPC_2eproto}, {
-      &scc_info_LogEntry_raftRPC_2eproto.base,}};
-
-static void InitDefaultsscc_info_AppendEntriesReply_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_AppendEntriesReply_default_instance_;
-    new (ptr) ::raftRpcProctoc::AppendEntriesReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProctoc::AppendEntriesReply::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppendEntriesReply_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AppendEntriesReply_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_InstallSnapshotRequest_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_InstallSnapshotRequest_default_instance_;
-    new (ptr) ::raftRpcProctoc::InstallSnapshotRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProctoc::InstallSnapshotRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InstallSnapshotRequest_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_InstallSnapshotRequest_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_InstallSnapshotResponse_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_InstallSnapshotResponse_default_instance_;
-    new (ptr) ::raftRpcProctoc::InstallSnapshotResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProctoc::InstallSnapshotResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InstallSnapshotResponse_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_InstallSnapshotResponse_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_LogEntry_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_LogEntry_default_instance_;
-    new (ptr) ::raftRpcProctoc::LogEntry();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProctoc::LogEntry::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LogEntry_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_LogEntry_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_RequestVoteArgs_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProctoc::_RequestVoteArgs_default_instance_;
-    new (ptr) ::raftRpcProctoc::RequestVoteArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProctoc::RequestVoteArgs::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestVoteArgs_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RequestVoteArgs_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_RequestVoteReply_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::raftRpcProctoc::_RequestVoteReply_default_instance_;
-    new (ptr) ::raftRpcProctoc::RequestVoteReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProctoc::RequestVoteReply::InitAsDefaultInstance();
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestVoteReply_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RequestVoteReply_raftRPC_2eproto}, {}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_raftRPC_2eproto[7];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_raftRPC_2eproto = nullptr;
-static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* file_level_service_descriptors_raftRPC_2eproto[1];
+namespace raftRpcProctoc {
+PROTOBUF_CONSTEXPR Member::Member(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.port_)*/0
+  , /*decltype(_impl_.learner_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MemberDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MemberDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MemberDefaultTypeInternal() {}
+  union {
+    Member _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MemberDefaultTypeInternal _Member_default_instance_;
+PROTOBUF_CONSTEXPR Membership::Membership(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.members_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MembershipDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MembershipDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MembershipDefaultTypeInternal() {}
+  union {
+    Membership _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MembershipDefaultTypeInternal _Membership_default_instance_;
+PROTOBUF_CONSTEXPR LogEntry::LogEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.command_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.config_)*/nullptr
+  , /*decltype(_impl_.logterm_)*/0
+  , /*decltype(_impl_.logindex_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogEntryDefaultTypeInternal() {}
+  union {
+    LogEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogEntryDefaultTypeInternal _LogEntry_default_instance_;
+PROTOBUF_CONSTEXPR AppendEntriesArgs::AppendEntriesArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.prevlogindex_)*/0
+  , /*decltype(_impl_.prevlogterm_)*/0
+  , /*decltype(_impl_.leadercommit_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendEntriesArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendEntriesArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendEntriesArgsDefaultTypeInternal() {}
+  union {
+    AppendEntriesArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendEntriesArgsDefaultTypeInternal _AppendEntriesArgs_default_instance_;
+PROTOBUF_CONSTEXPR AppendEntriesReply::AppendEntriesReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.updatenextindex_)*/0
+  , /*decltype(_impl_.appstate_)*/0
+  , /*decltype(_impl_.conflictterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendEntriesReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendEntriesReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendEntriesReplyDefaultTypeInternal() {}
+  union {
+    AppendEntriesReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendEntriesReplyDefaultTypeInternal _AppendEntriesReply_default_instance_;
+PROTOBUF_CONSTEXPR RequestVoteArgs::RequestVoteArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.candidateid_)*/0
+  , /*decltype(_impl_.lastlogindex_)*/0
+  , /*decltype(_impl_.lastlogterm_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_.leadertransfer_)*/false
+  , /*decltype(_impl_.prevote_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestVoteArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestVoteArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestVoteArgsDefaultTypeInternal() {}
+  union {
+    RequestVoteArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestVoteArgsDefaultTypeInternal _RequestVoteArgs_default_instance_;
+PROTOBUF_CONSTEXPR RequestVoteReply::RequestVoteReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.votegranted_)*/false
+  , /*decltype(_impl_.votestate_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestVoteReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestVoteReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestVoteReplyDefaultTypeInternal() {}
+  union {
+    RequestVoteReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestVoteReplyDefaultTypeInternal _RequestVoteReply_default_instance_;
+PROTOBUF_CONSTEXPR InstallSnapshotRequest::InstallSnapshotRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.lastsnapshotincludeindex_)*/0
+  , /*decltype(_impl_.lastsnapshotincludeterm_)*/0
+  , /*decltype(_impl_.offset_)*/int64_t{0}
+  , /*decltype(_impl_.done_)*/false
+  , /*decltype(_impl_.crc_)*/0u
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InstallSnapshotRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstallSnapshotRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstallSnapshotRequestDefaultTypeInternal() {}
+  union {
+    InstallSnapshotRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstallSnapshotRequestDefaultTypeInternal _InstallSnapshotRequest_default_instance_;
+PROTOBUF_CONSTEXPR InstallSnapshotResponse::InstallSnapshotResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nextoffset_)*/int64_t{0}
+  , /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.installed_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InstallSnapshotResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstallSnapshotResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstallSnapshotResponseDefaultTypeInternal() {}
+  union {
+    InstallSnapshotResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
+PROTOBUF_CONSTEXPR ReadIndexArgs::ReadIndexArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadIndexArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadIndexArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadIndexArgsDefaultTypeInternal() {}
+  union {
+    ReadIndexArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadIndexArgsDefaultTypeInternal _ReadIndexArgs_default_instance_;
+PROTOBUF_CONSTEXPR ReadIndexReply::ReadIndexReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.readindex_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadIndexReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadIndexReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadIndexReplyDefaultTypeInternal() {}
+  union {
+    ReadIndexReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadIndexReplyDefaultTypeInternal _ReadIndexReply_default_instance_;
+PROTOBUF_CONSTEXPR TimeoutNowArgs::TimeoutNowArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TimeoutNowArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimeoutNowArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimeoutNowArgsDefaultTypeInternal() {}
+  union {
+    TimeoutNowArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimeoutNowArgsDefaultTypeInternal _TimeoutNowArgs_default_instance_;
+PROTOBUF_CONSTEXPR TimeoutNowReply::TimeoutNowReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TimeoutNowReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimeoutNowReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimeoutNowReplyDefaultTypeInternal() {}
+  union {
+    TimeoutNowReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimeoutNowReplyDefaultTypeInternal _TimeoutNowReply_default_instance_;
+PROTOBUF_CONSTEXPR RangeAdminArgs::RangeAdminArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.start_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.end_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_.from_)*/0
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RangeAdminArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RangeAdminArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RangeAdminArgsDefaultTypeInternal() {}
+  union {
+    RangeAdminArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RangeAdminArgsDefaultTypeInternal _RangeAdminArgs_default_instance_;
+PROTOBUF_CONSTEXPR RangeAdminReply::RangeAdminReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.err_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.leaderterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RangeAdminReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RangeAdminReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RangeAdminReplyDefaultTypeInternal() {}
+  union {
+    RangeAdminReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RangeAdminReplyDefaultTypeInternal _RangeAdminReply_default_instance_;
+}  // namespace raftRpcProctoc
+static ::_pb::Metadata file_level_metadata_raftRPC_2eproto[15];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_raftRPC_2eproto = nullptr;
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_raftRPC_2eproto[1];
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_raftRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_raftRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _impl_.port_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Member, _impl_.learner_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Membership, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::Membership, _impl_.members_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, command_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, logterm_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, logindex_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _impl_.command_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _impl_.logterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _impl_.logindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::LogEntry, _impl_.config_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, leaderid_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, prevlogindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, prevlogterm_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, entries_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, leadercommit_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.prevlogindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.prevlogterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.leadercommit_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesArgs, _impl_.groupid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, success_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, updatenextindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, appstate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _impl_.updatenextindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _impl_.appstate_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::AppendEntriesReply, _impl_.conflictterm_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, candidateid_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, lastlogindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, lastlogterm_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.candidateid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.lastlogindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.lastlogterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.leadertransfer_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteArgs, _impl_.prevote_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, votegranted_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, votestate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, _impl_.votegranted_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RequestVoteReply, _impl_.votestate_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, leaderid_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, lastsnapshotincludeindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, lastsnapshotincludeterm_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, data_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.lastsnapshotincludeindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.lastsnapshotincludeterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.done_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.crc_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotRequest, _impl_.groupid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotResponse, term_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotResponse, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotResponse, _impl_.nextoffset_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::InstallSnapshotResponse, _impl_.installed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::ReadIndexArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::ReadIndexArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::ReadIndexArgs, _impl_.groupid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::ReadIndexReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::ReadIndexReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::ReadIndexReply, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::ReadIndexReply, _impl_.readindex_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowArgs, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowArgs, _impl_.groupid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::TimeoutNowReply, _impl_.success_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminArgs, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminArgs, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminArgs, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminArgs, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminArgs, _impl_.start_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminArgs, _impl_.end_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminArgs, _impl_.data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminReply, _impl_.err_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminReply, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminReply, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProctoc::RangeAdminReply, _impl_.leaderterm_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::raftRpcProctoc::LogEntry)},
-  { 8, -1, sizeof(::raftRpcProctoc::AppendEntriesArgs)},
-  { 19, -1, sizeof(::raftRpcProctoc::AppendEntriesReply)},
-  { 28, -1, sizeof(::raftRpcProctoc::RequestVoteArgs)},
-  { 37, -1, sizeof(::raftRpcProctoc::RequestVoteReply)},
-  { 45, -1, sizeof(::raftRpcProctoc::InstallSnapshotRequest)},
-  { 55, -1, sizeof(::raftRpcProctoc::InstallSnapshotResponse)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::raftRpcProctoc::Member)},
+  { 10, -1, -1, sizeof(::raftRpcProctoc::Membership)},
+  { 17, -1, -1, sizeof(::raftRpcProctoc::LogEntry)},
+  { 27, -1, -1, sizeof(::raftRpcProctoc::AppendEntriesArgs)},
+  { 40, -1, -1, sizeof(::raftRpcProctoc::AppendEntriesReply)},
+  { 51, -1, -1, sizeof(::raftRpcProctoc::RequestVoteArgs)},
+  { 64, -1, -1, sizeof(::raftRpcProctoc::RequestVoteReply)},
+  { 73, -1, -1, sizeof(::raftRpcProctoc::InstallSnapshotRequest)},
+  { 88, -1, -1, sizeof(::raftRpcProctoc::InstallSnapshotResponse)},
+  { 97, -1, -1, sizeof(::raftRpcProctoc::ReadIndexArgs)},
+  { 105, -1, -1, sizeof(::raftRpcProctoc::ReadIndexReply)},
+  { 114, -1, -1, sizeof(::raftRpcProctoc::TimeoutNowArgs)},
+  { 123, -1, -1, sizeof(::raftRpcProctoc::TimeoutNowReply)},
+  { 131, -1, -1, sizeof(::raftRpcProctoc::RangeAdminArgs)},
+  { 144, -1, -1, sizeof(::raftRpcProctoc::RangeAdminReply)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_LogEntry_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_AppendEntriesArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_AppendEntriesReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_RequestVoteArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_RequestVoteReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_InstallSnapshotRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProctoc::_InstallSnapshotResponse_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::raftRpcProctoc::_Member_default_instance_._instance,
+  &::raftRpcProctoc::_Membership_default_instance_._instance,
+  &::raftRpcProctoc::_LogEntry_default_instance_._instance,
+  &::raftRpcProctoc::_AppendEntriesArgs_default_instance_._instance,
+  &::raftRpcProctoc::_AppendEntriesReply_default_instance_._instance,
+  &::raftRpcProctoc::_RequestVoteArgs_default_instance_._instance,
+  &::raftRpcProctoc::_RequestVoteReply_default_instance_._instance,
+  &::raftRpcProctoc::_InstallSnapshotRequest_default_instance_._instance,
+  &::raftRpcProctoc::_InstallSnapshotResponse_default_instance_._instance,
+  &::raftRpcProctoc::_ReadIndexArgs_default_instance_._instance,
+  &::raftRpcProctoc::_ReadIndexReply_default_instance_._instance,
+  &::raftRpcProctoc::_TimeoutNowArgs_default_instance_._instance,
+  &::raftRpcProctoc::_TimeoutNowReply_default_instance_._instance,
+  &::raftRpcProctoc::_RangeAdminArgs_default_instance_._instance,
+  &::raftRpcProctoc::_RangeAdminReply_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_raftRPC_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\rraftRPC.proto\022\016raftRpcProctoc\">\n\010LogEn"
+  "\n\rraftRPC.proto\022\016raftRpcProctoc\"\?\n\006Membe"
+  "r\022\n\n\002Id\030\001 \001(\005\022\n\n\002Ip\030\002 \001(\014\022\014\n\004Port\030\003 \001(\005\022"
+  "\017\n\007Learner\030\004 \001(\010\"5\n\nMembership\022\'\n\007Member"
+  "s\030\001 \003(\0132\026.raftRpcProctoc.Member\"j\n\010LogEn"
   "try\022\017\n\007Command\030\001 \001(\014\022\017\n\007LogTerm\030\002 \001(\005\022\020\n"
-  "\010LogIndex\030\003 \001(\005\"\237\001\n\021AppendEntriesArgs\022\014\n"
-  "\004Term\030\001 \001(\005\022\020\n\010LeaderId\030\002 \001(\005\022\024\n\014PrevLog"
-  "Index\030\003 \001(\005\022\023\n\013PrevLogTerm\030\004 \001(\005\022)\n\007Entr"
-  "ies\030\005 \003(\0132\030.raftRpcProctoc.LogEntry\022\024\n\014L"
-  "eaderCommit\030\006 \001(\005\"^\n\022AppendEntriesReply\022"
-  "\014\n\004Term\030\001 \001(\005\022\017\n\007Success\030\002 \001(\010\022\027\n\017Update"
-  "NextIndex\030\003 \001(\005\022\020\n\010AppState\030\004 \001(\005\"_\n\017Req"
-  "uestVoteArgs\022\014\n\004Term\030\001 \001(\005\022\023\n\013CandidateI"
-  "d\030\002 \001(\005\022\024\n\014LastLogIndex\030\003 \001(\005\022\023\n\013LastLog"
-  "Term\030\004 \001(\005\"H\n\020RequestVoteReply\022\014\n\004Term\030\001"
-  " \001(\005\022\023\n\013VoteGranted\030\002 \001(\010\022\021\n\tVoteState\030\003"
-  " \001(\005\"\211\001\n\026InstallSnapshotRequest\022\020\n\010Leade"
-  "rId\030\001 \001(\005\022\014\n\004Term\030\002 \001(\005\022 \n\030LastSnapShotI"
-  "ncludeIndex\030\003 \001(\005\022\037\n\027LastSnapShotInclude"
-  "Term\030\004 \001(\005\022\014\n\004Data\030\005 \001(\014\"\'\n\027InstallSnaps"
-  "hotResponse\022\014\n\004Term\030\001 \001(\0052\227\002\n\007raftRpc\022V\n"
-  "\rAppendEntries\022!.raftRpcProctoc.AppendEn"
-  "triesArgs\032\".raftRpcProctoc.AppendEntries"
-  "Reply\022b\n\017InstallSnapshot\022&.raftRpcProcto"
-  "c.InstallSnapshotRequest\032\'.raftRpcProcto"
-  "c.InstallSnapshotResponse\022P\n\013RequestVote"
-  "\022\037.raftRpcProctoc.RequestVoteArgs\032 .raft"
-  "RpcProctoc.RequestVoteReplyB\003\200\001\001b\006proto3"
+  "\010LogIndex\030\003 \001(\005\022*\n\006Config\030\004 \001(\0132\032.raftRp"
+  "cProctoc.Membership\"\260\001\n\021AppendEntriesArg"
+  "s\022\014\n\004Term\030\001 \001(\005\022\020\n\010LeaderId\030\002 \001(\005\022\024\n\014Pre"
+  "vLogIndex\030\003 \001(\005\022\023\n\013PrevLogTerm\030\004 \001(\005\022)\n\007"
+  "Entries\030\005 \003(\0132\030.raftRpcProctoc.LogEntry\022"
+  "\024\n\014LeaderCommit\030\006 \001(\005\022\017\n\007GroupId\030\007 \001(\005\"t"
+  "\n\022AppendEntriesReply\022\014\n\004Term\030\001 \001(\005\022\017\n\007Su"
+  "ccess\030\002 \001(\010\022\027\n\017UpdateNextIndex\030\003 \001(\005\022\020\n\010"
+  "AppState\030\004 \001(\005\022\024\n\014ConflictTerm\030\005 \001(\005\"\231\001\n"
+  "\017RequestVoteArgs\022\014\n\004Term\030\001 \001(\005\022\023\n\013Candid"
+  "ateId\030\002 \001(\005\022\024\n\014LastLogIndex\030\003 \001(\005\022\023\n\013Las"
+  "tLogTerm\030\004 \001(\005\022\017\n\007GroupId\030\005 \001(\005\022\026\n\016Leade"
+  "rTransfer\030\006 \001(\010\022\017\n\007PreVote\030\007 \001(\010\"H\n\020Requ"
+  "estVoteReply\022\014\n\004Term\030\001 \001(\005\022\023\n\013VoteGrante"
+  "d\030\002 \001(\010\022\021\n\tVoteState\030\003 \001(\005\"\305\001\n\026InstallSn"
+  "apshotRequest\022\020\n\010LeaderId\030\001 \001(\005\022\014\n\004Term\030"
+  "\002 \001(\005\022 \n\030LastSnapShotIncludeIndex\030\003 \001(\005\022"
+  "\037\n\027LastSnapShotIncludeTerm\030\004 \001(\005\022\014\n\004Data"
+  "\030\005 \001(\014\022\016\n\006Offset\030\006 \001(\003\022\014\n\004Done\030\007 \001(\010\022\013\n\003"
+  "Crc\030\010 \001(\r\022\017\n\007GroupId\030\t \001(\005\"N\n\027InstallSna"
+  "pshotResponse\022\014\n\004Term\030\001 \001(\005\022\022\n\nNextOffse"
+  "t\030\002 \001(\003\022\021\n\tInstalled\030\003 \001(\010\".\n\rReadIndexA"
+  "rgs\022\014\n\004Term\030\001 \001(\005\022\017\n\007GroupId\030\002 \001(\005\"B\n\016Re"
+  "adIndexReply\022\014\n\004Term\030\001 \001(\005\022\017\n\007Success\030\002 "
+  "\001(\010\022\021\n\tReadIndex\030\003 \001(\005\"A\n\016TimeoutNowArgs"
+  "\022\014\n\004Term\030\001 \001(\005\022\020\n\010LeaderId\030\002 \001(\005\022\017\n\007Grou"
+  "pId\030\003 \001(\005\"0\n\017TimeoutNowReply\022\014\n\004Term\030\001 \001"
+  "(\005\022\017\n\007Success\030\002 \001(\010\"q\n\016RangeAdminArgs\022\017\n"
+  "\007GroupId\030\001 \001(\005\022\n\n\002Op\030\002 \001(\014\022\014\n\004From\030\003 \001(\005"
+  "\022\n\n\002Id\030\004 \001(\005\022\r\n\005Start\030\005 \001(\014\022\013\n\003End\030\006 \001(\014"
+  "\022\014\n\004Data\030\007 \001(\014\"P\n\017RangeAdminReply\022\013\n\003Err"
+  "\030\001 \001(\014\022\n\n\002Id\030\002 \001(\005\022\020\n\010LeaderId\030\003 \001(\005\022\022\n\n"
+  "LeaderTerm\030\004 \001(\0052\201\004\n\007raftRpc\022V\n\rAppendEn"
+  "tries\022!.raftRpcProctoc.AppendEntriesArgs"
+  "\032\".raftRpcProctoc.AppendEntriesReply\022b\n\017"
+  "InstallSnapshot\022&.raftRpcProctoc.Install"
+  "SnapshotRequest\032\'.raftRpcProctoc.Install"
+  "SnapshotResponse\022P\n\013RequestVote\022\037.raftRp"
+  "cProctoc.RequestVoteArgs\032 .raftRpcProcto"
+  "c.RequestVoteReply\022J\n\tReadIndex\022\035.raftRp"
+  "cProctoc.ReadIndexArgs\032\036.raftRpcProctoc."
+  "ReadIndexReply\022M\n\nTimeoutNow\022\036.raftRpcPr"
+  "octoc.TimeoutNowArgs\032\037.raftRpcProctoc.Ti"
+  "meoutNowReply\022M\n\nRangeAdmin\022\036.raftRpcPro"
+  "ctoc.RangeAdminArgs\032\037.raftRpcProctoc.Ran"
+  "geAdminReplyB\003\200\001\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_raftRPC_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_raftRPC_2eproto_sccs[7] = {
-  &scc_info_AppendEntriesArgs_raftRPC_2eproto.base,
-  &scc_info_AppendEntriesReply_raftRPC_2eproto.base,
-  &scc_info_InstallSnapshotRequest_raftRPC_2eproto.base,
-  &scc_info_InstallSnapshotResponse_raftRPC_2eproto.base,
-  &scc_info_LogEntry_raftRPC_2eproto.base,
-  &scc_info_RequestVoteArgs_raftRPC_2eproto.base,
-  &scc_info_RequestVoteReply_raftRPC_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_raftRPC_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_raftRPC_2eproto = {
-  false, false, descriptor_table_protodef_raftRPC_2eproto, "raftRPC.proto", 1000,
-  &descriptor_table_raftRPC_2eproto_once, descriptor_table_raftRPC_2eproto_sccs, descriptor_table_raftRPC_2eproto_deps, 7, 0,
-  schemas, file_default_instances, TableStruct_raftRPC_2eproto::offsets,
-  file_level_metadata_raftRPC_2eproto, 7, file_level_enum_descriptors_raftRPC_2eproto, file_level_service_descriptors_raftRPC_2eproto,
+static ::_pbi::once_flag descriptor_table_raftRPC_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_raftRPC_2eproto = {
+    false, false, 2025, descriptor_table_protodef_raftRPC_2eproto,
+    "raftRPC.proto",
+    &descriptor_table_raftRPC_2eproto_once, nullptr, 0, 15,
+    schemas, file_default_instances, TableStruct_raftRPC_2eproto::offsets,
+    file_level_metadata_raftRPC_2eproto, file_level_enum_descriptors_raftRPC_2eproto,
+    file_level_service_descriptors_raftRPC_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_raftRPC_2eproto_getter() {
+  return &descriptor_table_raftRPC_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_raftRPC_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_raftRPC_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_raftRPC_2eproto(&descriptor_table_raftRPC_2eproto);
 namespace raftRpcProctoc {
 
 // ===================================================================
 
-void LogEntry::InitAsDefaultInstance() {
-}
-class LogEntry::_Internal {
+class Member::_Internal {
  public:
 };
 
-LogEntry::LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.LogEntry)
+Member::Member(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.Member)
 }
-LogEntry::LogEntry(const LogEntry& from)
+Member::Member(const Member& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Member* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.port_){}
+    , decltype(_impl_.learner_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  command_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_command().empty()) {
-    command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_command(),
-      GetArena());
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip().empty()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.learner_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.learner_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.Member)
+}
+
+inline void Member::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.port_){0}
+    , decltype(_impl_.learner_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Member::~Member() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.Member)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  ::memcpy(&logterm_, &from.logterm_,
-    static_cast<size_t>(reinterpret_cast<char*>(&logindex_) -
-    reinterpret_cast<char*>(&logterm_)) + sizeof(logindex_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.LogEntry)
-}
-
-void LogEntry::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LogEntry_raftRPC_2eproto.base);
-  command_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&logterm_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&logindex_) -
-      reinterpret_cast<char*>(&logterm_)) + sizeof(logindex_));
-}
-
-LogEntry::~LogEntry() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.LogEntry)
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void LogEntry::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  command_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Member::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
 }
 
-void LogEntry::ArenaDtor(void* object) {
-  LogEntry* _this = reinterpret_cast< LogEntry* >(object);
-  (void)_this;
-}
-void LogEntry::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void LogEntry::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const LogEntry& LogEntry::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LogEntry_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void Member::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void LogEntry::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.LogEntry)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Member::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.Member)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  command_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::memset(&logterm_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&logindex_) -
-      reinterpret_cast<char*>(&logterm_)) + sizeof(logindex_));
+  _impl_.ip_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.learner_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.learner_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* LogEntry::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Member::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // bytes Command = 1;
+      // int32 Id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_command();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LogTerm = 2;
+      // bytes Ip = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          logterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LogIndex = 3;
+      // int32 Port = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          logindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Learner = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.learner_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* LogEntry::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.LogEntry)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Member::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.Member)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // bytes Command = 1;
-  if (this->command().size() > 0) {
+  // int32 Id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // bytes Ip = 2;
+  if (!this->_internal_ip().empty()) {
     target = stream->WriteBytesMaybeAliased(
-        1, this->_internal_command(), target);
+        2, this->_internal_ip(), target);
   }
 
-  // int32 LogTerm = 2;
-  if (this->logterm() != 0) {
+  // int32 Port = 3;
+  if (this->_internal_port() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_logterm(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_port(), target);
   }
 
-  // int32 LogIndex = 3;
-  if (this->logindex() != 0) {
+  // bool Learner = 4;
+  if (this->_internal_learner() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_logindex(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_learner(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.LogEntry)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.Member)
   return target;
 }
 
-size_t LogEntry::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.LogEntry)
+size_t Member::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.Member)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes Command = 1;
-  if (this->command().size() > 0) {
+  // bytes Ip = 2;
+  if (!this->_internal_ip().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_command());
+        this->_internal_ip());
   }
 
-  // int32 LogTerm = 2;
-  if (this->logterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_logterm());
+  // int32 Id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
   }
 
-  // int32 LogIndex = 3;
-  if (this->logindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_logindex());
+  // int32 Port = 3;
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
+  }
+
+  // bool Learner = 4;
+  if (this->_internal_learner() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Member::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Member::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Member::GetClassData() const { return &_class_data_; }
+
+
+void Member::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Member*>(&to_msg);
+  auto& from = static_cast<const Member&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.Member)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_ip().empty()) {
+    _this->_internal_set_ip(from._internal_ip());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
+  }
+  if (from._internal_learner() != 0) {
+    _this->_internal_set_learner(from._internal_learner());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Member::CopyFrom(const Member& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.Member)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Member::IsInitialized() const {
+  return true;
+}
+
+void Member::InternalSwap(Member* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Member, _impl_.learner_)
+      + sizeof(Member::_impl_.learner_)
+      - PROTOBUF_FIELD_OFFSET(Member, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Member::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[0]);
+}
+
+// ===================================================================
+
+class Membership::_Internal {
+ public:
+};
+
+Membership::Membership(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.Membership)
+}
+Membership::Membership(const Membership& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Membership* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.members_){from._impl_.members_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.Membership)
+}
+
+inline void Membership::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.members_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Membership::~Membership() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.Membership)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Membership::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.members_.~RepeatedPtrField();
+}
+
+void Membership::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Membership::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.Membership)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.members_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Membership::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .raftRpcProctoc.Member Members = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_members(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Membership::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.Membership)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .raftRpcProctoc.Member Members = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_members_size()); i < n; i++) {
+    const auto& repfield = this->_internal_members(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.Membership)
+  return target;
+}
+
+size_t Membership::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.Membership)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftRpcProctoc.Member Members = 1;
+  total_size += 1UL * this->_internal_members_size();
+  for (const auto& msg : this->_impl_.members_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Membership::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Membership::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Membership::GetClassData() const { return &_class_data_; }
+
+
+void Membership::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Membership*>(&to_msg);
+  auto& from = static_cast<const Membership&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.Membership)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.members_.MergeFrom(from._impl_.members_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void LogEntry::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.LogEntry)
-  GOOGLE_DCHECK_NE(&from, this);
-  const LogEntry* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LogEntry>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.LogEntry)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.LogEntry)
-    MergeFrom(*source);
+void Membership::CopyFrom(const Membership& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.Membership)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Membership::IsInitialized() const {
+  return true;
+}
+
+void Membership::InternalSwap(Membership* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.members_.InternalSwap(&other->_impl_.members_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Membership::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[1]);
+}
+
+// ===================================================================
+
+class LogEntry::_Internal {
+ public:
+  static const ::raftRpcProctoc::Membership& config(const LogEntry* msg);
+};
+
+const ::raftRpcProctoc::Membership&
+LogEntry::_Internal::config(const LogEntry* msg) {
+  return *msg->_impl_.config_;
+}
+LogEntry::LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.LogEntry)
+}
+LogEntry::LogEntry(const LogEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.logterm_){}
+    , decltype(_impl_.logindex_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_command().empty()) {
+    _this->_impl_.command_.Set(from._internal_command(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_config()) {
+    _this->_impl_.config_ = new ::raftRpcProctoc::Membership(*from._impl_.config_);
+  }
+  ::memcpy(&_impl_.logterm_, &from._impl_.logterm_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.logindex_) -
+    reinterpret_cast<char*>(&_impl_.logterm_)) + sizeof(_impl_.logindex_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.LogEntry)
+}
+
+inline void LogEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.logterm_){0}
+    , decltype(_impl_.logindex_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LogEntry::~LogEntry() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.LogEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.command_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.config_;
+}
+
+void LogEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.LogEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.command_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+  ::memset(&_impl_.logterm_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.logindex_) -
+      reinterpret_cast<char*>(&_impl_.logterm_)) + sizeof(_impl_.logindex_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes Command = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_command();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LogTerm = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.logterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LogIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.logindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .raftRpcProctoc.Membership Config = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.LogEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes Command = 1;
+  if (!this->_internal_command().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_command(), target);
+  }
+
+  // int32 LogTerm = 2;
+  if (this->_internal_logterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_logterm(), target);
+  }
+
+  // int32 LogIndex = 3;
+  if (this->_internal_logindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_logindex(), target);
+  }
+
+  // .raftRpcProctoc.Membership Config = 4;
+  if (this->_internal_has_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::config(this),
+        _Internal::config(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.LogEntry)
+  return target;
+}
+
+size_t LogEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.LogEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Command = 1;
+  if (!this->_internal_command().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_command());
+  }
+
+  // .raftRpcProctoc.Membership Config = 4;
+  if (this->_internal_has_config()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.config_);
+  }
+
+  // int32 LogTerm = 2;
+  if (this->_internal_logterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_logterm());
+  }
+
+  // int32 LogIndex = 3;
+  if (this->_internal_logindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_logindex());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogEntry::GetClassData() const { return &_class_data_; }
+
+
+void LogEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogEntry*>(&to_msg);
+  auto& from = static_cast<const LogEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.LogEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_command().empty()) {
+    _this->_internal_set_command(from._internal_command());
+  }
+  if (from._internal_has_config()) {
+    _this->_internal_mutable_config()->::raftRpcProctoc::Membership::MergeFrom(
+        from._internal_config());
+  }
+  if (from._internal_logterm() != 0) {
+    _this->_internal_set_logterm(from._internal_logterm());
+  }
+  if (from._internal_logindex() != 0) {
+    _this->_internal_set_logindex(from._internal_logindex());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogEntry::CopyFrom(const LogEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.LogEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogEntry::IsInitialized() const {
+  return true;
+}
+
+void LogEntry::InternalSwap(LogEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.command_, lhs_arena,
+      &other->_impl_.command_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogEntry, _impl_.logindex_)
+      + sizeof(LogEntry::_impl_.logindex_)
+      - PROTOBUF_FIELD_OFFSET(LogEntry, _impl_.config_)>(
+          reinterpret_cast<char*>(&_impl_.config_),
+          reinterpret_cast<char*>(&other->_impl_.config_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[2]);
+}
+
+// ===================================================================
+
+class AppendEntriesArgs::_Internal {
+ public:
+};
+
+AppendEntriesArgs::AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.AppendEntriesArgs)
+}
+AppendEntriesArgs::AppendEntriesArgs(const AppendEntriesArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendEntriesArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.prevlogindex_){}
+    , decltype(_impl_.prevlogterm_){}
+    , decltype(_impl_.leadercommit_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.AppendEntriesArgs)
+}
+
+inline void AppendEntriesArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.term_){0}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.prevlogindex_){0}
+    , decltype(_impl_.prevlogterm_){0}
+    , decltype(_impl_.leadercommit_){0}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AppendEntriesArgs::~AppendEntriesArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.AppendEntriesArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AppendEntriesArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void AppendEntriesArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AppendEntriesArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.AppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppendEntriesArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 PrevLogIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.prevlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 PrevLogTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.prevlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftRpcProctoc.LogEntry Entries = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderCommit = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.leadercommit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AppendEntriesArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.AppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
+  }
+
+  // int32 PrevLogIndex = 3;
+  if (this->_internal_prevlogindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_prevlogindex(), target);
+  }
+
+  // int32 PrevLogTerm = 4;
+  if (this->_internal_prevlogterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_prevlogterm(), target);
+  }
+
+  // repeated .raftRpcProctoc.LogEntry Entries = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 LeaderCommit = 6;
+  if (this->_internal_leadercommit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_leadercommit(), target);
+  }
+
+  // int32 GroupId = 7;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_groupid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.AppendEntriesArgs)
+  return target;
+}
+
+size_t AppendEntriesArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.AppendEntriesArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftRpcProctoc.LogEntry Entries = 5;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 PrevLogIndex = 3;
+  if (this->_internal_prevlogindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_prevlogindex());
+  }
+
+  // int32 PrevLogTerm = 4;
+  if (this->_internal_prevlogterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_prevlogterm());
+  }
+
+  // int32 LeaderCommit = 6;
+  if (this->_internal_leadercommit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leadercommit());
+  }
+
+  // int32 GroupId = 7;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendEntriesArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendEntriesArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendEntriesArgs::GetClassData() const { return &_class_data_; }
+
+
+void AppendEntriesArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendEntriesArgs*>(&to_msg);
+  auto& from = static_cast<const AppendEntriesArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.AppendEntriesArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_prevlogindex() != 0) {
+    _this->_internal_set_prevlogindex(from._internal_prevlogindex());
+  }
+  if (from._internal_prevlogterm() != 0) {
+    _this->_internal_set_prevlogterm(from._internal_prevlogterm());
+  }
+  if (from._internal_leadercommit() != 0) {
+    _this->_internal_set_leadercommit(from._internal_leadercommit());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AppendEntriesArgs::CopyFrom(const AppendEntriesArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.AppendEntriesArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppendEntriesArgs::IsInitialized() const {
+  return true;
+}
+
+void AppendEntriesArgs::InternalSwap(AppendEntriesArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, _impl_.groupid_)
+      + sizeof(AppendEntriesArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[3]);
+}
+
+// ===================================================================
+
+class AppendEntriesReply::_Internal {
+ public:
+};
+
+AppendEntriesReply::AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.AppendEntriesReply)
+}
+AppendEntriesReply::AppendEntriesReply(const AppendEntriesReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendEntriesReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.updatenextindex_){}
+    , decltype(_impl_.appstate_){}
+    , decltype(_impl_.conflictterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.conflictterm_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.conflictterm_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.AppendEntriesReply)
+}
+
+inline void AppendEntriesReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.updatenextindex_){0}
+    , decltype(_impl_.appstate_){0}
+    , decltype(_impl_.conflictterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AppendEntriesReply::~AppendEntriesReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.AppendEntriesReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AppendEntriesReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void AppendEntriesReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AppendEntriesReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.AppendEntriesReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.conflictterm_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.conflictterm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppendEntriesReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Success = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 UpdateNextIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.updatenextindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 AppState = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.appstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 ConflictTerm = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.conflictterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AppendEntriesReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.AppendEntriesReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
+  }
+
+  // int32 UpdateNextIndex = 3;
+  if (this->_internal_updatenextindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_updatenextindex(), target);
+  }
+
+  // int32 AppState = 4;
+  if (this->_internal_appstate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_appstate(), target);
+  }
+
+  // int32 ConflictTerm = 5;
+  if (this->_internal_conflictterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_conflictterm(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.AppendEntriesReply)
+  return target;
+}
+
+size_t AppendEntriesReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.AppendEntriesReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 UpdateNextIndex = 3;
+  if (this->_internal_updatenextindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_updatenextindex());
+  }
+
+  // int32 AppState = 4;
+  if (this->_internal_appstate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_appstate());
+  }
+
+  // int32 ConflictTerm = 5;
+  if (this->_internal_conflictterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_conflictterm());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendEntriesReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendEntriesReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendEntriesReply::GetClassData() const { return &_class_data_; }
+
+
+void AppendEntriesReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendEntriesReply*>(&to_msg);
+  auto& from = static_cast<const AppendEntriesReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.AppendEntriesReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_updatenextindex() != 0) {
+    _this->_internal_set_updatenextindex(from._internal_updatenextindex());
+  }
+  if (from._internal_appstate() != 0) {
+    _this->_internal_set_appstate(from._internal_appstate());
+  }
+  if (from._internal_conflictterm() != 0) {
+    _this->_internal_set_conflictterm(from._internal_conflictterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AppendEntriesReply::CopyFrom(const AppendEntriesReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.AppendEntriesReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppendEntriesReply::IsInitialized() const {
+  return true;
+}
+
+void AppendEntriesReply::InternalSwap(AppendEntriesReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AppendEntriesReply, _impl_.conflictterm_)
+      + sizeof(AppendEntriesReply::_impl_.conflictterm_)
+      - PROTOBUF_FIELD_OFFSET(AppendEntriesReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[4]);
+}
+
+// ===================================================================
+
+class RequestVoteArgs::_Internal {
+ public:
+};
+
+RequestVoteArgs::RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RequestVoteArgs)
+}
+RequestVoteArgs::RequestVoteArgs(const RequestVoteArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestVoteArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.candidateid_){}
+    , decltype(_impl_.lastlogindex_){}
+    , decltype(_impl_.lastlogterm_){}
+    , decltype(_impl_.groupid_){}
+    , decltype(_impl_.leadertransfer_){}
+    , decltype(_impl_.prevote_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.prevote_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.prevote_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RequestVoteArgs)
+}
+
+inline void RequestVoteArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.candidateid_){0}
+    , decltype(_impl_.lastlogindex_){0}
+    , decltype(_impl_.lastlogterm_){0}
+    , decltype(_impl_.groupid_){0}
+    , decltype(_impl_.leadertransfer_){false}
+    , decltype(_impl_.prevote_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RequestVoteArgs::~RequestVoteArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.RequestVoteArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestVoteArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RequestVoteArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestVoteArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RequestVoteArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.prevote_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.prevote_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestVoteArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 CandidateId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.candidateid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastLogIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.lastlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastLogTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.lastlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool LeaderTransfer = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.leadertransfer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool PreVote = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.prevote_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestVoteArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RequestVoteArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // int32 CandidateId = 2;
+  if (this->_internal_candidateid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_candidateid(), target);
+  }
+
+  // int32 LastLogIndex = 3;
+  if (this->_internal_lastlogindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastlogindex(), target);
+  }
+
+  // int32 LastLogTerm = 4;
+  if (this->_internal_lastlogterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastlogterm(), target);
+  }
+
+  // int32 GroupId = 5;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_groupid(), target);
+  }
+
+  // bool LeaderTransfer = 6;
+  if (this->_internal_leadertransfer() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_leadertransfer(), target);
+  }
+
+  // bool PreVote = 7;
+  if (this->_internal_prevote() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_prevote(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RequestVoteArgs)
+  return target;
+}
+
+size_t RequestVoteArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RequestVoteArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 CandidateId = 2;
+  if (this->_internal_candidateid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_candidateid());
+  }
+
+  // int32 LastLogIndex = 3;
+  if (this->_internal_lastlogindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastlogindex());
+  }
+
+  // int32 LastLogTerm = 4;
+  if (this->_internal_lastlogterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastlogterm());
+  }
+
+  // int32 GroupId = 5;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  // bool LeaderTransfer = 6;
+  if (this->_internal_leadertransfer() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool PreVote = 7;
+  if (this->_internal_prevote() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestVoteArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestVoteArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestVoteArgs::GetClassData() const { return &_class_data_; }
+
+
+void RequestVoteArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestVoteArgs*>(&to_msg);
+  auto& from = static_cast<const RequestVoteArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RequestVoteArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_candidateid() != 0) {
+    _this->_internal_set_candidateid(from._internal_candidateid());
+  }
+  if (from._internal_lastlogindex() != 0) {
+    _this->_internal_set_lastlogindex(from._internal_lastlogindex());
+  }
+  if (from._internal_lastlogterm() != 0) {
+    _this->_internal_set_lastlogterm(from._internal_lastlogterm());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  if (from._internal_leadertransfer() != 0) {
+    _this->_internal_set_leadertransfer(from._internal_leadertransfer());
+  }
+  if (from._internal_prevote() != 0) {
+    _this->_internal_set_prevote(from._internal_prevote());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestVoteArgs::CopyFrom(const RequestVoteArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RequestVoteArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestVoteArgs::IsInitialized() const {
+  return true;
+}
+
+void RequestVoteArgs::InternalSwap(RequestVoteArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestVoteArgs, _impl_.prevote_)
+      + sizeof(RequestVoteArgs::_impl_.prevote_)
+      - PROTOBUF_FIELD_OFFSET(RequestVoteArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[5]);
+}
+
+// ===================================================================
+
+class RequestVoteReply::_Internal {
+ public:
+};
+
+RequestVoteReply::RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RequestVoteReply)
+}
+RequestVoteReply::RequestVoteReply(const RequestVoteReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestVoteReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.votegranted_){}
+    , decltype(_impl_.votestate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.votestate_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.votestate_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RequestVoteReply)
+}
+
+inline void RequestVoteReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.votegranted_){false}
+    , decltype(_impl_.votestate_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RequestVoteReply::~RequestVoteReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.RequestVoteReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestVoteReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RequestVoteReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestVoteReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RequestVoteReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.votestate_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.votestate_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestVoteReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool VoteGranted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.votegranted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 VoteState = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.votestate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestVoteReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RequestVoteReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // bool VoteGranted = 2;
+  if (this->_internal_votegranted() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_votegranted(), target);
+  }
+
+  // int32 VoteState = 3;
+  if (this->_internal_votestate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_votestate(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RequestVoteReply)
+  return target;
+}
+
+size_t RequestVoteReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RequestVoteReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // bool VoteGranted = 2;
+  if (this->_internal_votegranted() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 VoteState = 3;
+  if (this->_internal_votestate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_votestate());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestVoteReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestVoteReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestVoteReply::GetClassData() const { return &_class_data_; }
+
+
+void RequestVoteReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestVoteReply*>(&to_msg);
+  auto& from = static_cast<const RequestVoteReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RequestVoteReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_votegranted() != 0) {
+    _this->_internal_set_votegranted(from._internal_votegranted());
+  }
+  if (from._internal_votestate() != 0) {
+    _this->_internal_set_votestate(from._internal_votestate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestVoteReply::CopyFrom(const RequestVoteReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RequestVoteReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestVoteReply::IsInitialized() const {
+  return true;
+}
+
+void RequestVoteReply::InternalSwap(RequestVoteReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestVoteReply, _impl_.votestate_)
+      + sizeof(RequestVoteReply::_impl_.votestate_)
+      - PROTOBUF_FIELD_OFFSET(RequestVoteReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[6]);
+}
+
+// ===================================================================
+
+class InstallSnapshotRequest::_Internal {
+ public:
+};
+
+InstallSnapshotRequest::InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.InstallSnapshotRequest)
+}
+InstallSnapshotRequest::InstallSnapshotRequest(const InstallSnapshotRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InstallSnapshotRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.lastsnapshotincludeindex_){}
+    , decltype(_impl_.lastsnapshotincludeterm_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.done_){}
+    , decltype(_impl_.crc_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.InstallSnapshotRequest)
+}
+
+inline void InstallSnapshotRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.term_){0}
+    , decltype(_impl_.lastsnapshotincludeindex_){0}
+    , decltype(_impl_.lastsnapshotincludeterm_){0}
+    , decltype(_impl_.offset_){int64_t{0}}
+    , decltype(_impl_.done_){false}
+    , decltype(_impl_.crc_){0u}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+InstallSnapshotRequest::~InstallSnapshotRequest() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.InstallSnapshotRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InstallSnapshotRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void InstallSnapshotRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InstallSnapshotRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.InstallSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.groupid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InstallSnapshotRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 LeaderId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Term = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastSnapShotIncludeIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.lastsnapshotincludeindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastSnapShotIncludeTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.lastsnapshotincludeterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Done = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.done_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 Crc = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.crc_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InstallSnapshotRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.InstallSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 LeaderId = 1;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_leaderid(), target);
+  }
+
+  // int32 Term = 2;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_term(), target);
+  }
+
+  // int32 LastSnapShotIncludeIndex = 3;
+  if (this->_internal_lastsnapshotincludeindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastsnapshotincludeindex(), target);
+  }
+
+  // int32 LastSnapShotIncludeTerm = 4;
+  if (this->_internal_lastsnapshotincludeterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastsnapshotincludeterm(), target);
+  }
+
+  // bytes Data = 5;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_data(), target);
+  }
+
+  // int64 Offset = 6;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_offset(), target);
+  }
+
+  // bool Done = 7;
+  if (this->_internal_done() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_done(), target);
+  }
+
+  // uint32 Crc = 8;
+  if (this->_internal_crc() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_crc(), target);
+  }
+
+  // int32 GroupId = 9;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_groupid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.InstallSnapshotRequest)
+  return target;
+}
+
+size_t InstallSnapshotRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.InstallSnapshotRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Data = 5;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // int32 LeaderId = 1;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 Term = 2;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 LastSnapShotIncludeIndex = 3;
+  if (this->_internal_lastsnapshotincludeindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastsnapshotincludeindex());
+  }
+
+  // int32 LastSnapShotIncludeTerm = 4;
+  if (this->_internal_lastsnapshotincludeterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastsnapshotincludeterm());
+  }
+
+  // int64 Offset = 6;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_offset());
+  }
+
+  // bool Done = 7;
+  if (this->_internal_done() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 Crc = 8;
+  if (this->_internal_crc() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_crc());
+  }
+
+  // int32 GroupId = 9;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InstallSnapshotRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InstallSnapshotRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InstallSnapshotRequest::GetClassData() const { return &_class_data_; }
+
+
+void InstallSnapshotRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InstallSnapshotRequest*>(&to_msg);
+  auto& from = static_cast<const InstallSnapshotRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.InstallSnapshotRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_lastsnapshotincludeindex() != 0) {
+    _this->_internal_set_lastsnapshotincludeindex(from._internal_lastsnapshotincludeindex());
+  }
+  if (from._internal_lastsnapshotincludeterm() != 0) {
+    _this->_internal_set_lastsnapshotincludeterm(from._internal_lastsnapshotincludeterm());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_done() != 0) {
+    _this->_internal_set_done(from._internal_done());
+  }
+  if (from._internal_crc() != 0) {
+    _this->_internal_set_crc(from._internal_crc());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InstallSnapshotRequest::CopyFrom(const InstallSnapshotRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.InstallSnapshotRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InstallSnapshotRequest::IsInitialized() const {
+  return true;
+}
+
+void InstallSnapshotRequest::InternalSwap(InstallSnapshotRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, _impl_.groupid_)
+      + sizeof(InstallSnapshotRequest::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, _impl_.leaderid_)>(
+          reinterpret_cast<char*>(&_impl_.leaderid_),
+          reinterpret_cast<char*>(&other->_impl_.leaderid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[7]);
+}
+
+// ===================================================================
+
+class InstallSnapshotResponse::_Internal {
+ public:
+};
+
+InstallSnapshotResponse::InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.InstallSnapshotResponse)
+}
+InstallSnapshotResponse::InstallSnapshotResponse(const InstallSnapshotResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InstallSnapshotResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nextoffset_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.installed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.nextoffset_, &from._impl_.nextoffset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.installed_) -
+    reinterpret_cast<char*>(&_impl_.nextoffset_)) + sizeof(_impl_.installed_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.InstallSnapshotResponse)
+}
+
+inline void InstallSnapshotResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nextoffset_){int64_t{0}}
+    , decltype(_impl_.term_){0}
+    , decltype(_impl_.installed_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InstallSnapshotResponse::~InstallSnapshotResponse() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.InstallSnapshotResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InstallSnapshotResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void InstallSnapshotResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InstallSnapshotResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.InstallSnapshotResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.nextoffset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.installed_) -
+      reinterpret_cast<char*>(&_impl_.nextoffset_)) + sizeof(_impl_.installed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InstallSnapshotResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 NextOffset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.nextoffset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Installed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.installed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InstallSnapshotResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.InstallSnapshotResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // int64 NextOffset = 2;
+  if (this->_internal_nextoffset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_nextoffset(), target);
+  }
+
+  // bool Installed = 3;
+  if (this->_internal_installed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_installed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.InstallSnapshotResponse)
+  return target;
+}
+
+size_t InstallSnapshotResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.InstallSnapshotResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 NextOffset = 2;
+  if (this->_internal_nextoffset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_nextoffset());
+  }
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // bool Installed = 3;
+  if (this->_internal_installed() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LogEntry::MergeFrom(const LogEntry& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.LogEntry)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InstallSnapshotResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InstallSnapshotResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InstallSnapshotResponse::GetClassData() const { return &_class_data_; }
+
+
+void InstallSnapshotResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InstallSnapshotResponse*>(&to_msg);
+  auto& from = static_cast<const InstallSnapshotResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.InstallSnapshotResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.command().size() > 0) {
-    _internal_set_command(from._internal_command());
+  if (from._internal_nextoffset() != 0) {
+    _this->_internal_set_nextoffset(from._internal_nextoffset());
   }
-  if (from.logterm() != 0) {
-    _internal_set_logterm(from._internal_logterm());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.logindex() != 0) {
-    _internal_set_logindex(from._internal_logindex());
+  if (from._internal_installed() != 0) {
+    _this->_internal_set_installed(from._internal_installed());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void LogEntry::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.LogEntry)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void LogEntry::CopyFrom(const LogEntry& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.LogEntry)
+void InstallSnapshotResponse::CopyFrom(const InstallSnapshotResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.InstallSnapshotResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LogEntry::IsInitialized() const {
+bool InstallSnapshotResponse::IsInitialized() const {
   return true;
 }
 
-void LogEntry::InternalSwap(LogEntry* other) {
+void InstallSnapshotResponse::InternalSwap(InstallSnapshotResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  command_.Swap(&other->command_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(LogEntry, logindex_)
-      + sizeof(LogEntry::logindex_)
-      - PROTOBUF_FIELD_OFFSET(LogEntry, logterm_)>(
-          reinterpret_cast<char*>(&logterm_),
-          reinterpret_cast<char*>(&other->logterm_));
+      PROTOBUF_FIELD_OFFSET(InstallSnapshotResponse, _impl_.installed_)
+      + sizeof(InstallSnapshotResponse::_impl_.installed_)
+      - PROTOBUF_FIELD_OFFSET(InstallSnapshotResponse, _impl_.nextoffset_)>(
+          reinterpret_cast<char*>(&_impl_.nextoffset_),
+          reinterpret_cast<char*>(&other->_impl_.nextoffset_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata LogEntry::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void AppendEntriesArgs::InitAsDefaultInstance() {
-}
-class AppendEntriesArgs::_Internal {
+class ReadIndexArgs::_Internal {
  public:
 };
 
-AppendEntriesArgs::AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  entries_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.AppendEntriesArgs)
-}
-AppendEntriesArgs::AppendEntriesArgs(const AppendEntriesArgs& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      entries_(from.entries_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&leadercommit_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(leadercommit_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.AppendEntriesArgs)
-}
-
-void AppendEntriesArgs::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppendEntriesArgs_raftRPC_2eproto.base);
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&leadercommit_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(leadercommit_));
+ReadIndexArgs::ReadIndexArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.ReadIndexArgs)
 }
+ReadIndexArgs::ReadIndexArgs(const ReadIndexArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadIndexArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-AppendEntriesArgs::~AppendEntriesArgs() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.AppendEntriesArgs)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.ReadIndexArgs)
+}
+
+inline void ReadIndexArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadIndexArgs::~ReadIndexArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.ReadIndexArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void AppendEntriesArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ReadIndexArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void AppendEntriesArgs::ArenaDtor(void* object) {
-  AppendEntriesArgs* _this = reinterpret_cast< AppendEntriesArgs* >(object);
-  (void)_this;
-}
-void AppendEntriesArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void AppendEntriesArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const AppendEntriesArgs& AppendEntriesArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppendEntriesArgs_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void ReadIndexArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void AppendEntriesArgs::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.AppendEntriesArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ReadIndexArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.ReadIndexArgs)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  entries_.Clear();
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&leadercommit_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(leadercommit_));
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AppendEntriesArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ReadIndexArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LeaderId = 2;
+      // int32 GroupId = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 PrevLogIndex = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          prevlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 PrevLogTerm = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          prevlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // repeated .raftRpcProctoc.LogEntry Entries = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // int32 LeaderCommit = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          leadercommit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* AppendEntriesArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.AppendEntriesArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ReadIndexArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.ReadIndexArgs)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
-  }
-
-  // int32 LeaderId = 2;
-  if (this->leaderid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
-  }
-
-  // int32 PrevLogIndex = 3;
-  if (this->prevlogindex() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_prevlogindex(), target);
-  }
-
-  // int32 PrevLogTerm = 4;
-  if (this->prevlogterm() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_prevlogterm(), target);
-  }
-
-  // repeated .raftRpcProctoc.LogEntry Entries = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_entries_size()); i < n; i++) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_entries(i), target, stream);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
-  // int32 LeaderCommit = 6;
-  if (this->leadercommit() != 0) {
+  // int32 GroupId = 2;
+  if (this->_internal_groupid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_leadercommit(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_groupid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.AppendEntriesArgs)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.ReadIndexArgs)
   return target;
 }
 
-size_t AppendEntriesArgs::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.AppendEntriesArgs)
+size_t ReadIndexArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.ReadIndexArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .raftRpcProctoc.LogEntry Entries = 5;
-  total_size += 1UL * this->_internal_entries_size();
-  for (const auto& msg : this->entries_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
   // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
-  }
-
-  // int32 LeaderId = 2;
-  if (this->leaderid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_leaderid());
-  }
-
-  // int32 PrevLogIndex = 3;
-  if (this->prevlogindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_prevlogindex());
-  }
-
-  // int32 PrevLogTerm = 4;
-  if (this->prevlogterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_prevlogterm());
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
-  // int32 LeaderCommit = 6;
-  if (this->leadercommit() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_leadercommit());
+  // int32 GroupId = 2;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void AppendEntriesArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.AppendEntriesArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const AppendEntriesArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppendEntriesArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.AppendEntriesArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.AppendEntriesArgs)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadIndexArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadIndexArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadIndexArgs::GetClassData() const { return &_class_data_; }
 
-void AppendEntriesArgs::MergeFrom(const AppendEntriesArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.AppendEntriesArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ReadIndexArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadIndexArgs*>(&to_msg);
+  auto& from = static_cast<const ReadIndexArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.ReadIndexArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  entries_.MergeFrom(from.entries_);
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-  if (from.leaderid() != 0) {
-    _internal_set_leaderid(from._internal_leaderid());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.prevlogindex() != 0) {
-    _internal_set_prevlogindex(from._internal_prevlogindex());
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
   }
-  if (from.prevlogterm() != 0) {
-    _internal_set_prevlogterm(from._internal_prevlogterm());
-  }
-  if (from.leadercommit() != 0) {
-    _internal_set_leadercommit(from._internal_leadercommit());
-  }
-}
-
-void AppendEntriesArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.AppendEntriesArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AppendEntriesArgs::CopyFrom(const AppendEntriesArgs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.AppendEntriesArgs)
+void ReadIndexArgs::CopyFrom(const ReadIndexArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.ReadIndexArgs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AppendEntriesArgs::IsInitialized() const {
+bool ReadIndexArgs::IsInitialized() const {
   return true;
 }
 
-void AppendEntriesArgs::InternalSwap(AppendEntriesArgs* other) {
+void ReadIndexArgs::InternalSwap(ReadIndexArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  entries_.InternalSwap(&other->entries_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, leadercommit_)
-      + sizeof(AppendEntriesArgs::leadercommit_)
-      - PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(ReadIndexArgs, _impl_.groupid_)
+      + sizeof(ReadIndexArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(ReadIndexArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesArgs::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ReadIndexArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void AppendEntriesReply::InitAsDefaultInstance() {
-}
-class AppendEntriesReply::_Internal {
+class ReadIndexReply::_Internal {
  public:
 };
 
-AppendEntriesReply::AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.AppendEntriesReply)
+ReadIndexReply::ReadIndexReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.ReadIndexReply)
 }
-AppendEntriesReply::AppendEntriesReply(const AppendEntriesReply& from)
+ReadIndexReply::ReadIndexReply(const ReadIndexReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&appstate_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(appstate_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.AppendEntriesReply)
-}
+  ReadIndexReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.readindex_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-void AppendEntriesReply::SharedCtor() {
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&appstate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(appstate_));
-}
-
-AppendEntriesReply::~AppendEntriesReply() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.AppendEntriesReply)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.readindex_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.readindex_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.ReadIndexReply)
+}
+
+inline void ReadIndexReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.readindex_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadIndexReply::~ReadIndexReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.ReadIndexReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void AppendEntriesReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ReadIndexReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void AppendEntriesReply::ArenaDtor(void* object) {
-  AppendEntriesReply* _this = reinterpret_cast< AppendEntriesReply* >(object);
-  (void)_this;
-}
-void AppendEntriesReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void AppendEntriesReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const AppendEntriesReply& AppendEntriesReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppendEntriesReply_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void ReadIndexReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void AppendEntriesReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.AppendEntriesReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ReadIndexReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.ReadIndexReply)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&appstate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(appstate_));
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.readindex_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.readindex_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AppendEntriesReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ReadIndexReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool Success = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 UpdateNextIndex = 3;
+      // int32 ReadIndex = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          updatenextindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.readindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 AppState = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          appstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* AppendEntriesReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.AppendEntriesReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ReadIndexReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.ReadIndexReply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
   // bool Success = 2;
-  if (this->success() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
-  }
-
-  // int32 UpdateNextIndex = 3;
-  if (this->updatenextindex() != 0) {
+  if (this->_internal_success() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_updatenextindex(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
   }
 
-  // int32 AppState = 4;
-  if (this->appstate() != 0) {
+  // int32 ReadIndex = 3;
+  if (this->_internal_readindex() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_appstate(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_readindex(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.AppendEntriesReply)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.ReadIndexReply)
   return target;
 }
 
-size_t AppendEntriesReply::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.AppendEntriesReply)
+size_t ReadIndexReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.ReadIndexReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
   // bool Success = 2;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  // int32 UpdateNextIndex = 3;
-  if (this->updatenextindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_updatenextindex());
-  }
-
-  // int32 AppState = 4;
-  if (this->appstate() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_appstate());
+  // int32 ReadIndex = 3;
+  if (this->_internal_readindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_readindex());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void AppendEntriesReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.AppendEntriesReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const AppendEntriesReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppendEntriesReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.AppendEntriesReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.AppendEntriesReply)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadIndexReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadIndexReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadIndexReply::GetClassData() const { return &_class_data_; }
 
-void AppendEntriesReply::MergeFrom(const AppendEntriesReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.AppendEntriesReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ReadIndexReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadIndexReply*>(&to_msg);
+  auto& from = static_cast<const ReadIndexReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.ReadIndexReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.success() != 0) {
-    _internal_set_success(from._internal_success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-  if (from.updatenextindex() != 0) {
-    _internal_set_updatenextindex(from._internal_updatenextindex());
+  if (from._internal_readindex() != 0) {
+    _this->_internal_set_readindex(from._internal_readindex());
   }
-  if (from.appstate() != 0) {
-    _internal_set_appstate(from._internal_appstate());
-  }
-}
-
-void AppendEntriesReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.AppendEntriesReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AppendEntriesReply::CopyFrom(const AppendEntriesReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.AppendEntriesReply)
+void ReadIndexReply::CopyFrom(const ReadIndexReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.ReadIndexReply)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AppendEntriesReply::IsInitialized() const {
+bool ReadIndexReply::IsInitialized() const {
   return true;
 }
 
-void AppendEntriesReply::InternalSwap(AppendEntriesReply* other) {
+void ReadIndexReply::InternalSwap(ReadIndexReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AppendEntriesReply, appstate_)
-      + sizeof(AppendEntriesReply::appstate_)
-      - PROTOBUF_FIELD_OFFSET(AppendEntriesReply, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(ReadIndexReply, _impl_.readindex_)
+      + sizeof(ReadIndexReply::_impl_.readindex_)
+      - PROTOBUF_FIELD_OFFSET(ReadIndexReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesReply::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ReadIndexReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void RequestVoteArgs::InitAsDefaultInstance() {
-}
-class RequestVoteArgs::_Internal {
+class TimeoutNowArgs::_Internal {
  public:
 };
 
-RequestVoteArgs::RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RequestVoteArgs)
+TimeoutNowArgs::TimeoutNowArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.TimeoutNowArgs)
 }
-RequestVoteArgs::RequestVoteArgs(const RequestVoteArgs& from)
+TimeoutNowArgs::TimeoutNowArgs(const TimeoutNowArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lastlogterm_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(lastlogterm_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RequestVoteArgs)
-}
-
-void RequestVoteArgs::SharedCtor() {
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastlogterm_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(lastlogterm_));
-}
+  TimeoutNowArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-RequestVoteArgs::~RequestVoteArgs() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.RequestVoteArgs)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.TimeoutNowArgs)
+}
+
+inline void TimeoutNowArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TimeoutNowArgs::~TimeoutNowArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.TimeoutNowArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RequestVoteArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void TimeoutNowArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RequestVoteArgs::ArenaDtor(void* object) {
-  RequestVoteArgs* _this = reinterpret_cast< RequestVoteArgs* >(object);
-  (void)_this;
-}
-void RequestVoteArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void RequestVoteArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void TimeoutNowArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const RequestVoteArgs& RequestVoteArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RequestVoteArgs_raftRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void RequestVoteArgs::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RequestVoteArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void TimeoutNowArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.TimeoutNowArgs)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastlogterm_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(lastlogterm_));
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RequestVoteArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TimeoutNowArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 CandidateId = 2;
+      // int32 LeaderId = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          candidateid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LastLogIndex = 3;
+      // int32 GroupId = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          lastlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LastLogTerm = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          lastlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RequestVoteArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RequestVoteArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* TimeoutNowArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.TimeoutNowArgs)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
-  }
-
-  // int32 CandidateId = 2;
-  if (this->candidateid() != 0) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_candidateid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
-  // int32 LastLogIndex = 3;
-  if (this->lastlogindex() != 0) {
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastlogindex(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
   }
 
-  // int32 LastLogTerm = 4;
-  if (this->lastlogterm() != 0) {
+  // int32 GroupId = 3;
+  if (this->_internal_groupid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastlogterm(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_groupid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RequestVoteArgs)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.TimeoutNowArgs)
   return target;
 }
 
-size_t RequestVoteArgs::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RequestVoteArgs)
+size_t TimeoutNowArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.TimeoutNowArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
-  }
-
-  // int32 CandidateId = 2;
-  if (this->candidateid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_candidateid());
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
-  // int32 LastLogIndex = 3;
-  if (this->lastlogindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastlogindex());
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
   }
 
-  // int32 LastLogTerm = 4;
-  if (this->lastlogterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastlogterm());
+  // int32 GroupId = 3;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RequestVoteArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.RequestVoteArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RequestVoteArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RequestVoteArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.RequestVoteArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.RequestVoteArgs)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TimeoutNowArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TimeoutNowArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TimeoutNowArgs::GetClassData() const { return &_class_data_; }
 
-void RequestVoteArgs::MergeFrom(const RequestVoteArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RequestVoteArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void TimeoutNowArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TimeoutNowArgs*>(&to_msg);
+  auto& from = static_cast<const TimeoutNowArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.TimeoutNowArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.candidateid() != 0) {
-    _internal_set_candidateid(from._internal_candidateid());
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
   }
-  if (from.lastlogindex() != 0) {
-    _internal_set_lastlogindex(from._internal_lastlogindex());
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
   }
-  if (from.lastlogterm() != 0) {
-    _internal_set_lastlogterm(from._internal_lastlogterm());
-  }
-}
-
-void RequestVoteArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.RequestVoteArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RequestVoteArgs::CopyFrom(const RequestVoteArgs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RequestVoteArgs)
+void TimeoutNowArgs::CopyFrom(const TimeoutNowArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.TimeoutNowArgs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RequestVoteArgs::IsInitialized() const {
+bool TimeoutNowArgs::IsInitialized() const {
   return true;
 }
 
-void RequestVoteArgs::InternalSwap(RequestVoteArgs* other) {
+void TimeoutNowArgs::InternalSwap(TimeoutNowArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RequestVoteArgs, lastlogterm_)
-      + sizeof(RequestVoteArgs::lastlogterm_)
-      - PROTOBUF_FIELD_OFFSET(RequestVoteArgs, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(TimeoutNowArgs, _impl_.groupid_)
+      + sizeof(TimeoutNowArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(TimeoutNowArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteArgs::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata TimeoutNowArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[11]);
 }
 
-
 // ===================================================================
 
-void RequestVoteReply::InitAsDefaultInstance() {
-}
-class RequestVoteReply::_Internal {
+class TimeoutNowReply::_Internal {
  public:
 };
 
-RequestVoteReply::RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RequestVoteReply)
+TimeoutNowReply::TimeoutNowReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.TimeoutNowReply)
 }
-RequestVoteReply::RequestVoteReply(const RequestVoteReply& from)
+TimeoutNowReply::TimeoutNowReply(const TimeoutNowReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&votestate_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(votestate_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RequestVoteReply)
-}
-
-void RequestVoteReply::SharedCtor() {
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&votestate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(votestate_));
-}
+  TimeoutNowReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-RequestVoteReply::~RequestVoteReply() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.RequestVoteReply)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.success_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.TimeoutNowReply)
+}
+
+inline void TimeoutNowReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TimeoutNowReply::~TimeoutNowReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.TimeoutNowReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RequestVoteReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void TimeoutNowReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RequestVoteReply::ArenaDtor(void* object) {
-  RequestVoteReply* _this = reinterpret_cast< RequestVoteReply* >(object);
-  (void)_this;
-}
-void RequestVoteReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TimeoutNowReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-void RequestVoteReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RequestVoteReply& RequestVoteReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RequestVoteReply_raftRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void RequestVoteReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RequestVoteReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void TimeoutNowReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.TimeoutNowReply)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&votestate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(votestate_));
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.success_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.success_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RequestVoteReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TimeoutNowReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bool VoteGranted = 2;
+      // bool Success = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          votegranted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 VoteState = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          votestate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RequestVoteReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RequestVoteReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* TimeoutNowReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.TimeoutNowReply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
-  // bool VoteGranted = 2;
-  if (this->votegranted() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_votegranted(), target);
-  }
-
-  // int32 VoteState = 3;
-  if (this->votestate() != 0) {
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_votestate(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RequestVoteReply)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.TimeoutNowReply)
   return target;
 }
 
-size_t RequestVoteReply::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RequestVoteReply)
+size_t TimeoutNowReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.TimeoutNowReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
-  // bool VoteGranted = 2;
-  if (this->votegranted() != 0) {
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  // int32 VoteState = 3;
-  if (this->votestate() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_votestate());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RequestVoteReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.RequestVoteReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RequestVoteReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RequestVoteReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.RequestVoteReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.RequestVoteReply)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TimeoutNowReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TimeoutNowReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TimeoutNowReply::GetClassData() const { return &_class_data_; }
 
-void RequestVoteReply::MergeFrom(const RequestVoteReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RequestVoteReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void TimeoutNowReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TimeoutNowReply*>(&to_msg);
+  auto& from = static_cast<const TimeoutNowReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.TimeoutNowReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-  if (from.votegranted() != 0) {
-    _internal_set_votegranted(from._internal_votegranted());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.votestate() != 0) {
-    _internal_set_votestate(from._internal_votestate());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RequestVoteReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.RequestVoteReply)
+void TimeoutNowReply::CopyFrom(const TimeoutNowReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.TimeoutNowReply)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void RequestVoteReply::CopyFrom(const RequestVoteReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RequestVoteReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool RequestVoteReply::IsInitialized() const {
+bool TimeoutNowReply::IsInitialized() const {
   return true;
 }
 
-void RequestVoteReply::InternalSwap(RequestVoteReply* other) {
+void TimeoutNowReply::InternalSwap(TimeoutNowReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RequestVoteReply, votestate_)
-      + sizeof(RequestVoteReply::votestate_)
-      - PROTOBUF_FIELD_OFFSET(RequestVoteReply, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(TimeoutNowReply, _impl_.success_)
+      + sizeof(TimeoutNowReply::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(TimeoutNowReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteReply::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata TimeoutNowReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[12]);
 }
 
-
 // ===================================================================
 
-void InstallSnapshotRequest::InitAsDefaultInstance() {
-}
-class InstallSnapshotRequest::_Internal {
+class RangeAdminArgs::_Internal {
  public:
 };
 
-InstallSnapshotRequest::InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.InstallSnapshotRequest)
+RangeAdminArgs::RangeAdminArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RangeAdminArgs)
 }
-InstallSnapshotRequest::InstallSnapshotRequest(const InstallSnapshotRequest& from)
+RangeAdminArgs::RangeAdminArgs(const RangeAdminArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RangeAdminArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.groupid_){}
+    , decltype(_impl_.from_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_op().empty()) {
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_start().empty()) {
+    _this->_impl_.start_.Set(from._internal_start(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_end().empty()) {
+    _this->_impl_.end_.Set(from._internal_end(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_data().empty()) {
-    data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_data(),
-      GetArena());
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.groupid_, &from._impl_.groupid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.id_) -
+    reinterpret_cast<char*>(&_impl_.groupid_)) + sizeof(_impl_.id_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RangeAdminArgs)
+}
+
+inline void RangeAdminArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.groupid_){0}
+    , decltype(_impl_.from_){0}
+    , decltype(_impl_.id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RangeAdminArgs::~RangeAdminArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.RangeAdminArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  ::memcpy(&leaderid_, &from.leaderid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lastsnapshotincludeterm_) -
-    reinterpret_cast<char*>(&leaderid_)) + sizeof(lastsnapshotincludeterm_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.InstallSnapshotRequest)
-}
-
-void InstallSnapshotRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_InstallSnapshotRequest_raftRPC_2eproto.base);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&leaderid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastsnapshotincludeterm_) -
-      reinterpret_cast<char*>(&leaderid_)) + sizeof(lastsnapshotincludeterm_));
-}
-
-InstallSnapshotRequest::~InstallSnapshotRequest() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.InstallSnapshotRequest)
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void InstallSnapshotRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void RangeAdminArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.op_.Destroy();
+  _impl_.start_.Destroy();
+  _impl_.end_.Destroy();
+  _impl_.data_.Destroy();
 }
 
-void InstallSnapshotRequest::ArenaDtor(void* object) {
-  InstallSnapshotRequest* _this = reinterpret_cast< InstallSnapshotRequest* >(object);
-  (void)_this;
-}
-void InstallSnapshotRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void RangeAdminArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-void InstallSnapshotRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const InstallSnapshotRequest& InstallSnapshotRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InstallSnapshotRequest_raftRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void InstallSnapshotRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.InstallSnapshotRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void RangeAdminArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RangeAdminArgs)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::memset(&leaderid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastsnapshotincludeterm_) -
-      reinterpret_cast<char*>(&leaderid_)) + sizeof(lastsnapshotincludeterm_));
+  _impl_.op_.ClearToEmpty();
+  _impl_.start_.ClearToEmpty();
+  _impl_.end_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.groupid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.id_) -
+      reinterpret_cast<char*>(&_impl_.groupid_)) + sizeof(_impl_.id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InstallSnapshotRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RangeAdminArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 LeaderId = 1;
+      // int32 GroupId = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 Term = 2;
+      // bytes Op = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_op();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LastSnapShotIncludeIndex = 3;
+      // int32 From = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          lastsnapshotincludeindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LastSnapShotIncludeTerm = 4;
+      // int32 Id = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          lastsnapshotincludeterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bytes Data = 5;
+      // bytes Start = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_start();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes End = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_end();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Data = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
           auto str = _internal_mutable_data();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* InstallSnapshotRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.InstallSnapshotRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* RangeAdminArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RangeAdminArgs)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 LeaderId = 1;
-  if (this->leaderid() != 0) {
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_leaderid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_groupid(), target);
   }
 
-  // int32 Term = 2;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_term(), target);
+  // bytes Op = 2;
+  if (!this->_internal_op().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_op(), target);
   }
 
-  // int32 LastSnapShotIncludeIndex = 3;
-  if (this->lastsnapshotincludeindex() != 0) {
+  // int32 From = 3;
+  if (this->_internal_from() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastsnapshotincludeindex(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_from(), target);
   }
 
-  // int32 LastSnapShotIncludeTerm = 4;
-  if (this->lastsnapshotincludeterm() != 0) {
+  // int32 Id = 4;
+  if (this->_internal_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastsnapshotincludeterm(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_id(), target);
   }
 
-  // bytes Data = 5;
-  if (this->data().size() > 0) {
+  // bytes Start = 5;
+  if (!this->_internal_start().empty()) {
     target = stream->WriteBytesMaybeAliased(
-        5, this->_internal_data(), target);
+        5, this->_internal_start(), target);
+  }
+
+  // bytes End = 6;
+  if (!this->_internal_end().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_end(), target);
+  }
+
+  // bytes Data = 7;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_data(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.InstallSnapshotRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RangeAdminArgs)
   return target;
 }
 
-size_t InstallSnapshotRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.InstallSnapshotRequest)
+size_t RangeAdminArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RangeAdminArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes Data = 5;
-  if (this->data().size() > 0) {
+  // bytes Op = 2;
+  if (!this->_internal_op().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_data());
+        this->_internal_op());
   }
 
-  // int32 LeaderId = 1;
-  if (this->leaderid() != 0) {
+  // bytes Start = 5;
+  if (!this->_internal_start().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_leaderid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_start());
   }
 
-  // int32 Term = 2;
-  if (this->term() != 0) {
+  // bytes End = 6;
+  if (!this->_internal_end().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_end());
   }
 
-  // int32 LastSnapShotIncludeIndex = 3;
-  if (this->lastsnapshotincludeindex() != 0) {
+  // bytes Data = 7;
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastsnapshotincludeindex());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
-  // int32 LastSnapShotIncludeTerm = 4;
-  if (this->lastsnapshotincludeterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastsnapshotincludeterm());
+  // int32 GroupId = 1;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 From = 3;
+  if (this->_internal_from() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_from());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void InstallSnapshotRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.InstallSnapshotRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const InstallSnapshotRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InstallSnapshotRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.InstallSnapshotRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.InstallSnapshotRequest)
-    MergeFrom(*source);
+  // int32 Id = 4;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void InstallSnapshotRequest::MergeFrom(const InstallSnapshotRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.InstallSnapshotRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RangeAdminArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RangeAdminArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RangeAdminArgs::GetClassData() const { return &_class_data_; }
+
+
+void RangeAdminArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RangeAdminArgs*>(&to_msg);
+  auto& from = static_cast<const RangeAdminArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RangeAdminArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.data().size() > 0) {
-    _internal_set_data(from._internal_data());
+  if (!from._internal_op().empty()) {
+    _this->_internal_set_op(from._internal_op());
   }
-  if (from.leaderid() != 0) {
-    _internal_set_leaderid(from._internal_leaderid());
+  if (!from._internal_start().empty()) {
+    _this->_internal_set_start(from._internal_start());
   }
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
+  if (!from._internal_end().empty()) {
+    _this->_internal_set_end(from._internal_end());
   }
-  if (from.lastsnapshotincludeindex() != 0) {
-    _internal_set_lastsnapshotincludeindex(from._internal_lastsnapshotincludeindex());
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
   }
-  if (from.lastsnapshotincludeterm() != 0) {
-    _internal_set_lastsnapshotincludeterm(from._internal_lastsnapshotincludeterm());
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
   }
+  if (from._internal_from() != 0) {
+    _this->_internal_set_from(from._internal_from());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InstallSnapshotRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.InstallSnapshotRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void InstallSnapshotRequest::CopyFrom(const InstallSnapshotRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.InstallSnapshotRequest)
+void RangeAdminArgs::CopyFrom(const RangeAdminArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RangeAdminArgs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InstallSnapshotRequest::IsInitialized() const {
+bool RangeAdminArgs::IsInitialized() const {
   return true;
 }
 
-void InstallSnapshotRequest::InternalSwap(InstallSnapshotRequest* other) {
+void RangeAdminArgs::InternalSwap(RangeAdminArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  data_.Swap(&other->data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.start_, lhs_arena,
+      &other->_impl_.start_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.end_, lhs_arena,
+      &other->_impl_.end_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, lastsnapshotincludeterm_)
-      + sizeof(InstallSnapshotRequest::lastsnapshotincludeterm_)
-      - PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, leaderid_)>(
-          reinterpret_cast<char*>(&leaderid_),
-          reinterpret_cast<char*>(&other->leaderid_));
+      PROTOBUF_FIELD_OFFSET(RangeAdminArgs, _impl_.id_)
+      + sizeof(RangeAdminArgs::_impl_.id_)
+      - PROTOBUF_FIELD_OFFSET(RangeAdminArgs, _impl_.groupid_)>(
+          reinterpret_cast<char*>(&_impl_.groupid_),
+          reinterpret_cast<char*>(&other->_impl_.groupid_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotRequest::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata RangeAdminArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[13]);
 }
 
-
 // ===================================================================
 
-void InstallSnapshotResponse::InitAsDefaultInstance() {
-}
-class InstallSnapshotResponse::_Internal {
+class RangeAdminReply::_Internal {
  public:
 };
 
-InstallSnapshotResponse::InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.InstallSnapshotResponse)
+RangeAdminReply::RangeAdminReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProctoc.RangeAdminReply)
 }
-InstallSnapshotResponse::InstallSnapshotResponse(const InstallSnapshotResponse& from)
+RangeAdminReply::RangeAdminReply(const RangeAdminReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  term_ = from.term_;
-  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.InstallSnapshotResponse)
-}
-
-void InstallSnapshotResponse::SharedCtor() {
-  term_ = 0;
-}
+  RangeAdminReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.leaderterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-InstallSnapshotResponse::~InstallSnapshotResponse() {
-  // @@protoc_insertion_point(destructor:raftRpcProctoc.InstallSnapshotResponse)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_err().empty()) {
+    _this->_impl_.err_.Set(from._internal_err(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leaderterm_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.leaderterm_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProctoc.RangeAdminReply)
+}
+
+inline void RangeAdminReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.err_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.leaderterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.err_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.err_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RangeAdminReply::~RangeAdminReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProctoc.RangeAdminReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void InstallSnapshotResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void RangeAdminReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.err_.Destroy();
 }
 
-void InstallSnapshotResponse::ArenaDtor(void* object) {
-  InstallSnapshotResponse* _this = reinterpret_cast< InstallSnapshotResponse* >(object);
-  (void)_this;
-}
-void InstallSnapshotResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void InstallSnapshotResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void RangeAdminReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const InstallSnapshotResponse& InstallSnapshotResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InstallSnapshotResponse_raftRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void InstallSnapshotResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.InstallSnapshotResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void RangeAdminReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProctoc.RangeAdminReply)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  term_ = 0;
+  _impl_.err_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leaderterm_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.leaderterm_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InstallSnapshotResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RangeAdminReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 Term = 1;
+      // bytes Err = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_err();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.leaderterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* InstallSnapshotResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.InstallSnapshotResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* RangeAdminReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProctoc.RangeAdminReply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_err(), target);
+  }
+
+  // int32 Id = 2;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // int32 LeaderId = 3;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_leaderid(), target);
+  }
+
+  // int32 LeaderTerm = 4;
+  if (this->_internal_leaderterm() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_leaderterm(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.InstallSnapshotResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProctoc.RangeAdminReply)
   return target;
 }
 
-size_t InstallSnapshotResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.InstallSnapshotResponse)
+size_t RangeAdminReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProctoc.RangeAdminReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
+  // bytes Err = 1;
+  if (!this->_internal_err().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_err());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 Id = 2;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+  }
+
+  // int32 LeaderId = 3;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void InstallSnapshotResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProctoc.InstallSnapshotResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const InstallSnapshotResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InstallSnapshotResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProctoc.InstallSnapshotResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProctoc.InstallSnapshotResponse)
-    MergeFrom(*source);
+  // int32 LeaderTerm = 4;
+  if (this->_internal_leaderterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderterm());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void InstallSnapshotResponse::MergeFrom(const InstallSnapshotResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.InstallSnapshotResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RangeAdminReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RangeAdminReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RangeAdminReply::GetClassData() const { return &_class_data_; }
+
+
+void RangeAdminReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RangeAdminReply*>(&to_msg);
+  auto& from = static_cast<const RangeAdminReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProctoc.RangeAdminReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
+  if (!from._internal_err().empty()) {
+    _this->_internal_set_err(from._internal_err());
   }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_leaderterm() != 0) {
+    _this->_internal_set_leaderterm(from._internal_leaderterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InstallSnapshotResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProctoc.InstallSnapshotResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void InstallSnapshotResponse::CopyFrom(const InstallSnapshotResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.InstallSnapshotResponse)
+void RangeAdminReply::CopyFrom(const RangeAdminReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProctoc.RangeAdminReply)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InstallSnapshotResponse::IsInitialized() const {
+bool RangeAdminReply::IsInitialized() const {
   return true;
 }
 
-void InstallSnapshotResponse::InternalSwap(InstallSnapshotResponse* other) {
+void RangeAdminReply::InternalSwap(RangeAdminReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(term_, other->term_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.err_, lhs_arena,
+      &other->_impl_.err_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RangeAdminReply, _impl_.leaderterm_)
+      + sizeof(RangeAdminReply::_impl_.leaderterm_)
+      - PROTOBUF_FIELD_OFFSET(RangeAdminReply, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotResponse::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata RangeAdminReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[14]);
 }
 
-
 // ===================================================================
 
 raftRpc::~raftRpc() {}
@@ -2227,6 +4753,30 @@ void raftRpc::RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
   done->Run();
 }
 
+void raftRpc::ReadIndex(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftRpcProctoc::ReadIndexArgs*,
+                         ::raftRpcProctoc::ReadIndexReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method ReadIndex() not implemented.");
+  done->Run();
+}
+
+void raftRpc::TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftRpcProctoc::TimeoutNowArgs*,
+                         ::raftRpcProctoc::TimeoutNowReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method TimeoutNow() not implemented.");
+  done->Run();
+}
+
+void raftRpc::RangeAdmin(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftRpcProctoc::RangeAdminArgs*,
+                         ::raftRpcProctoc::RangeAdminReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method RangeAdmin() not implemented.");
+  done->Run();
+}
+
 void raftRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
                              ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                              const ::PROTOBUF_NAMESPACE_ID::Message* request,
@@ -2258,6 +4808,30 @@ void raftRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method
                  response),
              done);
       break;
+    case 3:
+      ReadIndex(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftRpcProctoc::ReadIndexArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftRpcProctoc::ReadIndexReply*>(
+                 response),
+             done);
+      break;
+    case 4:
+      TimeoutNow(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftRpcProctoc::TimeoutNowArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftRpcProctoc::TimeoutNowReply*>(
+                 response),
+             done);
+      break;
+    case 5:
+      RangeAdmin(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftRpcProctoc::RangeAdminArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftRpcProctoc::RangeAdminReply*>(
+                 response),
+             done);
+      break;
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       break;
@@ -2274,6 +4848,12 @@ const ::PROTOBUF_NAMESPACE_ID::Message& raftRpc::GetRequestPrototype(
       return ::raftRpcProctoc::InstallSnapshotRequest::default_instance();
     case 2:
       return ::raftRpcProctoc::RequestVoteArgs::default_instance();
+    case 3:
+      return ::raftRpcProctoc::ReadIndexArgs::default_instance();
+    case 4:
+      return ::raftRpcProctoc::TimeoutNowArgs::default_instance();
+    case 5:
+      return ::raftRpcProctoc::RangeAdminArgs::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
@@ -2291,6 +4871,12 @@ const ::PROTOBUF_NAMESPACE_ID::Message& raftRpc::GetResponsePrototype(
       return ::raftRpcProctoc::InstallSnapshotResponse::default_instance();
     case 2:
       return ::raftRpcProctoc::RequestVoteReply::default_instance();
+    case 3:
+      return ::raftRpcProctoc::ReadIndexReply::default_instance();
+    case 4:
+      return ::raftRpcProctoc::TimeoutNowReply::default_instance();
+    case 5:
+      return ::raftRpcProctoc::RangeAdminReply::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
@@ -2330,32 +4916,92 @@ void raftRpc_Stub::RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controlle
   channel_->CallMethod(descriptor()->method(2),
                        controller, request, response, done);
 }
+void raftRpc_Stub::ReadIndex(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftRpcProctoc::ReadIndexArgs* request,
+                              ::raftRpcProctoc::ReadIndexReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(3),
+                       controller, request, response, done);
+}
+void raftRpc_Stub::TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftRpcProctoc::TimeoutNowArgs* request,
+                              ::raftRpcProctoc::TimeoutNowReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(4),
+                       controller, request, response, done);
+}
+void raftRpc_Stub::RangeAdmin(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftRpcProctoc::RangeAdminArgs* request,
+                              ::raftRpcProctoc::RangeAdminReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(5),
+                       controller, request, response, done);
+}
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace raftRpcProctoc
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::LogEntry* Arena::CreateMaybeMessage< ::raftRpcProctoc::LogEntry >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::Member*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::Member >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::Member >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::Membership*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::Membership >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::Membership >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::LogEntry*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::LogEntry >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::LogEntry >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::AppendEntriesArgs* Arena::CreateMaybeMessage< ::raftRpcProctoc::AppendEntriesArgs >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::AppendEntriesArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::AppendEntriesArgs >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::AppendEntriesArgs >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::AppendEntriesReply* Arena::CreateMaybeMessage< ::raftRpcProctoc::AppendEntriesReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::AppendEntriesReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::AppendEntriesReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::AppendEntriesReply >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RequestVoteArgs* Arena::CreateMaybeMessage< ::raftRpcProctoc::RequestVoteArgs >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RequestVoteArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::RequestVoteArgs >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::RequestVoteArgs >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RequestVoteReply* Arena::CreateMaybeMessage< ::raftRpcProctoc::RequestVoteReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RequestVoteReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::RequestVoteReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::RequestVoteReply >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::InstallSnapshotRequest* Arena::CreateMaybeMessage< ::raftRpcProctoc::InstallSnapshotRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::InstallSnapshotRequest*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::InstallSnapshotRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::InstallSnapshotRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProctoc::InstallSnapshotResponse* Arena::CreateMaybeMessage< ::raftRpcProctoc::InstallSnapshotResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::InstallSnapshotResponse*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::InstallSnapshotResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProctoc::InstallSnapshotResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::ReadIndexArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::ReadIndexArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::ReadIndexArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::ReadIndexReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::ReadIndexReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::ReadIndexReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::TimeoutNowArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::TimeoutNowArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::TimeoutNowArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::TimeoutNowReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::TimeoutNowReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::TimeoutNowReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RangeAdminArgs*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::RangeAdminArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::RangeAdminArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProctoc::RangeAdminReply*
+Arena::CreateMaybeMessage< ::raftRpcProctoc::RangeAdminReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProctoc::RangeAdminReply >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
-#include <google/protobuf/port_undef.inc>
\ No newline at end of file
+#include <google/protobuf/port_undef.inc>
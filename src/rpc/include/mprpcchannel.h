@@ -6,29 +6,105 @@
 #include <google/protobuf/service.h>
 #include <algorithm>
 #include <algorithm>  // 包含 std::generate_n() 和 std::generate() 函数的头文件
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <random>  // 包含 std::uniform_int_distribution 类型的头文件
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include "config.h"
 using namespace std;
 
+namespace monsoon {
+class IOManager;
+class Timer;
+}
+
 // 真正负责发送和接受的前后处理工作
 //  如消息的组织方式，向哪个节点发送等等
+// 异步模式下一条连接上可以同时有多个rpc，请求带上request_id，由读协程按request_id把响应分发给对应的调用
 class MprpcChannel : public google::protobuf::RpcChannel {
  public:
   // 所有通过stub代理对象调用的rpc方法，都走到这里了，统一做rpc方法调用的数据数据序列化和网络发送 那一步
+  // done不为空时异步模式下立即返回，响应到达或者失败后在rpc客户端的IO线程里调用done->Run()
   void CallMethod(const google::protobuf::MethodDescriptor *method, google::protobuf::RpcController *controller,
                   const google::protobuf::Message *request, google::protobuf::Message *response,
                   google::protobuf::Closure *done) override;
-  MprpcChannel(string ip, short port, bool connectNow);
+  // connections是异步模式的连接数，需要请求按发送顺序到达服务端时用1
+  MprpcChannel(string ip, short port, bool connectNow, bool async = false,
+               int connections = RPC_CONNECTIONS_PER_PEER);
+  ~MprpcChannel() override;
+
+  // 所有异步channel共享的读协程调度器，异步rpc的回调也在这里执行
+  static monsoon::IOManager *ClientIOManager();
 
  private:
+  struct PendingCall {
+    const google::protobuf::MethodDescriptor *method;
+    google::protobuf::RpcController *controller;
+    google::protobuf::Message *response;
+    google::protobuf::Closure *done;
+    std::shared_ptr<monsoon::Timer> timer;  // 设置了超时才有
+  };
+  // 一条多路复用的连接，断开后整体丢弃，下一次调用重新建立
+  struct Connection {
+    explicit Connection(int fd) : fd(fd) {}
+    ~Connection();
+    const int fd;
+    std::mutex writeMtx;  // 保证一个请求帧完整地写进socket
+    std::mutex mtx;       // 保护closed、pending、methodIds和peerCompressions
+    bool closed = false;
+    std::unordered_map<uint64_t, PendingCall> pending;
+    // 服务端分配的方法id，只在这条连接上有效
+    std::unordered_map<const google::protobuf::MethodDescriptor *, uint32_t> methodIds;
+    uint32_t peerCompressions = 0;  // 服务端能解压的压缩方式，收到第一个响应之前不压缩
+  };
+
   int m_clientFd;
   const std::string m_ip;  //保存ip和端口，如果断了可以尝试重连
   const uint16_t m_port;
+  const bool m_async;
+  std::atomic<uint64_t> m_nextRequestId;
+  std::mutex m_connMtx;  // 保护下面的连接池和重连退避状态
+  std::vector<std::shared_ptr<Connection>> m_conns;  // 异步模式的连接池，调用轮流使用
+  std::atomic<size_t> m_nextConn;
+  bool m_connecting;  // 同一时间只有一个调用在建立连接
+  int m_backoffMs;    // 当前的重连退避时间，0表示上次连接成功
+  std::chrono::steady_clock::time_point m_nextConnectTime;  // 退避结束之前不再尝试连接
+  // 同步模式下当前连接上服务端分配的方法id
+  std::unordered_map<const google::protobuf::MethodDescriptor *, uint32_t> m_methodIds;
+  uint32_t m_peerCompressions;  // 同步模式下当前连接的服务端能解压的压缩方式
+
+  // methodId为0时按service_name和method_name调用，timeoutMs <= 0表示不限
+  // compressType是对端支持的压缩方式，请求足够大时才压缩
+  bool encodeRequest(const google::protobuf::MethodDescriptor *method, const google::protobuf::Message *request,
+                     uint64_t requestId, uint32_t methodId, int timeoutMs, uint32_t compressType,
+                     std::string *send_rpc_str, std::string *errMsg);
+  // 一条连接同一时间只有一个rpc，发送后在调用线程上阻塞读响应
+  void callSync(const google::protobuf::MethodDescriptor *method, uint64_t requestId,
+                google::protobuf::RpcController *controller, const google::protobuf::Message *request,
+                google::protobuf::Message *response);
+  void callAsync(const google::protobuf::MethodDescriptor *method, uint64_t requestId,
+                 google::protobuf::RpcController *controller, const google::protobuf::Message *request,
+                 google::protobuf::Message *response, google::protobuf::Closure *done);
+  // 从连接池取一条可用的连接，必要时重连
+  std::shared_ptr<Connection> getConnection(std::string *errMsg);
+  static bool isOpen(const std::shared_ptr<Connection> &conn);
+  // 遵守退避的建立连接，返回fd，失败返回-1
+  int connectWithBackoff(std::string *errMsg);
+  static void readLoop(std::shared_ptr<Connection> conn);
+  // 标记连接断开，所有未完成的调用以reason失败
+  static void closeConnection(const std::shared_ptr<Connection> &conn, const std::string &reason);
+  // 超时的调用从pending中摘掉并以失败结束
+  static void timeoutCall(const std::weak_ptr<Connection> &weakConn, uint64_t requestId);
+  // controller是MprpcController时返回它设置的超时
+  static int CallTimeout(google::protobuf::RpcController *controller);
+  static int connectTo(const char *ip, uint16_t port, string *errMsg);
   /// @brief 连接ip和端口,并设置m_clientFd
   /// @param ip ip地址，本机字节序
   /// @param port 端口，本机字节序
@@ -10,6 +10,10 @@ class MprpcController : public google::protobuf::RpcController {
   std::string ErrorText() const;
   void SetFailed(const std::string& reason);
 
+  // 调用方设置的超时，ms，<= 0表示不限；随请求发给服务端，服务端发现调用方已经放弃时不再处理
+  void SetTimeout(int timeoutMs);
+  int Timeout() const;
+
   // 目前未实现具体的功能
   void StartCancel();
   bool IsCanceled() const;
@@ -18,4 +22,5 @@ class MprpcController : public google::protobuf::RpcController {
  private:
   bool m_failed;          // RPC方法执行过程中的状态
   std::string m_errText;  // RPC方法执行过程中的错误信息
+  int m_timeoutMs;        // 超时时间，<= 0表示不限
 };
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// rpc消息体（请求参数或响应）的压缩方式，写在RpcHeader.compress_type里
+// 编译时找到了对应的库才支持，见CMakeLists.txt里的RPC_WITH_LZ4 / RPC_WITH_ZSTD
+enum RpcCompressType : uint32_t {
+  RPC_COMPRESS_NONE = 0,
+  RPC_COMPRESS_LZ4 = 1,
+  RPC_COMPRESS_ZSTD = 2,
+};
+
+// 本进程能解压的压缩方式，第i位为1表示支持类型i，随消息发给对端
+uint32_t RpcSupportedCompressions();
+
+// 从对端能解压的集合中选一个本地也支持的，带宽比cpu紧张，优先zstd；都不支持时返回RPC_COMPRESS_NONE
+uint32_t RpcPickCompression(uint32_t peerAccepts);
+
+// 压缩失败或者压缩后没有变小都返回false，调用方直接发原文
+bool RpcCompress(uint32_t type, const char *data, size_t len, std::string *out);
+
+// rawSize是压缩前的长度，解压出来的长度不一致也算失败
+bool RpcDecompress(uint32_t type, const char *data, size_t len, size_t rawSize, std::string *out);
@@ -4,10 +4,15 @@
 #include <muduo/net/InetAddress.h>
 #include <muduo/net/TcpConnection.h>
 #include <muduo/net/TcpServer.h>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "google/protobuf/service.h"
+#include "iomanager.hpp"
 
 // 框架提供的专门发布rpc服务的网络对象类
 // todo:现在rpc客户端变成了 长连接，因此rpc服务器这边最好提供一个定时器，用以断开很久没有请求的连接。
@@ -15,7 +20,10 @@
 class RpcProvider {
  public:
   // 这里是框架提供给外部使用的，可以发布rpc方法的函数接口
-  void NotifyService(google::protobuf::Service *service);
+  // ordered为true时，同一条连接上这个服务的请求按到达顺序逐个执行（如raft流水线发送的AE）；
+  // 否则请求之间互不等待，适合会长时间阻塞的方法；unorderedMethods里的方法即使ordered为true也不排队
+  void NotifyService(google::protobuf::Service *service, bool ordered = false,
+                     const std::vector<std::string> &unorderedMethods = {});
 
   // 启动rpc服务节点，开始提供rpc远程网络调用服务
   void Run(int nodeIndex, short port);
@@ -24,21 +32,47 @@ class RpcProvider {
   // 组合EventLoop
   muduo::net::EventLoop m_eventLoop;
   std::shared_ptr<muduo::net::TcpServer> m_muduo_server;
+  // muduo的IO线程只负责收发和解析，业务方法都在这里的协程线程上执行，慢请求不会卡住同一个IO线程上的其他连接
+  std::unique_ptr<monsoon::IOManager> m_workers;
 
   // service服务类型信息
   struct ServiceInfo {
     google::protobuf::Service *m_service;                                                     // 保存服务对象
     std::unordered_map<std::string, const google::protobuf::MethodDescriptor *> m_methodMap;  // 保存服务方法
+    uint32_t m_firstMethodId;                                                                 // 第一个方法的id
+  };
+  struct MethodInfo {
+    google::protobuf::Service *m_service;
+    const google::protobuf::MethodDescriptor *m_method;
+    bool m_ordered;
+  };
+  // 每条连接上ordered服务的待执行请求，作为TcpConnection的context，同一时刻最多一个worker在执行它
+  struct ConnectionQueue {
+    std::mutex m_mtx;
+    std::deque<std::function<void()>> m_tasks;
+    bool m_running = false;
   };
   // 存储注册成功的服务对象和其服务方法的所有信息
   std::unordered_map<std::string, ServiceInfo> m_serviceMap;
+  // 按NotifyService的顺序给所有方法编号，方法id为下标+1，0表示请求里没有带id
+  std::vector<MethodInfo> m_methodTable;
 
   // 新的socket连接回调
   void OnConnection(const muduo::net::TcpConnectionPtr &);
-  // 已建立连接用户的读写事件回调
+  // 已建立连接用户的读写事件回调，按帧拆出每个请求
   void OnMessage(const muduo::net::TcpConnectionPtr &, muduo::net::Buffer *, muduo::Timestamp);
+  // 连接上第一个字节是"GET "时按HTTP处理：/metrics返回Metrics::RenderPrometheus()，回答完关闭连接
+  void HandleHttp(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer);
+  // 处理一个完整的请求帧，data指向接收缓冲区，只在调用期间有效；receiveTime用来判断请求是否已经超时
+  void HandleRequest(const muduo::net::TcpConnectionPtr &conn, const char *data, size_t len,
+                     muduo::Timestamp receiveTime);
+  // 把task放进连接的队列，队列没有在执行时才调度一个worker去依次执行
+  void EnqueueOrdered(const std::shared_ptr<ConnectionQueue> &queue, std::function<void()> task);
+  void DrainOrdered(const std::shared_ptr<ConnectionQueue> &queue);
   // Closure的回调操作，用于序列化rpc的响应和网络发送
-  void SendRpcResponse(const muduo::net::TcpConnectionPtr &, google::protobuf::Message *);
+  // methodId不为0时告诉客户端这个方法的id，compressType是客户端能解压的压缩方式
+  void SendRpcResponse(const muduo::net::TcpConnectionPtr &, uint64_t requestId, uint32_t methodId,
+                       uint32_t compressType, google::protobuf::Message *);
 
  public:
   ~RpcProvider();
@@ -1,95 +1,344 @@
 #include "mprpcchannel.h"
 #include <arpa/inet.h>
+#include <fcntl.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <sys/socket.h>
+#include <sys/time.h>
 #include <unistd.h>
+#include <algorithm>
 #include <cerrno>
+#include <condition_variable>
+#include <cstring>
 #include <string>
+#include "metrics.h"
+#include "monsoon.h"
 #include "mprpccontroller.h"
+#include "rpccompress.h"
 #include "rpcheader.pb.h"
 #include "util.h"
 
 /*
-header_size + service_name method_name args_size + args
+请求：frame_len(4字节，网络字节序) + header_size + header(service_name method_name/method_id args_size request_id) + args
+响应：frame_len(4字节，网络字节序) + header_size + header(request_id method_id) + response
+第一次按名字调用一个方法时，服务端在响应里告知方法id，之后同一条连接上的调用只带id
+双方在header里告诉对方自己能解压的压缩方式，知道对端支持之后，大于RPC_COMPRESS_MIN_SIZE的args/response才压缩
 */
+
+namespace {
+// 持有期间关闭当前线程的hook：持锁写socket、建立连接时不能让出协程，否则同线程的其他协程再拿这把锁会卡死整个线程
+class HookDisabler {
+ public:
+  HookDisabler() : m_enabled(monsoon::is_hook_enable()) { monsoon::set_hook_enable(false); }
+  ~HookDisabler() { monsoon::set_hook_enable(m_enabled); }
+
+ private:
+  bool m_enabled;
+};
+
+// send可能只发出一部分，直到全部发完或者出错；非阻塞的socket写满了就等到可写
+// 对端不读（分区、进程卡住）时socket缓冲区一直是满的，最多等timeoutMs（<=0时按RAFT_RPC_TIMEOUT_MS），
+// 超时返回false、errno为ETIMEDOUT，调用方关闭连接，不能让持着写锁的线程一直卡在这里
+bool sendAll(int fd, const char* data, size_t len, int timeoutMs) {
+  static MetricCounter* sentBytes = Metrics::Instance().Counter("rpc_client_sent_bytes_total", "rpc客户端发出的字节数");
+  sentBytes->add(len);
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(timeoutMs > 0 ? timeoutMs : RAFT_RPC_TIMEOUT_MS);
+  while (len > 0) {
+    ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+      pollfd pfd{fd, POLLOUT, 0};
+      if (left.count() <= 0 || poll(&pfd, 1, static_cast<int>(left.count())) == 0) {
+        errno = ETIMEDOUT;
+        return false;
+      }
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+// 系统调用层面的非阻塞connect，用poll等待完成，完成后恢复成阻塞的socket
+int connectWithTimeout(int fd, const sockaddr* addr, socklen_t len, int timeoutMs) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+  int rt = connect(fd, addr, len);
+  if (rt == -1 && errno == EINPROGRESS) {
+    pollfd pfd{fd, POLLOUT, 0};
+    rt = poll(&pfd, 1, timeoutMs);
+    if (rt == 0) {
+      errno = ETIMEDOUT;
+      rt = -1;
+    } else if (rt > 0) {
+      int error = 0;
+      socklen_t errLen = sizeof(error);
+      getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &errLen);
+      errno = error;
+      rt = error == 0 ? 0 : -1;
+    }
+  }
+  fcntl(fd, F_SETFL, flags);
+  return rt;
+}
+
+// 超时通过SO_RCVTIMEO实现，协程里的hook会据此设置定时器
+void setRecvTimeout(int fd, int timeoutMs) {
+  timeval tv{timeoutMs / 1000, (timeoutMs % 1000) * 1000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  // 内核里0表示不限，hook里0会立即超时，不限要设成-1
+  auto ctx = monsoon::FdMgr::GetInstance()->get(fd);
+  if (timeoutMs <= 0 && ctx) {
+    ctx->setTimeout(SO_RCVTIMEO, static_cast<uint64_t>(-1));
+  }
+}
+
+// 一直读到len个字节，对方关闭连接或者出错返回false
+bool recvAll(int fd, char* data, size_t len) {
+  static MetricCounter* recvBytes =
+      Metrics::Instance().Counter("rpc_client_received_bytes_total", "rpc客户端收到的字节数");
+  recvBytes->add(len);
+  while (len > 0) {
+    ssize_t n = recv(fd, data, len, 0);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+// 读一个完整的帧
+bool recvFrame(int fd, std::string* frame, std::string* errMsg) {
+  uint32_t frame_size = 0;
+  if (!recvAll(fd, reinterpret_cast<char*>(&frame_size), RPC_FRAME_HEADER_SIZE)) {
+    *errMsg = "recv error! errno:" + std::to_string(errno);
+    return false;
+  }
+  frame_size = ntohl(frame_size);
+  if (frame_size > RPC_MAX_FRAME_SIZE) {
+    *errMsg = "recv error! frame size " + std::to_string(frame_size) + " too large";
+    return false;
+  }
+  frame->assign(frame_size, '\0');
+  if (!recvAll(fd, &(*frame)[0], frame_size)) {
+    *errMsg = "recv error! errno:" + std::to_string(errno);
+    return false;
+  }
+  return true;
+}
+
+// 拆开响应帧，body指向其中response的部分（可能是压缩过的）
+bool decodeResponseFrame(const std::string& frame, RPC::RpcHeader* rpcHeader, const char** body, size_t* bodySize) {
+  google::protobuf::io::CodedInputStream coded_input(reinterpret_cast<const uint8_t*>(frame.data()),
+                                                     static_cast<int>(frame.size()));
+  uint32_t header_size = 0;
+  if (!coded_input.ReadVarint32(&header_size) || header_size > frame.size() - coded_input.CurrentPosition()) {
+    return false;
+  }
+  const char* header_data = frame.data() + coded_input.CurrentPosition();
+  if (!rpcHeader->ParseFromArray(header_data, static_cast<int>(header_size))) {
+    return false;
+  }
+  *body = header_data + header_size;
+  *bodySize = frame.size() - (*body - frame.data());
+  return true;
+}
+
+// 按header里的压缩方式反序列化响应
+bool parseResponse(const RPC::RpcHeader& rpcHeader, const char* body, size_t bodySize,
+                   google::protobuf::Message* response) {
+  if (rpcHeader.compress_type() == RPC_COMPRESS_NONE) {
+    return response->ParseFromArray(body, static_cast<int>(bodySize));
+  }
+  std::string raw;
+  return RpcDecompress(rpcHeader.compress_type(), body, bodySize, rpcHeader.raw_size(), &raw) &&
+         response->ParseFromString(raw);
+}
+
+// 同步调用在异步channel上等响应：在协程里就挂起让出线程，普通线程上用条件变量等
+class CallWaiter : public google::protobuf::Closure {
+ public:
+  void Run() override {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_done = true;
+    if (m_fiber) {
+      // 只调度回挂起时的线程，那个线程让出之后协程才可能被恢复
+      m_iom->scheduler(m_fiber, m_thread);
+    } else {
+      m_cv.notify_one();
+    }
+  }
+
+  void Wait() {
+    monsoon::IOManager* iom = monsoon::IOManager::GetThis();
+    std::unique_lock<std::mutex> lk(m_mtx);
+    if (iom != nullptr && monsoon::is_hook_enable() && !m_done) {
+      m_iom = iom;
+      m_fiber = monsoon::Fiber::GetThis();
+      m_thread = monsoon::GetThreadId();
+      lk.unlock();
+      monsoon::Fiber::GetThis()->yield();
+      // 等Run放开锁之后才能返回，返回之后this就被析构了
+      lk.lock();
+      return;
+    }
+    m_cv.wait(lk, [this]() { return m_done; });
+  }
+
+ private:
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  bool m_done = false;
+  monsoon::IOManager* m_iom = nullptr;
+  monsoon::Fiber::ptr m_fiber;
+  pid_t m_thread = -1;
+};
+}  // namespace
+
+MprpcChannel::Connection::~Connection() {
+  monsoon::FdMgr::GetInstance()->del(fd);
+  ::close(fd);
+}
+
 // 所有通过stub代理对象调用的rpc方法，都会走到这里了，
 // 统一通过rpcChannel来调用方法
 // 统一做rpc方法调用的数据数据序列化和网络发送
 void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
                               google::protobuf::RpcController* controller, const google::protobuf::Message* request,
                               google::protobuf::Message* response, google::protobuf::Closure* done) {
-  if (m_clientFd == -1) {
-    std::string errMsg;
-    bool rt = newConnect(m_ip.c_str(), m_port, &errMsg);
-    if (!rt) {
-      DPrintf("[func-MprpcChannel::CallMethod]重连接ip：{%s} port{%d}失败", m_ip.c_str(), m_port);
-      controller->SetFailed(errMsg);
-      return;
-    } else {
-      DPrintf("[func-MprpcChannel::CallMethod]连接ip：{%s} port{%d}成功", m_ip.c_str(), m_port);
+  uint64_t requestId = m_nextRequestId.fetch_add(1);
+  if (m_async) {
+    callAsync(method, requestId, controller, request, response, done);
+  } else {
+    callSync(method, requestId, controller, request, response);
+    if (done != nullptr) {
+      done->Run();
     }
   }
+}
 
+bool MprpcChannel::encodeRequest(const google::protobuf::MethodDescriptor* method,
+                                 const google::protobuf::Message* request, uint64_t requestId, uint32_t methodId,
+                                 int timeoutMs, uint32_t compressType, std::string* send_rpc_str,
+                                 std::string* errMsg) {
   const google::protobuf::ServiceDescriptor* sd = method->service();
-  std::string service_name = sd->name();     // service_name
-  std::string method_name = method->name();  // method_name
-
-  // 获取参数的序列化字符串长度 args_size
-  uint32_t args_size{};
-  std::string args_str;
-  if (request->SerializeToString(&args_str)) {
-    args_size = args_str.size();
-  } else {
-    controller->SetFailed("serialize request error!");
-    return;
+
+  // 获取参数的序列化长度 args_size
+  size_t args_size = request->ByteSizeLong();
+  if (args_size > RPC_MAX_FRAME_SIZE) {
+    *errMsg = "serialize request error! request too large";
+    return false;
   }
   RPC::RpcHeader rpcHeader;
-  rpcHeader.set_service_name(service_name);
-  rpcHeader.set_method_name(method_name);
-  rpcHeader.set_args_size(args_size);
-
-  std::string rpc_header_str;
-  if (!rpcHeader.SerializeToString(&rpc_header_str)) {
-    controller->SetFailed("serialize rpc header error!");
-    return;
+  if (methodId != 0) {
+    rpcHeader.set_method_id(methodId);
+  } else {
+    rpcHeader.set_service_name(sd->name());      // service_name
+    rpcHeader.set_method_name(method->name());  // method_name
   }
+  rpcHeader.set_args_size(static_cast<uint32_t>(args_size));
+  rpcHeader.set_request_id(requestId);
+  if (timeoutMs > 0) {
+    rpcHeader.set_timeout_ms(timeoutMs);
+  }
+  rpcHeader.set_accept_compress(RpcSupportedCompressions());
+  // 大的请求先序列化再压缩，压缩没有效果时照常直接序列化进帧里
+  std::string compressed;
+  if (compressType != RPC_COMPRESS_NONE && args_size >= RPC_COMPRESS_MIN_SIZE) {
+    std::string raw(args_size, '\0');
+    request->SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(&raw[0]));
+    if (RpcCompress(compressType, raw.data(), raw.size(), &compressed)) {
+      rpcHeader.set_compress_type(compressType);
+      rpcHeader.set_raw_size(static_cast<uint32_t>(args_size));
+      args_size = compressed.size();
+      rpcHeader.set_args_size(static_cast<uint32_t>(args_size));
+    }
+  }
+  size_t header_size = rpcHeader.ByteSizeLong();
 
-  // 使用protobuf的CodedOutputStream来构建发送的数据流
-  std::string send_rpc_str;  // 用来存储最终发送的数据
-  {
-    // 创建一个StringOutputStream用于写入send_rpc_str
-    google::protobuf::io::StringOutputStream string_output(&send_rpc_str);
-    google::protobuf::io::CodedOutputStream coded_output(&string_output);
-
-    // 先写入header的长度（变长编码）
-    coded_output.WriteVarint32(static_cast<uint32_t>(rpc_header_str.size()));
+  // 先算好整个帧的长度，header和args直接序列化进同一块缓冲区，不再经过中间的字符串
+  size_t frame_size =
+      google::protobuf::io::CodedOutputStream::VarintSize32(static_cast<uint32_t>(header_size)) + header_size +
+      args_size;
+  send_rpc_str->resize(RPC_FRAME_HEADER_SIZE + frame_size);
+  uint8_t* out = reinterpret_cast<uint8_t*>(&(*send_rpc_str)[0]);
 
-    // 不需要手动写入header_size，因为上面的WriteVarint32已经包含了header的长度信息
-    // 然后写入rpc_header本身
-    coded_output.WriteString(rpc_header_str);
+  // 在最前面放整个帧的长度
+  uint32_t frame_len = htonl(static_cast<uint32_t>(frame_size));
+  memcpy(out, &frame_len, RPC_FRAME_HEADER_SIZE);
+  out += RPC_FRAME_HEADER_SIZE;
+  // 再写入header的长度（变长编码）和rpc_header本身
+  out = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(header_size), out);
+  out = rpcHeader.SerializeWithCachedSizesToArray(out);
+  // 最后是请求参数，ByteSizeLong已经缓存了各字段的大小
+  if (rpcHeader.compress_type() != RPC_COMPRESS_NONE) {
+    memcpy(out, compressed.data(), compressed.size());
+  } else {
+    request->SerializeWithCachedSizesToArray(out);
   }
+  return true;
+}
 
-  // 最后，将请求参数附加到send_rpc_str后面
-  send_rpc_str += args_str;
-
-  // 打印调试信息
-  //    std::cout << "============================================" << std::endl;
-  //    std::cout << "header_size: " << header_size << std::endl;
-  //    std::cout << "rpc_header_str: " << rpc_header_str << std::endl;
-  //    std::cout << "service_name: " << service_name << std::endl;
-  //    std::cout << "method_name: " << method_name << std::endl;
-  //    std::cout << "args_str: " << args_str << std::endl;
-  //    std::cout << "============================================" << std::endl;
+void MprpcChannel::callSync(const google::protobuf::MethodDescriptor* method, uint64_t requestId,
+                            google::protobuf::RpcController* controller, const google::protobuf::Message* request,
+                            google::protobuf::Message* response) {
+  int timeoutMs = CallTimeout(controller);
+  if (m_clientFd == -1) {
+    std::string errMsg;
+    bool rt = newConnect(m_ip.c_str(), m_port, &errMsg);
+    if (!rt) {
+      DPrintf("[func-MprpcChannel::CallMethod]重连接ip：{%s} port{%d}失败", m_ip.c_str(), m_port);
+      controller->SetFailed(errMsg);
+      return;
+    } else {
+      DPrintf("[func-MprpcChannel::CallMethod]连接ip：{%s} port{%d}成功", m_ip.c_str(), m_port);
+    }
+  }
 
   // 发送rpc请求
   //失败会重试连接再发送，重试连接失败会直接return
-  while (-1 == send(m_clientFd, send_rpc_str.c_str(), send_rpc_str.size(), 0)) {
-    char errtxt[512] = {0};
-    sprintf(errtxt, "send error! errno:%d", errno);
-    std::cout << "尝试重新连接，对方ip：" << m_ip << " 对方端口" << m_port << std::endl;
+  std::string send_rpc_str;
+  for (int attempt = 0;; attempt++) {
+    // 重连之后方法id作废，要重新编码
+    auto it = m_methodIds.find(method);
+    uint32_t methodId = it == m_methodIds.end() ? 0 : it->second;
+    std::string errMsg;
+    uint32_t compressType = RpcPickCompression(m_peerCompressions);
+    if (!encodeRequest(method, request, requestId, methodId, timeoutMs, compressType, &send_rpc_str, &errMsg)) {
+      controller->SetFailed(errMsg);
+      return;
+    }
+    if (sendAll(m_clientFd, send_rpc_str.c_str(), send_rpc_str.size(), timeoutMs)) {
+      break;
+    }
+    int sendErrno = errno;
     close(m_clientFd);
     m_clientFd = -1;
-    std::string errMsg;
+    if (sendErrno == ETIMEDOUT) {
+      // 对端不读，换一条连接也一样，这次调用直接失败
+      controller->SetFailed("send timeout");
+      return;
+    }
+    errno = sendErrno;
+    if (attempt > 0) {
+      // 刚建立的连接也发不出去，不再原地重试
+      controller->SetFailed("send error! errno:" + std::to_string(errno));
+      return;
+    }
+    LOG_INFO("尝试重新连接，对方ip：%s 对方端口%d", m_ip.c_str(), m_port);
     bool rt = newConnect(m_ip.c_str(), m_port, &errMsg);
     if (!rt) {
       controller->SetFailed(errMsg);
@@ -100,60 +349,314 @@ void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
   从时间节点来说，这里将请求发送过去之后rpc服务的提供者就会开始处理，返回的时候就代表着已经返回响应了
   */
 
-  // 接收rpc请求的响应值
-  char recv_buf[1024] = {0};
-  int recv_size = 0;
-  if (-1 == (recv_size = recv(m_clientFd, recv_buf, 1024, 0))) {
+  // 接收rpc请求的响应值：先读帧长度，再读完整个帧
+  setRecvTimeout(m_clientFd, timeoutMs);
+  std::string recv_buf;
+  std::string errMsg;
+  if (!recvFrame(m_clientFd, &recv_buf, &errMsg)) {
+    // 超时之后响应可能随时到达，这条连接上的数据已经对不上了，只能断开
+    bool timedOut = errno == EAGAIN || errno == EWOULDBLOCK || errno == ETIMEDOUT;
     close(m_clientFd);
     m_clientFd = -1;
-    char errtxt[512] = {0};
-    sprintf(errtxt, "recv error! errno:%d", errno);
-    controller->SetFailed(errtxt);
+    controller->SetFailed(timedOut ? "rpc timeout" : errMsg);
     return;
   }
 
   // 反序列化rpc调用的响应数据
-  // std::string response_str(recv_buf, 0, recv_size); //
-  // bug：出现问题，recv_buf中遇到\0后面的数据就存不下来了，导致反序列化失败 if
-  // (!response->ParseFromString(response_str))
-  if (!response->ParseFromArray(recv_buf, recv_size)) {
-    char errtxt[1050] = {0};
-    sprintf(errtxt, "parse error! response_str:%s", recv_buf);
+  RPC::RpcHeader rpcHeader;
+  const char* body = nullptr;
+  size_t bodySize = 0;
+  if (!decodeResponseFrame(recv_buf, &rpcHeader, &body, &bodySize) || rpcHeader.request_id() != requestId ||
+      !parseResponse(rpcHeader, body, bodySize, response)) {
+    // 同步模式一条连接上只有一个请求，对不上说明流已经乱了
+    close(m_clientFd);
+    m_clientFd = -1;
+    char errtxt[512] = {0};
+    sprintf(errtxt, "parse error! response size:%zu", recv_buf.size());
     controller->SetFailed(errtxt);
     return;
   }
+  if (rpcHeader.method_id() != 0) {
+    m_methodIds[method] = rpcHeader.method_id();
+  }
+  m_peerCompressions = rpcHeader.accept_compress();
 }
 
-bool MprpcChannel::newConnect(const char* ip, uint16_t port, string* errMsg) {
+void MprpcChannel::callAsync(const google::protobuf::MethodDescriptor* method, uint64_t requestId,
+                             google::protobuf::RpcController* controller, const google::protobuf::Message* request,
+                             google::protobuf::Message* response, google::protobuf::Closure* done) {
+  int timeoutMs = CallTimeout(controller);
+  CallWaiter waiter;
+  google::protobuf::Closure* cb = done != nullptr ? done : &waiter;
+  std::string errMsg;
+  auto conn = getConnection(&errMsg);
+  if (!conn) {
+    DPrintf("[func-MprpcChannel::CallMethod]连接ip：{%s} port{%d}失败", m_ip.c_str(), m_port);
+    controller->SetFailed(errMsg);
+    cb->Run();
+    return;
+  }
+  uint32_t methodId = 0;
+  uint32_t compressType = RPC_COMPRESS_NONE;
+  {
+    std::lock_guard<std::mutex> lg(conn->mtx);
+    auto it = conn->methodIds.find(method);
+    if (it != conn->methodIds.end()) {
+      methodId = it->second;
+    }
+    compressType = RpcPickCompression(conn->peerCompressions);
+  }
+  std::string send_rpc_str;
+  if (!encodeRequest(method, request, requestId, methodId, timeoutMs, compressType, &send_rpc_str, &errMsg)) {
+    controller->SetFailed(errMsg);
+    cb->Run();
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lg(conn->mtx);
+    if (conn->closed) {
+      controller->SetFailed("connection closed");
+      cb->Run();
+      return;
+    }
+    conn->pending[requestId] = {method, controller, response, cb, nullptr};
+  }
+  if (timeoutMs > 0) {
+    // 定时器先于响应触发时这次调用以超时失败，之后到达的响应会被丢弃
+    std::weak_ptr<Connection> weakConn = conn;
+    auto timer = ClientIOManager()->addTimer(timeoutMs, [weakConn, requestId]() { timeoutCall(weakConn, requestId); });
+    std::lock_guard<std::mutex> lg(conn->mtx);
+    auto it = conn->pending.find(requestId);
+    if (it != conn->pending.end()) {
+      it->second.timer = timer;
+    } else {
+      timer->cancel();
+    }
+  }
+  bool sent = false;
+  {
+    std::lock_guard<std::mutex> lg(conn->writeMtx);
+    HookDisabler noHook;
+    sent = sendAll(conn->fd, send_rpc_str.data(), send_rpc_str.size(), timeoutMs);
+  }
+  if (!sent) {
+    // 包括这次调用在内的所有未完成调用都会失败；发送超时时连接上可能只写了半帧，也只能关掉
+    closeConnection(conn, "send error! errno:" + std::to_string(errno));
+  }
+  if (done == nullptr) {
+    waiter.Wait();
+  }
+}
+
+std::shared_ptr<MprpcChannel::Connection> MprpcChannel::getConnection(std::string* errMsg) {
+  // 轮流使用池里的连接；选中的连接断了就在这次调用里重连，连不上（别人正在连或者还在退避）就先用池里别的活着的连接
+  size_t slot = m_nextConn.fetch_add(1) % m_conns.size();
+  std::shared_ptr<Connection> fallback;
+  {
+    std::lock_guard<std::mutex> lg(m_connMtx);
+    for (size_t i = 0; i < m_conns.size(); i++) {
+      const auto& conn = m_conns[(slot + i) % m_conns.size()];
+      if (conn && isOpen(conn)) {
+        if (i == 0) {
+          return conn;
+        }
+        if (!fallback) {
+          fallback = conn;
+        }
+      }
+    }
+  }
+  int fd = connectWithBackoff(errMsg);
+  if (fd == -1) {
+    return fallback;
+  }
+  // 交给fd管理器之后socket被设成非阻塞，读协程在上面recv时会让出线程
+  monsoon::FdMgr::GetInstance()->get(fd, true);
+  auto conn = std::make_shared<Connection>(fd);
+  {
+    std::lock_guard<std::mutex> lg(m_connMtx);
+    m_conns[slot] = conn;
+  }
+  ClientIOManager()->scheduler([conn]() { readLoop(conn); });
+  return conn;
+}
+
+bool MprpcChannel::isOpen(const std::shared_ptr<Connection>& conn) {
+  std::lock_guard<std::mutex> lg(conn->mtx);
+  return !conn->closed;
+}
+
+int MprpcChannel::connectWithBackoff(std::string* errMsg) {
+  {
+    std::lock_guard<std::mutex> lg(m_connMtx);
+    if (m_connecting) {
+      *errMsg = "connect fail! another call is connecting";
+      return -1;
+    }
+    if (std::chrono::steady_clock::now() < m_nextConnectTime) {
+      *errMsg = "connect fail! peer unavailable, waiting for reconnect backoff";
+      return -1;
+    }
+    m_connecting = true;
+  }
+  // 连接期间不持有m_connMtx，其他调用者直接失败或者使用别的连接，不会跟着一起等
+  int fd = connectTo(m_ip.c_str(), m_port, errMsg);
+  std::lock_guard<std::mutex> lg(m_connMtx);
+  m_connecting = false;
+  if (fd == -1) {
+    // 退避时间指数增长
+    m_backoffMs =
+        m_backoffMs == 0 ? RPC_RECONNECT_BACKOFF_MIN_MS : std::min(m_backoffMs * 2, RPC_RECONNECT_BACKOFF_MAX_MS);
+    m_nextConnectTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_backoffMs);
+  } else {
+    m_backoffMs = 0;
+  }
+  return fd;
+}
+
+void MprpcChannel::readLoop(std::shared_ptr<Connection> conn) {
+  std::string frame;
+  std::string errMsg;
+  while (recvFrame(conn->fd, &frame, &errMsg)) {
+    RPC::RpcHeader rpcHeader;
+    const char* body = nullptr;
+    size_t bodySize = 0;
+    if (!decodeResponseFrame(frame, &rpcHeader, &body, &bodySize)) {
+      errMsg = "parse rpc header error!";
+      break;
+    }
+    PendingCall call{};
+    {
+      std::lock_guard<std::mutex> lg(conn->mtx);
+      conn->peerCompressions = rpcHeader.accept_compress();
+      auto it = conn->pending.find(rpcHeader.request_id());
+      if (it == conn->pending.end()) {
+        continue;  // 调用已经因为别的原因结束了
+      }
+      call = it->second;
+      conn->pending.erase(it);
+      if (rpcHeader.method_id() != 0) {
+        conn->methodIds[call.method] = rpcHeader.method_id();
+      }
+    }
+    if (call.timer) {
+      call.timer->cancel();
+    }
+    if (!parseResponse(rpcHeader, body, bodySize, call.response)) {
+      call.controller->SetFailed("parse error! response size:" + std::to_string(bodySize));
+    }
+    call.done->Run();
+  }
+  closeConnection(conn, errMsg);
+}
+
+void MprpcChannel::closeConnection(const std::shared_ptr<Connection>& conn, const std::string& reason) {
+  std::unordered_map<uint64_t, PendingCall> pending;
+  {
+    std::lock_guard<std::mutex> lg(conn->mtx);
+    if (conn->closed) {
+      return;
+    }
+    conn->closed = true;
+    pending.swap(conn->pending);
+  }
+  // 让读协程从recv中返回，fd在最后一个引用释放时才close，避免fd号被复用
+  ::shutdown(conn->fd, SHUT_RDWR);
+  for (auto& item : pending) {
+    if (item.second.timer) {
+      item.second.timer->cancel();
+    }
+    item.second.controller->SetFailed(reason);
+    item.second.done->Run();
+  }
+}
+
+void MprpcChannel::timeoutCall(const std::weak_ptr<Connection>& weakConn, uint64_t requestId) {
+  auto conn = weakConn.lock();
+  if (!conn) {
+    return;
+  }
+  PendingCall call{};
+  {
+    std::lock_guard<std::mutex> lg(conn->mtx);
+    auto it = conn->pending.find(requestId);
+    if (it == conn->pending.end()) {
+      return;
+    }
+    call = it->second;
+    conn->pending.erase(it);
+  }
+  call.controller->SetFailed("rpc timeout");
+  call.done->Run();
+}
+
+int MprpcChannel::CallTimeout(google::protobuf::RpcController* controller) {
+  auto mprpcController = dynamic_cast<MprpcController*>(controller);
+  return mprpcController != nullptr ? std::max(mprpcController->Timeout(), 0) : 0;
+}
+
+monsoon::IOManager* MprpcChannel::ClientIOManager() {
+  // 进程退出时不析构，读协程可能还阻塞在recv上
+  static monsoon::IOManager* iom = new monsoon::IOManager(RPC_CLIENT_IO_THREADS, false, "rpc-client");
+  return iom;
+}
+
+int MprpcChannel::connectTo(const char* ip, uint16_t port, string* errMsg) {
   int clientfd = socket(AF_INET, SOCK_STREAM, 0);
   if (-1 == clientfd) {
     char errtxt[512] = {0};
     sprintf(errtxt, "create socket error! errno:%d", errno);
-    m_clientFd = -1;
     *errMsg = errtxt;
-    return false;
+    return -1;
   }
 
   struct sockaddr_in server_addr;
   server_addr.sin_family = AF_INET;
   server_addr.sin_port = htons(port);
   server_addr.sin_addr.s_addr = inet_addr(ip);
-  // 连接rpc服务节点
-  if (-1 == connect(clientfd, (struct sockaddr*)&server_addr, sizeof(server_addr))) {
+  // 连接rpc服务节点，对端不可达时最多等RPC_CONNECT_TIMEOUT_MS
+  int rt;
+  if (monsoon::IOManager::GetThis() != nullptr && monsoon::is_hook_enable()) {
+    // 协程里由hook完成非阻塞connect，等待期间让出线程
+    rt = connect_with_timeout(clientfd, (struct sockaddr*)&server_addr, sizeof(server_addr), RPC_CONNECT_TIMEOUT_MS);
+  } else {
+    rt = connectWithTimeout(clientfd, (struct sockaddr*)&server_addr, sizeof(server_addr), RPC_CONNECT_TIMEOUT_MS);
+  }
+  if (-1 == rt) {
+    int err = errno;
     close(clientfd);
     char errtxt[512] = {0};
-    sprintf(errtxt, "connect fail! errno:%d", errno);
-    m_clientFd = -1;
+    sprintf(errtxt, "connect fail! errno:%d", err);
     *errMsg = errtxt;
-    return false;
+    return -1;
   }
-  m_clientFd = clientfd;
-  return true;
+  // 阻塞的socket写满时send每过这么久返回一次EAGAIN，sendAll才能按调用的超时时间放弃
+  timeval tv{RAFT_RPC_TIMEOUT_MS / 1000, (RAFT_RPC_TIMEOUT_MS % 1000) * 1000};
+  setsockopt(clientfd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+  return clientfd;
 }
 
-MprpcChannel::MprpcChannel(string ip, short port, bool connectNow) : m_ip(ip), m_port(port), m_clientFd(-1) {
-  // 使用tcp编程，完成rpc方法的远程调用，使用的是短连接，因此每次都要重新连接上去，待改成长连接。
-  // 没有连接或者连接已经断开，那么就要重新连接呢,会一直不断地重试
+bool MprpcChannel::newConnect(const char* ip, uint16_t port, string* errMsg) {
+  // 对端可能已经重启，之前拿到的方法id不一定还有效
+  m_methodIds.clear();
+  m_peerCompressions = 0;
+  m_clientFd = connectWithBackoff(errMsg);
+  return m_clientFd != -1;
+}
+
+MprpcChannel::MprpcChannel(string ip, short port, bool connectNow, bool async, int connections)
+    : m_ip(ip),
+      m_port(port),
+      m_clientFd(-1),
+      m_async(async),
+      m_nextRequestId(1),
+      m_conns(connections),
+      m_nextConn(0),
+      m_connecting(false),
+      m_backoffMs(0),
+      m_peerCompressions(0) {
+  // 使用tcp编程，完成rpc方法的远程调用，使用的是长连接，断开之后下一次调用时重连
+  // 连接失败之后按指数退避，退避期间的调用直接失败，不会卡住调用者
   // 读取配置文件rpcserver的信息
   // std::string ip = MprpcApplication::GetInstance().GetConfig().Load("rpcserverip");
   // uint16_t port = atoi(MprpcApplication::GetInstance().GetConfig().Load("rpcserverport").c_str());
@@ -163,10 +666,24 @@ MprpcChannel::MprpcChannel(string ip, short port, bool connectNow) : m_ip(ip), m
     return;
   }  //可以允许延迟连接
   std::string errMsg;
-  auto rt = newConnect(ip.c_str(), port, &errMsg);
-  int tryCount = 3;
-  while (!rt && tryCount--) {
-    std::cout << errMsg << std::endl;
-    rt = newConnect(ip.c_str(), port, &errMsg);
+  bool rt = m_async ? getConnection(&errMsg) != nullptr : newConnect(ip.c_str(), port, &errMsg);
+  if (!rt) {
+    LOG_WARN("%s", errMsg.c_str());
+  }
+}
+
+MprpcChannel::~MprpcChannel() {
+  if (m_clientFd != -1) {
+    close(m_clientFd);
+  }
+  std::vector<std::shared_ptr<Connection>> conns;
+  {
+    std::lock_guard<std::mutex> lg(m_connMtx);
+    conns.swap(m_conns);
   }
-}
\ No newline at end of file
+  for (auto& conn : conns) {
+    if (conn) {
+      closeConnection(conn, "channel destroyed");
+    }
+  }
+}
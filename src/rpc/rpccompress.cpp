@@ -0,0 +1,86 @@
+#include "rpccompress.h"
+#include "config.h"
+#ifdef RPC_WITH_LZ4
+#include <lz4.h>
+#endif
+#ifdef RPC_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+uint32_t RpcSupportedCompressions() {
+  uint32_t mask = 0;
+#ifdef RPC_WITH_LZ4
+  mask |= 1u << RPC_COMPRESS_LZ4;
+#endif
+#ifdef RPC_WITH_ZSTD
+  mask |= 1u << RPC_COMPRESS_ZSTD;
+#endif
+  return mask;
+}
+
+uint32_t RpcPickCompression(uint32_t peerAccepts) {
+  uint32_t both = peerAccepts & RpcSupportedCompressions();
+  if (both & (1u << RPC_COMPRESS_ZSTD)) {
+    return RPC_COMPRESS_ZSTD;
+  }
+  if (both & (1u << RPC_COMPRESS_LZ4)) {
+    return RPC_COMPRESS_LZ4;
+  }
+  return RPC_COMPRESS_NONE;
+}
+
+bool RpcCompress(uint32_t type, const char *data, size_t len, std::string *out) {
+  switch (type) {
+#ifdef RPC_WITH_LZ4
+    case RPC_COMPRESS_LZ4: {
+      if (len > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) {
+        return false;
+      }
+      out->resize(LZ4_compressBound(static_cast<int>(len)));
+      int n = LZ4_compress_default(data, &(*out)[0], static_cast<int>(len), static_cast<int>(out->size()));
+      if (n <= 0 || static_cast<size_t>(n) >= len) {
+        return false;
+      }
+      out->resize(n);
+      return true;
+    }
+#endif
+#ifdef RPC_WITH_ZSTD
+    case RPC_COMPRESS_ZSTD: {
+      out->resize(ZSTD_compressBound(len));
+      size_t n = ZSTD_compress(&(*out)[0], out->size(), data, len, RPC_COMPRESS_ZSTD_LEVEL);
+      if (ZSTD_isError(n) || n >= len) {
+        return false;
+      }
+      out->resize(n);
+      return true;
+    }
+#endif
+    default:
+      return false;
+  }
+}
+
+bool RpcDecompress(uint32_t type, const char *data, size_t len, size_t rawSize, std::string *out) {
+  // rawSize来自对端，先检查再分配内存
+  if (rawSize > RPC_MAX_FRAME_SIZE) {
+    return false;
+  }
+  out->resize(rawSize);
+  switch (type) {
+#ifdef RPC_WITH_LZ4
+    case RPC_COMPRESS_LZ4: {
+      int n = LZ4_decompress_safe(data, &(*out)[0], static_cast<int>(len), static_cast<int>(rawSize));
+      return n >= 0 && static_cast<size_t>(n) == rawSize;
+    }
+#endif
+#ifdef RPC_WITH_ZSTD
+    case RPC_COMPRESS_ZSTD: {
+      size_t n = ZSTD_decompress(&(*out)[0], rawSize, data, len);
+      return !ZSTD_isError(n) && n == rawSize;
+    }
+#endif
+    default:
+      return false;
+  }
+}
@@ -2,11 +2,47 @@
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <unistd.h>
+#include <boost/any.hpp>
+#include <algorithm>
 #include <cstring>
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <string>
+#include "google/protobuf/arena.h"
+#include "metrics.h"
+#include "rpccompress.h"
 #include "rpcheader.pb.h"
 #include "util.h"
+
+namespace {
+// 执行完一次后自动释放的Closure
+class ResponseClosure : public google::protobuf::Closure {
+ public:
+  explicit ResponseClosure(std::function<void()> fn) : m_fn(std::move(fn)) {}
+  void Run() override {
+    m_fn();
+    delete this;
+  }
+
+ private:
+  std::function<void()> m_fn;
+};
+
+struct RpcServerMetrics {
+  MetricCounter *requests = Metrics::Instance().Counter("rpc_server_requests_total", "收到的rpc请求数");
+  MetricCounter *dropped = Metrics::Instance().Counter("rpc_server_expired_total", "排队时已经超时被丢弃的rpc请求数");
+  MetricCounter *recvBytes = Metrics::Instance().Counter("rpc_server_received_bytes_total", "收到的rpc帧字节数");
+  MetricCounter *sentBytes = Metrics::Instance().Counter("rpc_server_sent_bytes_total", "发出的rpc响应字节数");
+  LatencyHistogram *handle = Metrics::Instance().Histogram("rpc_server_handle_us", "收到请求到响应交给IO线程的时间");
+};
+
+RpcServerMetrics &rpcMetrics() {
+  static RpcServerMetrics metrics;
+  return metrics;
+}
+}  // namespace
+
 /*
 service_name =>  service描述
                         =》 service* 记录服务对象
@@ -16,7 +52,8 @@ json   protobuf
 // 这里是框架提供给外部使用的，可以发布rpc方法的函数接口
 // 只是简单的把服务描述符和方法描述符全部保存在本地而已
 // todo 待修改 要把本机开启的ip和端口写在文件里面
-void RpcProvider::NotifyService(google::protobuf::Service *service) {
+void RpcProvider::NotifyService(google::protobuf::Service *service, bool ordered,
+                                const std::vector<std::string> &unorderedMethods) {
   ServiceInfo service_info;
 
   // 获取了服务对象的描述信息
@@ -33,8 +70,13 @@ void RpcProvider::NotifyService(google::protobuf::Service *service) {
     const google::protobuf::MethodDescriptor *pmethodDesc = pserviceDesc->method(i);
     std::string method_name = pmethodDesc->name();
     service_info.m_methodMap.insert({method_name, pmethodDesc});
+    bool methodOrdered =
+        ordered && std::find(unorderedMethods.begin(), unorderedMethods.end(), method_name) == unorderedMethods.end();
+    m_methodTable.push_back({service, pmethodDesc, methodOrdered});
   }
   service_info.m_service = service;
+  // 这个服务的方法在m_methodTable中连续存放，方法id = 第一个方法的id + 方法在服务里的下标
+  service_info.m_firstMethodId = m_methodTable.size() - methodCnt + 1;
   m_serviceMap.insert({service_name, service_info});
 }
 
@@ -88,7 +130,9 @@ void RpcProvider::Run(int nodeIndex, short port) {
       std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
 
   // 设置muduo库的线程数量
-  m_muduo_server->setThreadNum(4);
+  m_muduo_server->setThreadNum(RPC_SERVER_IO_THREADS);
+  // 执行业务方法的线程，不使用调用线程，调用线程要跑m_eventLoop
+  m_workers = std::make_unique<monsoon::IOManager>(RPC_SERVER_WORKER_THREADS, false, "rpc-worker");
 
   // rpc服务端准备启动，打印信息
   std::cout << "RpcProvider start service at ip:" << ip << " port:" << port << std::endl;
@@ -109,8 +153,10 @@ void RpcProvider::Run(int nodeIndex, short port) {
 
 // 新的socket连接回调
 void RpcProvider::OnConnection(const muduo::net::TcpConnectionPtr &conn) {
-  // 如果是新连接就什么都不干，即正常的接收连接即可
-  if (!conn->connected()) {
+  // 新连接挂上自己的请求队列，连接断开时随连接一起释放
+  if (conn->connected()) {
+    conn->setContext(std::make_shared<ConnectionQueue>());
+  } else {
     // 和rpc client的连接断开了
     conn->shutdown();
   }
@@ -126,97 +172,171 @@ header_size(4个字节) + header_str + args_str
 10 "10"
 10000 "1000000"
 std::string   insert和copy方法
+
+tcp是字节流，每个请求和响应外面再套一层帧：frame_len(4字节，网络字节序) + frame
+请求的frame是 varint header_size + header_str + args_str，响应的frame是 varint header_size + header_str(request_id) + response
+都直接在接收缓冲区上ParseFromArray，发送时一次性序列化到预先分配好的缓冲区里，中间不产生临时字符串
 */
 // 已建立连接用户的读写事件回调 如果远程有一个rpc服务的调用请求，那么OnMessage方法就会响应
-// 这里来的肯定是一个远程调用请求
-// 因此本函数需要：解析请求，根据服务名，方法名，参数，来调用service的来callmethod来调用本地的业务
-void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer, muduo::Timestamp) {
-  // 网络上接收的远程rpc调用请求的字符流    Login args
-  std::string recv_buf = buffer->retrieveAllAsString();
+// 一次回调里可能有多个请求，也可能只有半个，完整的帧全部处理掉，不完整的留在buffer里等下次
+void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer,
+                            muduo::Timestamp receiveTime) {
+  // rpc帧的前4个字节是长度，"GET "当长度看远大于RPC_MAX_FRAME_SIZE，不会和合法的帧混淆
+  if (buffer->readableBytes() >= 4 && memcmp(buffer->peek(), "GET ", 4) == 0) {
+    HandleHttp(conn, buffer);
+    return;
+  }
+  while (buffer->readableBytes() >= RPC_FRAME_HEADER_SIZE) {
+    uint32_t frame_size = static_cast<uint32_t>(buffer->peekInt32());
+    if (frame_size > RPC_MAX_FRAME_SIZE) {
+      // 帧长度不可能这么大，说明流已经错位了，只能断开
+      DPrintf("[func-RpcProvider::OnMessage] frame size %u too large, close connection %s", frame_size,
+              conn->name().c_str());
+      conn->shutdown();
+      return;
+    }
+    if (buffer->readableBytes() < RPC_FRAME_HEADER_SIZE + frame_size) {
+      return;  // 帧还没收全
+    }
+    buffer->retrieve(RPC_FRAME_HEADER_SIZE);
+    rpcMetrics().requests->add();
+    rpcMetrics().recvBytes->add(RPC_FRAME_HEADER_SIZE + frame_size);
+    // 请求在HandleRequest里就解析完了，之后才把这一帧从buffer里丢掉
+    HandleRequest(conn, buffer->peek(), frame_size, receiveTime);
+    buffer->retrieve(frame_size);
+  }
+}
+
+// 解析一个完整的请求帧，根据服务名，方法名，参数，来调用service的来callmethod来调用本地的业务
+void RpcProvider::HandleRequest(const muduo::net::TcpConnectionPtr &conn, const char *data, size_t len,
+                                muduo::Timestamp receiveTime) {
 
   // 使用protobuf的CodedInputStream来解析数据流
-  google::protobuf::io::ArrayInputStream array_input(recv_buf.data(), recv_buf.size());
-  google::protobuf::io::CodedInputStream coded_input(&array_input);
+  google::protobuf::io::CodedInputStream coded_input(reinterpret_cast<const uint8_t *>(data), static_cast<int>(len));
   uint32_t header_size{};
 
-  coded_input.ReadVarint32(&header_size);  // 解析header_size
+  // 解析header_size
+  if (!coded_input.ReadVarint32(&header_size) || header_size > len - coded_input.CurrentPosition()) {
+    LOG_WARN("rpc header size error!");
+    return;
+  }
+  const char *header_data = data + coded_input.CurrentPosition();
 
-  // 根据header_size读取数据头的原始字符流，反序列化数据，得到rpc请求的详细信息
-  std::string rpc_header_str;
+  // 根据header_size直接在缓冲区上反序列化数据头，得到rpc请求的详细信息
   RPC::RpcHeader rpcHeader;
   std::string service_name;
   std::string method_name;
-
-  // 设置读取限制，不必担心数据读多
-  google::protobuf::io::CodedInputStream::Limit msg_limit = coded_input.PushLimit(header_size);
-  coded_input.ReadString(&rpc_header_str, header_size);
-  // 恢复之前的限制，以便安全地继续读取其他数据
-  coded_input.PopLimit(msg_limit);
   uint32_t args_size{};
-  if (rpcHeader.ParseFromString(rpc_header_str)) {
+  uint64_t request_id{};
+  if (rpcHeader.ParseFromArray(header_data, header_size)) {
     // 数据头反序列化成功
     service_name = rpcHeader.service_name();
     method_name = rpcHeader.method_name();
     args_size = rpcHeader.args_size();
+    request_id = rpcHeader.request_id();
   } else {
     // 数据头反序列化失败
-    std::cout << "rpc_header_str:" << rpc_header_str << " parse error!" << std::endl;
+    LOG_WARN("rpc header parse error!");
     return;
   }
 
-  // 获取rpc方法参数的字符流数据
-  std::string args_str;
-  // 直接读取args_size长度的字符串数据
-  bool read_args_success = coded_input.ReadString(&args_str, args_size);
+  // 前面的请求处理得太久，调用方已经超时放弃了，不再浪费时间处理；进了worker之后开始执行前再检查一次
+  int64_t deadline = 0;  // 0表示调用方没有超时
+  if (rpcHeader.timeout_ms() > 0) {
+    deadline = receiveTime.microSecondsSinceEpoch() + static_cast<int64_t>(rpcHeader.timeout_ms()) * 1000;
+    if (muduo::Timestamp::now().microSecondsSinceEpoch() > deadline) {
+      DPrintf("[func-RpcProvider::HandleRequest] request %lu timeout, dropped", request_id);
+      rpcMetrics().dropped->add();
+      return;
+    }
+  }
 
-  if (!read_args_success) {
-    // 处理错误：参数数据读取失败
+  // rpc方法参数紧跟在数据头后面
+  const char *args_data = header_data + header_size;
+  if (args_size > len - (args_data - data)) {
+    // 处理错误：参数数据不完整
     return;
   }
 
   // 打印调试信息
   //    std::cout << "============================================" << std::endl;
   //    std::cout << "header_size: " << header_size << std::endl;
-  //    std::cout << "rpc_header_str: " << rpc_header_str << std::endl;
   //    std::cout << "service_name: " << service_name << std::endl;
   //    std::cout << "method_name: " << method_name << std::endl;
-  //    std::cout << "args_str: " << args_str << std::endl;
   //    std::cout << "============================================" << std::endl;
 
   // 获取service对象和method对象
-  auto it = m_serviceMap.find(service_name);
-  if (it == m_serviceMap.end()) {
-    std::cout << "服务：" << service_name << " is not exist!" << std::endl;
-    std::cout << "当前已经有的服务列表为:";
-    for (auto item : m_serviceMap) {
-      std::cout << item.first << " ";
+  // 带了方法id就直接下标查表；没有的话按名字查找，并在响应里把方法id告诉客户端，之后的请求就只带id
+  google::protobuf::Service *service = nullptr;                // 获取service对象  new UserService
+  const google::protobuf::MethodDescriptor *method = nullptr;  // 获取method对象  Login
+  uint32_t method_id = rpcHeader.method_id();
+  uint32_t assigned_method_id = 0;
+  bool ordered = false;
+  if (method_id != 0) {
+    if (method_id > m_methodTable.size()) {
+      LOG_WARN("method id:%u is not exist!", method_id);
+      return;
+    }
+    service = m_methodTable[method_id - 1].m_service;
+    method = m_methodTable[method_id - 1].m_method;
+    ordered = m_methodTable[method_id - 1].m_ordered;
+  } else {
+    auto it = m_serviceMap.find(service_name);
+    if (it == m_serviceMap.end()) {
+      std::string services;
+      for (auto &item : m_serviceMap) {
+        services += item.first + " ";
+      }
+      LOG_WARN("服务：%s is not exist! 当前已经有的服务列表为:%s", service_name.c_str(), services.c_str());
+      return;
     }
-    std::cout << std::endl;
-    return;
-  }
 
-  auto mit = it->second.m_methodMap.find(method_name);
-  if (mit == it->second.m_methodMap.end()) {
-    std::cout << service_name << ":" << method_name << " is not exist!" << std::endl;
-    return;
-  }
+    auto mit = it->second.m_methodMap.find(method_name);
+    if (mit == it->second.m_methodMap.end()) {
+      LOG_WARN("%s:%s is not exist!", service_name.c_str(), method_name.c_str());
+      return;
+    }
 
-  google::protobuf::Service *service = it->second.m_service;       // 获取service对象  new UserService
-  const google::protobuf::MethodDescriptor *method = mit->second;  // 获取method对象  Login
+    service = it->second.m_service;
+    method = mit->second;
+    assigned_method_id = it->second.m_firstMethodId + method->index();
+    ordered = m_methodTable[assigned_method_id - 1].m_ordered;
+  }
 
   // 生成rpc方法调用的请求request和响应response参数,由于是rpc的请求，因此请求需要通过request来序列化
-  google::protobuf::Message *request = service->GetRequestPrototype(method).New();
-  if (!request->ParseFromString(args_str)) {
-    std::cout << "request parse error, content:" << args_str << std::endl;
+  // request和response以及它们内部的字段都分配在这次请求独占的arena上，响应发出去之后整体释放
+  google::protobuf::ArenaOptions arenaOptions;
+  arenaOptions.start_block_size = RPC_ARENA_BLOCK_SIZE;
+  auto arena = std::make_unique<google::protobuf::Arena>(arenaOptions);
+  google::protobuf::Message *request = service->GetRequestPrototype(method).New(arena.get());
+  bool parsed = false;
+  if (rpcHeader.compress_type() == RPC_COMPRESS_NONE) {
+    parsed = request->ParseFromArray(args_data, static_cast<int>(args_size));
+  } else {
+    std::string raw;
+    parsed = RpcDecompress(rpcHeader.compress_type(), args_data, args_size, rpcHeader.raw_size(), &raw) &&
+             request->ParseFromString(raw);
+  }
+  if (!parsed) {
+    LOG_WARN("request parse error, service:%s method:%s", service_name.c_str(), method_name.c_str());
     return;
   }
-  google::protobuf::Message *response = service->GetResponsePrototype(method).New();
+  google::protobuf::Message *response = service->GetResponsePrototype(method).New(arena.get());
 
   // 给下面的method方法的调用，绑定一个Closure的回调函数
   // closure是执行完本地方法之后会发生的回调，因此需要完成序列化和反向发送请求的操作
+  // 响应要带回request_id，NewCallback最多绑定两个参数，这里用lambda
+  // 响应用调用方能解压的方式压缩
+  google::protobuf::Arena *requestArena = arena.release();
+  uint32_t compress_type = RpcPickCompression(rpcHeader.accept_compress());
   google::protobuf::Closure *done =
-      google::protobuf::NewCallback<RpcProvider, const muduo::net::TcpConnectionPtr &, google::protobuf::Message *>(
-          this, &RpcProvider::SendRpcResponse, conn, response);
+      new ResponseClosure([this, conn, request_id, assigned_method_id, compress_type, response, requestArena,
+                           receiveTime]() {
+        SendRpcResponse(conn, request_id, assigned_method_id, compress_type, response);
+        delete requestArena;
+        rpcMetrics().handle->record(muduo::Timestamp::now().microSecondsSinceEpoch() -
+                                    receiveTime.microSecondsSinceEpoch());
+      });
 
   // 在框架上根据远端rpc请求，调用当前rpc节点上发布的方法
   // new UserService().Login(controller, request, response, done)
@@ -231,19 +351,130 @@ void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net
   真的是妙呀
   */
   //真正调用方法
-  service->CallMethod(method, nullptr, request, response, done);
+  // 请求已经解析完，不再依赖接收缓冲区，交给worker执行，done里的conn->send会切回连接所属的IO线程发送
+  // 在worker池或者连接的顺序队列里排队的时间也算：开始执行时已经超时的直接丢弃，不发响应
+  auto task = [service, method, request, response, done, requestArena, deadline, request_id]() {
+    if (deadline > 0 && muduo::Timestamp::now().microSecondsSinceEpoch() > deadline) {
+      DPrintf("[func-RpcProvider::HandleRequest] request %lu expired while queued, dropped", request_id);
+      rpcMetrics().dropped->add();
+      delete done;
+      delete requestArena;
+      return;
+    }
+    service->CallMethod(method, nullptr, request, response, done);
+  };
+  if (ordered) {
+    EnqueueOrdered(boost::any_cast<std::shared_ptr<ConnectionQueue>>(conn->getContext()), std::move(task));
+  } else {
+    m_workers->scheduler(std::move(task));
+  }
 }
 
-// Closure的回调操作，用于序列化rpc的响应和网络发送,发送响应回去
-void RpcProvider::SendRpcResponse(const muduo::net::TcpConnectionPtr &conn, google::protobuf::Message *response) {
-  std::string response_str;
-  if (response->SerializeToString(&response_str))  // response进行序列化
+void RpcProvider::HandleHttp(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer) {
+  const char *begin = buffer->peek();
+  const char *end = begin + buffer->readableBytes();
+  static const char kHeaderEnd[] = "\r\n\r\n";
+  if (std::search(begin, end, kHeaderEnd, kHeaderEnd + 4) == end) {
+    if (buffer->readableBytes() > RPC_HTTP_MAX_HEADER_SIZE) {
+      conn->shutdown();
+      buffer->retrieveAll();
+    }
+    return;  // 请求头还没收全
+  }
+  // 只看请求行里的路径，忽略其余的头；GET没有body，之后再收到的内容也不再处理
+  const char *pathBegin = begin + 4;
+  const char *pathEnd = std::find_if(pathBegin, end, [](char c) { return c == ' ' || c == '?' || c == '\r'; });
+  std::string path(pathBegin, pathEnd);
+  buffer->retrieveAll();
+  // 生成内容要遍历所有指标、计算分位数，不在IO线程里做
+  m_workers->scheduler([conn, path]() {
+    std::string body;
+    std::string status;
+    std::string contentType;
+    if (path == "/metrics") {
+      body = Metrics::Instance().RenderPrometheus();
+      status = "200 OK";
+      contentType = "text/plain; version=0.0.4";
+    } else {
+      body = "not found\n";
+      status = "404 Not Found";
+      contentType = "text/plain";
+    }
+    conn->send("HTTP/1.1 " + status + "\r\nContent-Type: " + contentType +
+               "\r\nContent-Length: " + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body);
+    conn->shutdown();
+  });
+}
+
+void RpcProvider::EnqueueOrdered(const std::shared_ptr<ConnectionQueue> &queue, std::function<void()> task) {
   {
-    // 序列化成功后，通过网络把rpc方法执行的结果发送会rpc的调用方
-    conn->send(response_str);
+    std::lock_guard<std::mutex> lk(queue->m_mtx);
+    queue->m_tasks.push_back(std::move(task));
+    if (queue->m_running) {
+      return;  // 正在执行的worker会接着执行它
+    }
+    queue->m_running = true;
+  }
+  m_workers->scheduler([this, queue]() { DrainOrdered(queue); });
+}
+
+void RpcProvider::DrainOrdered(const std::shared_ptr<ConnectionQueue> &queue) {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::lock_guard<std::mutex> lk(queue->m_mtx);
+      if (queue->m_tasks.empty()) {
+        queue->m_running = false;
+        return;
+      }
+      task = std::move(queue->m_tasks.front());
+      queue->m_tasks.pop_front();
+    }
+    task();
+  }
+}
+
+// Closure的回调操作，用于序列化rpc的响应和网络发送,发送响应回去
+void RpcProvider::SendRpcResponse(const muduo::net::TcpConnectionPtr &conn, uint64_t requestId, uint32_t methodId,
+                                  uint32_t compressType, google::protobuf::Message *response) {
+  RPC::RpcHeader rpcHeader;
+  rpcHeader.set_request_id(requestId);
+  rpcHeader.set_method_id(methodId);
+  // 每个响应都带上，客户端重连之后第一个响应就能知道
+  rpcHeader.set_accept_compress(RpcSupportedCompressions());
+  size_t response_size = response->ByteSizeLong();
+  std::string compressed;
+  if (compressType != RPC_COMPRESS_NONE && response_size >= RPC_COMPRESS_MIN_SIZE) {
+    std::string raw(response_size, '\0');
+    response->SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(&raw[0]));
+    if (RpcCompress(compressType, raw.data(), raw.size(), &compressed)) {
+      rpcHeader.set_compress_type(compressType);
+      rpcHeader.set_raw_size(static_cast<uint32_t>(response_size));
+      response_size = compressed.size();
+    }
+  }
+  size_t header_size = rpcHeader.ByteSizeLong();
+  size_t frame_size =
+      google::protobuf::io::CodedOutputStream::VarintSize32(static_cast<uint32_t>(header_size)) + header_size +
+      response_size;
+
+  // frame_len + header_size + header(request_id method_id ...) + response，全部直接序列化进发送用的Buffer
+  muduo::net::Buffer frame;
+  frame.ensureWritableBytes(frame_size);
+  uint8_t *out = reinterpret_cast<uint8_t *>(frame.beginWrite());
+  out = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(header_size), out);
+  out = rpcHeader.SerializeWithCachedSizesToArray(out);
+  // 上面的ByteSizeLong已经缓存了各字段的大小，这里不会再算一遍
+  if (rpcHeader.compress_type() != RPC_COMPRESS_NONE) {
+    memcpy(out, compressed.data(), compressed.size());
   } else {
-    std::cout << "serialize response_str error!" << std::endl;
+    response->SerializeWithCachedSizesToArray(out);  // response进行序列化
   }
+  frame.hasWritten(frame_size);
+  frame.prependInt32(static_cast<int32_t>(frame_size));
+  rpcMetrics().sentBytes->add(frame.readableBytes());
+  // 序列化成功后，通过网络把rpc方法执行的结果发送会rpc的调用方
+  conn->send(&frame);
   //    conn->shutdown(); // 模拟http的短链接服务，由rpcprovider主动断开连接  //改为长连接，不主动断开
 }
 
@@ -0,0 +1,192 @@
+//
+// Created by swx on 24-3-2.
+//
+
+#ifndef EPOCH_RECLAIMER_H
+#define EPOCH_RECLAIMER_H
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+// Max number of threads that can be inside an epoch at the same time
+constexpr int EPOCH_MAX_THREADS = 256;
+// Try to free retired objects every EPOCH_RECLAIM_BATCH retirements
+constexpr int EPOCH_RECLAIM_BATCH = 64;
+
+// Process wide table of thread slots, every thread that touches an EpochReclaimer
+// owns one slot index and gives it back when it exits
+inline std::atomic<bool> g_epochSlotUsed[EPOCH_MAX_THREADS];
+
+class EpochThreadSlot {
+ public:
+  EpochThreadSlot() : m_index(-1) {
+    for (int i = 0; i < EPOCH_MAX_THREADS; ++i) {
+      bool expected = false;
+      if (!g_epochSlotUsed[i].load(std::memory_order_relaxed) &&
+          g_epochSlotUsed[i].compare_exchange_strong(expected, true)) {
+        m_index = i;
+        return;
+      }
+    }
+  }
+  ~EpochThreadSlot() {
+    if (m_index >= 0) {
+      g_epochSlotUsed[m_index].store(false);
+    }
+  }
+  int index() const { return m_index; }
+
+  static int Current() {
+    static thread_local EpochThreadSlot slot;
+    return slot.index();
+  }
+
+ private:
+  int m_index;
+};
+
+/**
+ * Epoch based memory reclamation.
+ * Readers pin the current global epoch before touching shared nodes, writers retire
+ * unlinked nodes with the epoch they were retired at. A retired object is freed only
+ * when every pinned reader entered after its retirement.
+ */
+class EpochReclaimer {
+ public:
+  EpochReclaimer() : m_globalEpoch(1), m_fallbackReaders(0), m_retireCount(0) {
+    for (auto &slot : m_active) {
+      slot.store(0, std::memory_order_relaxed);
+    }
+  }
+  ~EpochReclaimer() { drain(); }
+  EpochReclaimer(const EpochReclaimer &) = delete;
+  EpochReclaimer &operator=(const EpochReclaimer &) = delete;
+
+  // RAII guard, nested guards on the same thread only pin once
+  class Guard {
+   public:
+    explicit Guard(EpochReclaimer &reclaimer) : m_reclaimer(reclaimer), m_slot(EpochThreadSlot::Current()), m_owner(false) {
+      if (m_slot < 0) {
+        // no free slot, block reclamation entirely while this reader is inside
+        m_reclaimer.m_fallbackReaders.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_owner = true;
+        return;
+      }
+      auto &active = m_reclaimer.m_active[m_slot];
+      if (active.load(std::memory_order_relaxed) == 0) {
+        active.store(m_reclaimer.m_globalEpoch.load());
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_owner = true;
+      }
+    }
+    ~Guard() {
+      if (!m_owner) {
+        return;
+      }
+      if (m_slot < 0) {
+        m_reclaimer.m_fallbackReaders.fetch_sub(1, std::memory_order_release);
+        return;
+      }
+      m_reclaimer.m_active[m_slot].store(0, std::memory_order_release);
+    }
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+
+   private:
+    EpochReclaimer &m_reclaimer;
+    int m_slot;
+    bool m_owner;
+  };
+
+  // ptr must already be unreachable for new readers
+  template <typename T>
+  void retire(T *ptr) {
+    retire(static_cast<void *>(ptr), [](void *p, void *) { delete static_cast<T *>(p); }, nullptr);
+  }
+
+  // deleter is called as deleter(ptr, ctx)
+  void retire(void *ptr, void (*deleter)(void *, void *), void *ctx) {
+    uint64_t epoch = m_globalEpoch.fetch_add(1);
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_retired.push_back({ptr, deleter, ctx, epoch});
+    if (++m_retireCount % EPOCH_RECLAIM_BATCH == 0) {
+      reclaimLocked();
+    }
+  }
+
+  // for objects the caller keeps for reuse instead of retiring: mark ptr unreachable now,
+  // the object may be touched again once unseen(returned epoch) is true
+  uint64_t detach_epoch() { return m_globalEpoch.fetch_add(1); }
+
+  // no reader that could have seen an object detached at epoch is still inside
+  bool unseen(uint64_t epoch) const {
+    if (m_fallbackReaders.load() > 0) {
+      return false;
+    }
+    for (auto &slot : m_active) {
+      uint64_t e = slot.load();
+      if (e != 0 && e <= epoch) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // free everything that no reader can see any more
+  void reclaim() {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    reclaimLocked();
+  }
+
+  // free everything regardless of readers, only when nobody can be inside a Guard any more
+  void drain() {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    for (auto &item : m_retired) {
+      item.deleter(item.ptr, item.ctx);
+    }
+    m_retired.clear();
+  }
+
+ private:
+  struct Retired {
+    void *ptr;
+    void (*deleter)(void *, void *);
+    void *ctx;
+    uint64_t epoch;
+  };
+
+  void reclaimLocked() {
+    if (m_fallbackReaders.load() > 0) {
+      return;
+    }
+    uint64_t minActive = std::numeric_limits<uint64_t>::max();
+    for (auto &slot : m_active) {
+      uint64_t e = slot.load();
+      if (e != 0 && e < minActive) {
+        minActive = e;
+      }
+    }
+    size_t kept = 0;
+    for (size_t i = 0; i < m_retired.size(); ++i) {
+      if (m_retired[i].epoch < minActive) {
+        m_retired[i].deleter(m_retired[i].ptr, m_retired[i].ctx);
+      } else {
+        m_retired[kept++] = m_retired[i];
+      }
+    }
+    m_retired.resize(kept);
+  }
+
+  std::atomic<uint64_t> m_globalEpoch;
+  std::atomic<uint64_t> m_active[EPOCH_MAX_THREADS];
+  std::atomic<int> m_fallbackReaders;
+  std::mutex m_mtx;
+  std::vector<Retired> m_retired;
+  uint64_t m_retireCount;
+};
+
+#endif  // EPOCH_RECLAIMER_H
@@ -12,74 +12,265 @@
 > Description:
  ************************************************************************/
 
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include "epochReclaimer.h"
+#include "skipListArena.h"
+#include "skipListIndex.h"
+#include "snapshotCodec.h"
 
 #define STORE_FILE "store/dumpFile"
 
+// Height of the header tower, the level a new node may draw is further capped by
+// the element count (about log2(size)), so a small list stays low and a big one still
+// gets enough levels
+constexpr int SKIPLIST_MAX_LEVEL = 32;
+
+// Binary snapshot layout written by dump_file:
+//   "SLS1" | block ... | empty block
+//   block   = fixed32 count | fixed32 payload length | fixed32 crc32(payload) | payload
+//   payload = count * (fixed32 key length | key | fixed32 value length | value), keys ascending
+static const char SKIPLIST_SNAPSHOT_MAGIC[4] = {'S', 'L', 'S', '1'};
+
 static std::string delimiter = ":";
 
 // Class template to implement node
+// forward pointers carry a delete mark in their lowest bit (Harris style), a marked
+// forward[i] means this node is logically deleted at level i.
+// A node is a single arena block: the node itself followed by its level + 1 forward
+// slots, the first value is stored inline as well, so short std::string keys and
+// values (SSO) need no allocation of their own.
 template <typename K, typename V>
 class Node {
  public:
-  Node() {}
+  static Node<K, V> *create(SkipListArena &arena, const K &k, const V &v, int level);
 
-  Node(K k, V v, int);
+  // run the destructors and give the block back to arena,
+  // arena == nullptr means the whole arena is about to be released anyway
+  static void destroy(Node<K, V> *node, SkipListArena *arena);
 
-  ~Node();
+  // EpochReclaimer deleter, ctx is the SkipListArena the node came from
+  static void reclaim(void *node, void *arena);
 
   K get_key() const;
 
+  // the key never changes after creation, no copy needed
+  const K &key_ref() const { return key; }
+
+  // logically deleted, i.e. level 0 is marked
+  bool deleted() const;
+
   V get_value() const;
 
-  void set_value(V);
+  // the current value without a copy, only valid while the caller holds an epoch guard
+  const V &value_ref() const { return *value.load(std::memory_order_acquire); }
+
+  // replace the value with a copy of v, the returned handle must be passed to
+  // reclaim_value once no reader can see the old value any more
+  void *swap_value(SkipListArena &arena, const V &v);
+  // same, moving v into the new slot
+  void *swap_value(SkipListArena &arena, V &&v);
+
+  // append suffix to the value: the slot replaced by the previous append is kept as a spare,
+  // once no reader can see it any more it only needs the bytes it is behind and the suffix,
+  // so repeated appends to one key cost O(suffix) instead of copying the whole value each time
+  void append_value(SkipListArena &arena, EpochReclaimer &reclaimer, const V &suffix);
+
+  // hand out the spare slot (nullptr if none) for reclaim_value, any write other than
+  // append_value must drop it since the spare is no longer a prefix of the value
+  void *take_spare();
+
+  // EpochReclaimer deleter for the handle returned by swap_value
+  static void reclaim_value(void *handle, void *arena);
 
-  // Linear array to hold pointers to next node of different level
-  Node<K, V> **forward;
+  // forward[level] without the mark bit
+  Node<K, V> *next(int level) const;
+
+  Node<K, V> *next(int level, bool *marked) const;
+
+  bool cas_next(int level, Node<K, V> *expected, Node<K, V> *desired, bool expectedMark, bool desiredMark);
+
+  // Linear array to hold pointers to next node of different level, points right behind the node
+  std::atomic<uintptr_t> *forward;
 
   int node_level;
 
+  // inserter and remover both hold a reference, whoever drops the last one retires the node
+  std::atomic<int> unlink_refs;
+
  private:
+  Node(const K &k, const V &v, int level);
+  ~Node() = default;
+
+  static size_t block_size(int level) { return sizeof(Node<K, V>) + (level + 1) * sizeof(std::atomic<uintptr_t>); }
+
+  V *inline_value() { return reinterpret_cast<V *>(inline_value_); }
+
+  // tag the inline slot so reclaim_value does not give it back to the arena
+  void *value_handle(V *v) {
+    return reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(v) | uintptr_t(v == inline_value()));
+  }
+
   K key;
-  V value;
+  std::atomic<V *> value;
+  alignas(V) unsigned char inline_value_[sizeof(V)];
+  // writer only: the slot the last append_value replaced, and the epoch it was detached at
+  V *spare_ = nullptr;
+  uint64_t spare_epoch_ = 0;
 };
 
+static_assert(alignof(std::atomic<uintptr_t>) <= ARENA_ALIGN, "arena alignment too small");
+
 template <typename K, typename V>
-Node<K, V>::Node(const K k, const V v, int level) {
-  this->key = k;
-  this->value = v;
+Node<K, V>::Node(const K &k, const V &v, int level) : unlink_refs(2), key(k) {
   this->node_level = level;
 
   // level + 1, because array index is from 0 - level
-  this->forward = new Node<K, V> *[level + 1];
+  this->forward = reinterpret_cast<std::atomic<uintptr_t> *>(this + 1);
 
   // Fill forward array with 0(NULL)
-  memset(this->forward, 0, sizeof(Node<K, V> *) * (level + 1));
+  for (int i = 0; i <= level; i++) {
+    new (&this->forward[i]) std::atomic<uintptr_t>(0);
+  }
+  value.store(new (inline_value_) V(v), std::memory_order_relaxed);
 };
 
 template <typename K, typename V>
-Node<K, V>::~Node() {
-  delete[] forward;
-};
+Node<K, V> *Node<K, V>::create(SkipListArena &arena, const K &k, const V &v, int level) {
+  static_assert(alignof(Node<K, V>) <= ARENA_ALIGN, "arena alignment too small");
+  void *block = arena.allocate(block_size(level));
+  return new (block) Node<K, V>(k, v, level);
+}
+
+template <typename K, typename V>
+void Node<K, V>::destroy(Node<K, V> *node, SkipListArena *arena) {
+  int level = node->node_level;
+  for (V *cur : {node->value.load(std::memory_order_relaxed), node->spare_}) {
+    if (cur == nullptr) {
+      continue;
+    }
+    cur->~V();
+    if (cur != node->inline_value() && arena != nullptr) {
+      arena->deallocate(cur, sizeof(V));
+    }
+  }
+  node->~Node();
+  if (arena != nullptr) {
+    arena->deallocate(node, block_size(level));
+  }
+}
+
+template <typename K, typename V>
+void Node<K, V>::reclaim(void *node, void *arena) {
+  destroy(static_cast<Node<K, V> *>(node), static_cast<SkipListArena *>(arena));
+}
 
 template <typename K, typename V>
 K Node<K, V>::get_key() const {
   return key;
 };
 
+template <typename K, typename V>
+bool Node<K, V>::deleted() const {
+  return forward[0].load(std::memory_order_acquire) & 1;
+}
+
 template <typename K, typename V>
 V Node<K, V>::get_value() const {
-  return value;
+  return *value.load(std::memory_order_acquire);
 };
+
 template <typename K, typename V>
-void Node<K, V>::set_value(V value) {
-  this->value = value;
+void *Node<K, V>::swap_value(SkipListArena &arena, const V &v) {
+  static_assert(alignof(V) >= 2, "low bit of the value pointer is used as a tag");
+  V *newValue = new (arena.allocate(sizeof(V))) V(v);
+  V *old = value.exchange(newValue, std::memory_order_acq_rel);
+  // the inline value lives inside the node, tag it so reclaim_value does not free it
+  return value_handle(old);
 };
+
+template <typename K, typename V>
+void *Node<K, V>::swap_value(SkipListArena &arena, V &&v) {
+  V *newValue = new (arena.allocate(sizeof(V))) V(std::move(v));
+  V *old = value.exchange(newValue, std::memory_order_acq_rel);
+  return value_handle(old);
+}
+
+template <typename K, typename V>
+void Node<K, V>::append_value(SkipListArena &arena, EpochReclaimer &reclaimer, const V &suffix) {
+  const V &cur = *value.load(std::memory_order_relaxed);
+  V *next = spare_;
+  if (next != nullptr && reclaimer.unseen(spare_epoch_)) {
+    // only appends happened since the spare was published, so it is a prefix of cur
+    next->append(cur, next->size(), V::npos);
+  } else {
+    if (next != nullptr) {
+      reclaimer.retire(take_spare(), &Node<K, V>::reclaim_value, &arena);
+    }
+    next = new (arena.allocate(sizeof(V))) V();
+    next->reserve(2 * (cur.size() + suffix.size()));
+    next->append(cur);
+  }
+  next->append(suffix);
+  spare_ = value.exchange(next, std::memory_order_acq_rel);
+  spare_epoch_ = reclaimer.detach_epoch();
+}
+
+template <typename K, typename V>
+void *Node<K, V>::take_spare() {
+  if (spare_ == nullptr) {
+    return nullptr;
+  }
+  void *handle = value_handle(spare_);
+  spare_ = nullptr;
+  return handle;
+}
+
+template <typename K, typename V>
+void Node<K, V>::reclaim_value(void *handle, void *arena) {
+  uintptr_t raw = reinterpret_cast<uintptr_t>(handle);
+  V *old = reinterpret_cast<V *>(raw & ~uintptr_t(1));
+  old->~V();
+  if (!(raw & 1)) {
+    static_cast<SkipListArena *>(arena)->deallocate(old, sizeof(V));
+  }
+}
+
+template <typename K, typename V>
+Node<K, V> *Node<K, V>::next(int level) const {
+  return reinterpret_cast<Node<K, V> *>(forward[level].load(std::memory_order_acquire) & ~uintptr_t(1));
+}
+
+template <typename K, typename V>
+Node<K, V> *Node<K, V>::next(int level, bool *marked) const {
+  uintptr_t raw = forward[level].load(std::memory_order_acquire);
+  *marked = raw & 1;
+  return reinterpret_cast<Node<K, V> *>(raw & ~uintptr_t(1));
+}
+
+template <typename K, typename V>
+bool Node<K, V>::cas_next(int level, Node<K, V> *expected, Node<K, V> *desired, bool expectedMark,
+                          bool desiredMark) {
+  uintptr_t e = reinterpret_cast<uintptr_t>(expected) | uintptr_t(expectedMark);
+  uintptr_t d = reinterpret_cast<uintptr_t>(desired) | uintptr_t(desiredMark);
+  return forward[level].compare_exchange_strong(e, d, std::memory_order_acq_rel, std::memory_order_acquire);
+}
 // Class template to implement node
 template <typename K, typename V>
 class SkipListDump {
@@ -98,10 +289,15 @@ class SkipListDump {
   void insert(const Node<K, V> &node);
 };
 // Class template for Skip list
+// Readers (search_element, dump_file, display_list) never take a lock, writers link and
+// unlink nodes level by level with CAS, unlinked nodes and replaced values are
+// reclaimed through _reclaimer once no reader can still see them.
+// With hash_index search_element goes through a SkipListHashIndex kept next to the list,
+// the list itself then only serves ordered walks (Iterator, dumps)
 template <typename K, typename V>
 class SkipList {
  public:
-  SkipList(int);
+  explicit SkipList(int max_level = SKIPLIST_MAX_LEVEL, bool hash_index = false);
   ~SkipList();
   int get_random_level();
   Node<K, V> *create_node(K, V, int);
@@ -110,43 +306,234 @@ class SkipList {
   bool search_element(K, V &value);
   void delete_element(K);
   void insert_set_element(K &, V &);
+  // read-modify-write of one key: fn(const V *current, V *next) gets nullptr when the key is
+  // absent and returns false to leave it alone; returns whether the key was written
+  template <typename Fn>
+  bool update_element(const K &key, Fn fn);
+  // value += suffix without copying the whole value each time, see Node::append_value
+  void append_element(const K &key, const V &suffix);
   std::string dump_file();
-  void load_file(const std::string &dumpStr);
-  //递归删除节点
-  void clear(Node<K, V> *);
+  // append the binary snapshot of the list to out
+  void dump_to(std::string *out);
+  // replace the content with a snapshot, returns false (list untouched) on a corrupted one
+  bool load_file(const std::string &dumpStr);
+  bool load_from(const char *data, size_t len);
+
+  // 时间点一致的后台快照：begin_snapshot确定时间点，之后dump_snapshot可以在其他线程里
+  // 与写操作并发执行，写出的内容等于调用begin_snapshot时的状态。
+  // 要求写操作是单线程的（KvServer中只有apply线程在写），clear/load_file不能与之并发。
+  // 同一时间只能有一个快照，已经有快照在进行时begin_snapshot返回false
+  bool begin_snapshot();
+  void dump_snapshot(std::string *out);
+  // 丢弃全部节点，整块arena交给_reclaimer延迟释放，不能与其他写操作并发
+  void clear();
   int size();
 
+  // Ordered iterator over level 0, pins an epoch for its whole lifetime so the node it
+  // stands on stays valid even if it gets deleted meanwhile; logically deleted nodes
+  // are skipped. Keep it short lived, a long living iterator delays reclamation.
+  class Iterator {
+   public:
+    explicit Iterator(SkipList<K, V> &list);
+    Iterator(const Iterator &) = delete;
+    Iterator &operator=(const Iterator &) = delete;
+
+    bool valid() const { return _node != nullptr; }
+    // position at the first key >= target
+    void seek(const K &target);
+    void seek_to_first();
+    void next();
+    K key() const { return _node->get_key(); }
+    V value() const { return _node->get_value(); }
+
+   private:
+    void skip_deleted();
+
+    EpochReclaimer::Guard _guard;
+    Node<K, V> *_header;
+    Node<K, V> *_node;
+  };
+
  private:
   void get_key_value_from_string(const std::string &str, std::string *key, std::string *value);
   bool is_valid_string(const std::string &str);
+  // fill preds/succs for every level and physically unlink marked nodes on the way
+  bool find(const K &key, Node<K, V> **preds, Node<K, V> **succs);
+  // link a fresh node whose level 0 is already published
+  void link_upper_levels(Node<K, V> *node, Node<K, V> **preds, Node<K, V> **succs);
+  void release_unlink_ref(Node<K, V> *node);
+  // called by writers before they change key while a snapshot is running
+  void preserve_for_snapshot(const K &key);
+  // EpochReclaimer deleter for a list detached by clear
+  static void release_detached(void *header, void *arena);
+  // publish a fully built list and retire the current one
+  void install(Node<K, V> *header, SkipListArena *arena, int level, int count);
+  // old boost text archive snapshots
+  bool load_legacy(const std::string &dumpStr);
+  // random level for a list that holds count elements
+  int random_level_for(int count);
 
  private:
   // Maximum level of the skip list
   int _max_level;
 
-  // current level of skip list
-  int _skip_list_level;
+  // current level of skip list, only grows
+  std::atomic<int> _skip_list_level;
+
+  // pointer to header node, replaced by clear
+  std::atomic<Node<K, V> *> _header;
 
-  // pointer to header node
-  Node<K, V> *_header;
+  // every node of the current list is carved out of this arena
+  SkipListArena *_arena;
 
   // file operator
   std::ofstream _file_writer;
   std::ifstream _file_reader;
 
   // skiplist current element count
-  int _element_count;
-
-  std::mutex _mtx;  // mutex for critical section
+  std::atomic<int> _element_count;
+
+  EpochReclaimer _reclaimer;
+
+  // nullptr without hash_index
+  SkipListHashIndex<K, Node<K, V>> *_index;
+
+  // state of the running dump_snapshot
+  struct SnapshotState {
+    std::mutex mtx;
+    bool started = false;
+    // every key <= cursor has already been written by the walk
+    K cursor;
+    // key -> (existed at begin_snapshot, value at begin_snapshot), only keys ahead of cursor
+    std::map<K, std::pair<bool, V>> undo;
+  };
+  std::atomic<bool> _snapshotActive{false};
+  SnapshotState _snapshot;
 };
 
+template <typename K, typename V>
+SkipList<K, V>::Iterator::Iterator(SkipList<K, V> &list)
+    : _guard(list._reclaimer), _header(list._header.load(std::memory_order_acquire)), _node(nullptr) {}
+
+template <typename K, typename V>
+void SkipList<K, V>::Iterator::seek(const K &target) {
+  Node<K, V> *pred = _header;
+  Node<K, V> *current = nullptr;
+  for (int i = _header->node_level; i >= 0; i--) {
+    current = pred->next(i);
+    while (current != nullptr) {
+      bool marked = false;
+      Node<K, V> *succ = current->next(i, &marked);
+      if (marked) {
+        current = succ;
+        continue;
+      }
+      if (!(current->get_key() < target)) {
+        break;
+      }
+      pred = current;
+      current = succ;
+    }
+  }
+  _node = current;
+  skip_deleted();
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::Iterator::seek_to_first() {
+  _node = _header->next(0);
+  skip_deleted();
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::Iterator::next() {
+  _node = _node->next(0);
+  skip_deleted();
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::Iterator::skip_deleted() {
+  while (_node != nullptr) {
+    bool marked = false;
+    Node<K, V> *succ = _node->next(0, &marked);
+    if (!marked) {
+      return;
+    }
+    _node = succ;
+  }
+}
+
 // create new node
 template <typename K, typename V>
 Node<K, V> *SkipList<K, V>::create_node(const K k, const V v, int level) {
-  Node<K, V> *n = new Node<K, V>(k, v, level);
+  Node<K, V> *n = Node<K, V>::create(*_arena, k, v, level);
   return n;
 }
 
+template <typename K, typename V>
+bool SkipList<K, V>::find(const K &key, Node<K, V> **preds, Node<K, V> **succs) {
+retry:
+  Node<K, V> *pred = _header.load(std::memory_order_acquire);
+  for (int i = _max_level; i >= 0; i--) {
+    Node<K, V> *current = pred->next(i);
+    while (current != nullptr) {
+      bool marked = false;
+      Node<K, V> *succ = current->next(i, &marked);
+      while (marked) {
+        // current is logically deleted at this level, help to unlink it
+        if (!pred->cas_next(i, current, succ, false, false)) {
+          goto retry;
+        }
+        current = succ;
+        if (current == nullptr) {
+          break;
+        }
+        succ = current->next(i, &marked);
+      }
+      if (current == nullptr || !(current->get_key() < key)) {
+        break;
+      }
+      pred = current;
+      current = succ;
+    }
+    preds[i] = pred;
+    succs[i] = current;
+  }
+  return succs[0] != nullptr && succs[0]->get_key() == key;
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::link_upper_levels(Node<K, V> *node, Node<K, V> **preds, Node<K, V> **succs) {
+  for (int i = 1; i <= node->node_level; i++) {
+    while (true) {
+      bool marked = false;
+      Node<K, V> *oldNext = node->next(i, &marked);
+      if (marked) {
+        // removed while we were linking, stop here
+        return;
+      }
+      if (oldNext != succs[i] && !node->cas_next(i, oldNext, succs[i], false, false)) {
+        return;
+      }
+      if (preds[i]->cas_next(i, succs[i], node, false, false)) {
+        break;
+      }
+      find(node->get_key(), preds, succs);
+      if (succs[0] != node) {
+        // node is no longer reachable from level 0
+        return;
+      }
+    }
+  }
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::release_unlink_ref(Node<K, V> *node) {
+  if (node->unlink_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    _reclaimer.retire(node, &Node<K, V>::reclaim, _arena);
+  }
+}
+
 // Insert given key and value in skip list
 // return 1 means element exists
 // return 0 means insert successfully
@@ -172,58 +559,61 @@ level 0         1    4   9 10         30   40  | 50 |  60      70       100
 */
 template <typename K, typename V>
 int SkipList<K, V>::insert_element(const K key, const V value) {
-  _mtx.lock();
-  Node<K, V> *current = this->_header;
+  EpochReclaimer::Guard guard(_reclaimer);
+  preserve_for_snapshot(key);
 
   // create update array and initialize it
   // update is array which put node that the node->forward[i] should be operated later
   Node<K, V> *update[_max_level + 1];
-  memset(update, 0, sizeof(Node<K, V> *) * (_max_level + 1));
-
-  // start form highest level of skip list
-  for (int i = _skip_list_level; i >= 0; i--) {
-    while (current->forward[i] != NULL && current->forward[i]->get_key() < key) {
-      current = current->forward[i];
+  Node<K, V> *succs[_max_level + 1];
+
+  // Generate a random level for node
+  int random_level = get_random_level();
+  Node<K, V> *inserted_node = nullptr;
+
+  while (true) {
+    // if current node have key equal to searched key, we get it
+    if (find(key, update, succs)) {
+      if (inserted_node != nullptr) {
+        // never published, nobody else can see it
+        Node<K, V>::destroy(inserted_node, _arena);
+      }
+      return 1;
     }
-    update[i] = current;
-  }
 
-  // reached level 0 and forward pointer to right node, which is desired to insert key.
-  current = current->forward[0];
+    if (inserted_node == nullptr) {
+      // create new node with random level generated
+      inserted_node = create_node(key, value, random_level);
+    }
+    for (int i = 0; i <= random_level; i++) {
+      inserted_node->forward[i].store(reinterpret_cast<uintptr_t>(succs[i]), std::memory_order_relaxed);
+    }
 
-  // if current node have key equal to searched key, we get it
-  if (current != NULL && current->get_key() == key) {
-    std::cout << "key: " << key << ", exists" << std::endl;
-    _mtx.unlock();
-    return 1;
-  }
-
-  // if current is NULL that means we have reached to end of the level
-  // if current's key is not equal to key that means we have to insert node between update[0] and current node
-  if (current == NULL || current->get_key() != key) {
-    // Generate a random level for node
-    int random_level = get_random_level();
-
-    // If random level is greater thar skip list's current level, initialize update value with pointer to header
-    if (random_level > _skip_list_level) {
-      for (int i = _skip_list_level + 1; i < random_level + 1; i++) {
-        update[i] = _header;
-      }
-      _skip_list_level = random_level;
+    // level 0 decides whether the node is in the list
+    if (update[0]->cas_next(0, succs[0], inserted_node, false, false)) {
+      break;
     }
+  }
 
-    // create new node with random level generated
-    Node<K, V> *inserted_node = create_node(key, value, random_level);
+  // If random level is greater thar skip list's current level, raise the level hint
+  int level = _skip_list_level.load(std::memory_order_relaxed);
+  while (random_level > level && !_skip_list_level.compare_exchange_weak(level, random_level)) {
+  }
 
-    // insert node
-    for (int i = 0; i <= random_level; i++) {
-      inserted_node->forward[i] = update[i]->forward[i];
-      update[i]->forward[i] = inserted_node;
-    }
-    std::cout << "Successfully inserted key:" << key << ", value:" << value << std::endl;
-    _element_count++;
+  // insert node
+  link_upper_levels(inserted_node, update, succs);
+  bool marked = false;
+  inserted_node->next(0, &marked);
+  if (marked) {
+    // a concurrent delete may have missed the levels we linked afterwards
+    find(key, update, succs);
   }
-  _mtx.unlock();
+  if (_index != nullptr) {
+    _index->insert(inserted_node);
+  }
+  release_unlink_ref(inserted_node);
+
+  _element_count++;
   return 0;
 }
 
@@ -232,72 +622,309 @@ template <typename K, typename V>
 void SkipList<K, V>::display_list() {
   std::cout << "\n*****Skip List*****"
             << "\n";
-  for (int i = 0; i <= _skip_list_level; i++) {
-    Node<K, V> *node = this->_header->forward[i];
+  EpochReclaimer::Guard guard(_reclaimer);
+  int level = _skip_list_level.load(std::memory_order_acquire);
+  for (int i = 0; i <= level; i++) {
+    Node<K, V> *node = this->_header.load(std::memory_order_acquire)->next(i);
     std::cout << "Level " << i << ": ";
     while (node != NULL) {
-      std::cout << node->get_key() << ":" << node->get_value() << ";";
-      node = node->forward[i];
+      bool marked = false;
+      Node<K, V> *succ = node->next(i, &marked);
+      if (!marked) {
+        std::cout << node->get_key() << ":" << node->get_value() << ";";
+      }
+      node = succ;
     }
     std::cout << std::endl;
   }
 }
 
-// todo 对dump 和 load 后面可能要考虑加锁的问题
 // Dump data in memory to file
+// 直接在level 0上遍历写出，不需要加锁，得到的是遍历过程中的一个有序视图
 template <typename K, typename V>
 std::string SkipList<K, V>::dump_file() {
-  // std::cout << "dump_file-----------------" << std::endl;
-  //
-  //
-  // _file_writer.open(STORE_FILE);
-  Node<K, V> *node = this->_header->forward[0];
-  SkipListDump<K, V> dumper;
+  std::string out;
+  dump_to(&out);
+  return out;
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::dump_to(std::string *out) {
+  out->append(SKIPLIST_SNAPSHOT_MAGIC, sizeof(SKIPLIST_SNAPSHOT_MAGIC));
+  SnapshotBlockWriter writer(out);
+
+  EpochReclaimer::Guard guard(_reclaimer);
+  Node<K, V> *node = this->_header.load(std::memory_order_acquire)->next(0);
   while (node != nullptr) {
-    dumper.insert(*node);
-    // _file_writer << node->get_key() << ":" << node->get_value() << "\n";
-    // std::cout << node->get_key() << ":" << node->get_value() << ";\n";
-    node = node->forward[0];
+    bool marked = false;
+    Node<K, V> *succ = node->next(0, &marked);
+    if (!marked) {
+      writer.add(node->get_key(), node->get_value());
+    }
+    node = succ;
   }
-  std::stringstream ss;
-  boost::archive::text_oarchive oa(ss);
-  oa << dumper;
-  return ss.str();
-  // _file_writer.flush();
-  // _file_writer.close();
+  writer.finish();
 }
 
-// Load data from disk
 template <typename K, typename V>
-void SkipList<K, V>::load_file(const std::string &dumpStr) {
-  // _file_reader.open(STORE_FILE);
-  // std::cout << "load_file-----------------" << std::endl;
-  // std::string line;
-  // std::string* key = new std::string();
-  // std::string* value = new std::string();
-  // while (getline(_file_reader, line)) {
-  //     get_key_value_from_string(line, key, value);
-  //     if (key->empty() || value->empty()) {
-  //         continue;
-  //     }
-  //     // Define key as int type
-  //     insert_element(stoi(*key), *value);
-  //     std::cout << "key:" << *key << "value:" << *value << std::endl;
-  // }
-  // delete key;
-  // delete value;
-  // _file_reader.close();
-
-  if (dumpStr.empty()) {
+bool SkipList<K, V>::begin_snapshot() {
+  std::lock_guard<std::mutex> lg(_snapshot.mtx);
+  if (_snapshotActive.load()) {
+    return false;
+  }
+  _snapshot.started = false;
+  _snapshot.undo.clear();
+  _snapshotActive.store(true);
+  return true;
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::preserve_for_snapshot(const K &key) {
+  if (!_snapshotActive.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lg(_snapshot.mtx);
+  if (!_snapshotActive.load(std::memory_order_relaxed)) {
+    return;
+  }
+  if (_snapshot.started && !(_snapshot.cursor < key)) {
+    // the walk already went past this key, it has written the old state
+    return;
+  }
+  if (_snapshot.undo.count(key) > 0) {
+    // only the value at begin_snapshot matters
     return;
   }
+  Iterator it(*this);
+  it.seek(key);
+  if (it.valid() && it.key() == key) {
+    _snapshot.undo.emplace(key, std::make_pair(true, it.value()));
+  } else {
+    _snapshot.undo.emplace(key, std::make_pair(false, V()));
+  }
+}
+
+// The walk and the writers meet under _snapshot.mtx: for every key the walk either reads the
+// live value before any writer touched it, or finds the old value a writer saved in undo.
+// Keys that were removed before the walk reached them only live in undo and are merged in
+// key order, so the output stays sorted for load_from.
+template <typename K, typename V>
+void SkipList<K, V>::dump_snapshot(std::string *out) {
+  out->append(SKIPLIST_SNAPSHOT_MAGIC, sizeof(SKIPLIST_SNAPSHOT_MAGIC));
+  SnapshotBlockWriter writer(out);
+  auto &undo = _snapshot.undo;
+
+  EpochReclaimer::Guard guard(_reclaimer);
+  Node<K, V> *node = this->_header.load(std::memory_order_acquire)->next(0);
+  while (node != nullptr) {
+    bool marked = false;
+    Node<K, V> *succ = node->next(0, &marked);
+    if (!marked) {
+      K key = node->get_key();
+      std::lock_guard<std::mutex> lg(_snapshot.mtx);
+      _snapshot.started = true;
+      _snapshot.cursor = key;
+      auto it = undo.begin();
+      for (; it != undo.end() && it->first < key; it = undo.erase(it)) {
+        if (it->second.first) {
+          writer.add(it->first, it->second.second);
+        }
+      }
+      if (it != undo.end() && it->first == key) {
+        if (it->second.first) {
+          writer.add(key, it->second.second);
+        }
+        undo.erase(it);
+      } else {
+        writer.add(key, node->get_value());
+      }
+    }
+    node = succ;
+  }
+
+  std::lock_guard<std::mutex> lg(_snapshot.mtx);
+  for (auto &item : undo) {
+    if (item.second.first) {
+      writer.add(item.first, item.second.second);
+    }
+  }
+  writer.finish();
+  undo.clear();
+  _snapshotActive.store(false);
+}
+
+// Load data from disk
+template <typename K, typename V>
+bool SkipList<K, V>::load_file(const std::string &dumpStr) {
+  return load_from(dumpStr.data(), dumpStr.size());
+}
+
+// 输入本身有序，按顺序挂到每一层的尾部即可线性建表，建好之后一次性发布
+// Blocks are independent: one pass over the block headers splits the input, large snapshots are then
+// verified, decoded and turned into nodes by several threads, each into its own arena, and the nodes
+// are finally chained level by level in key order on the calling thread.
+template <typename K, typename V>
+bool SkipList<K, V>::load_from(const char *data, size_t len) {
+  if (len == 0) {
+    return true;
+  }
+  if (len < sizeof(SKIPLIST_SNAPSHOT_MAGIC) ||
+      memcmp(data, SKIPLIST_SNAPSHOT_MAGIC, sizeof(SKIPLIST_SNAPSHOT_MAGIC)) != 0) {
+    return load_legacy(std::string(data, len));
+  }
+  SnapshotReader reader(data + sizeof(SKIPLIST_SNAPSHOT_MAGIC), len - sizeof(SKIPLIST_SNAPSHOT_MAGIC));
+
+  struct Block {
+    const char *payload;
+    uint32_t len;
+    uint32_t count;
+    uint32_t crc;
+  };
+  std::vector<Block> blocks;
+  long long total = 0;
+  while (true) {
+    uint32_t blockCount = 0, payloadLen = 0, crc = 0;
+    if (!reader.GetFixed32(&blockCount) || !reader.GetFixed32(&payloadLen) || !reader.GetFixed32(&crc)) {
+      return false;
+    }
+    if (blockCount == 0) {
+      break;
+    }
+    if (reader.remaining() < payloadLen) {
+      return false;
+    }
+    blocks.push_back({reader.data(), payloadLen, blockCount, crc});
+    reader.Skip(payloadLen);
+    total += blockCount;
+  }
+
+  // the final size is known up front, so every tower gets the same height limit
+  int limit = 1;
+  while (limit < _max_level && (1LL << limit) < total) {
+    limit++;
+  }
+
+  struct Part {
+    SkipListArena *arena = nullptr;
+    std::vector<Node<K, V> *> nodes;
+    bool ok = true;
+  };
+  unsigned threads = 1;
+  if (len >= SNAPSHOT_PARALLEL_LOAD_BYTES) {
+    threads = std::min<unsigned>({std::max(1u, std::thread::hardware_concurrency()), SNAPSHOT_LOAD_MAX_THREADS,
+                                  static_cast<unsigned>(blocks.size())});
+  }
+  std::vector<Part> parts(threads);
+  for (auto &part : parts) {
+    part.arena = new SkipListArena();
+  }
+  auto decode = [&](unsigned t) {
+    Part &part = parts[t];
+    size_t first = blocks.size() * t / threads;
+    size_t last = blocks.size() * (t + 1) / threads;
+    // rand() is shared state, every part draws levels from its own generator
+    std::mt19937 rng(static_cast<uint32_t>(first + 1));
+    K k;
+    V v;
+    for (size_t b = first; b < last && part.ok; b++) {
+      const Block &block = blocks[b];
+      if (Crc32(block.payload, block.len) != block.crc) {
+        part.ok = false;
+        break;
+      }
+      SnapshotReader entries(block.payload, block.len);
+      for (uint32_t i = 0; i < block.count; i++) {
+        if (!DecodeSnapshotField(&entries, &k) || !DecodeSnapshotField(&entries, &v) ||
+            (!part.nodes.empty() && !(part.nodes.back()->key_ref() < k))) {
+          part.ok = false;
+          break;
+        }
+        int nodeLevel = 1;
+        while (nodeLevel < limit && (rng() & 1)) {
+          nodeLevel++;
+        }
+        Node<K, V> *node = Node<K, V>::create(*part.arena, k, v, nodeLevel);
+        // never went through insert_element, only a remover will drop a reference
+        node->unlink_refs.store(1, std::memory_order_relaxed);
+        part.nodes.push_back(node);
+      }
+    }
+  };
+  if (threads == 1) {
+    decode(0);
+  } else {
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; t++) {
+      workers.emplace_back(decode, t);
+    }
+    decode(0);
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  bool ok = true;
+  for (unsigned t = 0; t < threads && ok; t++) {
+    ok = parts[t].ok;
+    // keys must also ascend across the parts
+    if (ok && t > 0 && !parts[t - 1].nodes.empty() && !parts[t].nodes.empty()) {
+      ok = parts[t - 1].nodes.back()->key_ref() < parts[t].nodes.front()->key_ref();
+    }
+  }
+  if (!ok) {
+    for (auto &part : parts) {
+      if (!std::is_trivially_destructible<K>::value || !std::is_trivially_destructible<V>::value) {
+        for (Node<K, V> *node : part.nodes) {
+          Node<K, V>::destroy(node, nullptr);
+        }
+      }
+      delete part.arena;
+    }
+    return false;
+  }
+
+  SkipListArena *arena = parts[0].arena;
+  K k;
+  V v;
+  Node<K, V> *header = Node<K, V>::create(*arena, k, v, _max_level);
+  Node<K, V> *tails[_max_level + 1];
+  for (int i = 0; i <= _max_level; i++) {
+    tails[i] = header;
+  }
+  int level = 0;
+  for (unsigned t = 0; t < threads; t++) {
+    for (Node<K, V> *node : parts[t].nodes) {
+      for (int l = 0; l <= node->node_level; l++) {
+        tails[l]->forward[l].store(reinterpret_cast<uintptr_t>(node), std::memory_order_relaxed);
+        tails[l] = node;
+      }
+      level = std::max(level, node->node_level);
+    }
+    if (t > 0) {
+      arena->absorb(parts[t].arena);
+      delete parts[t].arena;
+    }
+  }
+  install(header, arena, level, static_cast<int>(total));
+  return true;
+}
+
+template <typename K, typename V>
+bool SkipList<K, V>::load_legacy(const std::string &dumpStr) {
   SkipListDump<K, V> dumper;
-  std::stringstream iss(dumpStr);
-  boost::archive::text_iarchive ia(iss);
-  ia >> dumper;
+  try {
+    std::stringstream iss(dumpStr);
+    boost::archive::text_iarchive ia(iss);
+    ia >> dumper;
+  } catch (boost::archive::archive_exception &e) {
+    return false;
+  }
+  // 快照代表完整状态，先丢弃旧数据
+  clear();
   for (int i = 0; i < dumper.keyDumpVt_.size(); ++i) {
-    insert_element(dumper.keyDumpVt_[i], dumper.keyDumpVt_[i]);
+    insert_set_element(dumper.keyDumpVt_[i], dumper.valDumpVt_[i]);
   }
+  return true;
 }
 
 // Get current SkipList size
@@ -329,39 +956,46 @@ bool SkipList<K, V>::is_valid_string(const std::string &str) {
 // Delete element from skip list
 template <typename K, typename V>
 void SkipList<K, V>::delete_element(K key) {
-  _mtx.lock();
-  Node<K, V> *current = this->_header;
+  EpochReclaimer::Guard guard(_reclaimer);
+  preserve_for_snapshot(key);
   Node<K, V> *update[_max_level + 1];
-  memset(update, 0, sizeof(Node<K, V> *) * (_max_level + 1));
+  Node<K, V> *succs[_max_level + 1];
 
-  // start from highest level of skip list
-  for (int i = _skip_list_level; i >= 0; i--) {
-    while (current->forward[i] != NULL && current->forward[i]->get_key() < key) {
-      current = current->forward[i];
+  if (!find(key, update, succs)) {
+    return;
+  }
+  Node<K, V> *current = succs[0];
+
+  // mark from the top level down, the level 0 mark decides which deleter wins
+  for (int i = current->node_level; i >= 1; i--) {
+    bool marked = false;
+    Node<K, V> *succ = current->next(i, &marked);
+    while (!marked) {
+      current->cas_next(i, succ, succ, false, true);
+      succ = current->next(i, &marked);
     }
-    update[i] = current;
   }
-
-  current = current->forward[0];
-  if (current != NULL && current->get_key() == key) {
-    // start for lowest level and delete the current node of each level
-    for (int i = 0; i <= _skip_list_level; i++) {
-      // if at level i, next node is not target node, break the loop.
-      if (update[i]->forward[i] != current) break;
-
-      update[i]->forward[i] = current->forward[i];
+  bool marked = false;
+  Node<K, V> *succ = current->next(0, &marked);
+  while (true) {
+    if (marked) {
+      // someone else deleted it first
+      return;
     }
-
-    // Remove levels which have no elements
-    while (_skip_list_level > 0 && _header->forward[_skip_list_level] == 0) {
-      _skip_list_level--;
+    if (current->cas_next(0, succ, succ, false, true)) {
+      break;
     }
+    succ = current->next(0, &marked);
+  }
 
-    std::cout << "Successfully deleted key " << key << std::endl;
-    delete current;
-    _element_count--;
+  if (_index != nullptr) {
+    _index->erase(current);
   }
-  _mtx.unlock();
+  // physically unlink it from every level
+  find(key, update, succs);
+  release_unlink_ref(current);
+
+  _element_count--;
   return;
 }
 
@@ -372,11 +1006,77 @@ void SkipList<K, V>::delete_element(K key) {
  */
 template <typename K, typename V>
 void SkipList<K, V>::insert_set_element(K &key, V &value) {
-  V oldValue;
-  if (search_element(key, oldValue)) {
-    delete_element(key);
+  EpochReclaimer::Guard guard(_reclaimer);
+  preserve_for_snapshot(key);
+  Node<K, V> *update[_max_level + 1];
+  Node<K, V> *succs[_max_level + 1];
+  while (true) {
+    if (find(key, update, succs)) {
+      // replace the value in place, readers holding the old one keep it alive until they leave
+      void *oldValue = succs[0]->swap_value(*_arena, value);
+      _reclaimer.retire(oldValue, &Node<K, V>::reclaim_value, _arena);
+      if (void *spare = succs[0]->take_spare()) {
+        _reclaimer.retire(spare, &Node<K, V>::reclaim_value, _arena);
+      }
+      return;
+    }
+    if (insert_element(key, value) == 0) {
+      return;
+    }
+  }
+}
+
+/*
+ * update_element reads and replaces a value in one lookup. An existing node keeps its place
+ * and only gets a new value slot (fn's result is moved in), the old slot is retired like in
+ * insert_set_element. Readers never see a half built value. Writers are single threaded
+ * (see begin_snapshot), so the key cannot change between fn and the swap.
+ */
+template <typename K, typename V>
+template <typename Fn>
+bool SkipList<K, V>::update_element(const K &key, Fn fn) {
+  EpochReclaimer::Guard guard(_reclaimer);
+  Node<K, V> *node = _index != nullptr ? _index->find(key) : nullptr;
+  if (node == nullptr || node->deleted()) {
+    Node<K, V> *update[_max_level + 1];
+    Node<K, V> *succs[_max_level + 1];
+    node = find(key, update, succs) ? succs[0] : nullptr;
+  }
+  V next;
+  if (!fn(node != nullptr ? &node->value_ref() : nullptr, &next)) {
+    return false;
+  }
+  preserve_for_snapshot(key);
+  if (node == nullptr) {
+    K k = key;
+    insert_set_element(k, next);
+    return true;
+  }
+  void *oldValue = node->swap_value(*_arena, std::move(next));
+  _reclaimer.retire(oldValue, &Node<K, V>::reclaim_value, _arena);
+  if (void *spare = node->take_spare()) {
+    _reclaimer.retire(spare, &Node<K, V>::reclaim_value, _arena);
+  }
+  return true;
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::append_element(const K &key, const V &suffix) {
+  EpochReclaimer::Guard guard(_reclaimer);
+  Node<K, V> *node = _index != nullptr ? _index->find(key) : nullptr;
+  if (node == nullptr || node->deleted()) {
+    Node<K, V> *update[_max_level + 1];
+    Node<K, V> *succs[_max_level + 1];
+    node = find(key, update, succs) ? succs[0] : nullptr;
   }
-  insert_element(key, value);
+  preserve_for_snapshot(key);
+  if (node == nullptr) {
+    K k = key;
+    V v = suffix;
+    insert_set_element(k, v);
+    return;
+  }
+  node->append_value(*_arena, _reclaimer, suffix);
 }
 
 // Search for element in skip list
@@ -400,27 +1100,49 @@ level 0         1    4   9 10         30   40    50+-->60      70       100
 */
 template <typename K, typename V>
 bool SkipList<K, V>::search_element(K key, V &value) {
-  std::cout << "search_element-----------------" << std::endl;
-  Node<K, V> *current = _header;
-
-  // start from highest level of skip list
-  for (int i = _skip_list_level; i >= 0; i--) {
-    while (current->forward[i] && current->forward[i]->get_key() < key) {
-      current = current->forward[i];
+  EpochReclaimer::Guard guard(_reclaimer);
+  if (_index != nullptr) {
+    Node<K, V> *node = _index->find(key);
+    if (node == nullptr) {
+      return false;
+    }
+    if (!node->deleted()) {
+      value = node->get_value();
+      return true;
+    }
+    // deleted while a re-insert of the same key may not be indexed yet, ask the list
+  }
+  Node<K, V> *pred = _header.load(std::memory_order_acquire);
+  Node<K, V> *current = nullptr;
+
+  // start from highest level of skip list, logically deleted nodes are skipped but not unlinked
+  for (int i = _skip_list_level.load(std::memory_order_acquire); i >= 0; i--) {
+    current = pred->next(i);
+    while (current != nullptr) {
+      bool marked = false;
+      Node<K, V> *succ = current->next(i, &marked);
+      if (marked) {
+        current = succ;
+        continue;
+      }
+      if (!(current->get_key() < key)) {
+        break;
+      }
+      pred = current;
+      current = succ;
     }
   }
-
-  // reached level 0 and advance pointer to right node, which we search
-  current = current->forward[0];
 
   // if current node have key equal to searched key, we get it
-  if (current and current->get_key() == key) {
+  bool marked = false;
+  if (current != nullptr) {
+    current->next(0, &marked);
+  }
+  if (current and !marked and current->get_key() == key) {
     value = current->get_value();
-    std::cout << "Found key: " << key << ", value: " << current->get_value() << std::endl;
     return true;
   }
 
-  std::cout << "Not Found Key:" << key << std::endl;
   return false;
 }
 
@@ -432,15 +1154,17 @@ void SkipListDump<K, V>::insert(const Node<K, V> &node) {
 
 // construct skip list
 template <typename K, typename V>
-SkipList<K, V>::SkipList(int max_level) {
-  this->_max_level = max_level;
+SkipList<K, V>::SkipList(int max_level, bool hash_index) {
+  this->_max_level = std::max(1, std::min(max_level, SKIPLIST_MAX_LEVEL));
   this->_skip_list_level = 0;
   this->_element_count = 0;
 
   // create header node and initialize key and value to null
   K k;
   V v;
-  this->_header = new Node<K, V>(k, v, _max_level);
+  this->_arena = new SkipListArena();
+  this->_header.store(create_node(k, v, _max_level), std::memory_order_relaxed);
+  this->_index = hash_index ? new SkipListHashIndex<K, Node<K, V>>(_reclaimer) : nullptr;
 };
 
 template <typename K, typename V>
@@ -452,28 +1176,68 @@ SkipList<K, V>::~SkipList() {
     _file_reader.close();
   }
 
-  //递归删除跳表链条
-  if (_header->forward[0] != nullptr) {
-    clear(_header->forward[0]);
+  // 析构时已没有并发访问，先释放已退休的节点和旧arena，再整体释放当前arena
+  _reclaimer.drain();
+  delete _index;
+  release_detached(_header.load(std::memory_order_relaxed), _arena);
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::release_detached(void *header, void *arena) {
+  if (!std::is_trivially_destructible<K>::value || !std::is_trivially_destructible<V>::value) {
+    // keys and values may own heap memory, run their destructors, the blocks go with the arena
+    Node<K, V> *node = static_cast<Node<K, V> *>(header);
+    while (node != nullptr) {
+      Node<K, V> *next = node->next(0);
+      Node<K, V>::destroy(node, nullptr);
+      node = next;
+    }
   }
-  delete (_header);
+  delete static_cast<SkipListArena *>(arena);
 }
+
 template <typename K, typename V>
-void SkipList<K, V>::clear(Node<K, V> *cur) {
-  if (cur->forward[0] != nullptr) {
-    clear(cur->forward[0]);
+void SkipList<K, V>::install(Node<K, V> *header, SkipListArena *arena, int level, int count) {
+  Node<K, V> *oldHeader = _header.load(std::memory_order_relaxed);
+  SkipListArena *oldArena = _arena;
+
+  _arena = arena;
+  _skip_list_level.store(level);
+  _element_count.store(count);
+  _header.store(header, std::memory_order_release);
+  if (_index != nullptr) {
+    _index->rebuild(header->next(0), count);
   }
-  delete (cur);
+
+  // readers that still walk the old list keep it alive until they leave
+  _reclaimer.retire(oldHeader, &SkipList<K, V>::release_detached, oldArena);
+}
+
+template <typename K, typename V>
+void SkipList<K, V>::clear() {
+  K k;
+  V v;
+  SkipListArena *arena = new SkipListArena();
+  install(Node<K, V>::create(*arena, k, v, _max_level), arena, 0, 0);
 }
 
 template <typename K, typename V>
 int SkipList<K, V>::get_random_level() {
+  return random_level_for(_element_count.load(std::memory_order_relaxed) + 1);
+};
+
+template <typename K, typename V>
+int SkipList<K, V>::random_level_for(int count) {
+  // with p = 1/2 about log2(count) levels are useful, more only cost header walks
+  int limit = 1;
+  while (limit < _max_level && (1LL << limit) < count) {
+    limit++;
+  }
   int k = 1;
-  while (rand() % 2) {
+  while (k < limit && rand() % 2) {
     k++;
   }
-  k = (k < _max_level) ? k : _max_level;
   return k;
-};
+}
 // vim: et tw=100 ts=4 sw=4 cc=120
 #endif  // SKIPLIST_H
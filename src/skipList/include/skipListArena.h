@@ -0,0 +1,116 @@
+//
+// Created by swx on 24-3-3.
+//
+
+#ifndef SKIPLIST_ARENA_H
+#define SKIPLIST_ARENA_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Size of one arena chunk, blocks larger than this get a chunk of their own
+constexpr size_t ARENA_CHUNK_SIZE = 256 * 1024;
+// Every block is rounded up to this, which is also the alignment the arena guarantees
+constexpr size_t ARENA_ALIGN = 16;
+// Blocks up to this size are recycled through per size class free lists
+constexpr size_t ARENA_MAX_CLASS_SIZE = 1024;
+
+/**
+ * Bump allocator backing one SkipList.
+ * Node header, forward tower and the inline key/value live in one block carved out of
+ * large chunks. Freed blocks go back to a free list of their size class and are reused
+ * by later allocations, the chunks themselves are only released when the arena dies,
+ * so dropping a whole list is one delete of the arena.
+ */
+class SkipListArena {
+ public:
+  SkipListArena() : m_cur(nullptr), m_left(0), m_freeLists(ARENA_MAX_CLASS_SIZE / ARENA_ALIGN + 1, nullptr) {}
+  ~SkipListArena() {
+    for (auto chunk : m_chunks) {
+      std::free(chunk);
+    }
+  }
+  SkipListArena(const SkipListArena &) = delete;
+  SkipListArena &operator=(const SkipListArena &) = delete;
+
+  void *allocate(size_t size) {
+    size = roundUp(size);
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (size <= ARENA_MAX_CLASS_SIZE) {
+      FreeBlock *&head = m_freeLists[size / ARENA_ALIGN];
+      if (head != nullptr) {
+        FreeBlock *block = head;
+        head = block->next;
+        return block;
+      }
+    }
+    if (size > m_left) {
+      if (size > ARENA_CHUNK_SIZE / 4) {
+        // big block, give it its own chunk so the current one is not wasted
+        return newChunk(size);
+      }
+      m_cur = static_cast<char *>(newChunk(ARENA_CHUNK_SIZE));
+      m_left = ARENA_CHUNK_SIZE;
+    }
+    void *p = m_cur;
+    m_cur += size;
+    m_left -= size;
+    return p;
+  }
+
+  // size must be the one passed to allocate
+  void deallocate(void *p, size_t size) {
+    size = roundUp(size);
+    if (size > ARENA_MAX_CLASS_SIZE) {
+      // stays in its chunk until the arena is released
+      return;
+    }
+    std::lock_guard<std::mutex> lg(m_mtx);
+    FreeBlock *block = static_cast<FreeBlock *>(p);
+    block->next = m_freeLists[size / ARENA_ALIGN];
+    m_freeLists[size / ARENA_ALIGN] = block;
+  }
+
+  // take over every chunk of other, blocks carved out of it now belong to this arena;
+  // other must not be used for allocation any more, deleting it frees nothing
+  void absorb(SkipListArena *other) {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::mutex> lgOther(other->m_mtx);
+    m_chunks.insert(m_chunks.end(), other->m_chunks.begin(), other->m_chunks.end());
+    other->m_chunks.clear();
+    other->m_cur = nullptr;
+    other->m_left = 0;
+  }
+
+  size_t chunkCount() {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    return m_chunks.size();
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  static size_t roundUp(size_t size) { return (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1); }
+
+  void *newChunk(size_t size) {
+    void *chunk = std::aligned_alloc(ARENA_ALIGN, size);
+    if (chunk == nullptr) {
+      throw std::bad_alloc();
+    }
+    m_chunks.push_back(chunk);
+    return chunk;
+  }
+
+  std::mutex m_mtx;
+  char *m_cur;
+  size_t m_left;
+  std::vector<FreeBlock *> m_freeLists;
+  std::vector<void *> m_chunks;
+};
+
+#endif  // SKIPLIST_ARENA_H
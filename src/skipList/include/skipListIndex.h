@@ -0,0 +1,186 @@
+//
+// Created by swx on 24-3-9.
+//
+
+#ifndef SKIPLIST_INDEX_H
+#define SKIPLIST_INDEX_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include "epochReclaimer.h"
+
+// Smallest table the index ever allocates, must be a power of two
+constexpr size_t SKIPLIST_INDEX_MIN_CAPACITY = 16;
+
+/**
+ * Open addressing (linear probing) hash table from a key to the skip list node holding it.
+ * Every slot is empty (0), a tombstone (1) or a node pointer, the key is read from the node
+ * itself so the table stays one word per slot.
+ * Readers probe without any lock and must be inside an epoch of the owning list, which keeps
+ * both the nodes and a table replaced by a resize alive. Writers are serialized by m_mtx.
+ * Live entries plus tombstones are kept at most half of the capacity, a probe always ends
+ * at an empty slot.
+ * NodeT needs key_ref() and deleted().
+ */
+template <typename K, typename NodeT>
+class SkipListHashIndex {
+ public:
+  explicit SkipListHashIndex(EpochReclaimer &reclaimer)
+      : m_reclaimer(reclaimer), m_table(new Table(SKIPLIST_INDEX_MIN_CAPACITY)) {}
+  ~SkipListHashIndex() { delete m_table.load(std::memory_order_relaxed); }
+  SkipListHashIndex(const SkipListHashIndex &) = delete;
+  SkipListHashIndex &operator=(const SkipListHashIndex &) = delete;
+
+  // node holding key, nullptr if none, the node may already be logically deleted
+  NodeT *find(const K &key) const {
+    const Table *table = m_table.load(std::memory_order_acquire);
+    for (size_t i = hash(key) & table->mask, n = 0; n <= table->mask; i = (i + 1) & table->mask, ++n) {
+      uintptr_t raw = table->slots[i].load(std::memory_order_acquire);
+      if (raw == kEmpty) {
+        return nullptr;
+      }
+      if (raw != kTombstone && reinterpret_cast<NodeT *>(raw)->key_ref() == key) {
+        return reinterpret_cast<NodeT *>(raw);
+      }
+    }
+    return nullptr;
+  }
+
+  // add node or replace the entry of its key. A node that got deleted before it made it
+  // into the index is skipped: its remover marks it before taking m_mtx, so whichever of
+  // the two comes second under m_mtx sees the other one
+  void insert(NodeT *node) {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (node->deleted()) {
+      return;
+    }
+    Table *table = m_table.load(std::memory_order_relaxed);
+    if ((table->used + 1) * 2 > table->mask + 1) {
+      table = rehash(table, table->live + 1);
+    }
+    put(table, node);
+  }
+
+  // drop the entry of node's key if it still points to node
+  void erase(NodeT *node) {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    Table *table = m_table.load(std::memory_order_relaxed);
+    const K &key = node->key_ref();
+    for (size_t i = hash(key) & table->mask, n = 0; n <= table->mask; i = (i + 1) & table->mask, ++n) {
+      uintptr_t raw = table->slots[i].load(std::memory_order_relaxed);
+      if (raw == kEmpty) {
+        return;
+      }
+      if (raw != kTombstone && reinterpret_cast<NodeT *>(raw)->key_ref() == key) {
+        if (raw == reinterpret_cast<uintptr_t>(node)) {
+          table->slots[i].store(kTombstone, std::memory_order_release);
+          table->live--;
+        }
+        return;
+      }
+    }
+  }
+
+  // index a whole new list from its first level 0 node, count is its element count
+  void rebuild(NodeT *first, size_t count) {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    Table *table = new Table(capacityFor(count));
+    for (NodeT *node = first; node != nullptr; node = node->next(0)) {
+      if (!node->deleted()) {
+        put(table, node);
+      }
+    }
+    publish(table);
+  }
+
+ private:
+  static constexpr uintptr_t kEmpty = 0;
+  static constexpr uintptr_t kTombstone = 1;
+
+  struct Table {
+    explicit Table(size_t capacity)
+        : mask(capacity - 1), used(0), live(0), slots(new std::atomic<uintptr_t>[capacity]) {
+      for (size_t i = 0; i < capacity; ++i) {
+        slots[i].store(kEmpty, std::memory_order_relaxed);
+      }
+    }
+    ~Table() { delete[] slots; }
+
+    size_t mask;
+    size_t used;  // live entries + tombstones, writer only
+    size_t live;
+    std::atomic<uintptr_t> *slots;
+  };
+
+  static size_t hash(const K &key) {
+    // spread the low bits, the mask only keeps those
+    uint64_t h = std::hash<K>()(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+  }
+
+  // room for count entries at a load factor of at most 1/4, so the next resize is far away
+  static size_t capacityFor(size_t count) {
+    size_t capacity = SKIPLIST_INDEX_MIN_CAPACITY;
+    while (capacity < count * 4) {
+      capacity <<= 1;
+    }
+    return capacity;
+  }
+
+  void put(Table *table, NodeT *node) {
+    const K &key = node->key_ref();
+    size_t tombstone = table->mask + 1;
+    for (size_t i = hash(key) & table->mask;; i = (i + 1) & table->mask) {
+      uintptr_t raw = table->slots[i].load(std::memory_order_relaxed);
+      if (raw == kEmpty) {
+        if (tombstone <= table->mask) {
+          i = tombstone;
+        } else {
+          table->used++;
+        }
+        table->live++;
+        table->slots[i].store(reinterpret_cast<uintptr_t>(node), std::memory_order_release);
+        return;
+      }
+      if (raw == kTombstone) {
+        if (tombstone > table->mask) {
+          tombstone = i;
+        }
+      } else if (reinterpret_cast<NodeT *>(raw)->key_ref() == key) {
+        table->slots[i].store(reinterpret_cast<uintptr_t>(node), std::memory_order_release);
+        return;
+      }
+    }
+  }
+
+  // copy the live entries into a table sized for count, tombstones are dropped on the way
+  Table *rehash(Table *table, size_t count) {
+    Table *fresh = new Table(capacityFor(count));
+    for (size_t i = 0; i <= table->mask; ++i) {
+      uintptr_t raw = table->slots[i].load(std::memory_order_relaxed);
+      if (raw != kEmpty && raw != kTombstone) {
+        put(fresh, reinterpret_cast<NodeT *>(raw));
+      }
+    }
+    publish(fresh);
+    return fresh;
+  }
+
+  // readers still probing the old table keep it alive until they leave their epoch
+  void publish(Table *table) {
+    Table *old = m_table.exchange(table, std::memory_order_acq_rel);
+    m_reclaimer.retire(old);
+  }
+
+  EpochReclaimer &m_reclaimer;
+  std::atomic<Table *> m_table;
+  std::mutex m_mtx;
+};
+
+#endif  // SKIPLIST_INDEX_H
@@ -0,0 +1,200 @@
+//
+// Created by swx on 24-3-4.
+//
+
+#ifndef SNAPSHOT_CODEC_H
+#define SNAPSHOT_CODEC_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+// A snapshot block is closed once its payload reaches this size
+constexpr size_t SNAPSHOT_BLOCK_SIZE = 64 * 1024;
+// fixed32 count | fixed32 payload length | fixed32 crc32(payload)
+constexpr size_t SNAPSHOT_BLOCK_HEADER_SIZE = 12;
+// Snapshots at least this large are decoded by several threads, each one a contiguous run of blocks
+constexpr size_t SNAPSHOT_PARALLEL_LOAD_BYTES = 4 * 1024 * 1024;
+constexpr unsigned SNAPSHOT_LOAD_MAX_THREADS = 8;
+
+// Little endian fixed width helpers shared by the SkipList and KvServer snapshot formats
+
+inline void PutFixed32(std::string *dst, uint32_t v) {
+  char buf[4];
+  for (int i = 0; i < 4; ++i) {
+    buf[i] = static_cast<char>((v >> (8 * i)) & 0xff);
+  }
+  dst->append(buf, 4);
+}
+
+inline void PutFixed64(std::string *dst, uint64_t v) {
+  PutFixed32(dst, static_cast<uint32_t>(v));
+  PutFixed32(dst, static_cast<uint32_t>(v >> 32));
+}
+
+inline uint32_t DecodeFixed32(const char *p) {
+  uint32_t v = 0;
+  for (int i = 0; i < 4; ++i) {
+    v |= static_cast<uint32_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+  }
+  return v;
+}
+
+inline void EncodeFixed32(char *p, uint32_t v) {
+  for (int i = 0; i < 4; ++i) {
+    p[i] = static_cast<char>((v >> (8 * i)) & 0xff);
+  }
+}
+
+// CRC-32 (IEEE 802.3, reflected 0xEDB88320)
+// Continues a checksum over more data: Crc32Extend(Crc32(a), b) == Crc32(a + b), Crc32Extend(0, a) == Crc32(a)
+inline uint32_t Crc32Extend(uint32_t crc, const char *data, size_t n) {
+  static const std::array<uint32_t, 256> table = [] {
+    std::array<uint32_t, 256> t{};
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; ++k) {
+        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      t[i] = c;
+    }
+    return t;
+  }();
+  crc ^= 0xFFFFFFFFu;
+  for (size_t i = 0; i < n; ++i) {
+    crc = table[(crc ^ static_cast<unsigned char>(data[i])) & 0xff] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+inline uint32_t Crc32(const char *data, size_t n) { return Crc32Extend(0, data, n); }
+
+// Sequential reader over an encoded buffer, every Get* returns false once the input is exhausted
+class SnapshotReader {
+ public:
+  SnapshotReader(const char *data, size_t len) : m_cur(data), m_end(data + len) {}
+
+  size_t remaining() const { return m_end - m_cur; }
+  const char *data() const { return m_cur; }
+
+  bool Skip(size_t n) {
+    if (remaining() < n) {
+      return false;
+    }
+    m_cur += n;
+    return true;
+  }
+
+  bool GetFixed32(uint32_t *v) {
+    if (remaining() < 4) {
+      return false;
+    }
+    *v = DecodeFixed32(m_cur);
+    m_cur += 4;
+    return true;
+  }
+
+  bool GetFixed64(uint64_t *v) {
+    uint32_t lo = 0;
+    uint32_t hi = 0;
+    if (!GetFixed32(&lo) || !GetFixed32(&hi)) {
+      return false;
+    }
+    *v = static_cast<uint64_t>(hi) << 32 | lo;
+    return true;
+  }
+
+  // length prefixed bytes
+  bool GetBytes(const char **p, uint32_t *len) {
+    if (!GetFixed32(len) || remaining() < *len) {
+      return false;
+    }
+    *p = m_cur;
+    m_cur += *len;
+    return true;
+  }
+
+ private:
+  const char *m_cur;
+  const char *m_end;
+};
+
+// How a key / value type is encoded in a snapshot: std::string as length prefixed bytes,
+// trivially copyable types as their raw bytes with the same length prefix
+template <typename T>
+void EncodeSnapshotField(std::string *dst, const T &v) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    PutFixed32(dst, static_cast<uint32_t>(v.size()));
+    dst->append(v);
+  } else {
+    static_assert(std::is_trivially_copyable<T>::value, "snapshot field must be std::string or trivially copyable");
+    PutFixed32(dst, sizeof(T));
+    dst->append(reinterpret_cast<const char *>(&v), sizeof(T));
+  }
+}
+
+template <typename T>
+bool DecodeSnapshotField(SnapshotReader *reader, T *v) {
+  const char *p = nullptr;
+  uint32_t len = 0;
+  if (!reader->GetBytes(&p, &len)) {
+    return false;
+  }
+  if constexpr (std::is_same<T, std::string>::value) {
+    v->assign(p, len);
+  } else {
+    if (len != sizeof(T)) {
+      return false;
+    }
+    std::memcpy(v, p, sizeof(T));
+  }
+  return true;
+}
+
+// Writes entries as checksummed blocks, finish() must be called once after the last add()
+class SnapshotBlockWriter {
+ public:
+  explicit SnapshotBlockWriter(std::string *out) : m_out(out), m_count(0) { openBlock(); }
+
+  template <typename K, typename V>
+  void add(const K &key, const V &value) {
+    EncodeSnapshotField(m_out, key);
+    EncodeSnapshotField(m_out, value);
+    ++m_count;
+    if (m_out->size() - m_blockStart - SNAPSHOT_BLOCK_HEADER_SIZE >= SNAPSHOT_BLOCK_SIZE) {
+      closeBlock();
+      openBlock();
+    }
+  }
+
+  void finish() {
+    if (m_count > 0) {
+      closeBlock();
+      openBlock();
+    }
+    // the open block is left empty, which terminates the snapshot
+  }
+
+ private:
+  void openBlock() {
+    m_blockStart = m_out->size();
+    m_count = 0;
+    m_out->append(SNAPSHOT_BLOCK_HEADER_SIZE, '\0');
+  }
+
+  void closeBlock() {
+    size_t payload = m_out->size() - m_blockStart - SNAPSHOT_BLOCK_HEADER_SIZE;
+    char *header = &(*m_out)[m_blockStart];
+    EncodeFixed32(header, m_count);
+    EncodeFixed32(header + 4, static_cast<uint32_t>(payload));
+    EncodeFixed32(header + 8, Crc32(header + SNAPSHOT_BLOCK_HEADER_SIZE, payload));
+  }
+
+  std::string *m_out;
+  size_t m_blockStart;
+  uint32_t m_count;
+};
+
+#endif  // SNAPSHOT_CODEC_H